@@ -0,0 +1,331 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Benchmarks of the kernels behind the hot pipeline operators: the hash table of
+// HashJoinBuildSink/HashJoinProbeOperator, the aggregation hash map of AggSinkOperator,
+// the block sort of SortSinkOperator and the hash partitioning of the local exchange.
+// The operators themselves need a full RuntimeState and plan to run, so the kernels are
+// driven directly with synthetic keys. Every benchmark runs on a single thread, so the
+// reported items/s (rows) and bytes/s are per core.
+//
+// Common arguments: rows, distinct keys, skew (percent of rows that hit the hottest key)
+// and null ratio (percent of null keys, only for sort). The template argument selects
+// string keys instead of int64 keys.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/custom_allocator.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/join_hash_table.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+namespace operator_benchmark {
+
+constexpr int BATCH_SIZE = 4064;
+
+// `rows` keys in [0, cardinality), `skew_percent` percent of them are the hottest key 0
+inline std::vector<Int64> generate_keys(size_t rows, int64_t cardinality, int64_t skew_percent,
+                                        uint32_t seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<int64_t> key_dis(0, std::max<int64_t>(cardinality, 1) - 1);
+    std::uniform_int_distribution<int64_t> skew_dis(0, 99);
+    std::vector<Int64> keys(rows);
+    for (auto& key : keys) {
+        key = skew_dis(gen) < skew_percent ? 0 : key_dis(gen);
+    }
+    return keys;
+}
+
+inline MutableColumnPtr make_int_column(const std::vector<Int64>& keys) {
+    auto column = ColumnInt64::create();
+    column->get_data().assign(keys.begin(), keys.end());
+    return column;
+}
+
+inline MutableColumnPtr make_string_column(const std::vector<Int64>& keys) {
+    auto column = ColumnString::create();
+    for (auto key : keys) {
+        auto value = "benchmark_key_" + std::to_string(key);
+        column->insert_data(value.data(), value.size());
+    }
+    return column;
+}
+
+inline MutableColumnPtr make_nullable_column(MutableColumnPtr nested, int64_t null_percent,
+                                             uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int64_t> dis(0, 99);
+    auto null_map = ColumnUInt8::create(nested->size(), 0);
+    for (auto& is_null : null_map->get_data()) {
+        is_null = dis(gen) < null_percent;
+    }
+    return ColumnNullable::create(std::move(nested), std::move(null_map));
+}
+
+template <bool string_key>
+struct KeyData {
+    using Key = std::conditional_t<string_key, StringRef, Int64>;
+    using Hash = std::conditional_t<string_key, DefaultHash<StringRef>, HashCRC32<Int64>>;
+
+    explicit KeyData(const std::vector<Int64>& raw_keys) {
+        if constexpr (string_key) {
+            column = make_string_column(raw_keys);
+            keys.reserve(raw_keys.size());
+            for (size_t i = 0; i < raw_keys.size(); ++i) {
+                keys.push_back(column->get_data_at(i));
+            }
+        } else {
+            column = make_int_column(raw_keys);
+            keys = raw_keys;
+        }
+    }
+
+    MutableColumnPtr column;
+    std::vector<Key> keys;
+};
+
+template <typename HashTable, typename Key>
+void compute_bucket_nums(const HashTable& hash_table, const std::vector<Key>& keys, size_t begin,
+                         DorisVector<uint32_t>& bucket_nums) {
+    const uint32_t bucket_size = hash_table.get_bucket_size();
+    bucket_nums.resize(keys.size());
+    for (size_t i = begin; i < keys.size(); ++i) {
+        bucket_nums[i] = static_cast<uint32_t>(hash_table.hash(keys[i]) & (bucket_size - 1));
+    }
+}
+
+} // namespace operator_benchmark
+
+// args: build rows, distinct keys, skew
+template <bool string_key>
+static void BM_HashJoinBuild(benchmark::State& state) {
+    using namespace operator_benchmark;
+    const auto rows = static_cast<size_t>(state.range(0));
+    // the first row in build side is not really from build side table
+    auto raw_keys = generate_keys(rows + 1, state.range(1), state.range(2), 1);
+    KeyData<string_key> data(raw_keys);
+    using HashTable = JoinHashMap<typename KeyData<string_key>::Key,
+                                  typename KeyData<string_key>::Hash>;
+    DorisVector<uint32_t> bucket_nums;
+
+    for (auto _ : state) {
+        HashTable hash_table;
+        hash_table.template prepare_build<TJoinOp::INNER_JOIN>(rows + 1, BATCH_SIZE, false);
+        compute_bucket_nums(hash_table, data.keys, 1, bucket_nums);
+        hash_table.build(data.keys.data(), bucket_nums.data(), static_cast<uint32_t>(rows + 1),
+                         false);
+        benchmark::DoNotOptimize(hash_table);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.column->byte_size()));
+}
+
+// args: probe rows, distinct keys, skew. The build side holds every distinct key once.
+template <bool string_key>
+static void BM_HashJoinProbe(benchmark::State& state) {
+    using namespace operator_benchmark;
+    const auto rows = static_cast<size_t>(state.range(0));
+    const int64_t cardinality = std::max<int64_t>(state.range(1), 1);
+    std::vector<Int64> raw_build_keys(static_cast<size_t>(cardinality) + 1);
+    std::iota(raw_build_keys.begin() + 1, raw_build_keys.end(), 0);
+    KeyData<string_key> build_data(raw_build_keys);
+    KeyData<string_key> probe_data(generate_keys(rows, cardinality, state.range(2), 2));
+
+    using HashTable = JoinHashMap<typename KeyData<string_key>::Key,
+                                  typename KeyData<string_key>::Hash>;
+    HashTable hash_table;
+    DorisVector<uint32_t> bucket_nums;
+    hash_table.template prepare_build<TJoinOp::INNER_JOIN>(build_data.keys.size(), BATCH_SIZE,
+                                                           false);
+    compute_bucket_nums(hash_table, build_data.keys, 1, bucket_nums);
+    hash_table.build(build_data.keys.data(), bucket_nums.data(),
+                     static_cast<uint32_t>(build_data.keys.size()), false);
+
+    // find_batch may emit one more row than the batch size
+    std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+    const int probe_rows = static_cast<int>(rows);
+    for (auto _ : state) {
+        compute_bucket_nums(hash_table, probe_data.keys, 0, bucket_nums);
+        hash_table.pre_build_idxs(bucket_nums);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        size_t matched_rows = 0;
+        while (probe_idx < probe_rows) {
+            auto [next_probe_idx, next_build_idx, matched_cnt] =
+                    hash_table.template find_batch<TJoinOp::INNER_JOIN>(
+                            probe_data.keys.data(), bucket_nums.data(), probe_idx, build_idx,
+                            probe_rows, probe_idxs.data(), probe_visited, build_idxs.data(),
+                            nullptr, false, false, false);
+            probe_idx = next_probe_idx;
+            build_idx = next_build_idx;
+            matched_rows += matched_cnt;
+        }
+        benchmark::DoNotOptimize(matched_rows);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(
+            static_cast<int64_t>(state.iterations() * probe_data.column->byte_size()));
+}
+
+// args: rows, distinct keys, skew. Counts the rows of each group as a count(*) would.
+template <bool string_key>
+static void BM_AggHashEmplace(benchmark::State& state) {
+    using namespace operator_benchmark;
+    const auto rows = static_cast<size_t>(state.range(0));
+    KeyData<string_key> data(generate_keys(rows, state.range(1), state.range(2), 3));
+    using HashMap = PHHashMap<typename KeyData<string_key>::Key, UInt64,
+                              typename KeyData<string_key>::Hash>;
+
+    for (auto _ : state) {
+        HashMap hash_map;
+        typename HashMap::LookupResult it;
+        for (const auto& key : data.keys) {
+            hash_map.lazy_emplace(key, it, [](const auto& ctor, auto& key_holder) {
+                ctor(key_holder, 0);
+            });
+            ++it->second;
+        }
+        benchmark::DoNotOptimize(hash_map.size());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.column->byte_size()));
+}
+
+// args: rows, distinct keys, skew, null ratio. Sorts the key column with an int64 payload.
+template <bool string_key>
+static void BM_SortBlock(benchmark::State& state) {
+    using namespace operator_benchmark;
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto raw_keys = generate_keys(rows, state.range(1), state.range(2), 4);
+    auto key_column = string_key ? make_string_column(raw_keys) : make_int_column(raw_keys);
+    DataTypePtr key_type = string_key ? DataTypePtr(std::make_shared<DataTypeString>())
+                                      : DataTypePtr(std::make_shared<DataTypeInt64>());
+    if (state.range(3) > 0) {
+        key_column = make_nullable_column(std::move(key_column), state.range(3), 5);
+        key_type = make_nullable(key_type);
+    }
+    std::vector<Int64> payload(rows);
+    std::iota(payload.begin(), payload.end(), 0);
+
+    Block block;
+    block.insert({std::move(key_column), key_type, "key"});
+    block.insert({make_int_column(payload), std::make_shared<DataTypeInt64>(), "payload"});
+    SortDescription description {SortColumnDescription(0, 1, 1)};
+
+    for (auto _ : state) {
+        Block sorted_block = block.clone_empty();
+        sort_block(block, sorted_block, description);
+        benchmark::DoNotOptimize(sorted_block);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * block.bytes()));
+}
+
+// args: rows, distinct keys, skew, partitions. Hashes the key column and distributes the
+// row indexes to the partitions the way the hash shuffle local exchanger does.
+static void BM_LocalExchangeHashShuffle(benchmark::State& state) {
+    using namespace operator_benchmark;
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto partitions = static_cast<uint32_t>(std::max<int64_t>(state.range(3), 1));
+    auto column = make_int_column(generate_keys(rows, state.range(1), state.range(2), 6));
+    std::vector<uint32_t> hashes(rows);
+    std::vector<uint32_t> partition_rows_histogram(partitions + 1);
+    std::vector<uint32_t> row_idx(rows);
+
+    for (auto _ : state) {
+        std::fill(hashes.begin(), hashes.end(), 0);
+        column->update_crcs_with_value(hashes.data(), PrimitiveType::TYPE_BIGINT,
+                                       static_cast<uint32_t>(rows));
+        std::fill(partition_rows_histogram.begin(), partition_rows_histogram.end(), 0);
+        for (auto& hash : hashes) {
+            hash %= partitions;
+            partition_rows_histogram[hash + 1]++;
+        }
+        std::partial_sum(partition_rows_histogram.begin(), partition_rows_histogram.end(),
+                         partition_rows_histogram.begin());
+        for (uint32_t i = 0; i < rows; ++i) {
+            row_idx[partition_rows_histogram[hashes[i]]++] = i;
+        }
+        benchmark::DoNotOptimize(row_idx.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * column->byte_size()));
+}
+
+static void operator_benchmark_key_args(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"rows", "ndv", "skew"});
+    for (int64_t ndv : {1024, 1 << 20}) {
+        for (int64_t skew : {0, 50}) {
+            bench->Args({1 << 20, ndv, skew});
+        }
+    }
+}
+
+static void operator_benchmark_sort_args(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"rows", "ndv", "skew", "null"});
+    for (int64_t ndv : {1024, 1 << 20}) {
+        for (int64_t null_percent : {0, 20}) {
+            bench->Args({1 << 20, ndv, 0, null_percent});
+        }
+    }
+}
+
+static void operator_benchmark_exchange_args(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"rows", "ndv", "skew", "partitions"});
+    for (int64_t skew : {0, 50}) {
+        for (int64_t partitions : {8, 64}) {
+            bench->Args({1 << 20, 1 << 20, skew, partitions});
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_HashJoinBuild, false)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_HashJoinBuild, true)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_HashJoinProbe, false)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_HashJoinProbe, true)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_AggHashEmplace, false)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_AggHashEmplace, true)->Apply(operator_benchmark_key_args);
+BENCHMARK_TEMPLATE(BM_SortBlock, false)->Apply(operator_benchmark_sort_args);
+BENCHMARK_TEMPLATE(BM_SortBlock, true)->Apply(operator_benchmark_sort_args);
+BENCHMARK(BM_LocalExchangeHashShuffle)->Apply(operator_benchmark_exchange_args);
+
+} // namespace doris::vectorized
@@ -431,6 +431,8 @@ Status _submit_task(const TAgentTaskRequest& task,
 }
 
 bvar::LatencyRecorder g_publish_version_latency("doris_pk", "publish_version");
+bvar::IntRecorder g_publish_version_report_batch_size("doris_pk",
+                                                      "publish_version_report_batch_size");
 
 bvar::Adder<uint64_t> ALTER_INVERTED_INDEX_count("task", "ALTER_INVERTED_INDEX");
 bvar::Adder<uint64_t> CHECK_CONSISTENCY_count("task", "CHECK_CONSISTENCY");
@@ -1996,9 +1998,62 @@ void cloud_push_callback(CloudStorageEngine& engine, const TAgentTaskRequest& re
 PublishVersionWorkerPool::PublishVersionWorkerPool(StorageEngine& engine)
         : TaskWorkerPool("PUBLISH_VERSION", config::publish_version_worker_count,
                          [this](const TAgentTaskRequest& task) { publish_version_callback(task); }),
-          _engine(engine) {}
+          _engine(engine) {
+    if (config::enable_publish_version_async_report) {
+        auto st = Thread::create("PublishVersionWorkerPool", "report_finished_publish",
+                                 [this] { _report_loop(); }, &_report_thread);
+        CHECK(st.ok()) << "PUBLISH_VERSION: " << st;
+    }
+}
+
+PublishVersionWorkerPool::~PublishVersionWorkerPool() {
+    // The workers report the finished tasks, stop them before the report thread.
+    stop();
+    {
+        std::lock_guard lock(_report_mtx);
+        _report_stopped = true;
+    }
+    _report_condv.notify_all();
+    if (_report_thread) {
+        _report_thread->join();
+    }
+}
+
+void PublishVersionWorkerPool::_report_finished(TFinishTaskRequest&& request) {
+    if (_report_thread == nullptr) {
+        finish_task(request);
+        remove_task_info(request.task_type, request.signature);
+        return;
+    }
+    {
+        std::lock_guard lock(_report_mtx);
+        _pending_reports.push_back(std::move(request));
+    }
+    _report_condv.notify_one();
+}
 
-PublishVersionWorkerPool::~PublishVersionWorkerPool() = default;
+void PublishVersionWorkerPool::_report_loop() {
+    std::vector<TFinishTaskRequest> batch;
+    while (true) {
+        {
+            std::unique_lock lock(_report_mtx);
+            _report_condv.wait(lock, [&] { return _report_stopped || !_pending_reports.empty(); });
+            // Report all the pending tasks before exiting.
+            if (_pending_reports.empty()) {
+                break;
+            }
+            batch.swap(_pending_reports);
+        }
+        g_publish_version_report_batch_size << static_cast<int64_t>(batch.size());
+        for (const auto& request : batch) {
+            finish_task(request);
+            // Removed after the report, the FE may resend the task until then and the resent
+            // task is discarded as a duplicate.
+            remove_task_info(request.task_type, request.signature);
+        }
+        batch.clear();
+    }
+}
 
 void PublishVersionWorkerPool::publish_version_callback(const TAgentTaskRequest& req) {
     const auto& publish_version_req = req.publish_version_req;
@@ -2128,8 +2183,7 @@ void PublishVersionWorkerPool::publish_version_callback(const TAgentTaskRequest&
             std::vector<TTabletId>(error_tablet_ids.begin(), error_tablet_ids.end()));
     finish_task_request.__set_table_id_to_tablet_id_to_delta_num_rows(
             table_id_to_tablet_id_to_num_delta_rows);
-    finish_task(finish_task_request);
-    remove_task_info(req.task_type, req.signature);
+    _report_finished(std::move(finish_task_request));
 }
 
 void clear_transaction_task_callback(StorageEngine& engine, const TAgentTaskRequest& req) {
@@ -25,6 +25,7 @@
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "common/status.h"
 
@@ -38,6 +39,7 @@ class ThreadPool;
 class TReportRequest;
 class TTabletInfo;
 class TAgentTaskRequest;
+class TFinishTaskRequest;
 class ClusterInfo;
 
 class TaskWorkerPoolIf {
@@ -73,7 +75,19 @@ public:
 private:
     void publish_version_callback(const TAgentTaskRequest& task);
 
+    // Report a finished task to the FE, by the report thread if there is.
+    void _report_finished(TFinishTaskRequest&& request);
+
+    void _report_loop();
+
     StorageEngine& _engine;
+
+    // Only if `enable_publish_version_async_report` is set.
+    std::shared_ptr<Thread> _report_thread;
+    std::mutex _report_mtx;
+    std::condition_variable _report_condv;
+    bool _report_stopped {false};
+    std::vector<TFinishTaskRequest> _pending_reports;
 };
 
 class PriorTaskWorkerPool final : public TaskWorkerPoolIf {
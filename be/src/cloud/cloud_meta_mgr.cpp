@@ -674,6 +674,9 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                 LOG_WARNING("failed to get delete bitmap, " + tablet_info).error(st);
                 return st;
             }
+            if (config::enable_delete_bitmap_run_optimize) {
+                delete_bitmap.run_optimize();
+            }
             tablet->tablet_meta()->delete_bitmap().merge(delete_bitmap);
             RETURN_IF_ERROR(_log_mow_delete_bitmap(tablet, resp, delete_bitmap, old_max_version,
                                                    options.full_sync, read_version));
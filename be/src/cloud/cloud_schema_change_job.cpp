@@ -19,6 +19,8 @@
 
 #include <gen_cpp/cloud.pb.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -37,8 +39,10 @@
 #include "olap/tablet.h"
 #include "olap/tablet_fwd.h"
 #include "olap/tablet_meta.h"
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/debug_points.h"
+#include "util/threadpool.h"
 
 namespace doris {
 using namespace ErrorCode;
@@ -292,8 +296,11 @@ Status CloudSchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParam
     DBUG_EXECUTE_IF("CloudSchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
     // 3. Convert historical data
-    bool already_exist_any_version = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
+    // Converts a single rowset, `existed_before_prepare` is set if the rowset had already been
+    // committed to the new tablet before this job prepared it
+    auto convert_rowset = [&](const RowsetReaderSharedPtr& rs_reader, SchemaChange* procedure,
+                              RowsetSharedPtr* output_rowset,
+                              bool* existed_before_prepare) -> Status {
         VLOG_TRACE << "Begin to convert a history rowset. version=" << rs_reader->version();
 
         RowsetWriterContext context;
@@ -326,22 +333,22 @@ Status CloudSchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParam
             if (st.is<ALREADY_EXIST>()) {
                 LOG(INFO) << "Rowset " << rs_reader->version() << " has already existed in tablet "
                           << _new_tablet->tablet_id();
-                // Add already committed rowset to _output_rowsets.
+                // Add already committed rowset to the output rowsets.
                 DCHECK(existed_rs_meta != nullptr);
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 RETURN_IF_ERROR(
                         RowsetFactory::create_rowset(nullptr, "", existed_rs_meta, &rowset));
-                _output_rowsets.push_back(std::move(rowset));
-                already_exist_any_version = true;
-                continue;
+                *output_rowset = std::move(rowset);
+                *existed_before_prepare = true;
+                return Status::OK();
             } else {
                 return st;
             }
         }
 
-        st = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                   _base_tablet_schema, _new_tablet_schema);
+        st = procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
+                                _base_tablet_schema, _new_tablet_schema);
         if (!st.ok()) {
             return Status::InternalError(
                     "failed to process schema change on rowset, version=[{}-{}], status={}",
@@ -362,21 +369,89 @@ Status CloudSchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParam
             if (st.is<ALREADY_EXIST>()) {
                 LOG(INFO) << "Rowset " << rs_reader->version() << " has already existed in tablet "
                           << _new_tablet->tablet_id();
-                // Add already committed rowset to _output_rowsets.
+                // Add already committed rowset to the output rowsets.
                 DCHECK(existed_rs_meta != nullptr);
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 RETURN_IF_ERROR(
                         RowsetFactory::create_rowset(nullptr, "", existed_rs_meta, &rowset));
-                _output_rowsets.push_back(std::move(rowset));
-                continue;
+                *output_rowset = std::move(rowset);
+                return Status::OK();
             } else {
                 return st;
             }
         }
-        _output_rowsets.push_back(std::move(new_rowset));
+        *output_rowset = std::move(new_rowset);
 
         VLOG_TRACE << "Successfully convert a history version " << rs_reader->version();
+        return Status::OK();
+    };
+
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    std::vector<RowsetSharedPtr> output_rowsets(rs_readers.size());
+    // Not std::vector<bool>, elements are written concurrently
+    std::vector<uint8_t> existed_before_prepare(rs_readers.size(), 0);
+    auto parallelism = std::min<size_t>(
+            std::max(config::schema_change_convert_rowset_parallelism, 1), rs_readers.size());
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            bool existed = false;
+            RETURN_IF_ERROR(convert_rowset(rs_readers[i], sc_procedure.get(), &output_rowsets[i],
+                                           &existed));
+            existed_before_prepare[i] = existed;
+        }
+    } else {
+        // Rowsets are independent of each other, convert them concurrently and split the
+        // memory budget of this job between the workers
+        std::unique_ptr<ThreadPool> convert_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("SchemaChangeConvertRowsetPool")
+                                .set_min_threads(static_cast<int>(parallelism))
+                                .set_max_threads(static_cast<int>(parallelism))
+                                .build(&convert_pool));
+        int64_t mem_limit =
+                _cloud_storage_engine.memory_limitation_bytes_per_thread_for_schema_change() /
+                static_cast<int64_t>(parallelism);
+        auto resource_ctx = thread_context()->resource_ctx();
+        std::vector<Status> statuses(rs_readers.size());
+        std::atomic<bool> failed {false};
+        Status submit_st;
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            submit_st = convert_pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                if (failed) {
+                    statuses[i] = Status::Cancelled("another rowset failed to convert");
+                    return;
+                }
+                auto procedure = get_sc_procedure(changer, sc_sorting, mem_limit);
+                bool existed = false;
+                statuses[i] = convert_rowset(rs_readers[i], procedure.get(), &output_rowsets[i],
+                                             &existed);
+                existed_before_prepare[i] = existed;
+                if (!statuses[i].ok()) {
+                    failed = true;
+                }
+            });
+            if (!submit_st.ok()) {
+                failed = true;
+                break;
+            }
+        }
+        convert_pool->wait();
+        RETURN_IF_ERROR(submit_st);
+        // Report the first real failure rather than a cancellation caused by it
+        for (const auto& st : statuses) {
+            if (!st.ok() && !st.is<ErrorCode::CANCELLED>()) {
+                return st;
+            }
+        }
+        for (const auto& st : statuses) {
+            RETURN_IF_ERROR(st);
+        }
+    }
+    bool already_exist_any_version = false;
+    for (size_t i = 0; i < rs_readers.size(); ++i) {
+        already_exist_any_version |= existed_before_prepare[i] != 0;
+        _output_rowsets.push_back(std::move(output_rowsets[i]));
     }
     auto* sc_job = job.mutable_schema_change();
     if (!sc_params.ref_rowset_readers.empty()) {
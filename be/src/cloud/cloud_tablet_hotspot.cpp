@@ -42,6 +42,16 @@ void TabletHotspot::count(const BaseTablet& tablet) {
     counter->cur_counter++;
 }
 
+uint64_t TabletHotspot::get_tablet_qpd(int64_t tablet_id) {
+    size_t slot_idx = tablet_id % s_slot_size;
+    auto& slot = _tablets_hotspot[slot_idx];
+    std::lock_guard lock(slot.mtx);
+    if (auto iter = slot.map.find(tablet_id); iter != slot.map.end()) {
+        return iter->second->qpd();
+    }
+    return 0;
+}
+
 TabletHotspot::TabletHotspot() {
     _counter_thread = std::thread(&TabletHotspot::make_dot_point, this);
 }
@@ -161,6 +161,9 @@ void CloudTxnDeleteBitmapCache::set_tablet_txn_info(
     std::string key_str = fmt::format("{}/{}", transaction_id, tablet_id);
     CacheKey key(key_str);
 
+    if (config::enable_delete_bitmap_run_optimize) {
+        delete_bitmap->run_optimize();
+    }
     auto val = new DeleteBitmapCacheValue(delete_bitmap, rowset_ids);
     size_t charge = sizeof(DeleteBitmapCacheValue);
     for (auto& [k, v] : val->delete_bitmap->delete_bitmap) {
@@ -203,6 +206,9 @@ Status CloudTxnDeleteBitmapCache::update_tablet_txn_info(TTransactionId transact
     std::string key_str = fmt::format("{}/{}", transaction_id, tablet_id);
     CacheKey key(key_str);
 
+    if (config::enable_delete_bitmap_run_optimize) {
+        delete_bitmap->run_optimize();
+    }
     auto val = new DeleteBitmapCacheValue(delete_bitmap, rowset_ids);
     size_t charge = sizeof(DeleteBitmapCacheValue);
     for (auto& [k, v] : val->delete_bitmap->delete_bitmap) {
@@ -59,65 +59,58 @@ Status DeleteBitmapFileReader::close() {
 }
 
 Status DeleteBitmapFileReader::read(DeleteBitmapPB& delete_bitmap) {
+    constexpr size_t header_size =
+            DeleteBitmapFileWriter::MAGIC_SIZE + DeleteBitmapFileWriter::LENGTH_SIZE;
+    constexpr size_t checksum_size = DeleteBitmapFileWriter::CHECKSUM_SIZE;
+    // The file is small and read once, fetch it with a single read instead of one remote
+    // request for each of the magic, length, delete bitmap and checksum sections.
+    size_t file_size = _file_reader->size();
+    if (file_size < header_size + checksum_size) {
+        return Status::InternalError(
+                "read delete bitmap failed from {} because file size {} is too small", _path,
+                file_size);
+    }
+    std::string file_buf;
+    file_buf.resize(file_size);
     size_t bytes_read = 0;
-    size_t offset = 0;
-    // 0. read magic number
-    {
-        uint8_t magic_buf[DeleteBitmapFileWriter::MAGIC_SIZE];
-        RETURN_IF_ERROR(_file_reader->read_at(
-                offset, {magic_buf, DeleteBitmapFileWriter::MAGIC_SIZE}, &bytes_read));
-        offset += DeleteBitmapFileWriter::MAGIC_SIZE;
-        if (bytes_read != DeleteBitmapFileWriter::MAGIC_SIZE ||
-            memcmp(magic_buf, DeleteBitmapFileWriter::DELETE_BITMAP_MAGIC,
-                   DeleteBitmapFileWriter::MAGIC_SIZE) != 0) {
-            return Status::InternalError(
-                    "read delete bitmap failed from {} because magic is not "
-                    "matched",
-                    _path);
-        }
+    RETURN_IF_ERROR(_file_reader->read_at(0, {file_buf.data(), file_size}, &bytes_read));
+    if (bytes_read != file_size) {
+        return Status::InternalError("read delete bitmap failed from {}, read {} of {} bytes",
+                                     _path, bytes_read, file_size);
+    }
+    const char* data = file_buf.data();
+    // 0. check magic number
+    if (memcmp(data, DeleteBitmapFileWriter::DELETE_BITMAP_MAGIC,
+               DeleteBitmapFileWriter::MAGIC_SIZE) != 0) {
+        return Status::InternalError(
+                "read delete bitmap failed from {} because magic is not "
+                "matched",
+                _path);
+    }
+    // 1. decode delete bitmap proto length
+    size_t delete_bitmap_len = decode_fixed64_le(
+            reinterpret_cast<const uint8_t*>(data + DeleteBitmapFileWriter::MAGIC_SIZE));
+    if (delete_bitmap_len == 0) {
+        return Status::InternalError("read delete bitmap failed from {} because length is 0",
+                                     _path);
     }
-    // 1. read delete bitmap proto length
-    size_t delete_bitmap_len = 0;
-    {
-        uint8_t len_buf[DeleteBitmapFileWriter::LENGTH_SIZE];
-        RETURN_IF_ERROR(_file_reader->read_at(
-                offset, {len_buf, DeleteBitmapFileWriter::LENGTH_SIZE}, &bytes_read));
-        offset += DeleteBitmapFileWriter::LENGTH_SIZE;
-        delete_bitmap_len = decode_fixed64_le(len_buf);
-        if (delete_bitmap_len == 0) {
-            return Status::InternalError("read delete bitmap failed from {} because length is 0",
-                                         _path);
-        }
-        if (offset == _file_reader->size()) {
-            LOG(WARNING) << "read delete bitmap failed because reach end of file=" << _path
-                         << ", file size=" << _file_reader->size() << ", offset=" << offset
-                         << ", delete_bitmap_len=" << delete_bitmap_len;
-            return Status::InternalError(
-                    "read delete bitmap failed from {} because reach end of file", _path);
-        }
+    if (delete_bitmap_len > file_size - header_size - checksum_size) {
+        LOG(WARNING) << "read delete bitmap failed because reach end of file=" << _path
+                     << ", file size=" << file_size << ", delete_bitmap_len=" << delete_bitmap_len;
+        return Status::InternalError("read delete bitmap failed from {} because reach end of file",
+                                     _path);
     }
-    // 2. read delete bitmap
-    std::string delete_bitmap_buf;
-    {
-        delete_bitmap_buf.resize(delete_bitmap_len);
-        RETURN_IF_ERROR(_file_reader->read_at(
-                offset, {delete_bitmap_buf.c_str(), delete_bitmap_len}, &bytes_read));
-        offset += delete_bitmap_len;
-        if (!delete_bitmap.ParseFromString(delete_bitmap_buf)) {
-            LOG(WARNING) << "deserialize delete bitmap failed from file=" << _path
-                         << ", file size=" << _file_reader->size()
-                         << ", delete_bitmap_len=" << delete_bitmap_len
-                         << ", bytes_read=" << bytes_read;
-            return Status::InternalError("deserialize delete bitmap failed from {}", _path);
-        }
+    // 2. parse delete bitmap
+    const char* delete_bitmap_data = data + header_size;
+    if (!delete_bitmap.ParseFromArray(delete_bitmap_data, static_cast<int>(delete_bitmap_len))) {
+        LOG(WARNING) << "deserialize delete bitmap failed from file=" << _path
+                     << ", file size=" << file_size << ", delete_bitmap_len=" << delete_bitmap_len;
+        return Status::InternalError("deserialize delete bitmap failed from {}", _path);
     }
     // 3. checksum
-    uint8_t checksum_len_buf[DeleteBitmapFileWriter::CHECKSUM_SIZE];
-    RETURN_IF_ERROR(_file_reader->read_at(
-            offset, {checksum_len_buf, DeleteBitmapFileWriter::CHECKSUM_SIZE}, &bytes_read));
-    offset += DeleteBitmapFileWriter::CHECKSUM_SIZE;
-    uint32_t checksum = decode_fixed32_le(checksum_len_buf);
-    uint32_t computed_checksum = crc32c::Value(delete_bitmap_buf.data(), delete_bitmap_len);
+    uint32_t checksum = decode_fixed32_le(
+            reinterpret_cast<const uint8_t*>(delete_bitmap_data + delete_bitmap_len));
+    uint32_t computed_checksum = crc32c::Value(delete_bitmap_data, delete_bitmap_len);
     if (computed_checksum != checksum) {
         return Status::InternalError("delete bitmap checksum failed from file=" + _path +
                                      ", computed checksum=" + std::to_string(computed_checksum) +
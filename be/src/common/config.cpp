@@ -94,6 +94,7 @@ DEFINE_Int32(brpc_num_threads, "256");
 // the time of brpc server keep idle connection, setting this value too small may cause rpc between backends to fail,
 // the default value is set to -1, which means never close idle connection.
 DEFINE_Int32(brpc_idle_timeout_sec, "-1");
+DEFINE_String(brpc_unix_socket_dir, "");
 
 // Declare a selection strategy for those servers have many ips.
 // Note that there should at most one ip match this list.
@@ -138,6 +139,8 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+DEFINE_mBool(enable_mmap_transparent_huge_pages, "false");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -146,6 +149,20 @@ DEFINE_mInt32(max_fill_rate, "2");
 
 DEFINE_mInt32(double_resize_threshold, "23");
 
+DEFINE_mInt64(hash_join_partitioned_build_min_rows, "-1");
+DEFINE_mBool(enable_hash_join_direct_mapping, "true");
+DEFINE_mBool(enable_streaming_agg_flush_hash_table, "false");
+DEFINE_mBool(enable_streaming_agg_adaptive_bypass, "false");
+DEFINE_mDouble(streaming_agg_bypass_min_reduction, "1.1");
+DEFINE_mInt64(streaming_agg_bypass_min_sample_rows, "65536");
+DEFINE_mInt32(streaming_agg_bypass_probe_interval, "16");
+DEFINE_mInt64(hash_join_probe_bloom_filter_min_rows, "-1");
+DEFINE_mDouble(hash_join_probe_bloom_filter_fpp, "0.05");
+DEFINE_mBool(enable_hash_join_late_materialization, "true");
+DEFINE_mInt64(hash_join_parallel_build_min_rows, "-1");
+DEFINE_mDouble(hash_join_spill_partition_ratio, "0.5");
+DEFINE_mBool(enable_hash_join_probe_column_pass_through, "true");
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -153,6 +170,7 @@ DEFINE_mInt32(double_resize_threshold, "23");
 // note that: `max_` prefix should be removed, but keep it for compatibility.
 DEFINE_Int64(max_sys_mem_available_low_water_mark_bytes, "-1");
 
+DEFINE_mBool(enable_memtable_limiter_fair_share, "true");
 DEFINE_Int64(memtable_limiter_reserved_memory_bytes, "838860800");
 
 // The size of the memory that gc wants to release each time, as a percentage of the mem limit.
@@ -170,6 +188,8 @@ DEFINE_mBool(disable_memory_gc, "false");
 // and the query may be blocked during the cancel process. skip this query and continue to cancel other queries.
 DEFINE_mInt64(revoke_memory_max_tolerance_ms, "3000");
 
+DEFINE_mBool(enable_spill_in_memory_gc, "false");
+
 DEFINE_mBool(enable_stacktrace, "true");
 
 DEFINE_mInt64(stacktrace_in_alloc_large_memory_bytes, "2147483647"); // 2GB -1
@@ -211,12 +231,15 @@ DEFINE_Int32(publish_version_worker_count, "8");
 DEFINE_Int32(tablet_publish_txn_max_thread, "32");
 // the timeout of EnginPublishVersionTask
 DEFINE_Int32(publish_version_task_timeout_s, "8");
+DEFINE_Bool(enable_publish_version_async_report, "false");
 // the count of thread to calc delete bitmap
 DEFINE_Int32(calc_delete_bitmap_max_thread, "32");
 // the count of thread to calc delete bitmap worker, only used for cloud
 DEFINE_Int32(calc_delete_bitmap_worker_count, "8");
 // the count of thread to calc tablet delete bitmap task, only used for cloud
 DEFINE_Int32(calc_tablet_delete_bitmap_task_max_thread, "32");
+DEFINE_mInt32(rowset_key_filter_min_segments, "0");
+DEFINE_mInt64(rowset_key_filter_max_rows, "16777216");
 // the count of thread to clear transaction task
 DEFINE_Int32(clear_transaction_task_worker_count, "1");
 // the count of thread to delete
@@ -257,6 +280,7 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+DEFINE_mInt32(clone_download_parallelism, "1");
 // whether to check md5sum when download
 DEFINE_mBool(enable_download_md5sum_check, "false");
 // download binlog meta timeout, default 30s
@@ -293,6 +317,19 @@ DEFINE_Int32(be_service_threads, "64");
 // The pipeline task has a high concurrency, therefore reducing its report frequency
 DEFINE_mInt32(pipeline_status_report_interval, "10");
 DEFINE_mInt32(pipeline_task_exec_time_slice, "100");
+DEFINE_Bool(enable_pipeline_task_numa_aware, "false");
+DEFINE_mBool(enable_pipeline_task_cooperative_yield, "true");
+DEFINE_Int32(pipeline_latency_scheduler_thread_percent, "0");
+DEFINE_mInt64(pipeline_latency_task_runtime_threshold_ms, "100");
+DEFINE_Bool(enable_workload_group_fair_pipeline_scheduler, "false");
+DEFINE_mInt32(workload_group_fair_scheduler_quantum_ms, "10");
+DEFINE_mBool(enable_pipeline_event_trace, "false");
+DEFINE_Int32(pipeline_event_trace_buffer_size, "16384");
+DEFINE_Bool(enable_pipeline_cpu_profile, "false");
+DEFINE_Int32(pipeline_cpu_profile_interval_ms, "10");
+DEFINE_Int32(pipeline_cpu_profile_buffer_size, "128");
+DEFINE_mInt32(pipeline_cpu_profile_min_fragment_time_s, "10");
+DEFINE_mInt32(pipeline_cpu_profile_max_stacks, "2000");
 
 // task executor min concurrency per task
 DEFINE_Int32(task_executor_min_concurrency_per_task, "1");
@@ -343,24 +380,34 @@ DEFINE_mInt64(thrift_client_retry_interval_ms, "1000");
 DEFINE_mInt64(thrift_max_message_size, "104857600");
 // max bytes number for single scan range, used in segmentv2
 DEFINE_mInt32(doris_scan_range_max_mb, "1024");
+DEFINE_mInt32(parallel_scan_splits_per_scanner, "1");
 // single read execute fragment row number
 DEFINE_mInt32(doris_scanner_row_num, "16384");
 // single read execute fragment row bytes
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mBool(enable_adaptive_scan_concurrency, "false");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_mBool(enable_exchange_credit_flow_control, "false");
+DEFINE_mInt32(exchange_credit_window_ms, "100");
+DEFINE_mBool(enable_exchange_limit_early_close, "false");
+DEFINE_mInt64(exchange_sink_coalesce_bytes, "0");
+DEFINE_mBool(enable_exchange_adaptive_compression, "false");
+DEFINE_mBool(enable_broadcast_exchange_fanout_per_be, "false");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_mInt32(schema_change_convert_rowset_parallelism, "1");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
+DEFINE_mInt32(point_query_row_cache_admission_min_misses, "1");
 DEFINE_mInt32(disk_stat_monitor_interval, "5");
 DEFINE_mInt32(unused_rowset_monitor_interval, "30");
 DEFINE_mInt32(quering_rowsets_evict_interval, "30");
@@ -404,6 +451,9 @@ DEFINE_Int32(storage_page_cache_shard_size, "256");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
+DEFINE_Int32(compressed_page_cache_percentage, "0");
+DEFINE_mBool(enable_page_cache_single_flight_load, "false");
+DEFINE_Bool(enable_bitshuffle_fused_page_decode, "false");
 // whether to disable page cache feature in storage
 DEFINE_mBool(disable_storage_page_cache, "false");
 // whether to disable row cache feature in storage
@@ -419,9 +469,14 @@ DEFINE_Int32(primary_key_data_page_size, "32768");
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+DEFINE_Bool(enable_storage_cache_tiny_lfu, "false");
+DEFINE_Bool(enable_lru_cache_lazy_recency, "false");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
+DEFINE_mBool(enable_encoded_page_predicate_evaluation, "false");
+DEFINE_mBool(enable_adaptive_predicate_reorder, "true");
+DEFINE_mInt32(adaptive_predicate_reorder_interval, "16");
 
 // be policy
 // whether check compaction checksum
@@ -611,6 +666,7 @@ DEFINE_mInt64(streaming_load_max_mb, "102400");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 DEFINE_mInt64(streaming_load_json_max_mb, "100");
+DEFINE_mBool(enable_stream_load_zero_copy_body, "false");
 // the alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -666,6 +722,7 @@ DEFINE_mBool(enable_token_check, "true");
 
 // to open/close system metrics
 DEFINE_Bool(enable_system_metrics, "true");
+DEFINE_mBool(enable_hot_path_metrics, "false");
 
 // Number of cores Doris will used, this will effect only when it's greater than 0.
 // Otherwise, Doris will use all cores returned from "/proc/cpuinfo".
@@ -689,6 +746,9 @@ DEFINE_mInt64(write_buffer_size_for_agg, "104857600");
 DEFINE_mInt64(min_write_buffer_size_for_partial_update, "1048576");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+DEFINE_mInt32(memtable_max_sorted_runs_to_merge, "8");
+DEFINE_mInt32(memtable_flush_max_parallel_segments, "1");
+DEFINE_mInt64(memtable_flush_min_rows_per_segment, "500000");
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DEFINE_mInt32(memtable_wait_for_memory_sleep_time_s, "300");
@@ -738,6 +798,7 @@ DEFINE_Bool(enable_metric_calculator, "true");
 
 // max consumer num in one data consumer group, for routine load
 DEFINE_mInt32(max_consumer_num_per_group, "3");
+DEFINE_mInt32(routine_load_consume_batch_size, "1");
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -840,6 +901,7 @@ DEFINE_Int32(query_cache_elasticity_size_mb, "128");
 
 // Maximum number of cache partitions corresponding to a SQL
 DEFINE_Int32(query_cache_max_partition_count, "1024");
+DEFINE_Int32(query_cache_shard_num, "1");
 
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
@@ -847,6 +909,7 @@ DEFINE_Int32(query_cache_max_partition_count, "1024");
 DEFINE_mInt32(max_tablet_version_num, "2000");
 
 DEFINE_mInt32(time_series_max_tablet_version_num, "20000");
+DEFINE_mInt32(time_series_compaction_level1_fan_out, "10");
 
 // Frontend mainly use two thrift sever type: THREAD_POOL, THREADED_SELECTOR. if fe use THREADED_SELECTOR model for thrift server,
 // the thrift_server_type_of_fe should be set THREADED_SELECTOR to make be thrift client to fe constructed with TFramedTransport
@@ -854,6 +917,7 @@ DEFINE_String(thrift_server_type_of_fe, "THREAD_POOL");
 
 // disable zone map index when page row is too few
 DEFINE_mInt32(zone_map_row_num_threshold, "20");
+DEFINE_mInt32(zone_map_max_distinct_values, "0");
 
 // aws sdk log level
 //    Off = 0,
@@ -884,6 +948,7 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
+DEFINE_mBool(enable_amortized_allocator_memory_check, "false");
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -925,6 +990,10 @@ DEFINE_Int32(send_batch_thread_pool_queue_size, "102400");
 DEFINE_mInt32(max_segment_num_per_rowset, "1000");
 DEFINE_mInt32(segment_compression_threshold_kb, "256");
 
+DEFINE_mBool(enable_adaptive_column_compression, "false");
+DEFINE_mInt32(adaptive_column_compression_sample_pages, "4");
+DEFINE_mDouble(adaptive_column_compression_min_gain, "0.2");
+
 // Time to clean up useless JDBC connection pool cache
 DEFINE_mInt32(jdbc_connection_pool_cache_clear_time_sec, "28800");
 
@@ -936,6 +1005,7 @@ DEFINE_Int64(delete_bitmap_agg_cache_capacity, "104857600");
 // we will take the larger of 1.0% of the total memory and 100MB as the delete bitmap cache size.
 DEFINE_String(delete_bitmap_dynamic_agg_cache_limit, "1.0%");
 DEFINE_mInt32(delete_bitmap_agg_cache_stale_sweep_time_sec, "1800");
+DEFINE_mBool(enable_delete_bitmap_run_optimize, "false");
 
 // reference https://github.com/edenhill/librdkafka/blob/master/INTRODUCTION.md#broker-version-compatibility
 // If the dependent kafka broker version older than 0.10.0.0,
@@ -998,6 +1068,7 @@ DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
+DEFINE_mInt64(parquet_row_group_prefetch_max_bytes, "0");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -1006,6 +1077,8 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 
 // Perform the always_true check at intervals determined by runtime_filter_sampling_frequency
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
+DEFINE_mBool(enable_late_arrival_runtime_filter_pushdown, "false");
+DEFINE_mInt32(runtime_filter_merge_wait_extension_ms, "0");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
 // cooldown task configs
@@ -1035,6 +1108,7 @@ DEFINE_mInt64(nodechannel_pending_queue_max_bytes, "67108864");
 
 // The batch size for sending data by brpc streaming client
 DEFINE_mInt64(brpc_streaming_client_batch_bytes, "262144");
+DEFINE_mInt64(stream_sink_file_writer_buffer_bytes, "65536");
 
 // Max waiting time to wait the "plan fragment start" rpc.
 // If timeout, the fragment will be cancelled.
@@ -1112,6 +1186,9 @@ DEFINE_Bool(enable_file_cache, "false");
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DEFINE_String(file_cache_path, "[{\"path\":\"${DORIS_HOME}/file_cache\"}]");
 DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
+DEFINE_mInt32(file_cache_sequential_read_ahead_blocks, "0");
+DEFINE_String(file_cache_index_block_compression, "");
+DEFINE_String(file_cache_normal_block_compression, "");
 
 DEFINE_Bool(clear_file_cache, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
@@ -1139,11 +1216,15 @@ DEFINE_mInt64(cache_lock_held_long_tail_threshold_us, "30000000");
 // write to file cache, enable_file_cache_adaptive_write true means when file cache is enough, it
 // will write to file cache; satisfying any of the two conditions will write to file cache.
 DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
+DEFINE_mInt64(file_cache_keep_base_compaction_output_min_qpd, "0");
+DEFINE_mDouble(file_cache_compaction_output_min_hot_ratio, "0");
 DEFINE_mBool(enable_file_cache_adaptive_write, "true");
 
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
+DEFINE_mBool(enable_segment_page_prefetch, "true");
+DEFINE_mInt64(segment_page_prefetch_window_bytes, "16777216");
 DEFINE_mInt64(file_cache_background_monitor_interval_ms, "5000");
 DEFINE_mInt64(file_cache_background_ttl_gc_interval_ms, "3000");
 DEFINE_mInt64(file_cache_background_ttl_gc_batch, "1000");
@@ -1152,6 +1233,8 @@ DEFINE_mInt64(file_cache_background_lru_dump_interval_ms, "60000");
 DEFINE_mInt64(file_cache_background_lru_dump_update_cnt_threshold, "1000");
 DEFINE_mInt64(file_cache_background_lru_dump_tail_record_num, "5000000");
 DEFINE_mInt64(file_cache_background_lru_log_replay_interval_ms, "1000");
+DEFINE_mInt64(file_cache_lru_move_min_interval_s, "0");
+DEFINE_mInt64(file_cache_normal_admission_ghost_num, "0");
 DEFINE_mBool(enable_evaluate_shadow_queue_diff, "false");
 
 DEFINE_Int32(file_cache_downloader_thread_num_min, "32");
@@ -1160,6 +1243,7 @@ DEFINE_Int32(file_cache_downloader_thread_num_max, "32");
 DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "1800");
 DEFINE_mInt32(inverted_index_cache_stale_sweep_time_sec, "600");
 DEFINE_mBool(enable_write_index_searcher_cache, "false");
+DEFINE_mBool(enable_compaction_index_searcher_preload, "false");
 // inverted index searcher cache size
 DEFINE_String(inverted_index_searcher_cache_limit, "10%");
 DEFINE_Bool(enable_inverted_index_cache_check_timestamp, "true");
@@ -1193,6 +1277,8 @@ DEFINE_Int32(num_broadcast_buffer, "32");
 
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
+DEFINE_mBool(enable_expr_release_intermediate_columns, "false");
+DEFINE_mBool(enable_conditional_branch_on_selected_rows, "false");
 
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
@@ -1203,6 +1289,8 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt32(s3_write_buffer_grow_parts_num, "0");
+DEFINE_mInt64(s3_write_buffer_max_size, "67108864");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1219,6 +1307,9 @@ DEFINE_Int32(segment_cache_fd_percentage, "20");
 DEFINE_mInt32(estimated_mem_per_column_reader, "512");
 DEFINE_Int32(segment_cache_memory_percentage, "5");
 DEFINE_Bool(enable_segment_cache_prune, "true");
+DEFINE_String(segment_footer_snapshot_path, "");
+DEFINE_Int64(segment_footer_snapshot_capacity, "268435456");
+DEFINE_Int32(segment_footer_snapshot_interval_sec, "600");
 
 // enable feature binlog, default false
 DEFINE_Bool(enable_feature_binlog, "false");
@@ -1229,7 +1320,9 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "28800");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+DEFINE_Int64(max_external_file_page_index_cache_size, "0");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
+DEFINE_Int64(regexp_cache_num, "0");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
 
@@ -1317,6 +1410,7 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mInt32(group_commit_adaptive_min_interval_ms, "0");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1353,10 +1447,13 @@ DEFINE_Bool(enable_snapshot_action, "false");
 DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 
 DEFINE_mInt32(variant_max_sparse_column_statistics_size, "10000");
+DEFINE_mInt32(variant_hot_path_min_access_count, "0");
 
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+DEFINE_mInt32(local_shuffle_spsc_ring_capacity, "0");
+DEFINE_mDouble(local_exchange_skew_ratio, "0");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1369,6 +1466,9 @@ DEFINE_mInt32(report_query_statistics_interval_ms, "3000");
 DEFINE_mInt32(query_statistics_reserve_timeout_ms, "30000");
 
 DEFINE_mInt32(report_exec_status_thread_num, "5");
+DEFINE_mBool(enable_query_io_ledger, "false");
+DEFINE_mInt32(query_io_ledger_max_files, "1000");
+DEFINE_mInt32(query_io_ledger_top_files, "10");
 
 // consider two high usage disk at the same available level if they do not exceed this diff.
 DEFINE_mDouble(high_disk_avail_level_diff_usages, "0.15");
@@ -1389,6 +1489,11 @@ DEFINE_Validator(spill_io_thread_pool_thread_num, [](const int config) -> bool {
     return true;
 });
 DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
+DEFINE_Int32(spill_read_ahead_thread_pool_thread_num, "16");
+DEFINE_mBool(enable_local_io_uring, "false");
+DEFINE_Int32(local_io_uring_queue_depth, "64");
+DEFINE_mBool(enable_spill_to_remote_storage, "false");
+DEFINE_mDouble(spill_proactive_query_memory_ratio, "0.9");
 
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
@@ -1402,6 +1507,11 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mBool(enable_s3_read_hedge, "false");
+DEFINE_mInt32(s3_read_hedge_min_delay_ms, "20");
+DEFINE_mInt32(s3_read_hedge_max_percent, "5");
+DEFINE_mInt64(s3_read_hedge_max_bytes, "8388608");
+DEFINE_Int32(max_s3_read_hedge_thread_num, "64");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1493,6 +1603,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "1");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1510,12 +1621,17 @@ DEFINE_mInt64(compaction_batch_size, "-1");
 // This is only for debug purpose, in case sometimes the page index
 // filter wrong data.
 DEFINE_mBool(enable_parquet_page_index, "true");
+DEFINE_mBool(enable_parquet_dict_row_group_filter, "false");
 
 DEFINE_mBool(ignore_not_found_file_in_external_table, "true");
 
 DEFINE_mBool(enable_hdfs_mem_limiter, "true");
 
 DEFINE_mInt16(topn_agg_limit_multiplier, "2");
+DEFINE_mBool(enable_topn_filter_dynamic_pruning, "true");
+DEFINE_mBool(enable_sort_normalized_key, "true");
+DEFINE_mBool(enable_analytic_sliding_extremum, "true");
+DEFINE_mBool(enable_analytic_running_frame_batch, "true");
 
 // Tablet meta size limit after serialization, 1.5GB
 DEFINE_mInt64(tablet_meta_serialize_size_limit, "1610612736");
@@ -1533,6 +1649,7 @@ DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
+DEFINE_mBool(enable_incremental_query_cache, "false");
 
 // Enable validation to check the correctness of table size.
 DEFINE_Bool(enable_table_size_correctness_check, "false");
@@ -1545,6 +1662,7 @@ DEFINE_mInt32(compaction_num_per_round, "-1");
 // Max automatic compaction task generated num per round.
 // Only valid if "compaction_num_per_round = 0"
 DEFINE_mInt32(max_automatic_compaction_num_per_round, "64");
+DEFINE_mDouble(compaction_score_read_hotness_weight, "0");
 
 DEFINE_mInt32(check_tablet_delete_bitmap_interval_seconds, "300");
 DEFINE_mInt32(check_tablet_delete_bitmap_score_top_n, "10");
@@ -1585,6 +1703,8 @@ DEFINE_mBool(enable_auto_clone_on_mow_publish_missing_version, "false");
 
 // The maximum csv line reader output buffer size
 DEFINE_mInt64(max_csv_line_reader_output_buffer_size, "4294967296");
+DEFINE_mInt32(text_decompress_pipeline_queue_size, "0");
+DEFINE_Int32(max_text_decompress_thread_num, "64");
 
 // The maximum number of threads supported when executing LLMFunction
 DEFINE_mInt32(llm_max_concurrent_requests, "1");
@@ -1594,6 +1714,9 @@ DEFINE_mInt32(llm_max_concurrent_requests, "1");
 // helping to prevent resource contention and ensure stable performance when multiple
 // Doris threads are executing OpenMP-accelerated operations simultaneously.
 DEFINE_mInt32(omp_threads_limit, "8");
+DEFINE_mInt32(ann_index_ivf_nprobe, "16");
+DEFINE_mInt32(ann_index_ivf_refine_factor, "4");
+DEFINE_mBool(enable_ann_topn_global_pruning, "false");
 // The capacity of segment partial column cache, used to cache column readers for each segment.
 DEFINE_mInt32(max_segment_partial_column_cache_size, "100");
 
@@ -128,6 +128,10 @@ DECLARE_Int32(arrow_flight_sql_proxy_port);
 // which means the number of bthreads is #cpu-cores
 DECLARE_Int32(brpc_num_threads);
 DECLARE_Int32(brpc_idle_timeout_sec);
+// If not empty, the brpc server also listens on a unix domain socket in this directory, and the
+// exchange to a BE whose socket is found in this directory is sent through the socket instead of
+// TCP. BEs on the same host (e.g. containers sharing a host volume) should use the same directory.
+DECLARE_String(brpc_unix_socket_dir);
 
 // Declare a selection strategy for those servers have many ips.
 // Note that there should at most one ip match this list.
@@ -172,6 +176,11 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Advise regions allocated through the mmap path of Allocator (at least mmap_threshold
+// bytes, mostly large hash tables) to use transparent huge pages. Needs THP enabled in
+// "madvise" or "always" mode on the host.
+DECLARE_mBool(enable_mmap_transparent_huge_pages);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -181,6 +190,49 @@ DECLARE_mInt32(max_fill_rate);
 
 DECLARE_mInt32(double_resize_threshold);
 
+// The hash join build side with at least this many rows is grouped by bucket when the hash table
+// is built, so that probing a bucket reads contiguous memory. It costs 4 bytes plus a copy of the
+// key per build row. -1 means never.
+DECLARE_mInt64(hash_join_partitioned_build_min_rows);
+
+// If true, the integral hash join keys are mapped directly to the buckets when the range of the
+// build keys is not larger than the hash buckets, the probe skips hashing and collisions.
+DECLARE_mBool(enable_hash_join_direct_mapping);
+
+// If true, the streaming pre-aggregation outputs and resets its hash table when the table is
+// not expanded any more, instead of passing through all the remaining input rows.
+DECLARE_mBool(enable_streaming_agg_flush_hash_table);
+// If true, the streaming pre-aggregation passes through its input when the live reduction
+// (input rows divided by new groups) is below `streaming_agg_bypass_min_reduction`, and samples
+// the reduction of one of every `streaming_agg_bypass_probe_interval` blocks to re-enable it.
+DECLARE_mBool(enable_streaming_agg_adaptive_bypass);
+DECLARE_mDouble(streaming_agg_bypass_min_reduction);
+// The pre-aggregation is not bypassed before this number of rows are aggregated.
+DECLARE_mInt64(streaming_agg_bypass_min_sample_rows);
+DECLARE_mInt32(streaming_agg_bypass_probe_interval);
+
+// The hash join build side with at least this many rows builds a bloom filter of its keys, the
+// probe rows missing the filter skip the hash buckets. It helps joins with a low match rate and
+// a hash table larger than the cache. -1 means never.
+DECLARE_mInt64(hash_join_probe_bloom_filter_min_rows);
+DECLARE_mDouble(hash_join_probe_bloom_filter_fpp);
+
+// If true, the hash join probe filters the joined rows by the conjuncts of the join node before
+// gathering the columns the conjuncts do not use.
+DECLARE_mBool(enable_hash_join_late_materialization);
+
+// The shared hash table of a broadcast join with at least this many build rows is chained by all
+// the instances of the join instead of only the one building it. -1 means never.
+DECLARE_mInt64(hash_join_parallel_build_min_rows);
+
+// When a spillable hash join runs out of memory, only about this fraction of the build side is
+// spilled, the other partitions stay in memory. 1 means spilling all the partitions.
+DECLARE_mDouble(hash_join_spill_partition_ratio);
+
+// When every probe row of a block is output exactly once, move the probe columns to the output
+// of the hash join instead of copying them.
+DECLARE_mBool(enable_hash_join_probe_column_pass_through);
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -190,6 +242,9 @@ DECLARE_Int64(max_sys_mem_available_low_water_mark_bytes);
 
 // reserve a small amount of memory so we do not trigger MinorGC
 DECLARE_Int64(memtable_limiter_reserved_memory_bytes);
+// when the memtable memory limit is reached, flush the memtables of the loads using more than
+// their fair share of the memory first, the share is split by workload group and then by load
+DECLARE_mBool(enable_memtable_limiter_fair_share);
 
 // The size of the memory that gc wants to release each time, as a percentage of the mem limit.
 DECLARE_mString(process_minor_gc_size);
@@ -206,6 +261,10 @@ DECLARE_mBool(disable_memory_gc);
 // and the query may be blocked during the cancel process. skip this query and continue to cancel other queries.
 DECLARE_mInt64(revoke_memory_max_tolerance_ms);
 
+// if true, the process memory gc first asks the queries with the most revocable memory to spill,
+// and cancels queries only when the spilling can not free enough memory.
+DECLARE_mBool(enable_spill_in_memory_gc);
+
 // if false, turn off all stacktrace
 DECLARE_mBool(enable_stacktrace);
 
@@ -256,12 +315,20 @@ DECLARE_Int32(publish_version_worker_count);
 DECLARE_Int32(tablet_publish_txn_max_thread);
 // the timeout of EnginPublishVersionTask
 DECLARE_Int32(publish_version_task_timeout_s);
+// If true, the publish version workers hand the finished tasks to a report thread, which reports
+// them to the FE in batches, instead of waiting for the FE before taking the next task.
+DECLARE_Bool(enable_publish_version_async_report);
 // the count of thread to calc delete bitmap
 DECLARE_Int32(calc_delete_bitmap_max_thread);
 // the count of thread to calc delete bitmap worker, only used for cloud
 DECLARE_Int32(calc_delete_bitmap_worker_count);
 // the count of thread to calc tablet delete bitmap task, only used for cloud
 DECLARE_Int32(calc_tablet_delete_bitmap_task_max_thread);
+// build a key -> segment id filter for a rowset with at least this many segments when looking up
+// primary keys in it, 0 means never
+DECLARE_mInt32(rowset_key_filter_min_segments);
+// don't build the key filter for a rowset with more rows, the filter takes 4.5 bytes per row
+DECLARE_mInt64(rowset_key_filter_max_rows);
 // the count of thread to clear transaction task
 DECLARE_Int32(clear_transaction_task_worker_count);
 // the count of thread to delete
@@ -301,6 +368,8 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// The max number of batches of a clone task downloaded concurrently, if `enable_batch_download`.
+DECLARE_mInt32(clone_download_parallelism);
 // whether to check md5sum when download
 DECLARE_mBool(enable_download_md5sum_check);
 // download binlog meta timeout
@@ -340,6 +409,40 @@ DECLARE_Int32(be_service_threads);
 DECLARE_mInt32(pipeline_status_report_interval);
 // Time slice for pipeline task execution (ms)
 DECLARE_mInt32(pipeline_task_exec_time_slice);
+// If true, pipeline task queues are grouped by NUMA node: worker threads are bound to the cores
+// of their node, tasks are stolen within the node first and only cross the node when it is idle.
+DECLARE_Bool(enable_pipeline_task_numa_aware);
+// If true, long running operators (hash table build, sort merge, aggregation merge) check the
+// time slice of the pipeline task and yield in the middle of a block.
+DECLARE_mBool(enable_pipeline_task_cooperative_yield);
+// Percent of the pipeline executor threads of a workload group used by a separated scheduler pool
+// for latency sensitive tasks. 0 means all the non-blocking tasks share one pool.
+DECLARE_Int32(pipeline_latency_scheduler_thread_percent);
+// A task is latency sensitive until it has run longer than this threshold (ms).
+DECLARE_mInt64(pipeline_latency_task_runtime_threshold_ms);
+// If true, the pipeline tasks of all the workload groups run in one shared worker pool instead of
+// a pool per group, and the groups share the pool by weighted deficit round robin on the cpu time
+// of their tasks, weighted by `min_cpu_percent` and capped by `max_cpu_percent`.
+DECLARE_Bool(enable_workload_group_fair_pipeline_scheduler);
+// The cpu time a workload group of weight 1 earns per round of the fair scheduler (ms).
+DECLARE_mInt32(workload_group_fair_scheduler_quantum_ms);
+// If true, the block, yield, steal and dependency wait events of pipeline tasks are recorded into
+// per-thread ring buffers, exported by `/api/pipeline_event_trace`.
+DECLARE_mBool(enable_pipeline_event_trace);
+// Number of events kept by the ring buffer of each thread.
+DECLARE_Int32(pipeline_event_trace_buffer_size);
+// If true, the threads running pipeline tasks and scanners sample their stacks on CPU time, and
+// the fragments running longer than `pipeline_cpu_profile_min_fragment_time_s` get a collapsed
+// CPU flame graph per operator in their profile.
+DECLARE_Bool(enable_pipeline_cpu_profile);
+// CPU time of a thread between two samples (ms).
+DECLARE_Int32(pipeline_cpu_profile_interval_ms);
+// Number of samples kept by the ring buffer of each thread until they are drained.
+DECLARE_Int32(pipeline_cpu_profile_buffer_size);
+// Only the fragments running longer than this (s) report their CPU flame graph.
+DECLARE_mInt32(pipeline_cpu_profile_min_fragment_time_s);
+// Max number of distinct stacks kept per fragment.
+DECLARE_mInt32(pipeline_cpu_profile_max_stacks);
 
 // task executor min concurrency per task
 DECLARE_mInt32(task_executor_min_concurrency_per_task);
@@ -372,18 +475,46 @@ DECLARE_mInt64(thrift_client_retry_interval_ms);
 DECLARE_mInt64(thrift_max_message_size);
 // max bytes number for single scan range, used in segmentv2
 DECLARE_mInt32(doris_scan_range_max_mb);
+// Number of splits built per scanner slot by the parallel olap scanner builder. Splits wait in
+// the scanner context queue and are pulled by whichever scan task frees up first, so values
+// above 1 even out the tail of skewed or partly cold tablets.
+DECLARE_mInt32(parallel_scan_splits_per_scanner);
 // single read execute fragment row number
 DECLARE_mInt32(doris_scanner_row_num);
 // single read execute fragment row bytes
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Adjust the number of in-flight scan tasks of a scan operator between its min and max scan
+// concurrency from how fast the operator drains the scanned blocks
+DECLARE_mBool(enable_adaptive_scan_concurrency);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// Delay the response of an exchange RPC, and so the next RPC of its sender, while the blocks of the
+// sender queued in the receiver exceed its credit instead of while the receiver exceeds
+// exchg_node_buffer_size_bytes. The credit is a share of exchg_node_buffer_size_bytes among the
+// remaining senders, lowered to what the receiver consumes in exchange_credit_window_ms.
+DECLARE_mBool(enable_exchange_credit_flow_control);
+DECLARE_mInt32(exchange_credit_window_ms);
+// Close an exchange receiver as soon as its limit is reached instead of when its task closes, so
+// senders see the receiver eof on their next RPC and senders in this BE stop without one.
+DECLARE_mBool(enable_exchange_limit_early_close);
+// If > 0 and the query does not set `exchange_multi_blocks_byte_size`, the blocks queued for one
+// destination instance while an RPC is in flight are coalesced into one RPC up to this many bytes.
+DECLARE_mInt64(exchange_sink_coalesce_bytes);
+// If true, the compression codec (none, LZ4 or ZSTD) of the blocks sent to each destination is
+// chosen from the measured compression ratio and speed and the observed RPC throughput.
+DECLARE_mBool(enable_exchange_adaptive_compression);
+// If true, a broadcast exchange sends one copy of each block to every destination BE, the
+// receiving BE fans it out to all the instances on it. Only enable it when all the BEs support it.
+DECLARE_mBool(enable_broadcast_exchange_fanout_per_be);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// Number of rowsets of a tablet converted concurrently by a cloud schema change job, the memory
+// limitation above is split between them
+DECLARE_mInt32(schema_change_convert_rowset_parallelism);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
@@ -391,6 +522,9 @@ DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
+// A row is inserted into the row cache only after missing it this many times recently, so
+// that one-off reads across the key space don't evict hot rows. 1 admits every row.
+DECLARE_mInt32(point_query_row_cache_admission_min_misses);
 DECLARE_mInt32(disk_stat_monitor_interval);
 DECLARE_mInt32(unused_rowset_monitor_interval);
 DECLARE_mInt32(quering_rowsets_evict_interval);
@@ -435,6 +569,15 @@ DECLARE_Int32(storage_page_cache_shard_size);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
+// Percentage of the data page cache that keeps the compressed data pages as read from the file,
+// so that a page evicted after decompression is decompressed again without IO. 0 disables it.
+DECLARE_Int32(compressed_page_cache_percentage);
+// Let one reader load a page missing from the storage page cache while concurrent readers of
+// the same page wait for it, instead of every scan reading and decompressing it
+DECLARE_mBool(enable_page_cache_single_flight_load);
+// Cache the bitshuffle data pages still lz4 compressed and decode them block by block while
+// reading them into the column, instead of decoding the whole page before caching it
+DECLARE_Bool(enable_bitshuffle_fused_page_decode);
 // whether to disable page cache feature in storage
 // TODO delete it. Divided into Data page, Index page, pk index page
 DECLARE_Bool(disable_storage_page_cache);
@@ -454,9 +597,23 @@ DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// Use the scan resistant TinyLFU eviction policy instead of LRU for the storage page caches,
+// the segment cache and the inverted index searcher cache.
+DECLARE_Bool(enable_storage_cache_tiny_lfu);
+// Let the LRU caches serve the hits under a shared lock, marking the entries visited instead of
+// moving them in the LRU list, and evict CLOCK style. Not applied with TinyLFU.
+DECLARE_Bool(enable_lru_cache_lazy_recency);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
+// Evaluate the predicates on the dictionary codes and the RLE runs of the data pages to
+// prune the row ranges before reading the values.
+DECLARE_mBool(enable_encoded_page_predicate_evaluation);
+// Reorder the short circuit predicates and the pushed down common exprs of a segment
+// iterator by their measured cost and selectivity, every `adaptive_predicate_reorder_interval`
+// batches.
+DECLARE_mBool(enable_adaptive_predicate_reorder);
+DECLARE_mInt32(adaptive_predicate_reorder_interval);
 
 // be policy
 // whether check compaction checksum
@@ -633,6 +790,9 @@ DECLARE_mInt64(streaming_load_max_mb);
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 DECLARE_mInt64(streaming_load_json_max_mb);
+// If true, the large segments of a stream load body are handed to the stream load pipe as they
+// were received by libevent instead of being copied into new buffers.
+DECLARE_mBool(enable_stream_load_zero_copy_body);
 // the alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -691,6 +851,10 @@ DECLARE_mBool(enable_token_check);
 
 // to open/close system metrics
 DECLARE_Bool(enable_system_metrics);
+// Record the latency histograms of hot paths (page cache lookups, pipeline and scan task queue
+// waits, exchange RPCs) and the wait of contended hot locks (file cache, LRU cache shards,
+// dependencies), exported as the `hot_path_latency_ns` and `lock_wait_ns` metrics
+DECLARE_mBool(enable_hot_path_metrics);
 
 // Number of cores Doris will used, this will effect only when it's greater than 0.
 // Otherwise, Doris will use all cores returned from "/proc/cpuinfo".
@@ -715,6 +879,13 @@ DECLARE_mInt64(write_buffer_size_for_agg);
 DECLARE_mInt64(min_write_buffer_size_for_partial_update);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// sort the new rows of a memtable by merging their sorted runs when there are at most
+// this many runs, otherwise sort them column by column. 0 means always sort by column
+DECLARE_mInt32(memtable_max_sorted_runs_to_merge);
+// flush a large memtable of a duplicate key table into at most this many segments concurrently,
+// each holding a key range of at least memtable_flush_min_rows_per_segment rows. 1 means disabled
+DECLARE_mInt32(memtable_flush_max_parallel_segments);
+DECLARE_mInt64(memtable_flush_min_rows_per_segment);
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DECLARE_mInt32(memtable_wait_for_memory_sleep_time_s);
@@ -764,6 +935,9 @@ DECLARE_Bool(enable_metric_calculator);
 
 // max consumer num in one data consumer group, for routine load
 DECLARE_mInt32(max_consumer_num_per_group);
+// If larger than 1, each kafka consumer of a routine load task packs up to this many messages into
+// one contiguous buffer before handing them to the task, instead of one message at a time.
+DECLARE_mInt32(routine_load_consume_batch_size);
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -867,12 +1041,20 @@ DECLARE_Int32(query_cache_elasticity_size_mb);
 // Maximum number of cache partitions corresponding to a SQL
 DECLARE_Int32(query_cache_max_partition_count);
 
+// Number of shards of the sql result cache, sql keys of different shards don't share a lock.
+// Each shard is pruned to its own part of query_cache_max_size_mb.
+DECLARE_Int32(query_cache_shard_num);
+
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
 // This is to avoid too many version num.
 DECLARE_mInt32(max_tablet_version_num);
 
 DECLARE_mInt32(time_series_max_tablet_version_num);
+// Fan-out of level 1 in the time series compaction policy: level 1 rowsets are merged into a
+// level 2 rowset once they reach this many times the compaction goal size or time threshold.
+// A larger fan-out rewrites the level 1 data less often.
+DECLARE_mInt32(time_series_compaction_level1_fan_out);
 
 // Frontend mainly use two thrift sever type: THREAD_POOL, THREADED_SELECTOR. if fe use THREADED_SELECTOR model for thrift server,
 // the thrift_server_type_of_fe should be set THREADED_SELECTOR to make be thrift client to fe constructed with TFramedTransport
@@ -880,6 +1062,9 @@ DECLARE_String(thrift_server_type_of_fe);
 
 // disable zone map index when page row is too few
 DECLARE_mInt32(zone_map_row_num_threshold);
+// Keep the distinct values of a page and of a segment in their zone maps when there are no
+// more than this, to prune them for `=` and `IN` predicates. 0 to disable.
+DECLARE_mInt32(zone_map_max_distinct_values);
 
 // aws sdk log level
 //    Off = 0,
@@ -907,6 +1092,11 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
 
+// If true, Allocator skips the process and mem tracker limit checks for an allocation that
+// leaves the thread's untracked memory below mem_tracker_consume_min_size_bytes, so limits
+// are checked at the same granularity the mem tracker is consumed at.
+DECLARE_mBool(enable_amortized_allocator_memory_check);
+
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
 // And as the new version is written and the old version is deleted,
@@ -950,6 +1140,16 @@ DECLARE_mInt32(max_segment_num_per_rowset);
 // segment_compression_threshold_kb.
 DECLARE_mInt32(segment_compression_threshold_kb);
 
+// If true, the first data pages of each column are compressed with the table codec, LZ4F and ZSTD,
+// and the column is compressed with the codec which saves the most for a bounded slowdown, or not
+// at all if no codec saves enough. The codec is kept in the column meta.
+DECLARE_mBool(enable_adaptive_column_compression);
+// The number of data pages of a column sampled to choose its codec.
+DECLARE_mInt32(adaptive_column_compression_sample_pages);
+// A codec other than the table codec is chosen only if it makes the sampled pages at least this
+// much smaller.
+DECLARE_mDouble(adaptive_column_compression_min_gain);
+
 // Time to clean up useless JDBC connection pool cache
 DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
 
@@ -957,9 +1157,15 @@ DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
 DECLARE_Int64(delete_bitmap_agg_cache_capacity);
 DECLARE_String(delete_bitmap_dynamic_agg_cache_limit);
 DECLARE_mInt32(delete_bitmap_agg_cache_stale_sweep_time_sec);
+// Convert delete bitmaps to run containers and release spare capacity when they are loaded
+// into tablet meta or the txn delete bitmap cache, trading some cpu for resident memory
+DECLARE_mBool(enable_delete_bitmap_run_optimize);
 
 // A common object cache depends on an Sharded LRU Cache.
 DECLARE_mInt32(common_obj_lru_cache_stale_sweep_time_sec);
+// max number of regexps compiled for non constant patterns kept in the process wide cache,
+// 0 to disable
+DECLARE_Int64(regexp_cache_num);
 
 // reference https://github.com/edenhill/librdkafka/blob/master/INTRODUCTION.md#broker-version-compatibility
 // If the dependent kafka broker version older than 0.10.0.0,
@@ -1025,6 +1231,9 @@ DECLARE_mDouble(max_amplified_read_ratio);
 // 1MB for oss, 8KB for hdfs
 DECLARE_mInt32(merged_oss_min_io_size);
 DECLARE_mInt32(merged_hdfs_min_io_size);
+// Max bytes of the column chunks of the next row group prefetched by a parquet reader on object
+// storage while the current row group is read, 0 to disable
+DECLARE_mInt64(parquet_row_group_prefetch_max_bytes);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -1032,6 +1241,12 @@ DECLARE_mInt64(big_column_size_buffer);
 DECLARE_mInt64(small_column_size_buffer);
 
 DECLARE_mInt32(runtime_filter_sampling_frequency);
+// Push bloom and IN runtime filters that arrive after the scan node has opened down to the
+// storage reader of olap scanners that have not been prepared yet
+DECLARE_mBool(enable_late_arrival_runtime_filter_pushdown);
+// Extra time consumers keep waiting once the producers on their backend have sent a global
+// runtime filter to the merge node, 0 to disable
+DECLARE_mInt32(runtime_filter_merge_wait_extension_ms);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
 
@@ -1060,6 +1275,9 @@ DECLARE_mInt64(nodechannel_pending_queue_max_bytes);
 
 // The batch size for sending data by brpc streaming client
 DECLARE_mInt64(brpc_streaming_client_batch_bytes);
+// Coalesce the small appends to a segment file streamed to other backends into one stream
+// message until this many bytes, 0 means every append is sent as a message
+DECLARE_mInt64(stream_sink_file_writer_buffer_bytes);
 DECLARE_mInt64(block_cache_wait_timeout_ms);
 
 DECLARE_Bool(enable_brpc_builtin_services);
@@ -1136,6 +1354,14 @@ DECLARE_Bool(enable_file_cache);
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
+// Once a CachedRemoteFileReader sees sequential reads, read this many file cache blocks ahead
+// of the current read into the file cache in the background with one remote read.
+// 0 means no read-ahead.
+DECLARE_mInt32(file_cache_sequential_read_ahead_blocks);
+// Compression of the index blocks and of all other blocks in the file cache, "lz4", "zstd" or empty
+// for none. A block is only kept compressed if that saves at least 1/8 of its size.
+DECLARE_String(file_cache_index_block_compression);
+DECLARE_String(file_cache_normal_block_compression);
 DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
@@ -1163,10 +1389,22 @@ DECLARE_mInt64(cache_lock_held_long_tail_threshold_us);
 // If your file cache is ample enough to accommodate all the data in your database,
 // enable this option; otherwise, it is recommended to leave it disabled.
 DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
+// Keep the base compaction output in the file cache if the tablet was queried at least this many
+// times in the last day, so the next queries do not land on a cold cache. 0 means disabled.
+DECLARE_mInt64(file_cache_keep_base_compaction_output_min_qpd);
+// Only keep the compaction output in the file cache when at least this ratio of the input
+// rowset bytes is in the file cache, so compacting cold data does not push hot data out.
+// 0 means always follow the rules above.
+DECLARE_mDouble(file_cache_compaction_output_min_hot_ratio);
 DECLARE_mBool(enable_file_cache_adaptive_write);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
+// Prefetch the data pages a segment iterator is going to read into the file cache
+// in the background, ahead of decoding them.
+DECLARE_mBool(enable_segment_page_prefetch);
+// The max bytes of data pages a segment iterator prefetches ahead of the row it reads.
+DECLARE_mInt64(segment_page_prefetch_window_bytes);
 DECLARE_mInt64(file_cache_background_monitor_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_batch);
@@ -1178,6 +1416,15 @@ DECLARE_mInt64(file_cache_background_lru_dump_interval_ms);
 DECLARE_mInt64(file_cache_background_lru_dump_update_cnt_threshold);
 DECLARE_mInt64(file_cache_background_lru_dump_tail_record_num);
 DECLARE_mInt64(file_cache_background_lru_log_replay_interval_ms);
+// A cache block hit again within this many seconds is not moved to the end of its lru queue
+// again, which keeps hot blocks from taking the cache lock for a queue update on every read.
+// 0 means always move.
+DECLARE_mInt64(file_cache_lru_move_min_interval_s);
+// The number of recently filled blocks remembered for the admission into the normal queue.
+// When > 0, a normal block filled for the first time goes to the disposable queue, it is only
+// admitted into the normal queue when it is filled again while remembered or hit by a query.
+// This keeps one-off scans like exports from flushing the working set. 0 means always admit.
+DECLARE_mInt64(file_cache_normal_admission_ghost_num);
 DECLARE_mBool(enable_evaluate_shadow_queue_diff);
 
 // inverted index searcher cache
@@ -1188,6 +1435,9 @@ DECLARE_mInt32(inverted_index_cache_stale_sweep_time_sec);
 // inverted index searcher cache size
 DECLARE_String(inverted_index_searcher_cache_limit);
 DECLARE_mBool(enable_write_index_searcher_cache);
+// open the inverted index searchers of a compaction output rowset into the searcher cache when
+// its tablet has already been queried, so the first query on the new segments skips the open
+DECLARE_mBool(enable_compaction_index_searcher_preload);
 DECLARE_Bool(enable_inverted_index_cache_check_timestamp);
 DECLARE_mBool(enable_inverted_index_correct_term_write);
 DECLARE_Int32(inverted_index_fd_number_limit_percent); // 50%
@@ -1217,6 +1467,11 @@ DECLARE_Int32(num_broadcast_buffer);
 
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
+// Release the intermediate columns of a function call as soon as the call has consumed them,
+// so the next node of the expression tree can reuse their memory.
+DECLARE_mBool(enable_expr_release_intermediate_columns);
+// Evaluate the branches of CASE and IF only on the rows that take them.
+DECLARE_mBool(enable_conditional_branch_on_selected_rows);
 
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
@@ -1227,6 +1482,11 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The part size of a s3 multipart upload doubles every this many parts, up to
+// s3_write_buffer_max_size, so that large files need fewer requests and stay below the limit
+// of 10000 parts. 0 means all parts are s3_write_buffer_size.
+DECLARE_mInt32(s3_write_buffer_grow_parts_num);
+DECLARE_mInt64(s3_write_buffer_max_size);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1243,6 +1503,13 @@ DECLARE_Int32(segment_cache_capacity);
 DECLARE_Int32(segment_cache_fd_percentage);
 DECLARE_Int32(segment_cache_memory_percentage);
 DECLARE_Bool(enable_segment_cache_prune);
+// The local file keeping the footers of the segments opened recently across restarts, so that
+// they are not read again from the segment files. Empty to disable it.
+DECLARE_String(segment_footer_snapshot_path);
+// Max bytes of the footers kept in the snapshot.
+DECLARE_Int64(segment_footer_snapshot_capacity);
+// Interval to write the snapshot file, it is also written at graceful shutdown.
+DECLARE_Int32(segment_footer_snapshot_interval_sec);
 
 DECLARE_mInt32(estimated_mem_per_column_reader);
 
@@ -1258,6 +1525,8 @@ DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max bytes of the serialized parquet page indexes cached for external files, 0 to disable
+DECLARE_Int64(max_external_file_page_index_cache_size);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1371,6 +1640,10 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Lower bound of the adaptive group commit interval. A group commit which only got one load
+// halves the interval of the next one of the table for lower latency, a busier one doubles it
+// back up to the table's group_commit_interval_ms. 0 means always use the table's interval.
+DECLARE_mInt32(group_commit_adaptive_min_interval_ms);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1416,8 +1689,20 @@ DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 // The max sparse column statistics size for a variant column
 DECLARE_mInt32(variant_max_sparse_column_statistics_size);
+// A variant path that queries read out of the sparse column at least this many times is
+// materialized as a subcolumn by the next compaction ahead of the more frequent paths.
+// 0 disables the tracking.
+DECLARE_mInt32(variant_hot_path_min_access_count);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// Capacity of the single-producer/single-consumer ring between each pair of local shuffle sink
+// and source. The blocks are pushed to the shared queue of the source if the ring is full. 0 means
+// all the sinks push to the shared queue.
+DECLARE_mInt32(local_shuffle_spsc_ring_capacity);
+// If the queued bytes of one source of an adaptive passthrough local exchange exceed this ratio
+// of the average, the sinks split the blocks by rows again until the sources are balanced. The
+// passthrough blocks also prefer the less loaded source. 0 means disabled.
+DECLARE_mDouble(local_exchange_skew_ratio);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1429,6 +1714,13 @@ DECLARE_Int32(ignore_invalid_partition_id_rowset_num);
 DECLARE_mInt32(report_query_statistics_interval_ms);
 DECLARE_mInt32(query_statistics_reserve_timeout_ms);
 DECLARE_mInt32(report_exec_status_thread_num);
+// If true, the reads of each query are recorded per tier (page cache, file cache, local disk,
+// remote storage) into its IO ledger, shown in the query profile and aggregated per workload group.
+DECLARE_mBool(enable_query_io_ledger);
+// Max number of distinct files tracked by the IO ledger of a query.
+DECLARE_mInt32(query_io_ledger_max_files);
+// Number of files read the most bytes from shown in the IO ledger.
+DECLARE_mInt32(query_io_ledger_top_files);
 
 // consider two high usage disk at the same available level if they do not exceed this diff.
 DECLARE_mDouble(high_disk_avail_level_diff_usages);
@@ -1448,6 +1740,20 @@ DECLARE_mInt32(spill_gc_interval_ms);
 DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
+// The threads reading the next block of each spilled run ahead of the merge, 0 means the runs are
+// read synchronously by the merge.
+DECLARE_Int32(spill_read_ahead_thread_pool_thread_num);
+// Submit the batched reads of the local files, e.g. the columns of a spilled block, with one
+// io_uring_enter instead of one pread per range. Falls back to pread if io_uring is unavailable.
+DECLARE_mBool(enable_local_io_uring);
+// The submission queue depth of the io_uring of each thread.
+DECLARE_Int32(local_io_uring_queue_depth);
+// In cloud mode, spill to the object storage of the latest storage vault when all the local spill
+// dirs reach their capacity limit, instead of failing the query.
+DECLARE_mBool(enable_spill_to_remote_storage);
+// Start spilling the spillable operators of a query once its memory usage exceeds this fraction of
+// the query memory limit, a value not less than 1 only spills when a reservation fails.
+DECLARE_mDouble(spill_proactive_query_memory_ratio);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
 DECLARE_Int64(wait_cancel_release_memory_ms);
 
@@ -1474,6 +1780,16 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// Hedge s3 reads against slow responses: when a GET of at most s3_read_hedge_max_bytes has not
+// finished after the recent p95 GET latency (at least s3_read_hedge_min_delay_ms), the same range
+// is requested again and the first response wins. At most s3_read_hedge_max_percent of the GETs
+// are hedged.
+DECLARE_mBool(enable_s3_read_hedge);
+DECLARE_mInt32(s3_read_hedge_min_delay_ms);
+DECLARE_mInt32(s3_read_hedge_max_percent);
+DECLARE_mInt64(s3_read_hedge_max_bytes);
+// The max number of threads running the GETs of hedged s3 reads
+DECLARE_Int32(max_s3_read_hedge_thread_num);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1546,6 +1862,9 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to load the tablet metas of one data dir, 1 means loading them in the thread
+// which traverses the meta
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1563,6 +1882,9 @@ DECLARE_mInt64(compaction_memory_bytes_limit);
 DECLARE_mInt64(compaction_batch_size);
 
 DECLARE_mBool(enable_parquet_page_index);
+// Filter parquet row groups by the dictionary of fully dictionary encoded columns for `=` and
+// `IN` predicates, which reads the dictionary pages of these columns in advance.
+DECLARE_mBool(enable_parquet_dict_row_group_filter);
 
 // Wheather to ignore not found file in external teble(eg, hive)
 // Default is true, if set to false, the not found file will result in query failure.
@@ -1574,6 +1896,22 @@ DECLARE_mBool(enable_hdfs_mem_limiter);
 // we should do agg limit opt
 DECLARE_mInt16(topn_agg_limit_multiplier);
 
+// Re-prune the unread rows of a segment by the page zone maps when the topn filter is tightened
+// by any instance of the query during the scan.
+DECLARE_mBool(enable_topn_filter_dynamic_pruning);
+
+// Sort a block by multiple fixed width keys by encoding the keys of each row into one
+// memcomparable key, instead of comparing the key columns one by one.
+DECLARE_mBool(enable_sort_normalized_key);
+
+// Evaluate min/max over a sliding rows frame with a monotonic queue of the frame rows, instead of
+// scanning the whole frame again when the row leaving the frame is the current extremum.
+DECLARE_mBool(enable_analytic_sliding_extremum);
+
+// Compute row_number and sum over rows between unbounded preceding and current row for a range of
+// rows at a time, from the result of the rows before the range.
+DECLARE_mBool(enable_analytic_running_frame_batch);
+
 DECLARE_mInt64(tablet_meta_serialize_size_limit);
 
 DECLARE_mInt64(pipeline_task_leakage_detect_period_secs);
@@ -1587,6 +1925,9 @@ DECLARE_mInt32(check_score_rounds_num);
 
 // MB
 DECLARE_Int32(query_cache_size);
+// Reuse a query cache entry of an older tablet version by scanning only the appended rowsets,
+// only for partial aggregations on duplicate key tablets without deletes in the appended range.
+DECLARE_mBool(enable_incremental_query_cache);
 DECLARE_Bool(force_regenerate_rowsetid_on_start_error);
 
 // Enable validation to check the correctness of table size.
@@ -1596,6 +1937,9 @@ DECLARE_mBool(enable_sleep_between_delete_cumu_compaction);
 
 DECLARE_mInt32(compaction_num_per_round);
 DECLARE_mInt32(max_automatic_compaction_num_per_round);
+// Weight of the query read frequency when ranking tablets for compaction, the score is scaled
+// by (1 + weight * log2(1 + recent scans per minute)). 0 means rank by compaction score only.
+DECLARE_mDouble(compaction_score_read_hotness_weight);
 
 DECLARE_mInt32(check_tablet_delete_bitmap_interval_seconds);
 DECLARE_mInt32(check_tablet_delete_bitmap_score_top_n);
@@ -1637,12 +1981,25 @@ DECLARE_String(fuzzy_test_type);
 
 // The maximum csv line reader output buffer size
 DECLARE_mInt64(max_csv_line_reader_output_buffer_size);
+// The number of decompressed chunks (4MB each) that a compressed text file is read and
+// decompressed ahead of the line parsing on another thread. 0 means decompressing inline.
+DECLARE_mInt32(text_decompress_pipeline_queue_size);
+// The max number of threads decompressing text files ahead of the line parsing
+DECLARE_Int32(max_text_decompress_thread_num);
 
 // The maximum number of threads supported when executing LLMFunction
 DECLARE_mInt32(llm_max_concurrent_requests);
 
 // Maximum number of OpenMP threads that can be used by each Doris thread
 DECLARE_Int32(omp_threads_limit);
+// Number of inverted lists an IVF ann index search scans per query
+DECLARE_mInt32(ann_index_ivf_nprobe);
+// An IVF ann index built with `refine` re-ranks this many candidates per wanted row by their
+// exact distance
+DECLARE_mInt32(ann_index_ivf_refine_factor);
+// Drop the ann topn results of a segment that rank behind the k-th best distance already found
+// by the other segments of the same scan
+DECLARE_mBool(enable_ann_topn_global_pruning);
 // The capacity of segment partial column cache, used to cache column readers for each segment.
 DECLARE_mInt32(max_segment_partial_column_cache_size);
 
@@ -552,6 +552,53 @@ bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
            || !comparator(key, std::tuple {part->start_key.first, part->start_key.second, false});
 }
 
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    if (_is_in_partition) {
+        for (int row = 0; row < rows; row++) {
+            find_partition(block, row, partitions[row]);
+        }
+        return;
+    }
+
+    VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
+    VOlapTablePartition* last_partition = nullptr;
+    for (int row = 0; row < rows; row++) {
+        BlockRowWithIndicator key {block, row, true};
+        // ranges don't overlap, so key in [start, end) of the last partition is enough.
+        if (last_partition != nullptr &&
+            comparator(key, std::tuple {last_partition->end_key.first,
+                                        last_partition->end_key.second, false}) &&
+            _part_contains(last_partition, key)) {
+            partitions[row] = last_partition;
+            continue;
+        }
+        find_partition(block, row, partitions[row]);
+        last_partition = partitions[row];
+    }
+}
+
+void VOlapTablePartitionParam::_find_tablets_by_hash(
+        vectorized::Block* block, const std::vector<uint32_t>& indexes,
+        const std::vector<VOlapTablePartition*>& partitions,
+        std::vector<uint32_t>& tablet_indexes) const {
+    std::vector<uint32_t> hash_vals(indexes.size(), 0);
+    for (auto slot_loc : _distributed_slot_locs) {
+        const auto type = _slots[slot_loc]->type()->get_primitive_type();
+        const auto& column = block->get_by_position(slot_loc).column;
+        for (size_t i = 0; i < indexes.size(); i++) {
+            auto val = column->get_data_at(indexes[i]);
+            hash_vals[i] = val.data != nullptr
+                                   ? RawValue::zlib_crc32(val.data, val.size, type, hash_vals[i])
+                                   : HashUtil::zlib_crc_hash_null(hash_vals[i]);
+        }
+    }
+    for (size_t i = 0; i < indexes.size(); i++) {
+        auto index = indexes[i];
+        tablet_indexes[index] = cast_set<uint32_t>(hash_vals[i] % partitions[index]->num_buckets);
+    }
+}
+
 // insert value into _partition_block's column
 // NOLINTBEGIN(readability-function-size)
 static Status _create_partition_key(const TExprNode& t_expr, BlockRow* part_key, uint16_t pos) {
@@ -222,16 +222,26 @@ public:
         return (partition != nullptr);
     }
 
+    // find partitions for the first `rows` rows of block. rows of a load usually come clustered
+    // by partition, so for range partitions the partition of the previous row is checked first
+    // and the map is only searched when the row falls out of it.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
             std::vector<uint32_t>& tablet_indexes /*result*/,
             /*TODO: check if flat hash map will be better*/
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
+        if (!_distributed_slot_locs.empty() && partition_tablets_buffer == nullptr) {
+            _find_tablets_by_hash(block, indexes, partitions, tablet_indexes);
+            return;
+        }
+
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
         if (!_distributed_slot_locs.empty()) {
-            //TODO: refactor by saving the hash values. then we can calculate in columnwise.
             compute_function = [this](vectorized::Block* block, uint32_t row,
                                       const VOlapTablePartition& partition) -> uint32_t {
                 uint32_t hash_val = 0;
@@ -309,6 +319,11 @@ public:
 private:
     Status _create_partition_keys(const std::vector<TExprNode>& t_exprs, BlockRow* part_key);
 
+    // compute the hash bucket of the rows in `indexes`, one distribution column at a time.
+    void _find_tablets_by_hash(vectorized::Block* block, const std::vector<uint32_t>& indexes,
+                               const std::vector<VOlapTablePartition*>& partitions,
+                               std::vector<uint32_t>& tablet_indexes) const;
+
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
@@ -115,6 +115,34 @@ public:
         return bucket_find(bucket_idx, hash);
 #endif
     }
+    // Finds 'n' hashes at once and sets results[i] to find(hashes[i]). The bucket of a later
+    // hash is prefetched while probing the current one, which hides the cache misses of a
+    // filter larger than the cache.
+    void find_batch(const uint32_t* __restrict hashes, size_t n,
+                    uint8_t* __restrict results) const noexcept {
+        if (_always_false) {
+            memset(results, 0, n);
+            return;
+        }
+        constexpr size_t kPrefetchDistance = 16;
+        for (size_t i = 0; i < n; ++i) {
+            if (i + kPrefetchDistance < n) {
+                __builtin_prefetch(
+                        &_directory[rehash32to32(hashes[i + kPrefetchDistance]) & _directory_mask]);
+            }
+            const uint32_t bucket_idx = rehash32to32(hashes[i]) & _directory_mask;
+#ifdef __AVX2__
+            results[i] = static_cast<uint8_t>(_mm256_testc_si256(
+                    reinterpret_cast<__m256i*>(_directory)[bucket_idx], make_mark(hashes[i])));
+#else
+            results[i] = bucket_find(bucket_idx, hashes[i]);
+#endif
+        }
+#ifdef __AVX2__
+        _mm256_zeroupper();
+#endif
+    }
+
     // Same as above with convenience of hashing the key.
     bool find(const StringRef& key) const noexcept {
         if (key.data) {
@@ -28,6 +28,9 @@
 
 namespace doris {
 
+// the number of rows hashed before probing the bloom filter in a batch
+static constexpr int BLOOM_FILTER_PROBE_BATCH_SIZE = 256;
+
 class BloomFilterAdaptor : public FilterBase {
 public:
     BloomFilterAdaptor(bool null_aware) : FilterBase(null_aware) {
@@ -56,6 +59,10 @@ public:
 
     bool test(uint32_t data) const { return _bloom_filter->find(data); }
 
+    void test_batch(const uint32_t* hashes, size_t n, uint8_t* results) const {
+        _bloom_filter->find_batch(hashes, n, results);
+    }
+
     template <typename fixed_len_to_uint32_method, typename T>
     bool test_element(T element) const {
         if constexpr (std::is_same_v<T, StringRef>) {
@@ -139,7 +146,25 @@ struct CommonFindOp {
         }
 
         const auto size = column->size();
-        if (nullmap) {
+        if constexpr (!std::is_same_v<T, StringRef>) {
+            // hash a batch of rows first, so that the probes can prefetch their buckets
+            uint32_t hashes[BLOOM_FILTER_PROBE_BATCH_SIZE];
+            for (size_t begin = 0; begin < size; begin += BLOOM_FILTER_PROBE_BATCH_SIZE) {
+                const size_t end = std::min(size, begin + BLOOM_FILTER_PROBE_BATCH_SIZE);
+                for (size_t i = begin; i < end; i++) {
+                    hashes[i - begin] = fixed_len_to_uint32_method()(data[i]);
+                }
+                bloom_filter.test_batch(hashes, end - begin, results + begin);
+            }
+            if (nullmap) {
+                const bool contain_null = bloom_filter.contain_null();
+                for (size_t i = 0; i < size; i++) {
+                    if (nullmap[i]) {
+                        results[i] = contain_null;
+                    }
+                }
+            }
+        } else if (nullmap) {
             for (size_t i = 0; i < size; i++) {
                 if (!nullmap[i]) {
                     results[i] = bloom_filter.test_element<fixed_len_to_uint32_method>(data[i]);
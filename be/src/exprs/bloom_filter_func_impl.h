@@ -73,6 +73,29 @@ uint16_t find_batch_olap(const BloomFilterAdaptor& bloom_filter, const char* dat
     };
 
     uint16_t new_size = 0;
+    if constexpr (!std::is_same_v<T, StringRef>) {
+        // hash a batch of rows first, so that the probes can prefetch their buckets
+        uint32_t hashes[BLOOM_FILTER_PROBE_BATCH_SIZE];
+        uint8_t found[BLOOM_FILTER_PROBE_BATCH_SIZE];
+        const bool contain_null = bloom_filter.contain_null();
+        for (int begin = 0; begin < number; begin += BLOOM_FILTER_PROBE_BATCH_SIZE) {
+            const int end = std::min(number, begin + BLOOM_FILTER_PROBE_BATCH_SIZE);
+            for (int i = begin; i < end; i++) {
+                const uint16_t idx = is_parse_column ? offsets[i] : static_cast<uint16_t>(i);
+                hashes[i - begin] = fixed_len_to_uint32_method()(get_element(data, idx));
+            }
+            bloom_filter.test_batch(hashes, static_cast<size_t>(end - begin), found);
+            // new_size never passes i, so the offsets not read yet are never overwritten
+            for (int i = begin; i < end; i++) {
+                const uint16_t idx = is_parse_column ? offsets[i] : static_cast<uint16_t>(i);
+                const bool pass =
+                        (nullmap != nullptr && nullmap[idx]) ? contain_null : found[i - begin] != 0;
+                offsets[new_size] = idx;
+                new_size += pass;
+            }
+        }
+        return new_size;
+    }
     if (is_parse_column) {
         if (nullmap == nullptr) {
             for (uint16_t i = 0; i < number; i++) {
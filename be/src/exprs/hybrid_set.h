@@ -19,6 +19,13 @@
 
 #include <gen_cpp/internal_service.pb.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "common/object_pool.h"
 #include "exprs/filter_base.h"
 #include "runtime/primitive_type.h"
@@ -192,10 +199,64 @@ public:
 
     size_t size() const { return _set.size(); }
 
+    template <typename Func>
+    void for_each(Func&& func) const {
+        for (const auto& value : _set) {
+            func(value);
+        }
+    }
+
 private:
     vectorized::flat_hash_set<T> _set;
 };
 
+/**
+ * Bitmap over [min, max] of a dense integer set, lookups test one bit instead of hashing
+ * and probing a random slot of the hash set.
+ * @tparam T Integer Element Type
+ */
+template <typename T>
+class DenseIntegerBitmap {
+public:
+    // Build from the values, returns false if they are too sparse. The bitmap takes at most
+    // 64 bits per value so it is never larger than the hash set it replaces.
+    template <typename Container>
+    bool build(const Container& values) {
+        if (values.size() == 0) {
+            return false;
+        }
+        T min_value = std::numeric_limits<T>::max();
+        T max_value = std::numeric_limits<T>::lowest();
+        values.for_each([&](const T& value) {
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+        });
+        auto range = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+        if (range / 64 >= values.size()) {
+            return false;
+        }
+        _min = static_cast<uint64_t>(min_value);
+        _range = range;
+        _bits.assign(range / 64 + 1, 0);
+        values.for_each([&](const T& value) {
+            auto offset = static_cast<uint64_t>(value) - _min;
+            _bits[offset >> 6] |= uint64_t(1) << (offset & 63);
+        });
+        return true;
+    }
+
+    bool find(const T& value) const {
+        // values below min wrap around to a large offset
+        auto offset = static_cast<uint64_t>(value) - _min;
+        return offset <= _range && ((_bits[offset >> 6] >> (offset & 63)) & 1);
+    }
+
+private:
+    uint64_t _min = 0;
+    uint64_t _range = 0;
+    std::vector<uint64_t> _bits;
+};
+
 // TODO Maybe change void* parameter to template parameter better.
 class HybridSetBase : public FilterBase {
 public:
@@ -269,8 +330,12 @@ public:
             return;
         }
         _set.insert(*reinterpret_cast<const ElementType*>(data));
+        _invalidate_dense_bitmap();
+    }
+    void clear() override {
+        _set.clear();
+        _invalidate_dense_bitmap();
     }
-    void clear() override { _set.clear(); }
 
     void insert(void* data, size_t /*unused*/) override { insert(data); }
 
@@ -298,12 +363,19 @@ public:
                 _set.insert(*(data + i));
             }
         }
+        _invalidate_dense_bitmap();
     }
 
     int size() override { return (int)_set.size(); }
 
     bool find(const void* data) const override {
-        return _set.find(*reinterpret_cast<const ElementType*>(data));
+        const auto& value = *reinterpret_cast<const ElementType*>(data);
+        if constexpr (can_use_dense_bitmap) {
+            if (const auto* bitmap = _get_dense_bitmap()) {
+                return bitmap->find(value);
+            }
+        }
+        return _set.find(value);
     }
 
     bool find(const void* data, size_t /*unused*/) const override { return find(data); }
@@ -336,7 +408,7 @@ public:
                      doris::vectorized::ColumnUInt8::Container& results) {
         auto& col = assert_cast<const ColumnType&>(column);
         const auto* __restrict data = (ElementType*)col.get_data().data();
-        const uint8_t* __restrict null_map_data;
+        const uint8_t* __restrict null_map_data = nullptr;
         if constexpr (is_nullable) {
             null_map_data = null_map->data();
         }
@@ -344,17 +416,30 @@ public:
         if constexpr (IsFixedContainer<ContainerType>::value) {
             _set.check_size();
         }
+        if constexpr (can_use_dense_bitmap) {
+            if (const auto* bitmap = _get_dense_bitmap()) {
+                _find_batch_in<is_nullable, is_negative>(*bitmap, data, null_map_data, rows,
+                                                         results);
+                return;
+            }
+        }
+        _find_batch_in<is_nullable, is_negative>(_set, data, null_map_data, rows, results);
+    }
 
+    template <bool is_nullable, bool is_negative, typename Lookup>
+    static void _find_batch_in(const Lookup& lookup, const ElementType* __restrict data,
+                               const uint8_t* __restrict null_map_data, size_t rows,
+                               doris::vectorized::ColumnUInt8::Container& results) {
         auto* __restrict result_data = results.data();
         for (size_t i = 0; i < rows; ++i) {
             if constexpr (!is_nullable && !is_negative) {
-                result_data[i] = _set.find(data[i]);
+                result_data[i] = lookup.find(data[i]);
             } else if constexpr (!is_nullable && is_negative) {
-                result_data[i] = !_set.find(data[i]);
+                result_data[i] = !lookup.find(data[i]);
             } else if constexpr (is_nullable && !is_negative) {
-                result_data[i] = _set.find(data[i]) & (!null_map_data[i]);
+                result_data[i] = lookup.find(data[i]) & (!null_map_data[i]);
             } else { // (is_nullable && is_negative)
-                result_data[i] = !(_set.find(data[i]) & (!null_map_data[i]));
+                result_data[i] = !(lookup.find(data[i]) & (!null_map_data[i]));
             }
         }
     }
@@ -386,8 +471,43 @@ public:
     void to_pb(PInFilter* filter) override { set_pb(filter, get_convertor<ElementType>()); }
 
 private:
+    // small sets already use FixedContainer, larger integer sets switch to a bitmap when
+    // their values are dense
+    static constexpr bool can_use_dense_bitmap = std::is_integral_v<ElementType> &&
+                                                 sizeof(ElementType) <= sizeof(uint64_t) &&
+                                                 !IsFixedContainer<ContainerType>::value;
+
+    void _invalidate_dense_bitmap() {
+        if constexpr (can_use_dense_bitmap) {
+            _dense_checked.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // The set is filled before it is probed, so the bitmap is built by the first lookup and
+    // shared by the threads probing the set afterwards.
+    const DenseIntegerBitmap<ElementType>* _get_dense_bitmap() const {
+        if (!_dense_checked.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_dense_lock);
+            if (!_dense_checked.load(std::memory_order_relaxed)) {
+                _dense_bitmap.reset();
+                if (_set.size() > FIXED_CONTAINER_MAX_SIZE) {
+                    auto bitmap = std::make_unique<DenseIntegerBitmap<ElementType>>();
+                    if (bitmap->build(_set)) {
+                        _dense_bitmap = std::move(bitmap);
+                    }
+                }
+                _dense_checked.store(true, std::memory_order_release);
+            }
+        }
+        return _dense_bitmap.get();
+    }
+
     ContainerType _set;
     ObjectPool _pool;
+
+    mutable std::mutex _dense_lock;
+    mutable std::atomic<bool> _dense_checked = false;
+    mutable std::unique_ptr<DenseIntegerBitmap<ElementType>> _dense_bitmap;
 };
 
 template <typename _ContainerType = DynamicContainer<std::string>>
@@ -25,6 +25,7 @@
 
 #include <sstream>
 
+#include "runtime/exec_env.h"
 #include "util/string_util.h"
 
 // NOTE: be careful not to use string::append.  It is not performant.
@@ -101,4 +102,28 @@ bool StringFunctions::compile_regex(const StringRef& pattern, std::string* error
     return true;
 }
 
+const re2::RE2* StringFunctions::compile_regex_cached(const StringRef& pattern,
+                                                     std::string* error_str,
+                                                     const StringRef& options_value,
+                                                     ObjLRUCache::CacheHandle* handle,
+                                                     std::unique_ptr<re2::RE2>& scoped_re) {
+    auto* cache = ExecEnv::GetInstance()->regexp_cache();
+    if (cache == nullptr || !cache->enabled()) {
+        if (!compile_regex(pattern, error_str, StringRef(), options_value, scoped_re)) {
+            return nullptr;
+        }
+        return scoped_re.get();
+    }
+    // the options are the only input besides the pattern that changes the compiled regex
+    ObjLRUCache::ObjKey key(options_value.to_string() + '\0' + pattern.to_string());
+    if (cache->lookup(key, handle)) {
+        return handle->data<re2::RE2>();
+    }
+    if (!compile_regex(pattern, error_str, StringRef(), options_value, scoped_re)) {
+        return nullptr;
+    }
+    cache->insert(key, scoped_re.release(), handle);
+    return handle->data<re2::RE2>();
+}
+
 } // namespace doris
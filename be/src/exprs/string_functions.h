@@ -25,6 +25,7 @@
 #include <memory>
 #include <string>
 
+#include "util/obj_lru_cache.h"
 #include "vec/common/string_ref.h"
 
 namespace doris {
@@ -38,5 +39,13 @@ public:
     static bool compile_regex(const StringRef& pattern, std::string* error_str,
                               const StringRef& match_parameter, const StringRef& options_value,
                               std::unique_ptr<re2::RE2>& re);
+
+    // Same as compile_regex without match parameter, but shares the regex through the process
+    // wide regexp cache when it is enabled. The returned regex is owned by handle if cached,
+    // otherwise by scoped_re. Returns nullptr if the pattern could not be compiled.
+    static const re2::RE2* compile_regex_cached(const StringRef& pattern, std::string* error_str,
+                                                const StringRef& options_value,
+                                                ObjLRUCache::CacheHandle* handle,
+                                                std::unique_ptr<re2::RE2>& scoped_re);
 };
 } // namespace doris
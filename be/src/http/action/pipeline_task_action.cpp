@@ -24,6 +24,7 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_status.h"
+#include "pipeline/pipeline_event_trace.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
@@ -54,8 +55,8 @@ void LongPipelineTaskAction::handle(HttpRequest* req) {
                             ExecEnv::GetInstance()->fragment_mgr()->dump_pipeline_tasks(duration));
 }
 
-void QueryPipelineTaskAction::handle(HttpRequest* req) {
-    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
+// Parse the `query_id` param, reply the error and return false if it is invalid.
+static bool parse_query_id(HttpRequest* req, TUniqueId* query_id) {
     int64_t high = 0;
     int64_t low = 0;
     try {
@@ -64,7 +65,7 @@ void QueryPipelineTaskAction::handle(HttpRequest* req) {
             HttpChannel::send_reply(
                     req, HttpStatus::INTERNAL_SERVER_ERROR,
                     "Invalid query id! Query id should be {hi}-{lo} which is a hexadecimal. \n");
-            return;
+            return false;
         }
         from_hex(&high, query_id_str.substr(0, 16));
         from_hex(&low, query_id_str.substr(17));
@@ -75,13 +76,36 @@ void QueryPipelineTaskAction::handle(HttpRequest* req) {
         LOG(WARNING) << fmt::to_string(debug_string_buffer);
         HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR,
                                 fmt::to_string(debug_string_buffer));
-        return;
+        return false;
     }
+    query_id->hi = high;
+    query_id->lo = low;
+    return true;
+}
+
+void QueryPipelineTaskAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
     TUniqueId query_id;
-    query_id.hi = high;
-    query_id.lo = low;
+    if (!parse_query_id(req, &query_id)) {
+        return;
+    }
     HttpChannel::send_reply(req, HttpStatus::OK,
                             ExecEnv::GetInstance()->fragment_mgr()->dump_pipeline_tasks(query_id));
 }
 
+void PipelineEventTraceAction::handle(HttpRequest* req) {
+    TUniqueId query_id;
+    bool filter_query = !req->param("query_id").empty();
+    if (filter_query && !parse_query_id(req, &query_id)) {
+        return;
+    }
+    auto* tracer = pipeline::PipelineEventTracer::instance();
+    auto json = tracer->to_chrome_trace_json(filter_query ? &query_id : nullptr);
+    if (req->param("clear") == "true") {
+        tracer->clear();
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK, json);
+}
+
 } // end namespace doris
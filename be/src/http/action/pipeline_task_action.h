@@ -51,4 +51,16 @@ public:
     void handle(HttpRequest* req) override;
 };
 
+// Export the pipeline task scheduling events as Chrome trace / Perfetto JSON, see
+// `enable_pipeline_event_trace`. Only the events of `query_id` are exported if it is given, the
+// recorded events are dropped after the export if `clear=true`.
+class PipelineEventTraceAction : public HttpHandlerWithAuth {
+public:
+    PipelineEventTraceAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~PipelineEventTraceAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
 } // end namespace doris
@@ -43,6 +43,7 @@
 #include "http/http_method.h"
 #include "http/http_request.h"
 #include "io/fs/local_file_system.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "runtime/exec_env.h"
 #include "util/bfd_parser.h"
 #include "util/pprof_utils.h" // IWYU pragma: keep
@@ -165,6 +166,8 @@ void ProfileAction::handle(HttpRequest* req) {
         ProfilerStart(tmp_prof_file_name.str().c_str());
         sleep(seconds);
         ProfilerStop();
+        // gperftools takes over SIGPROF, give it back to the query cpu profiler.
+        pipeline::PipelineCpuProfiler::instance()->restore_signal_handler();
 
         if (type_str != "text") {
             // return raw content via http response directly
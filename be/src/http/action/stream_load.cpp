@@ -29,13 +29,16 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <future>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "cloud/config.h"
 #include "common/config.h"
@@ -82,6 +85,10 @@ bvar::LatencyRecorder g_stream_load_commit_and_publish_latency_ms("stream_load",
 
 static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
 static const std::string CHUNK = "chunked";
+// The body segments smaller than this are still copied, handing each of them to the pipe would
+// cost more than the copy.
+static constexpr size_t MIN_ZERO_COPY_SEGMENT_SIZE = 32 * 1024;
+static constexpr size_t BODY_BUFFER_SIZE = 128 * 1024;
 
 #ifdef BE_TEST
 TStreamLoadPutResult k_stream_load_put_result;
@@ -346,6 +353,56 @@ Status StreamLoadAction::_on_header(HttpRequest* http_req, std::shared_ptr<Strea
     return _process_put(http_req, ctx);
 }
 
+// Move the received body out of `evbuf`, which moves the libevent chains without copying them,
+// and hand the large segments to the body sink as buffers sharing the ownership of the chains.
+static Status append_body_zero_copy(StreamLoadContext* ctx, struct evbuffer* evbuf) {
+    const size_t length = evbuffer_get_length(evbuf);
+    std::shared_ptr<struct evbuffer> body(evbuffer_new(), evbuffer_free);
+    if (body == nullptr) {
+        return Status::MemoryAllocFailed("failed to allocate evbuffer, {}", ctx->brief());
+    }
+    if (evbuffer_remove_buffer(evbuf, body.get(), length) != static_cast<int>(length)) {
+        return Status::InternalError("failed to read body content, {}", ctx->brief());
+    }
+    const int n = evbuffer_peek(body.get(), -1, nullptr, nullptr, 0);
+    std::vector<struct evbuffer_iovec> segments(n);
+    evbuffer_peek(body.get(), -1, nullptr, segments.data(), n);
+
+    // The small segments are copied into `copied`, keeping the order of the body.
+    ByteBufferPtr copied;
+    auto flush_copied = [&]() -> Status {
+        if (copied == nullptr) {
+            return Status::OK();
+        }
+        copied->flip();
+        auto buf = std::move(copied);
+        return ctx->body_sink->append(buf);
+    };
+    for (const auto& segment : segments) {
+        auto* data = static_cast<char*>(segment.iov_base);
+        if (segment.iov_len >= MIN_ZERO_COPY_SEGMENT_SIZE) {
+            RETURN_IF_ERROR(flush_copied());
+            RETURN_IF_ERROR(ctx->body_sink->append(ByteBuffer::wrap(data, segment.iov_len, body)));
+            continue;
+        }
+        size_t pos = 0;
+        while (pos < segment.iov_len) {
+            if (copied == nullptr) {
+                RETURN_IF_ERROR(ByteBuffer::allocate(BODY_BUFFER_SIZE, &copied));
+            }
+            const size_t size = std::min(segment.iov_len - pos, copied->capacity - copied->pos);
+            copied->put_bytes(data + pos, size);
+            pos += size;
+            if (copied->pos == copied->capacity) {
+                RETURN_IF_ERROR(flush_copied());
+            }
+        }
+    }
+    RETURN_IF_ERROR(flush_copied());
+    ctx->receive_bytes += length;
+    return Status::OK();
+}
+
 void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     std::shared_ptr<StreamLoadContext> ctx =
             std::static_pointer_cast<StreamLoadContext>(req->handler_ctx());
@@ -359,9 +416,17 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
 
     int64_t start_read_data_time = MonotonicNanos();
+    if (config::enable_stream_load_zero_copy_body && evbuffer_get_length(evbuf) > 0) {
+        Status st = append_body_zero_copy(ctx.get(), evbuf);
+        if (!st.ok()) {
+            LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
+            ctx->status = st;
+            return;
+        }
+    }
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
+        Status st = ByteBuffer::allocate(BODY_BUFFER_SIZE, &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "http/action/workload_io_ledger_action.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/exec_env.h"
+#include "runtime/runtime_query_statistics_mgr.h"
+#include "runtime/workload_management/io_ledger.h"
+#include "util/easy_json.h"
+
+namespace doris {
+
+void WorkloadIOLedgerAction::handle(HttpRequest* req) {
+    std::map<int64_t, IOLedger::Snapshot> ledgers;
+    ExecEnv::GetInstance()->runtime_query_statistics_mgr()->get_workload_io_ledgers(&ledgers);
+
+    EasyJson response;
+    response["msg"] = "OK";
+    response["code"] = 0;
+    response["enabled"] = IOLedger::enabled();
+    EasyJson data = response.Set("data", EasyJson::kArray);
+    for (const auto& [wg_id, snapshot] : ledgers) {
+        EasyJson wg = data.PushBack(EasyJson::kObject);
+        wg["workload_group_id"] = wg_id;
+        EasyJson tiers = wg.Set("tiers", EasyJson::kObject);
+        for (size_t i = 0; i < IO_TIER_NUM; ++i) {
+            const auto& t = snapshot.tiers[i];
+            EasyJson tier = tiers.Set(io_tier_name(static_cast<IOTier>(i)), EasyJson::kObject);
+            tier["bytes"] = t.bytes;
+            tier["requests"] = t.requests;
+            tier["latency_ns"] = t.latency_ns;
+            tier["p50_ns"] = t.latency_percentile_ns(50);
+            tier["p90_ns"] = t.latency_percentile_ns(90);
+            tier["p99_ns"] = t.latency_percentile_ns(99);
+        }
+        EasyJson files = wg.Set("top_files", EasyJson::kArray);
+        for (const auto& [path, bytes] : snapshot.top_files) {
+            EasyJson file = files.PushBack(EasyJson::kObject);
+            file["path"] = path.empty() ? "(others)" : path;
+            file["bytes"] = bytes;
+        }
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK, response.ToString());
+}
+
+} // namespace doris
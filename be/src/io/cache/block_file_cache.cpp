@@ -191,6 +191,8 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                                                              "file_cache_num_read_blocks");
     _num_hit_blocks = std::make_shared<bvar::Adder<size_t>>(_cache_base_path.c_str(),
                                                             "file_cache_num_hit_blocks");
+    _num_admitted_blocks = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_num_admitted_blocks");
     _num_removed_blocks = std::make_shared<bvar::Adder<size_t>>(_cache_base_path.c_str(),
                                                                 "file_cache_num_removed_blocks");
 
@@ -367,7 +369,9 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
 
     auto& queue = get_queue(cell.file_block->cache_type());
     /// Move to the end of the queue. The iterator remains valid.
-    if (cell.queue_iterator && move_iter_flag) {
+    /// A block moved a moment ago is still close to the end, skip it to keep the lock short.
+    if (cell.queue_iterator && move_iter_flag &&
+        !cell.used_within(config::file_cache_lru_move_min_interval_s)) {
         queue.move_to_end(*cell.queue_iterator, cache_lock);
         _lru_recorder->record_queue_event(cell.file_block->cache_type(),
                                           CacheLRULogType::MOVETOBACK, cell.file_block->_key.hash,
@@ -619,6 +623,33 @@ std::string BlockFileCache::clear_file_cache_async() {
     return msg;
 }
 
+bool BlockFileCache::admit_to_normal_queue(const UInt128Wrapper& hash, size_t offset,
+                                           std::lock_guard<std::mutex>& /* cache_lock */) {
+    const int64_t ghost_num = config::file_cache_normal_admission_ghost_num;
+    if (ghost_num <= 0) {
+        if (!_admission_ghost_list.empty()) {
+            _admission_ghost_list.clear();
+            _admission_ghost_map.clear();
+        }
+        return true;
+    }
+    AdmissionGhostKey key {hash, offset};
+    if (auto it = _admission_ghost_map.find(key); it != _admission_ghost_map.end()) {
+        // filled again before the ghost list forgot it, the block is reused
+        _admission_ghost_list.erase(it->second);
+        _admission_ghost_map.erase(it);
+        *_num_admitted_blocks << 1;
+        return true;
+    }
+    _admission_ghost_map.emplace(key,
+                                 _admission_ghost_list.insert(_admission_ghost_list.end(), key));
+    while (_admission_ghost_list.size() > static_cast<size_t>(ghost_num)) {
+        _admission_ghost_map.erase(_admission_ghost_list.front());
+        _admission_ghost_list.pop_front();
+    }
+    return false;
+}
+
 FileBlocks BlockFileCache::split_range_into_cells(const UInt128Wrapper& hash,
                                                   const CacheContext& context, size_t offset,
                                                   size_t size, FileBlock::State state,
@@ -635,20 +666,29 @@ FileBlocks BlockFileCache::split_range_into_cells(const UInt128Wrapper& hash,
     while (current_pos < end_pos_non_included) {
         current_size = std::min(remaining_size, _max_file_block_size);
         remaining_size -= current_size;
-        state = try_reserve(hash, context, current_pos, current_size, cache_lock)
+        const CacheContext* block_context = &context;
+        CacheContext disposable_context;
+        if (context.cache_type == FileCacheType::NORMAL &&
+            !admit_to_normal_queue(hash, current_pos, cache_lock)) {
+            disposable_context = context;
+            disposable_context.cache_type = FileCacheType::DISPOSABLE;
+            block_context = &disposable_context;
+        }
+        state = try_reserve(hash, *block_context, current_pos, current_size, cache_lock)
                         ? state
                         : FileBlock::State::SKIP_CACHE;
         if (state == FileBlock::State::SKIP_CACHE) [[unlikely]] {
             FileCacheKey key;
             key.hash = hash;
             key.offset = current_pos;
-            key.meta.type = context.cache_type;
+            key.meta.type = block_context->cache_type;
             key.meta.expiration_time = context.expiration_time;
             auto file_block = std::make_shared<FileBlock>(key, current_size, this,
                                                           FileBlock::State::SKIP_CACHE);
             file_blocks.push_back(std::move(file_block));
         } else {
-            auto* cell = add_cell(hash, context, current_pos, current_size, state, cache_lock);
+            auto* cell = add_cell(hash, *block_context, current_pos, current_size, state,
+                                  cache_lock);
             if (cell) {
                 file_blocks.push_back(cell->file_block);
                 if (!context.is_cold_data) {
@@ -2205,6 +2245,19 @@ std::string BlockFileCache::clear_file_cache_directly() {
     return msg;
 }
 
+size_t BlockFileCache::get_cached_size_by_key(const UInt128Wrapper& hash) {
+    size_t cached_size = 0;
+    SCOPED_CACHE_LOCK(_mutex, this);
+    if (auto it = _files.find(hash); it != _files.end()) {
+        for (auto& [_, cell] : it->second) {
+            if (cell.file_block->state() == FileBlock::State::DOWNLOADED) {
+                cached_size += cell.file_block->range().size();
+            }
+        }
+    }
+    return cached_size;
+}
+
 std::map<size_t, FileBlockSPtr> BlockFileCache::get_blocks_by_key(const UInt128Wrapper& hash) {
     std::map<size_t, FileBlockSPtr> offset_to_block;
     SCOPED_CACHE_LOCK(_mutex, this);
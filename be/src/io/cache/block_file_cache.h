@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <boost/lockfree/spsc_queue.hpp>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -32,6 +33,7 @@
 #include "io/cache/file_cache_common.h"
 #include "io/cache/file_cache_storage.h"
 #include "io/cache/lru_queue_recorder.h"
+#include "util/hot_path_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
 
@@ -72,7 +74,9 @@ private:
     }                                                                                             \
     LockScopedTimer cache_lock_timer;
 #else
-#define SCOPED_CACHE_LOCK(MUTEX, cache) std::lock_guard cache_lock(MUTEX);
+#define SCOPED_CACHE_LOCK(MUTEX, cache)                     \
+    hot_path_metrics::lock(MUTEX, HotLock::FILE_CACHE); \
+    std::lock_guard cache_lock(MUTEX, std::adopt_lock);
 #endif
 
 class FSFileCacheStorage;
@@ -161,6 +165,8 @@ public:
     std::string reset_capacity(size_t new_capacity);
 
     std::map<size_t, FileBlockSPtr> get_blocks_by_key(const UInt128Wrapper& hash);
+    // bytes of the downloaded blocks of the key, does not touch the lru queues
+    [[nodiscard]] size_t get_cached_size_by_key(const UInt128Wrapper& hash);
     /// For debug and UT
     std::string dump_structure(const UInt128Wrapper& hash);
     std::string dump_single_cache_type(const UInt128Wrapper& hash, size_t offset);
@@ -301,6 +307,15 @@ private:
                             std::chrono::steady_clock::now().time_since_epoch())
                             .count();
         }
+        bool used_within(int64_t seconds) const {
+            if (seconds <= 0 || atime == 0) {
+                return false;
+            }
+            auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count();
+            return now - atime < seconds;
+        }
 
         /// Pointer to file block is always hold by the cache itself.
         /// Apart from pointer in cache, it can be hold by cache users, when they call
@@ -358,6 +373,10 @@ private:
 
     size_t get_available_cache_size(FileCacheType cache_type) const;
 
+    // whether a normal block filled now goes to the normal queue or the disposable queue
+    bool admit_to_normal_queue(const UInt128Wrapper& hash, size_t offset,
+                               std::lock_guard<std::mutex>& cache_lock);
+
     FileBlocks split_range_into_cells(const UInt128Wrapper& hash, const CacheContext& context,
                                       size_t offset, size_t size, FileBlock::State state,
                                       std::lock_guard<std::mutex>& cache_lock);
@@ -474,6 +493,12 @@ private:
     LRUQueue _normal_queue;
     LRUQueue _disposable_queue;
     LRUQueue _ttl_queue;
+    // keys of the normal blocks filled once and not admitted yet, oldest first
+    using AdmissionGhostKey = std::pair<UInt128Wrapper, size_t>;
+    std::list<AdmissionGhostKey> _admission_ghost_list;
+    std::unordered_map<AdmissionGhostKey, std::list<AdmissionGhostKey>::iterator,
+                       LRUQueue::HashFileKeyAndOffset>
+            _admission_ghost_map;
 
     // keys for async remove
     RecycleFileCacheKeys _recycle_keys;
@@ -509,6 +534,7 @@ private:
 
     std::shared_ptr<bvar::Adder<size_t>> _num_read_blocks;
     std::shared_ptr<bvar::Adder<size_t>> _num_hit_blocks;
+    std::shared_ptr<bvar::Adder<size_t>> _num_admitted_blocks;
     std::shared_ptr<bvar::Adder<size_t>> _num_removed_blocks;
 
     std::shared_ptr<bvar::Status<double>> _hit_ratio;
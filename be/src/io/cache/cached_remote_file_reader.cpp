@@ -36,9 +36,13 @@
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
+#include "runtime/exec_env.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "util/bit_util.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 
 namespace doris::io {
 
@@ -47,6 +51,10 @@ bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
 bvar::Adder<uint64_t> g_skip_local_cache_io_sum_bytes(
         "cached_remote_reader_skip_local_cache_io_sum_bytes");
+bvar::Adder<uint64_t> g_read_ahead_bytes("cached_remote_reader_read_ahead_bytes");
+
+// reads in a row which make the access pattern count as sequential
+static constexpr int SEQUENTIAL_READS_TO_READ_AHEAD = 2;
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
@@ -126,8 +134,16 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         *bytes_read = 0;
         return Status::OK();
     }
+    _maybe_read_ahead(offset, bytes_req, io_ctx);
     ReadStatistics stats;
+    auto* io_ledger = current_io_ledger();
+    const int64_t start_ns = io_ledger != nullptr ? MonotonicNanos() : 0;
     auto defer_func = [&](int*) {
+        // A miss is recorded as `REMOTE` by the remote reader.
+        if (io_ledger != nullptr && stats.hit_cache && !is_dryrun) {
+            io_ledger->record(IOTier::FILE_CACHE, stats.bytes_read,
+                              MonotonicNanos() - start_ns, path().native());
+        }
         if (io_ctx->file_cache_stats && !is_dryrun) {
             // update stats in io_ctx, for query profile
             _update_stats(stats, io_ctx->file_cache_stats, io_ctx->is_inverted_index);
@@ -210,6 +226,16 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             stats.hit_cache = false;
             break;
         case FileBlock::State::DOWNLOADED:
+            // a block kept out of the normal queue by admission is promoted once it is reused
+            if (!is_dryrun && cache_context.cache_type == FileCacheType::NORMAL &&
+                block->cache_type() == FileCacheType::DISPOSABLE &&
+                config::file_cache_normal_admission_ghost_num > 0) {
+                auto st = block->change_cache_type_between_normal_and_index(
+                        FileCacheType::NORMAL);
+                if (!st.ok()) {
+                    LOG_WARNING("failed to promote file cache block").error(st);
+                }
+            }
             break;
         }
     }
@@ -329,6 +355,69 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
     return Status::OK();
 }
 
+void CachedRemoteFileReader::_maybe_read_ahead(size_t offset, size_t bytes_req,
+                                               const IOContext* io_ctx) {
+    const int64_t read_ahead_blocks = config::file_cache_sequential_read_ahead_blocks;
+    if (read_ahead_blocks <= 0 || io_ctx->is_dryrun) {
+        return;
+    }
+    const auto block_size = static_cast<size_t>(config::file_cache_each_block_size);
+    const size_t last_read_end = _last_read_end.exchange(offset + bytes_req);
+    // small gaps like skipped pages of other columns still count as a sequential scan
+    if (offset < last_read_end || offset - last_read_end > block_size) {
+        _sequential_reads = 0;
+        return;
+    }
+    if (++_sequential_reads < SEQUENTIAL_READS_TO_READ_AHEAD) {
+        return;
+    }
+    auto [align_left, align_size] = s_align_size(offset, bytes_req, size());
+    const size_t cur_end = align_left + align_size;
+    const size_t window = read_ahead_blocks * block_size;
+    const size_t ahead_end = _read_ahead_end;
+    // refill once less than half of the window is left, so the remote reads stay large
+    if (ahead_end > cur_end && (ahead_end - cur_end) * 2 > window) {
+        return;
+    }
+    const size_t start = std::max(cur_end, ahead_end);
+    const size_t end = std::min(size(), cur_end + window);
+    if (start >= end) {
+        return;
+    }
+    auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    auto self = weak_from_this().lock();
+    if (pool == nullptr || self == nullptr) {
+        return;
+    }
+    _read_ahead_end = end;
+    IOContext read_ahead_ctx;
+    read_ahead_ctx.reader_type = io_ctx->reader_type;
+    read_ahead_ctx.is_disposable = io_ctx->is_disposable;
+    read_ahead_ctx.is_index_data = io_ctx->is_index_data;
+    read_ahead_ctx.expiration_time = io_ctx->expiration_time;
+    read_ahead_ctx.is_dryrun = true;
+    auto st = pool->submit_func([self = std::move(self), start, end, read_ahead_ctx]() {
+        self->_read_ahead(start, end - start, read_ahead_ctx);
+    });
+    if (!st.ok()) {
+        VLOG_DEBUG << "failed to submit read ahead, path=" << path().native() << ", st=" << st;
+    }
+}
+
+void CachedRemoteFileReader::_read_ahead(size_t offset, size_t size, const IOContext& io_ctx) {
+    // a dryrun read only fills the file cache, the buffer is for the reads which fall back
+    // to the remote reader when a block is downloaded by someone else
+    std::unique_ptr<char[]> buffer(new char[size]);
+    size_t bytes_read = 0;
+    auto st = read_at(offset, Slice(buffer.get(), size), &bytes_read, &io_ctx);
+    if (!st.ok()) {
+        VLOG_DEBUG << "failed to read ahead, path=" << path().native() << ", offset=" << offset
+                   << ", size=" << size << ", st=" << st;
+        return;
+    }
+    g_read_ahead_bytes << bytes_read;
+}
+
 void CachedRemoteFileReader::_update_stats(const ReadStatistics& read_stats,
                                            FileCacheStatistics* statis,
                                            bool is_inverted_index) const {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -36,7 +37,8 @@ namespace doris::io {
 struct IOContext;
 struct FileCacheStatistics;
 
-class CachedRemoteFileReader final : public FileReader {
+class CachedRemoteFileReader final : public FileReader,
+                                     public std::enable_shared_from_this<CachedRemoteFileReader> {
 public:
     CachedRemoteFileReader(FileReaderSPtr remote_file_reader, const FileReaderOptions& opts);
 
@@ -60,6 +62,9 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+    // track whether the reads are sequential, and if so fill the file cache ahead of them
+    void _maybe_read_ahead(size_t offset, size_t bytes_req, const IOContext* io_ctx);
+    void _read_ahead(size_t offset, size_t size, const IOContext& io_ctx);
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
@@ -67,6 +72,12 @@ private:
     std::shared_mutex _mtx;
     std::map<size_t, FileBlockSPtr> _cache_file_readers;
 
+    // sequential read detection, the state is only a hint so races between readers are fine
+    std::atomic<size_t> _last_read_end {0};
+    std::atomic<int> _sequential_reads {0};
+    // end of the range read ahead so far
+    std::atomic<size_t> _read_ahead_end {0};
+
     void _update_stats(const ReadStatistics& stats, FileCacheStatistics* state,
                        bool is_inverted_index) const;
 };
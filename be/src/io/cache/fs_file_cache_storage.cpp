@@ -17,10 +17,15 @@
 
 #include "io/cache/fs_file_cache_storage.h"
 
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <cstring>
 #include <filesystem>
 #include <mutex>
+#include <string_view>
 #include <system_error>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -33,10 +38,66 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/block_compression.h"
+#include "util/faststring.h"
 #include "vec/common/hex.h"
 
 namespace doris::io {
 
+namespace {
+
+// A compressed block file is named after its plain block file plus this suffix. It starts with
+// the header below and is followed by the compressed block.
+constexpr std::string_view COMPRESSED_BLOCK_SUFFIX = "_z";
+
+struct CompressedBlockHeader {
+    uint32_t compression_type; // segment_v2::CompressionTypePB
+    uint32_t uncompressed_size;
+};
+
+segment_v2::CompressionTypePB block_compression_of(FileCacheType type) {
+    const std::string& compression = type == FileCacheType::INDEX
+                                             ? config::file_cache_index_block_compression
+                                             : config::file_cache_normal_block_compression;
+    if (compression == "lz4") {
+        return segment_v2::CompressionTypePB::LZ4;
+    } else if (compression == "zstd") {
+        return segment_v2::CompressionTypePB::ZSTD;
+    }
+    return segment_v2::CompressionTypePB::NO_COMPRESSION;
+}
+
+Status read_compressed_block(const FileReaderSPtr& file_reader, size_t value_offset,
+                             Slice buffer) {
+    const size_t file_size = file_reader->size();
+    if (file_size < sizeof(CompressedBlockHeader)) {
+        return Status::InternalError("invalid compressed cache block, file={}, size={}",
+                                     file_reader->path().native(), file_size);
+    }
+    std::unique_ptr<char[]> data(new char[file_size]);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(data.get(), file_size), &bytes_read));
+    CompressedBlockHeader header;
+    memcpy(&header, data.get(), sizeof(header));
+    if (value_offset + buffer.get_size() > header.uncompressed_size) {
+        return Status::InternalError(
+                "read out of compressed cache block, file={}, offset={}, size={}, block_size={}",
+                file_reader->path().native(), value_offset, buffer.get_size(),
+                header.uncompressed_size);
+    }
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(
+            static_cast<segment_v2::CompressionTypePB>(header.compression_type), &codec));
+    std::unique_ptr<char[]> block(new char[header.uncompressed_size]);
+    Slice output(block.get(), header.uncompressed_size);
+    RETURN_IF_ERROR(codec->decompress(
+            Slice(data.get() + sizeof(header), file_size - sizeof(header)), &output));
+    memcpy(buffer.data, block.get() + value_offset, buffer.get_size());
+    return Status::OK();
+}
+
+} // namespace
+
 struct BatchLoadArgs {
     UInt128Wrapper hash;
     CacheContext ctx;
@@ -174,9 +235,63 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
     }
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string true_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
+    if (block_compression_of(key.meta.type) != segment_v2::CompressionTypePB::NO_COMPRESSION) {
+        bool compressed = false;
+        RETURN_IF_ERROR(compress_block_file(file_writer->path(), key.meta.type, &compressed));
+        if (compressed) {
+            _has_compressed_blocks = true;
+            true_file += COMPRESSED_BLOCK_SUFFIX;
+        }
+    }
     return fs->rename(file_writer->path(), true_file);
 }
 
+Status FSFileCacheStorage::compress_block_file(const std::string& file, FileCacheType type,
+                                               bool* compressed) const {
+    *compressed = false;
+    FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(fs->open_file(file, &file_reader));
+    const size_t size = file_reader->size();
+    std::unique_ptr<char[]> data(new char[size]);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(data.get(), size), &bytes_read));
+    RETURN_IF_ERROR(file_reader->close());
+
+    const auto compression_type = block_compression_of(type);
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(compression_type, &codec));
+    faststring compressed_data;
+    RETURN_IF_ERROR(codec->compress(Slice(data.get(), size), &compressed_data));
+    if (sizeof(CompressedBlockHeader) + compressed_data.size() > size - size / 8) {
+        return Status::OK();
+    }
+
+    CompressedBlockHeader header {.compression_type = static_cast<uint32_t>(compression_type),
+                                  .uncompressed_size = static_cast<uint32_t>(size)};
+    FileWriterPtr file_writer;
+    FileWriterOptions opts {.sync_file_data = false};
+    RETURN_IF_ERROR(fs->create_file(file, &file_writer, &opts));
+    RETURN_IF_ERROR(file_writer->append(Slice(reinterpret_cast<char*>(&header), sizeof(header))));
+    RETURN_IF_ERROR(file_writer->append(Slice(compressed_data.data(), compressed_data.size())));
+    RETURN_IF_ERROR(file_writer->close());
+    *compressed = true;
+    return Status::OK();
+}
+
+Status FSFileCacheStorage::read_compressed_block_size(const Path& file, size_t* size) const {
+    FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(fs->open_file(file, &file_reader));
+    CompressedBlockHeader header;
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(
+            0, Slice(reinterpret_cast<char*>(&header), sizeof(header)), &bytes_read));
+    if (bytes_read != sizeof(header)) {
+        return Status::InternalError("invalid compressed cache block, file={}", file.native());
+    }
+    *size = header.uncompressed_size;
+    return file_reader->close();
+}
+
 Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
     AccessKeyAndOffset fd_key = std::make_pair(key.hash, key.offset);
     FileReaderSPtr file_reader = FDCache::instance()->get_file_reader(fd_key);
@@ -208,6 +323,9 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
 
         FDCache::instance()->insert_file_reader(fd_key, file_reader);
     }
+    if (file_reader->path().native().ends_with(COMPRESSED_BLOCK_SUFFIX)) [[unlikely]] {
+        return read_compressed_block(file_reader, value_offset, buffer);
+    }
     size_t bytes_read = 0;
     auto s = file_reader->read_at(value_offset, buffer, &bytes_read);
     if (!s.ok()) {
@@ -224,6 +342,9 @@ Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
     FDCache::instance()->remove_file_reader(std::make_pair(key.hash, key.offset));
     RETURN_IF_ERROR(fs->delete_file(file));
+    if (_has_compressed_blocks) {
+        RETURN_IF_ERROR(fs->delete_file(file + std::string(COMPRESSED_BLOCK_SUFFIX)));
+    }
     // return OK not means the file is deleted, it may be not exist
     // So for TTL, we make sure the old format will be removed well
     if (key.meta.type == FileCacheType::TTL) {
@@ -261,7 +382,12 @@ Status FSFileCacheStorage::change_key_meta_type(const FileCacheKey& key, const F
         std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
         std::string original_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
         std::string new_file = get_path_in_local_cache(dir, key.offset, type);
-        RETURN_IF_ERROR(fs->rename(original_file, new_file));
+        auto st = fs->rename(original_file, new_file);
+        if (st.is<ErrorCode::NOT_FOUND>() && _has_compressed_blocks) {
+            st = fs->rename(original_file + std::string(COMPRESSED_BLOCK_SUFFIX),
+                            new_file + std::string(COMPRESSED_BLOCK_SUFFIX));
+        }
+        RETURN_IF_ERROR(st);
     }
     return Status::OK();
 }
@@ -308,6 +434,11 @@ std::vector<std::string> FSFileCacheStorage::get_path_in_local_cache_all_candida
     candidates.push_back(base + "_idx");
     candidates.push_back(base + "_ttl");
     candidates.push_back(base + "_disposable");
+    if (_has_compressed_blocks) {
+        for (size_t i = 0, num = candidates.size(); i < num; ++i) {
+            candidates.push_back(candidates[i] + std::string(COMPRESSED_BLOCK_SUFFIX));
+        }
+    }
     return candidates;
 }
 
@@ -589,9 +720,14 @@ std::string FSFileCacheStorage::get_version_path() const {
 
 Status FSFileCacheStorage::parse_filename_suffix_to_cache_type(
         const std::shared_ptr<LocalFileSystem>& fs, const Path& file_path, long expiration_time,
-        size_t size, size_t* offset, bool* is_tmp, FileCacheType* cache_type) const {
+        size_t size, size_t* offset, bool* is_tmp, bool* is_compressed,
+        FileCacheType* cache_type) const {
     std::error_code ec;
     std::string offset_with_suffix = file_path.native();
+    if (offset_with_suffix.ends_with(COMPRESSED_BLOCK_SUFFIX)) {
+        *is_compressed = true;
+        offset_with_suffix.resize(offset_with_suffix.size() - COMPRESSED_BLOCK_SUFFIX.size());
+    }
     auto delim_pos1 = offset_with_suffix.find('_');
     bool parsed = true;
 
@@ -706,12 +842,19 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
                 size_t size = offset_it->file_size(ec);
                 size_t offset = 0;
                 bool is_tmp = false;
+                bool is_compressed = false;
                 FileCacheType cache_type = FileCacheType::NORMAL;
                 if (!parse_filename_suffix_to_cache_type(fs, offset_it->path().filename().native(),
                                                          expiration_time, size, &offset, &is_tmp,
-                                                         &cache_type)) {
+                                                         &is_compressed, &cache_type)) {
                     continue;
                 }
+                if (is_compressed) {
+                    _has_compressed_blocks = true;
+                    if (!read_compressed_block_size(offset_it->path(), &size)) {
+                        continue;
+                    }
+                }
                 context.cache_type = cache_type;
                 BatchLoadArgs args;
                 args.ctx = context;
@@ -803,12 +946,19 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
         size_t size = check_it->file_size(ec);
         size_t offset = 0;
         bool is_tmp = false;
+        bool is_compressed = false;
         FileCacheType cache_type = FileCacheType::NORMAL;
         if (!parse_filename_suffix_to_cache_type(fs, check_it->path().filename().native(),
                                                  context_original.expiration_time, size, &offset,
-                                                 &is_tmp, &cache_type)) {
+                                                 &is_tmp, &is_compressed, &cache_type)) {
             continue;
         }
+        if (is_compressed) {
+            _has_compressed_blocks = true;
+            if (!read_compressed_block_size(check_it->path(), &size)) {
+                continue;
+            }
+        }
         if (!mgr->_files.contains(key.hash) || !mgr->_files[key.hash].contains(offset)) {
             // if the file is tmp, it means it is the old file and it should be removed
             if (is_tmp) {
@@ -19,6 +19,7 @@
 
 #include <bvar/bvar.h>
 
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
@@ -98,9 +99,16 @@ private:
 
     Status read_file_cache_version(std::string* buffer) const;
 
+    // compress the finished block file in place, keep it as is if that does not pay off
+    Status compress_block_file(const std::string& file, FileCacheType type,
+                               bool* compressed) const;
+
+    Status read_compressed_block_size(const Path& file, size_t* size) const;
+
     Status parse_filename_suffix_to_cache_type(const std::shared_ptr<LocalFileSystem>& fs,
                                                const Path& file_path, long expiration_time,
                                                size_t size, size_t* offset, bool* is_tmp,
+                                               bool* is_compressed,
                                                FileCacheType* cache_type) const;
 
     Status write_file_cache_version() const;
@@ -119,6 +127,8 @@ private:
     std::mutex _mtx;
     std::unordered_map<FileWriterMapKey, FileWriterPtr, FileWriterMapKeyHash> _key_to_writer;
     std::shared_ptr<bvar::LatencyRecorder> _iterator_dir_retry_cnt;
+    // whether compressed block files may exist, so that the plain code path never looks for them
+    mutable std::atomic<bool> _has_compressed_blocks {false};
 };
 
 } // namespace doris::io
@@ -855,16 +855,7 @@ Result<io::FileReaderSPtr> DelegateReader::create_file_reader(
                 }
 
                 if (access_mode == AccessMode::SEQUENTIAL) {
-                    bool is_thread_safe = false;
-                    if (typeid_cast<io::S3FileReader*>(reader.get())) {
-                        is_thread_safe = true;
-                    } else if (auto* cached_reader =
-                                       typeid_cast<io::CachedRemoteFileReader*>(reader.get());
-                               cached_reader &&
-                               typeid_cast<io::S3FileReader*>(cached_reader->get_remote_reader())) {
-                        is_thread_safe = true;
-                    }
-                    if (is_thread_safe) {
+                    if (is_thread_safe(reader.get())) {
                         // PrefetchBufferedReader needs thread-safe reader to prefetch data concurrently.
                         return std::make_shared<io::PrefetchBufferedReader>(
                                 profile, std::move(reader), file_range, io_ctx);
@@ -875,6 +866,153 @@ Result<io::FileReaderSPtr> DelegateReader::create_file_reader(
             });
 }
 
+bool DelegateReader::is_thread_safe(io::FileReader* reader) {
+    if (typeid_cast<io::S3FileReader*>(reader)) {
+        return true;
+    }
+    if (auto* cached_reader = typeid_cast<io::CachedRemoteFileReader*>(reader);
+        cached_reader && typeid_cast<io::S3FileReader*>(cached_reader->get_remote_reader())) {
+        return true;
+    }
+    return false;
+}
+
+RangesPrefetchReader::RangesPrefetchReader(RuntimeProfile* profile, io::FileReaderSPtr reader,
+                                           const std::vector<PrefetchRange>& ranges,
+                                           size_t merge_gap, size_t max_bytes)
+        : _profile(profile),
+          _reader(std::move(reader)),
+          _state(std::make_shared<PrefetchState>()) {
+    _size = _reader->size();
+    size_t total_bytes = 0;
+    for (const PrefetchRange& range : ranges) {
+        if (range.start_offset >= range.end_offset) {
+            continue;
+        }
+        auto& merged = _state->ranges;
+        if (!merged.empty() && range.start_offset >= merged.back().end_offset &&
+            range.start_offset - merged.back().end_offset <= merge_gap) {
+            size_t grown = range.end_offset - merged.back().end_offset;
+            if (total_bytes + grown > max_bytes) {
+                break;
+            }
+            merged.back().end_offset = range.end_offset;
+            total_bytes += grown;
+        } else {
+            if (total_bytes + range.end_offset - range.start_offset > max_bytes) {
+                break;
+            }
+            merged.emplace_back(range);
+            total_bytes += range.end_offset - range.start_offset;
+        }
+    }
+    _statistics_prefetch_bytes = total_bytes;
+    if (_profile != nullptr) {
+        const char* prefetch_profile = "RowGroupPrefetch";
+        ADD_TIMER_WITH_LEVEL(_profile, prefetch_profile, 1);
+        _prefetch_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "PrefetchBytes", TUnit::BYTES,
+                                                       prefetch_profile, 1);
+        _hit_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "PrefetchHitBytes", TUnit::BYTES,
+                                                  prefetch_profile, 1);
+        _wait_time =
+                ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PrefetchWaitTime", prefetch_profile, 1);
+    }
+}
+
+RangesPrefetchReader::~RangesPrefetchReader() {
+    _cancel_and_wait();
+}
+
+Status RangesPrefetchReader::prefetch(const IOContext* io_ctx) {
+    if (_submitted || _state->ranges.empty()) {
+        return Status::OK();
+    }
+    // allocate in the calling thread, so the memory is tracked by the query
+    for (const PrefetchRange& range : _state->ranges) {
+        _state->buffers.emplace_back(
+                std::make_unique_for_overwrite<char[]>(range.end_offset - range.start_offset));
+    }
+    _prefetched = _state->promise.get_future().share();
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+            [state = _state, reader = _reader, io_ctx]() {
+                Status st;
+                for (size_t i = 0; i < state->ranges.size() && st.ok(); ++i) {
+                    if (state->cancelled || (io_ctx != nullptr && io_ctx->should_stop)) {
+                        st = Status::Cancelled("row group prefetch is cancelled");
+                        break;
+                    }
+                    const PrefetchRange& range = state->ranges[i];
+                    size_t to_read = range.end_offset - range.start_offset;
+                    size_t bytes_read = 0;
+                    st = reader->read_at(range.start_offset,
+                                         Slice(state->buffers[i].get(), to_read), &bytes_read,
+                                         io_ctx);
+                    if (st.ok() && bytes_read != to_read) {
+                        st = Status::InternalError("prefetch read {} bytes, expect {} bytes",
+                                                   bytes_read, to_read);
+                    }
+                }
+                state->promise.set_value(st);
+            }));
+    _submitted = true;
+    return Status::OK();
+}
+
+void RangesPrefetchReader::_cancel_and_wait() {
+    if (_submitted) {
+        _state->cancelled = true;
+        _prefetched.wait();
+        _submitted = false;
+    }
+}
+
+Status RangesPrefetchReader::close() {
+    if (!_closed) {
+        _cancel_and_wait();
+        _closed = true;
+    }
+    return Status::OK();
+}
+
+Status RangesPrefetchReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                                          const IOContext* io_ctx) {
+    if (_submitted) {
+        const auto& ranges = _state->ranges;
+        auto it = std::upper_bound(
+                ranges.begin(), ranges.end(), offset,
+                [](size_t off, const PrefetchRange& range) { return off < range.end_offset; });
+        if (it != ranges.end() && it->start_offset <= offset &&
+            offset + result.size <= it->end_offset) {
+            Status st;
+            {
+                SCOPED_RAW_TIMER(&_statistics_wait_time);
+                st = _prefetched.get();
+            }
+            if (st.ok()) {
+                auto index = static_cast<size_t>(it - ranges.begin());
+                memcpy(result.data, _state->buffers[index].get() + (offset - it->start_offset),
+                       result.size);
+                *bytes_read = result.size;
+                _statistics_hit_bytes += result.size;
+                return Status::OK();
+            }
+            LOG_EVERY_N(WARNING, 100) << "failed to prefetch " << path().native() << ": " << st;
+        }
+    }
+    return _reader->read_at(offset, result, bytes_read, io_ctx);
+}
+
+void RangesPrefetchReader::_collect_profile_before_close() {
+    if (_profile != nullptr) {
+        COUNTER_UPDATE(_prefetch_bytes, _statistics_prefetch_bytes);
+        COUNTER_UPDATE(_hit_bytes, _statistics_hit_bytes);
+        COUNTER_UPDATE(_wait_time, _statistics_wait_time);
+        if (_reader != nullptr) {
+            _reader->collect_profile_before_close();
+        }
+    }
+}
+
 Status LinearProbeRangeFinder::get_range_for(int64_t desired_offset,
                                              io::PrefetchRange& result_range) {
     while (index < _ranges.size()) {
@@ -20,7 +20,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <condition_variable>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -394,6 +396,68 @@ private:
     Statistics _statistics;
 };
 
+/**
+ * A FileReader that reads the given ranges into memory in the prefetch thread pool, so that the IO
+ * of the next row group can overlap with the decoding of the current one. Adjacent ranges whose
+ * gap is at most `merge_gap` are read by one request, and at most `max_bytes` are prefetched.
+ * A read inside the prefetched ranges waits for the prefetching and is copied from memory, other
+ * reads go to the underlying reader directly. The underlying reader should be thread-safe.
+ */
+class RangesPrefetchReader final : public io::FileReader {
+public:
+    RangesPrefetchReader(RuntimeProfile* profile, io::FileReaderSPtr reader,
+                         const std::vector<PrefetchRange>& ranges, size_t merge_gap,
+                         size_t max_bytes);
+
+    ~RangesPrefetchReader() override;
+
+    // Submit the prefetching to the prefetch thread pool, io_ctx should outlive this reader.
+    Status prefetch(const IOContext* io_ctx);
+
+    Status close() override;
+
+    const io::Path& path() const override { return _reader->path(); }
+
+    size_t size() const override { return _size; }
+
+    bool closed() const override { return _closed; }
+
+    // for test only
+    const std::vector<PrefetchRange>& prefetch_ranges() const { return _state->ranges; }
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const IOContext* io_ctx) override;
+
+    void _collect_profile_before_close() override;
+
+private:
+    // Shared with the prefetching task, which may outlive the read of this reader.
+    struct PrefetchState {
+        std::vector<PrefetchRange> ranges;
+        std::vector<std::unique_ptr<char[]>> buffers;
+        std::atomic<bool> cancelled = false;
+        std::promise<Status> promise;
+    };
+
+    void _cancel_and_wait();
+
+    RuntimeProfile* _profile = nullptr;
+    io::FileReaderSPtr _reader;
+    std::shared_ptr<PrefetchState> _state;
+    std::shared_future<Status> _prefetched;
+    size_t _size;
+    bool _submitted = false;
+    bool _closed = false;
+
+    RuntimeProfile::Counter* _prefetch_bytes = nullptr;
+    RuntimeProfile::Counter* _hit_bytes = nullptr;
+    RuntimeProfile::Counter* _wait_time = nullptr;
+    int64_t _statistics_prefetch_bytes = 0;
+    int64_t _statistics_hit_bytes = 0;
+    int64_t _statistics_wait_time = 0;
+};
+
 /**
  * Create a file reader suitable for accessing scenarios:
  * 1. When file size < config::in_memory_file_size, create InMemoryFileReader file reader
@@ -409,6 +473,9 @@ public:
             const FileDescription& file_description, const io::FileReaderOptions& reader_options,
             AccessMode access_mode = SEQUENTIAL, const IOContext* io_ctx = nullptr,
             const PrefetchRange file_range = PrefetchRange(0, 0));
+
+    // Whether the reader can be read concurrently by the prefetch threads.
+    static bool is_thread_safe(io::FileReader* reader);
 };
 
 class PrefetchBufferedReader;
@@ -40,4 +40,11 @@ std::string FileMetaCache::get_key(io::FileReaderSPtr file_reader,
             _file_description.file_size == -1 ? file_reader->size() : _file_description.file_size);
 }
 
+std::string FileMetaCache::get_page_index_key(const std::string& file_key, int row_group_id) {
+    std::string page_index_key = file_key;
+    page_index_key.append("_pi_");
+    page_index_key.append(reinterpret_cast<const char*>(&row_group_id), sizeof(row_group_id));
+    return page_index_key;
+}
+
 } // namespace doris
@@ -17,18 +17,32 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/file_factory.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
 
+// The serialized column index and offset index of a parquet row group. They are kept in the
+// compact thrift encoding of the file and parsed on use, which is much smaller than the parsed
+// structures.
+struct ParquetPageIndexBuffer {
+    std::vector<uint8_t> column_index;
+    std::vector<uint8_t> offset_index;
+};
+
 // A file meta cache depends on a LRU cache.
 // Such as parsed parquet footer.
 // The capacity will limit the number of cache entries in cache.
+// The page indexes are kept in another cache whose capacity is in bytes.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    FileMetaCache(int64_t capacity, int64_t page_index_capacity = 0)
+            : _cache(capacity),
+              _page_index_cache(CachePolicy::CacheType::FILE_PAGE_INDEX_CACHE,
+                                page_index_capacity) {}
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
@@ -52,8 +66,25 @@ public:
 
     bool enabled() const { return _cache.enabled(); }
 
+    // The key of the page index of a row group, 'file_key' is the key got by get_key().
+    static std::string get_page_index_key(const std::string& file_key, int row_group_id);
+
+    bool lookup_page_index(const std::string& key, ObjLRUCache::CacheHandle* handle) {
+        return _page_index_cache.lookup({key}, handle);
+    }
+
+    void insert_page_index(const std::string& key, ParquetPageIndexBuffer* value,
+                           ObjLRUCache::CacheHandle* handle) {
+        size_t charge = sizeof(ParquetPageIndexBuffer) + value->column_index.size() +
+                        value->offset_index.size();
+        _page_index_cache.insert({key}, value, handle, charge);
+    }
+
+    bool page_index_enabled() const { return _page_index_cache.enabled(); }
+
 private:
     ObjLRUCache _cache;
+    ObjLRUCache _page_index_cache;
 };
 
 } // namespace doris
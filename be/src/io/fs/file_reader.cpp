@@ -38,6 +38,32 @@ Status FileReader::read_at(size_t offset, Slice result, size_t* bytes_read,
     return st;
 }
 
+Status FileReader::read_at_batch(const std::vector<FileReadRange>& ranges, size_t* bytes_read,
+                                 const IOContext* io_ctx) {
+    DCHECK(bthread_self() == 0);
+    Status st = read_at_batch_impl(ranges, bytes_read, io_ctx);
+    if (!st) {
+        LOG(WARNING) << st;
+    }
+    return st;
+}
+
+Status FileReader::read_at_batch_impl(const std::vector<FileReadRange>& ranges,
+                                      size_t* bytes_read, const IOContext* io_ctx) {
+    *bytes_read = 0;
+    for (const auto& range : ranges) {
+        size_t range_bytes_read = 0;
+        RETURN_IF_ERROR(read_at_impl(range.offset, range.result, &range_bytes_read, io_ctx));
+        if (range_bytes_read != range.result.size) {
+            return Status::InternalError("cannot read {} bytes at {} from {}, only read {}",
+                                         range.result.size, range.offset, path().native(),
+                                         range_bytes_read);
+        }
+        *bytes_read += range_bytes_read;
+    }
+    return Status::OK();
+}
+
 Result<FileReaderSPtr> create_cached_file_reader(FileReaderSPtr raw_reader,
                                                  const FileReaderOptions& opts) {
     switch (opts.cache_type) {
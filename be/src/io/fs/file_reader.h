@@ -21,6 +21,7 @@
 #include <stddef.h>
 
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "io/fs/path.h"
@@ -63,6 +64,11 @@ struct FileReaderOptions {
 
 inline const FileReaderOptions FileReaderOptions::DEFAULT;
 
+struct FileReadRange {
+    size_t offset;
+    Slice result;
+};
+
 class FileReader : public doris::ProfileCollector {
 public:
     FileReader() = default;
@@ -78,6 +84,10 @@ public:
     Status read_at(size_t offset, Slice result, size_t* bytes_read,
                    const IOContext* io_ctx = nullptr);
 
+    /// Read several ranges at once, each range is read fully. `bytes_read` is the total bytes read.
+    Status read_at_batch(const std::vector<FileReadRange>& ranges, size_t* bytes_read,
+                         const IOContext* io_ctx = nullptr);
+
     virtual Status close() = 0;
 
     virtual const Path& path() const = 0;
@@ -91,6 +101,10 @@ public:
 protected:
     virtual Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                 const IOContext* io_ctx) = 0;
+
+    // Read the ranges one by one by default.
+    virtual Status read_at_batch_impl(const std::vector<FileReadRange>& ranges,
+                                      size_t* bytes_read, const IOContext* io_ctx);
 };
 
 using FileReaderSPtr = std::shared_ptr<FileReader>;
@@ -32,6 +32,7 @@
 #include "io/fs/err_utils.h"
 #include "io/hdfs_util.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
@@ -117,6 +118,9 @@ Status HdfsFileReader::close() {
 
 Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                     const IOContext* io_ctx) {
+    *bytes_read = 0;
+    ScopedIOLedgerRecord io_ledger_record(current_io_ledger(), IOTier::REMOTE, _path.native(),
+                                          bytes_read);
     auto st = do_read_at_impl(offset, result, bytes_read, io_ctx);
     if (!st.ok()) {
         _accessor.destroy();
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/io_uring.h"
+
+#include <errno.h> // IWYU pragma: keep
+#include <glog/logging.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include "common/config.h"
+#include "io/fs/err_utils.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define DORIS_HAS_IO_URING 1
+#endif
+
+namespace doris::io {
+#include "common/compile_check_begin.h"
+
+#ifdef DORIS_HAS_IO_URING
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ptr != nullptr && _cq_ptr != _sq_ptr) {
+        munmap(_cq_ptr, _cq_ring_size);
+    }
+    if (_sq_ptr != nullptr) {
+        munmap(_sq_ptr, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+IoUring* IoUring::local() {
+    // Set once the kernel refuses to create a ring, e.g. io_uring is disabled by seccomp.
+    static std::atomic<bool> unsupported = false;
+    if (!config::enable_local_io_uring || unsupported.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    thread_local std::unique_ptr<IoUring> ring;
+    if (!ring) [[unlikely]] {
+        std::unique_ptr<IoUring> new_ring(new IoUring());
+        auto st = new_ring->_init(
+                static_cast<uint32_t>(std::max(config::local_io_uring_queue_depth, 1)));
+        if (!st.ok()) {
+            LOG(WARNING) << "io_uring is not available, fall back to pread: " << st;
+            unsupported.store(true, std::memory_order_relaxed);
+            return nullptr;
+        }
+        ring = std::move(new_ring);
+    }
+    return ring.get();
+}
+
+Status IoUring::_init(uint32_t entries) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        return localfs_error(errno, "io_uring_setup failed");
+    }
+    _ring_fd = fd;
+    _entries = params.sq_entries;
+    // IORING_OP_READ comes with the same kernel version as this feature.
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        return Status::NotSupported("io_uring of the kernel does not support IORING_OP_READ");
+    }
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+    void* ptr = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     fd, IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED) {
+        return localfs_error(errno, "failed to map the io_uring submission queue");
+    }
+    _sq_ptr = ptr;
+    if (single_mmap) {
+        _cq_ptr = _sq_ptr;
+    } else {
+        ptr = mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                   IORING_OFF_CQ_RING);
+        if (ptr == MAP_FAILED) {
+            return localfs_error(errno, "failed to map the io_uring completion queue");
+        }
+        _cq_ptr = ptr;
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ptr = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+               IORING_OFF_SQES);
+    if (ptr == MAP_FAILED) {
+        return localfs_error(errno, "failed to map the io_uring submission entries");
+    }
+    _sqes = ptr;
+
+    auto* sq = static_cast<char*>(_sq_ptr);
+    _sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    _sq_mask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ptr);
+    _cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    _cq_mask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+    return Status::OK();
+}
+
+Status IoUring::_enter(uint32_t to_submit, uint32_t wait_nr) {
+    while (true) {
+        auto ret = syscall(__NR_io_uring_enter, _ring_fd, to_submit, wait_nr,
+                           wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+        if (ret >= 0) {
+            if (static_cast<uint32_t>(ret) >= to_submit) {
+                return Status::OK();
+            }
+            // Not all the entries are consumed, submit the rest.
+            to_submit -= static_cast<uint32_t>(ret);
+            continue;
+        }
+        if (errno != EINTR && errno != EAGAIN) {
+            return localfs_error(errno, "io_uring_enter failed");
+        }
+    }
+}
+
+Status IoUring::read_batch(int fd, const std::vector<FileReadRange>& ranges, size_t* bytes_read) {
+    *bytes_read = 0;
+    auto* sqes = static_cast<io_uring_sqe*>(_sqes);
+    auto* cqes = static_cast<io_uring_cqe*>(_cqes);
+    Status status = Status::OK();
+    size_t next = 0;
+    while (next < ranges.size()) {
+        const auto batch_size =
+                static_cast<uint32_t>(std::min<size_t>(_entries, ranges.size() - next));
+        // Only the owner thread produces entries, the tail does not need an acquire load.
+        const uint32_t tail = *_sq_tail;
+        for (uint32_t i = 0; i < batch_size; ++i) {
+            const auto& range = ranges[next + i];
+            const uint32_t index = (tail + i) & _sq_mask;
+            DCHECK_LE(range.result.size, UINT32_MAX);
+            auto* sqe = &sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = fd;
+            sqe->addr = reinterpret_cast<uint64_t>(range.result.data);
+            sqe->len = static_cast<uint32_t>(range.result.size);
+            sqe->off = range.offset;
+            sqe->user_data = next + i;
+            _sq_array[index] = index;
+        }
+        __atomic_store_n(_sq_tail, tail + batch_size, __ATOMIC_RELEASE);
+        RETURN_IF_ERROR(_enter(batch_size, batch_size));
+
+        // All the completions of the batch are reaped even if some reads failed, so that the
+        // ring is empty for the next batch.
+        uint32_t completed = 0;
+        while (completed < batch_size) {
+            uint32_t head = *_cq_head;
+            const uint32_t cq_tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+            if (head == cq_tail) {
+                RETURN_IF_ERROR(_enter(0, batch_size - completed));
+                continue;
+            }
+            for (; head != cq_tail; ++head, ++completed) {
+                const auto& cqe = cqes[head & _cq_mask];
+                const auto& range = ranges[cqe.user_data];
+                if (cqe.res < 0) {
+                    if (status.ok()) {
+                        status = localfs_error(-cqe.res, "io_uring read failed");
+                    }
+                    continue;
+                }
+                auto res = static_cast<size_t>(cqe.res);
+                // Finish a short read with pread, it is rare for regular files.
+                while (res < range.result.size && status.ok()) {
+                    auto ret = ::pread(fd, range.result.data + res, range.result.size - res,
+                                       static_cast<off_t>(range.offset + res));
+                    if (ret > 0) {
+                        res += static_cast<size_t>(ret);
+                    } else if (ret == 0) {
+                        status = Status::InternalError("unexpected EOF at {}", range.offset + res);
+                    } else if (errno != EINTR) {
+                        status = localfs_error(errno, "failed to read");
+                    }
+                }
+                *bytes_read += res;
+            }
+            __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+        }
+        RETURN_IF_ERROR(status);
+        next += batch_size;
+    }
+    return Status::OK();
+}
+
+#else
+
+IoUring::~IoUring() = default;
+
+IoUring* IoUring::local() {
+    return nullptr;
+}
+
+Status IoUring::_init(uint32_t entries) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status IoUring::_enter(uint32_t to_submit, uint32_t wait_nr) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status IoUring::read_batch(int fd, const std::vector<FileReadRange>& ranges, size_t* bytes_read) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+#endif
+
+#include "common/compile_check_end.h"
+} // namespace doris::io
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/file_reader.h"
+
+namespace doris::io {
+
+// A per-thread io_uring used to submit the reads of one batch with a single syscall, the
+// thread waits for the whole batch instead of issuing one pread per range. It only uses the
+// raw syscalls, liburing is not required.
+class IoUring {
+public:
+    ~IoUring();
+
+    // The ring of the current thread, nullptr if io_uring is disabled by `enable_local_io_uring`
+    // or not supported by the kernel.
+    static IoUring* local();
+
+    // Read all the ranges of `fd`, the ranges must be inside the file. `bytes_read` is the total
+    // bytes read.
+    Status read_batch(int fd, const std::vector<FileReadRange>& ranges, size_t* bytes_read);
+
+private:
+    IoUring() = default;
+
+    Status _init(uint32_t entries);
+    // Submit the prepared entries and wait for `wait_nr` completions.
+    Status _enter(uint32_t to_submit, uint32_t wait_nr);
+
+    int _ring_fd = -1;
+    uint32_t _entries = 0;
+
+    void* _sq_ptr = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ptr = nullptr;
+    size_t _cq_ring_size = 0;
+    void* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t* _sq_tail = nullptr;
+    uint32_t _sq_mask = 0;
+    uint32_t* _sq_array = nullptr;
+    uint32_t* _cq_head = nullptr;
+    uint32_t* _cq_tail = nullptr;
+    uint32_t _cq_mask = 0;
+    void* _cqes = nullptr;
+};
+
+} // namespace doris::io
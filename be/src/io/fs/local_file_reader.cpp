@@ -34,10 +34,12 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/io_uring.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/options.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/async_io.h"
 #include "util/debug_points.h"
@@ -125,7 +127,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -143,6 +145,10 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     *bytes_read = 0;
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
+    // The file cache reads its blocks without an IO context, they are recorded as `FILE_CACHE`
+    // by the cached reader.
+    ScopedIOLedgerRecord io_ledger_record(io_ctx != nullptr ? current_io_ledger() : nullptr,
+                                          IOTier::LOCAL_DISK, _path.native(), bytes_read);
 
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
@@ -173,5 +179,35 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     return Status::OK();
 }
 
+Status LocalFileReader::read_at_batch_impl(const std::vector<FileReadRange>& ranges,
+                                           size_t* bytes_read, const IOContext* io_ctx) {
+    auto* ring = IoUring::local();
+    if (ring == nullptr || ranges.size() <= 1) {
+        return FileReader::read_at_batch_impl(ranges, bytes_read, io_ctx);
+    }
+    if (closed()) [[unlikely]] {
+        return Status::InternalError("read closed file: ", _path.native());
+    }
+    for (const auto& range : ranges) {
+        if (range.offset + range.result.size > _file_size) {
+            return Status::InternalError(
+                    "range exceeds file size(offset: {}, size: {}, file size: {}, path: {})",
+                    range.offset, range.result.size, _file_size, _path.native());
+        }
+    }
+    *bytes_read = 0;
+
+    LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
+    ScopedIOLedgerRecord io_ledger_record(io_ctx != nullptr ? current_io_ledger() : nullptr,
+                                          IOTier::LOCAL_DISK, _path.native(), bytes_read);
+
+    auto st = ring->read_batch(_fd, ranges, bytes_read);
+    if (!st.ok()) {
+        return st.prepend(fmt::format("failed to read {}: ", _path.native()));
+    }
+    DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
+    return Status::OK();
+}
+
 } // namespace io
 } // namespace doris
@@ -66,6 +66,10 @@ private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    // Submit all the ranges with one io_uring_enter if io_uring is enabled.
+    Status read_at_batch_impl(const std::vector<FileReadRange>& ranges, size_t* bytes_read,
+                              const IOContext* io_ctx) override;
+
 private:
     int _fd = -1; // owned
     Path _path;
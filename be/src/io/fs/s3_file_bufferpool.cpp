@@ -66,7 +66,7 @@ struct Memory : boost::noncopyable, Allocator {
 
 struct FileBuffer::PartData {
     Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
+    explicit PartData(size_t size) : _memory(size) {}
     ~PartData() = default;
     [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
     [[nodiscard]] size_t size() const { return _memory._size; }
@@ -77,13 +77,13 @@ Slice FileBuffer::get_slice() const {
 }
 
 FileBuffer::FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder,
-                       size_t offset, OperationState state)
+                       size_t offset, OperationState state, size_t capacity)
         : _type(type),
           _alloc_holder(std::move(alloc_holder)),
           _offset(offset),
           _size(0),
           _state(std::move(state)),
-          _inner_data(std::make_unique<FileBuffer::PartData>()),
+          _inner_data(std::make_unique<FileBuffer::PartData>(capacity)),
           _capacity(_inner_data->size()) {}
 
 FileBuffer::~FileBuffer() {
@@ -244,9 +244,10 @@ Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
     OperationState state(_sync_after_complete_task, _is_cancelled);
 
     if (_type == BufferType::UPLOAD) {
+        size_t capacity = _capacity > 0 ? _capacity : config::s3_write_buffer_size;
         RETURN_IF_CATCH_EXCEPTION(*buf = std::make_shared<UploadFileBuffer>(
                                           std::move(_upload_cb), std::move(state), _offset,
-                                          std::move(_alloc_holder_cb)));
+                                          std::move(_alloc_holder_cb), capacity));
         return Status::OK();
     }
     if (_type == BufferType::DOWNLOAD) {
@@ -25,6 +25,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/cache/file_block.h"
 #include "util/crc32c.h"
@@ -77,7 +78,7 @@ struct OperationState {
 
 struct FileBuffer {
     FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder, size_t offset,
-               OperationState state);
+               OperationState state, size_t capacity);
     virtual ~FileBuffer();
     /**
     * submit the correspoding task to async executor
@@ -134,7 +135,8 @@ struct DownloadFileBuffer final : public FileBuffer {
                        std::function<void(FileBlocksHolderPtr, Slice)> write_to_cache,
                        std::function<void(Slice, size_t)> write_to_use_buffer, OperationState state,
                        size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder)
-            : FileBuffer(BufferType::DOWNLOAD, alloc_holder, offset, state),
+            : FileBuffer(BufferType::DOWNLOAD, alloc_holder, offset, state,
+                         config::s3_write_buffer_size),
               _download(std::move(download)),
               _write_to_local_file_cache(std::move(write_to_cache)),
               _write_to_use_buffer(std::move(write_to_use_buffer)) {}
@@ -153,8 +155,9 @@ struct DownloadFileBuffer final : public FileBuffer {
 
 struct UploadFileBuffer final : public FileBuffer {
     UploadFileBuffer(std::function<void(UploadFileBuffer&)> upload_cb, OperationState state,
-                     size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder)
-            : FileBuffer(BufferType::UPLOAD, alloc_holder, offset, state),
+                     size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder,
+                     size_t capacity)
+            : FileBuffer(BufferType::UPLOAD, alloc_holder, offset, state, capacity),
               _upload_to_remote(std::move(upload_cb)) {}
     ~UploadFileBuffer() override = default;
     Status append_data(const Slice& s) override;
@@ -265,6 +268,15 @@ struct FileBufferBuilder {
         return *this;
     }
     /**
+    * set the size of the memory buffer of an upload file buffer, s3_write_buffer_size if unset
+    *
+    * @param capacity
+    */
+    FileBufferBuilder& set_capacity(size_t capacity) {
+        _capacity = capacity;
+        return *this;
+    }
+    /**
     * set the callback which write the content into local file cache
     *
     * @param cb 
@@ -293,6 +305,7 @@ struct FileBufferBuilder {
     std::function<Status(Slice&)> _download;
     std::function<void(Slice, size_t)> _write_to_use_buffer;
     size_t _offset;
+    size_t _capacity {0};
 };
 } // namespace io
 } // namespace doris
@@ -29,19 +29,27 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -57,6 +65,86 @@ bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3
 // record successfull request, and s3_get_request_qps will record all request.
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_get_request_qps("s3_file_reader", "s3_get_request",
                                                           &s3_file_reader_read_counter);
+// latency of the successful GETs, its p95 is the delay before a GET is hedged
+bvar::LatencyRecorder s3_get_latency_us("s3_file_reader", "get_latency_us");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_counter("s3_file_reader", "hedged_read");
+bvar::Adder<uint64_t> s3_file_reader_hedge_win_counter("s3_file_reader", "hedge_win");
+
+namespace {
+
+// The GETs which may be hedged and the hedged ones, both are halved once in a while so that the
+// hedge budget follows the recent traffic.
+std::atomic<int64_t> s_hedge_budget_gets {0};
+std::atomic<int64_t> s_hedge_budget_hedges {0};
+
+bool take_hedge_budget() {
+    int64_t gets = s_hedge_budget_gets.load(std::memory_order_relaxed);
+    if (gets > 100000) {
+        s_hedge_budget_gets = gets / 2;
+        s_hedge_budget_hedges = s_hedge_budget_hedges.load(std::memory_order_relaxed) / 2;
+        gets /= 2;
+    }
+    int64_t hedges = s_hedge_budget_hedges.load(std::memory_order_relaxed);
+    if ((hedges + 1) * 100 > gets * config::s3_read_hedge_max_percent) {
+        return false;
+    }
+    s_hedge_budget_hedges.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Shared by the GETs of one hedged read, the first GET returning the whole range wins.
+struct HedgedGetState {
+    std::mutex mtx;
+    std::condition_variable cv;
+    int running = 0;
+    bool finished = false;
+    bool hedge_won = false;
+    // of the winner, or of the last failed GET if none succeeded
+    ObjectStorageResponse resp;
+    std::unique_ptr<char[]> data;
+    size_t bytes_read = 0;
+};
+
+bool submit_hedged_get(const std::shared_ptr<HedgedGetState>& state,
+                       std::shared_ptr<ObjStorageClient> client, const std::string& bucket,
+                       const std::string& key, size_t offset, size_t bytes_req, bool is_hedge) {
+    {
+        std::lock_guard lock(state->mtx);
+        ++state->running;
+    }
+    auto st = ExecEnv::GetInstance()->s3_read_hedge_thread_pool()->submit_func([=]() {
+        std::unique_ptr<char[]> data(new char[bytes_req]);
+        size_t bytes_read = 0;
+        MonotonicStopWatch watch;
+        watch.start();
+        // clang-format off
+        auto resp = client->get_object({ .bucket = bucket, .key = key, },
+                data.get(), offset, bytes_req, &bytes_read);
+        // clang-format on
+        bool ok = resp.status.code == ErrorCode::OK && bytes_read == bytes_req;
+        if (ok) {
+            s3_get_latency_us << watch.elapsed_time() / 1000;
+        }
+        std::lock_guard lock(state->mtx);
+        --state->running;
+        if (!state->finished) {
+            state->finished = ok;
+            state->hedge_won = ok && is_hedge;
+            state->resp = std::move(resp);
+            state->data = std::move(data);
+            state->bytes_read = bytes_read;
+        }
+        state->cv.notify_all();
+    });
+    if (!st.ok()) {
+        std::lock_guard lock(state->mtx);
+        --state->running;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key, int64_t file_size,
@@ -123,6 +211,9 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     if (!client) {
         return Status::InternalError("init s3 client error");
     }
+    *bytes_read = 0;
+    ScopedIOLedgerRecord io_ledger_record(current_io_ledger(), IOTier::REMOTE, _path.native(),
+                                          bytes_read);
 
     int retry_count = 0;
     const int base_wait_time = config::s3_read_base_wait_time_ms; // Base wait time in milliseconds
@@ -143,10 +234,7 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     while (retry_count <= max_retries) {
         *bytes_read = 0;
         s3_file_reader_read_counter << 1;
-        // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
-        // clang-format on
+        auto resp = _get_object(client, to, offset, bytes_req, bytes_read);
         _s3_stats.total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
@@ -192,6 +280,67 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::InternalError(msg);
 }
 
+ObjectStorageResponse S3FileReader::_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                                               char* to, size_t offset, size_t bytes_req,
+                                               size_t* bytes_read) {
+    if (!config::enable_s3_read_hedge ||
+        bytes_req > static_cast<size_t>(config::s3_read_hedge_max_bytes) ||
+        ExecEnv::GetInstance()->s3_read_hedge_thread_pool() == nullptr) {
+        return _direct_get_object(client, to, offset, bytes_req, bytes_read);
+    }
+    return _hedged_get_object(client, to, offset, bytes_req, bytes_read);
+}
+
+ObjectStorageResponse S3FileReader::_direct_get_object(
+        const std::shared_ptr<ObjStorageClient>& client, char* to, size_t offset,
+        size_t bytes_req, size_t* bytes_read) {
+    MonotonicStopWatch watch;
+    watch.start();
+    // clang-format off
+    auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
+            to, offset, bytes_req, bytes_read);
+    // clang-format on
+    if (resp.status.code == ErrorCode::OK) {
+        s3_get_latency_us << watch.elapsed_time() / 1000;
+    }
+    return resp;
+}
+
+ObjectStorageResponse S3FileReader::_hedged_get_object(
+        const std::shared_ptr<ObjStorageClient>& client, char* to, size_t offset,
+        size_t bytes_req, size_t* bytes_read) {
+    s_hedge_budget_gets.fetch_add(1, std::memory_order_relaxed);
+    auto state = std::make_shared<HedgedGetState>();
+    if (!submit_hedged_get(state, client, _bucket, _key, offset, bytes_req, false)) {
+        return _direct_get_object(client, to, offset, bytes_req, bytes_read);
+    }
+    const auto delay = std::chrono::microseconds(
+            std::max<int64_t>(config::s3_read_hedge_min_delay_ms * 1000L,
+                              s3_get_latency_us.latency_percentile(0.95)));
+    std::unique_lock lock(state->mtx);
+    auto done = [&state]() { return state->finished || state->running == 0; };
+    // a GET slower than most recent ones is likely stuck on a slow server, ask again
+    if (!state->cv.wait_for(lock, delay, done) && take_hedge_budget()) {
+        lock.unlock();
+        if (submit_hedged_get(state, client, _bucket, _key, offset, bytes_req, true)) {
+            s3_file_reader_hedged_read_counter << 1;
+        }
+        lock.lock();
+    }
+    state->cv.wait(lock, done);
+    *bytes_read = state->bytes_read;
+    if (state->finished) {
+        memcpy(to, state->data.get(), state->bytes_read);
+        if (state->hedge_won) {
+            s3_file_reader_hedge_win_counter << 1;
+        }
+    } else if (state->data != nullptr) {
+        // a short read, the caller reports it
+        memcpy(to, state->data.get(), std::min(state->bytes_read, bytes_req));
+    }
+    return state->resp;
+}
+
 void S3FileReader::_collect_profile_before_close() {
     if (_profile != nullptr) {
         const char* s3_profile_name = "S3Profile";
@@ -24,6 +24,7 @@
 #include "common/status.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
+#include "io/fs/obj_storage_client.h"
 #include "io/fs/path.h"
 #include "io/fs/s3_file_system.h"
 #include "util/slice.h"
@@ -60,6 +61,16 @@ protected:
     void _collect_profile_before_close() override;
 
 private:
+    // get the range from the object storage, hedged if enabled
+    ObjectStorageResponse _get_object(const std::shared_ptr<ObjStorageClient>& client, char* to,
+                                      size_t offset, size_t bytes_req, size_t* bytes_read);
+    ObjectStorageResponse _direct_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                                             char* to, size_t offset, size_t bytes_req,
+                                             size_t* bytes_read);
+    ObjectStorageResponse _hedged_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                                             char* to, size_t offset, size_t bytes_req,
+                                             size_t* bytes_read);
+
     struct S3Statistics {
         int64_t total_get_request_counter = 0;
         int64_t too_many_request_err_counter = 0;
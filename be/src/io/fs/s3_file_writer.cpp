@@ -22,6 +22,7 @@
 #include <fmt/core.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <sstream>
 #include <tuple>
 #include <utility>
@@ -58,7 +59,11 @@ S3FileWriter::S3FileWriter(std::shared_ptr<ObjClientHolder> client, std::string
                                   .bucket = std::move(bucket),
                                   .key = std::move(key)}),
           _used_by_s3_committer(opts ? opts->used_by_s3_committer : false),
-          _obj_client(std::move(client)) {
+          _obj_client(std::move(client)),
+          _base_part_size(static_cast<size_t>(config::s3_write_buffer_size)),
+          _part_size_grow_parts(config::s3_write_buffer_grow_parts_num),
+          _max_part_size(std::max(static_cast<size_t>(config::s3_write_buffer_max_size),
+                                  _base_part_size)) {
     s3_file_writer_total << 1;
     s3_file_being_written << 1;
     Aws::Http::SetCompliantRfc3986Encoding(true);
@@ -171,13 +176,27 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
     return ret;
 }
 
+size_t S3FileWriter::_part_size(int part_num) const {
+    size_t part_size = _base_part_size;
+    if (_part_size_grow_parts <= 0) {
+        return part_size;
+    }
+    for (int parts = _part_size_grow_parts; part_num > parts && part_size * 2 <= _max_part_size;
+         parts += _part_size_grow_parts) {
+        part_size *= 2;
+    }
+    return part_size;
+}
+
 Status S3FileWriter::_build_upload_buffer() {
+    const size_t part_size = _part_size(_cur_part_num);
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
             .set_upload_callback([part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                 _upload_one_part(part_num, buf);
             })
             .set_file_offset(_bytes_appended)
+            .set_capacity(part_size)
             .set_sync_after_complete_task([this](auto&& PH1) {
                 return _complete_part_task_callback(std::forward<decltype(PH1)>(PH1));
             })
@@ -188,8 +207,9 @@ Status S3FileWriter::_build_upload_buffer() {
         // try to do writing into file cache, so we make the lambda capture the variable
         // we need by value to extend their lifetime
         builder.set_allocate_file_blocks_holder(
-                [builder = *_cache_builder, offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                    return builder.allocate_cache_holder(offset, config::s3_write_buffer_size);
+                [builder = *_cache_builder, offset = _bytes_appended,
+                 part_size]() -> FileBlocksHolderPtr {
+                    return builder.allocate_cache_holder(offset, part_size);
                 });
     }
     RETURN_IF_ERROR(builder.build(&_pending_buf));
@@ -235,7 +255,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -248,6 +267,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             }
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
+            const size_t buffer_size = _pending_buf->get_capacaticy();
             data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
                                                                     buffer_size - _bytes_appended);
 
@@ -382,13 +402,16 @@ Status S3FileWriter::_complete() {
     }
 
     // check number of parts
-    int64_t expected_num_parts1 = (_bytes_appended / config::s3_write_buffer_size) +
-                                  !!(_bytes_appended % config::s3_write_buffer_size);
+    int64_t expected_num_parts1 = 0;
+    size_t parts_size = 0;
+    while (parts_size < _bytes_appended) {
+        parts_size += _part_size(cast_set<int>(++expected_num_parts1));
+    }
     int64_t expected_num_parts2 =
-            (_bytes_appended % config::s3_write_buffer_size) ? _cur_part_num : _cur_part_num - 1;
+            parts_size != _bytes_appended ? _cur_part_num : _cur_part_num - 1;
     DCHECK_EQ(expected_num_parts1, expected_num_parts2)
             << " bytes_appended=" << _bytes_appended << " cur_part_num=" << _cur_part_num
-            << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+            << " s3_write_buffer_size=" << _base_part_size;
     if (_failed || _completed_parts.size() != static_cast<size_t>(expected_num_parts1) ||
         expected_num_parts1 != expected_num_parts2) {
         _st = Status::InternalError(
@@ -406,7 +429,7 @@ Status S3FileWriter::_complete() {
     TEST_SYNC_POINT_CALLBACK("S3FileWriter::_complete:2", &_completed_parts);
     LOG(INFO) << "complete_multipart_upload " << _obj_storage_path_opts.path.native()
               << " size=" << _bytes_appended << " number_parts=" << _completed_parts.size()
-              << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+              << " s3_write_buffer_size=" << _base_part_size;
     auto resp = client->complete_multipart_upload(_obj_storage_path_opts, _completed_parts);
     if (resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to complete multipart upload, err={}, file_path={}", resp.status.msg,
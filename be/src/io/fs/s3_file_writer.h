@@ -82,6 +82,8 @@ private:
     void _upload_one_part(int part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
     Status _build_upload_buffer();
+    // the size of the given part, it only depends on the part number
+    size_t _part_size(int part_num) const;
 
     ObjectStoragePathOptions _obj_storage_path_opts;
 
@@ -111,6 +113,11 @@ private:
     std::unique_ptr<AsyncCloseStatusPack> _async_close_pack;
     State _state {State::OPENED};
     std::shared_ptr<ObjClientHolder> _obj_client;
+
+    // fixed when the writer is created, so a config update can not change the size of the parts
+    const size_t _base_part_size;
+    const int32_t _part_size_grow_parts;
+    const size_t _max_part_size;
 };
 
 } // namespace io
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/internal_service.pb.h>
 
+#include "common/config.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/beta_rowset_writer.h"
 #include "util/debug_points.h"
@@ -51,7 +52,28 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
                << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
                << ", data_length: " << bytes_req << "file_type" << _file_type;
 
-    std::span<const Slice> slices {data, data_cnt};
+    // Keep the small appends, e.g. the pages of a small segment, and send them in one message
+    // so that the receiver handles fewer messages.
+    auto buffer_bytes = config::stream_sink_file_writer_buffer_bytes;
+    if (buffer_bytes > 0 && _buffer.size() + bytes_req < static_cast<size_t>(buffer_bytes)) {
+        for (size_t i = 0; i < data_cnt; i++) {
+            _buffer.append(data[i].get_data(), data[i].get_size());
+        }
+        _bytes_appended += bytes_req;
+        return Status::OK();
+    }
+    std::vector<Slice> buffered_slices;
+    if (!_buffer.empty()) {
+        buffered_slices.reserve(data_cnt + 1);
+        buffered_slices.emplace_back(_buffer);
+        buffered_slices.insert(buffered_slices.end(), data, data + data_cnt);
+        bytes_req += _buffer.size();
+    }
+    std::span<const Slice> slices = buffered_slices.empty()
+                                            ? std::span<const Slice> {data, data_cnt}
+                                            : std::span<const Slice> {buffered_slices};
+    // the offset of the first byte in this message
+    size_t offset = _bytes_appended - _buffer.size();
     size_t fault_injection_skipped_streams = 0;
     bool ok = false;
     Status st;
@@ -70,8 +92,8 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
         });
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
                         { continue; });
-        st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id, _bytes_appended,
-                                 slices, false, _file_type);
+        st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id, offset, slices,
+                                 false, _file_type);
         ok = ok || st.ok();
         if (!st.ok()) {
             LOG(WARNING) << "failed to send segment data to backend " << stream->dst_id()
@@ -93,7 +115,8 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
                 "failed to send segment data to any replicas, tablet_id={}, segment_id={}",
                 _tablet_id, _segment_id);
     }
-    _bytes_appended += bytes_req;
+    _bytes_appended = offset + bytes_req;
+    _buffer.clear();
     return Status::OK();
 }
 
@@ -123,6 +146,12 @@ Status StreamSinkFileWriter::_finalize() {
     VLOG_DEBUG << "writer finalize, load_id: " << print_id(_load_id) << ", index_id: " << _index_id
                << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id;
     // TODO(zhengyu): update get_inverted_index_file_size into stat
+    // the buffered data is sent together with the segment eos
+    Slice buffered(_buffer);
+    std::span<const Slice> slices;
+    if (!_buffer.empty()) {
+        slices = {&buffered, 1};
+    }
     size_t fault_injection_skipped_streams = 0;
     bool ok = false;
     for (auto& stream : _streams) {
@@ -141,7 +170,8 @@ Status StreamSinkFileWriter::_finalize() {
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
                         { continue; });
         auto st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id,
-                                      _bytes_appended, {}, true, _file_type);
+                                      _bytes_appended - _buffer.size(), slices, true,
+                                      _file_type);
         ok = ok || st.ok();
         if (!st.ok()) {
             LOG(WARNING) << "failed to send segment eos to backend " << stream->dst_id()
@@ -164,6 +194,7 @@ Status StreamSinkFileWriter::_finalize() {
                 "failed to send segment eos to any replicas, tablet_id={}, segment_id={}",
                 _tablet_id, _segment_id);
     }
+    _buffer.clear();
     return Status::OK();
 }
 
@@ -21,6 +21,7 @@
 #include <gen_cpp/olap_common.pb.h>
 
 #include <queue>
+#include <string>
 
 #include "io/fs/file_writer.h"
 #include "util/uid_util.h"
@@ -65,6 +66,8 @@ private:
     int64_t _tablet_id;
     int32_t _segment_id;
     size_t _bytes_appended = 0;
+    // the appended data not sent yet, at the end of the file
+    std::string _buffer;
     State _state {State::OPENED};
     FileType _file_type {FileType::SEGMENT_FILE};
 };
@@ -74,11 +74,9 @@ bvar::LatencyRecorder g_tablet_update_delete_bitmap_latency("doris_pk", "update_
 
 static bvar::Adder<size_t> g_total_tablet_num("doris_total_tablet_num");
 
-Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t segid,
-                                    const TabletColumn& target_column,
-                                    SegmentCacheHandle* segment_cache_handle,
-                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
-                                    OlapReaderStatistics* stats) {
+Status _get_segment(const BetaRowsetSharedPtr& rowset, uint32_t segid,
+                    SegmentCacheHandle* segment_cache_handle,
+                    segment_v2::SegmentSharedPtr* segment) {
     RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(rowset, segment_cache_handle, true));
     // find segment
     auto it = std::find_if(
@@ -89,7 +87,14 @@ Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t
         return Status::NotFound(fmt::format("rowset {} 's segemnt not found, seg_id {}",
                                             rowset->rowset_id().to_string(), segid));
     }
-    segment_v2::SegmentSharedPtr segment = *it;
+    *segment = *it;
+    return Status::OK();
+}
+
+Status _new_segment_column_iterator(const segment_v2::SegmentSharedPtr& segment,
+                                    const TabletColumn& target_column,
+                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
+                                    OlapReaderStatistics* stats) {
     StorageReadOptions opts;
     opts.stats = stats;
     RETURN_IF_ERROR(segment->new_column_iterator(target_column, column_iterator, &opts));
@@ -104,6 +109,51 @@ Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t
     return Status::OK();
 }
 
+Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t segid,
+                                    const TabletColumn& target_column,
+                                    SegmentCacheHandle* segment_cache_handle,
+                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
+                                    OlapReaderStatistics* stats) {
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(_get_segment(rowset, segid, segment_cache_handle, &segment));
+    return _new_segment_column_iterator(segment, target_column, column_iterator, stats);
+}
+
+// the rowsets in `specified_rowsets` (order kept) which may contain a key of segment `seg_id`
+// of `rowset`, judged by the segments key bounds of both sides.
+std::vector<RowsetSharedPtr> _rowsets_overlap_with_segment(
+        const RowsetSharedPtr& rowset, uint32_t seg_id,
+        const std::vector<RowsetSharedPtr>& specified_rowsets) {
+    const auto& seg_bounds = rowset->rowset_meta()->get_segments_key_bounds();
+    if (seg_id >= static_cast<uint32_t>(seg_bounds.size())) {
+        return specified_rowsets;
+    }
+    Slice seg_min {seg_bounds[seg_id].min_key()};
+    Slice seg_max {seg_bounds[seg_id].max_key()};
+    bool seg_truncated = rowset->rowset_meta()->is_segments_key_bounds_truncated();
+
+    std::vector<RowsetSharedPtr> overlapped;
+    overlapped.reserve(specified_rowsets.size());
+    for (const auto& rs : specified_rowsets) {
+        const auto& bounds = rs->rowset_meta()->get_segments_key_bounds();
+        bool truncated = rs->rowset_meta()->is_segments_key_bounds_truncated();
+        if (static_cast<int64_t>(bounds.size()) != rs->num_segments()) {
+            overlapped.push_back(rs);
+            continue;
+        }
+        bool overlap = std::any_of(bounds.begin(), bounds.end(), [&](const KeyBoundsPB& b) {
+            return !Slice::lhs_is_strictly_less_than_rhs(Slice {b.max_key()}, truncated, seg_min,
+                                                         seg_truncated) &&
+                   !Slice::lhs_is_strictly_less_than_rhs(seg_max, seg_truncated,
+                                                         Slice {b.min_key()}, truncated);
+        });
+        if (overlap) {
+            overlapped.push_back(rs);
+        }
+    }
+    return overlapped;
+}
+
 } // namespace
 
 extern MetricPrototype METRIC_query_scan_bytes;
@@ -463,8 +513,7 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
             delete_bitmap == nullptr ? _tablet_meta->delete_bitmap_ptr() : delete_bitmap;
     for (size_t i = 0; i < specified_rowsets.size(); i++) {
         const auto& rs = specified_rowsets[i];
-        std::vector<KeyBoundsPB> segments_key_bounds;
-        rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
+        const auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
         int num_segments = cast_set<int>(rs->num_segments());
         DCHECK_EQ(segments_key_bounds.size(), num_segments);
         std::vector<uint32_t> picked_segments;
@@ -475,6 +524,19 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
             }
             picked_segments.emplace_back(j);
         }
+        if (picked_segments.size() > 1) {
+            // go straight to the segments which may contain the key instead of probing the
+            // bloom filter of each one
+            const auto* key_filter = std::static_pointer_cast<BetaRowset>(rs)->get_key_filter();
+            if (key_filter != nullptr) {
+                std::vector<uint32_t> candidates;
+                key_filter->lookup(key_without_seq, &candidates);
+                std::erase_if(picked_segments, [&](uint32_t id) {
+                    return std::find(candidates.begin(), candidates.end(), id) ==
+                           candidates.end();
+                });
+            }
+        }
         if (picked_segments.empty()) {
             continue;
         }
@@ -489,7 +551,8 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
 
         for (auto id : picked_segments) {
             Status s = segments[id]->lookup_row_key(encoded_key, schema, with_seq_col, with_rowid,
-                                                    &loc, stats, encoded_seq_value);
+                                                    &loc, stats, encoded_seq_value,
+                                                    segment_caches[i]->pk_index_iterator(id));
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -623,7 +686,11 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
-    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // Drop the rowsets whose key range does not overlap this segment once here instead of
+    // checking their segment key bounds again for every key.
+    const auto overlapped_rowsets = _rowsets_overlap_with_segment(rowset, seg->id(),
+                                                                  specified_rowsets);
+    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(overlapped_rowsets.size());
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
@@ -695,10 +762,10 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
             RowsetSharedPtr rowset_find;
             Status st = Status::OK();
             if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, overlapped_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find);
             } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, overlapped_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find, true,
                                     nullptr, nullptr, tablet_delete_bitmap);
             }
@@ -940,6 +1007,36 @@ Status BaseTablet::fetch_value_by_rowids(RowsetSharedPtr input_rowset, uint32_t
     return Status::OK();
 }
 
+Status BaseTablet::fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                          const std::vector<uint32_t>& rowids,
+                                          const TabletSchema& tablet_schema,
+                                          const std::vector<uint32_t>& cids,
+                                          vectorized::MutableColumns& dsts) {
+    DCHECK_EQ(cids.size(), dsts.size());
+    MonotonicStopWatch watch;
+    watch.start();
+    Defer _defer([&]() {
+        LOG_EVERY_N(INFO, 500) << "fetch_values_by_rowids, cost(us):"
+                               << watch.elapsed_time() / 1000 << ", row_batch_size:"
+                               << rowids.size() << ", columns:" << cids.size();
+    });
+
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    // look up the segment once, then read the columns one after another
+    SegmentCacheHandle segment_cache_handle;
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(_get_segment(rowset, segid, &segment_cache_handle, &segment));
+    OlapReaderStatistics stats;
+    for (size_t i = 0; i < cids.size(); ++i) {
+        std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+        RETURN_IF_ERROR(_new_segment_column_iterator(segment, tablet_schema.column(cids[i]),
+                                                     &column_iterator, &stats));
+        RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), dsts[i]));
+    }
+    return Status::OK();
+}
+
 const signed char* BaseTablet::get_delete_sign_column_data(const vectorized::Block& block,
                                                            size_t rows_at_least) {
     if (const vectorized::ColumnWithTypeAndName* delete_sign_column =
@@ -244,6 +244,14 @@ public:
                                         const TabletColumn& tablet_column,
                                         vectorized::MutableColumnPtr& dst);
 
+    // read columns `cids` of `tablet_schema` at `rowids` of a segment into `dsts`, the segment
+    // is looked up only once for all the columns.
+    static Status fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                         const std::vector<uint32_t>& rowids,
+                                         const TabletSchema& tablet_schema,
+                                         const std::vector<uint32_t>& cids,
+                                         vectorized::MutableColumns& dsts);
+
     virtual Result<std::unique_ptr<RowsetWriter>> create_transient_rowset_writer(
             const Rowset& rowset, std::shared_ptr<PartialUpdateInfo> partial_update_info,
             int64_t txn_expiration = 0) = 0;
@@ -373,6 +381,10 @@ public:
     IntCounter* flush_finish_count = nullptr;
     std::atomic<int64_t> published_count = 0;
     std::atomic<int64_t> read_block_count = 0;
+    // query scans per minute decayed by half every minute, maintained by the compaction producer
+    std::atomic<int64_t> compaction_read_hotness = 0;
+    std::atomic<int64_t> compaction_read_hotness_scan_count = 0;
+    std::atomic<int64_t> compaction_read_hotness_update_ms = 0;
     std::atomic<int64_t> write_count = 0;
     std::atomic<int64_t> compaction_count = 0;
 
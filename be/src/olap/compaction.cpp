@@ -39,6 +39,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
@@ -66,6 +67,7 @@
 #include "olap/rowset/segment_v2/inverted_index_compaction.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
 #include "olap/rowset/segment_v2/inverted_index_fs_directory.h"
+#include "olap/rowset/segment_v2/inverted_index_iterator.h"
 #include "olap/storage_engine.h"
 #include "olap/storage_policy.h"
 #include "olap/tablet.h"
@@ -1427,7 +1429,53 @@ void Compaction::_load_segment_to_cache() {
         LOG(WARNING) << "failed to load segment to cache! output rowset version="
                      << _output_rowset->start_version() << "-" << _output_rowset->end_version()
                      << ".";
+        return;
     }
+    // Only tablets that serve queries are worth the searcher cache space.
+    if (config::enable_compaction_index_searcher_preload &&
+        !config::enable_write_index_searcher_cache &&
+        _tablet->read_block_count.load(std::memory_order_relaxed) > 0 &&
+        !_output_rowset->tablet_schema()->inverted_indexes().empty()) {
+        st = _preload_index_searchers(handle.get_segments());
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to preload index searchers, tablet=" << _tablet->tablet_id()
+                         << ", output rowset version=" << _output_rowset->start_version() << "-"
+                         << _output_rowset->end_version() << ", st=" << st;
+        }
+    }
+}
+
+Status Compaction::_preload_index_searchers(
+        const std::vector<segment_v2::SegmentSharedPtr>& segments) {
+    OlapReaderStatistics stats;
+    StorageReadOptions read_options;
+    read_options.stats = &stats;
+    read_options.io_ctx.reader_type = compaction_type();
+    auto context = std::make_shared<segment_v2::IndexQueryContext>();
+    context->io_ctx = &read_options.io_ctx;
+    context->stats = &stats;
+
+    const auto& tablet_schema = _output_rowset->tablet_schema();
+    for (const auto& segment : segments) {
+        for (const auto& column : tablet_schema->columns()) {
+            // the indexes of variant sub columns are found through their parent column reader
+            if (column->is_extracted_column()) {
+                continue;
+            }
+            std::unique_ptr<segment_v2::IndexIterator> iter;
+            for (const auto* index_meta : tablet_schema->inverted_indexs(*column)) {
+                RETURN_IF_ERROR(segment->new_index_iterator(*column, index_meta, read_options,
+                                                            &iter));
+            }
+            auto* inverted_iter = dynamic_cast<segment_v2::InvertedIndexIterator*>(iter.get());
+            if (inverted_iter == nullptr) {
+                continue;
+            }
+            inverted_iter->set_context(context);
+            RETURN_IF_ERROR(inverted_iter->preload_searchers());
+        }
+    }
+    return Status::OK();
 }
 
 Status CloudCompactionMixin::build_basic_info() {
@@ -1585,6 +1633,20 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
                            (config::enable_file_cache_keep_base_compaction_output &&
                             compaction_type() == ReaderType::READER_BASE_COMPACTION);
+    // the base compaction output of a tablet queried in the last day is what the next queries
+    // read, keep it in the cache instead of letting them read the rewritten data cold.
+    if (!ctx.write_file_cache && compaction_type() == ReaderType::READER_BASE_COMPACTION &&
+        config::file_cache_keep_base_compaction_output_min_qpd > 0 &&
+        _engine.tablet_hotspot().get_tablet_qpd(_tablet->tablet_id()) >=
+                static_cast<uint64_t>(config::file_cache_keep_base_compaction_output_min_qpd)) {
+        ctx.write_file_cache = true;
+    }
+    // the input was read as disposable, rewriting cold input into the cache would evict
+    // the data which queries actually hit.
+    if (ctx.write_file_cache && config::file_cache_compaction_output_min_hot_ratio > 0 &&
+        input_rowsets_hot_ratio() < config::file_cache_compaction_output_min_hot_ratio) {
+        ctx.write_file_cache = false;
+    }
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     ctx.approximate_bytes_to_write = _input_rowsets_total_size;
 
@@ -1594,6 +1656,31 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     return Status::OK();
 }
 
+double CloudCompactionMixin::input_rowsets_hot_ratio() const {
+    if (!config::enable_file_cache) {
+        return 0;
+    }
+    int64_t total_bytes = 0;
+    size_t cached_bytes = 0;
+    for (const auto& rs : _input_rowsets) {
+        total_bytes += rs->data_disk_size();
+        for (int64_t seg_id = 0; seg_id < rs->num_segments(); ++seg_id) {
+            auto seg_path = rs->segment_path(seg_id);
+            if (!seg_path.has_value()) {
+                continue;
+            }
+            auto file_key = io::BlockFileCache::hash(
+                    io::Path(seg_path.value()).filename().native());
+            auto* file_cache = io::FileCacheFactory::instance()->get_by_path(file_key);
+            cached_bytes += file_cache->get_cached_size_by_key(file_key);
+        }
+    }
+    if (total_bytes <= 0) {
+        return 1;
+    }
+    return std::min(1.0, static_cast<double>(cached_bytes) / static_cast<double>(total_bytes));
+}
+
 Status CloudCompactionMixin::garbage_collection() {
     if (!config::enable_file_cache) {
         return Status::OK();
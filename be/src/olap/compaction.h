@@ -105,6 +105,7 @@ protected:
     void init_profile(const std::string& label);
 
     void _load_segment_to_cache();
+    Status _preload_index_searchers(const std::vector<segment_v2::SegmentSharedPtr>& segments);
 
     int64_t merge_way_num();
 
@@ -236,6 +237,9 @@ protected:
 private:
     Status construct_output_rowset_writer(RowsetWriterContext& ctx) override;
 
+    // ratio of the input segment bytes that are in the file cache
+    double input_rowsets_hot_ratio() const;
+
     Status execute_compact_impl(int64_t permits);
 
     Status build_basic_info();
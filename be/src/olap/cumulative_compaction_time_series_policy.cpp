@@ -32,6 +32,10 @@ namespace doris {
 static constexpr int64_t MAX_LEVEL2_COMPACTION_TIMEOUT = 24 * 60 * 60;
 static constexpr int64_t MAX_LEVEL1_COMPACTION_GOAL_SIZE = 2 * 1024;
 
+static int64_t level1_fan_out() {
+    return std::max(2, config::time_series_compaction_level1_fan_out);
+}
+
 uint32_t TimeSeriesCumulativeCompactionPolicy::calc_cumulative_compaction_score(Tablet* tablet) {
     uint32_t score = 0;
     uint32_t level0_score = 0;
@@ -136,7 +140,8 @@ uint32_t TimeSeriesCumulativeCompactionPolicy::calc_cumulative_compaction_score(
             continuous_size += rs_meta->total_disk_size();
             // Condition 4: level1 achieve compaction_goal_size
             if (level1_rowsets.size() >= 2) {
-                if (continuous_size >= compaction_goal_size_mbytes * 10 * 1024 * 1024) {
+                if (continuous_size >=
+                    compaction_goal_size_mbytes * level1_fan_out() * 1024 * 1024) {
                     return cast_set<int32_t>(level1_rowsets.size());
                 }
             }
@@ -148,7 +153,7 @@ uint32_t TimeSeriesCumulativeCompactionPolicy::calc_cumulative_compaction_score(
         // Condition 5: level1 achieve compaction_time_threshold_seconds
         if (level1_rowsets.size() >= 2) {
             int64_t cumu_interval = now - earliest_level1_rowset_creation_time;
-            if (cumu_interval > compaction_time_threshold_seconds * 10) {
+            if (cumu_interval > compaction_time_threshold_seconds * level1_fan_out()) {
                 return cast_set<int32_t>(level1_rowsets.size());
             }
         }
@@ -386,7 +391,8 @@ int32_t TimeSeriesCumulativeCompactionPolicy::pick_input_rowsets(
             continuous_size += rs_meta->total_disk_size();
             // Condition 4: level1 achieve compaction_goal_size
             if (level1_rowsets.size() >= 2) {
-                if (continuous_size >= compaction_goal_size_mbytes * 10 * 1024 * 1024) {
+                if (continuous_size >=
+                    compaction_goal_size_mbytes * level1_fan_out() * 1024 * 1024) {
                     input_rowsets->swap(level1_rowsets);
                     return cast_set<int32_t>(input_rowsets->size());
                 }
@@ -403,7 +409,7 @@ int32_t TimeSeriesCumulativeCompactionPolicy::pick_input_rowsets(
         // Condition 5: level1 achieve compaction_time_threshold_seconds
         if (level1_rowsets.size() >= 2) {
             int64_t cumu_interval = now - level1_rowsets.front()->rowset_meta()->creation_time();
-            if (cumu_interval > compaction_time_threshold_seconds * 10) {
+            if (cumu_interval > compaction_time_threshold_seconds * level1_fan_out()) {
                 input_rowsets->swap(level1_rowsets);
                 return cast_set<int32_t>(input_rowsets->size());
             }
@@ -30,13 +30,16 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/config.h"
@@ -62,9 +65,11 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -421,11 +426,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_mtx;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mtx](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard lock(tablet_ids_mtx);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -448,11 +454,51 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Deserializing the tablet metas and creating the tablets dominates the restart time of a
+    // BE with many tablets, spread them over a pool instead of the traversing thread.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        static_cast<void>(ThreadPoolBuilder("load_tablet_meta")
+                                  .set_min_threads(config::load_tablet_meta_threads_per_data_dir)
+                                  .set_max_threads(config::load_tablet_meta_threads_per_data_dir)
+                                  .build(&load_tablet_pool));
+    }
+    // The metas are copied out of the meta iterator and loaded batch by batch to bound memory
+    constexpr size_t load_tablet_batch_size = 4096;
+    std::vector<std::tuple<int64_t, int32_t, std::string>> pending_tablet_metas;
+    auto load_pending_tablets = [&]() {
+        for (auto& [tablet_id, schema_hash, value] : pending_tablet_metas) {
+            auto st = load_tablet_pool->submit_func(
+                    [&load_tablet, tablet_id, schema_hash, value = std::string_view(value)]() {
+                        SCOPED_INIT_THREAD_CONTEXT();
+                        load_tablet(tablet_id, schema_hash, value);
+                    });
+            if (!st.ok()) {
+                load_tablet(tablet_id, schema_hash, value);
+            }
+        }
+        load_tablet_pool->wait();
+        pending_tablet_metas.clear();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash,
+                                std::string_view value) -> bool {
+        if (load_tablet_pool == nullptr) {
+            load_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        pending_tablet_metas.emplace_back(tablet_id, schema_hash, std::string(value));
+        if (pending_tablet_metas.size() >= load_tablet_batch_size) {
+            load_pending_tablets();
+        }
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    if (load_tablet_pool != nullptr) {
+        load_pending_tablets();
+    }
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
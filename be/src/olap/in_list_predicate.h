@@ -276,8 +276,14 @@ public:
             return true;
         }
         if constexpr (PT == PredicateType::IN_LIST) {
-            return get_zone_map_value<Type, T>(statistic.first->cell_ptr()) <= _max_value &&
-                   get_zone_map_value<Type, T>(statistic.second->cell_ptr()) >= _min_value;
+            const T min_value = get_zone_map_value<Type, T>(statistic.first->cell_ptr());
+            const T max_value = get_zone_map_value<Type, T>(statistic.second->cell_ptr());
+            // A zone of a single value, e.g. one of the distinct values of a zone map. The
+            // values of CHAR are padded in the set, but not in the zone map.
+            if (Type != TYPE_CHAR && min_value == max_value) {
+                return _values->find(reinterpret_cast<const T*>(&min_value));
+            }
+            return min_value <= _max_value && max_value >= _min_value;
         } else {
             return true;
         }
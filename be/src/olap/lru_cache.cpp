@@ -4,12 +4,17 @@
 
 #include "olap/lru_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <new>
 #include <sstream>
 #include <string>
 
+#include "common/cast_set.h"
+#include "common/config.h"
+#include "util/bit_util.h"
+#include "util/hot_path_metrics.h"
 #include "util/metrics.h"
 #include "util/time.h"
 
@@ -27,6 +32,7 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS)
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_miss_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_stampede_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_rejected_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
@@ -164,12 +170,77 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
-LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
+void FrequencySketch::ensure_capacity(size_t num_entries) {
+    // the words are sized like the entries, 4 counters per entry fill a quarter of them
+    static constexpr size_t MAX_WORDS = 1 << 16;
+    const auto entries = cast_set<int64_t>(std::max<size_t>(num_entries, 16));
+    const auto words =
+            std::min(MAX_WORDS, static_cast<size_t>(BitUtil::RoundUpToPowerOfTwo(entries)));
+    if (words <= _table.size()) {
+        return;
+    }
+    _table.assign(words, 0);
+    _sample_size = 10 * words;
+    _additions = 0;
+}
+
+std::pair<size_t, int> FrequencySketch::_index_of(uint32_t hash, int i) const {
+    static constexpr uint64_t SEEDS[DEPTH] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                              0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (hash + SEEDS[i]) * SEEDS[i];
+    h ^= h >> 32;
+    return {(h >> 4) & (_table.size() - 1), static_cast<int>(h & 15) << 2};
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    if (_table.empty()) {
+        return;
+    }
+    bool added = false;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [word, shift] = _index_of(hash, i);
+        if (((_table[word] >> shift) & 0xfULL) != 0xfULL) {
+            _table[word] += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_additions >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    if (_table.empty()) {
+        return 0;
+    }
+    uint32_t frequency = 0xf;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [word, shift] = _index_of(hash, i);
+        frequency = std::min(frequency, static_cast<uint32_t>((_table[word] >> shift) & 0xfULL));
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _additions /= 2;
+}
+
+LRUCache::LRUCache(LRUCacheType type, LRUCacheEvictionPolicy eviction_policy)
+        : _type(type),
+          _is_lru_k(eviction_policy == LRUCacheEvictionPolicy::LRU_K),
+          _is_tiny_lfu(eviction_policy == LRUCacheEvictionPolicy::TINY_LFU),
+          // the admission and the probation list of TINY_LFU need the exclusive lock on hits
+          _lazy_recency(config::enable_lru_cache_lazy_recency && !_is_tiny_lfu) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
     _lru_normal.prev = &_lru_normal;
     _lru_durable.next = &_lru_durable;
     _lru_durable.prev = &_lru_durable;
+    _lru_probation.next = &_lru_probation;
+    _lru_probation.prev = &_lru_probation;
 }
 
 LRUCache::~LRUCache() {
@@ -201,13 +272,11 @@ PrunedInfo LRUCache::set_capacity(size_t capacity) {
 }
 
 uint64_t LRUCache::get_lookup_count() {
-    std::lock_guard l(_mutex);
-    return _lookup_count;
+    return _lookup_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_hit_count() {
-    std::lock_guard l(_mutex);
-    return _hit_count;
+    return _hit_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_stampede_count() {
@@ -215,9 +284,13 @@ uint64_t LRUCache::get_stampede_count() {
     return _stampede_count;
 }
 
-uint64_t LRUCache::get_miss_count() {
+uint64_t LRUCache::get_rejected_count() {
     std::lock_guard l(_mutex);
-    return _miss_count;
+    return _rejected_count;
+}
+
+uint64_t LRUCache::get_miss_count() {
+    return _miss_count.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_usage() {
@@ -289,22 +362,75 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     }
 }
 
+// With lazy recency, the entries stay in their LRU list while they are referenced. Return the
+// oldest entry of `list` not referenced externally, moving the referenced entries and the ones
+// visited since the last pass to the newest end, CLOCK style. Return nullptr if there is none.
+LRUHandle* LRUCache::_lru_victim(LRUHandle* list) {
+    if (!_use_lazy_recency()) {
+        return list->next != list ? list->next : nullptr;
+    }
+    // every entry is passed at most twice, once to clear `visited`
+    const size_t max_passed = 2 * _table.element_count();
+    for (size_t passed = 0; list->next != list && passed < max_passed; ++passed) {
+        LRUHandle* e = list->next;
+        if (e->refs == 1 && !e->visited) {
+            return e;
+        }
+        if (e->refs == 1) {
+            e->visited = false;
+        }
+        _lru_remove(e);
+        _lru_append(list, e);
+    }
+    return nullptr;
+}
+
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
-    std::lock_guard l(_mutex);
-    ++_lookup_count;
+    if (_use_lazy_recency()) {
+        // a hit neither moves the entry nor changes the state guarded by `_mutex`, except the
+        // reference count updated atomically, so the readers do not exclude each other
+        hot_path_metrics::lock_shared(_mutex, HotLock::LRU_CACHE_SHARD);
+        std::shared_lock l(_mutex, std::adopt_lock);
+        LRUHandle* e = _table.lookup(key, hash);
+        if (e != nullptr) {
+            DCHECK(e->in_cache);
+            std::atomic_ref<uint32_t>(e->refs).fetch_add(1, std::memory_order_relaxed);
+            std::atomic_ref<bool>(e->visited).store(true, std::memory_order_relaxed);
+            std::atomic_ref<int64_t>(e->last_visit_time)
+                    .store(UnixMillis(), std::memory_order_relaxed);
+            _lookup_count.fetch_add(1, std::memory_order_relaxed);
+            _hit_count.fetch_add(1, std::memory_order_relaxed);
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+        // a miss may update the visits list of LRU-K
+        if (!_is_lru_k) {
+            _lookup_count.fetch_add(1, std::memory_order_relaxed);
+            _miss_count.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    hot_path_metrics::lock(_mutex, HotLock::LRU_CACHE_SHARD);
+    std::lock_guard l(_mutex, std::adopt_lock);
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
         DCHECK(e->in_cache);
-        if (e->refs == 1) {
+        if (e->refs == 1 && !_use_lazy_recency()) {
             // only in LRU free list, remove it from list
             _lru_remove(e);
         }
         e->refs++;
-        ++_hit_count;
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
         e->last_visit_time = UnixMillis();
+        e->in_probation = false;
+        e->visited = true;
     } else {
-        ++_miss_count;
+        _miss_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (_is_tiny_lfu) {
+        _frequency_sketch.increment(hash);
     }
 
     // If key not exist in cache, and is lru k cache, and key in visits list,
@@ -325,9 +451,24 @@ void LRUCache::release(Cache::Handle* handle) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_use_lazy_recency()) {
+        // the entry is already in its LRU list, only dropping the last external reference
+        // needs the exclusive lock, to free the entry or to remove it from an overfull cache
+        hot_path_metrics::lock_shared(_mutex, HotLock::LRU_CACHE_SHARD);
+        std::shared_lock l(_mutex, std::adopt_lock);
+        std::atomic_ref<uint32_t> refs(e->refs);
+        uint32_t r = refs.load(std::memory_order_relaxed);
+        while (r > 2 || (r == 2 && (!e->in_cache || _usage <= _capacity))) {
+            if (refs.compare_exchange_weak(r, r - 1, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
     bool last_ref = false;
     {
-        std::lock_guard l(_mutex);
+        hot_path_metrics::lock(_mutex, HotLock::LRU_CACHE_SHARD);
+        std::lock_guard l(_mutex, std::adopt_lock);
         // if last_ref is true, key may have been evict from the cache,
         // or if it is lru k, first insert of key may have failed.
         last_ref = _unref(e);
@@ -335,6 +476,9 @@ void LRUCache::release(Cache::Handle* handle) {
             // only exists in cache
             if (_usage > _capacity) {
                 // take this opportunity and remove the item
+                if (_use_lazy_recency()) {
+                    _lru_remove(e);
+                }
                 bool removed = _table.remove(e);
                 DCHECK(removed);
                 e->in_cache = false;
@@ -343,9 +487,11 @@ void LRUCache::release(Cache::Handle* handle) {
                 // see the comment for old entry in `LRUCache::insert`.
                 _usage -= e->total_size;
                 last_ref = true;
-            } else {
+            } else if (!_use_lazy_recency()) {
                 // put it to LRU free list
-                if (e->priority == CachePriority::NORMAL) {
+                if (e->in_probation && _use_probation()) {
+                    _lru_append(&_lru_probation, e);
+                } else if (e->priority == CachePriority::NORMAL) {
                     _lru_append(&_lru_normal, e);
                 } else if (e->priority == CachePriority::DURABLE) {
                     _lru_append(&_lru_durable, e);
@@ -387,19 +533,33 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
 }
 
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
+    // 0. evict the entries never hit first, so that a scan does not flush the others
+    while (_usage + total_size > _capacity || _check_element_count_limit()) {
+        LRUHandle* old = _lru_victim(&_lru_probation);
+        if (old == nullptr) {
+            break;
+        }
+        _evict_one_entry(old);
+        old->next = *to_remove_head;
+        *to_remove_head = old;
+    }
     // 1. evict normal cache entries
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_normal.next != &_lru_normal) {
-        LRUHandle* old = _lru_normal.next;
+    while (_usage + total_size > _capacity || _check_element_count_limit()) {
+        LRUHandle* old = _lru_victim(&_lru_normal);
+        if (old == nullptr) {
+            break;
+        }
         DCHECK(old->priority == CachePriority::NORMAL);
         _evict_one_entry(old);
         old->next = *to_remove_head;
         *to_remove_head = old;
     }
     // 2. evict durable cache entries if need
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_durable.next != &_lru_durable) {
-        LRUHandle* old = _lru_durable.next;
+    while (_usage + total_size > _capacity || _check_element_count_limit()) {
+        LRUHandle* old = _lru_victim(&_lru_durable);
+        if (old == nullptr) {
+            break;
+        }
         DCHECK(old->priority == CachePriority::DURABLE);
         _evict_one_entry(old);
         old->next = *to_remove_head;
@@ -460,6 +620,36 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
     return false;
 }
 
+// After cache is full and the probationary list is empty, an evicted entry is only replaced by
+// a key accessed more frequently. Return true if the key is rejected.
+bool LRUCache::_tiny_lfu_reject(size_t total_size, uint32_t hash) {
+    _frequency_sketch.ensure_capacity(_table.element_count() + 1);
+    _frequency_sketch.increment(hash);
+    if (_usage + total_size <= _capacity && !_check_element_count_limit()) {
+        return false;
+    }
+    if (_use_probation() && _lru_probation.next != &_lru_probation) {
+        return false;
+    }
+    const LRUHandle* victim = nullptr;
+    if (_cache_value_check_timestamp) {
+        if (!_sorted_normal_entries_with_timestamp.empty()) {
+            victim = _sorted_normal_entries_with_timestamp.begin()->second;
+        }
+    } else if (_lru_normal.next != &_lru_normal) {
+        victim = _lru_normal.next;
+    }
+    // the durable entries are not compared, they are evicted after all the normal ones
+    if (victim == nullptr) {
+        return false;
+    }
+    if (_frequency_sketch.frequency(hash) <= _frequency_sketch.frequency(victim->hash)) {
+        ++_rejected_count;
+        return true;
+    }
+    return false;
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -476,16 +666,22 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->in_cache = false;
     e->priority = priority;
     e->type = _type;
+    e->in_probation = _is_tiny_lfu && priority == CachePriority::NORMAL;
+    e->visited = false;
     memcpy(e->key_data, key.data(), key.size());
     e->last_visit_time = UnixMillis();
 
     LRUHandle* to_remove_head = nullptr;
     {
-        std::lock_guard l(_mutex);
+        hot_path_metrics::lock(_mutex, HotLock::LRU_CACHE_SHARD);
+        std::lock_guard l(_mutex, std::adopt_lock);
 
         if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
             return reinterpret_cast<Cache::Handle*>(e);
         }
+        if (_is_tiny_lfu && _tiny_lfu_reject(e->total_size, hash)) {
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
 
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
@@ -502,6 +698,9 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         e->in_cache = true;
         _usage += e->total_size;
         e->refs++; // one for the returned handle, one for LRUCache.
+        if (_use_lazy_recency()) {
+            _lru_append(priority == CachePriority::NORMAL ? &_lru_normal : &_lru_durable, e);
+        }
         if (old != nullptr) {
             _stampede_count++;
             old->in_cache = false;
@@ -513,10 +712,13 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             // will be released from the cache memory_tracker.
             _usage -= old->total_size;
             // if false, old entry is being used externally, just ref-- and sub _usage,
-            if (_unref(old)) {
+            bool last_ref = _unref(old);
+            if (last_ref || _use_lazy_recency()) {
                 // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
+                // was just 1 (Unref returned 0), or it is always with lazy recency
                 _lru_remove(old);
+            }
+            if (last_ref) {
                 old->next = to_remove_head;
                 to_remove_head = old;
             }
@@ -538,12 +740,14 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     LRUHandle* e = nullptr;
     bool last_ref = false;
     {
-        std::lock_guard l(_mutex);
+        hot_path_metrics::lock(_mutex, HotLock::LRU_CACHE_SHARD);
+        std::lock_guard l(_mutex, std::adopt_lock);
         e = _table.remove(key, hash);
         if (e != nullptr) {
             last_ref = _unref(e);
-            // if last_ref is false or in_cache is false, e must not be in lru
-            if (last_ref && e->in_cache) {
+            // if last_ref is false or in_cache is false, e must not be in lru,
+            // except that an entry in cache is always in lru with lazy recency
+            if (e->in_cache && (last_ref || _use_lazy_recency())) {
                 // locate in free list
                 _lru_remove(e);
             }
@@ -563,14 +767,17 @@ PrunedInfo LRUCache::prune() {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
+        while (LRUHandle* old = _lru_victim(&_lru_probation)) {
+            _evict_one_entry(old);
+            old->next = to_remove_head;
+            to_remove_head = old;
+        }
+        while (LRUHandle* old = _lru_victim(&_lru_normal)) {
             _evict_one_entry(old);
             old->next = to_remove_head;
             to_remove_head = old;
         }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
+        while (LRUHandle* old = _lru_victim(&_lru_durable)) {
             _evict_one_entry(old);
             old->next = to_remove_head;
             to_remove_head = old;
@@ -592,9 +799,31 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        LRUHandle* p = _lru_normal.next;
+        LRUHandle* p = _lru_probation.next;
+        while (p != &_lru_probation) {
+            LRUHandle* next = p->next;
+            // with lazy recency the referenced entries are in the list too, they are kept
+            if (p->refs > 1) {
+                p = next;
+                continue;
+            }
+            if (pred(p)) {
+                _evict_one_entry(p);
+                p->next = to_remove_head;
+                to_remove_head = p;
+            } else if (lazy_mode) {
+                break;
+            }
+            p = next;
+        }
+
+        p = _lru_normal.next;
         while (p != &_lru_normal) {
             LRUHandle* next = p->next;
+            if (p->refs > 1) {
+                p = next;
+                continue;
+            }
             if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
@@ -608,6 +837,10 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
         p = _lru_durable.next;
         while (p != &_lru_durable) {
             LRUHandle* next = p->next;
+            if (p->refs > 1) {
+                p = next;
+                continue;
+            }
             if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
@@ -644,7 +877,7 @@ inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
 
 ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
                                  uint32_t num_shards, uint32_t total_element_count_capacity,
-                                 bool is_lru_k)
+                                 LRUCacheEvictionPolicy eviction_policy)
         : _name(name),
           _num_shard_bits(__builtin_ctz(num_shards)),
           _num_shards(num_shards),
@@ -659,7 +892,7 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
             (total_element_count_capacity + (_num_shards - 1)) / _num_shards;
     auto** shards = new (std::nothrow) LRUCache*[_num_shards];
     for (int s = 0; s < _num_shards; s++) {
-        shards[s] = new LRUCache(type, is_lru_k);
+        shards[s] = new LRUCache(type, eviction_policy);
         shards[s]->set_capacity(per_shard);
         shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
     }
@@ -675,6 +908,7 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
     INT_COUNTER_METRIC_REGISTER(_entity, cache_lookup_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_stampede_count);
+    INT_COUNTER_METRIC_REGISTER(_entity, cache_rejected_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_miss_count);
     DOUBLE_GAUGE_METRIC_REGISTER(_entity, cache_hit_ratio);
 
@@ -690,9 +924,10 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
                                  uint32_t num_shards,
                                  CacheValueTimeExtractor cache_value_time_extractor,
                                  bool cache_value_check_timestamp,
-                                 uint32_t total_element_count_capacity, bool is_lru_k)
+                                 uint32_t total_element_count_capacity,
+                                 LRUCacheEvictionPolicy eviction_policy)
         : ShardedLRUCache(name, capacity, type, num_shards, total_element_count_capacity,
-                          is_lru_k) {
+                          eviction_policy) {
     for (int s = 0; s < _num_shards; s++) {
         _shards[s]->set_cache_value_time_extractor(cache_value_time_extractor);
         _shards[s]->set_cache_value_check_timestamp(cache_value_check_timestamp);
@@ -801,6 +1036,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_element_count = 0;
     size_t total_miss_count = 0;
     size_t total_stampede_count = 0;
+    size_t total_rejected_count = 0;
 
     for (int i = 0; i < _num_shards; i++) {
         capacity += _shards[i]->get_capacity();
@@ -810,6 +1046,7 @@ void ShardedLRUCache::update_cache_metrics() const {
         total_element_count += _shards[i]->get_element_count();
         total_miss_count += _shards[i]->get_miss_count();
         total_stampede_count += _shards[i]->get_stampede_count();
+        total_rejected_count += _shards[i]->get_rejected_count();
     }
 
     cache_capacity->set_value(capacity);
@@ -819,6 +1056,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     cache_hit_count->set_value(total_hit_count);
     cache_miss_count->set_value(total_miss_count);
     cache_stampede_count->set_value(total_stampede_count);
+    cache_rejected_count->set_value(total_rejected_count);
     cache_usage_ratio->set_value(
             capacity == 0 ? 0 : (static_cast<double>(total_usage) / static_cast<double>(capacity)));
     cache_hit_ratio->set_value(total_lookup_count == 0 ? 0
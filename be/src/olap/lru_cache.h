@@ -17,8 +17,10 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
@@ -36,10 +38,23 @@ enum LRUCacheType {
     NUMBER // The capacity of cache is based on the number of cache entry, number = charge, the weight of an entry.
 };
 
+// Which entries a full cache keeps.
+enum class LRUCacheEvictionPolicy {
+    // Evict the least recently used entry.
+    LRU,
+    // Like LRU, but a key is only admitted on its second insert once the cache is full, K=2.
+    LRU_K,
+    // Scan resistant. An inserted entry stays in a probationary list, evicted first, until it is
+    // hit. Once the probationary list is empty, a new key is only admitted if it is accessed
+    // more frequently than the LRU entry it evicts, estimated by a frequency sketch (TinyLFU).
+    TINY_LFU
+};
+
 static constexpr LRUCacheType DEFAULT_LRU_CACHE_TYPE = LRUCacheType::SIZE;
 static constexpr uint32_t DEFAULT_LRU_CACHE_NUM_SHARDS = 32;
 static constexpr size_t DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY = 0;
-static constexpr bool DEFAULT_LRU_CACHE_IS_LRU_K = false;
+static constexpr LRUCacheEvictionPolicy DEFAULT_LRU_CACHE_EVICTION_POLICY =
+        LRUCacheEvictionPolicy::LRU;
 
 class CacheKey {
 public:
@@ -159,7 +174,7 @@ public:
     // When the inserted entry is no longer needed, the key and
     // value will be passed to "deleter".
     //
-    // if cache is lru k and cache is full, first insert of key will not succeed.
+    // if cache is lru k or tiny lfu and cache is full, an insert of key may not succeed.
     //
     // Note: if is ShardedLRUCache, cache capacity = ShardedLRUCache_capacity / num_shards.
     virtual Handle* insert(const CacheKey& key, void* value, size_t charge,
@@ -231,6 +246,8 @@ struct LRUHandle {
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
     bool in_cache; // Whether entry is in the cache.
+    bool in_probation; // Not hit since inserted, only used by LRUCacheEvictionPolicy::TINY_LFU.
+    bool visited; // Hit since the last eviction pass, only used with lazy recency.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -300,6 +317,32 @@ private:
     void _resize();
 };
 
+// A count-min sketch of 4 bit counters, estimating how often a key hash is accessed. The
+// counters are halved once the number of increments reaches 10 times the number of words,
+// so that the estimation follows the recent accesses.
+class FrequencySketch {
+public:
+    // Size the sketch for `num_entries` keys, the counters are cleared if it grows.
+    void ensure_capacity(size_t num_entries);
+
+    void increment(uint32_t hash);
+
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    FRIEND_TEST(CacheTest, FrequencySketch);
+
+    static constexpr int DEPTH = 4;
+    // the word and the counter in the word of `hash` in the row `i`
+    std::pair<size_t, int> _index_of(uint32_t hash, int i) const;
+    void _reset();
+
+    // 16 counters of 4 bits per word
+    std::vector<uint64_t> _table;
+    size_t _sample_size = 0;
+    size_t _additions = 0;
+};
+
 // pair first is timestatmp, put <timestatmp, LRUHandle*> into asc set,
 // when need to free space, can first evict the begin of the set,
 // because the begin element's timestamp is the oldest.
@@ -308,7 +351,8 @@ using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 // A single shard of sharded cache.
 class LRUCache {
 public:
-    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K);
+    LRUCache(LRUCacheType type,
+             LRUCacheEvictionPolicy eviction_policy = DEFAULT_LRU_CACHE_EVICTION_POLICY);
     ~LRUCache();
 
     // visits_lru_cache_key is the hash value of CacheKey.
@@ -341,6 +385,7 @@ public:
     uint64_t get_hit_count();
     uint64_t get_miss_count();
     uint64_t get_stampede_count();
+    uint64_t get_rejected_count();
 
     size_t get_usage();
     size_t get_capacity();
@@ -355,6 +400,10 @@ private:
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    bool _tiny_lfu_reject(size_t total_size, uint32_t hash);
+    bool _use_probation() const { return _is_tiny_lfu && !_cache_value_check_timestamp; }
+    bool _use_lazy_recency() const { return _lazy_recency && !_cache_value_check_timestamp; }
+    LRUHandle* _lru_victim(LRUHandle* list);
 
 private:
     LRUCacheType _type;
@@ -363,22 +412,29 @@ private:
     size_t _capacity = 0;
 
     // _mutex protects the following state.
-    std::mutex _mutex;
+    // With lazy recency, the hits and the releases not dropping the last external reference
+    // only take it shared, they update `refs`, `visited` and `last_visit_time` atomically.
+    std::shared_mutex _mutex;
     size_t _usage = 0;
 
     // Dummy head of LRU list.
-    // Entries have refs==1 and in_cache==true.
+    // Entries have refs==1 and in_cache==true. With lazy recency the entries stay in the list
+    // while they are referenced, and a hit marks them visited instead of moving them.
     // _lru_normal.prev is newest entry, _lru_normal.next is oldest entry.
     LRUHandle _lru_normal;
     // _lru_durable.prev is newest entry, _lru_durable.next is oldest entry.
     LRUHandle _lru_durable;
+    // The normal entries not hit since inserted if TINY_LFU, evicted before _lru_normal.
+    // _lru_probation.prev is newest entry, _lru_probation.next is oldest entry.
+    LRUHandle _lru_probation;
 
     HandleTable _table;
 
-    uint64_t _lookup_count = 0; // number of cache lookups
-    uint64_t _hit_count = 0;    // number of cache hits
-    uint64_t _miss_count = 0;   // number of cache misses
+    std::atomic<uint64_t> _lookup_count = 0; // number of cache lookups
+    std::atomic<uint64_t> _hit_count = 0;    // number of cache hits
+    std::atomic<uint64_t> _miss_count = 0;   // number of cache misses
     uint64_t _stampede_count = 0;
+    uint64_t _rejected_count = 0; // number of inserts not admitted by TINY_LFU
 
     CacheValueTimeExtractor _cache_value_time_extractor;
     bool _cache_value_check_timestamp = false;
@@ -392,6 +448,12 @@ private:
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    bool _is_tiny_lfu = false;
+    FrequencySketch _frequency_sketch;
+
+    // CLOCK style recency, so that the hits do not take `_mutex` exclusively.
+    bool _lazy_recency = false;
 };
 
 class ShardedLRUCache : public Cache {
@@ -416,12 +478,13 @@ private:
     friend class LRUCachePolicy;
 
     explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
-                             uint32_t num_shards, uint32_t element_count_capacity, bool is_lru_k);
+                             uint32_t num_shards, uint32_t element_count_capacity,
+                             LRUCacheEvictionPolicy eviction_policy);
     explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
                              uint32_t num_shards,
                              CacheValueTimeExtractor cache_value_time_extractor,
                              bool cache_value_check_timestamp, uint32_t element_count_capacity,
-                             bool is_lru_k);
+                             LRUCacheEvictionPolicy eviction_policy);
 
     void update_cache_metrics() const;
 
@@ -448,6 +511,7 @@ private:
     IntCounter* cache_hit_count = nullptr;
     IntCounter* cache_miss_count = nullptr;
     IntCounter* cache_stampede_count = nullptr;
+    IntCounter* cache_rejected_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
     // bvars
     std::unique_ptr<bvar::Adder<uint64_t>> _hit_count_bvar;
@@ -82,7 +82,8 @@ MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schem
     }
     // TODO: Support ZOrderComparator in the future
     _init_columns_offset_by_slot_descs(slot_descs, tuple_desc);
-    _row_in_blocks = std::make_unique<DorisVector<std::shared_ptr<RowInBlock>>>();
+    _row_in_blocks = std::make_unique<DorisVector<RowInBlock*>>();
+    _row_in_block_arena = std::make_unique<vectorized::Arena>();
 }
 
 void MemTable::_init_columns_offset_by_slot_descs(const std::vector<SlotDescriptor*>* slot_descs,
@@ -171,6 +172,7 @@ MemTable::~MemTable() {
         _arena.clear(true);
         _vec_row_comparator.reset();
         _row_in_blocks.reset();
+        _row_in_block_arena.reset();
         _agg_functions.clear();
         _input_mutable_block.clear();
         _output_mutable_block.clear();
@@ -236,8 +238,9 @@ Status MemTable::insert(const vectorized::Block* input_block,
     size_t cursor_in_mutableblock = _input_mutable_block.rows();
     RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
                                                   row_idxs.data() + num_rows, &_column_offset));
+    auto* rows = _alloc_row_in_blocks(*_row_in_block_arena, num_rows);
     for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
+        _row_in_blocks->emplace_back(new (rows + i) RowInBlock(cursor_in_mutableblock + i));
     }
 
     _stat.raw_rows += num_rows;
@@ -302,35 +305,90 @@ Status MemTable::_put_into_output(vectorized::Block& in_block) {
                                           row_pos_vec.data() + in_block.rows());
 }
 
+// Sort the new rows by merging the runs already sorted by key, which is much cheaper than the
+// column by column sort for the loads whose data mostly comes in key order. Return false
+// without reordering any row when there are more runs than memtable_max_sorted_runs_to_merge.
+bool MemTable::_merge_sorted_runs(bool is_dup, size_t* same_keys_num) {
+    auto max_runs = static_cast<size_t>(std::max(config::memtable_max_sorted_runs_to_merge, 0));
+    if (max_runs == 0) {
+        return false;
+    }
+    auto& rows = *_row_in_blocks;
+    std::vector<size_t> run_begins {_last_sorted_pos};
+    bool has_same_keys = false;
+    for (size_t i = _last_sorted_pos + 1; i < rows.size(); i++) {
+        int value = (*_vec_row_comparator)(rows[i - 1], rows[i]);
+        if (value > 0) {
+            if (run_begins.size() == max_runs) {
+                return false;
+            }
+            run_begins.push_back(i);
+        } else if (value == 0) {
+            has_same_keys = true;
+            (*same_keys_num)++;
+        }
+    }
+    // the new rows are in insertion order, the rows with the same key in a run are sorted by
+    // ascending _row_pos already, reverse them for duplicate keys like the full sort does
+    if (is_dup && has_same_keys) {
+        size_t same_begin = _last_sorted_pos;
+        for (size_t i = _last_sorted_pos + 1; i <= rows.size(); i++) {
+            if (i == rows.size() || (*_vec_row_comparator)(rows[i - 1], rows[i]) != 0) {
+                std::reverse(std::next(rows.begin(), same_begin), std::next(rows.begin(), i));
+                same_begin = i;
+            }
+        }
+    }
+    auto cmp_func = [this, is_dup, same_keys_num](const RowInBlock* l,
+                                                  const RowInBlock* r) -> bool {
+        auto value = (*(this->_vec_row_comparator))(l, r);
+        if (value == 0) {
+            (*same_keys_num)++;
+            return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
+        }
+        return value < 0;
+    };
+    for (size_t i = 1; i < run_begins.size(); i++) {
+        auto run_end = i + 1 < run_begins.size() ? run_begins[i + 1] : rows.size();
+        std::inplace_merge(std::next(rows.begin(), _last_sorted_pos),
+                           std::next(rows.begin(), run_begins[i]),
+                           std::next(rows.begin(), run_end), cmp_func);
+    }
+    return true;
+}
+
 size_t MemTable::_sort() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
     size_t same_keys_num = 0;
-    // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
-        auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
-            return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
-        };
-        _sort_one_column(*_row_in_blocks, tie, cmp);
-    }
     bool is_dup = (_keys_type == KeysType::DUP_KEYS);
-    // sort extra round by _row_pos to make the sort stable
-    auto iter = tie.iter();
-    while (iter.next()) {
-        pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
-                std::next(_row_in_blocks->begin(), iter.right()),
-                [&is_dup](const std::shared_ptr<RowInBlock>& lhs,
-                          const std::shared_ptr<RowInBlock>& rhs) -> bool {
-                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
-                });
-        same_keys_num += iter.right() - iter.left();
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    if (!_merge_sorted_runs(is_dup, &same_keys_num)) {
+        // sort new rows
+        Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
+        for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+            auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
+                return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i,
+                                                               -1);
+            };
+            _sort_one_column(*_row_in_blocks, tie, cmp);
+        }
+        // sort extra round by _row_pos to make the sort stable
+        auto iter = tie.iter();
+        while (iter.next()) {
+            pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
+                    std::next(_row_in_blocks->begin(), iter.right()),
+                    [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
+                        return is_dup ? lhs->_row_pos > rhs->_row_pos
+                                      : lhs->_row_pos < rhs->_row_pos;
+                    });
+            same_keys_num += iter.right() - iter.left();
+        }
     }
     // merge new rows and old rows
-    _vec_row_comparator->set_block(&_input_mutable_block);
-    auto cmp_func = [this, is_dup, &same_keys_num](const std::shared_ptr<RowInBlock>& l,
-                                                   const std::shared_ptr<RowInBlock>& r) -> bool {
-        auto value = (*(this->_vec_row_comparator))(l.get(), r.get());
+    auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
+                                                   const RowInBlock* r) -> bool {
+        auto value = (*(this->_vec_row_comparator))(l, r);
         if (value == 0) {
             same_keys_num++;
             return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
@@ -339,7 +397,11 @@ size_t MemTable::_sort() {
         }
     };
     auto new_row_it = std::next(_row_in_blocks->begin(), _last_sorted_pos);
-    std::inplace_merge(_row_in_blocks->begin(), new_row_it, _row_in_blocks->end(), cmp_func);
+    // the new rows just follow the old ones when they all have greater keys
+    if (_last_sorted_pos > 0 && new_row_it != _row_in_blocks->end() &&
+        (*_vec_row_comparator)(*std::prev(new_row_it), *new_row_it) >= 0) {
+        std::inplace_merge(_row_in_blocks->begin(), new_row_it, _row_in_blocks->end(), cmp_func);
+    }
     _last_sorted_pos = _row_in_blocks->size();
     return same_keys_num;
 }
@@ -354,10 +416,12 @@ Status MemTable::_sort_by_cluster_keys() {
     auto clone_block = in_block.clone_without_columns();
     _output_mutable_block = vectorized::MutableBlock::build_mutable_block(&clone_block);
 
-    DorisVector<std::shared_ptr<RowInBlock>> row_in_blocks;
+    DorisVector<RowInBlock> rows;
+    DorisVector<RowInBlock*> row_in_blocks;
+    rows.reserve(mutable_block.rows());
     row_in_blocks.reserve(mutable_block.rows());
     for (size_t i = 0; i < mutable_block.rows(); i++) {
-        row_in_blocks.emplace_back(std::make_shared<RowInBlock>(i));
+        row_in_blocks.emplace_back(&rows.emplace_back(i));
     }
     Tie tie = Tie(0, mutable_block.rows());
 
@@ -378,8 +442,9 @@ Status MemTable::_sort_by_cluster_keys() {
     while (iter.next()) {
         pdqsort(std::next(row_in_blocks.begin(), iter.left()),
                 std::next(row_in_blocks.begin(), iter.right()),
-                [](const std::shared_ptr<RowInBlock>& lhs, const std::shared_ptr<RowInBlock>& rhs)
-                        -> bool { return lhs->_row_pos < rhs->_row_pos; });
+                [](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
+                    return lhs->_row_pos < rhs->_row_pos;
+                });
     }
 
     in_block = mutable_block.to_block();
@@ -398,16 +463,16 @@ Status MemTable::_sort_by_cluster_keys() {
                                           row_pos_vec.data() + in_block.rows(), &column_offset);
 }
 
-void MemTable::_sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
+void MemTable::_sort_one_column(DorisVector<RowInBlock*>& row_in_blocks, Tie& tie,
                                 std::function<int(RowInBlock*, RowInBlock*)> cmp) {
     auto iter = tie.iter();
     while (iter.next()) {
         pdqsort(std::next(row_in_blocks.begin(), static_cast<int>(iter.left())),
                 std::next(row_in_blocks.begin(), static_cast<int>(iter.right())),
-                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs.get(), rhs.get()) < 0; });
+                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs, rhs) < 0; });
         tie[iter.left()] = 0;
         for (auto i = iter.left() + 1; i < iter.right(); i++) {
-            tie[i] = (cmp(row_in_blocks[i - 1].get(), row_in_blocks[i].get()) == 0);
+            tie[i] = (cmp(row_in_blocks[i - 1], row_in_blocks[i]) == 0);
         }
     }
 }
@@ -459,6 +524,14 @@ void MemTable::_finalize_one_row(RowInBlock* row,
     }
 }
 
+RowInBlock* MemTable::_alloc_row_in_blocks(vectorized::Arena& arena, size_t num_rows) {
+    if (num_rows == 0) {
+        return nullptr;
+    }
+    return reinterpret_cast<RowInBlock*>(
+            arena.aligned_alloc(sizeof(RowInBlock) * num_rows, alignof(RowInBlock)));
+}
+
 void MemTable::_init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block) {
     row->init_agg_places(_arena.aligned_alloc(_total_size_of_aggregate_states, 16),
                          _offsets_of_aggregate_states.data());
@@ -481,6 +554,75 @@ void MemTable::_clear_row_agg(RowInBlock* row) {
     }
 }
 
+// Aggregate the rows with the same keys one row at a time, the sequence column decides
+// whether a row is aggregated into the previous one.
+template <bool is_final>
+void MemTable::_aggregate_by_row(const vectorized::ColumnsWithTypeAndName& block_data,
+                                 vectorized::MutableBlock& mutable_block,
+                                 DorisVector<RowInBlock*>& temp_row_in_blocks) {
+    RowInBlock* prev_row = nullptr;
+    int row_pos = -1;
+    for (RowInBlock* cur_row : *_row_in_blocks) {
+        if (!temp_row_in_blocks.empty() && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
+            if (!prev_row->has_init_agg()) {
+                _init_row_for_agg(prev_row, mutable_block);
+            }
+            _stat.merged_rows++;
+            _aggregate_two_row_in_block<false>(mutable_block, cur_row, prev_row);
+        } else {
+            prev_row = cur_row;
+            if (!temp_row_in_blocks.empty()) {
+                // no more rows to merge for prev row, finalize it
+                _finalize_one_row<is_final>(temp_row_in_blocks.back(), block_data, row_pos);
+            }
+            temp_row_in_blocks.push_back(cur_row);
+            row_pos++;
+        }
+    }
+    if (!temp_row_in_blocks.empty()) {
+        // finalize the last low
+        _finalize_one_row<is_final>(temp_row_in_blocks.back(), block_data, row_pos);
+    }
+}
+
+// Aggregate the rows with the same keys one value column at a time, which calls each
+// aggregate function once for all rows instead of once per row. The rows are added in
+// ascending _row_pos order, which is also the order of the rows with the same key after
+// _sort(), so the results are the same as aggregating row by row.
+template <bool is_final>
+void MemTable::_aggregate_by_column(const vectorized::ColumnsWithTypeAndName& block_data,
+                                    vectorized::MutableBlock& mutable_block,
+                                    DorisVector<RowInBlock*>& temp_row_in_blocks) {
+    // the aggregate states each row is added to, nullptr for the first row of each key
+    DorisVector<vectorized::AggregateDataPtr> places(mutable_block.rows(), nullptr);
+    RowInBlock* prev_row = nullptr;
+    bool has_same_keys = false;
+    for (RowInBlock* cur_row : *_row_in_blocks) {
+        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
+            if (!prev_row->has_init_agg()) {
+                _init_row_for_agg(prev_row, mutable_block);
+            }
+            _stat.merged_rows++;
+            places[cur_row->_row_pos] = prev_row->_agg_mem;
+            has_same_keys = true;
+        } else {
+            prev_row = cur_row;
+            temp_row_in_blocks.push_back(cur_row);
+        }
+    }
+    if (has_same_keys) {
+        for (size_t cid = _tablet_schema->num_key_columns(); cid < _num_columns; ++cid) {
+            const vectorized::IColumn* col_ptr = mutable_block.mutable_columns()[cid].get();
+            _agg_functions[cid]->add_batch_selected(places.size(), places.data(),
+                                                    _offsets_of_aggregate_states[cid], &col_ptr,
+                                                    _arena);
+        }
+    }
+    for (int row_pos = 0; row_pos < temp_row_in_blocks.size(); ++row_pos) {
+        _finalize_one_row<is_final>(temp_row_in_blocks[row_pos], block_data, row_pos);
+    }
+}
+
 template <bool is_final, bool has_skip_bitmap_col>
 void MemTable::_aggregate() {
     SCOPED_RAW_TIMER(&_stat.agg_ns);
@@ -490,35 +632,15 @@ void MemTable::_aggregate() {
             vectorized::MutableBlock::build_mutable_block(&in_block);
     _vec_row_comparator->set_block(&mutable_block);
     auto& block_data = in_block.get_columns_with_type_and_name();
-    DorisVector<std::shared_ptr<RowInBlock>> temp_row_in_blocks;
+    DorisVector<RowInBlock*> temp_row_in_blocks;
     temp_row_in_blocks.reserve(_last_sorted_pos);
     //only init agg if needed
 
     if constexpr (!has_skip_bitmap_col) {
-        RowInBlock* prev_row = nullptr;
-        int row_pos = -1;
-        for (const auto& cur_row_ptr : *_row_in_blocks) {
-            RowInBlock* cur_row = cur_row_ptr.get();
-            if (!temp_row_in_blocks.empty() && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
-                if (!prev_row->has_init_agg()) {
-                    _init_row_for_agg(prev_row, mutable_block);
-                }
-                _stat.merged_rows++;
-                _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row, prev_row);
-            } else {
-                prev_row = cur_row;
-                if (!temp_row_in_blocks.empty()) {
-                    // no more rows to merge for prev row, finalize it
-                    _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data,
-                                                row_pos);
-                }
-                temp_row_in_blocks.push_back(cur_row_ptr);
-                row_pos++;
-            }
-        }
-        if (!temp_row_in_blocks.empty()) {
-            // finalize the last low
-            _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data, row_pos);
+        if (!_tablet_schema->has_sequence_col() || _seq_col_idx_in_block < 0) {
+            _aggregate_by_column<is_final>(block_data, mutable_block, temp_row_in_blocks);
+        } else {
+            _aggregate_by_row<is_final>(block_data, mutable_block, temp_row_in_blocks);
         }
     } else {
         DCHECK(_delete_sign_col_idx != -1);
@@ -538,7 +660,15 @@ void MemTable::_aggregate() {
         _output_mutable_block =
                 vectorized::MutableBlock::build_mutable_block(empty_input_block.get());
         _output_mutable_block.clear_column_data();
-        *_row_in_blocks = temp_row_in_blocks;
+        // copy the remaining rows into a new arena, the rows merged away are released
+        // together with the old one
+        auto row_in_block_arena = std::make_unique<vectorized::Arena>();
+        auto* rows = _alloc_row_in_blocks(*row_in_block_arena, temp_row_in_blocks.size());
+        _row_in_blocks->clear();
+        for (size_t i = 0; i < temp_row_in_blocks.size(); i++) {
+            _row_in_blocks->emplace_back(new (rows + i) RowInBlock(*temp_row_in_blocks[i]));
+        }
+        _row_in_block_arena = std::move(row_in_block_arena);
         _last_sorted_pos = _row_in_blocks->size();
     }
 }
@@ -547,8 +677,8 @@ template <bool is_final>
 void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
         const vectorized::ColumnsWithTypeAndName& block_data,
         vectorized::MutableBlock& mutable_block,
-        DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks) {
-    std::shared_ptr<RowInBlock> prev_row {nullptr};
+        DorisVector<RowInBlock*>& temp_row_in_blocks) {
+    RowInBlock* prev_row {nullptr};
     int row_pos = -1;
     auto& skip_bitmaps = assert_cast<vectorized::ColumnBitmap*>(
                                  mutable_block.mutable_columns()[_skip_bitmap_col_idx].get())
@@ -556,32 +686,31 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
     auto& delete_signs = assert_cast<vectorized::ColumnInt8*>(
                                  mutable_block.mutable_columns()[_delete_sign_col_idx].get())
                                  ->get_data();
-    std::shared_ptr<RowInBlock> row_with_delete_sign {nullptr};
-    std::shared_ptr<RowInBlock> row_without_delete_sign {nullptr};
+    RowInBlock* row_with_delete_sign {nullptr};
+    RowInBlock* row_without_delete_sign {nullptr};
 
     auto finalize_rows = [&]() {
         if (row_with_delete_sign != nullptr) {
             temp_row_in_blocks.push_back(row_with_delete_sign);
-            _finalize_one_row<is_final>(row_with_delete_sign.get(), block_data, ++row_pos);
+            _finalize_one_row<is_final>(row_with_delete_sign, block_data, ++row_pos);
             row_with_delete_sign = nullptr;
         }
         if (row_without_delete_sign != nullptr) {
             temp_row_in_blocks.push_back(row_without_delete_sign);
-            _finalize_one_row<is_final>(row_without_delete_sign.get(), block_data, ++row_pos);
+            _finalize_one_row<is_final>(row_without_delete_sign, block_data, ++row_pos);
             row_without_delete_sign = nullptr;
         }
         // _arena.clear();
     };
 
-    auto add_row = [&](std::shared_ptr<RowInBlock> row, bool with_delete_sign) {
+    auto add_row = [&](RowInBlock* row, bool with_delete_sign) {
         if (with_delete_sign) {
-            row_with_delete_sign = std::move(row);
+            row_with_delete_sign = row;
         } else {
-            row_without_delete_sign = std::move(row);
+            row_without_delete_sign = row;
         }
     };
-    for (const auto& cur_row_ptr : *_row_in_blocks) {
-        RowInBlock* cur_row = cur_row_ptr.get();
+    for (RowInBlock* cur_row : *_row_in_blocks) {
         const BitmapValue& skip_bitmap = skip_bitmaps[cur_row->_row_pos];
         bool cur_row_has_delete_sign = (!skip_bitmap.contains(_delete_sign_col_unique_id) &&
                                         delete_signs[cur_row->_row_pos] != 0);
@@ -589,11 +718,11 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
                 (row_with_delete_sign == nullptr) ? row_without_delete_sign : row_with_delete_sign;
         // compare keys, the keys of row_with_delete_sign and row_without_delete_sign is the same,
         // choose any of them if it's valid
-        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row.get(), cur_row) == 0) {
+        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
             if (cur_row_has_delete_sign) {
                 if (row_without_delete_sign != nullptr) {
                     // if there exits row without delete sign, remove it first
-                    _clear_row_agg(row_without_delete_sign.get());
+                    _clear_row_agg(row_without_delete_sign);
                     _stat.merged_rows++;
                     row_without_delete_sign = nullptr;
                 }
@@ -604,17 +733,17 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
             }
 
             if (prev_row == nullptr) {
-                add_row(cur_row_ptr, cur_row_has_delete_sign);
+                add_row(cur_row, cur_row_has_delete_sign);
             } else {
                 if (!prev_row->has_init_agg()) {
-                    _init_row_for_agg(prev_row.get(), mutable_block);
+                    _init_row_for_agg(prev_row, mutable_block);
                 }
                 _stat.merged_rows++;
-                _aggregate_two_row_in_block<true>(mutable_block, cur_row, prev_row.get());
+                _aggregate_two_row_in_block<true>(mutable_block, cur_row, prev_row);
             }
         } else {
             finalize_rows();
-            add_row(cur_row_ptr, cur_row_has_delete_sign);
+            add_row(cur_row, cur_row_has_delete_sign);
         }
     }
     // finalize the last lows
@@ -625,13 +754,12 @@ template <bool is_final>
 void MemTable::_aggregate_for_flexible_partial_update_with_seq_col(
         const vectorized::ColumnsWithTypeAndName& block_data,
         vectorized::MutableBlock& mutable_block,
-        DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks) {
+        DorisVector<RowInBlock*>& temp_row_in_blocks) {
     // For flexible partial update, when table has sequence column, we don't do any aggregation
     // in memtable. These duplicate rows will be aggregated in VerticalSegmentWriter
     int row_pos = -1;
-    for (const auto& row_ptr : *_row_in_blocks) {
-        RowInBlock* row = row_ptr.get();
-        temp_row_in_blocks.push_back(row_ptr);
+    for (RowInBlock* row : *_row_in_blocks) {
+        temp_row_in_blocks.push_back(row);
         _finalize_one_row<is_final>(row, block_data, ++row_pos);
     }
 }
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "common/status.h"
@@ -69,6 +70,7 @@ struct RowInBlock {
 
     inline void remove_init_agg() { _has_init_agg = false; }
 };
+static_assert(std::is_trivially_destructible_v<RowInBlock>);
 
 class Tie {
 public:
@@ -194,6 +196,8 @@ public:
 
     const MemTableStat& stat() { return _stat; }
 
+    KeysType keys_type() const { return _keys_type; }
+
     std::shared_ptr<ResourceContext> resource_ctx() { return _resource_ctx; }
 
     std::shared_ptr<MemTracker> mem_tracker() { return _mem_tracker; }
@@ -249,29 +253,41 @@ private:
 
     //return number of same keys
     size_t _sort();
+    bool _merge_sorted_runs(bool is_dup, size_t* same_keys_num);
     Status _sort_by_cluster_keys();
-    void _sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
+    void _sort_one_column(DorisVector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(RowInBlock*, RowInBlock*)> cmp);
     template <bool is_final>
     void _finalize_one_row(RowInBlock* row, const vectorized::ColumnsWithTypeAndName& block_data,
                            int row_pos);
+    static RowInBlock* _alloc_row_in_blocks(vectorized::Arena& arena, size_t num_rows);
     void _init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block);
     void _clear_row_agg(RowInBlock* row);
 
     template <bool is_final, bool has_skip_bitmap_col = false>
     void _aggregate();
 
+    template <bool is_final>
+    void _aggregate_by_row(const vectorized::ColumnsWithTypeAndName& block_data,
+                           vectorized::MutableBlock& mutable_block,
+                           DorisVector<RowInBlock*>& temp_row_in_blocks);
+
+    template <bool is_final>
+    void _aggregate_by_column(const vectorized::ColumnsWithTypeAndName& block_data,
+                              vectorized::MutableBlock& mutable_block,
+                              DorisVector<RowInBlock*>& temp_row_in_blocks);
+
     template <bool is_final>
     void _aggregate_for_flexible_partial_update_without_seq_col(
             const vectorized::ColumnsWithTypeAndName& block_data,
             vectorized::MutableBlock& mutable_block,
-            DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks);
+            DorisVector<RowInBlock*>& temp_row_in_blocks);
 
     template <bool is_final>
     void _aggregate_for_flexible_partial_update_with_seq_col(
             const vectorized::ColumnsWithTypeAndName& block_data,
             vectorized::MutableBlock& mutable_block,
-            DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks);
+            DorisVector<RowInBlock*>& temp_row_in_blocks);
 
     Status _put_into_output(vectorized::Block& in_block);
     bool _is_first_insertion;
@@ -280,7 +296,10 @@ private:
     std::vector<vectorized::AggregateFunctionPtr> _agg_functions;
     std::vector<size_t> _offsets_of_aggregate_states;
     size_t _total_size_of_aggregate_states;
-    std::unique_ptr<DorisVector<std::shared_ptr<RowInBlock>>> _row_in_blocks;
+    std::unique_ptr<DorisVector<RowInBlock*>> _row_in_blocks;
+    // the rows of _row_in_blocks are allocated from this arena instead of one heap object
+    // per row, and are released together with it
+    std::unique_ptr<vectorized::Arena> _row_in_block_arena;
 
     size_t _num_columns;
     int32_t _seq_col_idx_in_block {-1};
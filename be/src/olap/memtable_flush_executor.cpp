@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <ostream>
 
+#include "common/cast_set.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/signal_handler.h"
@@ -30,6 +31,7 @@
 #include "olap/rowset/rowset_writer.h"
 #include "olap/storage_engine.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
 #include "util/metrics.h"
@@ -47,10 +49,11 @@ class MemtableFlushTask final : public Runnable {
 
 public:
     MemtableFlushTask(std::shared_ptr<FlushToken> flush_token, std::shared_ptr<MemTable> memtable,
-                      int32_t segment_id, int64_t submit_task_time)
+                      int32_t segment_id, int32_t num_segments, int64_t submit_task_time)
             : _flush_token(flush_token),
               _memtable(memtable),
               _segment_id(segment_id),
+              _num_segments(num_segments),
               _submit_task_time(submit_task_time) {
         g_flush_task_num << 1;
     }
@@ -60,7 +63,7 @@ public:
     void run() override {
         auto token = _flush_token.lock();
         if (token) {
-            token->_flush_memtable(_memtable, _segment_id, _submit_task_time);
+            token->_flush_memtable(_memtable, _segment_id, _num_segments, _submit_task_time);
         } else {
             LOG(WARNING) << "flush token is deconstructed, ignore the flush task";
         }
@@ -70,9 +73,39 @@ private:
     std::weak_ptr<FlushToken> _flush_token;
     std::shared_ptr<MemTable> _memtable;
     int32_t _segment_id;
+    int32_t _num_segments;
     int64_t _submit_task_time;
 };
 
+// The key ranges of a memtable flushed into separate segments concurrently. A range is
+// flushed by whichever thread claims it first, so the flushing thread never waits for a
+// range still queued in the thread pool.
+struct ParallelFlushContext {
+    struct Range {
+        std::unique_ptr<vectorized::Block> block;
+        int32_t segment_id = 0;
+        int64_t flush_size = 0;
+        Status status;
+        std::atomic<bool> claimed {false};
+    };
+
+    explicit ParallelFlushContext(size_t num_ranges)
+            : ranges(num_ranges), latch(static_cast<int>(num_ranges)) {}
+
+    void flush(RowsetWriter* rowset_writer, Range& range) {
+        if (range.claimed.exchange(true)) {
+            return;
+        }
+        range.status = rowset_writer->flush_memtable(range.block.get(), range.segment_id,
+                                                     &range.flush_size);
+        range.block.reset();
+        latch.count_down();
+    }
+
+    std::vector<Range> ranges;
+    CountDownLatch latch;
+};
+
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     os << "(flush time(ms)=" << stat.flush_time_ns / NANOS_PER_MILLIS
        << ", flush wait time(ms)=" << stat.flush_wait_time_ns / NANOS_PER_MILLIS
@@ -99,8 +132,11 @@ Status FlushToken::submit(std::shared_ptr<MemTable> mem_table) {
         return Status::OK();
     }
     int64_t submit_task_time = MonotonicNanos();
+    // the segment ids are allocated here to keep them in the order of the memtables
+    int32_t num_segments = _num_flush_segments(mem_table.get());
     auto task = MemtableFlushTask::create_shared(
-            shared_from_this(), mem_table, _rowset_writer->allocate_segment_id(), submit_task_time);
+            shared_from_this(), mem_table, _rowset_writer->allocate_segment_ids(num_segments),
+            num_segments, submit_task_time);
     // NOTE: we should guarantee WorkloadGroup is not deconstructed when submit memtable flush task.
     // because currently WorkloadGroup's can only be destroyed when all queries in the group is finished,
     // but not consider whether load channel is finish.
@@ -181,7 +217,67 @@ Status FlushToken::_try_reserve_memory(const std::shared_ptr<ResourceContext>& r
     return st;
 }
 
-Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size) {
+int32_t FlushToken::_num_flush_segments(MemTable* memtable) {
+    // the rows of a duplicate key memtable are not merged, so every range is known not empty
+    int64_t max_segments = config::memtable_flush_max_parallel_segments;
+    int64_t min_rows = std::max<int64_t>(config::memtable_flush_min_rows_per_segment, 1);
+    if (max_segments <= 1 || memtable->keys_type() != KeysType::DUP_KEYS) {
+        return 1;
+    }
+    return cast_set<int32_t>(std::clamp<int64_t>(memtable->stat().raw_rows / min_rows, 1,
+                                                 max_segments));
+}
+
+Status FlushToken::_flush_block_in_parallel(MemTable* memtable, vectorized::Block* block,
+                                            int32_t segment_id, int32_t num_segments,
+                                            int64_t* flush_size) {
+    size_t num_rows = block->rows();
+    auto num_ranges = static_cast<size_t>(num_segments);
+    if (num_rows < num_ranges) {
+        return Status::InternalError("can't flush {} rows into {} segments", num_rows,
+                                     num_segments);
+    }
+    // the block is sorted, consecutive segment ids get ascending key ranges
+    auto ctx = std::make_shared<ParallelFlushContext>(num_ranges);
+    for (size_t i = 0; i < num_ranges; ++i) {
+        size_t begin = num_rows * i / num_ranges;
+        size_t end = num_rows * (i + 1) / num_ranges;
+        vectorized::MutableColumns columns;
+        for (const auto& column : block->get_columns()) {
+            columns.push_back(column->cut(begin, end - begin)->assume_mutable());
+        }
+        ctx->ranges[i].block =
+                vectorized::Block::create_unique(block->clone_with_columns(std::move(columns)));
+        ctx->ranges[i].segment_id = segment_id + cast_set<int32_t>(i);
+    }
+    block->clear();
+    auto rowset_writer = _rowset_writer;
+    auto resource_ctx = memtable->resource_ctx();
+    auto mem_tracker = memtable->mem_tracker();
+    for (size_t i = 1; i < num_ranges; ++i) {
+        auto st = _thread_pool->submit_func([ctx, i, rowset_writer, resource_ctx, mem_tracker]() {
+            SCOPED_ATTACH_TASK(resource_ctx);
+            SCOPED_CONSUME_MEM_TRACKER(mem_tracker);
+            ctx->flush(rowset_writer.get(), ctx->ranges[i]);
+        });
+        if (!st.ok()) {
+            ctx->flush(rowset_writer.get(), ctx->ranges[i]);
+        }
+    }
+    for (auto& range : ctx->ranges) {
+        ctx->flush(rowset_writer.get(), range);
+    }
+    ctx->latch.wait();
+    *flush_size = 0;
+    for (auto& range : ctx->ranges) {
+        RETURN_IF_ERROR(range.status);
+        *flush_size += range.flush_size;
+    }
+    return Status::OK();
+}
+
+Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id,
+                                      int32_t num_segments, int64_t* flush_size) {
     VLOG_CRITICAL << "begin to flush memtable for tablet: " << memtable->tablet_id()
                   << ", memsize: " << PrettyPrinter::print_bytes(memtable->memory_usage())
                   << ", rows: " << memtable->stat().raw_rows;
@@ -207,7 +303,12 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
         }};
         std::unique_ptr<vectorized::Block> block;
         RETURN_IF_ERROR(memtable->to_block(&block));
-        RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        if (num_segments > 1) {
+            RETURN_IF_ERROR(_flush_block_in_parallel(memtable, block.get(), segment_id,
+                                                     num_segments, flush_size));
+        } else {
+            RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        }
         memtable->set_flush_success();
     }
     _memtable_stat += memtable->stat();
@@ -219,7 +320,7 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
 }
 
 void FlushToken::_flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t segment_id,
-                                 int64_t submit_task_time) {
+                                 int32_t num_segments, int64_t submit_task_time) {
     signal::set_signal_task_id(_rowset_writer->load_id());
     signal::tablet_id = memtable_ptr->tablet_id();
     Defer defer {[&]() {
@@ -262,7 +363,7 @@ void FlushToken::_flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t
     size_t memory_usage = memtable_ptr->memory_usage();
 
     int64_t flush_size;
-    Status s = _do_flush_memtable(memtable_ptr.get(), segment_id, &flush_size);
+    Status s = _do_flush_memtable(memtable_ptr.get(), segment_id, num_segments, &flush_size);
 
     {
         std::shared_lock rdlk(_flush_status_lock);
@@ -92,9 +92,17 @@ private:
     friend class MemtableFlushTask;
 
     void _flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t segment_id,
-                         int64_t submit_task_time);
+                         int32_t num_segments, int64_t submit_task_time);
 
-    Status _do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size);
+    // The number of segments the memtable is flushed into, each holding a key range.
+    int32_t _num_flush_segments(MemTable* memtable);
+
+    Status _do_flush_memtable(MemTable* memtable, int32_t segment_id, int32_t num_segments,
+                              int64_t* flush_size);
+
+    Status _flush_block_in_parallel(MemTable* memtable, vectorized::Block* block,
+                                    int32_t segment_id, int32_t num_segments,
+                                    int64_t* flush_size);
 
     Status _try_reserve_memory(const std::shared_ptr<ResourceContext>& resource_context,
                                int64_t size);
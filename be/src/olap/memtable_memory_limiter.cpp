@@ -19,6 +19,12 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "common/cast_set.h"
 #include "common/config.h"
 #include "olap/memtable.h"
 #include "olap/memtable_writer.h"
@@ -196,23 +202,32 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(int64_t need_flush) {
         return 0;
     }
 
-    using WriterMem = std::pair<std::weak_ptr<MemTableWriter>, int64_t>;
-    auto cmp = [](WriterMem left, WriterMem right) { return left.second < right.second; };
+    auto cmp = [](const WriterMem& left, const WriterMem& right) {
+        return std::tie(left.over_share, left.mem) < std::tie(right.over_share, right.mem);
+    };
     std::priority_queue<WriterMem, std::vector<WriterMem>, decltype(cmp)> heap(cmp);
 
+    std::vector<WriterMem> writer_mems;
     for (auto writer : _active_writers) {
         auto w = writer.lock();
         if (w == nullptr) {
             continue;
         }
-        heap.emplace(w, w->active_memtable_mem_consumption());
+        writer_mems.push_back({w, w->active_memtable_mem_consumption(), false});
+    }
+    if (config::enable_memtable_limiter_fair_share) {
+        _mark_over_share_writers(writer_mems);
+    }
+    for (auto& writer_mem : writer_mems) {
+        heap.push(std::move(writer_mem));
     }
 
     int64_t mem_flushed = 0;
     int64_t num_flushed = 0;
 
     while (mem_flushed < need_flush && !heap.empty()) {
-        auto [writer, sort_mem] = heap.top();
+        auto writer = heap.top().writer;
+        auto sort_mem = heap.top().mem;
         heap.pop();
         auto w = writer.lock();
         if (w == nullptr) {
@@ -243,6 +258,58 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(int64_t need_flush) {
     return mem_flushed;
 }
 
+void MemTableMemoryLimiter::_mark_over_share_writers(std::vector<WriterMem>& writer_mems) {
+    // The active memory is shared equally by the workload groups, and the share of a group is
+    // shared equally by its loads. A group using less than its share leaves the rest to the
+    // others, so the loads of a busy group are not flushed only because there are other groups.
+    using LoadKey = std::pair<int64_t, int64_t>;
+    std::map<uint64_t, std::map<LoadKey, int64_t>> group_loads;
+    int64_t total_mem = 0;
+    for (const auto& writer_mem : writer_mems) {
+        auto w = writer_mem.writer.lock();
+        if (w == nullptr) {
+            continue;
+        }
+        LoadKey load {w->load_id().hi(), w->load_id().lo()};
+        group_loads[w->workload_group_id()][load] += writer_mem.mem;
+        total_mem += writer_mem.mem;
+    }
+    if (group_loads.empty()) {
+        return;
+    }
+    std::map<uint64_t, int64_t> group_mems;
+    for (const auto& [group_id, loads] : group_loads) {
+        for (const auto& [load, mem] : loads) {
+            group_mems[group_id] += mem;
+        }
+    }
+    // give the unused share of the small groups to the others
+    int64_t remaining_mem = total_mem;
+    auto remaining_groups = cast_set<int64_t>(group_mems.size());
+    std::vector<std::pair<int64_t, uint64_t>> groups_by_mem;
+    for (const auto& [group_id, mem] : group_mems) {
+        groups_by_mem.emplace_back(mem, group_id);
+    }
+    std::sort(groups_by_mem.begin(), groups_by_mem.end());
+    std::map<uint64_t, int64_t> group_shares;
+    for (const auto& [mem, group_id] : groups_by_mem) {
+        int64_t share = std::min<int64_t>(mem, remaining_mem / remaining_groups);
+        group_shares[group_id] = share;
+        remaining_mem -= share;
+        remaining_groups--;
+    }
+    for (auto& writer_mem : writer_mems) {
+        auto w = writer_mem.writer.lock();
+        if (w == nullptr) {
+            continue;
+        }
+        const auto& loads = group_loads[w->workload_group_id()];
+        int64_t load_share = group_shares[w->workload_group_id()] / cast_set<int64_t>(loads.size());
+        LoadKey load {w->load_id().hi(), w->load_id().lo()};
+        writer_mem.over_share = loads.at(load) > load_share;
+    }
+}
+
 void MemTableMemoryLimiter::refresh_mem_tracker() {
     std::lock_guard<std::mutex> l(_lock);
     _refresh_mem_tracker();
@@ -20,6 +20,8 @@
 #include <stdint.h>
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "runtime/memory/mem_tracker.h"
@@ -62,7 +64,15 @@ private:
     bool _hard_limit_reached();
     bool _load_usage_low();
     int64_t _need_flush();
+    struct WriterMem {
+        std::weak_ptr<MemTableWriter> writer;
+        int64_t mem;
+        // whether the load of the writer uses more than its fair share of the memory
+        bool over_share;
+    };
+
     int64_t _flush_active_memtables(int64_t need_flush);
+    void _mark_over_share_writers(std::vector<WriterMem>& writer_mems);
     void _refresh_mem_tracker();
     std::mutex _lock;
     std::condition_variable _hard_limit_end_cond;
@@ -94,6 +94,8 @@ public:
 
     int64_t tablet_id() const { return _req.tablet_id; }
 
+    const PUniqueId& load_id() const { return _req.load_id; }
+
     int64_t total_received_rows() const { return _total_received_rows; }
 
     const FlushStatistic& get_flush_token_stats();
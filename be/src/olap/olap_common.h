@@ -335,12 +335,15 @@ struct OlapReaderStatistics {
     int64_t vec_cond_ns = 0;
     int64_t short_cond_ns = 0;
     int64_t expr_filter_ns = 0;
+    // times the order of the predicates is changed by the measured cost and selectivity
+    int64_t predicate_reorder_num = 0;
     int64_t output_col_ns = 0;
     int64_t rows_key_range_filtered = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_stats_rp_filtered = 0;
     int64_t rows_bf_filtered = 0;
     int64_t segment_dict_filtered = 0;
+    int64_t rows_encoded_page_filtered = 0;
     // Including the number of rows filtered out according to the Delete information in the Tablet,
     // and the number of rows filtered for marked deleted rows under the unique key model.
     // This metric is mainly used to record the number of rows filtered by the delete condition in Segment V1,
@@ -355,11 +358,14 @@ struct OlapReaderStatistics {
     int64_t generate_row_ranges_by_bf_ns = 0;
     int64_t generate_row_ranges_by_zonemap_ns = 0;
     int64_t generate_row_ranges_by_dict_ns = 0;
+    int64_t generate_row_ranges_by_encoded_pages_ns = 0;
 
     int64_t index_load_ns = 0;
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // pages decompressed from the compressed page cache tier without IO
+    int64_t cached_compressed_pages_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
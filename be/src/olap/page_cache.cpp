@@ -23,6 +23,7 @@
 #include <ostream>
 
 #include "runtime/exec_env.h"
+#include "util/hot_path_metrics.h"
 
 namespace doris {
 
@@ -74,32 +75,46 @@ MemoryTrackedPageWithPagePtr<T>::~MemoryTrackedPageWithPagePtr() {
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int32_t compressed_cache_percentage) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, compressed_cache_percentage);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int32_t compressed_cache_percentage)
         : _index_cache_percentage(index_cache_percentage) {
+    CHECK(compressed_cache_percentage >= 0 && compressed_cache_percentage < 100)
+            << "invalid compressed page cache percentage";
+    size_t data_capacity = 0;
     if (index_cache_percentage == 0) {
-        _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
+        data_capacity = capacity;
     } else if (index_cache_percentage == 100) {
         _index_page_cache = std::make_unique<IndexPageCache>(capacity, num_shards);
     } else if (index_cache_percentage > 0 && index_cache_percentage < 100) {
-        _data_page_cache = std::make_unique<DataPageCache>(
-                capacity * (100 - index_cache_percentage) / 100, num_shards);
+        data_capacity = capacity * (100 - index_cache_percentage) / 100;
         _index_page_cache = std::make_unique<IndexPageCache>(
                 capacity * index_cache_percentage / 100, num_shards);
     } else {
         CHECK(false) << "invalid index page cache percentage";
     }
+    if (index_cache_percentage != 100) {
+        size_t compressed_capacity = data_capacity * compressed_cache_percentage / 100;
+        if (compressed_capacity > 0) {
+            _compressed_data_page_cache =
+                    std::make_unique<CompressedDataPageCache>(compressed_capacity, num_shards);
+        }
+        _data_page_cache =
+                std::make_unique<DataPageCache>(data_capacity - compressed_capacity, num_shards);
+    }
 
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
 }
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type) {
+    ScopedHotPathLatency latency(HotPath::PAGE_CACHE_LOOKUP);
     auto* cache = _get_page_cache(page_type);
     auto* lru_handle = cache->lookup(key.encode());
     if (lru_handle == nullptr) {
@@ -122,6 +137,49 @@ void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHand
     *handle = PageCacheHandle(cache, lru_handle);
 }
 
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle,
+                                         segment_v2::PageTypePB page_type) {
+    if (!has_compressed_tier(page_type)) {
+        return false;
+    }
+    auto* lru_handle = _compressed_data_page_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_data_page_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, DataPage* data,
+                                         segment_v2::PageTypePB page_type) {
+    DCHECK(has_compressed_tier(page_type));
+    auto* lru_handle =
+            _compressed_data_page_cache->insert(key.encode(), data, data->capacity(), 0);
+    DCHECK(lru_handle != nullptr);
+    _compressed_data_page_cache->release(lru_handle);
+}
+
+bool StoragePageCache::begin_load(const CacheKey& key) {
+    std::string encoded_key = key.encode();
+    auto& shard = _loading_shard(encoded_key);
+    std::unique_lock l(shard.lock);
+    if (shard.keys.insert(encoded_key).second) {
+        return true;
+    }
+    shard.cv.wait(l, [&]() { return !shard.keys.contains(encoded_key); });
+    return false;
+}
+
+void StoragePageCache::finish_load(const CacheKey& key) {
+    std::string encoded_key = key.encode();
+    auto& shard = _loading_shard(encoded_key);
+    {
+        std::lock_guard l(shard.lock);
+        shard.keys.erase(encoded_key);
+    }
+    shard.cv.notify_all();
+}
+
 template <typename T>
 void StoragePageCache::insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type, bool in_memory) {
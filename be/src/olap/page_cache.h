@@ -22,8 +22,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "olap/lru_cache.h"
@@ -118,8 +122,10 @@ public:
         DataPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::DATA_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
-                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true, true) {
-        }
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU_K) {}
     };
 
     class IndexPageCache : public LRUCachePolicy {
@@ -127,7 +133,10 @@ public:
         IndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::INDEXPAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::index_page_cache_stale_sweep_time_sec,
-                                 num_shards) {}
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU) {}
     };
 
     class PKIndexPageCache : public LRUCachePolicy {
@@ -135,7 +144,23 @@ public:
         PKIndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::PK_INDEX_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE,
-                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {}
+                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards,
+                                 DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU) {}
+    };
+
+    // Keeps the data pages as read from the file, before decompression.
+    class CompressedDataPageCache : public LRUCachePolicy {
+    public:
+        CompressedDataPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::COMPRESSED_DATA_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU) {}
     };
 
     static constexpr uint32_t kDefaultNumShards = 16;
@@ -143,14 +168,18 @@ public:
     // Create global instance of this class
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int32_t compressed_cache_percentage = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
+    // `compressed_cache_percentage` of the data page cache capacity is given to the tier of
+    // the compressed data pages.
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int32_t compressed_cache_percentage = 0);
 
     // Lookup the given page in the cache.
     //
@@ -182,6 +211,28 @@ public:
     void insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                 segment_v2::PageTypePB page_type, bool in_memory = false);
 
+    // Whether the pages of page_type are also cached before decompression.
+    bool has_compressed_tier(segment_v2::PageTypePB page_type) const {
+        return page_type == segment_v2::DATA_PAGE && _compressed_data_page_cache != nullptr;
+    }
+
+    // Lookup the given page in the compressed tier, the entry is the page as read from the
+    // file without its checksum. Return true if entry is found, otherwise return false.
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle,
+                           segment_v2::PageTypePB page_type);
+
+    // Insert a page before decompression into the compressed tier, which takes the ownership
+    // of data. has_compressed_tier(page_type) must be true.
+    void insert_compressed(const CacheKey& key, DataPage* data, segment_v2::PageTypePB page_type);
+
+    // Announce that the caller is about to read the missing page of key and insert it. Return
+    // true if the caller should load it, and must call finish_load() once done. Return false
+    // after waiting for another thread that was already loading the same page, the caller
+    // should then look the page up again. This keeps concurrent scans of the same hot pages
+    // from reading and decompressing each page once per scan.
+    bool begin_load(const CacheKey& key);
+    void finish_load(const CacheKey& key);
+
     std::shared_ptr<MemTrackerLimiter> mem_tracker(segment_v2::PageTypePB page_type) {
         return _get_page_cache(page_type)->mem_tracker();
     }
@@ -196,6 +247,21 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
+    // The compressed tier of the data page cache, a miss of _data_page_cache found here is
+    // decompressed without IO. nullptr if disabled.
+    std::unique_ptr<CompressedDataPageCache> _compressed_data_page_cache;
+
+    // Keys of the pages being loaded by begin_load() callers.
+    struct LoadingShard {
+        std::mutex lock;
+        std::condition_variable cv;
+        std::unordered_set<std::string> keys;
+    };
+    std::array<LoadingShard, kDefaultNumShards> _loading_shards;
+
+    LoadingShard& _loading_shard(const std::string& encoded_key) {
+        return _loading_shards[std::hash<std::string> {}(encoded_key) % kDefaultNumShards];
+    }
 
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
@@ -343,15 +343,13 @@ Status FixedReadPlan::read_columns_by_plan(
                 }
                 continue;
             }
-            for (size_t cid = 0; cid < mutable_columns.size(); ++cid) {
-                TabletColumn tablet_column = tablet_schema.column(cids_to_read[cid]);
-                auto st = doris::BaseTablet::fetch_value_by_rowids(
-                        rowset_iter->second, segment_id, rids, tablet_column, mutable_columns[cid]);
-                // set read value to output block
-                if (!st.ok()) {
-                    LOG(WARNING) << "failed to fetch value";
-                    return st;
-                }
+            auto st = doris::BaseTablet::fetch_values_by_rowids(
+                    rowset_iter->second, segment_id, rids, tablet_schema, cids_to_read,
+                    mutable_columns);
+            // set read value to output block
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to fetch value";
+                return st;
             }
         }
     }
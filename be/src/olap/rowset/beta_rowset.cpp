@@ -38,6 +38,7 @@
 #include "io/fs/remote_file_system.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
+#include "olap/primary_key_index.h"
 #include "olap/rowset/beta_rowset_reader.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/segment_v2/index_file_reader.h"
@@ -49,6 +50,7 @@
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "vec/data_types/data_type_factory.hpp"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -93,6 +95,68 @@ Status BetaRowset::get_segment_num_rows(std::vector<uint32_t>* segment_rows) {
     return Status::OK();
 }
 
+const RowsetKeyFilter* BetaRowset::get_key_filter() {
+    int64_t segment_count = num_segments();
+    if (config::rowset_key_filter_min_segments <= 0 ||
+        segment_count < config::rowset_key_filter_min_segments ||
+        segment_count > RowsetKeyFilter::MAX_SEGMENTS ||
+        num_rows() > config::rowset_key_filter_max_rows) {
+        return nullptr;
+    }
+    if (!_build_key_filter_once.call([this] { return _build_key_filter(); }).ok()) {
+        return nullptr;
+    }
+    return _key_filter.get();
+}
+
+Status BetaRowset::_build_key_filter() {
+    SegmentCacheHandle segment_cache_handle;
+    RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
+            std::static_pointer_cast<BetaRowset>(shared_from_this()), &segment_cache_handle,
+            true, true));
+    // the filter is looked up with the keys without sequence column and row id
+    size_t suffix_length = 0;
+    if (_schema->has_sequence_col()) {
+        suffix_length += _schema->column(_schema->sequence_col_idx()).length() + 1;
+    }
+    if (!_schema->cluster_key_uids().empty()) {
+        suffix_length += PrimaryKeyIndexReader::ROW_ID_LENGTH;
+    }
+    auto filter = std::make_unique<RowsetKeyFilter>(cast_set<size_t>(num_rows()));
+    for (const auto& segment : segment_cache_handle.get_segments()) {
+        const auto* pk_index = segment->get_primary_key_index();
+        DCHECK(pk_index != nullptr);
+        std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
+        RETURN_IF_ERROR(pk_index->new_iterator(&iter, nullptr));
+        auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+                pk_index->type_info()->type(), 1, 0);
+        size_t total = pk_index->num_rows();
+        size_t ordinal = 0;
+        while (ordinal < total) {
+            auto index_column = index_type->create_column();
+            size_t num_read = std::min<size_t>(1024, total - ordinal);
+            RETURN_IF_ERROR(iter->seek_to_ordinal(ordinal));
+            RETURN_IF_ERROR(iter->next_batch(&num_read, index_column));
+            if (num_read == 0) {
+                return Status::InternalError("read no primary key at {} of segment {}", ordinal,
+                                             segment->id());
+            }
+            for (size_t i = 0; i < num_read; ++i) {
+                auto key = index_column->get_data_at(i);
+                DCHECK_GE(key.size, suffix_length);
+                if (!filter->insert(Slice(key.data, key.size - suffix_length), segment->id())) {
+                    LOG(WARNING) << "key filter is full, rowset_id=" << rowset_id().to_string()
+                                 << ", num_rows=" << num_rows();
+                    return Status::InternalError("key filter is full");
+                }
+            }
+            ordinal += num_read;
+        }
+    }
+    _key_filter = std::move(filter);
+    return Status::OK();
+}
+
 Status BetaRowset::get_inverted_index_size(int64_t* index_size) {
     const auto& fs = _rowset_meta->fs();
     if (!fs) {
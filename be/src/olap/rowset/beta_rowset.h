@@ -28,6 +28,7 @@
 #include "common/status.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/rowset.h"
+#include "olap/rowset/rowset_key_filter.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/rowset/rowset_reader.h"
 #include "olap/rowset/segment_v2/segment.h"
@@ -93,6 +94,11 @@ public:
 
     Status get_segment_num_rows(std::vector<uint32_t>* segment_rows);
 
+    // Return the filter mapping a primary key to the segments which may contain it, built on
+    // the first call. Return nullptr when the filter is disabled or can't be built for this
+    // rowset, every segment should be checked then.
+    const RowsetKeyFilter* get_key_filter();
+
 protected:
     BetaRowset(const TabletSchemaSPtr& schema, const RowsetMetaSharedPtr& rowset_meta,
                std::string tablet_path);
@@ -112,6 +118,11 @@ private:
 
     DorisCallOnce<Status> _load_segment_rows_once;
     std::vector<uint32_t> _segments_rows;
+
+    Status _build_key_filter();
+
+    DorisCallOnce<Status> _build_key_filter_once;
+    std::unique_ptr<RowsetKeyFilter> _key_filter;
 };
 
 } // namespace doris
@@ -168,6 +168,10 @@ public:
 
     int32_t allocate_segment_id() override { return _segment_creator.allocate_segment_id(); };
 
+    int32_t allocate_segment_ids(int32_t num) override {
+        return _segment_creator.allocate_segment_ids(num);
+    }
+
     void set_segment_start_id(int32_t start_id) override {
         _segment_creator.set_segment_start_id(start_id);
         _segment_start_id = start_id;
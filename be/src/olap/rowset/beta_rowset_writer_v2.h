@@ -116,6 +116,10 @@ public:
 
     int32_t allocate_segment_id() override { return _segment_creator.allocate_segment_id(); };
 
+    int32_t allocate_segment_ids(int32_t num) override {
+        return _segment_creator.allocate_segment_ids(num);
+    }
+
     int32_t next_segment_id() { return _segment_creator.next_segment_id(); };
 
     int64_t delete_bitmap_ns() override { return _delete_bitmap_ns; }
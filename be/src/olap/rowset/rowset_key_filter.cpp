@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/rowset_key_filter.h"
+
+#include <utility>
+
+#include "util/hash_util.hpp"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+RowsetKeyFilter::RowsetKeyFilter(size_t num_keys) {
+    // keep the load factor under 90%
+    size_t num_buckets = 1;
+    while (num_buckets * SLOTS_PER_BUCKET * 9 < num_keys * 10) {
+        num_buckets <<= 1;
+    }
+    _bucket_mask = num_buckets - 1;
+    _slots.resize(num_buckets * SLOTS_PER_BUCKET, 0);
+}
+
+bool RowsetKeyFilter::_insert_to_bucket(size_t bucket, uint32_t slot) {
+    uint32_t* slots = &_slots[bucket * SLOTS_PER_BUCKET];
+    for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i) {
+        if (slots[i] == 0) {
+            slots[i] = slot;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RowsetKeyFilter::insert(const Slice& key, uint32_t segment_id) {
+    DCHECK_LT(segment_id, MAX_SEGMENTS);
+    uint64_t hash = HashUtil::hash64(key.data, key.size, 0);
+    uint16_t fp = _fingerprint(hash);
+    size_t bucket = hash & _bucket_mask;
+    uint32_t slot = (static_cast<uint32_t>(fp) << 16) | segment_id;
+    if (_insert_to_bucket(bucket, slot) || _insert_to_bucket(_alt_bucket(bucket, fp), slot)) {
+        return true;
+    }
+    // kick out a random slot to its alternate bucket
+    for (int kick = 0; kick < MAX_KICKS; ++kick) {
+        _kick_seed = _kick_seed * 1103515245 + 12345;
+        size_t victim_pos = bucket * SLOTS_PER_BUCKET + (_kick_seed >> 16) % SLOTS_PER_BUCKET;
+        uint32_t& victim = _slots[victim_pos];
+        std::swap(victim, slot);
+        bucket = _alt_bucket(bucket, static_cast<uint16_t>(slot >> 16));
+        if (_insert_to_bucket(bucket, slot)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RowsetKeyFilter::lookup(const Slice& key, std::vector<uint32_t>* segment_ids) const {
+    uint64_t hash = HashUtil::hash64(key.data, key.size, 0);
+    uint16_t fp = _fingerprint(hash);
+    size_t bucket = hash & _bucket_mask;
+    auto lookup_bucket = [&](size_t b) {
+        const uint32_t* slots = &_slots[b * SLOTS_PER_BUCKET];
+        for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i) {
+            if ((slots[i] >> 16) == fp) {
+                segment_ids->push_back(slots[i] & 0xffff);
+            }
+        }
+    };
+    lookup_bucket(bucket);
+    size_t alt_bucket = _alt_bucket(bucket, fp);
+    if (alt_bucket != bucket) {
+        lookup_bucket(alt_bucket);
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/slice.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// A cuckoo filter over the primary keys of all segments in a rowset, which stores the id of
+// the segment containing the key next to the fingerprint. A lookup returns the few segments
+// that may contain the key instead of checking the bloom filter of every segment.
+//
+// Every slot is 32 bits: the 16-bit fingerprint of the key (never 0) and the 16-bit segment
+// id, 0 means an empty slot. A bucket has 4 slots and every key has 2 candidate buckets, so
+// a lookup returns a false positive segment with a probability of about 8 / 2^16.
+// There are no false negatives, the filter is unusable once an insert fails.
+class RowsetKeyFilter {
+public:
+    static constexpr uint32_t MAX_SEGMENTS = 1 << 16;
+
+    explicit RowsetKeyFilter(size_t num_keys);
+
+    // Return false when the filter is too full, it must not be used after that.
+    bool insert(const Slice& key, uint32_t segment_id);
+
+    // Append the ids of the segments which may contain `key` to `segment_ids`.
+    void lookup(const Slice& key, std::vector<uint32_t>* segment_ids) const;
+
+    size_t size_bytes() const { return _slots.size() * sizeof(uint32_t); }
+
+private:
+    static constexpr size_t SLOTS_PER_BUCKET = 4;
+    static constexpr int MAX_KICKS = 500;
+
+    static uint16_t _fingerprint(uint64_t hash) {
+        auto fp = static_cast<uint16_t>(hash >> 48);
+        return fp == 0 ? 1 : fp;
+    }
+    size_t _alt_bucket(size_t bucket, uint16_t fp) const {
+        return (bucket ^ (static_cast<size_t>(fp) * 0x5bd1e995)) & _bucket_mask;
+    }
+    bool _insert_to_bucket(size_t bucket, uint32_t slot);
+
+    size_t _bucket_mask = 0;
+    std::vector<uint32_t> _slots;
+    uint32_t _kick_seed = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -174,6 +174,9 @@ public:
 
     virtual int32_t allocate_segment_id() = 0;
 
+    // Allocate `num` consecutive segment ids, return the first one.
+    virtual int32_t allocate_segment_ids(int32_t num) = 0;
+
     virtual void set_segment_start_id(int num_segment) {
         throw Exception(Status::FatalError("not supported!"));
     }
@@ -185,6 +185,8 @@ public:
 
     int32_t allocate_segment_id() { return _next_segment_id.fetch_add(1); }
 
+    int32_t allocate_segment_ids(int32_t num) { return _next_segment_id.fetch_add(num); }
+
     int32_t next_segment_id() const { return _next_segment_id.load(); }
 
     int64_t num_rows_written() const { return _segment_flusher.num_rows_written(); }
@@ -0,0 +1,519 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "common/cast_set.h"
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+enum { ALP_PAGE_HEADER_SIZE = 20 };
+
+// ALP (adaptive lossless floating-point) encodes the floats of a page as decimals:
+// a value v is stored as the integer n = round(v * 10^e * 10^-f), and decoded as
+// n * 10^f * 10^-e. The exponent e and the factor f are chosen per page from a sample.
+// The values which do not survive the round trip (NaN, inf, -0.0, too many significant
+// digits...) are stored as exceptions.
+//
+// The page format is as follows:
+//
+// 1. Header: (20 bytes total)
+//
+//    <num_elements> [32-bit]
+//    <exponent> [8-bit] <factor> [8-bit] <bit_width> [8-bit] <reserved> [8-bit]
+//    <num_exceptions> [32-bit]
+//    <base> [64-bit]
+//      The minimum of the encoded integers, they are stored as the offset to it.
+//
+// 2. The offsets of the encoded integers, bit-packed with <bit_width>.
+//
+// 3. The positions of the exceptions [32-bit each], in ascending order.
+//
+// 4. The exception values, in their original representation.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+// Any value can be decoded on its own, the decoder unpacks the group of 32 values
+// containing it and patches the exceptions, so the seek is O(1).
+template <typename T>
+struct AlpConstants {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+    // Beyond them the decimals can not be represented by the type anyway.
+    static constexpr uint8_t MAX_EXPONENT = std::is_same_v<T, float> ? 10 : 18;
+    static constexpr size_t SAMPLE_SIZE = 256;
+    // Rounds to nearest with the FPU, valid for |x| < 2^51.
+    static constexpr double MAGIC_NUMBER = 6755399441055744.0;
+    static constexpr double ENCODING_LIMIT = 2251799813685248.0;
+
+    static constexpr double EXP10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                       1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                       1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC10[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                        1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                        1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+
+    // Return false if `value` can not be encoded with `exponent` and `factor`.
+    static bool encode(T value, uint8_t exponent, uint8_t factor, int64_t* encoded) {
+        const double scaled = static_cast<double>(value) * EXP10[exponent] * FRAC10[factor];
+        // Also false for NaN.
+        if (!(std::abs(scaled) < ENCODING_LIMIT)) {
+            return false;
+        }
+        const auto n = static_cast<int64_t>(scaled + MAGIC_NUMBER - MAGIC_NUMBER);
+        const T decoded = decode(n, exponent, factor);
+        // Compare the bits, -0.0 == 0.0 but -0.0 must be an exception.
+        if (memcmp(&decoded, &value, sizeof(T)) != 0) {
+            return false;
+        }
+        *encoded = n;
+        return true;
+    }
+
+    static T decode(int64_t encoded, uint8_t exponent, uint8_t factor) {
+        return static_cast<T>(static_cast<double>(encoded) * EXP10[factor] * FRAC10[exponent]);
+    }
+};
+
+inline uint8_t alp_bit_width(uint64_t range) {
+    return range == 0 ? 0 : static_cast<uint8_t>(64 - __builtin_clzll(range));
+}
+
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilderHelper<AlpPageBuilder<Type>> {
+public:
+    using Self = AlpPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _remain_element_capacity == 0; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        if (_remain_element_capacity == 0) {
+            *count = 0;
+            return Status::OK();
+        }
+        uint32_t to_add =
+                cast_set<uint32_t>(std::min(cast_set<size_t>(_remain_element_capacity), *count));
+        size_t orig_size = _data.size();
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION(_data.resize(orig_size + to_add * SIZE_OF_TYPE));
+        memcpy(&_data[orig_size], vals, to_add * SIZE_OF_TYPE);
+        _count += to_add;
+        _remain_element_capacity -= to_add;
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        if (_count > 0) {
+            _first_value = cell(0);
+            _last_value = cell(_count - 1);
+        }
+        RETURN_IF_CATCH_EXCEPTION({ *slice = _finish(); });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _count = 0;
+            _data.clear();
+            _data.reserve(_options.data_page_size);
+            _buffer.clear();
+            _finished = false;
+            _remain_element_capacity =
+                    cast_set<uint32_t>(std::max<size_t>(_options.data_page_size / SIZE_OF_TYPE, 1));
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _count; }
+
+    uint64_t size() const override { return _finished ? _buffer.size() : _data.size(); }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_count == 0) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_first_value, SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_count == 0) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_last_value, SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Constants = AlpConstants<CppType>;
+
+    AlpPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    CppType cell(size_t idx) const {
+        CppType ret;
+        memcpy(&ret, &_data[idx * SIZE_OF_TYPE], SIZE_OF_TYPE);
+        return ret;
+    }
+
+    // Pick the exponent and factor giving the smallest page for a sample of the values.
+    void _choose_exponent_and_factor(uint8_t* best_exponent, uint8_t* best_factor) const {
+        *best_exponent = 0;
+        *best_factor = 0;
+        if (_count == 0) {
+            return;
+        }
+        const size_t step = std::max<size_t>(_count / Constants::SAMPLE_SIZE, 1);
+        uint64_t best_size = std::numeric_limits<uint64_t>::max();
+        for (uint8_t exponent = Constants::MAX_EXPONENT;; --exponent) {
+            for (uint8_t factor = 0; factor <= exponent; ++factor) {
+                int64_t min_value = std::numeric_limits<int64_t>::max();
+                int64_t max_value = std::numeric_limits<int64_t>::min();
+                uint64_t num_sampled = 0;
+                uint64_t num_exceptions = 0;
+                for (size_t i = 0; i < _count; i += step, ++num_sampled) {
+                    int64_t encoded;
+                    if (Constants::encode(cell(i), exponent, factor, &encoded)) {
+                        min_value = std::min(min_value, encoded);
+                        max_value = std::max(max_value, encoded);
+                    } else {
+                        ++num_exceptions;
+                    }
+                }
+                uint64_t size = num_exceptions * (sizeof(uint32_t) + SIZE_OF_TYPE) * 8;
+                if (num_exceptions < num_sampled) {
+                    size += alp_bit_width(static_cast<uint64_t>(max_value) -
+                                          static_cast<uint64_t>(min_value)) *
+                            num_sampled;
+                }
+                // Prefer the bigger exponent and smaller factor when the sizes are equal,
+                // they are tried first.
+                if (size < best_size) {
+                    best_size = size;
+                    *best_exponent = exponent;
+                    *best_factor = factor;
+                }
+            }
+            if (exponent == 0) {
+                break;
+            }
+        }
+    }
+
+    OwnedSlice _finish() {
+        uint8_t exponent;
+        uint8_t factor;
+        _choose_exponent_and_factor(&exponent, &factor);
+
+        std::vector<int64_t> encoded(_count);
+        std::vector<uint32_t> exception_positions;
+        faststring exception_values;
+        int64_t min_value = std::numeric_limits<int64_t>::max();
+        int64_t max_value = std::numeric_limits<int64_t>::min();
+        for (uint32_t i = 0; i < _count; ++i) {
+            if (Constants::encode(cell(i), exponent, factor, &encoded[i])) {
+                min_value = std::min(min_value, encoded[i]);
+                max_value = std::max(max_value, encoded[i]);
+            } else {
+                exception_positions.push_back(i);
+                exception_values.append(&_data[i * SIZE_OF_TYPE], SIZE_OF_TYPE);
+            }
+        }
+        if (exception_positions.size() == _count) {
+            min_value = max_value = 0;
+        }
+        // The exceptions take the base in the packed data, so they do not widen it.
+        for (auto pos : exception_positions) {
+            encoded[pos] = min_value;
+        }
+        const uint8_t bit_width = alp_bit_width(static_cast<uint64_t>(max_value) -
+                                                static_cast<uint64_t>(min_value));
+
+        faststring packed;
+        if (bit_width > 0) {
+            BitWriter writer(&packed);
+            for (auto value : encoded) {
+                writer.PutValue(static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value),
+                                bit_width);
+            }
+            writer.Flush();
+        }
+
+        _buffer.resize(ALP_PAGE_HEADER_SIZE);
+        encode_fixed32_le(&_buffer[0], _count);
+        _buffer[4] = exponent;
+        _buffer[5] = factor;
+        _buffer[6] = bit_width;
+        _buffer[7] = 0;
+        encode_fixed32_le(&_buffer[8], cast_set<uint32_t>(exception_positions.size()));
+        encode_fixed64_le(&_buffer[12], static_cast<uint64_t>(min_value));
+        _buffer.append(packed.data(), packed.size());
+        for (auto pos : exception_positions) {
+            put_fixed32_le(&_buffer, pos);
+        }
+        _buffer.append(exception_values.data(), exception_values.size());
+        _finished = true;
+        return _buffer.build();
+    }
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    PageBuilderOptions _options;
+    uint32_t _count = 0;
+    uint32_t _remain_element_capacity = 0;
+    bool _finished = false;
+    faststring _data;
+    faststring _buffer;
+    CppType _first_value;
+    CppType _last_value;
+};
+
+template <FieldType Type>
+class AlpPageDecoder : public PageDecoder {
+public:
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption("file corruption: invalid data size:{}, header size:{}",
+                                      _data.size, ALP_PAGE_HEADER_SIZE);
+        }
+        const auto* header = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(header);
+        _exponent = header[4];
+        _factor = header[5];
+        _bit_width = header[6];
+        _num_exceptions = decode_fixed32_le(header + 8);
+        _base = static_cast<int64_t>(decode_fixed64_le(header + 12));
+        if (_exponent > Constants::MAX_EXPONENT || _factor > _exponent || _bit_width > 64 ||
+            _num_exceptions > _num_elements) {
+            return Status::Corruption(
+                    "file corruption: invalid alp header, exponent:{}, factor:{}, bit_width:{}, "
+                    "num_exceptions:{}, num_elements:{}",
+                    _exponent, _factor, _bit_width, _num_exceptions, _num_elements);
+        }
+        _packed_size = (static_cast<size_t>(_num_elements) * _bit_width + 7) / 8;
+        const size_t expected_size = ALP_PAGE_HEADER_SIZE + _packed_size +
+                                     _num_exceptions * (sizeof(uint32_t) + SIZE_OF_TYPE);
+        if (_data.size != expected_size) {
+            return Status::Corruption(
+                    "file corruption: size information unmatched, data size:{}, expected "
+                    "size:{}",
+                    _data.size, expected_size);
+        }
+        _packed = header + ALP_PAGE_HEADER_SIZE;
+        _exception_positions = _packed + _packed_size;
+        _exception_values = _exception_positions + _num_exceptions * sizeof(uint32_t);
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (_num_elements == 0) [[unlikely]] {
+            if (pos != 0) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                        "seek pos {} is larger than total elements  {}", pos, _num_elements);
+            }
+        }
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        _buffer.resize(max_fetch);
+        _decode(_cur_index, max_fetch, _buffer.data());
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()), max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        // The rowids are ascending, the unpacked group is reused by the rows inside it.
+        size_t cached_group = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elements)) {
+                break;
+            }
+            const size_t group = ord / GROUP_SIZE;
+            if (group != cached_group) {
+                const size_t group_start = group * GROUP_SIZE;
+                _decode(group_start, std::min<size_t>(GROUP_SIZE, _num_elements - group_start),
+                        _group_values);
+                cached_group = group;
+            }
+            _buffer[read_count++] = _group_values[ord % GROUP_SIZE];
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Constants = AlpConstants<CppType>;
+
+    // The end of every 32 values is at a byte boundary whatever the bit width is.
+    static constexpr size_t GROUP_SIZE = 32;
+
+    // Decode `count` values from `start` into `out`.
+    void _decode(size_t start, size_t count, CppType* out) {
+        const size_t group_start = start / GROUP_SIZE * GROUP_SIZE;
+        const size_t skip = start - group_start;
+        _unpacked.resize(skip + count);
+        if (_bit_width == 0) {
+            std::fill(_unpacked.begin(), _unpacked.end(), 0);
+        } else {
+            const size_t offset = group_start * _bit_width / 8;
+            BitPacking::UnpackValues(_bit_width, _packed + offset,
+                                     static_cast<int64_t>(_packed_size - offset),
+                                     static_cast<int64_t>(skip + count), _unpacked.data());
+        }
+        // A plain loop of int to float conversions and multiplications, it is vectorized.
+        const double f = Constants::EXP10[_factor];
+        const double e = Constants::FRAC10[_exponent];
+        const auto base = static_cast<uint64_t>(_base);
+        const uint64_t* __restrict unpacked = _unpacked.data() + skip;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<CppType>(
+                    static_cast<double>(static_cast<int64_t>(unpacked[i] + base)) * f * e);
+        }
+
+        if (_num_exceptions == 0) {
+            return;
+        }
+        size_t left = 0;
+        size_t right = _num_exceptions;
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (_exception_position(mid) < start) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        for (size_t i = left; i < _num_exceptions; ++i) {
+            const uint32_t pos = _exception_position(i);
+            if (pos >= start + count) {
+                break;
+            }
+            memcpy(&out[pos - start], _exception_values + i * SIZE_OF_TYPE, SIZE_OF_TYPE);
+        }
+    }
+
+    uint32_t _exception_position(size_t idx) const {
+        return decode_fixed32_le(_exception_positions + idx * sizeof(uint32_t));
+    }
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    uint32_t _num_elements = 0;
+    uint8_t _exponent = 0;
+    uint8_t _factor = 0;
+    uint8_t _bit_width = 0;
+    uint32_t _num_exceptions = 0;
+    int64_t _base = 0;
+    size_t _packed_size = 0;
+    const uint8_t* _packed = nullptr;
+    const uint8_t* _exception_positions = nullptr;
+    const uint8_t* _exception_values = nullptr;
+    // Index of the currently seeked element in the page.
+    size_t _cur_index = 0;
+
+    std::vector<uint64_t> _unpacked;
+    std::vector<CppType> _buffer;
+    CppType _group_values[GROUP_SIZE];
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -48,6 +48,12 @@ std::string ann_index_type_to_string(AnnIndexType type) {
         return "unknown";
     case AnnIndexType::HNSW:
         return "hnsw";
+    case AnnIndexType::IVF:
+        return "ivf";
+    case AnnIndexType::IVF_PQ:
+        return "ivf_pq";
+    case AnnIndexType::IVF_SQ8:
+        return "ivf_sq8";
     default:
         return "unknown";
     }
@@ -56,6 +62,12 @@ std::string ann_index_type_to_string(AnnIndexType type) {
 AnnIndexType string_to_ann_index_type(const std::string& type) {
     if (type == "hnsw") {
         return AnnIndexType::HNSW;
+    } else if (type == "ivf") {
+        return AnnIndexType::IVF;
+    } else if (type == "ivf_pq") {
+        return AnnIndexType::IVF_PQ;
+    } else if (type == "ivf_sq8") {
+        return AnnIndexType::IVF_SQ8;
     } else {
         return AnnIndexType::UNKNOWN;
     }
@@ -54,7 +54,7 @@ std::string metric_to_string(AnnIndexMetric metric);
 
 AnnIndexMetric string_to_metric(const std::string& metric);
 
-enum class AnnIndexType { UNKNOWN, HNSW };
+enum class AnnIndexType { UNKNOWN, HNSW, IVF, IVF_PQ, IVF_SQ8 };
 
 std::string ann_index_type_to_string(AnnIndexType type);
 
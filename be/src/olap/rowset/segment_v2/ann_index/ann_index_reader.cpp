@@ -120,6 +120,17 @@ Status AnnIndexReader::query(io::IOContext* io_ctx, AnnTopNParam* param, AnnInde
             stats->engine_search_ns.update(index_search_result.engine_search_ns);
             stats->engine_convert_ns.update(index_search_result.engine_convert_ns);
             stats->engine_prepare_ns.update(index_search_result.engine_prepare_ns);
+        } else if (_is_ivf_index()) {
+            IVFSearchParameters ivf_search_params;
+            ivf_search_params.roaring = param->roaring;
+            ivf_search_params.rows_of_segment = param->rows_of_segment;
+            ivf_search_params.nprobe = param->_user_params.ivf_nprobe;
+            ivf_search_params.refine_factor = param->_user_params.ivf_refine_factor;
+            RETURN_IF_ERROR(_vector_index->ann_topn_search(query_vec, limit, ivf_search_params,
+                                                           index_search_result));
+            stats->engine_search_ns.update(index_search_result.engine_search_ns);
+            stats->engine_convert_ns.update(index_search_result.engine_convert_ns);
+            stats->engine_prepare_ns.update(index_search_result.engine_prepare_ns);
         } else {
             throw Status::NotSupported("Unsupported index type: {}",
                                        ann_index_type_to_string(_index_type));
@@ -169,6 +180,11 @@ Status AnnIndexReader::range_search(const AnnRangeSearchParams& params,
             hnsw_param->check_relative_distance = custom_params.hnsw_check_relative_distance;
             hnsw_param->bounded_queue = custom_params.hnsw_bounded_queue;
             search_param = std::move(hnsw_param);
+        } else if (_is_ivf_index()) {
+            auto ivf_param = std::make_unique<segment_v2::IVFSearchParameters>();
+            ivf_param->nprobe = custom_params.ivf_nprobe;
+            ivf_param->refine_factor = custom_params.ivf_refine_factor;
+            search_param = std::move(ivf_param);
         } else {
             throw Status::NotSupported("Unsupported index type: {}",
                                        ann_index_type_to_string(_index_type));
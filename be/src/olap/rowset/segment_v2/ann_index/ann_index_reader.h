@@ -60,6 +60,11 @@ public:
     AnnIndexMetric get_metric_type() const { return _metric_type; }
 
 private:
+    bool _is_ivf_index() const {
+        return _index_type == AnnIndexType::IVF || _index_type == AnnIndexType::IVF_PQ ||
+               _index_type == AnnIndexType::IVF_SQ8;
+    }
+
     TabletIndex _index_meta;
     std::shared_ptr<IndexFileReader> _index_file_reader;
     std::unique_ptr<VectorIndex> _vector_index;
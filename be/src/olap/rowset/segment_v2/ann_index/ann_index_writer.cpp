@@ -62,15 +62,20 @@ Status AnnIndexColumnWriter::init() {
     build_parameter.max_degree = std::stoi(get_or_default(properties, MAX_DEGREE, "32"));
     build_parameter.metric_type = FaissBuildParameter::string_to_metric_type(metric_type);
     build_parameter.ef_construction = std::stoi(get_or_default(properties, EF_CONSTRUCTION, "40"));
+    build_parameter.nlist = std::stoi(get_or_default(properties, NLIST, "1024"));
+    build_parameter.pq_m = std::stoi(get_or_default(properties, PQ_M, "8"));
+    build_parameter.pq_nbits = std::stoi(get_or_default(properties, PQ_NBITS, "8"));
+    build_parameter.refine = get_or_default(properties, REFINE, "false") == "true";
 
     faiss_index->build(build_parameter);
 
     _vector_index = faiss_index;
     LOG_INFO(
             "Create a new faiss index, index_type {} dim {} metric_type {} max_degree {}, "
-            "ef_construction {}",
+            "ef_construction {}, nlist {}, pq_m {}, pq_nbits {}, refine {}",
             index_type, build_parameter.dim, metric_type, build_parameter.max_degree,
-            build_parameter.ef_construction);
+            build_parameter.ef_construction, build_parameter.nlist, build_parameter.pq_m,
+            build_parameter.pq_nbits, build_parameter.refine);
     return Status::OK();
 }
 
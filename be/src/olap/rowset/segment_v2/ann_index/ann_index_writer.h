@@ -44,6 +44,10 @@ public:
     static constexpr const char* DIM = "dim";
     static constexpr const char* MAX_DEGREE = "max_degree";
     static constexpr const char* EF_CONSTRUCTION = "ef_construction";
+    static constexpr const char* NLIST = "nlist";
+    static constexpr const char* PQ_M = "pq_m";
+    static constexpr const char* PQ_NBITS = "pq_nbits";
+    static constexpr const char* REFINE = "refine";
 
     explicit AnnIndexColumnWriter(IndexFileWriter* index_file_writer,
                                   const TabletIndex* index_meta);
@@ -142,5 +142,13 @@ struct HNSWSearchParameters : public IndexSearchParameters {
     bool check_relative_distance = true;
     bool bounded_queue = true;
 };
+
+struct IVFSearchParameters : public IndexSearchParameters {
+    // Number of inverted lists scanned for each query, trades recall for latency.
+    int nprobe = 16;
+    // For indexes built with refine, refine_factor * k candidates of the quantized index
+    // are re-ranked by their exact distance.
+    int refine_factor = 4;
+};
 #include "common/compile_check_end.h"
 } // namespace doris::segment_v2
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include <string>
 #include <utility>
 
+#include "common/cast_set.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "olap/rowset/segment_v2/ann_index/ann_index_iterator.h"
 #include "olap/rowset/segment_v2/ann_index/ann_search_params.h"
@@ -155,6 +157,10 @@ Status AnnTopNRuntime::evaluate_vector_ann_search(segment_v2::IndexIterator* ann
     DCHECK(ann_query_params.distance != nullptr);
     DCHECK(ann_query_params.row_ids != nullptr);
 
+    if (config::enable_ann_topn_global_pruning) {
+        _prune_by_global_topn(*ann_query_params.distance, *ann_query_params.row_ids, *roaring);
+    }
+
     size_t num_results = ann_query_params.distance->size();
     auto result_column_float = vectorized::ColumnFloat32::create(num_results);
 
@@ -168,6 +174,41 @@ Status AnnTopNRuntime::evaluate_vector_ann_search(segment_v2::IndexIterator* ann
     return Status::OK();
 }
 
+void AnnTopNRuntime::_prune_by_global_topn(std::vector<float>& distances,
+                                           std::vector<uint64_t>& row_ids,
+                                           roaring::Roaring& row_bitmap) {
+    DCHECK_EQ(distances.size(), row_ids.size());
+    if (_limit == 0) {
+        return;
+    }
+    auto score = [this](float distance) { return _asc ? distance : -distance; };
+    std::lock_guard<std::mutex> lock(_global_topn_lock);
+    if (_global_topn_scores.size() == _limit) {
+        // Ties with the K-th best row are kept, any of them may end up in the result.
+        const float bound = _global_topn_scores.top();
+        size_t num_kept = 0;
+        for (size_t i = 0; i < distances.size(); ++i) {
+            if (score(distances[i]) > bound) {
+                row_bitmap.remove(cast_set<uint32_t>(row_ids[i]));
+                continue;
+            }
+            distances[num_kept] = distances[i];
+            row_ids[num_kept] = row_ids[i];
+            ++num_kept;
+        }
+        distances.resize(num_kept);
+        row_ids.resize(num_kept);
+    }
+    for (float distance : distances) {
+        if (_global_topn_scores.size() < _limit) {
+            _global_topn_scores.push(score(distance));
+        } else if (score(distance) < _global_topn_scores.top()) {
+            _global_topn_scores.pop();
+            _global_topn_scores.push(score(distance));
+        }
+    }
+}
+
 std::string AnnTopNRuntime::debug_string() const {
     return fmt::format(
             "AnnTopNRuntime: limit={}, src_col_idx={}, dest_col_idx={}, asc={}, user_params={}, "
@@ -35,6 +35,10 @@
 
 #pragma once
 
+#include <mutex>
+#include <queue>
+#include <vector>
+
 #include "runtime/runtime_state.h"
 #include "vec/columns/column.h"
 #include "vec/exprs/varray_literal.h"
@@ -150,6 +154,16 @@ public:
     bool is_asc() const { return _asc; }
 
 private:
+    /**
+     * @brief Drops the results of one segment that can not make the top-K of the scan.
+     *
+     * Rows ranked behind the K-th best distance found by the segments searched so far
+     * are removed from the results and the row bitmap, the remaining ones are merged
+     * into the shared top-K.
+     */
+    void _prune_by_global_topn(std::vector<float>& distances, std::vector<uint64_t>& row_ids,
+                               roaring::Roaring& row_bitmap);
+
     // Core configuration
     const bool _asc;     ///< Sort order for results
     const size_t _limit; ///< Maximum number of results (K in K-NN)
@@ -163,6 +177,11 @@ private:
     segment_v2::AnnIndexMetric _metric_type;    ///< Distance metric type
     vectorized::IColumn::Ptr _query_array;      ///< Query vector data
     doris::VectorSearchUserParams _user_params; ///< User-defined search parameters
+
+    // Shared by all scanners of the scan, the scores are distances for asc and negated
+    // distances for desc, so the top of the heap is the current K-th best row.
+    std::mutex _global_topn_lock;
+    std::priority_queue<float> _global_topn_scores;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::segment_v2
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <faiss/index_io.h>
 #include <omp.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -33,7 +34,12 @@
 #include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "faiss/IndexFlat.h"
 #include "faiss/IndexHNSW.h"
+#include "faiss/IndexIVFFlat.h"
+#include "faiss/IndexIVFPQ.h"
+#include "faiss/IndexRefine.h"
+#include "faiss/IndexScalarQuantizer.h"
 #include "faiss/MetricType.h"
 #include "faiss/impl/IDSelector.h"
 #include "faiss/impl/io.h"
@@ -71,6 +77,14 @@ void FaissVectorIndex::update_roaring(const faiss::idx_t* labels, const size_t n
 
 FaissVectorIndex::FaissVectorIndex() : _index(nullptr) {}
 
+// FAISS warns when k-means gets fewer training points than this per centroid.
+static constexpr size_t IVF_TRAIN_POINTS_PER_CENTROID = 39;
+
+static faiss::MetricType to_faiss_metric(FaissBuildParameter::MetricType metric_type) {
+    return metric_type == FaissBuildParameter::MetricType::IP ? faiss::METRIC_INNER_PRODUCT
+                                                               : faiss::METRIC_L2;
+}
+
 struct FaissIndexWriter : faiss::IOWriter {
 public:
     FaissIndexWriter() = default;
@@ -155,10 +169,67 @@ doris::Status FaissVectorIndex::add(int n, const float* vec) {
     DCHECK(vec != nullptr);
     DCHECK(_index != nullptr);
     omp_set_num_threads(config::omp_threads_limit);
+    if (_need_train) {
+        _train_vectors.insert(_train_vectors.end(), vec, vec + static_cast<size_t>(n) * _dimension);
+        if (_train_vectors.size() / _dimension >= _train_rows) {
+            _train_ivf_index();
+        }
+        return doris::Status::OK();
+    }
     _index->add(n, vec);
     return doris::Status::OK();
 }
 
+void FaissVectorIndex::_train_ivf_index() {
+    DCHECK(_need_train);
+    const auto num_rows = _train_vectors.size() / _dimension;
+    const auto metric = to_faiss_metric(_build_params.metric_type);
+    const int dim = _build_params.dim;
+    std::unique_ptr<faiss::Index> index;
+    if (num_rows == 0) {
+        // Nothing to train on, an empty flat index keeps the segment searchable.
+        index = std::make_unique<faiss::IndexFlat>(dim, metric);
+    } else {
+        auto nlist = std::min(static_cast<size_t>(_build_params.nlist), num_rows);
+        auto quantizer = std::make_unique<faiss::IndexFlat>(dim, metric);
+        std::unique_ptr<faiss::IndexIVF> ivf_index;
+        auto index_type = _build_params.index_type;
+        if (index_type == FaissBuildParameter::IndexType::IVF_PQ &&
+            num_rows < (size_t(1) << _build_params.pq_nbits)) {
+            // PQ needs one training point per code at least, small segments keep raw vectors.
+            index_type = FaissBuildParameter::IndexType::IVF;
+        }
+        switch (index_type) {
+        case FaissBuildParameter::IndexType::IVF_PQ:
+            ivf_index = std::make_unique<faiss::IndexIVFPQ>(quantizer.get(), dim, nlist,
+                                                            _build_params.pq_m,
+                                                            _build_params.pq_nbits, metric);
+            break;
+        case FaissBuildParameter::IndexType::IVF_SQ8:
+            ivf_index = std::make_unique<faiss::IndexIVFScalarQuantizer>(
+                    quantizer.get(), dim, nlist, faiss::ScalarQuantizer::QT_8bit, metric);
+            break;
+        default:
+            ivf_index = std::make_unique<faiss::IndexIVFFlat>(quantizer.get(), dim, nlist, metric);
+            break;
+        }
+        ivf_index->own_fields = true;
+        std::ignore = quantizer.release();
+        index = std::move(ivf_index);
+        if (_build_params.refine && index_type != FaissBuildParameter::IndexType::IVF) {
+            auto refine_index = std::make_unique<faiss::IndexRefineFlat>(index.get());
+            refine_index->own_fields = true;
+            std::ignore = index.release();
+            index = std::move(refine_index);
+        }
+        index->train(cast_set<faiss::idx_t>(num_rows), _train_vectors.data());
+        index->add(cast_set<faiss::idx_t>(num_rows), _train_vectors.data());
+    }
+    _index = std::move(index);
+    _need_train = false;
+    std::vector<float>().swap(_train_vectors);
+}
+
 void FaissVectorIndex::build(const FaissBuildParameter& params) {
     _dimension = params.dim;
     switch (params.metric_type) {
@@ -189,12 +260,53 @@ void FaissVectorIndex::build(const FaissBuildParameter& params) {
         }
         hnsw_index->hnsw.efConstruction = params.ef_construction;
         _index = std::move(hnsw_index);
+    } else if (params.index_type == FaissBuildParameter::IndexType::IVF ||
+               params.index_type == FaissBuildParameter::IndexType::IVF_PQ ||
+               params.index_type == FaissBuildParameter::IndexType::IVF_SQ8) {
+        if (params.nlist <= 0) {
+            throw doris::Exception(doris::ErrorCode::INVALID_ARGUMENT,
+                                   "nlist of ivf index must be positive, got {}", params.nlist);
+        }
+        size_t train_centroids = params.nlist;
+        if (params.index_type == FaissBuildParameter::IndexType::IVF_PQ) {
+            if (params.pq_m <= 0 || params.dim % params.pq_m != 0 || params.pq_nbits <= 0 ||
+                params.pq_nbits > 16) {
+                throw doris::Exception(doris::ErrorCode::INVALID_ARGUMENT,
+                                       "Invalid pq parameters, dim {} pq_m {} pq_nbits {}",
+                                       params.dim, params.pq_m, params.pq_nbits);
+            }
+            train_centroids = std::max(train_centroids, size_t(1) << params.pq_nbits);
+        }
+        _build_params = params;
+        _need_train = true;
+        _train_rows = train_centroids * IVF_TRAIN_POINTS_PER_CENTROID;
     } else {
         throw doris::Exception(doris::ErrorCode::INVALID_ARGUMENT, "Unsupported index type: {}",
                                static_cast<int>(params.index_type));
     }
 }
 
+// The refine parameters own the IVF parameters of their base index.
+struct IVFRefineSearchParameters : faiss::IndexRefineSearchParameters {
+    faiss::SearchParametersIVF ivf_params;
+};
+
+std::unique_ptr<faiss::SearchParameters> FaissVectorIndex::_create_ivf_search_parameters(
+        const IVFSearchParameters& params, faiss::IDSelector* sel) const {
+    if (dynamic_cast<const faiss::IndexRefine*>(_index.get()) != nullptr) {
+        auto refine_params = std::make_unique<IVFRefineSearchParameters>();
+        refine_params->ivf_params.nprobe = params.nprobe;
+        refine_params->ivf_params.sel = sel;
+        refine_params->base_index_params = &refine_params->ivf_params;
+        refine_params->k_factor = static_cast<float>(std::max(params.refine_factor, 1));
+        return refine_params;
+    }
+    auto ivf_params = std::make_unique<faiss::SearchParametersIVF>();
+    ivf_params->nprobe = params.nprobe;
+    ivf_params->sel = sel;
+    return ivf_params;
+}
+
 // TODO: Support batch search
 doris::Status FaissVectorIndex::ann_topn_search(const float* query_vec, int k,
                                                 const segment_v2::IndexSearchParameters& params,
@@ -214,29 +326,35 @@ doris::Status FaissVectorIndex::ann_topn_search(const float* query_vec, int k,
     DCHECK(params.roaring != nullptr)
             << "Roaring should not be null for topN search, please set roaring in params";
 
-    faiss::SearchParametersHNSW param;
-    const HNSWSearchParameters* hnsw_params = dynamic_cast<const HNSWSearchParameters*>(&params);
-    if (hnsw_params == nullptr) {
-        return doris::Status::InvalidArgument(
-                "HNSW search parameters should not be null for HNSW index");
-    }
-    param.efSearch = hnsw_params->ef_search;
-    param.check_relative_distance = hnsw_params->check_relative_distance;
-    param.bounded_queue = hnsw_params->bounded_queue;
-    param.sel = nullptr;
     std::unique_ptr<faiss::IDSelector> id_sel = nullptr;
     // Costs of roaring to faiss selector is very high especially when the cardinality is very high.
     if (params.roaring->cardinality() != params.rows_of_segment) {
         SCOPED_RAW_TIMER(&result.engine_prepare_ns);
         id_sel = roaring_to_faiss_selector(*params.roaring);
-        param.sel = id_sel.get();
+    }
+
+    faiss::SearchParametersHNSW param;
+    std::unique_ptr<faiss::SearchParameters> ivf_param;
+    faiss::SearchParameters* search_param = &param;
+    if (const auto* ivf_params = dynamic_cast<const IVFSearchParameters*>(&params)) {
+        ivf_param = _create_ivf_search_parameters(*ivf_params, id_sel.get());
+        search_param = ivf_param.get();
     } else {
-        param.sel = nullptr;
+        const HNSWSearchParameters* hnsw_params =
+                dynamic_cast<const HNSWSearchParameters*>(&params);
+        if (hnsw_params == nullptr) {
+            return doris::Status::InvalidArgument(
+                    "HNSW search parameters should not be null for HNSW index");
+        }
+        param.efSearch = hnsw_params->ef_search;
+        param.check_relative_distance = hnsw_params->check_relative_distance;
+        param.bounded_queue = hnsw_params->bounded_queue;
+        param.sel = id_sel.get();
     }
 
     {
         SCOPED_RAW_TIMER(&result.engine_search_ns);
-        _index->search(1, query_vec, k, distances, labels, &param);
+        _index->search(1, query_vec, k, distances, labels, search_param);
     }
     {
         SCOPED_RAW_TIMER(&result.engine_convert_ns);
@@ -287,7 +405,11 @@ doris::Status FaissVectorIndex::range_search(const float* query_vec, const float
             << "Roaring should not be null for range search, please set roaring in params";
     faiss::SearchParametersHNSW param;
     const HNSWSearchParameters* hnsw_params = dynamic_cast<const HNSWSearchParameters*>(&params);
-    {
+    const IVFSearchParameters* ivf_params = dynamic_cast<const IVFSearchParameters*>(&params);
+    if (hnsw_params == nullptr && ivf_params == nullptr) {
+        return doris::Status::InvalidArgument("HNSW or IVF search parameters are expected");
+    }
+    if (hnsw_params != nullptr) {
         // Engine prepare: set search parameters and bind selector
         SCOPED_RAW_TIMER(&result.engine_prepare_ns);
         param.efSearch = hnsw_params->ef_search;
@@ -306,20 +428,35 @@ doris::Status FaissVectorIndex::range_search(const float* query_vec, const float
         }
     }
 
+    // Refine indexes can not range search, their quantized base index answers it.
+    faiss::Index* search_index = _index.get();
+    std::unique_ptr<faiss::SearchParameters> ivf_param;
+    faiss::SearchParameters* search_param = &param;
+    if (ivf_params != nullptr) {
+        if (auto* refine_index = dynamic_cast<faiss::IndexRefine*>(_index.get())) {
+            search_index = refine_index->base_index;
+        }
+        auto ivf_search_params = std::make_unique<faiss::SearchParametersIVF>();
+        ivf_search_params->nprobe = ivf_params->nprobe;
+        ivf_search_params->sel = sel.get();
+        ivf_param = std::move(ivf_search_params);
+        search_param = ivf_param.get();
+    }
+
     faiss::RangeSearchResult native_search_result(1, true);
-    // Currently only support HNSW index for range search.
-    DCHECK(hnsw_params != nullptr) << "HNSW search parameters should not be null for HNSW index";
     {
         // Engine search: FAISS range_search
         SCOPED_RAW_TIMER(&result.engine_search_ns);
         if (_metric == AnnIndexMetric::L2) {
             if (radius <= 0) {
-                _index->range_search(1, query_vec, 0.0f, &native_search_result, &param);
+                search_index->range_search(1, query_vec, 0.0f, &native_search_result,
+                                           search_param);
             } else {
-                _index->range_search(1, query_vec, radius * radius, &native_search_result, &param);
+                search_index->range_search(1, query_vec, radius * radius, &native_search_result,
+                                           search_param);
             }
         } else if (_metric == AnnIndexMetric::IP) {
-            _index->range_search(1, query_vec, radius, &native_search_result, &param);
+            search_index->range_search(1, query_vec, radius, &native_search_result, search_param);
         }
     }
 
@@ -425,6 +562,10 @@ doris::Status FaissVectorIndex::range_search(const float* query_vec, const float
 
 doris::Status FaissVectorIndex::save(lucene::store::Directory* dir) {
     auto start_time = std::chrono::high_resolution_clock::now();
+    if (_need_train) {
+        // The segment ended before enough vectors were buffered, train on what it has.
+        _train_ivf_index();
+    }
 
     lucene::store::IndexOutput* idx_output = dir->createOutput(faiss_index_fila_name);
     auto writer = std::make_unique<FaissIndexWriter>(idx_output);
@@ -28,6 +28,7 @@
 #include <gen_cpp/olap_file.pb.h>
 
 #include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "olap/rowset/segment_v2/ann_index/ann_index.h"
@@ -37,6 +38,7 @@ namespace doris::segment_v2 {
 #include "common/compile_check_begin.h"
 struct IndexSearchParameters;
 struct IndexSearchResult;
+struct IVFSearchParameters;
 /**
  * @brief Build parameters for constructing FAISS-based vector indexes.
  * 
@@ -49,7 +51,10 @@ struct FaissBuildParameter {
      * @brief Supported vector index types.
      */
     enum class IndexType {
-        HNSW ///< Hierarchical Navigable Small World (HNSW) index for high performance
+        HNSW,    ///< Hierarchical Navigable Small World (HNSW) index for high performance
+        IVF,     ///< Inverted file index storing the raw vectors of every list
+        IVF_PQ,  ///< Inverted file index storing product quantized codes
+        IVF_SQ8, ///< Inverted file index storing 8-bit scalar quantized codes
     };
 
     /**
@@ -69,6 +74,12 @@ struct FaissBuildParameter {
     static IndexType string_to_index_type(const std::string& type) {
         if (type == "hnsw") {
             return IndexType::HNSW;
+        } else if (type == "ivf") {
+            return IndexType::IVF;
+        } else if (type == "ivf_pq") {
+            return IndexType::IVF_PQ;
+        } else if (type == "ivf_sq8") {
+            return IndexType::IVF_SQ8;
         } else {
             throw doris::Exception(doris::ErrorCode::INVALID_ARGUMENT, "Unsupported index type: {}",
                                    type);
@@ -98,6 +109,12 @@ struct FaissBuildParameter {
     IndexType index_type = IndexType::HNSW;  ///< Type of index to build
     MetricType metric_type = MetricType::L2; ///< Distance metric to use
     int ef_construction = 40; ///< Size of dynamic list for nearest neighbors during construction
+
+    // IVF-specific parameters
+    int nlist = 1024; ///< Number of inverted lists (coarse centroids)
+    int pq_m = 8;     ///< Number of PQ sub-quantizers, must divide dim
+    int pq_nbits = 8; ///< Bits per PQ sub-quantizer code
+    bool refine = false; ///< Keep raw vectors to re-rank quantized candidates by exact distance
 };
 
 /**
@@ -229,7 +246,24 @@ public:
     doris::Status load(lucene::store::Directory*) override;
 
 private:
+    /**
+     * @brief Trains the IVF index on the buffered vectors and adds them to it.
+     *
+     * Segments with fewer vectors than the index needs for training get fewer
+     * inverted lists, or an IVF-Flat index when there are too few rows for PQ.
+     */
+    void _train_ivf_index();
+
+    std::unique_ptr<faiss::SearchParameters> _create_ivf_search_parameters(
+            const IVFSearchParameters& params, faiss::IDSelector* sel) const;
+
     std::unique_ptr<faiss::Index> _index = nullptr; ///< Underlying FAISS index instance
+    FaissBuildParameter _build_params;
+    // IVF indexes must be trained before vectors are added, the first vectors of the segment
+    // are buffered until there are enough of them to train on.
+    bool _need_train = false;
+    size_t _train_rows = 0;
+    std::vector<float> _train_vectors;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::segment_v2
\ No newline at end of file
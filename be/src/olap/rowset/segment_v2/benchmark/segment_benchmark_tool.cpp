@@ -0,0 +1,398 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Generates segments with SegmentWriter and measures the scan throughput of SegmentIterator
+// for every combination of value column type, page compression, predicate selectivity and
+// cache state.
+//
+// Each segment has a bigint key column `k`, an int predicate column `p` uniformly distributed
+// in [0, 1000) and `value_columns` value columns of the benchmarked type with `ndv` distinct
+// values. Every type is written with its default encoding. A selectivity below 100 scans with
+// `p < selectivity * 10`, so the value columns are read lazily for the selected rows only.
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+#include <gflags/gflags.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "io/io_common.h"
+#include "olap/block_column_predicate.h"
+#include "olap/comparison_predicate.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
+#include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/cache_manager.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/disk_info.h"
+#include "util/mem_info.h"
+#include "util/stopwatch.hpp"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+
+DEFINE_string(dir, "./segment_benchmark", "Directory to write the generated segments to");
+DEFINE_int64(rows, 1048576, "Number of rows of each segment");
+DEFINE_string(column_types, "int,bigint,varchar",
+              "Types of the value columns, each type is written with its default encoding");
+DEFINE_int32(value_columns, 2, "Number of value columns of each segment");
+DEFINE_int64(ndv, 1024, "Number of distinct values of the value columns");
+DEFINE_string(compressions, "LZ4F,ZSTD,NO_COMPRESSION", "Page compressions");
+DEFINE_string(selectivities, "1,10,100",
+              "Percent of rows selected by the predicate, 100 scans without predicate");
+DEFINE_string(cache_states, "cold,warm",
+              "cold: the OS cache of the segment is dropped and the page cache is not used, "
+              "warm: the page cache is filled by a scan before the measured ones");
+DEFINE_int32(repetitions, 3, "Number of measured scans of each case, the fastest one is reported");
+DEFINE_int64(page_cache_mb, 4096, "Capacity of the storage page cache");
+DEFINE_string(conf, "", "Optional be.conf to load the BE configs from");
+
+namespace doris::segment_v2 {
+
+static constexpr uint32_t PREDICATE_COLUMN_ID = 1;
+static constexpr int32_t PREDICATE_VALUE_RANGE = 1000;
+static constexpr size_t WRITE_BATCH_ROWS = 4096;
+static constexpr int64_t TABLET_ID = 10000;
+
+std::string get_usage(const std::string& progname) {
+    std::stringstream ss;
+    ss << progname << " is the Doris BE benchmark tool for scanning segment_v2 segments.\n";
+    ss << "Usage:\n";
+    ss << progname
+       << " --dir=[path] --rows=[num] --column_types=[int,bigint,varchar] --value_columns=[num]"
+          " --ndv=[num] --compressions=[LZ4F,ZSTD,...] --selectivities=[1,10,100]"
+          " --cache_states=[cold,warm] --repetitions=[num] --page_cache_mb=[num]\n";
+    ss << "\nOutput columns:\n";
+    ss << "     ns/row:        wall time of the scan per scanned row\n";
+    ss << "     io ns/row:     time spent reading pages from the file per row\n";
+    ss << "     decomp ns/row: time spent decompressing pages per row\n";
+    ss << "     decode ns/row: the rest of the scan, decoding and predicate evaluation\n";
+    ss << "     io bytes:      compressed bytes read from the file\n";
+    ss << "     cache hit:     page cache hits of all the pages read\n";
+    ss << "\nExample:\n";
+    ss << progname << " --rows=4194304 --column_types=varchar --compressions=ZSTD\n";
+    return ss.str();
+}
+
+std::vector<std::string> split_flag(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+struct ColumnTypeInfo {
+    std::string type;
+    int32_t length;
+};
+
+Status get_column_type_info(const std::string& name, ColumnTypeInfo* info) {
+    if (name == "int") {
+        *info = {"INT", 4};
+    } else if (name == "bigint") {
+        *info = {"BIGINT", 8};
+    } else if (name == "varchar") {
+        *info = {"VARCHAR", 65533};
+    } else {
+        return Status::InvalidArgument("unsupported column type {}", name);
+    }
+    return Status::OK();
+}
+
+TabletSchemaSPtr create_schema(const ColumnTypeInfo& value_type, CompressionTypePB compression) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(KeysType::DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    schema_pb.set_num_rows_per_row_block(1024);
+    schema_pb.set_compression_type(compression);
+    auto add_column = [&](int32_t unique_id, const std::string& name, const std::string& type,
+                          int32_t length, bool is_key) {
+        ColumnPB* column = schema_pb.add_column();
+        column->set_unique_id(unique_id);
+        column->set_name(name);
+        column->set_type(type);
+        column->set_is_key(is_key);
+        column->set_is_nullable(false);
+        column->set_length(length);
+        column->set_index_length(is_key ? length : 0);
+        column->set_aggregation("NONE");
+    };
+    add_column(0, "k", "BIGINT", 8, true);
+    add_column(static_cast<int32_t>(PREDICATE_COLUMN_ID), "p", "INT", 4, false);
+    for (int32_t i = 0; i < FLAGS_value_columns; ++i) {
+        add_column(static_cast<int32_t>(PREDICATE_COLUMN_ID) + 1 + i, fmt::format("v{}", i),
+                   value_type.type, value_type.length, false);
+    }
+    auto schema = std::make_shared<TabletSchema>();
+    schema->init_from_pb(schema_pb);
+    return schema;
+}
+
+void fill_value(vectorized::IColumn& column, const std::string& type, int64_t value) {
+    if (type == "INT") {
+        assert_cast<vectorized::ColumnInt32&>(column).get_data().push_back(
+                static_cast<int32_t>(value));
+    } else if (type == "BIGINT") {
+        assert_cast<vectorized::ColumnInt64&>(column).get_data().push_back(value * 1000003);
+    } else {
+        auto str = fmt::format("benchmark_value_{}", value);
+        assert_cast<vectorized::ColumnString&>(column).insert_data(str.data(), str.size());
+    }
+}
+
+Status write_segment(const std::string& path, const TabletSchemaSPtr& schema,
+                     const ColumnTypeInfo& value_type) {
+    io::FileWriterPtr file_writer;
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(path, &file_writer));
+    SegmentWriterOptions opts;
+    SegmentWriter writer(file_writer.get(), 0, schema, nullptr, nullptr, opts, nullptr);
+    RETURN_IF_ERROR(writer.init());
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int32_t> predicate_dis(0, PREDICATE_VALUE_RANGE - 1);
+    std::uniform_int_distribution<int64_t> value_dis(0, std::max<int64_t>(FLAGS_ndv, 1) - 1);
+    for (int64_t begin = 0; begin < FLAGS_rows; begin += WRITE_BATCH_ROWS) {
+        auto rows = std::min<int64_t>(WRITE_BATCH_ROWS, FLAGS_rows - begin);
+        auto block = schema->create_block();
+        auto columns = block.mutate_columns();
+        for (int64_t row = begin; row < begin + rows; ++row) {
+            assert_cast<vectorized::ColumnInt64&>(*columns[0]).get_data().push_back(row);
+            assert_cast<vectorized::ColumnInt32&>(*columns[PREDICATE_COLUMN_ID])
+                    .get_data()
+                    .push_back(predicate_dis(gen));
+            for (size_t i = PREDICATE_COLUMN_ID + 1; i < columns.size(); ++i) {
+                fill_value(*columns[i], value_type.type, value_dis(gen));
+            }
+        }
+        block.set_columns(std::move(columns));
+        RETURN_IF_ERROR(writer.append_block(&block, 0, static_cast<size_t>(rows)));
+    }
+
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    RETURN_IF_ERROR(writer.finalize(&file_size, &index_size));
+    return file_writer->close();
+}
+
+// Drops the OS page cache of the file so that a cold scan really reads the disk
+void drop_os_cache(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    static_cast<void>(::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED));
+    ::close(fd);
+}
+
+struct ScanResult {
+    uint64_t elapsed_ns = std::numeric_limits<uint64_t>::max();
+    int64_t rows_returned = 0;
+    OlapReaderStatistics stats;
+};
+
+Status scan_segment(const std::string& path, const TabletSchemaSPtr& schema, int32_t selectivity,
+                    bool warm, ScanResult* result) {
+    OlapReaderStatistics stats;
+    MonotonicStopWatch watch;
+    watch.start();
+
+    RowsetId rowset_id;
+    rowset_id.init(1);
+    std::shared_ptr<Segment> segment;
+    RETURN_IF_ERROR(Segment::open(io::global_local_filesystem(), path, TABLET_ID, 0, rowset_id,
+                                  schema, io::FileReaderOptions {}, &segment));
+
+    StorageReadOptions opts;
+    opts.stats = &stats;
+    opts.tablet_schema = schema;
+    opts.use_page_cache = warm;
+    opts.io_ctx.reader_type = ReaderType::READER_QUERY;
+    std::unique_ptr<ColumnPredicate> predicate;
+    if (selectivity < 100) {
+        predicate = std::make_unique<ComparisonPredicateBase<TYPE_INT, PredicateType::LT>>(
+                PREDICATE_COLUMN_ID, selectivity * PREDICATE_VALUE_RANGE / 100);
+        opts.column_predicates.push_back(predicate.get());
+        auto and_predicate = AndBlockColumnPredicate::create_shared();
+        and_predicate->add_column_predicate(
+                SingleColumnBlockPredicate::create_unique(predicate.get()));
+        opts.col_id_to_predicates.emplace(PREDICATE_COLUMN_ID, std::move(and_predicate));
+    }
+
+    std::unique_ptr<RowwiseIterator> iter;
+    RETURN_IF_ERROR(segment->new_iterator(std::make_shared<Schema>(schema), opts, &iter));
+    auto block = schema->create_block();
+    int64_t rows_returned = 0;
+    while (true) {
+        block.clear_column_data();
+        auto st = iter->next_batch(&block);
+        if (st.is<ErrorCode::END_OF_FILE>()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        rows_returned += block.rows();
+    }
+    iter.reset();
+
+    uint64_t elapsed_ns = watch.elapsed_time();
+    if (elapsed_ns < result->elapsed_ns) {
+        result->elapsed_ns = elapsed_ns;
+        result->rows_returned = rows_returned;
+        result->stats = stats;
+    }
+    return Status::OK();
+}
+
+void print_header() {
+    std::cout << fmt::format("{:<8} {:<15} {:>6} {:<5} {:>12} {:>9} {:>10} {:>13} {:>13} {:>14} "
+                             "{:>10}",
+                             "type", "compression", "select", "cache", "rows_out", "ns/row",
+                             "io ns/row", "decomp ns/row", "decode ns/row", "io bytes",
+                             "cache hit")
+              << std::endl;
+}
+
+void print_result(const std::string& type, const std::string& compression, int32_t selectivity,
+                  const std::string& cache_state, const ScanResult& result) {
+    auto rows = static_cast<double>(std::max<int64_t>(FLAGS_rows, 1));
+    const auto& stats = result.stats;
+    auto total_ns = static_cast<double>(result.elapsed_ns);
+    auto io_ns = static_cast<double>(stats.io_ns);
+    auto decompress_ns = static_cast<double>(stats.decompress_ns);
+    auto decode_ns = std::max(total_ns - io_ns - decompress_ns, 0.0);
+    double hit_rate = stats.total_pages_num == 0
+                              ? 0
+                              : static_cast<double>(stats.cached_pages_num) /
+                                        static_cast<double>(stats.total_pages_num);
+    std::cout << fmt::format("{:<8} {:<15} {:>5}% {:<5} {:>12} {:>9.2f} {:>10.2f} {:>13.2f} "
+                             "{:>13.2f} {:>14} {:>9.1f}%",
+                             type, compression, selectivity, cache_state, result.rows_returned,
+                             total_ns / rows, io_ns / rows, decompress_ns / rows, decode_ns / rows,
+                             stats.compressed_bytes_read, hit_rate * 100)
+              << std::endl;
+}
+
+Status run() {
+    RETURN_IF_ERROR(io::global_local_filesystem()->delete_directory(FLAGS_dir));
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(FLAGS_dir));
+
+    std::vector<int32_t> selectivities;
+    for (const auto& item : split_flag(FLAGS_selectivities)) {
+        selectivities.push_back(std::clamp(std::stoi(item), 0, 100));
+    }
+    for (const auto& cache_state : split_flag(FLAGS_cache_states)) {
+        if (cache_state != "cold" && cache_state != "warm") {
+            return Status::InvalidArgument("unsupported cache state {}", cache_state);
+        }
+    }
+
+    print_header();
+    for (const auto& type : split_flag(FLAGS_column_types)) {
+        ColumnTypeInfo value_type;
+        RETURN_IF_ERROR(get_column_type_info(type, &value_type));
+        for (const auto& compression_name : split_flag(FLAGS_compressions)) {
+            CompressionTypePB compression;
+            if (!CompressionTypePB_Parse(compression_name, &compression)) {
+                return Status::InvalidArgument("unsupported compression {}", compression_name);
+            }
+            auto schema = create_schema(value_type, compression);
+            auto path = fmt::format("{}/{}_{}.dat", FLAGS_dir, type, compression_name);
+            RETURN_IF_ERROR(write_segment(path, schema, value_type));
+
+            for (auto selectivity : selectivities) {
+                for (const auto& cache_state : split_flag(FLAGS_cache_states)) {
+                    bool warm = cache_state == "warm";
+                    ScanResult result;
+                    if (warm) {
+                        // fill the page cache, not measured
+                        ScanResult warm_up;
+                        RETURN_IF_ERROR(scan_segment(path, schema, selectivity, true, &warm_up));
+                    }
+                    for (int32_t i = 0; i < std::max(FLAGS_repetitions, 1); ++i) {
+                        if (!warm) {
+                            drop_os_cache(path);
+                        }
+                        RETURN_IF_ERROR(scan_segment(path, schema, selectivity, warm, &result));
+                    }
+                    print_result(type, compression_name, selectivity, cache_state, result);
+                }
+            }
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace doris::segment_v2
+
+int main(int argc, char** argv) {
+    SCOPED_INIT_THREAD_CONTEXT();
+    std::string usage = doris::segment_v2::get_usage(argv[0]);
+    gflags::SetUsageMessage(usage);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (!doris::config::init(FLAGS_conf.empty() ? nullptr : FLAGS_conf.c_str(), false)) {
+        std::cerr << "failed to init config from \"" << FLAGS_conf << "\"" << std::endl;
+        return 1;
+    }
+    doris::CpuInfo::init();
+    doris::DiskInfo::init();
+    doris::MemInfo::init();
+
+    auto* env = doris::ExecEnv::GetInstance();
+    env->init_mem_tracker();
+    doris::thread_context()->thread_mem_tracker_mgr->init();
+    auto tracker = doris::MemTrackerLimiter::create_shared(
+            doris::MemTrackerLimiter::Type::GLOBAL, "SegmentBenchmark");
+    doris::thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(tracker);
+    env->set_cache_manager(doris::CacheManager::create_global_instance());
+    env->set_storage_page_cache(doris::StoragePageCache::create_global_cache(
+            static_cast<size_t>(FLAGS_page_cache_mb) << 20, 10, 0));
+    doris::ExecEnv::set_tracking_memory(false);
+
+    auto st = doris::segment_v2::run();
+    if (!st.ok()) {
+        std::cerr << "segment benchmark failed: " << st << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -20,6 +20,7 @@
 #include <gen_cpp/segment_v2.pb.h>
 
 #include <algorithm>
+#include <cstring>
 #include <ostream>
 #include <utility>
 
@@ -294,6 +295,25 @@ Status BinaryDictPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr
     return Status::OK();
 }
 
+Status BinaryDictPageDecoder::next_encoded_refs(size_t* n, uint32_t* refs) {
+    if (_encoding_type != DICT_ENCODING) {
+        return Status::NotSupported("the page falls back to plain encoding");
+    }
+    DCHECK(_parsed);
+    if (*n == 0 || _bit_shuffle_ptr->_cur_index >= _bit_shuffle_ptr->_num_elements) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+
+    size_t max_fetch = std::min(*n, static_cast<size_t>(_bit_shuffle_ptr->_num_elements -
+                                                        _bit_shuffle_ptr->_cur_index));
+    *n = max_fetch;
+    const auto* data_array = reinterpret_cast<const int32_t*>(_bit_shuffle_ptr->get_data(0));
+    memcpy(refs, data_array + _bit_shuffle_ptr->_cur_index, max_fetch * sizeof(uint32_t));
+    _bit_shuffle_ptr->_cur_index += max_fetch;
+    return Status::OK();
+}
+
 Status BinaryDictPageDecoder::read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal,
                                              size_t* n, vectorized::MutableColumnPtr& dst) {
     if (_encoding_type == PLAIN_ENCODING) {
@@ -121,6 +121,9 @@ public:
     Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
                           vectorized::MutableColumnPtr& dst) override;
 
+    // The references are the codes of the dictionary.
+    Status next_encoded_refs(size_t* n, uint32_t* refs) override;
+
     size_t count() const override { return _data_page_decoder->count(); }
 
     size_t current_index() const override { return _data_page_decoder->current_index(); }
@@ -28,6 +28,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/status.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/bitshuffle_wrapper.h"
@@ -314,17 +315,22 @@ public:
 
     Status init() override {
         CHECK(!_parsed);
-        size_t unused;
-        RETURN_IF_ERROR(parse_bit_shuffle_header(_data, _num_elements, unused,
+        size_t compressed_size;
+        RETURN_IF_ERROR(parse_bit_shuffle_header(_data, _num_elements, compressed_size,
                                                  _num_element_after_padding, _size_of_element));
 
         if (_data.size !=
             _num_element_after_padding * _size_of_element + BITSHUFFLE_PAGE_HEADER_SIZE) {
-            std::stringstream ss;
-            ss << "Size information unmatched, _data.size:" << _data.size
-               << ", _num_elements:" << _num_elements << ", expected size is "
-               << _num_element_after_padding * _size_of_element + BITSHUFFLE_PAGE_HEADER_SIZE;
-            return Status::InternalError(ss.str());
+            // BitShufflePagePreDecoder keeps the page encoded when
+            // `enable_bitshuffle_fused_page_decode` is true.
+            if (!config::enable_bitshuffle_fused_page_decode || compressed_size != _data.size) {
+                std::stringstream ss;
+                ss << "Size information unmatched, _data.size:" << _data.size
+                   << ", _num_elements:" << _num_elements << ", expected size is "
+                   << _num_element_after_padding * _size_of_element + BITSHUFFLE_PAGE_HEADER_SIZE;
+                return Status::InternalError(ss.str());
+            }
+            _encoded = true;
         }
 
         // Currently, only the UINT32 block encoder supports expanding size:
@@ -338,6 +344,14 @@ public:
             return Status::InternalError("invalid size info. size of element:{}, SIZE_OF_TYPE:{}",
                                          _size_of_element, SIZE_OF_TYPE);
         }
+        if (_encoded) {
+            if (UNLIKELY(_size_of_element != SIZE_OF_TYPE)) {
+                return Status::InternalError(
+                        "invalid size info of encoded page. size of element:{}, SIZE_OF_TYPE:{}",
+                        _size_of_element, SIZE_OF_TYPE);
+            }
+            RETURN_IF_ERROR(_parse_blocks());
+        }
         _parsed = true;
         return Status::OK();
     }
@@ -379,7 +393,7 @@ public:
         // - left == _num_elements when not found (all values < target)
         while (left < right) {
             size_t mid = left + (right - left) / 2;
-            mid_value = get_data(mid);
+            RETURN_IF_ERROR(_get_value(mid, &mid_value));
             if (TypeTraits<Type>::cmp(mid_value, value) < 0) {
                 left = mid + 1;
             } else {
@@ -389,7 +403,8 @@ public:
         if (left >= _num_elements) {
             return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("all value small than the value");
         }
-        void* find_value = get_data(left);
+        void* find_value = nullptr;
+        RETURN_IF_ERROR(_get_value(left, &find_value));
         if (TypeTraits<Type>::cmp(find_value, value) == 0) {
             *exact_match = true;
         } else {
@@ -410,7 +425,11 @@ public:
 
         size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
 
-        dst->insert_many_fix_len_data(get_data(_cur_index), max_fetch);
+        if (_encoded) {
+            RETURN_IF_ERROR(_insert_encoded_values(_cur_index, max_fetch, dst));
+        } else {
+            dst->insert_many_fix_len_data(get_data(_cur_index), max_fetch);
+        }
         *n = max_fetch;
         if constexpr (forward_index) {
             _cur_index += max_fetch;
@@ -440,7 +459,13 @@ public:
                 break;
             }
 
-            _buffer[read_count++] = *reinterpret_cast<CppType*>(get_data(ord));
+            if (_encoded) {
+                void* value = nullptr;
+                RETURN_IF_ERROR(_get_value(ord, &value));
+                _buffer[read_count++] = *reinterpret_cast<CppType*>(value);
+            } else {
+                _buffer[read_count++] = *reinterpret_cast<CppType*>(get_data(ord));
+            }
         }
 
         if (LIKELY(read_count > 0)) {
@@ -468,6 +493,73 @@ private:
         memcpy(data, get_data(_cur_index), n * SIZE_OF_TYPE);
     }
 
+    // The elements of an encoded page are bitshuffled and lz4 compressed in blocks of
+    // `_block_elems` elements, the last block may be shorter. Each block is prefixed by its
+    // compressed size as a 32-bit big-endian int.
+    Status _parse_blocks() {
+        _block_elems = bitshuffle::default_block_size(SIZE_OF_TYPE);
+        const size_t num_blocks = (_num_element_after_padding + _block_elems - 1) / _block_elems;
+        _block_offsets.resize(num_blocks);
+        size_t offset = BITSHUFFLE_PAGE_HEADER_SIZE;
+        for (size_t i = 0; i < num_blocks; ++i) {
+            if (offset + 4 > _data.size) [[unlikely]] {
+                return Status::Corruption("invalid bitshuffle block {} at offset {}, data size:{}",
+                                          i, offset, _data.size);
+            }
+            const auto* header = reinterpret_cast<const uint8_t*>(&_data.data[offset]);
+            const uint32_t block_size = (uint32_t(header[0]) << 24) | (uint32_t(header[1]) << 16) |
+                                        (uint32_t(header[2]) << 8) | uint32_t(header[3]);
+            _block_offsets[i] = offset;
+            offset += 4 + block_size;
+        }
+        if (offset != _data.size) [[unlikely]] {
+            return Status::Corruption("bitshuffle blocks end at {}, data size:{}", offset,
+                                      _data.size);
+        }
+        _block_buf.resize(_block_elems * SIZE_OF_TYPE);
+        _decoded_block = num_blocks;
+        return Status::OK();
+    }
+
+    // Decompress and unshuffle one block into `_block_buf`, which is small enough to stay in the
+    // CPU cache until its values are copied out.
+    Status _decode_block(size_t block) {
+        if (block == _decoded_block) {
+            return Status::OK();
+        }
+        const size_t n = std::min(_block_elems, _num_element_after_padding - block * _block_elems);
+        auto bytes = bitshuffle::decompress_lz4(&_data.data[_block_offsets[block]],
+                                                _block_buf.data(), n, SIZE_OF_TYPE, n);
+        if (bytes < 0) [[unlikely]] {
+            warn_with_bitshuffle_error(bytes);
+            return Status::RuntimeError("Unshuffle Process failed");
+        }
+        _decoded_block = block;
+        return Status::OK();
+    }
+
+    Status _get_value(size_t index, void** value) {
+        if (!_encoded) {
+            *value = get_data(index);
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_decode_block(index / _block_elems));
+        *value = &_block_buf[(index % _block_elems) * SIZE_OF_TYPE];
+        return Status::OK();
+    }
+
+    Status _insert_encoded_values(size_t index, size_t n, vectorized::MutableColumnPtr& dst) {
+        while (n > 0) {
+            const size_t offset = index % _block_elems;
+            const size_t count = std::min(n, _block_elems - offset);
+            RETURN_IF_ERROR(_decode_block(index / _block_elems));
+            dst->insert_many_fix_len_data(&_block_buf[offset * SIZE_OF_TYPE], count);
+            index += count;
+            n -= count;
+        }
+        return Status::OK();
+    }
+
     using CppType = typename TypeTraits<Type>::CppType;
 
     enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
@@ -483,6 +575,13 @@ private:
 
     std::vector<std::conditional_t<std::is_same_v<CppType, bool>, uint8_t, CppType>> _buffer;
 
+    // Set if the page is still encoded, its blocks are decoded one at a time when read.
+    bool _encoded = false;
+    size_t _block_elems = 0;
+    std::vector<size_t> _block_offsets;
+    std::vector<char> _block_buf;
+    size_t _decoded_block = 0;
+
     friend class BinaryDictPageDecoder;
 };
 
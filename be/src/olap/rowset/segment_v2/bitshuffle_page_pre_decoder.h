@@ -63,6 +63,16 @@ struct BitShufflePagePreDecoder : public DataPagePreDecoder {
                     compressed_size, num_elements, data.size);
         }
 
+        if constexpr (!USED_IN_DICT_ENCODING) {
+            // Let BitShufflePageDecoder decode the blocks when they are read, unless the encoded
+            // page could be taken for a decoded one.
+            if (config::enable_bitshuffle_fused_page_decode &&
+                data.size != BITSHUFFLE_PAGE_HEADER_SIZE +
+                                     num_element_after_padding * size_of_element) {
+                return Status::OK();
+            }
+        }
+
         Slice decoded_slice;
         decoded_slice.size = size_of_dict_header + BITSHUFFLE_PAGE_HEADER_SIZE +
                              num_element_after_padding * size_of_element + size_of_tail;
@@ -87,6 +87,9 @@ int64_t decompress_lz4(void* in, void* out, size_t size, size_t elem_size, size_
 size_t compress_lz4_bound(size_t size, size_t elem_size, size_t block_size) {
     return g_bshuf_compress_lz4_bound(size, elem_size, block_size);
 }
+size_t default_block_size(size_t elem_size) {
+    return bshuf_default_block_size(elem_size);
+}
 
 } // namespace bitshuffle
 } // namespace doris
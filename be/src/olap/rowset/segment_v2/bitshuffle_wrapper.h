@@ -29,6 +29,8 @@ namespace bitshuffle {
 size_t compress_lz4_bound(size_t size, size_t elem_size, size_t block_size);
 int64_t compress_lz4(void* in, void* out, size_t size, size_t elem_size, size_t block_size);
 int64_t decompress_lz4(void* in, void* out, size_t size, size_t elem_size, size_t block_size);
+// The number of elements of the blocks compressed independently when `block_size` is 0.
+size_t default_block_size(size_t elem_size);
 
 } // namespace bitshuffle
 } // namespace doris
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <utility>
@@ -55,6 +56,7 @@
 #include "olap/rowset/segment_v2/page_pointer.h" // for PagePointer
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
 #include "olap/rowset/segment_v2/variant/variant_column_reader.h"
 #include "olap/rowset/segment_v2/zone_map_index.h"
 #include "olap/tablet_schema.h"
@@ -74,6 +76,7 @@
 #include "vec/columns/column_struct.h"
 #include "vec/columns/column_variant.h"
 #include "vec/columns/column_vector.h"
+#include "vec/columns/predicate_column.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/common/string_ref.h"
@@ -547,7 +550,44 @@ bool ColumnReader::_zone_map_match_condition(const ZoneMapPB& zone_map,
         return true;
     }
 
-    return col_predicates->evaluate_and({min_value_container, max_value_container});
+    return col_predicates->evaluate_and({min_value_container, max_value_container}) &&
+           _zone_map_values_match_condition(zone_map, col_predicates);
+}
+
+bool ColumnReader::_zone_map_values_match_condition(
+        const ZoneMapPB& zone_map, const AndBlockColumnPredicate* col_predicates) const {
+    if (zone_map.distinct_values_size() == 0) {
+        return true;
+    }
+    std::set<const ColumnPredicate*> predicate_set;
+    col_predicates->get_all_column_predicate(predicate_set);
+    std::vector<const ColumnPredicate*> predicates;
+    for (const auto* pred : predicate_set) {
+        // A zone of a single value is evaluated exactly by these predicates, and they never
+        // select null, so the null rows of the zone do not matter.
+        if ((PredicateTypeTraits::is_comparison(pred->type()) ||
+             PredicateTypeTraits::is_list(pred->type())) &&
+            !pred->opposite()) {
+            predicates.push_back(pred);
+        }
+    }
+    if (predicates.empty()) {
+        return true;
+    }
+    std::unique_ptr<WrapperField> value(
+            WrapperField::create_by_type(_type_info->type(), _meta_length));
+    for (const auto& value_string : zone_map.distinct_values()) {
+        if (!value->from_string(value_string).ok()) {
+            return true;
+        }
+        value->set_not_null();
+        if (std::all_of(predicates.begin(), predicates.end(), [&](const ColumnPredicate* pred) {
+                return pred->evaluate_and({value.get(), value.get()});
+            })) {
+            return true;
+        }
+    }
+    return false;
 }
 
 Status ColumnReader::_get_filtered_pages(
@@ -1252,7 +1292,7 @@ Status FileColumnIterator::seek_to_ordinal(ordinal_t ord) {
     // if current page contains this row, we don't need to seek
     if (!_page || !_page.contains(ord) || !_page_iter.valid()) {
         RETURN_IF_ERROR(_reader->seek_at_or_before(ord, &_page_iter, _opts));
-        RETURN_IF_ERROR(_read_data_page(_page_iter));
+        RETURN_IF_ERROR(_read_data_page(_page_iter, &_page));
     }
     RETURN_IF_ERROR(_seek_to_pos_in_page(&_page, ord - _page.first_ordinal));
     _current_ordinal = ord;
@@ -1440,13 +1480,14 @@ Status FileColumnIterator::_load_next_page(bool* eos) {
         return Status::OK();
     }
 
-    RETURN_IF_ERROR(_read_data_page(_page_iter));
+    RETURN_IF_ERROR(_read_data_page(_page_iter, &_page));
     RETURN_IF_ERROR(_seek_to_pos_in_page(&_page, 0));
     *eos = false;
     return Status::OK();
 }
 
-Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
+Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter,
+                                           ParsedPage* page) {
     PageHandle handle;
     Slice page_body;
     PageFooterPB footer;
@@ -1456,7 +1497,7 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     // parse data page
     RETURN_IF_ERROR(ParsedPage::create(std::move(handle), page_body, footer.data_page_footer(),
                                        _reader->encoding_info(), iter.page(), iter.page_index(),
-                                       &_page));
+                                       page));
 
     // dictionary page is read when the first data page that uses it is read,
     // this is to optimize the memory usage: when there is no query on one column, we could
@@ -1464,7 +1505,7 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     // note that concurrent iterators for the same column won't repeatedly read dictionary page
     // because of page cache.
     if (_reader->encoding_info()->encoding() == DICT_ENCODING) {
-        auto dict_page_decoder = reinterpret_cast<BinaryDictPageDecoder*>(_page.data_decoder.get());
+        auto dict_page_decoder = reinterpret_cast<BinaryDictPageDecoder*>(page->data_decoder.get());
         if (dict_page_decoder->is_dict_encoding()) {
             if (_dict_decoder == nullptr) {
                 RETURN_IF_ERROR(_read_dict_data());
@@ -1534,6 +1575,184 @@ Status FileColumnIterator::get_row_ranges_by_dict(const AndBlockColumnPredicate*
     return Status::OK();
 }
 
+// Evaluate the predicates on every value of `values` in chunks, a predicate selects at most
+// 65535 rows at a time. `matches[offset + i]` is set to 1 if values[i] satisfies them all.
+static void evaluate_encoded_values(const std::vector<const ColumnPredicate*>& predicates,
+                                    const vectorized::IColumn& values, size_t offset,
+                                    std::vector<uint8_t>* matches) {
+    const auto size = cast_set<uint16_t>(values.size());
+    std::vector<uint16_t> sel(size);
+    std::iota(sel.begin(), sel.end(), uint16_t(0));
+    uint16_t selected = size;
+    for (const auto* pred : predicates) {
+        selected = pred->evaluate(values, sel.data(), selected);
+    }
+    for (uint16_t i = 0; i < selected; ++i) {
+        (*matches)[offset + sel[i]] = 1;
+    }
+}
+
+Status FileColumnIterator::get_row_ranges_by_encoded_pages(
+        const AndBlockColumnPredicate* col_predicates, RowRanges* row_ranges) {
+    const auto encoding = _reader->encoding_info()->encoding();
+    const auto type = _reader->get_meta_type();
+    const bool is_dict_strings = encoding == DICT_ENCODING &&
+                                 (type == FieldType::OLAP_FIELD_TYPE_VARCHAR ||
+                                  type == FieldType::OLAP_FIELD_TYPE_STRING);
+    const bool is_rle_bools = encoding == RLE && type == FieldType::OLAP_FIELD_TYPE_BOOL;
+    if (row_ranges->is_empty() || (!is_dict_strings && !is_rle_bools)) {
+        return Status::OK();
+    }
+    std::set<const ColumnPredicate*> predicate_set;
+    col_predicates->get_all_column_predicate(predicate_set);
+    std::vector<const ColumnPredicate*> predicates;
+    for (const auto* pred : predicate_set) {
+        // Only the predicates never selecting null are used, the null rows are dropped
+        // without looking at them. The runtime filters judge their selectivity on the
+        // rows they see, the shared values would mislead them.
+        if ((PredicateTypeTraits::is_comparison(pred->type()) ||
+             PredicateTypeTraits::is_list(pred->type())) &&
+            !pred->opposite() && !pred->is_runtime_filter()) {
+            predicates.push_back(pred);
+        }
+    }
+    if (predicates.empty()) {
+        return Status::OK();
+    }
+
+    static constexpr size_t MAX_VALUES_PER_EVALUATION = 4096;
+    RowRanges result;
+    auto add_rows = [&](ordinal_t from, ordinal_t to) {
+        result.add(RowRange(cast_set<int64_t>(from), cast_set<int64_t>(to)));
+    };
+    // the matches of the dictionary words, evaluated once for all the pages
+    std::vector<uint8_t> dict_matches;
+    std::vector<uint8_t> page_matches;
+    std::vector<uint32_t> refs;
+    OrdinalPageIndexIterator iter;
+    for (size_t i = 0; i < row_ranges->range_size(); ++i) {
+        const auto from = cast_set<ordinal_t>(row_ranges->get_range_from(i));
+        const auto to = cast_set<ordinal_t>(row_ranges->get_range_to(i));
+        RETURN_IF_ERROR(_reader->seek_at_or_before(from, &iter, _opts));
+        for (; iter.valid() && iter.first_ordinal() < to; iter.next()) {
+            const ordinal_t page_from = std::max(from, iter.first_ordinal());
+            const ordinal_t page_to = std::min(to, iter.last_ordinal() + 1);
+            ParsedPage page;
+            RETURN_IF_ERROR(_read_data_page(iter, &page));
+            const std::vector<uint8_t>* matches = nullptr;
+            if (is_dict_strings) {
+                auto* dict_page = reinterpret_cast<BinaryDictPageDecoder*>(page.data_decoder.get());
+                if (!dict_page->is_dict_encoding()) {
+                    add_rows(page_from, page_to);
+                    continue;
+                }
+                if (dict_matches.empty()) {
+                    const auto dict_size = cast_set<uint32_t>(_dict_decoder->count());
+                    dict_matches.assign(dict_size, 0);
+                    for (uint32_t start = 0; start < dict_size;
+                         start += MAX_VALUES_PER_EVALUATION) {
+                        const auto num = std::min<size_t>(dict_size - start,
+                                                          MAX_VALUES_PER_EVALUATION);
+                        auto words = vectorized::PredicateColumnType<TYPE_STRING>::create();
+                        words->insert_many_strings(_dict_word_info.get() + start, num);
+                        evaluate_encoded_values(predicates, *words, start, &dict_matches);
+                    }
+                }
+                matches = &dict_matches;
+            } else {
+                vectorized::MutableColumnPtr values =
+                        vectorized::PredicateColumnType<TYPE_BOOLEAN>::create();
+                auto st = page.data_decoder->read_encoded_values(values);
+                if (st.is<ErrorCode::NOT_IMPLEMENTED_ERROR>() ||
+                    values->size() > MAX_VALUES_PER_EVALUATION) {
+                    add_rows(page_from, page_to);
+                    continue;
+                }
+                RETURN_IF_ERROR(st);
+                page_matches.assign(values->size(), 0);
+                evaluate_encoded_values(predicates, *values, 0, &page_matches);
+                matches = &page_matches;
+            }
+
+            // The data decoder holds the non null values only, walk the null runs from
+            // the start of the page to find the values of the rows.
+            ordinal_t ord = page.first_ordinal;
+            size_t value_pos = 0;
+            while (ord < page_to) {
+                bool is_null = false;
+                size_t run = page_to - ord;
+                if (page.has_null) {
+                    run = page.null_decoder.GetNextRun(&is_null, run);
+                    if (run == 0) {
+                        return Status::Corruption("file corruption: null map of page {} ends at {}",
+                                                  iter.page_index(), ord);
+                    }
+                }
+                if (is_null || ord + run <= page_from) {
+                    value_pos += is_null ? 0 : run;
+                    ord += run;
+                    continue;
+                }
+                const ordinal_t start = std::max(ord, page_from);
+                value_pos += start - ord;
+                size_t n = ord + run - start;
+                refs.resize(n);
+                RETURN_IF_ERROR(page.data_decoder->seek_to_position_in_page(value_pos));
+                RETURN_IF_ERROR(page.data_decoder->next_encoded_refs(&n, refs.data()));
+                for (size_t k = 0; k < n; ++k) {
+                    if (refs[k] >= matches->size()) {
+                        return Status::Corruption(
+                                "file corruption: invalid encoded value {} in page {}", refs[k],
+                                iter.page_index());
+                    }
+                }
+                for (size_t k = 0; k < n;) {
+                    if (!(*matches)[refs[k]]) {
+                        ++k;
+                        continue;
+                    }
+                    size_t end = k + 1;
+                    while (end < n && (*matches)[refs[end]]) {
+                        ++end;
+                    }
+                    add_rows(start + k, start + end);
+                    k = end;
+                }
+                value_pos += n;
+                ord += run;
+            }
+        }
+    }
+    *row_ranges = std::move(result);
+    return Status::OK();
+}
+
+Status FileColumnIterator::collect_prefetch_pages(const RowRanges& row_ranges,
+                                                  SegmentPrefetcher* prefetcher) {
+    std::vector<PagePointer> pages;
+    std::vector<ordinal_t> first_ordinals;
+    std::vector<ordinal_t> last_ordinals;
+    int32_t last_page_index = -1;
+    OrdinalPageIndexIterator iter;
+    for (size_t i = 0; i < row_ranges.range_size(); ++i) {
+        const auto from = cast_set<ordinal_t>(row_ranges.get_range_from(i));
+        const auto to = cast_set<ordinal_t>(row_ranges.get_range_to(i));
+        RETURN_IF_ERROR(_reader->seek_at_or_before(from, &iter, _opts));
+        for (; iter.valid() && iter.first_ordinal() < to; iter.next()) {
+            // adjacent row ranges may fall into the same page
+            if (iter.page_index() <= last_page_index) {
+                continue;
+            }
+            last_page_index = iter.page_index();
+            pages.push_back(iter.page());
+            first_ordinals.push_back(iter.first_ordinal());
+            last_ordinals.push_back(iter.last_ordinal());
+        }
+    }
+    prefetcher->add_column_pages(pages, first_ordinals, last_ordinals);
+    return Status::OK();
+}
+
 Status DefaultValueColumnIterator::init(const ColumnIteratorOptions& opts) {
     _opts = opts;
     // be consistent with segment v1
@@ -81,6 +81,7 @@ class InvertedIndexReader;
 class IndexFileReader;
 class PageDecoder;
 class RowRanges;
+class SegmentPrefetcher;
 class ZoneMapIndexReader;
 class IndexIterator;
 
@@ -256,6 +257,11 @@ private:
                                    WrapperField* max_value_container,
                                    const AndBlockColumnPredicate* col_predicates) const;
 
+    // Whether one of the distinct values kept in the zone map satisfies the predicates,
+    // true if the zone map keeps no values.
+    bool _zone_map_values_match_condition(const ZoneMapPB& zone_map,
+                                          const AndBlockColumnPredicate* col_predicates) const;
+
     Status _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                            WrapperField* max_value_container) const;
 
@@ -363,8 +369,21 @@ public:
         return Status::OK();
     }
 
+    // remove the rows not satisfying `col_predicates` from `row_ranges` by evaluating the
+    // predicates on the encoded data pages, without decoding the values
+    virtual Status get_row_ranges_by_encoded_pages(const AndBlockColumnPredicate* col_predicates,
+                                                   RowRanges* row_ranges) {
+        return Status::OK();
+    }
+
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // add the data pages holding `row_ranges` to `prefetcher`
+    virtual Status collect_prefetch_pages(const RowRanges& row_ranges,
+                                          SegmentPrefetcher* prefetcher) {
+        return Status::OK();
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -404,16 +423,24 @@ public:
     Status get_row_ranges_by_dict(const AndBlockColumnPredicate* col_predicates,
                                   RowRanges* row_ranges) override;
 
+    // Predicates are evaluated once per dictionary word on dictionary encoded pages and once
+    // per run on RLE pages. The rows of the pages not supporting it are kept.
+    Status get_row_ranges_by_encoded_pages(const AndBlockColumnPredicate* col_predicates,
+                                           RowRanges* row_ranges) override;
+
     ParsedPage* get_current_page() { return &_page; }
 
     bool is_nullable() { return _reader->is_nullable(); }
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    Status collect_prefetch_pages(const RowRanges& row_ranges,
+                                  SegmentPrefetcher* prefetcher) override;
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
-    Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    Status _read_data_page(const OrdinalPageIndexIterator& iter, ParsedPage* page);
     Status _read_dict_data();
 
     std::shared_ptr<ColumnReader> _reader = nullptr;
@@ -45,6 +45,7 @@
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/rle_encoding.h"
+#include "util/stopwatch.hpp"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_agg_state.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -430,6 +431,19 @@ ScalarColumnWriter::~ScalarColumnWriter() {
 
 Status ScalarColumnWriter::init() {
     RETURN_IF_ERROR(get_block_compression_codec(_opts.meta->compression(), &_compress_codec));
+    // The columns stored without compression on purpose are left as they are.
+    if (config::enable_adaptive_column_compression && _compress_codec != nullptr &&
+        config::adaptive_column_compression_sample_pages > 0) {
+        for (auto type : {_opts.meta->compression(), LZ4F, ZSTD}) {
+            if (std::any_of(_compression_candidates.begin(), _compression_candidates.end(),
+                            [type](const auto& c) { return c.type == type; })) {
+                continue;
+            }
+            CompressionCandidate candidate {.type = type};
+            RETURN_IF_ERROR(get_block_compression_codec(type, &candidate.codec));
+            _compression_candidates.push_back(candidate);
+        }
+    }
 
     PageBuilder* page_builder = nullptr;
 
@@ -615,6 +629,9 @@ Status ScalarColumnWriter::finish() {
 }
 
 Status ScalarColumnWriter::write_data() {
+    if (!_compression_candidates.empty()) {
+        RETURN_IF_ERROR(_choose_compression());
+    }
     for (auto& page : _pages) {
         RETURN_IF_ERROR(_write_data_page(page.get()));
     }
@@ -729,8 +746,12 @@ Status ScalarColumnWriter::finish_current_page() {
     }
     // trying to compress page body
     OwnedSlice compressed_body;
-    RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving,
-                                               body, &compressed_body));
+    if (_compression_candidates.empty()) {
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+    } else {
+        RETURN_IF_ERROR(_sample_compression(body));
+    }
     if (compressed_body.slice().empty()) {
         // page body is uncompressed
         page->data.emplace_back(std::move(encoded_values));
@@ -742,6 +763,75 @@ Status ScalarColumnWriter::finish_current_page() {
 
     _push_back_page(std::move(page));
     _first_rowid = _next_rowid;
+    if (!_compression_candidates.empty() &&
+        _sampled_pages >= config::adaptive_column_compression_sample_pages) {
+        RETURN_IF_ERROR(_choose_compression());
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::_sample_compression(const std::vector<Slice>& body) {
+    const size_t uncompressed_size = Slice::compute_total_size(body);
+    _sampled_bytes += uncompressed_size;
+    ++_sampled_pages;
+    for (auto& candidate : _compression_candidates) {
+        OwnedSlice compressed;
+        MonotonicStopWatch watch;
+        watch.start();
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                candidate.codec, _opts.compression_min_space_saving, body, &compressed));
+        candidate.compress_ns += static_cast<int64_t>(watch.elapsed_time());
+        // A page which does not save enough is stored uncompressed.
+        candidate.compressed_bytes +=
+                compressed.slice().empty() ? uncompressed_size : compressed.slice().size;
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::_choose_compression() {
+    // A codec compressing this many times slower than the table codec is not chosen, the pages
+    // are also decompressed slower.
+    static constexpr int64_t MAX_COMPRESS_SLOWDOWN = 4;
+    const auto& configured = _compression_candidates.front();
+    const CompressionCandidate* chosen = &configured;
+    for (const auto& candidate : _compression_candidates) {
+        if (static_cast<double>(candidate.compressed_bytes) <=
+                    static_cast<double>(chosen->compressed_bytes) *
+                            (1 - config::adaptive_column_compression_min_gain) &&
+            candidate.compress_ns <= std::max<int64_t>(configured.compress_ns, 1) *
+                                             MAX_COMPRESS_SLOWDOWN) {
+            chosen = &candidate;
+        }
+    }
+    CompressionTypePB type = chosen->type;
+    BlockCompressionCodec* codec = chosen->codec;
+    // Not worth the decompression if the best codec does not save enough.
+    if (_sampled_bytes == 0 || static_cast<double>(chosen->compressed_bytes) >
+                                       static_cast<double>(_sampled_bytes) *
+                                               (1 - _opts.compression_min_space_saving)) {
+        type = NO_COMPRESSION;
+        codec = nullptr;
+    }
+    _opts.meta->set_compression(type);
+    _compress_codec = codec;
+    _compression_candidates.clear();
+
+    for (auto& page : _pages) {
+        std::vector<Slice> body;
+        uint64_t uncompressed_size = 0;
+        for (const auto& data : page->data) {
+            body.push_back(data.slice());
+            uncompressed_size += data.slice().size;
+        }
+        OwnedSlice compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+        if (!compressed_body.slice().empty()) {
+            _data_size = _data_size - uncompressed_size + compressed_body.slice().size;
+            page->data.clear();
+            page->data.emplace_back(std::move(compressed_body));
+        }
+    }
     return Status::OK();
 }
 
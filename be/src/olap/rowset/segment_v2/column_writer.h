@@ -282,6 +282,18 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // Adaptive compression, see `enable_adaptive_column_compression`. The sampled pages are kept
+    // uncompressed until the codec is chosen.
+    struct CompressionCandidate {
+        CompressionTypePB type;
+        BlockCompressionCodec* codec = nullptr;
+        uint64_t compressed_bytes = 0;
+        int64_t compress_ns = 0;
+    };
+    Status _sample_compression(const std::vector<Slice>& body);
+    // Choose the codec of the column and compress the sampled pages with it.
+    Status _choose_compression();
+
 private:
     io::FileWriter* _file_writer = nullptr;
     // total size of data page list
@@ -293,6 +305,11 @@ private:
 
     BlockCompressionCodec* _compress_codec;
 
+    // Not empty while the pages are sampled, the table codec first.
+    std::vector<CompressionCandidate> _compression_candidates;
+    uint64_t _sampled_bytes = 0;
+    int32_t _sampled_pages = 0;
+
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
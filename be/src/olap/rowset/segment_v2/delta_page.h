@@ -0,0 +1,371 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "common/cast_set.h"
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/bit_util.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+enum { DELTA_PAGE_HEADER_SIZE = 32 };
+
+// Delta-of-delta encoding for the integers and timestamps which grow at a regular
+// interval, such as the sort key of a time series. The value i is
+//   value[i] = value[i - 1] + delta[i], delta[i] = delta[i - 1] + dod[i]
+// and only the delta of deltas `dod` are stored, a regular interval makes them 0.
+//
+// The page format is as follows:
+//
+// 1. Header: (32 bytes total)
+//
+//    <num_elements> [32-bit]
+//    <bit_width> [8-bit] <reserved> [24-bit]
+//    <first_value> [64-bit]
+//    <first_delta> [64-bit]
+//      value[1] - value[0], wrapped around.
+//    <min_dod> [64-bit]
+//      The minimum of the delta of deltas, they are stored as the offset to it.
+//
+// 2. The offsets of the delta of deltas of the values from the third one, bit-packed
+//    with <bit_width>.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+// The arithmetic is done on 64-bit unsigned integers, the overflow wraps around and
+// the values are truncated back to their type. The decoder decodes the whole page
+// in init(), like the bitshuffle decoder does, the seek in the page is then O(1).
+template <FieldType Type>
+class DeltaPageBuilder : public PageBuilderHelper<DeltaPageBuilder<Type>> {
+public:
+    using Self = DeltaPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _remain_element_capacity == 0; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        if (_remain_element_capacity == 0) {
+            *count = 0;
+            return Status::OK();
+        }
+        auto to_add =
+                cast_set<uint32_t>(std::min(cast_set<size_t>(_remain_element_capacity), *count));
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION({
+            const auto* values = reinterpret_cast<const CppType*>(vals);
+            _values.insert(_values.end(), values, values + to_add);
+        });
+        _remain_element_capacity -= to_add;
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        RETURN_IF_CATCH_EXCEPTION({ *slice = _finish(); });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.clear();
+            _values.reserve(_options.data_page_size / SIZE_OF_TYPE);
+            _buffer.clear();
+            _finished = false;
+            _remain_element_capacity =
+                    cast_set<uint32_t>(std::max<size_t>(_options.data_page_size / SIZE_OF_TYPE, 1));
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override {
+        return _finished ? _buffer.size() : _values.size() * SIZE_OF_TYPE;
+    }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(uint64_t));
+
+    DeltaPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    // Sign extend the signed types, so that a small negative delta is small.
+    static uint64_t _to_uint64(CppType value) {
+        if constexpr (std::is_signed_v<CppType>) {
+            return static_cast<uint64_t>(static_cast<int64_t>(value));
+        } else {
+            return static_cast<uint64_t>(value);
+        }
+    }
+
+    OwnedSlice _finish() {
+        const size_t num_elements = _values.size();
+        uint64_t first_value = num_elements > 0 ? _to_uint64(_values[0]) : 0;
+        uint64_t first_delta = num_elements > 1 ? _to_uint64(_values[1]) - first_value : 0;
+
+        std::vector<int64_t> dods(num_elements > 2 ? num_elements - 2 : 0);
+        int64_t min_dod = 0;
+        int64_t max_dod = 0;
+        uint64_t prev_delta = first_delta;
+        for (size_t i = 2; i < num_elements; ++i) {
+            const uint64_t delta = _to_uint64(_values[i]) - _to_uint64(_values[i - 1]);
+            dods[i - 2] = static_cast<int64_t>(delta - prev_delta);
+            prev_delta = delta;
+        }
+        if (!dods.empty()) {
+            const auto [min_it, max_it] = std::minmax_element(dods.begin(), dods.end());
+            min_dod = *min_it;
+            max_dod = *max_it;
+        }
+        const auto bit_width = cast_set<uint8_t>(BitUtil::Log2Floor64(
+                                                         static_cast<uint64_t>(max_dod) -
+                                                         static_cast<uint64_t>(min_dod)) +
+                                                 1);
+
+        _buffer.resize(DELTA_PAGE_HEADER_SIZE);
+        encode_fixed32_le(&_buffer[0], cast_set<uint32_t>(num_elements));
+        memset(&_buffer[4], 0, 4);
+        _buffer[4] = bit_width;
+        encode_fixed64_le(&_buffer[8], first_value);
+        encode_fixed64_le(&_buffer[16], first_delta);
+        encode_fixed64_le(&_buffer[24], static_cast<uint64_t>(min_dod));
+        if (bit_width > 0) {
+            faststring packed;
+            BitWriter writer(&packed);
+            for (auto dod : dods) {
+                writer.PutValue(static_cast<uint64_t>(dod) - static_cast<uint64_t>(min_dod),
+                                bit_width);
+            }
+            writer.Flush();
+            _buffer.append(packed.data(), packed.size());
+        }
+        _finished = true;
+        return _buffer.build();
+    }
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    PageBuilderOptions _options;
+    uint32_t _remain_element_capacity = 0;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buffer;
+};
+
+template <FieldType Type>
+class DeltaPageDecoder : public PageDecoder {
+public:
+    DeltaPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DELTA_PAGE_HEADER_SIZE) {
+            return Status::Corruption("file corruption: invalid data size:{}, header size:{}",
+                                      _data.size, DELTA_PAGE_HEADER_SIZE);
+        }
+        const auto* header = reinterpret_cast<const uint8_t*>(_data.data);
+        const uint32_t num_elements = decode_fixed32_le(header);
+        const uint8_t bit_width = header[4];
+        const uint64_t first_value = decode_fixed64_le(header + 8);
+        const uint64_t first_delta = decode_fixed64_le(header + 16);
+        const uint64_t min_dod = decode_fixed64_le(header + 24);
+        const size_t num_dods = num_elements > 2 ? num_elements - 2 : 0;
+        const size_t packed_size = (num_dods * bit_width + 7) / 8;
+        if (bit_width > 64 || _data.size != DELTA_PAGE_HEADER_SIZE + packed_size) {
+            return Status::Corruption(
+                    "file corruption: size information unmatched, data size:{}, "
+                    "num_elements:{}, bit_width:{}",
+                    _data.size, num_elements, bit_width);
+        }
+
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.resize(num_elements);
+            std::vector<uint64_t> deltas(num_dods);
+            if (bit_width > 0) {
+                BitPacking::UnpackValues(bit_width, header + DELTA_PAGE_HEADER_SIZE,
+                                         static_cast<int64_t>(packed_size),
+                                         static_cast<int64_t>(num_dods), deltas.data());
+            }
+            // Two prefix sums, the first one turns the delta of deltas into deltas.
+            uint64_t delta = first_delta;
+            for (size_t i = 0; i < num_dods; ++i) {
+                delta += deltas[i] + min_dod;
+                deltas[i] = delta;
+            }
+            if (num_elements > 0) {
+                uint64_t value = first_value;
+                _values[0] = static_cast<CppType>(value);
+                if (num_elements > 1) {
+                    value += first_delta;
+                    _values[1] = static_cast<CppType>(value);
+                }
+                for (size_t i = 0; i < num_dods; ++i) {
+                    value += deltas[i];
+                    _values[i + 2] = static_cast<CppType>(value);
+                }
+            }
+        });
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (_values.empty()) [[unlikely]] {
+            if (pos != 0) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                        "seek pos {} is larger than total elements  {}", pos, _values.size());
+            }
+        }
+        DCHECK_LE(pos, _values.size());
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        auto it = std::lower_bound(_values.begin(), _values.end(),
+                                   *reinterpret_cast<const CppType*>(value));
+        if (it == _values.end()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("all value small than the value");
+        }
+        *exact_match = *it == *reinterpret_cast<const CppType*>(value);
+        _cur_index = static_cast<size_t>(it - _values.begin());
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _values.size()) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        const size_t max_fetch = std::min(*n, _values.size() - _cur_index);
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_values[_cur_index]),
+                                      max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _values.size())) {
+                break;
+            }
+            _buffer[read_count++] = _values[ord];
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    std::vector<CppType> _values;
+    std::vector<CppType> _buffer;
+    // Index of the currently seeked element in the page.
+    size_t _cur_index = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
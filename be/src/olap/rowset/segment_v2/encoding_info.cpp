@@ -25,12 +25,15 @@
 #include <utility>
 
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/alp_page.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/binary_prefix_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/delta_page.h"
 #include "olap/rowset/segment_v2/frame_of_reference_page.h"
+#include "olap/rowset/segment_v2/fsst_page.h"
 #include "olap/rowset/segment_v2/plain_page.h"
 #include "olap/rowset/segment_v2/rle_page.h"
 #include "olap/types.h"
@@ -176,6 +179,46 @@ struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value &&
+                                                  !std::is_same<CppType, bool>::value &&
+                                                  sizeof(CppType) <= sizeof(uint64_t)>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return DeltaPageBuilder<type>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return AlpPageBuilder<type>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type>
+struct TypeEncodingTraits<type, FSST_ENCODING, Slice> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return FsstPageBuilder<type>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new FsstPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType field_type, EncodingTypePB encoding_type>
 struct EncodingTraits : TypeEncodingTraits<field_type, encoding_type,
                                            typename CppTypeTraits<field_type>::CppType> {
@@ -234,21 +277,27 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<FieldType::OLAP_FIELD_TYPE_TINYINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_TINYINT, FOR_ENCODING, true>();
     _add_map<FieldType::OLAP_FIELD_TYPE_TINYINT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_TINYINT, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_SMALLINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_SMALLINT, FOR_ENCODING, true>();
     _add_map<FieldType::OLAP_FIELD_TYPE_SMALLINT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_SMALLINT, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_INT, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_BIGINT, BIT_SHUFFLE>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_BIGINT, DELTA_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_INT, BIT_SHUFFLE>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_INT, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_LARGEINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_LARGEINT, PLAIN_ENCODING>();
@@ -256,21 +305,26 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, PREFIX_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, FSST_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, PREFIX_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, FSST_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, PREFIX_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_STRING, FSST_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_JSONB, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_JSONB, PLAIN_ENCODING>();
@@ -292,14 +346,17 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATEV2, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DECIMAL, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DECIMAL, PLAIN_ENCODING>();
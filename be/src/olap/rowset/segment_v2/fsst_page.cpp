@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+// The table is built from at most this many bytes of the page.
+static constexpr size_t FSST_SAMPLE_SIZE = 16 * 1024;
+// Every generation counts the symbols and the pairs of adjacent symbols in the sample
+// compressed with the previous table, the pairs become the candidates of longer symbols.
+static constexpr int FSST_GENERATIONS = 5;
+
+void FsstSymbolTable::build(const std::vector<Slice>& strings) {
+    std::vector<Slice> sample;
+    size_t total_size = 0;
+    for (const auto& s : strings) {
+        total_size += s.size;
+    }
+    // Take the strings evenly from the page.
+    const size_t step = std::max<size_t>(total_size / FSST_SAMPLE_SIZE, 1);
+    size_t sample_size = 0;
+    for (size_t i = 0; i < strings.size() && sample_size < FSST_SAMPLE_SIZE; i += step) {
+        sample.push_back(strings[i]);
+        sample_size += strings[i].size;
+    }
+
+    std::unordered_map<std::string, uint64_t> counts;
+    for (int generation = 0; generation < FSST_GENERATIONS; ++generation) {
+        counts.clear();
+        for (const auto& s : sample) {
+            const auto* data = reinterpret_cast<const uint8_t*>(s.data);
+            size_t pos = 0;
+            size_t prev_pos = 0;
+            size_t prev_len = 0;
+            while (pos < s.size) {
+                const uint8_t code = _find_longest_symbol(data + pos, s.size - pos);
+                const size_t len = code == ESCAPE_CODE ? 1 : _lengths[code];
+                counts[std::string(reinterpret_cast<const char*>(data + pos), len)]++;
+                if (prev_len > 0 && prev_len + len <= MAX_SYMBOL_LENGTH) {
+                    counts[std::string(reinterpret_cast<const char*>(data + prev_pos),
+                                       prev_len + len)]++;
+                }
+                prev_pos = pos;
+                prev_len = len;
+                pos += len;
+            }
+        }
+
+        std::vector<std::pair<uint64_t, const std::string*>> candidates;
+        candidates.reserve(counts.size());
+        for (const auto& [symbol, count] : counts) {
+            candidates.emplace_back(count * symbol.size(), &symbol);
+        }
+        const size_t num_candidates = std::min(candidates.size(), MAX_SYMBOLS);
+        std::partial_sort(candidates.begin(), candidates.begin() + num_candidates,
+                          candidates.end(), [](const auto& l, const auto& r) {
+                              return l.first != r.first ? l.first > r.first : *l.second < *r.second;
+                          });
+
+        _num_symbols = 0;
+        memset(_symbols, 0, sizeof(_symbols));
+        memset(_lengths, 0, sizeof(_lengths));
+        for (auto& codes : _codes_by_first_byte) {
+            codes.clear();
+        }
+        for (size_t i = 0; i < num_candidates; ++i) {
+            const auto& symbol = *candidates[i].second;
+            _add_symbol(reinterpret_cast<const uint8_t*>(symbol.data()), symbol.size());
+        }
+    }
+}
+
+void FsstSymbolTable::_add_symbol(const uint8_t* data, size_t len) {
+    DCHECK_LT(_num_symbols, MAX_SYMBOLS);
+    DCHECK_LE(len, MAX_SYMBOL_LENGTH);
+    const auto code = cast_set<uint8_t>(_num_symbols++);
+    memcpy(&_symbols[code], data, len);
+    _lengths[code] = cast_set<uint8_t>(len);
+    auto& codes = _codes_by_first_byte[data[0]];
+    codes.push_back(code);
+    std::stable_sort(codes.begin(), codes.end(),
+                     [this](uint8_t l, uint8_t r) { return _lengths[l] > _lengths[r]; });
+}
+
+uint8_t FsstSymbolTable::_find_longest_symbol(const uint8_t* data, size_t len) const {
+    for (uint8_t code : _codes_by_first_byte[data[0]]) {
+        if (_lengths[code] <= len && memcmp(&_symbols[code], data, _lengths[code]) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+size_t FsstSymbolTable::compress(const Slice& src, uint8_t* dst) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(src.data);
+    uint8_t* out = dst;
+    size_t pos = 0;
+    while (pos < src.size) {
+        const uint8_t code = _find_longest_symbol(data + pos, src.size - pos);
+        *out++ = code;
+        if (code == ESCAPE_CODE) {
+            *out++ = data[pos++];
+        } else {
+            pos += _lengths[code];
+        }
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+void FsstSymbolTable::serialize(faststring* buf) const {
+    buf->push_back(static_cast<char>(_num_symbols));
+    buf->append(_lengths, _num_symbols);
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        buf->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+Status FsstSymbolTable::deserialize(const Slice& data, size_t* consumed) {
+    if (data.size < 1) {
+        return Status::Corruption("file corruption: empty fsst symbol table");
+    }
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data);
+    _num_symbols = ptr[0];
+    if (_num_symbols > MAX_SYMBOLS || data.size < 1 + _num_symbols) {
+        return Status::Corruption("file corruption: invalid fsst symbol table, symbols:{}, size:{}",
+                                  _num_symbols, data.size);
+    }
+    size_t pos = 1 + _num_symbols;
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        const uint8_t len = ptr[1 + code];
+        if (len == 0 || len > MAX_SYMBOL_LENGTH || pos + len > data.size) {
+            return Status::Corruption("file corruption: invalid fsst symbol {}, length:{}", code,
+                                      len);
+        }
+        _lengths[code] = len;
+        memcpy(&_symbols[code], ptr + pos, len);
+        pos += len;
+    }
+    *consumed = pos;
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,395 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common/cast_set.h"
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+#include "vec/common/unaligned.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+// FSST (fast static symbol table) replaces the frequent substrings of up to 8 bytes
+// with 1-byte codes. The table of a page has at most 255 symbols, the code 255 is an
+// escape followed by a literal byte.
+class FsstSymbolTable {
+public:
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+    static constexpr uint8_t ESCAPE_CODE = 255;
+
+    FsstSymbolTable() { memset(_lengths, 0, sizeof(_lengths)); }
+
+    // Build the table from a sample of `strings`.
+    void build(const std::vector<Slice>& strings);
+
+    // Compress `src` into `dst` and return the compressed size, `dst` must have space
+    // for 2 * src.size bytes.
+    size_t compress(const Slice& src, uint8_t* dst) const;
+
+    void serialize(faststring* buf) const;
+
+    // `consumed` is the size of the table in `data`.
+    Status deserialize(const Slice& data, size_t* consumed);
+
+    // Decompress `len` bytes of `src` into `dst`, and return the decompressed size.
+    // Every code writes 8 bytes, `dst` must have space for 8 * len bytes.
+    size_t decompress(const uint8_t* src, size_t len, uint8_t* dst) const {
+        const uint8_t* end = src + len;
+        uint8_t* out = dst;
+        while (src < end) {
+            const uint8_t code = *src++;
+            if (code == ESCAPE_CODE) [[unlikely]] {
+                if (src == end) [[unlikely]] {
+                    break;
+                }
+                *out++ = *src++;
+            } else {
+                unaligned_store<uint64_t>(out, _symbols[code]);
+                out += _lengths[code];
+            }
+        }
+        return static_cast<size_t>(out - dst);
+    }
+
+    size_t num_symbols() const { return _num_symbols; }
+
+private:
+    void _add_symbol(const uint8_t* data, size_t len);
+    // The code of the longest symbol which is a prefix of [data, data + len), or
+    // ESCAPE_CODE if there is none.
+    uint8_t _find_longest_symbol(const uint8_t* data, size_t len) const;
+
+    size_t _num_symbols = 0;
+    // The bytes of a symbol, zero padded, the unused codes have a length of 0.
+    uint64_t _symbols[256] = {};
+    uint8_t _lengths[256];
+    // The codes of each first byte, the longer symbols go first.
+    std::vector<uint8_t> _codes_by_first_byte[256];
+};
+
+// The page format is as follows:
+//
+// 1. Symbol table:
+//
+//    <num_symbols> [8-bit]
+//    <symbol_lengths> [8-bit each]
+//    <symbols> The bytes of the symbols, concatenated.
+//
+// 2. The compressed strings, concatenated.
+//
+// 3. Trailer, the same as the binary plain page:
+//
+//    <offsets> [32-bit each], the start of each compressed string in the page.
+//    <num_elements> [32-bit]
+//
+// A string can be decompressed on its own, so the seek is O(1).
+template <FieldType Type>
+class FsstPageBuilder : public PageBuilderHelper<FsstPageBuilder<Type>> {
+public:
+    using Self = FsstPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        DCHECK_GT(*count, 0);
+        size_t i = 0;
+        // If the page is full, should stop adding more items.
+        while (!is_page_full() && i < *count) {
+            const auto* src = reinterpret_cast<const Slice*>(vals);
+            _raw_offsets.push_back(cast_set<uint32_t>(_raw_data.size()));
+            // This may need a large memory, should return error if could not allocated
+            // successfully, to avoid BE OOM.
+            RETURN_IF_CATCH_EXCEPTION(_raw_data.append(src->data, src->size));
+            _size_estimate += src->size + sizeof(uint32_t);
+            i++;
+            vals += sizeof(Slice);
+        }
+        *count = i;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        _finished = true;
+        RETURN_IF_CATCH_EXCEPTION({
+            const size_t num_elems = _raw_offsets.size();
+            std::vector<Slice> strings(num_elems);
+            for (size_t i = 0; i < num_elems; ++i) {
+                strings[i] = _raw_value_at(i);
+            }
+            FsstSymbolTable table;
+            table.build(strings);
+
+            _buffer.clear();
+            table.serialize(&_buffer);
+            std::vector<uint32_t> offsets(num_elems);
+            for (size_t i = 0; i < num_elems; ++i) {
+                offsets[i] = cast_set<uint32_t>(_buffer.size());
+                size_t orig_size = _buffer.size();
+                _buffer.resize(orig_size + 2 * strings[i].size);
+                _buffer.resize(orig_size + table.compress(strings[i], &_buffer[orig_size]));
+            }
+            for (uint32_t offset : offsets) {
+                put_fixed32_le(&_buffer, offset);
+            }
+            put_fixed32_le(&_buffer, cast_set<uint32_t>(num_elems));
+            if (num_elems > 0) {
+                const auto& first = strings[0];
+                const auto& last = strings[num_elems - 1];
+                _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+                _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+            }
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _raw_offsets.clear();
+            _raw_data.clear();
+            _raw_data.reserve(_options.data_page_size == 0 ? 1024 : _options.data_page_size);
+            _buffer.clear();
+            _size_estimate = sizeof(uint32_t);
+            _finished = false;
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _raw_offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_raw_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_raw_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+        return Status::OK();
+    }
+
+private:
+    FsstPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    Slice _raw_value_at(size_t idx) const {
+        const size_t end =
+                idx + 1 < _raw_offsets.size() ? _raw_offsets[idx + 1] : _raw_data.size();
+        return Slice(&_raw_data[_raw_offsets[idx]], end - _raw_offsets[idx]);
+    }
+
+    PageBuilderOptions _options;
+    // The strings are compressed in finish(), when the whole page is known.
+    faststring _raw_data;
+    std::vector<uint32_t> _raw_offsets;
+    faststring _buffer;
+    size_t _size_estimate = 0;
+    bool _finished = false;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+template <FieldType Type>
+class FsstPageDecoder : public PageDecoder {
+public:
+    FsstPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < sizeof(uint32_t)) {
+            return Status::Corruption(
+                    "file corruption: not enough bytes for trailer in FsstPageDecoder, "
+                    "invalid data size:{}",
+                    _data.size);
+        }
+        _num_elems = decode_fixed32_le(
+                reinterpret_cast<const uint8_t*>(&_data[_data.size - sizeof(uint32_t)]));
+        const size_t trailer_size = (static_cast<size_t>(_num_elems) + 1) * sizeof(uint32_t);
+        if (trailer_size > _data.size) {
+            return Status::Corruption(
+                    "file corruption: offsets pos beyonds data_size: {}, num_element: {}",
+                    _data.size, _num_elems);
+        }
+        _offsets_pos = cast_set<uint32_t>(_data.size - trailer_size);
+        size_t table_size = 0;
+        RETURN_IF_ERROR(_table.deserialize(Slice(_data.data, _offsets_pos), &table_size));
+        if (_num_elems > 0 && guarded_offset(0) < table_size) {
+            return Status::Corruption("file corruption: invalid first offset {}, table size {}",
+                                      guarded_offset(0), table_size);
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        if (_num_elems == 0) [[unlikely]] {
+            if (pos != 0) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                        "seek pos {} is larger than total elements  {}", pos, _num_elems);
+            }
+        }
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_idx >= _num_elems) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        _offsets.resize(max_fetch + 1);
+        _offsets[0] = 0;
+        uint32_t start = guarded_offset(_cur_idx);
+        for (size_t i = 0; i < max_fetch; ++i, ++_cur_idx) {
+            const uint32_t end = offset(_cur_idx + 1);
+            RETURN_IF_ERROR(_decompress(start, end, _offsets[i], &_offsets[i + 1]));
+            start = end;
+        }
+        dst->insert_many_continuous_binary_data(reinterpret_cast<const char*>(_decoded.data()),
+                                                _offsets.data(), max_fetch);
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        auto total = *n;
+        size_t read_count = 0;
+        _offsets.resize(total + 1);
+        _offsets[0] = 0;
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elems)) {
+                break;
+            }
+            RETURN_IF_ERROR(_decompress(offset(ord), offset(ord + 1), _offsets[read_count],
+                                        &_offsets[read_count + 1]));
+            read_count++;
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_continuous_binary_data(
+                    reinterpret_cast<const char*>(_decoded.data()), _offsets.data(), read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+private:
+    // Decompress the string in [start, end) of the page to `_decoded` at `pos`.
+    Status _decompress(uint32_t start, uint32_t end, uint32_t pos, uint32_t* next_pos) {
+        if (start > end || end > _offsets_pos) [[unlikely]] {
+            return Status::Corruption("file corruption: invalid string range [{}, {}) in {}",
+                                      start, end, _offsets_pos);
+        }
+        const size_t capacity = pos + (end - start) * FsstSymbolTable::MAX_SYMBOL_LENGTH;
+        if (_decoded.size() < capacity) {
+            _decoded.resize(std::max(capacity, _decoded.size() * 2));
+        }
+        const size_t len = _table.decompress(reinterpret_cast<const uint8_t*>(_data.data) + start,
+                                             end - start, _decoded.data() + pos);
+        *next_pos = cast_set<uint32_t>(pos + len);
+        return Status::OK();
+    }
+
+    // Return the offset within '_data' where the string value with index 'idx' can be found.
+    uint32_t offset(size_t idx) const {
+        if (idx >= _num_elems) {
+            return _offsets_pos;
+        }
+        return guarded_offset(idx);
+    }
+
+    uint32_t guarded_offset(size_t idx) const {
+        const auto* p =
+                reinterpret_cast<const uint8_t*>(&_data[_offsets_pos + idx * sizeof(uint32_t)]);
+        return decode_fixed32_le(p);
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+
+    uint32_t _num_elems = 0;
+    uint32_t _offsets_pos = 0;
+    FsstSymbolTable _table;
+
+    // The decompressed strings of the last batch.
+    faststring _decoded;
+    std::vector<uint32_t> _offsets;
+
+    // Index of the currently seeked element in the page.
+    size_t _cur_idx = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -148,6 +148,17 @@ public:
 
     const Slice& current_key() const { return _reader->get_key(cast_set<int>(_pos)); }
 
+    // Return true when `search_key` falls into the current entry, i.e. the
+    // current key is <= search_key and the next key (if any) is > search_key.
+    // seek_at_or_before(search_key) would then leave the iterator unchanged.
+    bool current_entry_covers(const Slice& search_key) const {
+        if (_pos >= _reader->count() || current_key().compare(search_key) > 0) {
+            return false;
+        }
+        return (_pos + 1) >= _reader->count() ||
+               _reader->get_key(cast_set<int>(_pos + 1)).compare(search_key) > 0;
+    }
+
     const PagePointer& current_page_pointer() const {
         return _reader->get_value(cast_set<int>(_pos));
     }
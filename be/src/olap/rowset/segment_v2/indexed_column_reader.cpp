@@ -51,6 +51,8 @@ static bvar::PerSecond<bvar::Adder<uint64_t>> g_index_reader_cached_pages_per_se
 static bvar::Adder<uint64_t> g_index_reader_seek_count("doris_pk", "index_reader_seek_count");
 static bvar::PerSecond<bvar::Adder<uint64_t>> g_index_reader_seek_per_second(
         "doris_pk", "index_reader_seek_per_second", &g_index_reader_seek_count, 60);
+static bvar::Adder<uint64_t> g_index_reader_seek_reuse_page_count(
+        "doris_pk", "index_reader_seek_reuse_page_count");
 static bvar::Adder<uint64_t> g_index_reader_pk_pages("doris_pk", "index_reader_pk_pages");
 static bvar::PerSecond<bvar::Adder<uint64_t>> g_index_reader_pk_bytes_per_second(
         "doris_pk", "index_reader_pk_pages_per_second", &g_index_reader_pk_pages, 60);
@@ -225,7 +227,16 @@ Status IndexedColumnIterator::seek_at_or_after(const void* key, bool* exact_matc
         // seek index to determine the data page to seek
         std::string encoded_key;
         _reader->_value_key_coder->full_encode_ascending(key, &encoded_key);
-        Status st = _value_iter.seek_at_or_before(encoded_key);
+        // Keys looked up in ascending order mostly land in the data page that
+        // is already loaded, skip the binary search over the index page then.
+        Status st = Status::OK();
+        if (_data_page && _current_iter == &_value_iter &&
+            _data_page.page_pointer == _value_iter.current_page_pointer() &&
+            _value_iter.current_entry_covers(encoded_key)) {
+            g_index_reader_seek_reuse_page_count << 1;
+        } else {
+            st = _value_iter.seek_at_or_before(encoded_key);
+        }
         if (st.is<ENTRY_NOT_FOUND>()) {
             // all keys in page is greater than `encoded_key`, point to the first page.
             // otherwise, we may missing some pages.
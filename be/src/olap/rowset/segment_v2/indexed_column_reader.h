@@ -144,6 +144,9 @@ public:
     // After one seek, we can only call this function once to read data
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst);
 
+    // Iterators may be kept across several lookups, each with its own statistics.
+    void set_stats(OlapReaderStatistics* stats) { _stats = stats; }
+
 private:
     Status _read_data_page(const PagePointer& pp);
 
@@ -80,9 +80,20 @@ bool BooleanQuery::should_use_skip() {
 void BooleanQuery::search_by_skiplist(const std::shared_ptr<roaring::Roaring>& result) {
     auto _next_doc = [](const auto& node) { return node->next_doc(); };
 
+    // Matched docs come in ascending order, adding them in batches lets roaring append
+    // to each container once per batch instead of locating it for every doc.
+    std::vector<uint32_t> docs;
+    docs.reserve(BATCH_SIZE);
     int32_t doc = 0;
     while ((doc = visit_node(_op, _next_doc)) != INT32_MAX) {
-        result->add(doc);
+        docs.push_back(static_cast<uint32_t>(doc));
+        if (docs.size() == BATCH_SIZE) {
+            result->addMany(docs.size(), docs.data());
+            docs.clear();
+        }
+    }
+    if (!docs.empty()) {
+        result->addMany(docs.size(), docs.data());
     }
 }
 
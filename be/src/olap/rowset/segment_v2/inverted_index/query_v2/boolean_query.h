@@ -46,6 +46,8 @@ public:
     };
 
 private:
+    static constexpr size_t BATCH_SIZE = 1024;
+
     bool should_use_skip();
     void search_by_skiplist(const std::shared_ptr<roaring::Roaring>& result);
     void search_by_bitmap(const std::shared_ptr<roaring::Roaring>& result);
@@ -43,9 +43,14 @@ public:
     }
 
     int32_t advance(int32_t target) const {
-        while (_iter != _end && *_iter < target) {
-            ++_iter;
+        if (_doc >= target) {
+            return _doc;
+        }
+        if (_iter == _end) {
+            _iter = _roaring->begin();
         }
+        // Seek inside the containers rather than stepping over every row id in between.
+        _iter.equalorlarger(static_cast<uint32_t>(target));
         _doc = (_iter != _end) ? *_iter : INT_MAX;
         return _doc;
     }
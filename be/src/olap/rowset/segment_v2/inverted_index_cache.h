@@ -106,7 +106,10 @@ private:
                 : LRUCachePolicy(CachePolicy::CacheType::INVERTEDINDEX_SEARCHER_CACHE, capacity,
                                  LRUCacheType::SIZE,
                                  config::inverted_index_cache_stale_sweep_time_sec, num_shards,
-                                 element_count_capacity, true) {}
+                                 element_count_capacity, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU) {}
         InvertedIndexSearcherCachePolicy(size_t capacity, uint32_t num_shards,
                                          uint32_t element_count_capacity,
                                          CacheValueTimeExtractor cache_value_time_extractor,
@@ -115,7 +118,10 @@ private:
                                  LRUCacheType::SIZE,
                                  config::inverted_index_cache_stale_sweep_time_sec, num_shards,
                                  element_count_capacity, cache_value_time_extractor,
-                                 cache_value_check_timestamp, true) {}
+                                 cache_value_check_timestamp, true,
+                                 config::enable_storage_cache_tiny_lfu
+                                         ? LRUCacheEvictionPolicy::TINY_LFU
+                                         : LRUCacheEvictionPolicy::LRU) {}
     };
     // Insert a cache entry by key.
     // And the cache entry will be returned in handle.
@@ -96,6 +96,15 @@ Result<bool> InvertedIndexIterator::has_null() {
     return reader->has_null();
 }
 
+Status InvertedIndexIterator::preload_searchers() {
+    for (const auto& entry : _readers) {
+        auto inverted_reader = std::static_pointer_cast<InvertedIndexReader>(entry.second);
+        InvertedIndexCacheHandle cache_handle;
+        RETURN_IF_ERROR(inverted_reader->handle_searcher_cache(_context, &cache_handle));
+    }
+    return Status::OK();
+}
+
 Status InvertedIndexIterator::try_read_from_inverted_index(const InvertedIndexReaderPtr& reader,
                                                            const std::string& column_name,
                                                            const void* query_value,
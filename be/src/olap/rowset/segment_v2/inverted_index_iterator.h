@@ -45,6 +45,9 @@ public:
 
     [[nodiscard]] Result<bool> has_null() override;
 
+    // Opens the searchers of all readers into the searcher cache ahead of the first query.
+    Status preload_searchers();
+
     IndexReaderPtr get_reader(IndexReaderType reader_type) const override;
 
 private:
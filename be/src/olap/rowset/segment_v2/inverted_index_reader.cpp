@@ -161,10 +161,11 @@ Status InvertedIndexReader::handle_searcher_cache(
         InvertedIndexCacheHandle* inverted_index_cache_handle) {
     auto index_file_key = _index_file_reader->get_index_file_cache_key(&_index_meta);
     InvertedIndexSearcherCache::CacheKey searcher_cache_key(index_file_key);
-    const auto& query_options = context->runtime_state->query_options();
 
+    // Without a runtime state the searcher is being preloaded, which always goes to the cache.
     bool cache_hit = false;
-    if (query_options.enable_inverted_index_searcher_cache) {
+    if (context->runtime_state == nullptr ||
+        context->runtime_state->query_options().enable_inverted_index_searcher_cache) {
         SCOPED_RAW_TIMER(&context->stats->inverted_index_lookup_timer);
         cache_hit = InvertedIndexSearcherCache::instance()->lookup(searcher_cache_key,
                                                                    inverted_index_cache_handle);
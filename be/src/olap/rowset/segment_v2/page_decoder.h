@@ -74,6 +74,23 @@ public:
         return Status::NotSupported("not implement vec op now");
     }
 
+    // Some encodings store every value as a reference to a value shared by many rows, such
+    // as a dictionary code or a RLE run. Predicates can be evaluated once per shared value
+    // on such a page, and the values of the rows not satisfying them are never decoded.
+    //
+    // Append the shared values of the page to `dst`. Dictionary encoded pages share the
+    // dictionary of the column and do not implement this, the caller reads the dictionary.
+    virtual Status read_encoded_values(vectorized::MutableColumnPtr& dst) {
+        return Status::NotSupported("read_encoded_values not supported");
+    }
+
+    // Return the references to the shared values of the next *n values from the current
+    // position in `refs`, and move forward the position. Return NotSupported if the page
+    // is not encoded with shared values.
+    virtual Status next_encoded_refs(size_t* n, uint32_t* refs) {
+        return Status::NotSupported("next_encoded_refs not supported");
+    }
+
     // Return the number of elements in this page.
     virtual size_t count() const = 0;
 
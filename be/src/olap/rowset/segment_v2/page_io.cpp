@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -39,11 +40,14 @@
 #include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/page_handle.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "util/block_compression.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace doris {
 namespace segment_v2 {
@@ -135,12 +139,40 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                          opts.file_reader->size(), opts.page_pointer.offset);
     VLOG_DEBUG << fmt::format("Reading page {}:{}:{}", cache_key.fname, cache_key.fsize,
                               cache_key.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+    bool is_page_loader = false;
+    Defer finish_load {[&]() {
+        if (is_page_loader) {
+            cache->finish_load(cache_key);
+        }
+    }};
+    auto lookup_cache = [&]() {
+        if (!opts.use_page_cache || !cache) {
+            return false;
+        }
+        if (cache->lookup(cache_key, &cache_handle, opts.type)) {
+            return true;
+        }
+        if (!config::enable_page_cache_single_flight_load) {
+            return false;
+        }
+        // Wait for a concurrent reader of the same page instead of reading it again. If that
+        // reader did not get the page cached, e.g. it failed, read the page ourselves.
+        is_page_loader = cache->begin_load(cache_key);
+        return !is_page_loader && cache->lookup(cache_key, &cache_handle, opts.type);
+    };
+    // The page cache hits are not counted per file, the lookups are too frequent for the lock.
+    auto* io_ledger = current_io_ledger();
+    const int64_t lookup_start_ns = io_ledger != nullptr ? MonotonicNanos() : 0;
+    if (lookup_cache()) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
         // parse body and footer
         Slice page_slice = handle->data();
+        if (io_ledger != nullptr) {
+            io_ledger->record(IOTier::PAGE_CACHE, static_cast<int64_t>(page_slice.size),
+                              MonotonicNanos() - lookup_start_ns);
+        }
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
         if (!footer->ParseFromString(footer_buf)) {
@@ -153,41 +185,56 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         return Status::OK();
     }
 
-    // every page contains 4 bytes footer length and 4 bytes checksum
-    const uint32_t page_size = opts.page_pointer.size;
-    if (page_size < 8) {
-        return Status::Corruption("Bad page: too small size ({}), file={}", page_size,
-                                  opts.file_reader->path().native());
-    }
-
     // hold compressed page at first, reset to decompressed page later
-    std::unique_ptr<DataPage> page =
-            std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
-    Slice page_slice(page->data(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        size_t bytes_read = 0;
-        RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
-                                                  &opts.io_ctx));
-        DCHECK_EQ(bytes_read, page_size);
-        opts.stats->compressed_bytes_read += page_size;
-    }
+    std::unique_ptr<DataPage> page;
+    Slice page_slice;
+    // the compressed tier keeps the page without checksum, which is verified before insertion
+    PageCacheHandle compressed_handle;
+    const bool use_compressed_tier =
+            opts.use_page_cache && cache && cache->has_compressed_tier(opts.type);
+    if (use_compressed_tier && cache->lookup_compressed(cache_key, &compressed_handle, opts.type)) {
+        opts.stats->cached_compressed_pages_num++;
+        page_slice = compressed_handle.data();
+        if (io_ledger != nullptr) {
+            io_ledger->record(IOTier::PAGE_CACHE, static_cast<int64_t>(page_slice.size),
+                              MonotonicNanos() - lookup_start_ns);
+        }
+    } else {
+        // every page contains 4 bytes footer length and 4 bytes checksum
+        const uint32_t page_size = opts.page_pointer.size;
+        if (page_size < 8) {
+            return Status::Corruption("Bad page: too small size ({}), file={}", page_size,
+                                      opts.file_reader->path().native());
+        }
 
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        InjectionContext ctx = {&actual, const_cast<PageReadOptions*>(&opts)};
-        (void)ctx;
-        TEST_INJECTION_POINT_CALLBACK("PageIO::read_and_decompress_page:crc_failure_inj", &ctx);
-        if (expect != actual) {
-            return Status::Corruption(
-                    "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual, expect,
-                    opts.file_reader->path().native());
+        page = std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
+        page_slice = Slice(page->data(), page_size);
+        {
+            SCOPED_RAW_TIMER(&opts.stats->io_ns);
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice,
+                                                      &bytes_read, &opts.io_ctx));
+            DCHECK_EQ(bytes_read, page_size);
+            opts.stats->compressed_bytes_read += page_size;
         }
-    }
 
-    // remove checksum suffix
-    page_slice.size -= 4;
+        if (opts.verify_checksum) {
+            uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+            uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+            InjectionContext ctx = {&actual, const_cast<PageReadOptions*>(&opts)};
+            (void)ctx;
+            TEST_INJECTION_POINT_CALLBACK("PageIO::read_and_decompress_page:crc_failure_inj",
+                                          &ctx);
+            if (expect != actual) {
+                return Status::Corruption(
+                        "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual,
+                        expect, opts.file_reader->path().native());
+            }
+        }
+
+        // remove checksum suffix
+        page_slice.size -= 4;
+    }
     // parse and set footer
     uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
     if (!footer->ParseFromArray(page_slice.data + page_slice.size - 4 - footer_size, footer_size)) {
@@ -196,6 +243,10 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     }
 
     auto body_size = cast_set<uint32_t>(page_slice.size - 4 - footer_size);
+    if (page == nullptr && body_size == footer->uncompressed_size()) {
+        return Status::InternalError("Bad page: uncompressed page in compressed cache, file={}",
+                                     opts.file_reader->path().native());
+    }
     if (body_size != footer->uncompressed_size()) { // need decompress body
         if (opts.codec == nullptr) {
             return Status::Corruption(
@@ -219,6 +270,11 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         // append footer and footer size
         memcpy(decompressed_body.data + decompressed_body.size, page_slice.data + body_size,
                footer_size + 4);
+        if (use_compressed_tier && page != nullptr) {
+            // keep the compressed page instead of freeing it
+            page->reset_size(page_slice.size);
+            cache->insert_compressed(cache_key, page.release(), opts.type);
+        }
         // free memory of compressed page
         page = std::move(decompressed_page);
         page_slice = Slice(page->data(), footer->uncompressed_size() + footer_size + 4);
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "common/cast_set.h"
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
@@ -285,6 +288,52 @@ public:
         return Status::OK();
     }
 
+    // The shared values are the runs of the page.
+    Status read_encoded_values(vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        _run_ends.clear();
+        RleDecoder<CppType> decoder((uint8_t*)_data.data + RLE_PAGE_HEADER_SIZE,
+                                    cast_set<int>(_data.size - RLE_PAGE_HEADER_SIZE), _bit_width);
+        size_t num_values = 0;
+        CppType value;
+        while (num_values < _num_elements) {
+            size_t run = decoder.GetNextRun(&value, _num_elements - num_values);
+            if (run == 0) {
+                return Status::Corruption("file corruption: rle page ends at {} of {} values",
+                                          num_values, _num_elements);
+            }
+            num_values += run;
+            _run_ends.push_back(num_values);
+            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
+        }
+        return Status::OK();
+    }
+
+    Status next_encoded_refs(size_t* n, uint32_t* refs) override {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        if (_run_ends.empty()) {
+            return Status::InternalError("read_encoded_values must be called before");
+        }
+        size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        auto run = static_cast<size_t>(
+                std::upper_bound(_run_ends.begin(), _run_ends.end(), _cur_index) -
+                _run_ends.begin());
+        for (size_t i = 0; i < to_fetch; ++i) {
+            if (_cur_index + i >= _run_ends[run]) {
+                ++run;
+            }
+            refs[i] = cast_set<uint32_t>(run);
+        }
+        _rle_decoder.Skip(to_fetch);
+        _cur_index += to_fetch;
+        *n = to_fetch;
+        return Status::OK();
+    }
+
     size_t count() const override { return _num_elements; }
 
     size_t current_index() const override { return _cur_index; }
@@ -298,6 +347,8 @@ private:
     bool _parsed;
     uint32_t _num_elements;
     size_t _cur_index;
+    // the position after every run, filled by read_encoded_values()
+    std::vector<size_t> _run_ends;
     int _bit_width;
     RleDecoder<CppType> _rle_decoder;
 };
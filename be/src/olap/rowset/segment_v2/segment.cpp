@@ -49,6 +49,7 @@
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/rowset/segment_v2/segment_footer_snapshot.h"
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h" // k_segment_magic_length
 #include "olap/rowset/segment_v2/stream_reader.h"
@@ -406,6 +407,21 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
                                   file_cache_key_str(_file_reader->path().native()));
     }
 
+    // the footer of the segment opened before restart is kept in the snapshot
+    auto* footer_snapshot = ExecEnv::GetInstance()->segment_footer_snapshot();
+    std::string snapshot_key;
+    if (footer_snapshot != nullptr) {
+        snapshot_key = get_segment_footer_cache_key().encode();
+        std::string snapshot_footer_buf;
+        if (footer_snapshot->lookup(snapshot_key, &snapshot_footer_buf)) {
+            footer = std::make_shared<SegmentFooterPB>();
+            if (footer->ParseFromString(snapshot_footer_buf)) {
+                return Status::OK();
+            }
+            footer_snapshot->erase(snapshot_key);
+        }
+    }
+
     uint8_t fixed_buf[12];
     size_t bytes_read = 0;
     // TODO(plat1ko): Support session variable `enable_file_cache`
@@ -477,6 +493,9 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
                 file_cache_key_str(_file_reader->path().native()));
     }
 
+    if (footer_snapshot != nullptr) {
+        footer_snapshot->insert(snapshot_key, std::move(footer_buf));
+    }
     VLOG_DEBUG << fmt::format("Loading segment footer from {} finished",
                               _file_reader->path().native());
     return Status::OK();
@@ -817,7 +836,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
 
 Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
-                               OlapReaderStatistics* stats, std::string* encoded_seq_value) {
+                               OlapReaderStatistics* stats, std::string* encoded_seq_value,
+                               std::unique_ptr<IndexedColumnIterator>* pk_index_iterator) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
@@ -836,8 +856,15 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND, false>("");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    // reuse the caller's iterator so that the loaded data page is kept across lookups
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_iterator;
+    std::unique_ptr<segment_v2::IndexedColumnIterator>& index_iterator =
+            pk_index_iterator != nullptr ? *pk_index_iterator : local_iterator;
+    if (index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    } else {
+        index_iterator->set_stats(stats);
+    }
     auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
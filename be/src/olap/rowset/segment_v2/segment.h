@@ -68,6 +68,7 @@ class BitmapIndexIterator;
 class Segment;
 class InvertedIndexIterator;
 class IndexFileReader;
+class IndexedColumnIterator;
 class IndexIterator;
 class ColumnReaderCache;
 
@@ -137,7 +138,8 @@ public:
 
     Status lookup_row_key(const Slice& key, const TabletSchema* latest_schema, bool with_seq_col,
                           bool with_rowid, RowLocation* row_location, OlapReaderStatistics* stats,
-                          std::string* encoded_seq_value = nullptr);
+                          std::string* encoded_seq_value = nullptr,
+                          std::unique_ptr<IndexedColumnIterator>* pk_index_iterator = nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
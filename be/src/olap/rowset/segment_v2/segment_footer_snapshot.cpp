@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_snapshot.h"
+
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "common/cast_set.h"
+#include "common/logging.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+#include "util/slice.h"
+#include "util/thread.h"
+
+namespace doris::segment_v2 {
+#include "common/compile_check_begin.h"
+
+static constexpr char SNAPSHOT_MAGIC[] = "DSFS";
+static constexpr size_t SNAPSHOT_MAGIC_LENGTH = 4;
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+static uint32_t entry_checksum(const std::string& key, const std::string& footer) {
+    return crc32c::Extend(crc32c::Value(key.data(), key.size()), footer.data(), footer.size());
+}
+
+SegmentFooterSnapshot::SegmentFooterSnapshot(std::string path, size_t capacity)
+        : _path(std::move(path)), _capacity(capacity) {}
+
+SegmentFooterSnapshot::~SegmentFooterSnapshot() {
+    stop();
+}
+
+Status SegmentFooterSnapshot::load() {
+    bool exists = false;
+    RETURN_IF_ERROR(io::global_local_filesystem()->exists(_path, &exists));
+    if (!exists) {
+        return Status::OK();
+    }
+    io::FileReaderSPtr reader;
+    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(_path, &reader));
+    std::string buf;
+    buf.resize(reader->size());
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(reader->read_at(0, Slice(buf), &bytes_read));
+    RETURN_IF_ERROR(reader->close());
+    if (bytes_read != buf.size()) {
+        return Status::Corruption("Bad segment footer snapshot {}: read {} of {} bytes", _path,
+                                  bytes_read, buf.size());
+    }
+    if (buf.size() < SNAPSHOT_MAGIC_LENGTH + 4 ||
+        memcmp(buf.data(), SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LENGTH) != 0) {
+        return Status::Corruption("Bad segment footer snapshot {}: magic number not match",
+                                  _path);
+    }
+    const auto* data = reinterpret_cast<const uint8_t*>(buf.data());
+    if (decode_fixed32_le(data + SNAPSHOT_MAGIC_LENGTH) != SNAPSHOT_VERSION) {
+        return Status::NotSupported("Segment footer snapshot {} of version {} is not supported",
+                                    _path, decode_fixed32_le(data + SNAPSHOT_MAGIC_LENGTH));
+    }
+
+    // the entries are written from the most recently used one, take them as long as valid
+    size_t pos = SNAPSHOT_MAGIC_LENGTH + 4;
+    size_t num_loaded = 0;
+    std::lock_guard l(_mutex);
+    auto read_string = [&](std::string* value) {
+        if (pos + 4 > buf.size()) {
+            return false;
+        }
+        uint32_t length = decode_fixed32_le(data + pos);
+        pos += 4;
+        if (pos + length > buf.size()) {
+            return false;
+        }
+        value->assign(buf.data() + pos, length);
+        pos += length;
+        return true;
+    };
+    while (pos < buf.size()) {
+        std::string key;
+        std::string footer;
+        if (!read_string(&key) || !read_string(&footer) || pos + 4 > buf.size() ||
+            decode_fixed32_le(data + pos) != entry_checksum(key, footer)) {
+            LOG(WARNING) << "segment footer snapshot " << _path << " is truncated at " << pos
+                         << ", " << num_loaded << " entries loaded";
+            break;
+        }
+        pos += 4;
+        // keep the order of recency
+        if (!_index.contains(key) && _bytes + key.size() + footer.size() <= _capacity) {
+            _bytes += key.size() + footer.size();
+            _entries.push_back({std::move(key), std::move(footer)});
+            _index[_entries.back().key] = std::prev(_entries.end());
+            ++num_loaded;
+        }
+    }
+    LOG(INFO) << "loaded " << num_loaded << " segment footers of " << _bytes << " bytes from "
+              << _path;
+    return Status::OK();
+}
+
+Status SegmentFooterSnapshot::save() {
+    // serialize under the lock, the footers are small compared to the IO
+    std::string buf;
+    {
+        std::lock_guard l(_mutex);
+        if (!_dirty) {
+            return Status::OK();
+        }
+        buf.reserve(SNAPSHOT_MAGIC_LENGTH + 4 + _bytes + _entries.size() * 12);
+        buf.append(SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LENGTH);
+        put_fixed32_le(&buf, SNAPSHOT_VERSION);
+        for (const auto& entry : _entries) {
+            put_fixed32_le(&buf, cast_set<uint32_t>(entry.key.size()));
+            buf.append(entry.key);
+            put_fixed32_le(&buf, cast_set<uint32_t>(entry.footer.size()));
+            buf.append(entry.footer);
+            put_fixed32_le(&buf, entry_checksum(entry.key, entry.footer));
+        }
+        _dirty = false;
+    }
+
+    std::string tmp_path = _path + ".tmp";
+    io::FileWriterPtr writer;
+    Status st = io::global_local_filesystem()->create_file(tmp_path, &writer);
+    if (st.ok()) {
+        st = writer->append(buf);
+    }
+    if (st.ok()) {
+        st = writer->close();
+    }
+    if (st.ok()) {
+        st = io::global_local_filesystem()->rename(tmp_path, _path);
+    }
+    if (!st.ok()) {
+        std::lock_guard l(_mutex);
+        _dirty = true;
+        return st;
+    }
+    return Status::OK();
+}
+
+Status SegmentFooterSnapshot::start(int32_t interval_sec) {
+    return Thread::create(
+            "SegmentFooterSnapshot", "save_segment_footer_snapshot",
+            [this, interval_sec]() {
+                while (!_stop_latch.wait_for(std::chrono::seconds(interval_sec))) {
+                    Status st = save();
+                    if (!st.ok()) {
+                        LOG(WARNING) << "failed to save segment footer snapshot " << _path
+                                     << ": " << st;
+                    }
+                }
+            },
+            &_save_thread);
+}
+
+void SegmentFooterSnapshot::stop() {
+    if (_save_thread == nullptr) {
+        return;
+    }
+    _stop_latch.count_down();
+    _save_thread->join();
+    _save_thread.reset();
+    Status st = save();
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to save segment footer snapshot " << _path << ": " << st;
+    }
+}
+
+bool SegmentFooterSnapshot::lookup(const std::string& key, std::string* footer) {
+    std::lock_guard l(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) {
+        return false;
+    }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    *footer = it->second->footer;
+    return true;
+}
+
+void SegmentFooterSnapshot::insert(const std::string& key, std::string footer) {
+    if (key.size() + footer.size() > _capacity) {
+        return;
+    }
+    std::lock_guard l(_mutex);
+    _insert_locked(key, std::move(footer));
+}
+
+void SegmentFooterSnapshot::erase(const std::string& key) {
+    std::lock_guard l(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) {
+        return;
+    }
+    _bytes -= it->second->key.size() + it->second->footer.size();
+    _entries.erase(it->second);
+    _index.erase(it);
+    _dirty = true;
+}
+
+size_t SegmentFooterSnapshot::size() {
+    std::lock_guard l(_mutex);
+    return _entries.size();
+}
+
+size_t SegmentFooterSnapshot::bytes() {
+    std::lock_guard l(_mutex);
+    return _bytes;
+}
+
+void SegmentFooterSnapshot::_insert_locked(std::string key, std::string footer) {
+    auto it = _index.find(key);
+    if (it != _index.end()) {
+        _bytes -= it->second->footer.size();
+        _bytes += footer.size();
+        it->second->footer = std::move(footer);
+        _entries.splice(_entries.begin(), _entries, it->second);
+    } else {
+        _bytes += key.size() + footer.size();
+        _entries.push_front({std::move(key), std::move(footer)});
+        _index[_entries.front().key] = _entries.begin();
+    }
+    _dirty = true;
+    _evict_locked();
+}
+
+void SegmentFooterSnapshot::_evict_locked() {
+    while (_bytes > _capacity && !_entries.empty()) {
+        auto& entry = _entries.back();
+        _bytes -= entry.key.size() + entry.footer.size();
+        _index.erase(entry.key);
+        _entries.pop_back();
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::segment_v2
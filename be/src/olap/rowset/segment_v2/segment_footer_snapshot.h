@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "util/countdown_latch.h"
+
+namespace doris {
+class Thread;
+
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+// Keeps the serialized footers of the segments opened recently, and persists them to a local
+// snapshot file periodically and at shutdown. After a restart, a segment whose footer is in
+// the snapshot is opened without reading the footer from its file.
+//
+// An entry is keyed by the footer cache key of the segment, which includes the path of the file
+// (so the rowset id) and its size. The segment files are immutable, so an entry is either for
+// the same file or never looked up again, the stale ones are evicted in LRU order. An entry
+// failing to parse is ignored and the footer is read from the file.
+//
+// File := Magic(4), Version(4), Entry*
+// Entry := KeyLength(4), Key, FooterLength(4), Footer, Checksum(4) of Key and Footer
+class SegmentFooterSnapshot {
+public:
+    SegmentFooterSnapshot(std::string path, size_t capacity);
+    ~SegmentFooterSnapshot();
+
+    // Load the snapshot file if exists, an invalid file is ignored.
+    Status load();
+    // Write the entries to the snapshot file, replacing it atomically.
+    Status save();
+
+    // Start the thread saving the snapshot every `interval_sec`.
+    Status start(int32_t interval_sec);
+    // Stop the thread and save the snapshot.
+    void stop();
+
+    bool lookup(const std::string& key, std::string* footer);
+    void insert(const std::string& key, std::string footer);
+    void erase(const std::string& key);
+
+    size_t size();
+    size_t bytes();
+
+private:
+    struct Entry {
+        std::string key;
+        std::string footer;
+    };
+    using EntryList = std::list<Entry>;
+
+    // Must hold _mutex.
+    void _insert_locked(std::string key, std::string footer);
+    void _evict_locked();
+
+    const std::string _path;
+    const size_t _capacity;
+
+    std::mutex _mutex;
+    // The most recently used entry is at the front.
+    EntryList _entries;
+    std::unordered_map<std::string, EntryList::iterator> _index;
+    size_t _bytes = 0;
+    // Whether the entries changed since the last save.
+    bool _dirty = false;
+
+    CountDownLatch _stop_latch {1};
+    std::shared_ptr<Thread> _save_thread;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
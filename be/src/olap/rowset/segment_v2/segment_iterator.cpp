@@ -38,6 +38,7 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/cache/cached_remote_file_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -63,6 +64,7 @@
 #include "olap/rowset/segment_v2/inverted_index_reader.h"
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
 #include "olap/rowset/segment_v2/variant/variant_column_reader.h"
 #include "olap/rowset/segment_v2/virtual_column_iterator.h"
 #include "olap/schema.h"
@@ -71,6 +73,7 @@
 #include "olap/types.h"
 #include "olap/utils.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
@@ -79,6 +82,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/time.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nothing.h"
@@ -110,7 +114,11 @@ namespace segment_v2 {
 
 #include "common/compile_check_begin.h"
 
-SegmentIterator::~SegmentIterator() = default;
+SegmentIterator::~SegmentIterator() {
+    if (_page_prefetcher != nullptr) {
+        _page_prefetcher->stop();
+    }
+}
 
 // A fast range iterator for roaring bitmap. Output ranges use closed-open form, like [from, to).
 // Example:
@@ -423,9 +431,54 @@ Status SegmentIterator::_lazy_init() {
 
     if (_opts.read_orderby_key_reverse) {
         _range_iter.reset(new BackwardBitmapRangeIterator(_row_bitmap));
+        _read_rowid_bound = num_rows();
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
+        _read_rowid_bound = 0;
     }
+    RETURN_IF_ERROR(_init_page_prefetcher());
+    return Status::OK();
+}
+
+Status SegmentIterator::_init_page_prefetcher() {
+    // Only the reads of the remote data benefit from the prefetch, the pages are read
+    // into the file cache ahead of the decoding. Reverse reads are not supported, the
+    // pages are issued in the ascending order of rows.
+    if (!config::enable_segment_page_prefetch || _row_bitmap.isEmpty() ||
+        _opts.read_orderby_key_reverse || _opts.io_ctx.reader_type != ReaderType::READER_QUERY ||
+        !_opts.io_ctx.read_file_cache ||
+        dynamic_cast<io::CachedRemoteFileReader*>(_file_reader.get()) == nullptr) {
+        return Status::OK();
+    }
+    RowRanges row_ranges;
+    uint32_t range_from = 0;
+    uint32_t range_to = 0;
+    for (uint32_t rowid : _row_bitmap) {
+        if (rowid != range_to) {
+            row_ranges.add(RowRange(range_from, range_to));
+            range_from = rowid;
+        }
+        range_to = rowid + 1;
+    }
+    row_ranges.add(RowRange(range_from, range_to));
+
+    auto prefetcher = std::make_shared<SegmentPrefetcher>(
+            _file_reader, _opts.io_ctx,
+            static_cast<size_t>(config::segment_page_prefetch_window_bytes),
+            ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool());
+    for (auto cid : _schema->column_ids()) {
+        if (_column_iterators[cid] == nullptr || _virtual_column_exprs.contains(cid)) {
+            continue;
+        }
+        RETURN_IF_ERROR(_column_iterators[cid]->collect_prefetch_pages(row_ranges,
+                                                                       prefetcher.get()));
+    }
+    if (prefetcher->num_reads() == 0) {
+        return Status::OK();
+    }
+    prefetcher->finish();
+    prefetcher->advance(_row_bitmap.minimum());
+    _page_prefetcher = std::move(prefetcher);
     return Status::OK();
 }
 
@@ -806,28 +859,7 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
                                        condition_row_ranges);
 
         if (!_opts.topn_filter_source_node_ids.empty()) {
-            auto* query_ctx = _opts.runtime_state->get_query_ctx();
-            for (int id : _opts.topn_filter_source_node_ids) {
-                std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
-                        query_ctx->get_runtime_predicate(id).get_predicate(
-                                _opts.topn_filter_target_node_id);
-                if (_segment->can_apply_predicate_safely(runtime_predicate->column_id(), *_schema,
-                                                         _opts.target_cast_type_for_variants,
-                                                         _opts.io_ctx.reader_type)) {
-                    AndBlockColumnPredicate and_predicate;
-                    and_predicate.add_column_predicate(
-                            SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-
-                    RowRanges column_rp_row_ranges = RowRanges::create_single(num_rows());
-                    RETURN_IF_ERROR(_column_iterators[runtime_predicate->column_id()]
-                                            ->get_row_ranges_by_zone_map(&and_predicate, nullptr,
-                                                                         &column_rp_row_ranges));
-
-                    // intersect different columns's row ranges to get final row ranges by zone map
-                    RowRanges::ranges_intersection(zone_map_row_ranges, column_rp_row_ranges,
-                                                   &zone_map_row_ranges);
-                }
-            }
+            RETURN_IF_ERROR(_get_row_ranges_by_topn_filter(&zone_map_row_ranges));
         }
 
         size_t pre_size2 = condition_row_ranges->count();
@@ -837,6 +869,101 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
         _opts.stats->rows_stats_filtered += (pre_size - condition_row_ranges->count());
     }
 
+    if (config::enable_encoded_page_predicate_evaluation &&
+        _opts.io_ctx.reader_type == ReaderType::READER_QUERY) {
+        SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_encoded_pages_ns);
+        // evaluate the predicates on the dictionary codes or the runs of the pages left,
+        // the values of the pages and the runs not satisfying them are never decoded
+        pre_size = condition_row_ranges->count();
+        for (const auto& cid : cids) {
+            if (condition_row_ranges->is_empty()) {
+                break;
+            }
+            if (!_segment->can_apply_predicate_safely(cid, *_schema,
+                                                      _opts.target_cast_type_for_variants,
+                                                      _opts.io_ctx.reader_type)) {
+                continue;
+            }
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_encoded_pages(
+                    _opts.col_id_to_predicates.at(cid).get(), condition_row_ranges));
+        }
+        _opts.stats->rows_encoded_page_filtered += (pre_size - condition_row_ranges->count());
+    }
+
+    return Status::OK();
+}
+
+Status SegmentIterator::_get_row_ranges_by_topn_filter(RowRanges* row_ranges) {
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    _topn_filter_versions.resize(_opts.topn_filter_source_node_ids.size());
+    for (size_t i = 0; i != _opts.topn_filter_source_node_ids.size(); ++i) {
+        auto& predicate = query_ctx->get_runtime_predicate(_opts.topn_filter_source_node_ids[i]);
+        // Read the version before the predicate, a concurrent update is applied next time.
+        _topn_filter_versions[i] = predicate.version();
+        std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
+                predicate.get_predicate(_opts.topn_filter_target_node_id);
+        if (_segment->can_apply_predicate_safely(runtime_predicate->column_id(), *_schema,
+                                                 _opts.target_cast_type_for_variants,
+                                                 _opts.io_ctx.reader_type)) {
+            AndBlockColumnPredicate and_predicate;
+            and_predicate.add_column_predicate(
+                    SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
+
+            RowRanges column_rp_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[runtime_predicate->column_id()]
+                                    ->get_row_ranges_by_zone_map(&and_predicate, nullptr,
+                                                                 &column_rp_row_ranges));
+
+            // intersect different columns's row ranges to get final row ranges by zone map
+            RowRanges::ranges_intersection(*row_ranges, column_rp_row_ranges, row_ranges);
+        }
+    }
+    return Status::OK();
+}
+
+// The topn filter is shared by all the instances of the query and keeps being tightened during
+// the scan, prune the rows not read yet by the page zone maps again once it changes.
+Status SegmentIterator::_prune_unread_rows_by_topn_filter() {
+    if (_opts.topn_filter_source_node_ids.empty() ||
+        !config::enable_topn_filter_dynamic_pruning) {
+        return Status::OK();
+    }
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    bool changed = _topn_filter_versions.size() != _opts.topn_filter_source_node_ids.size();
+    for (size_t i = 0; !changed && i != _topn_filter_versions.size(); ++i) {
+        changed = query_ctx->get_runtime_predicate(_opts.topn_filter_source_node_ids[i])
+                          .version() != _topn_filter_versions[i];
+    }
+    if (!changed) {
+        return Status::OK();
+    }
+
+    SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_zonemap_ns);
+    RowRanges row_ranges = RowRanges::create_single(num_rows());
+    RETURN_IF_ERROR(_get_row_ranges_by_topn_filter(&row_ranges));
+
+    roaring::Roaring unread_rows = _topn_pruned ? _topn_pruned_row_bitmap : _row_bitmap;
+    if (_opts.read_orderby_key_reverse) {
+        unread_rows.removeRange(_read_rowid_bound, num_rows());
+    } else {
+        unread_rows.removeRange(0, _read_rowid_bound);
+    }
+    const auto pre_size = unread_rows.cardinality();
+    unread_rows &= RowRanges::ranges_to_roaring(row_ranges);
+    if (unread_rows.cardinality() == pre_size) {
+        return Status::OK();
+    }
+    _opts.stats->rows_stats_rp_filtered += pre_size - unread_rows.cardinality();
+    _opts.stats->rows_stats_filtered += pre_size - unread_rows.cardinality();
+
+    // `_row_bitmap` is kept as is, it is also used to compute the scores of the rows.
+    _topn_pruned_row_bitmap = std::move(unread_rows);
+    _topn_pruned = true;
+    if (_opts.read_orderby_key_reverse) {
+        _range_iter.reset(new BackwardBitmapRangeIterator(_topn_pruned_row_bitmap));
+    } else {
+        _range_iter.reset(new BitmapRangeIterator(_topn_pruned_row_bitmap));
+    }
     return Status::OK();
 }
 
@@ -1981,6 +2108,13 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0) {
+        _read_rowid_bound = _opts.read_orderby_key_reverse ? _block_rowids[0]
+                                                           : _block_rowids[nrows_read - 1] + 1;
+    }
+    if (_page_prefetcher != nullptr && nrows_read > 0) {
+        _page_prefetcher->advance(_block_rowids[0]);
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
     VLOG_DEBUG << fmt::format(
@@ -2182,10 +2316,28 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     }
 
     uint16_t original_size = selected_size;
-    for (auto* predicate : _short_cir_eval_predicate) {
+    const bool adaptive_reorder =
+            config::enable_adaptive_predicate_reorder && _short_cir_eval_predicate.size() > 1;
+    if (adaptive_reorder && _short_cir_eval_stats.size() != _short_cir_eval_predicate.size()) {
+        _short_cir_eval_stats.assign(_short_cir_eval_predicate.size(), PredicateEvalStats());
+    }
+    for (size_t i = 0; i < _short_cir_eval_predicate.size(); ++i) {
+        auto* predicate = _short_cir_eval_predicate[i];
         auto column_id = predicate->column_id();
         auto& short_cir_column = _current_return_columns[column_id];
+        const int64_t start_ns = adaptive_reorder ? MonotonicNanos() : 0;
+        const uint16_t input_size = selected_size;
         selected_size = predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        if (adaptive_reorder) {
+            _short_cir_eval_stats[i].update(input_size, selected_size, MonotonicNanos() - start_ns);
+        }
+    }
+    if (adaptive_reorder &&
+        ++_short_cir_eval_batches >= config::adaptive_predicate_reorder_interval) {
+        _short_cir_eval_batches = 0;
+        if (reorder_by_rank(&_short_cir_eval_predicate, &_short_cir_eval_stats)) {
+            _opts.stats->predicate_reorder_num++;
+        }
     }
 
     _opts.stats->short_circuit_cond_input_rows += original_size;
@@ -2418,6 +2570,8 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         }
     }
 
+    RETURN_IF_ERROR(_prune_unread_rows_by_topn_filter());
+
     uint32_t nrows_read_limit = _opts.block_row_max;
     if (_can_opt_topn_reads()) {
         nrows_read_limit = std::min(static_cast<uint32_t>(_opts.topn_limit), nrows_read_limit);
@@ -2688,9 +2842,23 @@ Status SegmentIterator::_execute_common_expr(uint16_t* sel_rowid_idx, uint16_t&
     uint16_t original_size = selected_size;
     _opts.stats->expr_cond_input_rows += original_size;
 
+    const bool adaptive_reorder =
+            config::enable_adaptive_predicate_reorder && _common_expr_ctxs_push_down.size() > 1;
+    if (adaptive_reorder && _common_expr_eval_stats.size() != _common_expr_ctxs_push_down.size()) {
+        _common_expr_eval_stats.assign(_common_expr_ctxs_push_down.size(), PredicateEvalStats());
+    }
+
     vectorized::IColumn::Filter filter;
     RETURN_IF_ERROR(vectorized::VExprContext::execute_conjuncts_and_filter_block(
-            _common_expr_ctxs_push_down, block, _columns_to_filter, prev_columns, filter));
+            _common_expr_ctxs_push_down, block, _columns_to_filter, prev_columns, filter,
+            adaptive_reorder ? &_common_expr_eval_stats : nullptr));
+    if (adaptive_reorder &&
+        ++_common_expr_eval_batches >= config::adaptive_predicate_reorder_interval) {
+        _common_expr_eval_batches = 0;
+        if (reorder_by_rank(&_common_expr_ctxs_push_down, &_common_expr_eval_stats)) {
+            _opts.stats->predicate_reorder_num++;
+        }
+    }
 
     selected_size = _evaluate_common_expr_filter(sel_rowid_idx, selected_size, filter);
     _opts.stats->rows_expr_cond_filtered += original_size - selected_size;
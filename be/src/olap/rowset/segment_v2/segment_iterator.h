@@ -45,6 +45,7 @@
 #include "olap/rowset/segment_v2/index_iterator.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/schema.h"
+#include "util/predicate_eval_stats.h"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
 #include "vec/columns/column.h"
@@ -74,6 +75,7 @@ class ColumnIterator;
 class InvertedIndexIterator;
 class RowRanges;
 class IndexIterator;
+class SegmentPrefetcher;
 
 struct ColumnPredicateInfo {
     ColumnPredicateInfo() = default;
@@ -174,6 +176,8 @@ private:
     [[nodiscard]] Status _init_index_iterators();
 
     Status _apply_ann_topn_predicate();
+    // start prefetching the data pages of the rows left after all the pruning
+    [[nodiscard]] Status _init_page_prefetcher();
     // calculate row ranges that fall into requested key ranges using short key index
     [[nodiscard]] Status _get_row_ranges_by_keys();
     [[nodiscard]] Status _prepare_seek(const StorageReadOptions::KeyRange& key_range);
@@ -191,6 +195,8 @@ private:
     // calculate row ranges that satisfy requested column conditions using various column index
     [[nodiscard]] Status _get_row_ranges_by_column_conditions();
     [[nodiscard]] Status _get_row_ranges_from_conditions(RowRanges* condition_row_ranges);
+    [[nodiscard]] Status _get_row_ranges_by_topn_filter(RowRanges* row_ranges);
+    [[nodiscard]] Status _prune_unread_rows_by_topn_filter();
     [[nodiscard]] Status _apply_bitmap_index();
     [[nodiscard]] Status _apply_inverted_index();
     [[nodiscard]] Status _apply_inverted_index_on_column_predicate(
@@ -387,6 +393,14 @@ private:
     roaring::Roaring _row_bitmap;
     // an iterator for `_row_bitmap` that can be used to extract row range to scan
     std::unique_ptr<BitmapRangeIterator> _range_iter;
+    // The unread rows of `_row_bitmap` not pruned by the topn filter, `_range_iter` iterates it
+    // instead of `_row_bitmap` once `_topn_pruned` is set.
+    roaring::Roaring _topn_pruned_row_bitmap;
+    bool _topn_pruned = false;
+    // The rows before (after for reverse read) this bound have been read by `_range_iter`.
+    rowid_t _read_rowid_bound = 0;
+    // The versions of the topn filters when they were last applied to the zone maps.
+    std::vector<uint64_t> _topn_filter_versions;
     // the next rowid to read
     rowid_t _cur_rowid;
     // members related to lazy materialization read
@@ -414,6 +428,14 @@ private:
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+    // The short circuit predicates narrow the selection one after another, and the pushed
+    // down common exprs stop once all the rows are filtered, so both are reordered by the
+    // stats measured in the last `adaptive_predicate_reorder_interval` batches.
+    // The vectorized predicates evaluate all the rows whatever the order is.
+    std::vector<PredicateEvalStats> _short_cir_eval_stats;
+    std::vector<PredicateEvalStats> _common_expr_eval_stats;
+    int32_t _short_cir_eval_batches = 0;
+    int32_t _common_expr_eval_batches = 0;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
@@ -451,6 +473,8 @@ private:
     vectorized::MutableColumns _short_key;
 
     io::FileReaderSPtr _file_reader;
+    // prefetch the data pages to read into the file cache, null if not enabled
+    std::shared_ptr<SegmentPrefetcher> _page_prefetcher;
 
     // char_type or array<char> type columns cid
     std::vector<size_t> _char_type_idx;
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
+
+#include <bvar/bvar.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "io/fs/file_reader.h"
+#include "util/slice.h"
+#include "util/threadpool.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+bvar::Adder<uint64_t> g_segment_prefetch_submitted_bytes("segment_prefetch_submitted_bytes");
+bvar::Adder<uint64_t> g_segment_prefetch_finished_bytes("segment_prefetch_finished_bytes");
+bvar::Adder<uint64_t> g_segment_prefetch_failed_num("segment_prefetch_failed_num");
+
+// The buffer of one background read, a coalesced read is done in chunks of this size.
+static constexpr size_t PREFETCH_CHUNK_SIZE = 1024 * 1024;
+
+SegmentPrefetcher::SegmentPrefetcher(io::FileReaderSPtr file_reader, const io::IOContext& io_ctx,
+                                     size_t window_bytes, ThreadPool* thread_pool)
+        : _file_reader(std::move(file_reader)),
+          _io_ctx(io_ctx),
+          _window_bytes(window_bytes),
+          _thread_pool(thread_pool) {
+    // The reads only fill the file cache, the data is dropped and the statistics of the
+    // query are not touched, they may outlive the query.
+    _io_ctx.is_dryrun = true;
+    _io_ctx.query_id = nullptr;
+    _io_ctx.file_cache_stats = nullptr;
+    _io_ctx.file_reader_stats = nullptr;
+}
+
+void SegmentPrefetcher::add_column_pages(const std::vector<PagePointer>& pages,
+                                         const std::vector<ordinal_t>& first_ordinals,
+                                         const std::vector<ordinal_t>& last_ordinals) {
+    DCHECK_EQ(pages.size(), first_ordinals.size());
+    DCHECK_EQ(pages.size(), last_ordinals.size());
+    // The file cache always downloads whole blocks, the bytes between two pages in one
+    // block cost nothing more, so pages not farther than a block are read together.
+    const auto max_gap = static_cast<uint64_t>(config::file_cache_each_block_size);
+    // Keep several reads in the window, a single huge read would serialize the prefetch.
+    const uint64_t max_read_size = std::max<uint64_t>(_window_bytes / 4, PREFETCH_CHUNK_SIZE);
+    // the reads of different columns are never merged, they are needed at different rows
+    const size_t column_start = _reads.size();
+    for (size_t i = 0; i < pages.size(); ++i) {
+        const auto& page = pages[i];
+        if (page.size == 0) {
+            continue;
+        }
+        if (_reads.size() > column_start) {
+            auto& last = _reads.back();
+            const uint64_t end = last.offset + last.size;
+            if (page.offset >= end && page.offset - end <= max_gap &&
+                page.offset + page.size - last.offset <= max_read_size) {
+                last.size = page.offset + page.size - last.offset;
+                last.last_ordinal = last_ordinals[i];
+                continue;
+            }
+        }
+        _reads.push_back({page.offset, page.size, first_ordinals[i], last_ordinals[i]});
+    }
+}
+
+void SegmentPrefetcher::finish() {
+    std::stable_sort(_reads.begin(), _reads.end(), [](const Read& l, const Read& r) {
+        return l.first_ordinal < r.first_ordinal;
+    });
+}
+
+void SegmentPrefetcher::advance(ordinal_t rowid) {
+    if (_stopped) {
+        return;
+    }
+    while (_next_consume < _next_submit && _reads[_next_consume].last_ordinal < rowid) {
+        _bytes_ahead -= _reads[_next_consume].size;
+        ++_next_consume;
+    }
+    while (_next_submit < _reads.size()) {
+        const auto& read = _reads[_next_submit];
+        if (read.last_ordinal < rowid) {
+            // the iterator has passed this read before it was issued
+            if (_next_consume == _next_submit) {
+                ++_next_consume;
+            } else {
+                _bytes_ahead += read.size;
+            }
+            ++_next_submit;
+            continue;
+        }
+        // always allow one read, or a read larger than the window would never be issued
+        if (_bytes_ahead > 0 && _bytes_ahead + read.size > _window_bytes) {
+            break;
+        }
+        _bytes_ahead += read.size;
+        _submit(read);
+        ++_next_submit;
+    }
+}
+
+void SegmentPrefetcher::_submit(const Read& read) {
+    g_segment_prefetch_submitted_bytes << read.size;
+    if (_thread_pool == nullptr) {
+        _do_read(read);
+        return;
+    }
+    auto st = _thread_pool->submit_func(
+            [prefetcher = shared_from_this(), read]() { prefetcher->_do_read(read); });
+    if (!st.ok()) {
+        // best effort, the iterator reads the pages itself
+        g_segment_prefetch_failed_num << 1;
+        VLOG_DEBUG << "failed to submit segment prefetch, path=" << _file_reader->path().native()
+                   << ", st=" << st;
+    }
+}
+
+void SegmentPrefetcher::_do_read(const Read& read) {
+    std::unique_ptr<char[]> buffer(new char[std::min<uint64_t>(read.size, PREFETCH_CHUNK_SIZE)]);
+    uint64_t offset = read.offset;
+    const uint64_t end = read.offset + read.size;
+    while (offset < end && !_stopped) {
+        const size_t size = std::min<uint64_t>(end - offset, PREFETCH_CHUNK_SIZE);
+        size_t bytes_read = 0;
+        auto st = _file_reader->read_at(offset, Slice(buffer.get(), size), &bytes_read, &_io_ctx);
+        if (!st.ok() || bytes_read == 0) {
+            g_segment_prefetch_failed_num << 1;
+            VLOG_DEBUG << "failed to prefetch segment pages, path="
+                       << _file_reader->path().native() << ", offset=" << offset
+                       << ", size=" << size << ", st=" << st;
+            return;
+        }
+        offset += bytes_read;
+        g_segment_prefetch_finished_bytes << bytes_read;
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/file_reader_writer_fwd.h"
+#include "io/io_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/page_pointer.h"
+
+namespace doris {
+class ThreadPool;
+
+namespace segment_v2 {
+
+// SegmentPrefetcher reads the data pages a SegmentIterator is going to decode into the
+// file cache in the background, so that the remote IO of the next pages overlaps with the
+// decoding of the current ones.
+//
+// The pages of every projected column are collected once the row ranges of the segment
+// are final, pages adjacent in the file are coalesced into one read, and the reads are
+// issued in the order of the rows they hold. At most `window_bytes` are read ahead of the
+// row the iterator is at, which bounds both the memory of the in flight reads and the
+// file cache space taken by data the iterator has not reached yet.
+//
+// Not thread safe, all the methods except the background reads are called by the thread
+// that owns the SegmentIterator.
+class SegmentPrefetcher : public std::enable_shared_from_this<SegmentPrefetcher> {
+public:
+    SegmentPrefetcher(io::FileReaderSPtr file_reader, const io::IOContext& io_ctx,
+                      size_t window_bytes, ThreadPool* thread_pool);
+
+    // Add the pages of one column in row order, `first_ordinals[i]` and `last_ordinals[i]`
+    // are the first and the last row of `pages[i]`.
+    void add_column_pages(const std::vector<PagePointer>& pages,
+                          const std::vector<ordinal_t>& first_ordinals,
+                          const std::vector<ordinal_t>& last_ordinals);
+
+    // Order the reads of all the columns by row, must be called after the last
+    // add_column_pages() and before the first advance().
+    void finish();
+
+    // The iterator is going to read `rowid` next, issue the reads of the rows after it
+    // until the window is full.
+    void advance(ordinal_t rowid);
+
+    // Stop issuing reads, the reads already running exit at the next chunk.
+    void stop() { _stopped = true; }
+
+    size_t num_reads() const { return _reads.size(); }
+    uint64_t bytes_ahead() const { return _bytes_ahead; }
+
+private:
+    struct Read {
+        uint64_t offset;
+        uint64_t size;
+        ordinal_t first_ordinal;
+        ordinal_t last_ordinal;
+    };
+
+    void _submit(const Read& read);
+    void _do_read(const Read& read);
+
+    io::FileReaderSPtr _file_reader;
+    io::IOContext _io_ctx;
+    const size_t _window_bytes;
+    ThreadPool* _thread_pool = nullptr;
+
+    std::vector<Read> _reads;
+    // reads before `_next_submit` have been submitted
+    size_t _next_submit = 0;
+    // reads before `_next_consume` are behind the row the iterator is at
+    size_t _next_consume = 0;
+    // bytes submitted but not reached by the iterator yet
+    uint64_t _bytes_ahead = 0;
+
+    std::atomic<bool> _stopped {false};
+};
+
+} // namespace segment_v2
+} // namespace doris
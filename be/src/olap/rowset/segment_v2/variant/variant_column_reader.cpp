@@ -33,6 +33,7 @@
 #include "olap/rowset/segment_v2/variant/hierarchical_data_iterator.h"
 #include "olap/rowset/segment_v2/variant/sparse_column_extract_iterator.h"
 #include "olap/rowset/segment_v2/variant/sparse_column_merge_iterator.h"
+#include "olap/rowset/segment_v2/variant/variant_path_access_tracker.h"
 #include "olap/tablet_schema.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_nullable.h"
@@ -367,6 +368,11 @@ Status VariantColumnReader::new_iterator(ColumnIteratorUPtr* iterator,
         ColumnIteratorUPtr inner_iter;
         RETURN_IF_ERROR(_sparse_column_reader->new_iterator(&inner_iter, nullptr));
         DCHECK(opt);
+        if (config::variant_hot_path_min_access_count > 0 &&
+            !is_compaction_reader_type(opt->io_ctx.reader_type)) {
+            VariantPathAccessTracker::instance()->record(opt->tablet_id, col_uid,
+                                                         relative_path.get_path());
+        }
         // Sparse column exists or reached sparse size limit, read sparse column
         *iterator = std::make_unique<SparseColumnExtractIterator>(
                 relative_path.get_path(), std::move(inner_iter), nullptr, *target_col);
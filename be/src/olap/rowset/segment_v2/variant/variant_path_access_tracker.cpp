@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/variant/variant_path_access_tracker.h"
+
+#include "common/config.h"
+
+namespace doris::segment_v2 {
+
+#include "common/compile_check_begin.h"
+
+void VariantPathAccessTracker::record(int64_t tablet_id, int32_t col_uid,
+                                      const std::string& path) {
+    std::lock_guard<std::mutex> lock(_lock);
+    auto& paths = _access_counts[{tablet_id, col_uid}];
+    if (auto it = paths.find(path); it != paths.end()) {
+        ++it->second;
+    } else if (paths.size() < config::variant_max_sparse_column_statistics_size) {
+        paths.emplace(path, 1);
+    }
+}
+
+std::unordered_set<std::string> VariantPathAccessTracker::take_hot_paths(int64_t tablet_id,
+                                                                         int32_t col_uid) {
+    std::unordered_set<std::string> hot_paths;
+    std::lock_guard<std::mutex> lock(_lock);
+    auto it = _access_counts.find({tablet_id, col_uid});
+    if (it == _access_counts.end()) {
+        return hot_paths;
+    }
+    auto& paths = it->second;
+    for (auto path_it = paths.begin(); path_it != paths.end();) {
+        if (path_it->second >= config::variant_hot_path_min_access_count) {
+            hot_paths.insert(path_it->first);
+        }
+        path_it->second /= 2;
+        if (path_it->second == 0) {
+            path_it = paths.erase(path_it);
+        } else {
+            ++path_it;
+        }
+    }
+    if (paths.empty()) {
+        _access_counts.erase(it);
+    }
+    return hot_paths;
+}
+
+#include "common/compile_check_end.h"
+
+} // namespace doris::segment_v2
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace doris::segment_v2 {
+
+#include "common/compile_check_begin.h"
+
+// Counts how often queries read a path of a variant column out of its sparse column, so that
+// compaction can materialize the paths that are queried often even when few rows carry them.
+class VariantPathAccessTracker {
+public:
+    static VariantPathAccessTracker* instance() {
+        static VariantPathAccessTracker instance;
+        return &instance;
+    }
+
+    void record(int64_t tablet_id, int32_t col_uid, const std::string& path);
+
+    // Returns the paths read at least `config::variant_hot_path_min_access_count` times and
+    // halves all counts, so a path has to stay hot to keep its subcolumn across compactions.
+    std::unordered_set<std::string> take_hot_paths(int64_t tablet_id, int32_t col_uid);
+
+private:
+    struct KeyHash {
+        size_t operator()(const std::pair<int64_t, int32_t>& key) const {
+            return std::hash<int64_t> {}(key.first) * 31 + std::hash<int32_t> {}(key.second);
+        }
+    };
+
+    std::mutex _lock;
+    // <tablet_id, col_uid> -> path -> access count
+    std::unordered_map<std::pair<int64_t, int32_t>, std::unordered_map<std::string, int64_t>,
+                       KeyHash>
+            _access_counts;
+};
+
+#include "common/compile_check_end.h"
+
+} // namespace doris::segment_v2
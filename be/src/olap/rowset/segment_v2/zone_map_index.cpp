@@ -23,7 +23,9 @@
 #include <algorithm>
 #include <type_traits>
 
+#include "common/config.h"
 #include "olap/olap_common.h"
+#include "olap/olap_define.h"
 #include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/indexed_column_writer.h"
@@ -43,13 +45,22 @@ struct uint24_t;
 namespace segment_v2 {
 
 template <PrimitiveType Type>
-TypedZoneMapIndexWriter<Type>::TypedZoneMapIndexWriter(Field* field) : _field(field) {
+TypedZoneMapIndexWriter<Type>::TypedZoneMapIndexWriter(Field* field)
+        : _field(field),
+          // the text of a float may not parse back to the same value, an exact match on
+          // it could wrongly prune a zone
+          _max_distinct_values(Type == TYPE_FLOAT || Type == TYPE_DOUBLE
+                                       ? 0
+                                       : cast_set<size_t>(std::max(
+                                                 config::zone_map_max_distinct_values, 0))) {
     _page_zone_map.min_value = _field->allocate_zone_map_value(_arena);
     _page_zone_map.max_value = _field->allocate_zone_map_value(_arena);
     _reset_zone_map(&_page_zone_map);
     _segment_zone_map.min_value = _field->allocate_zone_map_value(_arena);
     _segment_zone_map.max_value = _field->allocate_zone_map_value(_arena);
     _reset_zone_map(&_segment_zone_map);
+    _page_distinct_values_overflow = _max_distinct_values == 0;
+    _segment_distinct_values_overflow = _max_distinct_values == 0;
 }
 
 template <PrimitiveType Type>
@@ -68,6 +79,46 @@ void TypedZoneMapIndexWriter<Type>::add_values(const void* values, size_t count)
         _field->type_info()->direct_copy_may_cut(_page_zone_map.max_value,
                                                  reinterpret_cast<const void*>(max));
     }
+    for (size_t i = 0; i < count && !_page_distinct_values_overflow; ++i) {
+        _add_distinct_value(vals + i);
+    }
+}
+
+template <PrimitiveType Type>
+void TypedZoneMapIndexWriter<Type>::_add_distinct_value(const void* value) {
+    using ValType = PrimitiveTypeTraits<Type>::StorageFieldType;
+    if constexpr (std::is_same_v<ValType, StringRef>) {
+        const auto ref = unaligned_load<StringRef>(value);
+        // the long strings are cut in the min and the max, they would bloat the index
+        if (ref.size > MAX_ZONE_MAP_INDEX_SIZE) {
+            _page_distinct_values_overflow = true;
+        } else {
+            _page_distinct_values.emplace(ref.data, ref.size);
+        }
+    } else {
+        _page_distinct_values.emplace(static_cast<const char*>(value), sizeof(ValType));
+    }
+    if (_page_distinct_values.size() > _max_distinct_values) {
+        _page_distinct_values_overflow = true;
+    }
+    if (_page_distinct_values_overflow) {
+        _page_distinct_values.clear();
+    }
+}
+
+template <PrimitiveType Type>
+void TypedZoneMapIndexWriter<Type>::_distinct_values_to_proto(
+        const phmap::flat_hash_set<std::string>& values, ZoneMapPB* dst) const {
+    using ValType = PrimitiveTypeTraits<Type>::StorageFieldType;
+    for (const auto& value : values) {
+        if constexpr (std::is_same_v<ValType, StringRef>) {
+            StringRef ref(value.data(), value.size());
+            dst->add_distinct_values(_field->to_string(reinterpret_cast<const char*>(&ref)));
+        } else {
+            auto cell = unaligned_load<ValType>(value.data());
+            dst->add_distinct_values(_field->to_string(reinterpret_cast<const char*>(&cell)));
+        }
+    }
 }
 
 template <PrimitiveType Type>
@@ -98,11 +149,27 @@ Status TypedZoneMapIndexWriter<Type>::flush() {
     if (_page_zone_map.has_not_null) {
         _segment_zone_map.has_not_null = true;
     }
+    if (_page_distinct_values_overflow) {
+        _segment_distinct_values_overflow = true;
+        _segment_distinct_values.clear();
+    } else if (!_segment_distinct_values_overflow) {
+        _segment_distinct_values.insert(_page_distinct_values.begin(),
+                                        _page_distinct_values.end());
+        if (_segment_distinct_values.size() > _max_distinct_values) {
+            _segment_distinct_values_overflow = true;
+            _segment_distinct_values.clear();
+        }
+    }
 
     ZoneMapPB zone_map_pb;
     moidfy_index_before_flush(_page_zone_map);
     _page_zone_map.to_proto(&zone_map_pb, _field);
+    if (!_page_zone_map.pass_all) {
+        _distinct_values_to_proto(_page_distinct_values, &zone_map_pb);
+    }
     _reset_zone_map(&_page_zone_map);
+    _page_distinct_values.clear();
+    _page_distinct_values_overflow = _max_distinct_values == 0;
 
     std::string serialized_zone_map;
     bool ret = zone_map_pb.SerializeToString(&serialized_zone_map);
@@ -122,6 +189,7 @@ Status TypedZoneMapIndexWriter<Type>::finish(io::FileWriter* file_writer,
     // store segment zone map
     moidfy_index_before_flush(_segment_zone_map);
     _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _field);
+    _distinct_values_to_proto(_segment_distinct_values, meta->mutable_segment_zone_map());
 
     // write out zone map for each data pages
     const auto* type_info = get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_BITMAP>();
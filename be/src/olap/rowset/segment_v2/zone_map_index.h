@@ -18,6 +18,7 @@
 #pragma once
 
 #include <gen_cpp/segment_v2.pb.h>
+#include <parallel_hashmap/phmap.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -100,6 +101,11 @@ public:
 // The IndexedColumn stores serialized ZoneMapPB for each data page.
 // It also create and store the segment-level zone map in the index meta so that
 // reader can prune an entire segment without reading pages.
+//
+// If `config::zone_map_max_distinct_values` is positive, the zone maps of a page and of the
+// segment also keep their distinct values when there are no more than that, so that an
+// `IN` or `=` predicate prunes the zones its values fall between the min and the max of,
+// but do not appear in.
 template <PrimitiveType Type>
 class TypedZoneMapIndexWriter final : public ZoneMapIndexWriter {
 public:
@@ -130,6 +136,11 @@ private:
         zone_map->pass_all = false;
     }
 
+    // overflow once there are more distinct values than `_max_distinct_values`
+    void _add_distinct_value(const void* value);
+    void _distinct_values_to_proto(const phmap::flat_hash_set<std::string>& values,
+                                   ZoneMapPB* dst) const;
+
     Field* _field = nullptr;
     // memory will be managed by Arena
     ZoneMap _page_zone_map;
@@ -138,6 +149,14 @@ private:
     // for field. But Arena allocate 4KB least, it will a waste for most cases.
     vectorized::Arena _arena;
 
+    // the distinct values of the current page and of the segment in the storage format,
+    // cleared once they overflow
+    const size_t _max_distinct_values;
+    phmap::flat_hash_set<std::string> _page_distinct_values;
+    phmap::flat_hash_set<std::string> _segment_distinct_values;
+    bool _page_distinct_values_overflow = false;
+    bool _segment_distinct_values_overflow = false;
+
     // serialized ZoneMapPB for each data page
     std::vector<std::string> _values;
     uint64_t _estimated_size = 0;
@@ -33,6 +33,7 @@
 #include "common/status.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_common.h" // for rowset id
+#include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "util/time.h"
@@ -86,7 +87,9 @@ public:
             : LRUCachePolicy(
                       CachePolicy::CacheType::SEGMENT_CACHE, memory_bytes_limit, LRUCacheType::SIZE,
                       config::tablet_rowset_stale_sweep_time_sec, DEFAULT_LRU_CACHE_NUM_SHARDS * 2,
-                      cast_set<uint32_t>(segment_num_limit), config::enable_segment_cache_prune) {}
+                      cast_set<uint32_t>(segment_num_limit), config::enable_segment_cache_prune,
+                      config::enable_storage_cache_tiny_lfu ? LRUCacheEvictionPolicy::TINY_LFU
+                                                            : LRUCacheEvictionPolicy::LRU) {}
 
     // Lookup the given segment in the cache.
     // If the segment is found, the cache entry will be written into handle.
@@ -170,6 +173,16 @@ public:
 
     std::vector<segment_v2::SegmentSharedPtr>& get_segments() { return segments; }
 
+    // Primary key index iterator of the `idx`-th segment, kept for the lifetime of the
+    // handle so that consecutive lookups in sorted order reuse the loaded index pages.
+    std::unique_ptr<segment_v2::IndexedColumnIterator>* pk_index_iterator(size_t idx) {
+        if (_pk_index_iterators.size() < segments.size()) {
+            _pk_index_iterators.resize(segments.size());
+        }
+        DCHECK_LT(idx, _pk_index_iterators.size());
+        return &_pk_index_iterators[idx];
+    }
+
     [[nodiscard]] bool is_inited() const { return _init; }
 
     void set_inited() {
@@ -191,6 +204,7 @@ public:
 
 private:
     std::vector<segment_v2::SegmentSharedPtr> segments;
+    std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>> _pk_index_iterators;
     bool _init {false};
 
     // Don't allow copy and assign
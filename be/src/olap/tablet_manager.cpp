@@ -28,6 +28,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <list>
 #include <mutex>
 #include <ostream>
@@ -728,6 +730,33 @@ struct TabletScore {
     int score;
 };
 
+// Scale the compaction score by how often queries scan the tablet, so the versions of the
+// tablets which are actually read get merged first and idle tablets wait.
+static uint32_t _read_weighted_compaction_score(const TabletSharedPtr& tablet, uint32_t score,
+                                                int64_t now_ms) {
+    if (config::compaction_score_read_hotness_weight <= 0 || tablet->query_scan_count == nullptr) {
+        return score;
+    }
+    int64_t last_update_ms = tablet->compaction_read_hotness_update_ms.load();
+    if (now_ms - last_update_ms >= 60 * 1000 &&
+        tablet->compaction_read_hotness_update_ms.compare_exchange_strong(last_update_ms, now_ms)) {
+        int64_t scan_count = tablet->query_scan_count->value();
+        int64_t recent_scans =
+                scan_count - tablet->compaction_read_hotness_scan_count.exchange(scan_count);
+        // the first round only takes the snapshot, the scans before it are not recent
+        if (last_update_ms == 0) {
+            recent_scans = 0;
+        }
+        tablet->compaction_read_hotness =
+                tablet->compaction_read_hotness / 2 + std::max<int64_t>(0, recent_scans);
+    }
+    auto hotness = static_cast<double>(tablet->compaction_read_hotness.load());
+    double weighted = score * (1 + config::compaction_score_read_hotness_weight *
+                                           std::log2(1 + hotness));
+    return static_cast<uint32_t>(
+            std::min(weighted, static_cast<double>(std::numeric_limits<uint32_t>::max())));
+}
+
 std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         CompactionType compaction_type, DataDir* data_dir,
         const std::unordered_set<TabletSharedPtr>& tablet_submitted_compaction, uint32_t* score,
@@ -737,6 +766,8 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    // highest score weighted by read hotness, which is what tablets are ranked by
+    uint32_t highest_sched_score = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
@@ -804,6 +835,8 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score <= 0) {
             return;
         }
+        uint32_t sched_score =
+                _read_weighted_compaction_score(tablet_ptr, current_compaction_score, now_ms);
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -818,10 +851,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
 
         if (compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
-            ts.score = current_compaction_score;
+            ts.score = sched_score;
             ts.tablet_ptr = tablet_ptr;
             if ((top_tablets.size() >= compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 sched_score > top_tablets.top().score) ||
                 top_tablets.size() < compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -834,10 +867,11 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (sched_score > highest_sched_score && !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
+                    highest_sched_score = sched_score;
                     highest_score = current_compaction_score;
                     best_tablet = tablet_ptr;
                 }
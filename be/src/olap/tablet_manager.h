@@ -20,6 +20,7 @@
 #include <butil/macros.h>
 #include <gen_cpp/BackendService_types.h>
 #include <gen_cpp/Types_types.h>
+#include <parallel_hashmap/phmap.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,6 +37,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/compiler_util.h"
 #include "common/status.h"
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
@@ -230,9 +232,12 @@ private:
 private:
     DISALLOW_COPY_AND_ASSIGN(TabletManager);
 
-    using tablet_map_t = std::unordered_map<int64_t, TabletSharedPtr>;
+    // Looked up on every scan, load and report, a flat map keeps a lookup within the shard's
+    // contiguous slots instead of chasing a node per bucket.
+    using tablet_map_t = phmap::flat_hash_map<int64_t, TabletSharedPtr>;
 
-    struct tablets_shard {
+    // Aligned to a cache line so that readers locking neighbouring shards do not false share.
+    struct alignas(CACHE_LINE_SIZE) tablets_shard {
         tablets_shard() = default;
         tablets_shard(tablets_shard&& shard) {
             tablet_map = std::move(shard.tablet_map);
@@ -770,6 +770,9 @@ void TabletMeta::init_from_pb(const TabletMetaPB& tablet_meta_pb) {
             auto bitmap = tablet_meta_pb.delete_bitmap().segment_delete_bitmaps(i).data();
             delete_bitmap().delete_bitmap[{rst_id, seg_id, ver}] = roaring::Roaring::read(bitmap);
         }
+        if (config::enable_delete_bitmap_run_optimize) {
+            delete_bitmap().run_optimize();
+        }
     }
 
     if (tablet_meta_pb.has_binlog_config()) {
@@ -1294,6 +1297,19 @@ uint64_t DeleteBitmap::get_size() const {
     return charge;
 }
 
+uint64_t DeleteBitmap::run_optimize() {
+    std::lock_guard l(lock);
+    uint64_t saved = 0;
+    for (auto& [k, v] : delete_bitmap) {
+        size_t before = v.getSizeInBytes();
+        v.runOptimize();
+        v.shrinkToFit();
+        size_t after = v.getSizeInBytes();
+        saved += before > after ? before - after : 0;
+    }
+    return saved;
+}
+
 bool DeleteBitmap::contains_agg_without_cache(const BitmapKey& bmk, uint32_t row_id) const {
     std::shared_lock l(lock);
     DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), 0};
@@ -493,6 +493,14 @@ public:
 
     uint64_t get_size() const;
 
+    /**
+     * Converts the bitmaps to run containers where it is smaller and releases
+     * their spare capacity, the content is not changed
+     *
+     * @return the number of bytes saved
+     */
+    uint64_t run_optimize();
+
     /**
      * Sets the bitmap of specific segment, it's may be insertion or replacement
      *
@@ -29,6 +29,8 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -66,6 +68,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -677,6 +680,7 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
     std::vector<std::pair<std::string, size_t>> batch_files;
     for (size_t i = 0; i < total_files;) {
         size_t batch_file_size = 0;
@@ -691,20 +695,68 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_file_size += file_info_list[j].second;
         }
 
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
-            return Status::Error<EXCEEDED_LIMIT>(
-                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                    batch_file_size);
-        }
-
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
         total_file_size += batch_file_size;
         i += batch_files.size();
+        batches.push_back(std::move(batch_files));
         batch_files.clear();
     }
 
+    // check disk capacity
+    if (data_dir->reach_capacity_limit(total_file_size)) {
+        return Status::Error<EXCEEDED_LIMIT>("reach the capacity limit of path {}, file_size={}",
+                                             data_dir->path(), total_file_size);
+    }
+
+    // The last batch holds the header file, it is downloaded after all the others.
+    const size_t parallelism = std::min(
+            static_cast<size_t>(std::max(config::clone_download_parallelism, 1)),
+            batches.empty() ? size_t(1) : batches.size() - 1);
+    if (parallelism <= 1) {
+        for (const auto& batch : batches) {
+            RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch));
+        }
+    } else {
+        // The data files are independent of each other, download them in concurrent streams
+        std::unique_ptr<ThreadPool> download_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownloadPool")
+                                .set_min_threads(static_cast<int>(parallelism))
+                                .set_max_threads(static_cast<int>(parallelism))
+                                .build(&download_pool));
+        std::vector<Status> statuses(batches.size() - 1);
+        std::atomic<bool> failed {false};
+        Status submit_st;
+        for (size_t i = 0; i + 1 < batches.size(); ++i) {
+            submit_st = download_pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(_mem_tracker);
+                if (failed) {
+                    statuses[i] = Status::Cancelled("another batch failed to download");
+                    return;
+                }
+                statuses[i] = download_files_v2(address, token, remote_dir, local_dir, batches[i]);
+                if (!statuses[i].ok()) {
+                    failed = true;
+                }
+            });
+            if (!submit_st.ok()) {
+                failed = true;
+                break;
+            }
+        }
+        download_pool->wait();
+        RETURN_IF_ERROR(submit_st);
+        // Report the first real failure rather than a cancellation caused by it
+        for (const auto& st : statuses) {
+            if (!st.ok() && !st.is<ErrorCode::CANCELLED>()) {
+                return st;
+            }
+        }
+        for (const auto& st : statuses) {
+            RETURN_IF_ERROR(st);
+        }
+        RETURN_IF_ERROR(
+                download_files_v2(address, token, remote_dir, local_dir, batches.back()));
+    }
+
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
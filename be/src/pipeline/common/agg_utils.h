@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/common/arena.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
@@ -318,4 +321,99 @@ private:
     uint32_t _total_count {};
     bool _inited = false;
 };
+
+// Aggregate states stored by columns: the states of each aggregate function live in their own
+// contiguous chunks indexed by the group id, instead of one row-wise blob per group addressed by
+// `AggregateDataPtr` and the offsets of the functions. The updates of one function touch only its
+// own states, and the states of one function can be serialized or released on their own.
+class ColumnarAggregateStates {
+public:
+    explicit ColumnarAggregateStates(std::vector<const vectorized::IAggregateFunction*> functions)
+            : _functions(std::move(functions)), _chunks(_functions.size()) {}
+
+    ~ColumnarAggregateStates() {
+        for (size_t i = 0; i < _functions.size(); ++i) {
+            for (size_t chunk = 0; chunk < _chunks[i].size(); ++chunk) {
+                _functions[i]->destroy_vec(_chunks[i][chunk], _rows_in_chunk(chunk));
+            }
+        }
+    }
+
+    ColumnarAggregateStates(const ColumnarAggregateStates&) = delete;
+    ColumnarAggregateStates& operator=(const ColumnarAggregateStates&) = delete;
+
+    // Append a group with the states of all the functions created, returns its group id.
+    uint32_t append_group() {
+        if (UNLIKELY(!_functions.empty() && _chunks[0].size() * CHUNK_CAPACITY == _total_count)) {
+            for (size_t i = 0; i < _functions.size(); ++i) {
+                DCHECK_EQ(_functions[i]->size_of_data() % _functions[i]->align_of_data(), 0);
+                _chunks[i].emplace_back(_arena_pool.aligned_alloc(
+                        _functions[i]->size_of_data() * CHUNK_CAPACITY,
+                        _functions[i]->align_of_data()));
+            }
+        }
+        for (size_t i = 0; i < _functions.size(); ++i) {
+            try {
+                _functions[i]->create(state(i, _total_count));
+            } catch (...) {
+                for (size_t j = 0; j < i; ++j) {
+                    _functions[j]->destroy(state(j, _total_count));
+                }
+                throw;
+            }
+        }
+        return _total_count++;
+    }
+
+    vectorized::AggregateDataPtr state(size_t function_idx, uint32_t group_id) const {
+        return _chunks[function_idx][group_id / CHUNK_CAPACITY] +
+               _functions[function_idx]->size_of_data() * (group_id % CHUNK_CAPACITY);
+    }
+
+    // Add the rows of `columns` into the states of function `function_idx` of their groups.
+    void add_batch(size_t function_idx, const uint32_t* group_ids, size_t rows,
+                   const vectorized::IColumn** columns, vectorized::Arena& arena) {
+        _places.resize(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            _places[i] = state(function_idx, group_ids[i]);
+        }
+        _functions[function_idx]->add_batch(rows, _places.data(), 0, columns, arena, false);
+    }
+
+    // Insert the results of function `function_idx` of all the groups in group id order.
+    void insert_results_into(size_t function_idx, vectorized::IColumn& to) {
+        _fill_places(function_idx);
+        _functions[function_idx]->insert_result_into_vec(_places, 0, to, _total_count);
+    }
+
+    // Serialize the states of function `function_idx` of all the groups in group id order.
+    void serialize_to_column(size_t function_idx, vectorized::MutableColumnPtr& dst) {
+        _fill_places(function_idx);
+        _functions[function_idx]->serialize_to_column(_places, 0, dst, _total_count);
+    }
+
+    [[nodiscard]] uint32_t total_count() const { return _total_count; }
+
+    int64_t memory_usage() const { return _arena_pool.size(); }
+
+private:
+    size_t _rows_in_chunk(size_t chunk) const {
+        return std::min<size_t>(CHUNK_CAPACITY, _total_count - chunk * CHUNK_CAPACITY);
+    }
+
+    void _fill_places(size_t function_idx) {
+        _places.resize(_total_count);
+        for (uint32_t i = 0; i < _total_count; ++i) {
+            _places[i] = state(function_idx, i);
+        }
+    }
+
+    static constexpr uint32_t CHUNK_CAPACITY = 8192;
+    std::vector<const vectorized::IAggregateFunction*> _functions;
+    // The chunks of states of each function.
+    std::vector<std::vector<vectorized::AggregateDataPtr>> _chunks;
+    std::vector<vectorized::AggregateDataPtr> _places;
+    vectorized::Arena _arena_pool;
+    uint32_t _total_count {};
+};
 } // namespace doris
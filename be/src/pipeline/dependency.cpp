@@ -17,6 +17,8 @@
 
 #include "dependency.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <mutex>
 
@@ -32,6 +34,7 @@
 #include "vec/exec/scan/file_scanner.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
+#include "vec/runtime/partitioner.h"
 #include "vec/spill/spill_stream_manager.h"
 #include "vec/utils/util.hpp"
 
@@ -61,51 +64,73 @@ Dependency* BasicSharedState::create_sink_dependency(int dest_id, int node_id,
     return sink_deps.back().get();
 }
 
-void Dependency::_add_block_task(std::shared_ptr<PipelineTask> task) {
-    DCHECK(_blocked_task.empty() || _blocked_task[_blocked_task.size() - 1].lock() == nullptr ||
-           _blocked_task[_blocked_task.size() - 1].lock().get() != task.get())
-            << "Duplicate task: " << task->debug_string();
-    _blocked_task.push_back(task);
+Dependency::~Dependency() {
+    auto* node = _blocked_tasks.load();
+    while (node != nullptr && node != _ready_tag()) {
+        auto* next = node->next;
+        delete node;
+        node = next;
+    }
 }
 
 void Dependency::set_ready() {
-    if (_ready) {
+    if (ready()) {
         return;
     }
     _watcher.stop();
-    std::vector<std::weak_ptr<PipelineTask>> local_block_task {};
-    {
-        std::unique_lock<std::mutex> lc(_task_lock);
-        if (_ready) {
-            return;
-        }
-        _ready = true;
-        local_block_task.swap(_blocked_task);
+    auto* head = _blocked_tasks.exchange(_ready_tag());
+    if (head == _ready_tag()) {
+        return;
     }
-    for (auto task : local_block_task) {
-        if (auto t = task.lock()) {
-            std::unique_lock<std::mutex> lc(_task_lock);
-            THROW_IF_ERROR(t->wake_up(this));
+    int num_nodes = 0;
+    std::vector<PipelineTaskSPtr> tasks;
+    while (head != nullptr) {
+        auto* next = head->next;
+        if (auto t = head->task.lock()) {
+            tasks.push_back(std::move(t));
         }
+        delete head;
+        head = next;
+        num_nodes++;
+    }
+    _num_blocked_tasks -= num_nodes;
+    if (!tasks.empty()) {
+        // The stack is LIFO, wake up the tasks in the order they were blocked.
+        std::reverse(tasks.begin(), tasks.end());
+        THROW_IF_ERROR(PipelineTask::wake_up(this, tasks));
     }
 }
 
 Dependency* Dependency::is_blocked_by(std::shared_ptr<PipelineTask> task) {
-    std::unique_lock<std::mutex> lc(_task_lock);
-    auto ready = _ready.load();
-    if (!ready && task) {
-        _add_block_task(task);
-        start_watcher();
-        THROW_IF_ERROR(task->blocked(this));
+    auto* head = _blocked_tasks.load();
+    if (head == _ready_tag()) {
+        return nullptr;
+    }
+    if (!task) {
+        return this;
+    }
+    // The task must be in the blocked state before it is visible to `set_ready`.
+    THROW_IF_ERROR(task->blocked(this));
+    start_watcher();
+    _num_blocked_tasks++;
+    auto* node = new BlockedTaskNode {task, head};
+    while (!_blocked_tasks.compare_exchange_weak(node->next, node)) {
+        if (node->next == _ready_tag()) {
+            // Became ready before the task is pushed, nobody will wake it up, so keep running.
+            delete node;
+            _num_blocked_tasks--;
+            THROW_IF_ERROR(task->unblocked(this));
+            return nullptr;
+        }
     }
-    return ready ? nullptr : this;
+    return this;
 }
 
 std::string Dependency::debug_string(int indentation_level) {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer, "{}{}: id={}, block task = {}, ready={}, _always_ready={}",
-                   std::string(indentation_level * 2, ' '), _name, _node_id, _blocked_task.size(),
-                   _ready, _always_ready);
+                   std::string(indentation_level * 2, ' '), _name, _node_id,
+                   _num_blocked_tasks.load(), ready(), _always_ready);
     return fmt::to_string(debug_string_buffer);
 }
 
@@ -113,8 +138,8 @@ std::string CountedFinishDependency::debug_string(int indentation_level) {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer,
                    "{}{}: id={}, block_task={}, ready={}, _always_ready={}, count={}",
-                   std::string(indentation_level * 2, ' '), _name, _node_id, _blocked_task.size(),
-                   _ready, _always_ready, _counter);
+                   std::string(indentation_level * 2, ' '), _name, _node_id,
+                   _num_blocked_tasks.load(), ready(), _always_ready, _counter);
     return fmt::to_string(debug_string_buffer);
 }
 
@@ -126,6 +151,14 @@ void RuntimeFilterTimer::call_ready() {
     _parent->set_ready();
 }
 
+void RuntimeFilterTimer::extend_wait_time(int32_t extension_ms) {
+    int64_t wait_time_ms = MonotonicMillis() - _registration_time + extension_ms;
+    if (wait_time_ms > _wait_time_ms) {
+        _wait_time_ms = static_cast<int32_t>(
+                std::min<int64_t>(wait_time_ms, std::numeric_limits<int32_t>::max()));
+    }
+}
+
 // should check rf timeout in two case:
 // 1. the rf is ready just remove the wait queue
 // 2. if the rf have local dependency, the rf should start wait when all local dependency is ready
@@ -462,6 +495,120 @@ Status SetSharedState::hash_table_init() {
     return init_hash_method<SetDataVariants>(hash_table_variants.get(), data_types, true);
 }
 
+void SetSharedState::init_spill_params(size_t partition_count) {
+    spill_partition_count = partition_count;
+    spilled_streams.resize(child_quantity);
+    for (auto& streams : spilled_streams) {
+        streams.resize(partition_count);
+    }
+}
+
+Status SetSharedState::extract_spill_key_block(const vectorized::VExprContextSPtrs& ctxs,
+                                               vectorized::Block& block,
+                                               vectorized::Block& key_block) const {
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        int result_col_id = -1;
+        RETURN_IF_ERROR(ctxs[i]->execute(&block, &result_col_id));
+        auto column = block.get_by_position(result_col_id).column->convert_to_full_column_if_const();
+        auto type = block.get_by_position(result_col_id).type;
+        if (build_not_ignore_null[i]) {
+            column = vectorized::make_nullable(column, false);
+            type = vectorized::make_nullable(type);
+        }
+        key_block.insert({std::move(column), std::move(type), ""});
+    }
+    return Status::OK();
+}
+
+Status SetSharedState::partition_spill_block(
+        const vectorized::Block& key_block,
+        std::vector<std::unique_ptr<vectorized::MutableBlock>>& partitioned_blocks) const {
+    const auto rows = cast_set<uint32_t>(key_block.rows());
+    if (rows == 0) {
+        return Status::OK();
+    }
+    // The same hash as the spill partitioner, the rows of all the children with equal keys are
+    // in the same partition.
+    std::vector<uint32_t> hashes(rows, 0);
+    for (const auto& column : key_block) {
+        column.column->update_crcs_with_value(hashes.data(), column.type->get_primitive_type(),
+                                              rows);
+    }
+    std::vector<std::vector<uint32_t>> partition_indexes(spill_partition_count);
+    for (uint32_t i = 0; i != rows; ++i) {
+        partition_indexes[vectorized::SpillPartitionChannelIds()(hashes[i], spill_partition_count)]
+                .emplace_back(i);
+    }
+
+    partitioned_blocks.resize(spill_partition_count);
+    for (size_t i = 0; i != spill_partition_count; ++i) {
+        const auto& indexes = partition_indexes[i];
+        if (indexes.empty()) {
+            continue;
+        }
+        if (!partitioned_blocks[i]) {
+            partitioned_blocks[i] = vectorized::MutableBlock::create_unique(key_block.clone_empty());
+        }
+        RETURN_IF_ERROR(partitioned_blocks[i]->add_rows(&key_block, indexes.data(),
+                                                        indexes.data() + indexes.size()));
+    }
+    return Status::OK();
+}
+
+Status SetSharedState::spill_partitioned_blocks(
+        RuntimeState* state, int child_id, int node_id, RuntimeProfile* operator_profile,
+        std::vector<std::unique_ptr<vectorized::MutableBlock>>& partitioned_blocks, bool eos) {
+    auto& streams = spilled_streams[child_id];
+    for (size_t i = 0; i != partitioned_blocks.size() && !state->is_cancelled(); ++i) {
+        auto& partitioned_block = partitioned_blocks[i];
+        if (!partitioned_block || partitioned_block->empty()) {
+            continue;
+        }
+        if (!streams[i]) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, streams[i], print_id(state->query_id()), "set", node_id,
+                    std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                    operator_profile));
+        }
+        RETURN_IF_ERROR(streams[i]->spill_block(state, partitioned_block->to_block(), false));
+        partitioned_block.reset();
+    }
+
+    if (eos) {
+        for (auto& stream : streams) {
+            if (stream) {
+                RETURN_IF_ERROR(stream->spill_eof());
+            }
+        }
+    }
+    return Status::OK();
+}
+
+void SetSharedState::update_spill_stream_profiles(RuntimeProfile* source_profile) {
+    for (auto& streams : spilled_streams) {
+        for (auto& stream : streams) {
+            if (stream) {
+                stream->update_shared_profiles(source_profile);
+            }
+        }
+    }
+}
+
+void SetSharedState::close() {
+    bool false_close = false;
+    if (!is_closed.compare_exchange_strong(false_close, true)) {
+        return;
+    }
+    for (auto& streams : spilled_streams) {
+        for (auto& stream : streams) {
+            if (stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+                stream.reset();
+            }
+        }
+    }
+}
+
 void AggSharedState::refresh_top_limit(size_t row_id,
                                        const vectorized::ColumnRawPtrs& key_columns) {
     for (int j = 0; j < key_columns.size(); ++j) {
@@ -41,6 +41,7 @@
 #include "pipeline/exec/data_queue.h"
 #include "pipeline/exec/join/process_hash_table_probe.h"
 #include "util/brpc_closure.h"
+#include "util/hot_path_metrics.h"
 #include "util/stack_util.h"
 #include "vec/common/sort/partition_sorter.h"
 #include "vec/common/sort/sorter.h"
@@ -104,15 +105,18 @@ class Dependency : public std::enable_shared_from_this<Dependency> {
 public:
     ENABLE_FACTORY_CREATOR(Dependency);
     Dependency(int id, int node_id, std::string name, bool ready = false)
-            : _id(id), _node_id(node_id), _name(std::move(name)), _ready(ready) {}
-    virtual ~Dependency() = default;
+            : _id(id),
+              _node_id(node_id),
+              _name(std::move(name)),
+              _blocked_tasks(ready ? _ready_tag() : nullptr) {}
+    virtual ~Dependency();
 
     [[nodiscard]] int id() const { return _id; }
     [[nodiscard]] virtual std::string name() const { return _name; }
     BasicSharedState* shared_state() { return _shared_state; }
     void set_shared_state(BasicSharedState* shared_state) { _shared_state = shared_state; }
     virtual std::string debug_string(int indentation_level = 0);
-    bool ready() const { return _ready; }
+    bool ready() const { return _blocked_tasks.load() == _ready_tag(); }
 
     // Start the watcher. We use it to count how long this dependency block the current pipeline task.
     void start_watcher() { _watcher.start(); }
@@ -136,18 +140,22 @@ public:
         if (_always_ready) {
             return;
         }
-        std::unique_lock<std::mutex> lc(_always_ready_lock);
+        hot_path_metrics::lock(_always_ready_lock, HotLock::DEPENDENCY);
+        std::unique_lock<std::mutex> lc(_always_ready_lock, std::adopt_lock);
         if (_always_ready) {
             return;
         }
-        _ready = false;
+        // Nothing to do if it is not ready, the blocked tasks are kept.
+        auto* expected = _ready_tag();
+        _blocked_tasks.compare_exchange_strong(expected, nullptr);
     }
 
     void set_always_ready() {
         if (_always_ready) {
             return;
         }
-        std::unique_lock<std::mutex> lc(_always_ready_lock);
+        hot_path_metrics::lock(_always_ready_lock, HotLock::DEPENDENCY);
+        std::unique_lock<std::mutex> lc(_always_ready_lock, std::adopt_lock);
         if (_always_ready) {
             return;
         }
@@ -156,19 +164,25 @@ public:
     }
 
 protected:
-    void _add_block_task(std::shared_ptr<PipelineTask> task);
+    // The blocked tasks are kept in a lock-free stack (multi producers, single consumer), and the
+    // readiness is encoded in its head: `_ready_tag()` means ready and no task can be pushed.
+    // `is_blocked_by` pushes a task only if the head is not `_ready_tag()`, and `set_ready` swaps
+    // the whole stack with `_ready_tag()`, so a wakeup is never lost without taking a lock.
+    struct BlockedTaskNode {
+        std::weak_ptr<PipelineTask> task;
+        BlockedTaskNode* next = nullptr;
+    };
+    static BlockedTaskNode* _ready_tag() { return reinterpret_cast<BlockedTaskNode*>(uintptr_t(1)); }
 
     const int _id;
     const int _node_id;
     const std::string _name;
-    std::atomic<bool> _ready;
+    std::atomic<BlockedTaskNode*> _blocked_tasks;
+    std::atomic<int> _num_blocked_tasks = 0;
 
     BasicSharedState* _shared_state = nullptr;
     MonotonicStopWatch _watcher;
 
-    std::mutex _task_lock;
-    std::vector<std::weak_ptr<PipelineTask>> _blocked_task;
-
     // If `_always_ready` is true, `block()` will never block tasks.
     std::atomic<bool> _always_ready = false;
     std::mutex _always_ready_lock;
@@ -185,7 +199,8 @@ public:
             : Dependency(id, node_id, std::move(name), true) {}
 
     void add(uint32_t count = 1) {
-        std::unique_lock<std::mutex> l(_mtx);
+        hot_path_metrics::lock(_mtx, HotLock::DEPENDENCY);
+        std::unique_lock<std::mutex> l(_mtx, std::adopt_lock);
         if (!_counter) {
             block();
         }
@@ -193,7 +208,8 @@ public:
     }
 
     void sub() {
-        std::unique_lock<std::mutex> l(_mtx);
+        hot_path_metrics::lock(_mtx, HotLock::DEPENDENCY);
+        std::unique_lock<std::mutex> l(_mtx, std::adopt_lock);
         _counter--;
         if (!_counter) {
             set_ready();
@@ -226,6 +242,10 @@ public:
     int64_t registration_time() const { return _registration_time; }
     int32_t wait_time_ms() const { return _wait_time_ms; }
 
+    // Keep waiting at least `extension_ms` from now, called when the filter is known to be
+    // close to arriving.
+    void extend_wait_time(int32_t extension_ms);
+
     void set_local_runtime_filter_dependencies(
             const std::vector<std::shared_ptr<Dependency>>& deps) {
         _local_runtime_filter_dependencies = deps;
@@ -240,8 +260,8 @@ private:
     std::shared_ptr<Dependency> _parent = nullptr;
     std::vector<std::shared_ptr<Dependency>> _local_runtime_filter_dependencies;
     std::mutex _lock;
-    int64_t _registration_time;
-    const int32_t _wait_time_ms;
+    std::atomic<int64_t> _registration_time;
+    std::atomic<int32_t> _wait_time_ms;
     // true only for group_commit_scan_operator
     bool _force_wait_timeout;
 };
@@ -593,6 +613,49 @@ struct JoinSharedState : public BasicSharedState {
     JoinOpVariants join_op_variants;
 };
 
+// The chained build of a shared hash table by all the instances of a broadcast join. The instance
+// building the hash table publishes the rows, every instance takes ranges of them until none is
+// left. The hash table is complete once `finished` returns true.
+class ParallelJoinBuild {
+public:
+    void start(uint32_t begin, uint32_t end, uint32_t range_rows,
+               std::function<void(uint32_t, uint32_t)> build_range) {
+        _build_range = std::move(build_range);
+        _end = end;
+        _range_rows = range_rows;
+        _total_rows = end - begin;
+        _next_row.store(begin, std::memory_order_relaxed);
+        _started.store(true, std::memory_order_release);
+    }
+
+    bool started() const { return _started.load(std::memory_order_acquire); }
+
+    // Build the ranges left, returns whether all the rows are built.
+    bool run() {
+        while (true) {
+            auto begin = _next_row.fetch_add(_range_rows, std::memory_order_relaxed);
+            if (begin >= _end) {
+                break;
+            }
+            auto end = std::min<uint64_t>(_end, begin + _range_rows);
+            _build_range(static_cast<uint32_t>(begin), static_cast<uint32_t>(end));
+            _built_rows.fetch_add(end - begin, std::memory_order_acq_rel);
+        }
+        return finished();
+    }
+
+    bool finished() const { return _built_rows.load(std::memory_order_acquire) == _total_rows; }
+
+private:
+    std::function<void(uint32_t, uint32_t)> _build_range;
+    uint64_t _end = 0;
+    uint64_t _range_rows = 0;
+    uint64_t _total_rows = 0;
+    std::atomic<uint64_t> _next_row = 0;
+    std::atomic<uint64_t> _built_rows = 0;
+    std::atomic<bool> _started = false;
+};
+
 struct HashJoinSharedState : public JoinSharedState {
     ENABLE_FACTORY_CREATOR(HashJoinSharedState)
     HashJoinSharedState() {
@@ -621,6 +684,8 @@ struct HashJoinSharedState : public JoinSharedState {
     // memory in `_hash_table_variants`. So before execution, we should use a local _hash_table_variants
     // which has a shared hash table in it.
     std::vector<std::shared_ptr<JoinDataVariants>> hash_table_variant_vector;
+
+    ParallelJoinBuild parallel_build;
 };
 
 struct PartitionedHashJoinSharedState
@@ -641,6 +706,9 @@ struct PartitionedHashJoinSharedState
     std::shared_ptr<HashJoinSharedState> inner_shared_state;
     std::vector<std::unique_ptr<vectorized::MutableBlock>> partitioned_build_blocks;
     std::vector<vectorized::SpillStreamSPtr> spilled_streams;
+    // The partitions whose build rows are written to `spilled_streams`, the build rows of the
+    // other partitions are kept in `partitioned_build_blocks` until memory is revoked again.
+    std::vector<bool> spilled_partitions;
     bool need_to_spill = false;
 };
 
@@ -665,7 +733,9 @@ public:
     std::mutex prepared_finish_lock;
 };
 
-struct SetSharedState : public BasicSharedState {
+struct SetSharedState : public BasicSharedState,
+                        public BasicSpillSharedState,
+                        public std::enable_shared_from_this<SetSharedState> {
     ENABLE_FACTORY_CREATOR(SetSharedState)
 public:
     /// default init
@@ -704,6 +774,41 @@ public:
 
     /// called in setup_local_state
     Status hash_table_init();
+
+    // Reset the visited flags after a probe child finished, and shrink the hash table if most
+    // of the elements can not be in the result any more.
+    template <bool is_intersect>
+    void refresh_hash_table();
+
+    /// spill
+    // Once the build side is spilled, the key columns of every child are hash partitioned into
+    // `spilled_streams`, and the source processes the partitions one by one.
+    bool is_spilled = false;
+    std::atomic_bool is_closed = false;
+    size_t spill_partition_count = 0;
+    //The i-th is the spilled partitions of the i-th child.
+    std::vector<std::vector<vectorized::SpillStreamSPtr>> spilled_streams;
+
+    void init_spill_params(size_t partition_count);
+
+    // The key columns of `block` after the nullable cast, the same as the columns in hash table.
+    Status extract_spill_key_block(const vectorized::VExprContextSPtrs& ctxs,
+                                   vectorized::Block& block, vectorized::Block& key_block) const;
+
+    // Append the rows of `key_block` to the partitions of their keys.
+    Status partition_spill_block(
+            const vectorized::Block& key_block,
+            std::vector<std::unique_ptr<vectorized::MutableBlock>>& partitioned_blocks) const;
+
+    // Write the partitioned blocks of the child to its spill streams, the streams are finished
+    // if `eos`.
+    Status spill_partitioned_blocks(
+            RuntimeState* state, int child_id, int node_id, RuntimeProfile* operator_profile,
+            std::vector<std::unique_ptr<vectorized::MutableBlock>>& partitioned_blocks, bool eos);
+
+    void update_spill_stream_profiles(RuntimeProfile* source_profile) override;
+
+    void close();
 };
 
 enum class ExchangeType : uint8_t {
@@ -263,20 +263,25 @@ template <bool limit, bool for_spill>
 Status AggSinkLocalState::_merge_with_serialized_key_helper(vectorized::Block* block) {
     SCOPED_TIMER(_merge_timer);
 
+    // If the merge of this block yielded in the last run, the keys are already emplaced into the
+    // hash table and `_places` is still valid, just continue the merge of the remaining functions.
+    const size_t resume_evaluator = _merge_next_evaluator;
     size_t key_size = Base::_shared_state->probe_expr_ctxs.size();
     vectorized::ColumnRawPtrs key_columns(key_size);
     std::vector<int> key_locs(key_size);
 
-    for (int i = 0; i < key_size; ++i) {
-        if constexpr (for_spill) {
-            key_columns[i] = block->get_by_position(i).column.get();
-            key_locs[i] = i;
-        } else {
-            int& result_column_id = key_locs[i];
-            RETURN_IF_ERROR(
-                    Base::_shared_state->probe_expr_ctxs[i]->execute(block, &result_column_id));
-            block->replace_by_position_if_const(result_column_id);
-            key_columns[i] = block->get_by_position(result_column_id).column.get();
+    if (resume_evaluator == 0) {
+        for (int i = 0; i < key_size; ++i) {
+            if constexpr (for_spill) {
+                key_columns[i] = block->get_by_position(i).column.get();
+                key_locs[i] = i;
+            } else {
+                int& result_column_id = key_locs[i];
+                RETURN_IF_ERROR(Base::_shared_state->probe_expr_ctxs[i]->execute(
+                        block, &result_column_id));
+                block->replace_by_position_if_const(result_column_id);
+                key_columns[i] = block->get_by_position(result_column_id).column.get();
+            }
         }
     }
 
@@ -330,12 +335,22 @@ Status AggSinkLocalState::_merge_with_serialized_key_helper(vectorized::Block* b
             need_do_agg = _emplace_into_hash_table_limit(_places.data(), block, key_locs,
                                                          key_columns, (uint32_t)rows);
             rows = block->rows();
-        } else {
+        } else if (resume_evaluator == 0) {
             _emplace_into_hash_table(_places.data(), key_columns, (uint32_t)rows);
         }
 
         if (need_do_agg) {
-            for (int i = 0; i < Base::_shared_state->aggregate_evaluators.size(); ++i) {
+            for (size_t i = resume_evaluator; i < Base::_shared_state->aggregate_evaluators.size();
+                 ++i) {
+                if constexpr (!limit && !for_spill) {
+                    // Merging heavy states (bitmap, hll, quantile...) of a big block may take long,
+                    // yield between the functions when the time slice is used up.
+                    if (i > resume_evaluator && Base::_state->should_yield()) {
+                        _merge_next_evaluator = i;
+                        Base::_state->set_sink_yielded();
+                        return Status::OK();
+                    }
+                }
                 if (Base::_shared_state->aggregate_evaluators[i]->is_merge() || for_spill) {
                     size_t col_id = 0;
                     if constexpr (for_spill) {
@@ -377,6 +392,7 @@ Status AggSinkLocalState::_merge_with_serialized_key_helper(vectorized::Block* b
                             _places.data(), _agg_arena_pool));
                 }
             }
+            _merge_next_evaluator = 0;
         }
 
         if (!limit && _should_limit_output) {
@@ -863,10 +879,17 @@ Status AggSinkOperatorX::_check_agg_fn_output() {
 Status AggSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_block, bool eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
-    COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
-    local_state._shared_state->input_num_rows += in_block->rows();
+    // `in_block` is already counted if its merge yielded in the last run.
+    if (local_state._merge_next_evaluator == 0) {
+        COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
+        local_state._shared_state->input_num_rows += in_block->rows();
+    }
     if (in_block->rows() > 0) {
         RETURN_IF_ERROR(local_state._executor->execute(&local_state, in_block));
+        if (local_state._merge_next_evaluator > 0) {
+            // yielded in the middle of the block, it will be sunk again in the next run
+            return Status::OK();
+        }
         local_state._executor->update_memusage(&local_state);
         COUNTER_SET(local_state._hash_table_size_counter,
                     (int64_t)local_state._get_hash_table_size());
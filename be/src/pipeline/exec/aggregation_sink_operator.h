@@ -117,6 +117,9 @@ protected:
 
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
+    // The first aggregate function to merge if the merge of the current block yielded,
+    // 0 means there is no yielded merge.
+    size_t _merge_next_evaluator = 0;
 
     vectorized::Block _preagg_block = vectorized::Block();
 
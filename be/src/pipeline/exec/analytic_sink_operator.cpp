@@ -24,8 +24,11 @@
 #include <cstdint>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/runtime_state.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 
 namespace doris::pipeline {
@@ -141,6 +144,57 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
                 _agg_functions[i]->function()->supported_incremental_mode();
     }
 
+    _running_frame_input_types.resize(_agg_functions_size, INVALID_TYPE);
+    _use_running_frame_batch =
+            config::enable_analytic_running_frame_batch && _agg_functions_size > 0 &&
+            p._has_window_end && _rows_end_offset == 0 &&
+            _executor.get_next_impl == &AnalyticSinkLocalState::_get_next_for_unbounded_rows;
+    for (int i = 0; i < _agg_functions_size && _use_running_frame_batch; ++i) {
+        const auto* function = _agg_functions[i]->function();
+        if (function->get_name() == "row_number") {
+            _use_running_frame_batch = !_result_column_nullable_flags[i];
+            continue;
+        }
+        if (function->get_name() != "sum" || _agg_input_columns[i].size() != 1 ||
+            _agg_expr_ctxs[i][0]->root()->data_type()->is_nullable()) {
+            _use_running_frame_batch = false;
+            break;
+        }
+        auto input_type = _agg_expr_ctxs[i][0]->root()->data_type()->get_primitive_type();
+        auto result_type = function->get_return_type()->get_primitive_type();
+        if ((is_int(input_type) && input_type != TYPE_LARGEINT && result_type == TYPE_BIGINT) ||
+            (is_float_or_double(input_type) && result_type == TYPE_DOUBLE)) {
+            _running_frame_input_types[i] = input_type;
+        } else {
+            _use_running_frame_batch = false;
+        }
+    }
+
+    _use_sliding_extremum.resize(_agg_functions_size, false);
+    _sliding_extremum_is_max.resize(_agg_functions_size, false);
+    _sliding_extremum_rows.resize(_agg_functions_size);
+    _sliding_extremum_next_rows.resize(_agg_functions_size, 0);
+    _sliding_extremum_partition_starts.resize(_agg_functions_size, -1);
+    if (config::enable_analytic_sliding_extremum && p._has_window_start && p._has_window_end &&
+        _executor.get_next_impl == &AnalyticSinkLocalState::_get_next_for_sliding_rows) {
+        for (int i = 0; i < _agg_functions_size; ++i) {
+            const auto& name = _agg_functions[i]->function()->get_name();
+            if (_agg_input_columns[i].size() != 1 ||
+                (name != "max" && name != "min" && name != "Nullable(max)" &&
+                 name != "Nullable(min)")) {
+                continue;
+            }
+            // compare_at must order the values the same way as min/max, float has NaN
+            auto type = vectorized::remove_nullable(_agg_expr_ctxs[i][0]->root()->data_type())
+                                ->get_primitive_type();
+            if (is_int_or_bool(type) || is_decimal(type) || is_date_type(type) ||
+                is_string_type(type) || is_ip(type)) {
+                _use_sliding_extremum[i] = true;
+                _sliding_extremum_is_max[i] = name == "max" || name == "Nullable(max)";
+            }
+        }
+    }
+
     _partition_exprs_size = p._partition_by_eq_expr_ctxs.size();
     _partition_by_eq_expr_ctxs.resize(_partition_exprs_size);
     _partition_by_columns.resize(_partition_exprs_size);
@@ -228,6 +282,13 @@ bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_ro
 
 bool AnalyticSinkLocalState::_get_next_for_unbounded_rows(int64_t current_block_rows,
                                                           int64_t current_block_base_pos) {
+    if (_use_running_frame_batch && _current_row_position < _partition_by_pose.end) {
+        int64_t end = std::min<int64_t>(_partition_by_pose.end,
+                                        current_block_base_pos + current_block_rows);
+        _execute_running_frame_batch(_current_row_position, end, current_pos_in_block());
+        _current_row_position = end;
+        return _current_row_position - current_block_base_pos >= current_block_rows;
+    }
     const bool is_n_following_frame = _rows_end_offset > 0;
     while (_current_row_position < _partition_by_pose.end) {
         int64_t current_row_end = _current_row_position + _rows_end_offset + 1;
@@ -256,6 +317,81 @@ bool AnalyticSinkLocalState::_get_next_for_unbounded_rows(int64_t current_block_
     return false;
 }
 
+template <typename ColumnType, typename ResultType>
+NO_SANITIZE_UNDEFINED static void running_sum(const vectorized::IColumn& input, int64_t start,
+                                              int64_t end, ResultType carry, ResultType* result) {
+    const auto& data = assert_cast<const ColumnType&>(input).get_data();
+    for (int64_t i = start; i < end; ++i) {
+        carry += ResultType(data[i]);
+        *result++ = carry;
+    }
+}
+
+void AnalyticSinkLocalState::_execute_running_frame_batch(int64_t start, int64_t end, int64_t pos) {
+    const int64_t rows = end - start;
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        const auto* function = _agg_functions[i]->function();
+        auto* to = _result_window_columns[i].get();
+        if (_result_column_nullable_flags[i]) {
+            auto* dst = assert_cast<vectorized::ColumnNullable*>(to);
+            dst->get_null_map_data().resize_fill(
+                    dst->get_null_map_data().size() + static_cast<size_t>(rows), 0);
+            to = &dst->get_nested_column();
+        }
+        // the result of the rows of the partition before `start`
+        auto carry_column = to->clone_empty();
+        function->insert_result_into(place, *carry_column);
+
+        if (_running_frame_input_types[i] == INVALID_TYPE) {
+            // row_number, the result column is resized to the block rows
+            auto carry = assert_cast<const vectorized::ColumnInt64&>(*carry_column).get_data()[0];
+            auto& data = assert_cast<vectorized::ColumnInt64&>(*to).get_data();
+            for (int64_t j = 0; j < rows; ++j) {
+                data[pos + j] = carry + j + 1;
+            }
+            function->add_batch_single_place(rows, place, nullptr, _agg_arena_pool);
+            continue;
+        }
+
+        const auto& input = *_agg_input_columns[i][0];
+        if (is_float_or_double(_running_frame_input_types[i])) {
+            auto& data = assert_cast<vectorized::ColumnFloat64&>(*to).get_data();
+            auto carry = assert_cast<const vectorized::ColumnFloat64&>(*carry_column).get_data()[0];
+            data.resize(data.size() + static_cast<size_t>(rows));
+            auto* result = data.data() + data.size() - rows;
+            if (_running_frame_input_types[i] == TYPE_FLOAT) {
+                running_sum<vectorized::ColumnFloat32>(input, start, end, carry, result);
+            } else {
+                running_sum<vectorized::ColumnFloat64>(input, start, end, carry, result);
+            }
+        } else {
+            auto& data = assert_cast<vectorized::ColumnInt64&>(*to).get_data();
+            auto carry = assert_cast<const vectorized::ColumnInt64&>(*carry_column).get_data()[0];
+            data.resize(data.size() + static_cast<size_t>(rows));
+            auto* result = data.data() + data.size() - rows;
+            switch (_running_frame_input_types[i]) {
+            case TYPE_TINYINT:
+                running_sum<vectorized::ColumnInt8>(input, start, end, carry, result);
+                break;
+            case TYPE_SMALLINT:
+                running_sum<vectorized::ColumnInt16>(input, start, end, carry, result);
+                break;
+            case TYPE_INT:
+                running_sum<vectorized::ColumnInt32>(input, start, end, carry, result);
+                break;
+            default:
+                running_sum<vectorized::ColumnInt64>(input, start, end, carry, result);
+                break;
+            }
+        }
+        const auto* agg_column = &input;
+        function->add_range_single_place(_partition_by_pose.start, _partition_by_pose.end, start,
+                                         end, place, &agg_column, _agg_arena_pool,
+                                         &_use_null_result[i], &_could_use_previous_result[i]);
+    }
+}
+
 bool AnalyticSinkLocalState::_get_next_for_partition(int64_t current_block_rows,
                                                      int64_t current_block_base_pos) {
     if (_current_row_position == _partition_by_pose.start) {
@@ -381,6 +517,10 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         std::vector<const vectorized::IColumn*> agg_columns;
+        if (_use_sliding_extremum[i]) {
+            _execute_sliding_extremum(i, partition_start, partition_end, frame_start, frame_end);
+            continue;
+        }
         for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_agg_input_columns[i][j].get());
         }
@@ -399,6 +539,59 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     }
 }
 
+void AnalyticSinkLocalState::_execute_sliding_extremum(size_t idx, int64_t partition_start,
+                                                       int64_t partition_end, int64_t frame_start,
+                                                       int64_t frame_end) {
+    auto& rows = _sliding_extremum_rows[idx];
+    auto& next_row = _sliding_extremum_next_rows[idx];
+    if (_sliding_extremum_partition_starts[idx] != partition_start) {
+        rows.clear();
+        next_row = partition_start;
+        _sliding_extremum_partition_starts[idx] = partition_start;
+    }
+    // the frames of the consecutive rows of a partition only move forward
+    const int64_t start = std::max<int64_t>(frame_start, partition_start);
+    const int64_t end = std::min<int64_t>(frame_end, partition_end);
+    while (!rows.empty() && rows.front() < start) {
+        rows.pop_front();
+    }
+    next_row = std::max(next_row, start);
+
+    const vectorized::IColumn* column = _agg_input_columns[idx][0].get();
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(column)) {
+        column = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    const bool is_max = _sliding_extremum_is_max[idx];
+    for (; next_row < end; ++next_row) {
+        if (null_map != nullptr && (*null_map)[next_row]) {
+            continue;
+        }
+        // the rows dominated by the new row can never be the extremum of a later frame
+        while (!rows.empty()) {
+            int cmp = column->compare_at(rows.back(), next_row, *column, 1);
+            if (is_max ? cmp > 0 : cmp < 0) {
+                break;
+            }
+            rows.pop_back();
+        }
+        rows.push_back(next_row);
+    }
+
+    auto* place = _fn_place_ptr + _offsets_of_aggregate_states[idx];
+    _agg_functions[idx]->reset(place);
+    _use_null_result[idx] = 0;
+    _could_use_previous_result[idx] = 0;
+    // an empty range gives the null result of the function
+    const int64_t best_row = rows.empty() ? partition_start : rows.front();
+    const int64_t best_row_end = rows.empty() ? partition_start : best_row + 1;
+    const vectorized::IColumn* agg_column = _agg_input_columns[idx][0].get();
+    _agg_functions[idx]->function()->add_range_single_place(
+            partition_start, partition_end, best_row, best_row_end, place, &agg_column,
+            _agg_arena_pool, &_use_null_result[idx], &_could_use_previous_result[idx]);
+}
+
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
@@ -874,6 +1067,16 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     _current_row_position -= remove_rows;
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
+    for (size_t i = 0; i < _agg_functions_size; i++) {
+        if (!_use_sliding_extremum[i]) {
+            continue;
+        }
+        for (auto& row : _sliding_extremum_rows[i]) {
+            row -= remove_rows;
+        }
+        _sliding_extremum_next_rows[i] -= remove_rows;
+        _sliding_extremum_partition_starts[i] -= remove_rows;
+    }
     int64_t candidate_partition_end_size = _next_partition_ends.size();
     while (--candidate_partition_end_size >= 0) {
         auto peek = _next_partition_ends.front();
@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <deque>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
 
@@ -91,6 +93,12 @@ private:
     template <bool incremental = false>
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    // min/max of function `idx` over [frame_start, frame_end) by the monotonic queue of the frame
+    void _execute_sliding_extremum(size_t idx, int64_t partition_start, int64_t partition_end,
+                                   int64_t frame_start, int64_t frame_end);
+    // results of rows [start, end) of rows between unbounded preceding and current row in one pass,
+    // the rows are the local range and the state of the previous rows is carried into it
+    void _execute_running_frame_batch(int64_t start, int64_t end, int64_t pos);
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
@@ -147,6 +155,20 @@ private:
 
     std::vector<uint8_t> _use_null_result;
     std::vector<uint8_t> _could_use_previous_result;
+
+    // For min/max over rows between M preceding and N following, the frame rows that may still be
+    // the extremum of a later frame, the values are monotonic from front to back.
+    std::vector<bool> _use_sliding_extremum;
+    std::vector<bool> _sliding_extremum_is_max;
+    std::vector<std::deque<int64_t>> _sliding_extremum_rows;
+    // the next row to push into the queue and the partition the queue belongs to
+    std::vector<int64_t> _sliding_extremum_next_rows;
+    std::vector<int64_t> _sliding_extremum_partition_starts;
+
+    // row_number and sum of numbers over rows between unbounded preceding and current row are
+    // computed for a whole range of rows at a time, instead of one row at a time
+    bool _use_running_frame_batch = false;
+    std::vector<PrimitiveType> _running_frame_input_types;
     bool _streaming_mode = false;
     bool _support_incremental_calculate = true;
     bool _need_more_data = false;
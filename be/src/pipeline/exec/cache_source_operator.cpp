@@ -23,6 +23,8 @@
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/query_context.h"
+#include "util/uid_util.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -68,28 +70,48 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     custom_profile()->add_info_string("HitCache", std::to_string(hit_cache));
     if (hit_cache && !cache_param.force_refresh_query_cache) {
         _hit_cache_results = _query_cache_handle.get_cache_result();
-        auto hit_cache_slot_orders = _query_cache_handle.get_cache_slot_orders();
-
-        if (_slot_orders != *hit_cache_slot_orders) {
-            for (auto slot_id : _slot_orders) {
-                auto find_res = std::find(hit_cache_slot_orders->begin(),
-                                          hit_cache_slot_orders->end(), slot_id);
-                if (find_res != hit_cache_slot_orders->end()) {
-                    _hit_cache_column_orders.emplace_back(find_res -
-                                                          hit_cache_slot_orders->begin());
-                } else {
-                    return Status::InternalError(fmt::format(
-                            "Cache can find the mapping slot id {}, node id {}, "
-                            "hit_cache_column_orders [{}]",
-                            slot_id, cache_param.node_id, fmt::join(*hit_cache_slot_orders, ",")));
-                }
-            }
-        }
+        RETURN_IF_ERROR(_build_column_orders(*_query_cache_handle.get_cache_slot_orders(),
+                                             &_hit_cache_column_orders));
     }
 
     return Status::OK();
 }
 
+Status CacheSourceLocalState::_build_column_orders(const std::vector<int>& cache_slot_orders,
+                                                   std::vector<int>* column_orders) const {
+    if (_slot_orders == cache_slot_orders) {
+        return Status::OK();
+    }
+    for (auto slot_id : _slot_orders) {
+        auto find_res = std::find(cache_slot_orders.begin(), cache_slot_orders.end(), slot_id);
+        if (find_res != cache_slot_orders.end()) {
+            column_orders->emplace_back(find_res - cache_slot_orders.begin());
+        } else {
+            return Status::InternalError(fmt::format(
+                    "Cache can find the mapping slot id {}, node id {}, "
+                    "hit_cache_column_orders [{}]",
+                    slot_id, _parent->cast<CacheSourceOperatorX>()._cache_param.node_id,
+                    fmt::join(cache_slot_orders, ",")));
+        }
+    }
+    return Status::OK();
+}
+
+void CacheSourceLocalState::_append_cache_block(vectorized::BlockUPtr cache_block) {
+    const auto& cache_param = _parent->cast<CacheSourceOperatorX>()._cache_param;
+    _current_query_cache_rows += cache_block->rows();
+    _current_query_cache_bytes += cache_block->allocated_bytes();
+
+    if (cache_param.entry_max_bytes < _current_query_cache_bytes ||
+        cache_param.entry_max_rows < _current_query_cache_rows) {
+        // over the max bytes, pass through the data, no need to do cache
+        _local_cache_blocks.clear();
+        _need_insert_cache = false;
+    } else {
+        _local_cache_blocks.emplace_back(std::move(cache_block));
+    }
+}
+
 Status CacheSourceLocalState::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
@@ -109,6 +131,23 @@ std::string CacheSourceLocalState::debug_string(int indentation_level) const {
     return fmt::to_string(debug_string_buffer);
 }
 
+static Status fill_block_from_cache(const vectorized::Block& cache_block,
+                                    const std::vector<int>& column_orders, bool need_clone_empty,
+                                    vectorized::Block* block) {
+    if (need_clone_empty) {
+        *block = cache_block.clone_empty();
+    }
+    RETURN_IF_ERROR(vectorized::MutableBlock::build_mutable_block(block).merge(cache_block));
+    if (!column_orders.empty()) {
+        auto datas = block->get_columns_with_type_and_name();
+        block->clear();
+        for (auto loc : column_orders) {
+            block->insert(datas[loc]);
+        }
+    }
+    return Status::OK();
+}
+
 Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* block, bool* eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
@@ -117,6 +156,40 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
     bool need_clone_empty = block->columns() == 0;
 
     if (local_state._hit_cache_results == nullptr) {
+        auto& data_queue = local_state._shared_state->data_queue;
+        // The olap scan has finished preparing once the child produced anything.
+        if (config::enable_incremental_query_cache && !local_state._delta_base_taken &&
+            (_has_data(state) || data_queue.is_all_finish())) {
+            local_state._delta_base_taken = true;
+            local_state._delta_base = state->get_query_ctx()->take_query_cache_delta_base(
+                    local_state._cache_key + print_id(state->fragment_instance_id()));
+            if (local_state._delta_base != nullptr) {
+                local_state.custom_profile()->add_info_string(
+                        "DeltaBaseVersion",
+                        std::to_string(local_state._delta_base->get_cache_version()));
+                RETURN_IF_ERROR(local_state._build_column_orders(
+                        *local_state._delta_base->get_cache_slot_orders(),
+                        &local_state._delta_base_column_orders));
+            }
+        }
+        if (local_state._delta_base != nullptr &&
+            local_state._delta_base_pos < local_state._delta_base->get_cache_result()->size()) {
+            const auto& cache_block =
+                    local_state._delta_base->get_cache_result()->at(local_state._delta_base_pos++);
+            RETURN_IF_ERROR(fill_block_from_cache(*cache_block,
+                                                  local_state._delta_base_column_orders,
+                                                  need_clone_empty, block));
+            if (local_state._need_insert_cache) {
+                auto new_cache_block = vectorized::Block::create_unique(block->clone_empty());
+                RETURN_IF_ERROR(
+                        vectorized::MutableBlock::build_mutable_block(new_cache_block.get())
+                                .merge(*block));
+                local_state._append_cache_block(std::move(new_cache_block));
+            }
+            local_state.reached_limit(block, eos);
+            return Status::OK();
+        }
+
         Defer insert_cache([&] {
             if (*eos) {
                 local_state.custom_profile()->add_info_string(
@@ -149,18 +222,7 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
             }
             RETURN_IF_ERROR(
                     vectorized::MutableBlock::build_mutable_block(block).merge(*output_block));
-            local_state._current_query_cache_rows += output_block->rows();
-            auto mem_consume = output_block->allocated_bytes();
-            local_state._current_query_cache_bytes += mem_consume;
-
-            if (_cache_param.entry_max_bytes < local_state._current_query_cache_bytes ||
-                _cache_param.entry_max_rows < local_state._current_query_cache_rows) {
-                // over the max bytes, pass through the data, no need to do cache
-                local_state._local_cache_blocks.clear();
-                local_state._need_insert_cache = false;
-            } else {
-                local_state._local_cache_blocks.emplace_back(std::move(output_block));
-            }
+            local_state._append_cache_block(std::move(output_block));
         } else {
             *block = std::move(*output_block);
         }
@@ -168,18 +230,9 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
         if (local_state._hit_cache_pos < local_state._hit_cache_results->size()) {
             const auto& hit_cache_block =
                     local_state._hit_cache_results->at(local_state._hit_cache_pos++);
-            if (need_clone_empty) {
-                *block = hit_cache_block->clone_empty();
-            }
-            RETURN_IF_ERROR(
-                    vectorized::MutableBlock::build_mutable_block(block).merge(*hit_cache_block));
-            if (!local_state._hit_cache_column_orders.empty()) {
-                auto datas = block->get_columns_with_type_and_name();
-                block->clear();
-                for (auto loc : local_state._hit_cache_column_orders) {
-                    block->insert(datas[loc]);
-                }
-            }
+            RETURN_IF_ERROR(fill_block_from_cache(*hit_cache_block,
+                                                  local_state._hit_cache_column_orders,
+                                                  need_clone_empty, block));
         } else {
             *eos = true;
         }
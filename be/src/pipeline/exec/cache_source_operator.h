@@ -66,6 +66,17 @@ private:
     std::vector<vectorized::BlockUPtr>* _hit_cache_results = nullptr;
     std::vector<int> _hit_cache_column_orders;
     int _hit_cache_pos = 0;
+
+    // The cache entry of an older version handed over by the olap scan, which only reads the
+    // rowsets after it. Its blocks are emitted before the blocks of the child.
+    std::shared_ptr<QueryCacheHandle> _delta_base;
+    std::vector<int> _delta_base_column_orders;
+    size_t _delta_base_pos = 0;
+    bool _delta_base_taken = false;
+
+    Status _build_column_orders(const std::vector<int>& cache_slot_orders,
+                                std::vector<int>* column_orders) const;
+    void _append_cache_block(vectorized::BlockUPtr cache_block);
 };
 
 class CacheSourceOperatorX final : public OperatorX<CacheSourceLocalState> {
@@ -28,6 +28,7 @@
 #include <pdqsort.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <exception>
@@ -43,6 +44,7 @@
 #include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/defer_op.h"
+#include "util/hot_path_metrics.h"
 #include "util/proto_util.h"
 #include "util/time.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -105,9 +107,73 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
                              state->query_options().exchange_multi_blocks_byte_size > 0) {
     if (_send_multi_blocks) {
         _send_multi_blocks_byte_size = state->query_options().exchange_multi_blocks_byte_size;
+    } else if (config::exchange_sink_coalesce_bytes > 0) {
+        // Only the blocks already queued are coalesced, no block waits for more blocks.
+        _send_multi_blocks = true;
+        _send_multi_blocks_byte_size = cast_set<int>(config::exchange_sink_coalesce_bytes);
     }
 }
 
+segment_v2::CompressionTypePB AdaptiveTransmitCodec::choose(
+        segment_v2::CompressionTypePB default_type) {
+    std::lock_guard<std::mutex> l(_lock);
+    ++_num_choices;
+    if (_lz4.uncompressed_bytes == 0) {
+        return segment_v2::CompressionTypePB::LZ4;
+    }
+    if (_zstd.uncompressed_bytes == 0) {
+        return segment_v2::CompressionTypePB::ZSTD;
+    }
+    if (_num_choices % PROBE_INTERVAL == 0) {
+        return (_num_choices / PROBE_INTERVAL) % 2 ? segment_v2::CompressionTypePB::LZ4
+                                                   : segment_v2::CompressionTypePB::ZSTD;
+    }
+    if (_rpc_bytes == 0) {
+        return default_type;
+    }
+    const double ns_per_wire_byte = _rpc_ns / _rpc_bytes;
+    auto cost = [&](const CodecStats& stats) {
+        return (stats.compress_ns + stats.compressed_bytes * ns_per_wire_byte) /
+               stats.uncompressed_bytes;
+    };
+    auto lz4_cost = cost(_lz4);
+    auto zstd_cost = cost(_zstd);
+    if (ns_per_wire_byte <= std::min(lz4_cost, zstd_cost)) {
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    return lz4_cost <= zstd_cost ? segment_v2::CompressionTypePB::LZ4
+                                 : segment_v2::CompressionTypePB::ZSTD;
+}
+
+void AdaptiveTransmitCodec::update_compression(segment_v2::CompressionTypePB type,
+                                               size_t uncompressed_bytes, size_t compressed_bytes,
+                                               int64_t compress_ns) {
+    if (uncompressed_bytes == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_lock);
+    CodecStats* stats = nullptr;
+    if (type == segment_v2::CompressionTypePB::LZ4) {
+        stats = &_lz4;
+    } else if (type == segment_v2::CompressionTypePB::ZSTD) {
+        stats = &_zstd;
+    } else {
+        return;
+    }
+    stats->uncompressed_bytes = stats->uncompressed_bytes * DECAY + double(uncompressed_bytes);
+    stats->compressed_bytes = stats->compressed_bytes * DECAY + double(compressed_bytes);
+    stats->compress_ns = stats->compress_ns * DECAY + double(compress_ns);
+}
+
+void AdaptiveTransmitCodec::update_rpc(size_t bytes, int64_t rpc_ns) {
+    if (bytes == 0 || rpc_ns <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_lock);
+    _rpc_bytes = _rpc_bytes * DECAY + double(bytes);
+    _rpc_ns = _rpc_ns * DECAY + double(rpc_ns);
+}
+
 void ExchangeSinkBuffer::close() {
     // Could not clear the queue here, because there maybe a running rpc want to
     // get a request from the queue, and clear method will release the request
@@ -151,10 +217,29 @@ void ExchangeSinkBuffer::construct_request(TUniqueId fragment_instance_id) {
     instance_data->request->mutable_query_id()->CopyFrom(_query_id);
     instance_data->request->set_node_id(_dest_node_id);
     instance_data->running_sink_count = _exchange_sink_num;
+    if (config::enable_exchange_adaptive_compression) {
+        instance_data->codec = std::make_unique<AdaptiveTransmitCodec>();
+    }
 
     _rpc_instances[low_id] = std::move(instance_data);
 }
 
+void ExchangeSinkBuffer::set_broadcast_fanout(const std::vector<TUniqueId>& fragment_instance_ids) {
+    if (_is_failed || fragment_instance_ids.size() < 2) {
+        return;
+    }
+    auto& leader = *_rpc_instances[fragment_instance_ids[0].lo];
+    for (size_t i = 1; i < fragment_instance_ids.size(); ++i) {
+        auto& follower = *_rpc_instances[fragment_instance_ids[i].lo];
+        DCHECK(follower.broadcast_leader == nullptr && follower.broadcast_followers.empty());
+        follower.broadcast_leader = &leader;
+        leader.broadcast_followers.push_back(&follower);
+        auto* finst_id = leader.request->add_broadcast_finst_ids();
+        finst_id->set_hi(fragment_instance_ids[i].hi);
+        finst_id->set_lo(fragment_instance_ids[i].lo);
+    }
+}
+
 Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&& request) {
     if (_is_failed) {
         return Status::OK();
@@ -168,6 +253,10 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&
     if (instance_data.rpc_channel_is_turn_off) {
         return Status::EndOfFile("receiver eof");
     }
+    if (instance_data.broadcast_leader) {
+        // Sent by the leader.
+        return Status::OK();
+    }
     bool send_now = false;
     {
         std::unique_lock<std::mutex> lock(*instance_data.mutex);
@@ -210,6 +299,10 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel,
     if (instance_data.rpc_channel_is_turn_off) {
         return Status::EndOfFile("receiver eof");
     }
+    if (instance_data.broadcast_leader) {
+        // Sent by the leader.
+        return Status::OK();
+    }
     bool send_now = false;
     {
         std::unique_lock<std::mutex> lock(*instance_data.mutex);
@@ -307,6 +400,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
         }
 
         instance_data.seq += requests.size();
+        instance_data.rpc_bytes = mem_byte;
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -345,12 +439,18 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
                 _set_receiver_eof(ins);
+                for (auto* follower : ins.broadcast_followers) {
+                    _set_receiver_eof(*follower);
+                }
             } else if (!s.ok()) {
                 _failed(ins.id,
                         fmt::format("exchange req success but status isn't ok: {}", s.to_string()));
                 return;
             } else if (eos) {
                 _ended(ins);
+                for (auto* follower : ins.broadcast_followers) {
+                    _ended(*follower);
+                }
             }
             // The eos here only indicates that the current exchange sink has reached eos.
             // However, the queue still contains data from other exchange sinks, so RPCs need to continue being sent.
@@ -436,6 +536,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
         }
         instance_data.seq += requests.size();
+        instance_data.rpc_bytes = mem_byte;
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -474,12 +575,18 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
                 _set_receiver_eof(ins);
+                for (auto* follower : ins.broadcast_followers) {
+                    _set_receiver_eof(*follower);
+                }
             } else if (!s.ok()) {
                 _failed(ins.id,
                         fmt::format("exchange req success but status isn't ok: {}", s.to_string()));
                 return;
             } else if (eos) {
                 _ended(ins);
+                for (auto* follower : ins.broadcast_followers) {
+                    _ended(*follower);
+                }
             }
 
             // The eos here only indicates that the current exchange sink has reached eos.
@@ -619,11 +726,17 @@ void ExchangeSinkBuffer::update_rpc_time(RpcInstance& ins, int64_t start_rpc_tim
     _rpc_count++;
     int64_t rpc_spend_time = receive_rpc_time - start_rpc_time;
     if (rpc_spend_time > 0) {
+        if (ins.codec) {
+            ins.codec->update_rpc(ins.rpc_bytes, rpc_spend_time);
+        }
         auto& stats = ins.stats;
         ++stats.rpc_count;
         stats.sum_time += rpc_spend_time;
         stats.max_time = std::max(stats.max_time, rpc_spend_time);
         stats.min_time = std::min(stats.min_time, rpc_spend_time);
+        if (hot_path_metrics::enabled()) {
+            hot_path_metrics::record_latency(HotPath::EXCHANGE_RPC, rpc_spend_time);
+        }
     }
 }
 
@@ -20,6 +20,7 @@
 #include <brpc/controller.h>
 #include <gen_cpp/data.pb.h>
 #include <gen_cpp/internal_service.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
 #include <gen_cpp/types.pb.h>
 #include <parallel_hashmap/phmap.h>
 
@@ -127,6 +128,37 @@ struct RpcInstanceStatistics {
     int64_t sum_time = 0;
 };
 
+// Chooses the compression codec of the blocks sent to one destination. The cost of a codec per
+// uncompressed byte is its compression time plus the time to send the compressed bytes, which is
+// estimated by the observed RPC time per byte. Sending the bytes uncompressed is a candidate too,
+// so compression is skipped on fast links where it is pure CPU overhead.
+class AdaptiveTransmitCodec {
+public:
+    // Every `PROBE_INTERVAL` choices one of the codecs is probed to refresh its statistics.
+    static constexpr int64_t PROBE_INTERVAL = 64;
+
+    segment_v2::CompressionTypePB choose(segment_v2::CompressionTypePB default_type);
+    void update_compression(segment_v2::CompressionTypePB type, size_t uncompressed_bytes,
+                            size_t compressed_bytes, int64_t compress_ns);
+    void update_rpc(size_t bytes, int64_t rpc_ns);
+
+private:
+    // Recent statistics are weighted higher, the old ones decay by `DECAY` on every update.
+    static constexpr double DECAY = 0.875;
+    struct CodecStats {
+        double uncompressed_bytes = 0;
+        double compressed_bytes = 0;
+        double compress_ns = 0;
+    };
+
+    std::mutex _lock;
+    CodecStats _lz4;
+    CodecStats _zstd;
+    double _rpc_bytes = 0;
+    double _rpc_ns = 0;
+    int64_t _num_choices = 0;
+};
+
 // Consolidated structure for RPC instance data
 struct RpcInstance {
     // Constructor initializes the instance with the given ID
@@ -164,6 +196,18 @@ struct RpcInstance {
 
     // Count of active exchange sinks using this RPC instance
     int64_t running_sink_count = 0;
+
+    // Bytes of the in-flight RPC, at most one RPC is in flight.
+    int64_t rpc_bytes = 0;
+
+    // Set if `enable_exchange_adaptive_compression` is true.
+    std::unique_ptr<AdaptiveTransmitCodec> codec;
+
+    // Per-BE broadcast: one instance of each destination BE is the leader, its requests are
+    // fanned out to the other instances (followers) by the receiving BE. A follower never sends
+    // rpc, it is ended with its leader.
+    RpcInstance* broadcast_leader = nullptr;
+    std::vector<RpcInstance*> broadcast_followers;
 };
 
 template <typename Response>
@@ -276,6 +320,10 @@ public:
 
     void construct_request(TUniqueId);
 
+    // Send the requests of `fragment_instance_ids`, which are on the same BE, once to the first
+    // of them. Must be called after all the requests are constructed.
+    void set_broadcast_fanout(const std::vector<TUniqueId>& fragment_instance_ids);
+
     Status add_block(vectorized::Channel* channel, TransmitInfo&& request);
     Status add_block(vectorized::Channel* channel, BroadcastTransmitInfo&& request);
     void close();
@@ -291,6 +339,12 @@ public:
 
     void set_low_memory_mode() { _queue_capacity = 8; }
     std::string debug_each_instance_queue_size();
+
+    // The codec chooser of the destination instance, nullptr if the adaptive compression is off.
+    AdaptiveTransmitCodec* adaptive_codec(InstanceLoId ins_id) {
+        auto it = _rpc_instances.find(ins_id);
+        return it == _rpc_instances.end() ? nullptr : it->second->codec.get();
+    }
 #ifdef BE_TEST
 public:
 #else
@@ -22,11 +22,16 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exchange_sink_buffer.h"
 #include "pipeline/dependency.h"
@@ -192,6 +197,18 @@ void ExchangeSinkLocalState::_create_channels() {
     }
 }
 
+bool ExchangeSinkLocalState::is_finished() const {
+    if (_reach_limit.load()) {
+        return true;
+    }
+    // Local receivers that reached their limit are closed early, there is no need to wait for
+    // the next block to find out that nobody reads the data any more.
+    return config::enable_exchange_limit_early_close && _only_local_exchange && !channels.empty() &&
+           std::all_of(channels.begin(), channels.end(), [](const auto& channel) {
+               return channel->is_local_receiver_closed();
+           });
+}
+
 void ExchangeSinkLocalState::on_channel_finished(InstanceLoId channel_id) {
     std::lock_guard<std::mutex> lock(_finished_channels_mutex);
 
@@ -579,6 +596,23 @@ std::shared_ptr<ExchangeSinkBuffer> ExchangeSinkOperatorX::_create_buffer(
     for (const auto& _dest : _dests) {
         sink_buffer->construct_request(_dest.fragment_instance_id);
     }
+    if (_part_type == TPartitionType::UNPARTITIONED &&
+        config::enable_broadcast_exchange_fanout_per_be) {
+        // Group the remote destinations by BE, each BE receives one copy of the broadcast.
+        std::map<std::pair<std::string, int>, std::vector<TUniqueId>> be_to_instances;
+        for (const auto& dest : _dests) {
+            const auto& addr = dest.brpc_server;
+            bool is_local = addr.hostname == BackendOptions::get_localhost() &&
+                            addr.port == config::brpc_port && state->enable_local_exchange();
+            if (is_local || dest.fragment_instance_id.hi == -1) {
+                continue;
+            }
+            be_to_instances[{addr.hostname, addr.port}].push_back(dest.fragment_instance_id);
+        }
+        for (const auto& [_, instances] : be_to_instances) {
+            sink_buffer->set_broadcast_fanout(instances);
+        }
+    }
     return sink_buffer;
 }
 
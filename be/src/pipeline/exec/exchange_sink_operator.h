@@ -82,7 +82,7 @@ public:
     RuntimeProfile::Counter* local_sent_rows() { return _local_sent_rows; }
     RuntimeProfile::Counter* merge_block_timer() { return _merge_block_timer; }
     [[nodiscard]] bool transfer_large_data_by_brpc() const;
-    bool is_finished() const override { return _reach_limit.load(); }
+    bool is_finished() const override;
     void set_reach_limit() { _reach_limit = true; };
 
     // sender_id indicates which instance within a fragment, while be_number indicates which instance
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
@@ -200,6 +201,11 @@ Status ExchangeSourceOperatorX::get_block(RuntimeState* state, vectorized::Block
             auto limit = _limit - local_state.num_rows_returned();
             block->set_num_rows(limit);
             local_state.set_num_rows_returned(_limit);
+            if (config::enable_exchange_limit_early_close && _limit >= 0) {
+                // No more rows are needed, deregister the receiver now so that the senders get
+                // eof instead of producing data until this task closes.
+                local_state.stream_recvr->close();
+            }
         }
     }
     return Status::OK();
@@ -365,40 +365,43 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
         return Status::OK();
     }
 
-    LOG(INFO) << "build block rows: " << block.rows() << ", columns count: " << block.columns()
-              << ", bytes/allocated_bytes: " << PrettyPrinter::print_bytes(block.bytes()) << "/"
-              << PrettyPrinter::print_bytes(block.allocated_bytes());
-    // 1. Dispose the overflow of ColumnString
-    // 2. Finalize the ColumnVariant to speed up
-    for (auto& data : block) {
-        data.column = std::move(*data.column).mutate()->convert_column_if_overflow();
-        if (p._need_finalize_variant_column) {
-            std::move(*data.column).mutate()->finalize();
+    // The key columns are already extracted if the build is resumed after a yield.
+    if (_build_next_row == 0) {
+        LOG(INFO) << "build block rows: " << block.rows() << ", columns count: " << block.columns()
+                  << ", bytes/allocated_bytes: " << PrettyPrinter::print_bytes(block.bytes())
+                  << "/" << PrettyPrinter::print_bytes(block.allocated_bytes());
+        // 1. Dispose the overflow of ColumnString
+        // 2. Finalize the ColumnVariant to speed up
+        for (auto& data : block) {
+            data.column = std::move(*data.column).mutate()->convert_column_if_overflow();
+            if (p._need_finalize_variant_column) {
+                std::move(*data.column).mutate()->finalize();
+            }
         }
-    }
 
-    vectorized::ColumnRawPtrs raw_ptrs(_build_expr_ctxs.size());
-    vectorized::ColumnUInt8::MutablePtr null_map_val;
-    if (p._join_op == TJoinOp::LEFT_OUTER_JOIN || p._join_op == TJoinOp::FULL_OUTER_JOIN) {
-        _convert_block_to_null(block);
-        // first row is mocked
-        for (int i = 0; i < block.columns(); i++) {
-            auto [column, is_const] = unpack_if_const(block.safe_get_by_position(i).column);
-            assert_cast<vectorized::ColumnNullable*>(column->assume_mutable().get())
-                    ->get_null_map_column()
-                    .get_data()
-                    .data()[0] = 1;
+        _build_raw_ptrs.resize(_build_expr_ctxs.size());
+        if (p._join_op == TJoinOp::LEFT_OUTER_JOIN || p._join_op == TJoinOp::FULL_OUTER_JOIN) {
+            _convert_block_to_null(block);
+            // first row is mocked
+            for (int i = 0; i < block.columns(); i++) {
+                auto [column, is_const] = unpack_if_const(block.safe_get_by_position(i).column);
+                assert_cast<vectorized::ColumnNullable*>(column->assume_mutable().get())
+                        ->get_null_map_column()
+                        .get_data()
+                        .data()[0] = 1;
+            }
         }
-    }
 
-    _set_build_side_has_external_nullmap(block, _build_col_ids);
-    if (_build_side_has_external_nullmap) {
-        null_map_val = vectorized::ColumnUInt8::create();
-        null_map_val->get_data().assign((size_t)rows, (uint8_t)0);
-    }
+        _set_build_side_has_external_nullmap(block, _build_col_ids);
+        if (_build_side_has_external_nullmap) {
+            _build_null_map = vectorized::ColumnUInt8::create();
+            _build_null_map->get_data().assign((size_t)rows, (uint8_t)0);
+        }
 
-    // Get the key column that needs to be built
-    RETURN_IF_ERROR(_extract_join_column(block, null_map_val, raw_ptrs, _build_col_ids));
+        // Get the key column that needs to be built
+        RETURN_IF_ERROR(_extract_join_column(block, _build_null_map, _build_raw_ptrs,
+                                             _build_col_ids));
+    }
 
     Status st = std::visit(
             vectorized::Overload {
@@ -412,11 +415,11 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
                         using HashTableCtxType = std::decay_t<decltype(arg)>;
                         using JoinOpType = std::decay_t<decltype(join_op)>;
                         ProcessHashTableBuild<HashTableCtxType> hash_table_build_process(
-                                rows, raw_ptrs, this, state->batch_size(), state);
+                                rows, _build_raw_ptrs, this, state->batch_size(), state);
                         auto st = hash_table_build_process.template run<
                                 JoinOpType::value, short_circuit_for_null_in_build_side,
                                 with_other_conjuncts>(
-                                arg, null_map_val ? &null_map_val->get_data() : nullptr,
+                                arg, _build_null_map ? &_build_null_map->get_data() : nullptr,
                                 &_shared_state->_has_null_in_build_side);
                         COUNTER_SET(_memory_used_counter,
                                     _build_blocks_memory_usage->value() +
@@ -431,6 +434,21 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
     return st;
 }
 
+bool HashJoinBuildSinkLocalState::_should_build_in_parallel(uint32_t rows) const {
+    const auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    return p._use_shared_hash_table && _shared_state->sink_deps.size() > 1 &&
+           config::hash_join_parallel_build_min_rows >= 0 &&
+           rows >= config::hash_join_parallel_build_min_rows;
+}
+
+void HashJoinBuildSinkLocalState::_wake_up_build_helpers() {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    std::unique_lock lock(p._mutex);
+    for (auto& dep : _shared_state->sink_deps) {
+        dep->set_ready();
+    }
+}
+
 void HashJoinBuildSinkLocalState::_set_build_side_has_external_nullmap(
         vectorized::Block& block, const std::vector<int>& res_col_ids) {
     DCHECK(_should_build_hash_table);
@@ -569,7 +587,10 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     SCOPED_TIMER(local_state.exec_time_counter());
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
 
-    if (local_state._should_build_hash_table) {
+    // The hash table build yielded in the last run, `in_block` is already merged into the build
+    // block, just continue to build.
+    const bool resume_build = local_state._build_next_row > 0;
+    if (local_state._should_build_hash_table && !resume_build) {
         // If eos or have already met a null value using short-circuit strategy, we do not need to pull
         // data from probe side.
 
@@ -608,22 +629,40 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     }
 
     if (local_state._should_build_hash_table && eos) {
-        DCHECK(!local_state._build_side_mutable_block.empty());
-        local_state._shared_state->build_block = std::make_shared<vectorized::Block>(
-                local_state._build_side_mutable_block.to_block());
-
-        RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
-                state, local_state._shared_state->build_block->rows(),
-                local_state._finish_dependency));
+        if (!resume_build) {
+            DCHECK(!local_state._build_side_mutable_block.empty());
+            local_state._shared_state->build_block = std::make_shared<vectorized::Block>(
+                    local_state._build_side_mutable_block.to_block());
+
+            RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
+                    state, local_state._shared_state->build_block->rows(),
+                    local_state._finish_dependency));
+        }
 
         RETURN_IF_ERROR(
                 local_state.process_build_block(state, (*local_state._shared_state->build_block)));
+        if (local_state._build_next_row > 0) {
+            // yielded in the middle of the build, the probe side must wait until it finishes
+            return Status::OK();
+        }
         local_state.init_short_circuit_for_probe();
     } else if (!local_state._should_build_hash_table) {
         // the instance which is not build hash table, it's should wait the signal of hash table build finished.
         // but if it's running and signaled == false, maybe the source operator have closed caused by some short circuit
         // return eof will make task marked as wake_up_early
         // todo: remove signaled after we can guarantee that wake up eraly is always set accurately
+        auto& parallel_build = local_state._shared_state->parallel_build;
+        if (!_signaled && !local_state._terminated && parallel_build.started()) {
+            // Woken up to help the parallel build, then wait for the hash table to be finished
+            // and run the sink again.
+            parallel_build.run();
+            std::lock_guard<std::mutex> guard(_mutex);
+            if (!_signaled) {
+                local_state._dependency->block();
+                state->set_sink_yielded();
+                return Status::OK();
+            }
+        }
         if (!_signaled || local_state._terminated) {
             return Status::Error<ErrorCode::END_OF_FILE>("source have closed");
         }
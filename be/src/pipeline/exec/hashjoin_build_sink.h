@@ -60,6 +60,10 @@ protected:
                                 vectorized::ColumnUInt8::MutablePtr& null_map,
                                 vectorized::ColumnRawPtrs& raw_ptrs,
                                 const std::vector<int>& res_col_ids);
+    // A large shared hash table is chained by all the instances of the broadcast join, the
+    // instances not building it are woken up to help, see `ParallelJoinBuild`.
+    bool _should_build_in_parallel(uint32_t rows) const;
+    void _wake_up_build_helpers();
     friend class HashJoinBuildSinkOperatorX;
     friend class PartitionedHashJoinSinkLocalState;
     template <class HashTableContext>
@@ -78,6 +82,13 @@ protected:
     vectorized::MutableBlock _build_side_mutable_block;
     std::shared_ptr<RuntimeFilterProducerHelper> _runtime_filter_producer_helper;
 
+    // The hash table is built in ranges of rows and the build may yield between the ranges when
+    // the time slice of the task is used up. `_build_next_row` is the first row not inserted yet,
+    // 0 means the build is not started (the first row is mocked and never inserted).
+    uint32_t _build_next_row = 0;
+    vectorized::ColumnRawPtrs _build_raw_ptrs;
+    vectorized::ColumnUInt8::MutablePtr _build_null_map;
+
     /*
      * The comparison result of a null value with any other value is null,
      * which means that for most join(exclude: null aware join, null equal safe join),
@@ -190,31 +201,85 @@ struct ProcessHashTableBuild {
     template <int JoinOpType, bool short_circuit_for_null, bool with_other_conjuncts>
     Status run(HashTableContext& hash_table_ctx, vectorized::ConstNullMapPtr null_map,
                bool* has_null_key) {
-        if (null_map) {
-            // first row is mocked and is null
-            // TODO: Need to test the for loop. break may better
-            for (uint32_t i = 1; i < _rows; i++) {
-                if ((*null_map)[i]) {
-                    *has_null_key = true;
+        SCOPED_TIMER(_parent->_build_table_insert_timer);
+        if (_parent->_build_next_row == 0) {
+            if (null_map) {
+                // first row is mocked and is null
+                // TODO: Need to test the for loop. break may better
+                for (uint32_t i = 1; i < _rows; i++) {
+                    if ((*null_map)[i]) {
+                        *has_null_key = true;
+                    }
+                }
+                if (short_circuit_for_null && *has_null_key) {
+                    return Status::OK();
                 }
             }
-            if (short_circuit_for_null && *has_null_key) {
-                return Status::OK();
+
+            hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
+                                                                          *has_null_key);
+
+            // In order to make the null keys equal when using single null eq, all null keys need to be set to default value.
+            if (_build_raw_ptrs.size() == 1 && null_map) {
+                _build_raw_ptrs[0]->assume_mutable()->replace_column_null_data(null_map->data());
             }
-        }
 
-        SCOPED_TIMER(_parent->_build_table_insert_timer);
-        hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
-                                                                      *has_null_key);
+            hash_table_ctx.init_serialized_keys(_build_raw_ptrs, _rows,
+                                                null_map ? null_map->data() : nullptr, true, true,
+                                                hash_table_ctx.hash_table->get_bucket_size());
+            if constexpr (requires {
+                              hash_table_ctx.hash_table->direct_bucket_num(hash_table_ctx.keys[0]);
+                          }) {
+                if (config::enable_hash_join_direct_mapping &&
+                    hash_table_ctx.hash_table->try_direct_mapping(
+                            hash_table_ctx.keys, null_map ? null_map->data() : nullptr, _rows)) {
+                    hash_table_ctx.init_join_bucket_num(
+                            _rows, hash_table_ctx.hash_table->get_bucket_size(),
+                            null_map ? null_map->data() : nullptr);
+                }
+            }
+            _parent->_build_next_row = 1;
+        }
 
-        // In order to make the null keys equal when using single null eq, all null keys need to be set to default value.
-        if (_build_raw_ptrs.size() == 1 && null_map) {
-            _build_raw_ptrs[0]->assume_mutable()->replace_column_null_data(null_map->data());
+        if (_parent->_build_next_row == 1 && config::hash_join_partitioned_build_min_rows >= 0 &&
+            _rows >= config::hash_join_partitioned_build_min_rows) {
+            // One pass without yield, radix sorting the rows is cheaper than chaining them.
+            hash_table_ctx.hash_table->build_partitioned(
+                    hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows);
+            _parent->_build_next_row = _rows;
+        }
+        auto& parallel_build = _parent->_shared_state->parallel_build;
+        if (_parent->_build_next_row == 1 && _parent->_should_build_in_parallel(_rows)) {
+            auto* hash_table = hash_table_ctx.hash_table.get();
+            const auto* bucket_nums = hash_table_ctx.bucket_nums.data();
+            hash_table->set_build_keys(hash_table_ctx.keys);
+            parallel_build.start(1, _rows, BUILD_RANGE_ROWS,
+                                 [hash_table, bucket_nums](uint32_t begin, uint32_t end) {
+                                     hash_table->build_range_concurrent(bucket_nums, begin, end);
+                                 });
+            _parent->_wake_up_build_helpers();
+            _parent->_build_next_row = _rows;
         }
+        if (parallel_build.started() && !parallel_build.run()) {
+            // The other instances are still building their ranges, check again in the next run
+            // of the task.
+            _state->set_sink_yielded();
+            return Status::OK();
+        }
+        while (_parent->_build_next_row < _rows) {
+            if (_state->should_yield()) {
+                // Continue from `_build_next_row` in the next run of the task.
+                _state->set_sink_yielded();
+                return Status::OK();
+            }
+            uint32_t end = std::min(_rows, _parent->_build_next_row + BUILD_RANGE_ROWS);
+            hash_table_ctx.hash_table->build_range(hash_table_ctx.keys,
+                                                   hash_table_ctx.bucket_nums.data(),
+                                                   _parent->_build_next_row, end);
+            _parent->_build_next_row = end;
+        }
+        _parent->_build_next_row = 0;
 
-        hash_table_ctx.init_serialized_keys(_build_raw_ptrs, _rows,
-                                            null_map ? null_map->data() : nullptr, true, true,
-                                            hash_table_ctx.hash_table->get_bucket_size());
         // only 2 cases need to access the null value in hash table
         bool keep_null_key = false;
         if ((JoinOpType == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN ||
@@ -233,8 +298,12 @@ struct ProcessHashTableBuild {
             keep_null_key = true;
         }
 
-        hash_table_ctx.hash_table->build(hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(),
-                                         _rows, keep_null_key);
+        hash_table_ctx.hash_table->finish_build(keep_null_key);
+        if (config::hash_join_probe_bloom_filter_min_rows >= 0 &&
+            _rows >= config::hash_join_probe_bloom_filter_min_rows) {
+            RETURN_IF_ERROR(hash_table_ctx.hash_table->build_bloom_filter(
+                    hash_table_ctx.keys, _rows, config::hash_join_probe_bloom_filter_fpp));
+        }
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
 
@@ -246,6 +315,9 @@ struct ProcessHashTableBuild {
     }
 
 private:
+    // checking the time slice between ranges is cheap enough at this granularity
+    static constexpr uint32_t BUILD_RANGE_ROWS = 65536;
+
     const uint32_t _rows;
     vectorized::ColumnRawPtrs& _build_raw_ptrs;
     HashJoinBuildSinkLocalState* _parent = nullptr;
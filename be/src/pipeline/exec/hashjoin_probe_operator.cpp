@@ -22,6 +22,7 @@
 #include <string>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/descriptors.h"
@@ -285,12 +286,28 @@ Status HashJoinProbeOperatorX::pull(doris::RuntimeState* state, vectorized::Bloc
     local_state._estimate_memory_usage += temp_block.allocated_bytes();
     RETURN_IF_ERROR(
             local_state.filter_data_and_build_output(state, output_block, eos, &temp_block));
-    // Here make _join_block release the columns' ptr
-    local_state._join_block.set_columns(local_state._join_block.clone_empty_columns());
+    // Here make _join_block release the columns' ptr. After _build_output_block, temp_block
+    // holds the columns output_block had before, which the caller cleared for reuse.
+    local_state._reset_join_block(temp_block);
     mutable_join_block.clear();
     return Status::OK();
 }
 
+void HashJoinProbeLocalState::_reset_join_block(vectorized::Block& recycled_block) {
+    bool reusable = recycled_block.columns() == _join_block.columns();
+    for (size_t i = 0; reusable && i < _join_block.columns(); ++i) {
+        const auto& recycled = recycled_block.get_by_position(i);
+        reusable = recycled.column && recycled.column->empty() &&
+                   !is_column_const(*recycled.column) &&
+                   recycled.type->equals(*_join_block.get_by_position(i).type);
+    }
+    if (reusable) {
+        _join_block.set_columns(recycled_block.mutate_columns());
+    } else {
+        _join_block.set_columns(_join_block.clone_empty_columns());
+    }
+}
+
 std::string HashJoinProbeLocalState::debug_string(int indentation_level) const {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer, "{}, short_circuit_for_probe: {}",
@@ -365,7 +382,9 @@ Status HashJoinProbeLocalState::filter_data_and_build_output(RuntimeState* state
     if (check_rows_count) {
         DCHECK(output_rows <= state->batch_size());
     }
-    {
+    if (_conjuncts_evaluated_by_probe) {
+        _conjuncts_evaluated_by_probe = false;
+    } else {
         SCOPED_TIMER(_join_filter_timer);
         RETURN_IF_ERROR(filter_block(_conjuncts, temp_block, temp_block->columns()));
     }
@@ -534,6 +553,20 @@ Status HashJoinProbeOperatorX::prepare(RuntimeState* state) {
         conjunct->root()->collect_slot_column_ids(_should_not_lazy_materialized_column_ids);
     }
 
+    // Joins whose output rows are filtered by the conjuncts of this node can gather the other
+    // columns after the filter, like the other join conjuncts do. Semi and anti joins do not
+    // output the row pairs, so they are not worth it.
+    _lazy_materialize_for_conjuncts =
+            config::enable_hash_join_late_materialization && !_have_other_join_conjunct &&
+            !_is_mark_join && !_conjuncts.empty() &&
+            (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::LEFT_OUTER_JOIN ||
+             _join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN);
+    if (_lazy_materialize_for_conjuncts) {
+        for (auto& conjunct : _conjuncts) {
+            conjunct->root()->collect_slot_column_ids(_should_not_lazy_materialized_column_ids);
+        }
+    }
+
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_probe_expr_ctxs, state, _child->row_desc()));
     DCHECK(_build_side_child != nullptr);
     // right table data types
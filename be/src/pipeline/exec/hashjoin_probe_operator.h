@@ -74,6 +74,9 @@ private:
     bool _need_probe_null_map(vectorized::Block& block, const std::vector<int>& res_col_ids);
     std::vector<uint16_t> _convert_block_to_null(vectorized::Block& block);
     Status _extract_join_column(vectorized::Block& block, const std::vector<int>& res_col_ids);
+    // Give _join_block new empty columns for the next batch, taking them from recycled_block
+    // when it holds cleared columns of the same types so their capacity is reused.
+    void _reset_join_block(vectorized::Block& recycled_block);
     friend class HashJoinProbeOperatorX;
     template <int JoinOpType>
     friend struct ProcessHashTableProbe;
@@ -107,6 +110,8 @@ private:
             std::make_unique<HashTableCtxVariants>();
 
     int _task_idx;
+    // Set when the probe has already filtered the joined rows by `_conjuncts`.
+    bool _conjuncts_evaluated_by_probe = false;
 
     RuntimeProfile::Counter* _probe_expr_call_timer = nullptr;
     RuntimeProfile::Counter* _probe_side_output_timer = nullptr;
@@ -154,7 +159,13 @@ public:
 
     bool need_finalize_variant_column() const { return _need_finalize_variant_column; }
 
-    bool can_do_lazy_materialized() const { return _have_other_join_conjunct || _is_mark_join; }
+    bool can_do_lazy_materialized() const {
+        return _have_other_join_conjunct || _is_mark_join || _lazy_materialize_for_conjuncts;
+    }
+
+    // The conjuncts of this node are evaluated right after probing, only the columns they use are
+    // materialized before the filter.
+    bool lazy_materialize_for_conjuncts() const { return _lazy_materialize_for_conjuncts; }
 
     bool is_lazy_materialized_column(int column_id) const {
         return can_do_lazy_materialized() &&
@@ -189,6 +200,7 @@ private:
     std::vector<bool> _right_output_slot_flags;
     bool _need_finalize_variant_column = false;
     std::set<int> _should_not_lazy_materialized_column_ids;
+    bool _lazy_materialize_for_conjuncts = false;
     std::vector<std::string> _right_table_column_names;
     const std::vector<TExpr> _partition_exprs;
 
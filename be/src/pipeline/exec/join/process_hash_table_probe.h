@@ -66,6 +66,10 @@ struct ProcessHashTableProbe {
 
     Status do_mark_join_conjuncts(vectorized::Block* output_block, const uint8_t* null_map);
 
+    // Filter the joined rows by the conjuncts of the join node, the columns not used by the
+    // conjuncts are only gathered for the rows passing the filter.
+    Status do_lazy_materialized_conjuncts(vectorized::Block* output_block);
+
     Status finalize_block_with_filter(vectorized::Block* output_block, size_t filter_column_id,
                                       size_t column_to_keep);
 
@@ -20,6 +20,7 @@
 #include <gen_cpp/PlanNodes_types.h>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "process_hash_table_probe.h"
@@ -148,6 +149,11 @@ void ProcessHashTableProbe<JoinOpType>::probe_side_output_column(vectorized::Mut
     SCOPED_TIMER(_probe_side_output_timer);
     auto& probe_block = _parent->_probe_block;
     bool all_match_one = check_all_match_one(_probe_indexs.get_data());
+    // Every probe row is output once, e.g. a fact table joined to dimension tables by their keys,
+    // the probe columns are moved to the output instead of copied, so that a chain of such joins
+    // does not copy the probe columns at each join.
+    bool pass_through = config::enable_hash_join_probe_column_pass_through && all_match_one &&
+                        _probe_indexs.size() == probe_block.rows();
 
     for (int i = 0; i < _left_output_slot_flags.size(); ++i) {
         if (_left_output_slot_flags[i]) {
@@ -158,6 +164,15 @@ void ProcessHashTableProbe<JoinOpType>::probe_side_output_column(vectorized::Mut
 
         if (_left_output_slot_flags[i] && !_parent_operator->is_lazy_materialized_column(i)) {
             auto& column = probe_block.get_by_position(i).column;
+            if (pass_through && mcol[i]->empty() && column->is_exclusive() &&
+                probe_block.get_by_position(i).type->equals(
+                        *_parent->_join_block.get_by_position(i).type)) {
+                // The whole probe block has been probed, the moved column is not read again.
+                auto empty_column = column->clone_empty();
+                mcol[i] = vectorized::IColumn::mutate(std::move(column));
+                column = std::move(empty_column);
+                continue;
+            }
             insert_with_indexs(mcol[i], column, _probe_indexs.get_data(), all_match_one);
         } else {
             mock_column_size(mcol[i], _probe_indexs.size());
@@ -188,7 +203,8 @@ typename HashTableType::State ProcessHashTableProbe<JoinOpType>::_init_probe_sid
 
         hash_table_ctx.init_serialized_keys(_parent->_probe_columns, probe_rows, null_map, true,
                                             false, hash_table_ctx.hash_table->get_bucket_size());
-        hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.bucket_nums);
+        hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.bucket_nums,
+                                                  hash_table_ctx.keys);
         int64_t arena_memory_usage = hash_table_ctx.serialized_keys_size(false);
         COUNTER_SET(_parent->_probe_arena_memory_usage, arena_memory_usage);
         COUNTER_UPDATE(_parent->_memory_used_counter, arena_memory_usage);
@@ -303,6 +319,8 @@ Status ProcessHashTableProbe<JoinOpType>::process(HashTableType& hash_table_ctx,
         return do_mark_join_conjuncts(output_block, ignore_null_map ? nullptr : null_map);
     } else if (_have_other_join_conjunct) {
         return do_other_join_conjuncts(output_block, hash_table_ctx.hash_table->get_visited());
+    } else if (_parent_operator->lazy_materialize_for_conjuncts()) {
+        return do_lazy_materialized_conjuncts(output_block);
     }
 
     return Status::OK();
@@ -689,6 +707,32 @@ Status ProcessHashTableProbe<JoinOpType>::do_other_join_conjuncts(vectorized::Bl
     return Status::OK();
 }
 
+template <int JoinOpType>
+Status ProcessHashTableProbe<JoinOpType>::do_lazy_materialized_conjuncts(
+        vectorized::Block* output_block) {
+    _parent->_conjuncts_evaluated_by_probe = true;
+    auto row_count = output_block->rows();
+    if (!row_count) {
+        return Status::OK();
+    }
+
+    SCOPED_TIMER(_parent->_join_filter_timer);
+    size_t orig_columns = output_block->columns();
+    vectorized::IColumn::Filter filter(row_count, 1);
+    {
+        bool can_be_filter_all = false;
+        RETURN_IF_ERROR(vectorized::VExprContext::execute_conjuncts(
+                _parent->_conjuncts, nullptr, output_block, &filter, &can_be_filter_all));
+    }
+
+    auto filter_column = vectorized::ColumnUInt8::create();
+    filter_column->get_data() = std::move(filter);
+    auto result_column_id = output_block->columns();
+    output_block->insert(
+            {std::move(filter_column), std::make_shared<vectorized::DataTypeUInt8>(), ""});
+    return finalize_block_with_filter(output_block, result_column_id, orig_columns);
+}
+
 template <int JoinOpType>
 template <typename HashTableType>
 Status ProcessHashTableProbe<JoinOpType>::finish_probing(HashTableType& hash_table_ctx,
@@ -33,6 +33,7 @@
 #include "olap/tablet_manager.h"
 #include "pipeline/exec/scan_operator.h"
 #include "pipeline/query_cache/query_cache.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime_filter/runtime_filter_consumer_helper.h"
 #include "service/backend_options.h"
@@ -150,6 +151,8 @@ Status OlapScanLocalState::_init_profile() {
             ADD_TIMER(_segment_profile, "GenerateRowRangeByZoneMapIndexTime");
     _segment_generate_row_range_by_dict_timer =
             ADD_TIMER(_segment_profile, "GenerateRowRangeByDictTime");
+    _segment_generate_row_range_by_encoded_pages_timer =
+            ADD_TIMER(_segment_profile, "GenerateRowRangeByEncodedPagesTime");
 
     _rows_vec_cond_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsVectorPredFiltered", TUnit::UNIT);
@@ -165,6 +168,8 @@ Status OlapScanLocalState::_init_profile() {
     _vec_cond_timer = ADD_TIMER(_segment_profile, "VectorPredEvalTime");
     _short_cond_timer = ADD_TIMER(_segment_profile, "ShortPredEvalTime");
     _expr_filter_timer = ADD_TIMER(_segment_profile, "ExprFilterEvalTime");
+    _predicate_reorder_counter =
+            ADD_COUNTER(_segment_profile, "PredicateReorderCount", TUnit::UNIT);
     _predicate_column_read_timer = ADD_TIMER(_segment_profile, "PredicateColumnReadTime");
     _non_predicate_column_read_timer = ADD_TIMER(_segment_profile, "NonPredicateColumnReadTime");
     _predicate_column_read_seek_timer = ADD_TIMER(_segment_profile, "PredicateColumnReadSeekTime");
@@ -182,6 +187,8 @@ Status OlapScanLocalState::_init_profile() {
             ADD_COUNTER(_segment_profile, "RowsZoneMapRuntimePredicateFiltered", TUnit::UNIT);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
     _dict_filtered_counter = ADD_COUNTER(_segment_profile, "SegmentDictFiltered", TUnit::UNIT);
+    _encoded_page_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsEncodedPageFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
     _conditions_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsConditionsFiltered", TUnit::UNIT);
@@ -193,6 +200,8 @@ Status OlapScanLocalState::_init_profile() {
 
     _total_pages_num_counter = ADD_COUNTER(_segment_profile, "TotalPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_segment_profile, "CachedPagesNum", TUnit::UNIT);
+    _cached_compressed_pages_num_counter =
+            ADD_COUNTER(_segment_profile, "CachedCompressedPagesNum", TUnit::UNIT);
 
     _bitmap_index_filter_counter =
             ADD_COUNTER(_segment_profile, "RowsBitmapIndexFiltered", TUnit::UNIT);
@@ -335,6 +344,7 @@ Status OlapScanLocalState::_process_conjuncts(RuntimeState* state) {
         return Status::OK();
     }
     RETURN_IF_ERROR(_build_key_ranges_and_filters());
+    _normalized_conjunct_num = _conjuncts.size();
     return Status::OK();
 }
 
@@ -472,6 +482,9 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* sc
         if (max_scanners_count <= 0) {
             max_scanners_count = CpuInfo::num_cores();
         }
+        // Build finer splits than scan tasks, the scanner context keeps at most its scan
+        // concurrency of them running and hands the rest to tasks as they finish.
+        max_scanners_count *= std::max(1, config::parallel_scan_splits_per_scanner);
 
         // Too small value of `min_rows_per_scanner` is meaningless.
         auto min_rows_per_scanner =
@@ -554,8 +567,7 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* sc
 
 Status OlapScanLocalState::_sync_cloud_tablets(RuntimeState* state) {
     if (config::is_cloud_mode() && !_sync_tablet) {
-        _pending_tablets_num = _scan_ranges.size();
-        if (_pending_tablets_num > 0) {
+        if (!_scan_ranges.empty()) {
             _sync_cloud_tablets_watcher.start();
             _cloud_tablet_dependency = Dependency::create_shared(
                     _parent->operator_id(), _parent->node_id(), "CLOUD_TABLET_DEP");
@@ -568,8 +580,24 @@ Status OlapScanLocalState::_sync_cloud_tablets(RuntimeState* state) {
                 std::from_chars(_scan_ranges[i]->version.data(),
                                 _scan_ranges[i]->version.data() + _scan_ranges[i]->version.size(),
                                 version);
+                // The cached tablets already synced to the query version need no meta service rpc,
+                // resolve them here instead of taking a slot of the bounded fork join below.
+                BaseTabletSPtr cached_tablet;
+                if (auto res = ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats, true);
+                    res.has_value()) {
+                    cached_tablet = std::move(res.value());
+                    auto* cloud_tablet = static_cast<CloudTablet*>(cached_tablet.get());
+                    if (version > 0 && cloud_tablet->tablet_state() == TABLET_RUNNING &&
+                        cloud_tablet->max_version().second >= version) {
+                        ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_hotspot().count(
+                                *cached_tablet);
+                        _tablets[i] = {std::move(cached_tablet), version};
+                        continue;
+                    }
+                }
                 auto task_ctx = state->get_task_execution_context();
-                tasks.emplace_back([this, sync_stats, version, i, task_ctx]() {
+                tasks.emplace_back([this, sync_stats, version, i, task_ctx,
+                                    cached_tablet = std::move(cached_tablet)]() mutable {
                     auto task_lock = task_ctx.lock();
                     if (task_lock == nullptr) {
                         return Status::OK();
@@ -580,9 +608,11 @@ Status OlapScanLocalState::_sync_cloud_tablets(RuntimeState* state) {
                             _sync_cloud_tablets_watcher.stop();
                         }
                     });
-                    auto tablet =
-                            DORIS_TRY(ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats));
-                    _tablets[i] = {std::move(tablet), version};
+                    if (cached_tablet == nullptr) {
+                        cached_tablet = DORIS_TRY(
+                                ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats));
+                    }
+                    _tablets[i] = {std::move(cached_tablet), version};
                     SyncOptions options;
                     options.query_version = version;
                     options.merge_schema = true;
@@ -594,9 +624,15 @@ Status OlapScanLocalState::_sync_cloud_tablets(RuntimeState* state) {
                     return Status::OK();
                 });
             }
-            RETURN_IF_ERROR(cloud::bthread_fork_join(std::move(tasks),
-                                                     config::init_scanner_sync_rowsets_parallelism,
-                                                     &_cloud_tablet_future));
+            _pending_tablets_num = tasks.size();
+            if (tasks.empty()) {
+                _cloud_tablet_dependency->set_ready();
+                _sync_cloud_tablets_watcher.stop();
+            } else {
+                RETURN_IF_ERROR(cloud::bthread_fork_join(
+                        std::move(tasks), config::init_scanner_sync_rowsets_parallelism,
+                        &_cloud_tablet_future));
+            }
         }
         _sync_tablet = true;
     }
@@ -691,6 +727,12 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
     }
 
     for (size_t i = 0; i < _scan_ranges.size(); i++) {
+        if (_query_cache_delta_base != nullptr) {
+            if (_capture_query_cache_delta(i)) {
+                continue;
+            }
+            _query_cache_delta_base.reset();
+        }
         RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers({0, _tablets[i].version},
                                                                &_read_sources[i].rs_splits,
                                                                _state->skip_missing_version()));
@@ -704,6 +746,14 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
                      print_id(PipelineXLocalState<>::_state->query_id()));
         }
     }
+    if (_query_cache_delta_base != nullptr) {
+        custom_profile()->add_info_string(
+                "QueryCacheDeltaBaseVersion",
+                std::to_string(_query_cache_delta_base->get_cache_version()));
+        PipelineXLocalState<>::_state->get_query_ctx()->set_query_cache_delta_base(
+                _query_cache_key + print_id(PipelineXLocalState<>::_state->fragment_instance_id()),
+                std::move(_query_cache_delta_base));
+    }
     timer.stop();
     double cost_secs = static_cast<double>(timer.elapsed_time()) / NANOS_PER_SEC;
     if (cost_secs > 1) {
@@ -762,7 +812,8 @@ TOlapScanNode& OlapScanLocalState::olap_scan_node() const {
 
 void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
                                          const std::vector<TScanRangeParams>& scan_ranges) {
-    const auto& cache_param = _parent->cast<OlapScanOperatorX>()._cache_param;
+    const auto& p = _parent->cast<OlapScanOperatorX>();
+    const auto& cache_param = p._cache_param;
     bool hit_cache = false;
     if (!cache_param.digest.empty() && !cache_param.force_refresh_query_cache) {
         std::string cache_key;
@@ -773,6 +824,13 @@ void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
         }
         doris::QueryCacheHandle handle;
         hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
+        if (!hit_cache && p._query_cache_allow_delta && config::enable_incremental_query_cache) {
+            auto delta_base = std::make_shared<QueryCacheHandle>();
+            if (QueryCache::instance()->lookup_delta_base(cache_key, version, delta_base.get())) {
+                _query_cache_key = std::move(cache_key);
+                _query_cache_delta_base = std::move(delta_base);
+            }
+        }
     }
 
     if (!hit_cache) {
@@ -784,6 +842,29 @@ void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
     }
 }
 
+// Rows of a duplicate key tablet are never merged across rowsets, so when no delete lands in
+// the appended versions the cached result plus the result of those rowsets covers the tablet.
+bool OlapScanLocalState::_capture_query_cache_delta(size_t tablet_idx) {
+    const auto& tablet = _tablets[tablet_idx].tablet;
+    if (tablet->keys_type() != KeysType::DUP_KEYS) {
+        return false;
+    }
+    Version delta_version {_query_cache_delta_base->get_cache_version() + 1,
+                           _tablets[tablet_idx].version};
+    std::vector<RowSetSplits> rs_splits;
+    // Fails when a compaction already merged the cached version into a newer rowset.
+    if (!tablet->capture_rs_readers(delta_version, &rs_splits, false).ok()) {
+        return false;
+    }
+    for (const auto& split : rs_splits) {
+        if (split.rs_reader->rowset()->rowset_meta()->has_delete_predicate()) {
+            return false;
+        }
+    }
+    _read_sources[tablet_idx].rs_splits = std::move(rs_splits);
+    return true;
+}
+
 static std::string olap_filter_to_string(const doris::TCondition& condition) {
     auto op_name = condition.condition_op;
     if (condition.condition_op == "*=") {
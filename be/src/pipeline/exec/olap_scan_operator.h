@@ -28,6 +28,10 @@
 #include "pipeline/exec/scan_operator.h"
 #include "util/runtime_profile.h"
 
+namespace doris {
+class QueryCacheHandle;
+} // namespace doris
+
 namespace doris::vectorized {
 class OlapScanner;
 } // namespace doris::vectorized
@@ -66,6 +70,7 @@ private:
     friend class vectorized::OlapScanner;
 
     Status _sync_cloud_tablets(RuntimeState* state);
+    bool _capture_query_cache_delta(size_t tablet_idx);
     void set_scan_ranges(RuntimeState* state,
                          const std::vector<TScanRangeParams>& scan_ranges) override;
     Status _init_profile() override;
@@ -110,6 +115,9 @@ private:
     std::vector<std::unique_ptr<doris::OlapScanRange>> _cond_ranges;
     OlapScanKeys _scan_keys;
     std::vector<FilterOlapParam<TCondition>> _olap_filters;
+    // Number of conjuncts left after normalization, runtime filters that arrive later are
+    // appended behind them
+    size_t _normalized_conjunct_num = 0;
     // If column id in this set, indicate that we need to read data after index filtering
     std::set<int32_t> _maybe_read_column_ids;
 
@@ -136,12 +144,14 @@ private:
     RuntimeProfile::Counter* _vec_cond_timer = nullptr;
     RuntimeProfile::Counter* _short_cond_timer = nullptr;
     RuntimeProfile::Counter* _expr_filter_timer = nullptr;
+    RuntimeProfile::Counter* _predicate_reorder_counter = nullptr;
     RuntimeProfile::Counter* _output_col_timer = nullptr;
 
     RuntimeProfile::Counter* _stats_filtered_counter = nullptr;
     RuntimeProfile::Counter* _stats_rp_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
     RuntimeProfile::Counter* _dict_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _encoded_page_filtered_counter = nullptr;
     RuntimeProfile::Counter* _del_filtered_counter = nullptr;
     RuntimeProfile::Counter* _conditions_filtered_counter = nullptr;
     RuntimeProfile::Counter* _key_range_filtered_counter = nullptr;
@@ -173,6 +183,7 @@ private:
     RuntimeProfile::Counter* _collect_iterator_merge_next_timer = nullptr;
     RuntimeProfile::Counter* _segment_generate_row_range_by_zonemap_timer = nullptr;
     RuntimeProfile::Counter* _segment_generate_row_range_by_dict_timer = nullptr;
+    RuntimeProfile::Counter* _segment_generate_row_range_by_encoded_pages_timer = nullptr;
     RuntimeProfile::Counter* _predicate_column_read_timer = nullptr;
     RuntimeProfile::Counter* _non_predicate_column_read_timer = nullptr;
     RuntimeProfile::Counter* _predicate_column_read_seek_timer = nullptr;
@@ -187,6 +198,8 @@ private:
     // page read from cache
     // used by segment v2
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
+    // page decompressed from the compressed page cache
+    RuntimeProfile::Counter* _cached_compressed_pages_num_counter = nullptr;
 
     // row count filtered by bitmap inverted index
     RuntimeProfile::Counter* _bitmap_index_filter_counter = nullptr;
@@ -272,6 +285,10 @@ private:
     std::vector<TabletWithVersion> _tablets;
     std::vector<TabletReader::ReadSource> _read_sources;
 
+    // The query cache entry of an older version, only the rowsets after it are scanned.
+    std::string _query_cache_key;
+    std::shared_ptr<QueryCacheHandle> _query_cache_delta_base;
+
     std::map<SlotId, vectorized::VExprContextSPtr> _slot_id_to_virtual_column_expr;
     std::map<SlotId, size_t> _slot_id_to_index_in_block;
     // this map is needed for scanner opening.
@@ -284,10 +301,15 @@ public:
                       const DescriptorTbl& descs, int parallel_tasks,
                       const TQueryCacheParam& cache_param);
 
+    // Set when the query cache sits on a partial aggregation, whose cached result can be
+    // extended with the result of the newly appended rowsets.
+    void set_query_cache_allow_delta(bool allow) { _query_cache_allow_delta = allow; }
+
 private:
     friend class OlapScanLocalState;
     TOlapScanNode _olap_scan_node;
     TQueryCacheParam _cache_param;
+    bool _query_cache_allow_delta = false;
 };
 
 #include "common/compile_check_end.h"
@@ -81,6 +81,7 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
@@ -376,6 +377,7 @@ Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::
         }
     });
 
+    ScopedCpuProfileOperator cpu_profile_operator(node_id(), CpuProfileScope::OPERATOR);
     Status status;
     auto* local_state = state->get_local_state(operator_id());
     Defer defer([&]() {
@@ -129,6 +129,12 @@ public:
 
     virtual size_t revocable_mem_size(RuntimeState* state) const { return 0; }
 
+    // The bytes expected to be written to the spill files to free `revocable_mem_size`, the query
+    // prefers to spill the operators freeing the most memory per byte of spill io.
+    virtual size_t revocable_mem_spill_io_size(RuntimeState* state) const {
+        return revocable_mem_size(state);
+    }
+
     virtual Status revoke_memory(RuntimeState* state,
                                  const std::shared_ptr<SpillContext>& spill_context) {
         return Status::OK();
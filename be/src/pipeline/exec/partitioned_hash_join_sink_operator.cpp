@@ -20,9 +20,11 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
@@ -46,6 +48,7 @@ Status PartitionedHashJoinSinkLocalState::init(doris::RuntimeState* state,
     auto& p = _parent->cast<PartitionedHashJoinSinkOperatorX>();
     _shared_state->partitioned_build_blocks.resize(p._partition_count);
     _shared_state->spilled_streams.resize(p._partition_count);
+    _shared_state->spilled_partitions.assign(p._partition_count, false);
 
     _rows_in_partitions.assign(p._partition_count, 0);
 
@@ -220,6 +223,16 @@ Status PartitionedHashJoinSinkLocalState::_revoke_unpartitioned_block(
         auto& partitioned_blocks = _shared_state->partitioned_build_blocks;
         std::vector<std::vector<uint32_t>> partitions_indexes(p._partition_count);
 
+        // Only part of the partitions are spilled, the rows of the others are kept in memory and
+        // joined without reading back from disk.
+        auto& spilled_partitions = _shared_state->spilled_partitions;
+        const auto ratio = std::clamp(config::hash_join_spill_partition_ratio, 0.0, 1.0);
+        const auto num_spilled_partitions = std::max<uint32_t>(
+                1, static_cast<uint32_t>(std::ceil(ratio * p._partition_count)));
+        for (uint32_t i = 0; i != num_spilled_partitions; ++i) {
+            spilled_partitions[i] = true;
+        }
+
         const size_t reserved_size = 4096;
         std::for_each(partitions_indexes.begin(), partitions_indexes.end(),
                       [](std::vector<uint32_t>& indices) { indices.reserve(reserved_size); });
@@ -271,7 +284,8 @@ Status PartitionedHashJoinSinkLocalState::_revoke_unpartitioned_block(
                 }
                 int64_t new_mem = partition_block->allocated_bytes();
 
-                if (partition_block->rows() >= reserved_size || is_last_block) {
+                if (spilled_partitions[partition_idx] &&
+                    (partition_block->rows() >= reserved_size || is_last_block)) {
                     auto block = partition_block->to_block();
                     RETURN_IF_ERROR(spilling_stream->spill_block(state, block, false));
                     partition_block =
@@ -338,8 +352,64 @@ Status PartitionedHashJoinSinkLocalState::terminate(RuntimeState* state) {
     return PipelineXSpillSinkLocalState<PartitionedHashJoinSharedState>::terminate(state);
 }
 
+std::vector<uint32_t> PartitionedHashJoinSinkLocalState::_select_partitions_to_spill(
+        bool spill_in_memory_partitions) {
+    auto& partitioned_blocks = _shared_state->partitioned_build_blocks;
+    auto& spilled_partitions = _shared_state->spilled_partitions;
+    std::vector<uint32_t> partitions;
+    std::vector<uint32_t> in_memory_partitions;
+    size_t in_memory_bytes = 0;
+    for (uint32_t i = 0; i != partitioned_blocks.size(); ++i) {
+        auto& block = partitioned_blocks[i];
+        if (!block) {
+            continue;
+        }
+        if (spilled_partitions[i]) {
+            partitions.emplace_back(i);
+        } else {
+            in_memory_partitions.emplace_back(i);
+            in_memory_bytes += block->allocated_bytes();
+        }
+    }
+    if (!spill_in_memory_partitions) {
+        return partitions;
+    }
+
+    // Spill the largest in-memory partitions first, until about `hash_join_spill_partition_ratio`
+    // of the in-memory bytes are released.
+    std::sort(in_memory_partitions.begin(), in_memory_partitions.end(),
+              [&](uint32_t lhs, uint32_t rhs) {
+                  return partitioned_blocks[lhs]->allocated_bytes() >
+                         partitioned_blocks[rhs]->allocated_bytes();
+              });
+    const auto ratio = std::clamp(config::hash_join_spill_partition_ratio, 0.0, 1.0);
+    const auto bytes_to_spill = static_cast<size_t>(ratio * static_cast<double>(in_memory_bytes));
+    size_t spilled_bytes = 0;
+    for (auto i : in_memory_partitions) {
+        if (spilled_bytes > 0 && spilled_bytes >= bytes_to_spill) {
+            break;
+        }
+        spilled_bytes += partitioned_blocks[i]->allocated_bytes();
+        spilled_partitions[i] = true;
+        partitions.emplace_back(i);
+    }
+    return partitions;
+}
+
+size_t PartitionedHashJoinSinkLocalState::_spilled_partitions_mem_size() const {
+    size_t mem_size = 0;
+    for (size_t i = 0; i != _shared_state->partitioned_build_blocks.size(); ++i) {
+        auto& block = _shared_state->partitioned_build_blocks[i];
+        if (block && _shared_state->spilled_partitions[i]) {
+            mem_size += block->allocated_bytes();
+        }
+    }
+    return mem_size;
+}
+
 Status PartitionedHashJoinSinkLocalState::revoke_memory(
-        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context,
+        bool spill_in_memory_partitions) {
     SCOPED_TIMER(_spill_total_timer);
     VLOG_DEBUG << fmt::format("Query:{}, hash join sink:{}, task:{}, revoke_memory, eos:{}",
                               print_id(state->query_id()), _parent->node_id(), state->task_id(),
@@ -380,9 +450,10 @@ Status PartitionedHashJoinSinkLocalState::revoke_memory(
         return status;
     };
 
+    auto partitions = _select_partitions_to_spill(spill_in_memory_partitions);
     auto spill_runnable = std::make_shared<SpillSinkRunnable>(
             state, nullptr, nullptr, operator_profile(), _shared_state->shared_from_this(),
-            [this, query_id] {
+            [this, query_id, partitions = std::move(partitions)] {
                 DBUG_EXECUTE_IF("fault_inject::partitioned_hash_join_sink::revoke_memory_cancel", {
                     auto status = Status::InternalError(
                             "fault_inject partitioned_hash_join_sink "
@@ -392,7 +463,7 @@ Status PartitionedHashJoinSinkLocalState::revoke_memory(
                 });
                 SCOPED_TIMER(_spill_build_timer);
 
-                for (size_t i = 0; i != _shared_state->partitioned_build_blocks.size(); ++i) {
+                for (auto i : partitions) {
                     vectorized::SpillStreamSPtr& spilling_stream =
                             _shared_state->spilled_streams[i];
                     DCHECK(spilling_stream != nullptr);
@@ -406,7 +477,7 @@ Status PartitionedHashJoinSinkLocalState::revoke_memory(
 
                     auto status = [&]() {
                         RETURN_IF_CATCH_EXCEPTION(
-                                return _spill_to_disk(static_cast<uint32_t>(i), spilling_stream));
+                                return _spill_to_disk(i, spilling_stream));
                     }();
 
                     RETURN_IF_ERROR(status);
@@ -630,7 +701,7 @@ Status PartitionedHashJoinSinkOperatorX::sink(RuntimeState* state, vectorized::B
     if (rows == 0) {
         if (eos) {
             if (need_to_spill) {
-                return revoke_memory(state, nullptr);
+                return local_state.revoke_memory(state, nullptr, false);
             } else {
                 DBUG_EXECUTE_IF("fault_inject::partitioned_hash_join_sink::sink_eos", {
                     return Status::Error<INTERNAL_ERROR>(
@@ -675,10 +746,10 @@ Status PartitionedHashJoinSinkOperatorX::sink(RuntimeState* state, vectorized::B
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
     if (need_to_spill) {
         RETURN_IF_ERROR(local_state._partition_block(state, in_block, 0, rows));
-        if (eos) {
-            return revoke_memory(state, nullptr);
-        } else if (revocable_mem_size(state) > vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM) {
-            return revoke_memory(state, nullptr);
+        // The in-memory partitions are only spilled when memory is revoked by the memory manager.
+        if (eos || local_state._spilled_partitions_mem_size() >
+                           vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM) {
+            return local_state.revoke_memory(state, nullptr, false);
         }
     } else {
         DBUG_EXECUTE_IF("fault_inject::partitioned_hash_join_sink::sink", {
@@ -720,6 +791,12 @@ size_t PartitionedHashJoinSinkOperatorX::revocable_mem_size(RuntimeState* state)
     return local_state.revocable_mem_size(state);
 }
 
+size_t PartitionedHashJoinSinkOperatorX::revocable_mem_spill_io_size(RuntimeState* state) const {
+    // The probe rows falling into the spilled partitions are spilled as well, assume the probe
+    // side is as large as the build side.
+    return revocable_mem_size(state) * 2;
+}
+
 Status PartitionedHashJoinSinkOperatorX::revoke_memory(
         RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
     auto& local_state = get_local_state(state);
@@ -49,7 +49,10 @@ public:
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
     Status close(RuntimeState* state, Status exec_status) override;
-    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context);
+    // Spill the partitions already spilled, and also some of the in-memory partitions if
+    // `spill_in_memory_partitions` is true.
+    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context,
+                         bool spill_in_memory_partitions = true);
     size_t revocable_mem_size(RuntimeState* state) const;
     Status terminate(RuntimeState* state) override;
     [[nodiscard]] size_t get_reserve_mem_size(RuntimeState* state, bool eos);
@@ -73,6 +76,12 @@ protected:
 
     Status _finish_spilling();
 
+    // The partitions to write to disk on revoking memory, the chosen in-memory partitions are
+    // marked spilled.
+    std::vector<uint32_t> _select_partitions_to_spill(bool spill_in_memory_partitions);
+
+    size_t _spilled_partitions_mem_size() const;
+
     Status _setup_internal_operator(RuntimeState* state);
 
     friend class PartitionedHashJoinSinkOperatorX;
@@ -113,6 +122,8 @@ public:
 
     size_t revocable_mem_size(RuntimeState* state) const override;
 
+    size_t revocable_mem_spill_io_size(RuntimeState* state) const override;
+
     Status revoke_memory(RuntimeState* state,
                          const std::shared_ptr<SpillContext>& spill_context) override;
 
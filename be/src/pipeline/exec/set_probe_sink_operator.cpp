@@ -22,8 +22,11 @@
 #include <memory>
 
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
 #include "pipeline/pipeline_task.h"
+#include "runtime/fragment_mgr.h"
 #include "vec/common/hash_table/hash_table_set_probe.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -52,6 +55,8 @@ Status SetProbeSinkOperatorX<is_intersect>::init(const TPlanNode& tnode, Runtime
 
     const auto& texpr = (*result_texpr_lists)[_cur_child_id];
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(texpr, _child_exprs));
+    // Only spills after the build side is spilled, see `revocable_mem_size`.
+    this->_spillable = state->enable_spill();
 
     return Status::OK();
 }
@@ -73,6 +78,22 @@ Status SetProbeSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized
     SCOPED_PEAK_MEM(&local_state._estimate_memory_usage);
 
     const auto probe_rows = cast_set<uint32_t>(in_block->rows());
+    if (local_state._shared_state->is_spilled) {
+        if (probe_rows > 0) {
+            SCOPED_TIMER(local_state._extract_probe_data_timer);
+            vectorized::Block key_block;
+            RETURN_IF_ERROR(local_state._shared_state->extract_spill_key_block(
+                    local_state._child_exprs, *in_block, key_block));
+            RETURN_IF_ERROR(local_state._shared_state->partition_spill_block(
+                    key_block, local_state._partitioned_blocks));
+        }
+        if (eos && !local_state._terminated) {
+            local_state._child_eos = true;
+            return local_state.revoke_memory(state, nullptr);
+        }
+        return Status::OK();
+    }
+
     if (probe_rows > 0) {
         {
             SCOPED_TIMER(local_state._extract_probe_data_timer);
@@ -109,6 +130,8 @@ Status SetProbeSinkLocalState<is_intersect>::init(RuntimeState* state, LocalSink
 
     _probe_timer = ADD_TIMER(Base::custom_profile(), "ProbeTime");
     _extract_probe_data_timer = ADD_TIMER(Base::custom_profile(), "ExtractProbeDataTime");
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "SetProbeSinkSpillDependency", true);
     Parent& parent = _parent->cast<Parent>();
     _shared_state->probe_finished_children_dependency[parent._cur_child_id] = _dependency;
     _dependency->block();
@@ -179,8 +202,18 @@ template <bool is_intersect>
 void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
         SetProbeSinkLocalState<is_intersect>& local_state) {
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
+    if (local_state._shared_state->is_spilled) {
+        // The source probes the spilled partitions one by one.
+        if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
+            local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
+                    ->set_ready();
+        } else {
+            local_state._dependency->set_ready_to_read();
+        }
+        return;
+    }
     if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
-        _refresh_hash_table(local_state);
+        local_state._shared_state->template refresh_hash_table<is_intersect>();
         uint64_t hash_table_size = local_state._shared_state->get_hash_table_size();
         valid_element_in_hash_tbl = is_intersect ? 0 : hash_table_size;
         local_state._probe_columns.resize(
@@ -199,10 +232,76 @@ size_t SetProbeSinkOperatorX<is_intersect>::get_reserve_mem_size(RuntimeState* s
 }
 
 template <bool is_intersect>
-void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
-        SetProbeSinkLocalState<is_intersect>& local_state) {
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    auto& hash_table_variants = local_state._shared_state->hash_table_variants;
+size_t SetProbeSinkOperatorX<is_intersect>::revocable_mem_size(RuntimeState* state) const {
+    auto& local_state = get_local_state(state);
+    if (!local_state._shared_state->is_spilled) {
+        return 0;
+    }
+    size_t mem_size = 0;
+    for (const auto& block : local_state._partitioned_blocks) {
+        if (block) {
+            mem_size += block->allocated_bytes();
+        }
+    }
+    return mem_size;
+}
+
+template <bool is_intersect>
+Status SetProbeSinkOperatorX<is_intersect>::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    auto& local_state = get_local_state(state);
+    return local_state.revoke_memory(state, spill_context);
+}
+
+template <bool is_intersect>
+Status SetProbeSinkLocalState<is_intersect>::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    auto& parent = _parent->cast<Parent>();
+    auto query_id = state->query_id();
+    VLOG_DEBUG << fmt::format("Query:{}, set probe sink:{}, task:{}, revoke_memory, eos:{}",
+                              print_id(query_id), _parent->node_id(), state->task_id(),
+                              _child_eos);
+
+    auto spill_func = [this, state, query_id, &parent] {
+        Status status;
+        Defer defer {[&]() {
+            if (!status.ok()) {
+                LOG(WARNING) << fmt::format(
+                        "Query:{}, set probe sink:{}, task:{}, revoke memory error:{}",
+                        print_id(query_id), _parent->node_id(), state->task_id(), status);
+            }
+            state->get_query_ctx()
+                    ->resource_ctx()
+                    ->task_controller()
+                    ->decrease_revoking_tasks_count();
+        }};
+
+        status = _shared_state->spill_partitioned_blocks(state, parent._cur_child_id,
+                                                         _parent->node_id(), operator_profile(),
+                                                         _partitioned_blocks, _child_eos);
+        RETURN_IF_ERROR(status);
+        if (_child_eos) {
+            parent._finalize_probe(*this);
+        }
+        return status;
+    };
+
+    auto exception_catch_func = [spill_func]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    state->get_query_ctx()->resource_ctx()->task_controller()->increase_revoking_tasks_count();
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillSinkRunnable>(state, spill_context, _spill_dependency,
+                                                operator_profile(),
+                                                _shared_state->shared_from_this(),
+                                                exception_catch_func));
+}
+
+template <bool is_intersect>
+void SetSharedState::refresh_hash_table() {
     std::visit(
             [&](auto&& arg) {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
@@ -223,8 +322,7 @@ void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
                     if (is_need_shrink) {
                         auto tmp_hash_table =
                                 std::make_shared<typename HashTableCtxType::HashMapType>();
-                        tmp_hash_table->reserve(
-                                local_state._shared_state->valid_element_in_hash_tbl);
+                        tmp_hash_table->reserve(valid_element_in_hash_tbl);
                         while (iter != arg.end) {
                             auto& mapped = iter.get_second();
                             auto* it = &mapped;
@@ -254,12 +352,14 @@ void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
 
                     arg.inited_iterator = false;
                 } else {
-                    LOG(WARNING) << "Uninited hash table in Set Probe Sink Operator";
+                    LOG(WARNING) << "Uninited hash table in Set Operator";
                 }
             },
             hash_table_variants->method_variant);
 }
 
+template void SetSharedState::refresh_hash_table<true>();
+template void SetSharedState::refresh_hash_table<false>();
 template class SetProbeSinkLocalState<true>;
 template class SetProbeSinkLocalState<false>;
 template class SetProbeSinkOperatorX<true>;
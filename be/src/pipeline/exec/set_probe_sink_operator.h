@@ -38,10 +38,10 @@ template <bool is_intersect>
 class SetProbeSinkOperatorX;
 
 template <bool is_intersect>
-class SetProbeSinkLocalState final : public PipelineXSinkLocalState<SetSharedState> {
+class SetProbeSinkLocalState final : public PipelineXSpillSinkLocalState<SetSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(SetProbeSinkLocalState);
-    using Base = PipelineXSinkLocalState<SetSharedState>;
+    using Base = PipelineXSpillSinkLocalState<SetSharedState>;
     using Parent = SetProbeSinkOperatorX<is_intersect>;
 
     SetProbeSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
@@ -51,6 +51,8 @@ public:
     Status open(RuntimeState* state) override;
     int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
 
+    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context);
+
 private:
     friend class SetProbeSinkOperatorX<is_intersect>;
     template <class HashTableContext, bool is_intersected>
@@ -66,6 +68,10 @@ private:
 
     RuntimeProfile::Counter* _extract_probe_data_timer = nullptr;
     RuntimeProfile::Counter* _probe_timer = nullptr;
+
+    // The rows waiting to be spilled once the build side is spilled.
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> _partitioned_blocks;
+    bool _child_eos = false;
 };
 
 template <bool is_intersect>
@@ -111,12 +117,16 @@ public:
 
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) override;
 
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state,
+                         const std::shared_ptr<SpillContext>& spill_context) override;
+
 private:
     void _finalize_probe(SetProbeSinkLocalState<is_intersect>& local_state);
     Status _extract_probe_column(SetProbeSinkLocalState<is_intersect>& local_state,
                                  vectorized::Block& block, vectorized::ColumnRawPtrs& raw_ptrs,
                                  int child_id);
-    void _refresh_hash_table(SetProbeSinkLocalState<is_intersect>& local_state);
     const int _cur_child_id;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
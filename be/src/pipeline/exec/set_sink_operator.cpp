@@ -20,8 +20,12 @@
 #include <memory>
 
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
+#include "pipeline/pipeline_task.h"
+#include "runtime/fragment_mgr.h"
 #include "vec/common/hash_table/hash_table_set_build.h"
 #include "vec/core/materialize_block.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -74,6 +78,24 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
     auto& build_block = local_state._shared_state->build_block;
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
 
+    if (local_state._shared_state->is_spilled) {
+        if (in_block->rows() != 0) {
+            SCOPED_TIMER(local_state._merge_block_timer);
+            vectorized::Block key_block;
+            RETURN_IF_ERROR(local_state._shared_state->extract_spill_key_block(
+                    local_state._child_exprs, *in_block, key_block));
+            RETURN_IF_ERROR(local_state._shared_state->partition_spill_block(
+                    key_block, local_state._partitioned_blocks));
+        }
+        if (eos) {
+            local_state._child_eos = true;
+            // The runtime filters need the whole hash table, which is never built once spilled.
+            RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->skip_process(state));
+            return local_state.revoke_memory(state, nullptr);
+        }
+        return Status::OK();
+    }
+
     if (in_block->rows() != 0) {
         {
             SCOPED_TIMER(local_state._merge_block_timer);
@@ -180,11 +202,13 @@ Status SetSinkOperatorX<is_intersect>::_extract_build_column(
 
 template <bool is_intersect>
 Status SetSinkLocalState<is_intersect>::init(RuntimeState* state, LocalSinkStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<SetSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _merge_block_timer = ADD_TIMER(custom_profile(), "MergeBlocksTime");
     _build_timer = ADD_TIMER(custom_profile(), "BuildTime");
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "SetSinkSpillDependency", true);
     auto& parent = _parent->cast<Parent>();
     _shared_state->probe_finished_children_dependency[parent._cur_child_id] = _dependency;
     DCHECK(parent._cur_child_id == 0);
@@ -212,7 +236,8 @@ template <bool is_intersect>
 Status SetSinkLocalState<is_intersect>::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
-    RETURN_IF_ERROR(PipelineXSinkLocalState<SetSharedState>::open(state));
+    RETURN_IF_ERROR(Base::open(state));
+    _shared_state->setup_shared_profile(custom_profile());
 
     auto& parent = _parent->cast<Parent>();
     DCHECK(parent._cur_child_id == 0);
@@ -237,6 +262,7 @@ Status SetSinkOperatorX<is_intersect>::init(const TPlanNode& tnode, RuntimeState
 
     const auto& texpr = (*result_texpr_lists)[_cur_child_id];
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(texpr, _child_exprs));
+    this->_spillable = state->enable_spill();
 
     return Status::OK();
 }
@@ -244,6 +270,13 @@ Status SetSinkOperatorX<is_intersect>::init(const TPlanNode& tnode, RuntimeState
 template <bool is_intersect>
 size_t SetSinkOperatorX<is_intersect>::get_reserve_mem_size(RuntimeState* state, bool eos) {
     auto& local_state = get_local_state(state);
+    if (local_state._shared_state->is_spilled) {
+        size_t size_to_reserve = 0;
+        for (auto& _child_expr : _child_exprs) {
+            size_to_reserve += _child_expr->root()->estimate_memory(state->batch_size());
+        }
+        return size_to_reserve;
+    }
     size_t size_to_reserve = std::visit(
             [&](auto&& arg) -> size_t {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
@@ -262,6 +295,98 @@ size_t SetSinkOperatorX<is_intersect>::get_reserve_mem_size(RuntimeState* state,
     return size_to_reserve;
 }
 
+template <bool is_intersect>
+size_t SetSinkOperatorX<is_intersect>::revocable_mem_size(RuntimeState* state) const {
+    auto& local_state = get_local_state(state);
+    if (!local_state._shared_state->is_spilled) {
+        // The rows are in the hash table once it is built, it can not be spilled any more.
+        if (local_state._shared_state->build_block.rows() != 0) {
+            return 0;
+        }
+        return local_state._mutable_block.allocated_bytes();
+    }
+    size_t mem_size = 0;
+    for (const auto& block : local_state._partitioned_blocks) {
+        if (block) {
+            mem_size += block->allocated_bytes();
+        }
+    }
+    return mem_size;
+}
+
+template <bool is_intersect>
+Status SetSinkOperatorX<is_intersect>::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    auto& local_state = get_local_state(state);
+    return local_state.revoke_memory(state, spill_context);
+}
+
+template <bool is_intersect>
+Status SetSinkLocalState<is_intersect>::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    auto& parent = _parent->cast<Parent>();
+    if (!_shared_state->is_spilled) {
+        _shared_state->is_spilled = true;
+        _shared_state->init_spill_params(state->spill_hash_join_partition_count());
+        custom_profile()->add_info_string("Spilled", "true");
+    }
+
+    auto query_id = state->query_id();
+    VLOG_DEBUG << fmt::format("Query:{}, set sink:{}, task:{}, revoke_memory, eos:{}",
+                              print_id(query_id), _parent->node_id(), state->task_id(),
+                              _child_eos);
+
+    auto spill_func = [this, state, query_id, &parent] {
+        Status status;
+        Defer defer {[&]() {
+            if (!status.ok()) {
+                LOG(WARNING) << fmt::format("Query:{}, set sink:{}, task:{}, revoke memory error:{}",
+                                            print_id(query_id), _parent->node_id(),
+                                            state->task_id(), status);
+            }
+            state->get_query_ctx()
+                    ->resource_ctx()
+                    ->task_controller()
+                    ->decrease_revoking_tasks_count();
+        }};
+
+        // The rows merged before the first spill.
+        if (!_mutable_block.empty()) {
+            auto block = _mutable_block.to_block();
+            _mutable_block.clear();
+            vectorized::Block key_block;
+            status = _shared_state->extract_spill_key_block(_child_exprs, block, key_block);
+            RETURN_IF_ERROR(status);
+            block.clear();
+            status = _shared_state->partition_spill_block(key_block, _partitioned_blocks);
+            RETURN_IF_ERROR(status);
+        }
+
+        status = _shared_state->spill_partitioned_blocks(state, parent._cur_child_id,
+                                                         _parent->node_id(), operator_profile(),
+                                                         _partitioned_blocks, _child_eos);
+        RETURN_IF_ERROR(status);
+        if (_child_eos) {
+            _shared_state->probe_finished_children_dependency[parent._cur_child_id + 1]
+                    ->set_ready();
+        }
+        return status;
+    };
+
+    auto exception_catch_func = [spill_func]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    state->get_query_ctx()->resource_ctx()->task_controller()->increase_revoking_tasks_count();
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillSinkRunnable>(state, spill_context, _spill_dependency,
+                                                operator_profile(),
+                                                _shared_state->shared_from_this(),
+                                                exception_catch_func));
+}
+
 template <bool is_intersect>
 Status SetSinkOperatorX<is_intersect>::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Base::prepare(state));
@@ -34,10 +34,10 @@ template <bool is_intersect>
 class SetSinkOperatorX;
 
 template <bool is_intersect>
-class SetSinkLocalState final : public PipelineXSinkLocalState<SetSharedState> {
+class SetSinkLocalState final : public PipelineXSpillSinkLocalState<SetSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(SetSinkLocalState);
-    using Base = PipelineXSinkLocalState<SetSharedState>;
+    using Base = PipelineXSpillSinkLocalState<SetSharedState>;
     using Parent = SetSinkOperatorX<is_intersect>;
 
     SetSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state) : Base(parent, state) {
@@ -51,6 +51,8 @@ public:
     Status terminate(RuntimeState* state) override;
     Status close(RuntimeState* state, Status exec_status) override;
 
+    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context);
+
 private:
     friend class SetSinkOperatorX<is_intersect>;
 
@@ -64,6 +66,10 @@ private:
 
     std::shared_ptr<RuntimeFilterProducerHelperSet> _runtime_filter_producer_helper;
     std::shared_ptr<CountedFinishDependency> _finish_dependency;
+
+    // The rows waiting to be spilled after the build side is spilled.
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> _partitioned_blocks;
+    bool _child_eos = false;
 };
 
 template <bool is_intersect>
@@ -116,6 +122,11 @@ public:
 
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) override;
 
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state,
+                         const std::shared_ptr<SpillContext>& spill_context) override;
+
 private:
     template <class HashTableContext, bool is_intersected>
     friend struct HashTableBuild;
@@ -22,6 +22,11 @@
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
+#include "runtime/fragment_mgr.h"
+#include "vec/common/hash_table/hash_table_set_build.h"
+#include "vec/common/hash_table/hash_table_set_probe.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -32,6 +37,8 @@ Status SetSourceLocalState<is_intersect>::init(RuntimeState* state, LocalStateIn
     SCOPED_TIMER(_init_timer);
     _get_data_timer = ADD_TIMER(custom_profile(), "GetDataTime");
     _filter_timer = ADD_TIMER(custom_profile(), "FilterTime");
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "SetSourceSpillDependency", true);
     _shared_state->probe_finished_children_dependency.resize(
             _parent->cast<SetSourceOperatorX<is_intersect>>()._child_quantity, nullptr);
     return Status::OK();
@@ -71,6 +78,143 @@ Status SetSourceLocalState<is_intersect>::open(RuntimeState* state) {
     return Status::OK();
 }
 
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::close(RuntimeState* state) {
+    if (_closed) {
+        return Status::OK();
+    }
+    if (_shared_state) {
+        _shared_state->close();
+    }
+    return Base::close(state);
+}
+
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::_read_spilled_partition(
+        RuntimeState* state, size_t child_id, std::unique_ptr<vectorized::MutableBlock>& block) {
+    auto& stream = _shared_state->spilled_streams[child_id][_partition_cursor];
+    if (!stream) {
+        return Status::OK();
+    }
+    bool eos = false;
+    while (!eos && !state->is_cancelled()) {
+        vectorized::Block spilled_block;
+        RETURN_IF_ERROR(stream->read_next_block_sync(&spilled_block, &eos));
+        if (spilled_block.empty()) {
+            continue;
+        }
+        if (!block) {
+            block = vectorized::MutableBlock::create_unique(std::move(spilled_block));
+        } else {
+            RETURN_IF_ERROR(block->merge(std::move(spilled_block)));
+        }
+    }
+    ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+    stream.reset();
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::_recover_partition(RuntimeState* state) {
+    auto query_id = state->query_id();
+    auto spill_func = [this, state] {
+        auto& shared_state = *_shared_state;
+        shared_state.hash_table_variants = std::make_unique<SetDataVariants>();
+        RETURN_IF_ERROR(shared_state.hash_table_init());
+        _arena.clear();
+
+        std::unique_ptr<vectorized::MutableBlock> build_block;
+        RETURN_IF_ERROR(_read_spilled_partition(state, 0, build_block));
+        shared_state.build_block = build_block ? build_block->to_block() : vectorized::Block();
+        build_block.reset();
+        // The spilled blocks only have the key columns.
+        shared_state.build_col_idx.clear();
+        for (int i = 0; i != cast_set<int>(shared_state.build_block.columns()); ++i) {
+            shared_state.build_col_idx.insert({i, i});
+        }
+
+        const auto build_rows = cast_set<uint32_t>(shared_state.build_block.rows());
+        vectorized::ColumnRawPtrs build_columns;
+        for (const auto& column : shared_state.build_block) {
+            build_columns.push_back(column.column.get());
+        }
+        RETURN_IF_ERROR(std::visit(
+                [&](auto&& arg) -> Status {
+                    using HashTableCtxType = std::decay_t<decltype(arg)>;
+                    if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                        if (build_rows == 0) {
+                            return Status::OK();
+                        }
+                        vectorized::HashTableBuild<HashTableCtxType, is_intersect>
+                                hash_table_build_process(this, build_rows, build_columns, state);
+                        return hash_table_build_process(arg, _arena);
+                    } else {
+                        return Status::InternalError("Uninited hash table in Set Source Operator");
+                    }
+                },
+                shared_state.hash_table_variants->method_variant));
+
+        shared_state.valid_element_in_hash_tbl =
+                is_intersect ? 0 : shared_state.get_hash_table_size();
+        for (size_t child_id = 1; child_id != shared_state.child_quantity; ++child_id) {
+            auto& stream = shared_state.spilled_streams[child_id][_partition_cursor];
+            bool eos = !stream || shared_state.get_hash_table_size() == 0;
+            while (!eos && !state->is_cancelled()) {
+                vectorized::Block probe_block;
+                RETURN_IF_ERROR(stream->read_next_block_sync(&probe_block, &eos));
+                const auto probe_rows = cast_set<uint32_t>(probe_block.rows());
+                if (probe_rows == 0) {
+                    continue;
+                }
+                _probe_columns.clear();
+                for (const auto& column : probe_block) {
+                    _probe_columns.push_back(column.column.get());
+                }
+                RETURN_IF_ERROR(std::visit(
+                        [&](auto&& arg) -> Status {
+                            using HashTableCtxType = std::decay_t<decltype(arg)>;
+                            if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                                vectorized::HashTableProbe<HashTableCtxType, is_intersect>
+                                        process_hashtable_ctx(this, probe_rows);
+                                return process_hashtable_ctx.mark_data_in_hashtable(arg);
+                            } else {
+                                return Status::InternalError(
+                                        "Uninited hash table in Set Source Operator");
+                            }
+                        },
+                        shared_state.hash_table_variants->method_variant));
+            }
+            if (stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+                stream.reset();
+            }
+
+            if (child_id != shared_state.child_quantity - 1) {
+                shared_state.template refresh_hash_table<is_intersect>();
+                shared_state.valid_element_in_hash_tbl =
+                        is_intersect ? 0 : shared_state.get_hash_table_size();
+            }
+        }
+        _partition_ready = true;
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [spill_func, query_id]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        if (!status.ok()) {
+            LOG(WARNING) << fmt::format("Query:{}, set source recover partition error:{}",
+                                        print_id(query_id), status);
+        }
+        return status;
+    };
+
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillRecoverRunnable>(state, _spill_dependency, operator_profile(),
+                                                   _shared_state->shared_from_this(),
+                                                   exception_catch_func));
+}
+
 template <bool is_intersect>
 Status SetSourceOperatorX<is_intersect>::get_block(RuntimeState* state, vectorized::Block* block,
                                                    bool* eos) {
@@ -79,6 +223,16 @@ Status SetSourceOperatorX<is_intersect>::get_block(RuntimeState* state, vectoriz
     SCOPED_TIMER(local_state.exec_time_counter());
     SCOPED_PEAK_MEM(&local_state._estimate_memory_usage);
 
+    const auto is_spilled = local_state._shared_state->is_spilled;
+    if (is_spilled && !local_state._partition_ready) {
+        local_state.copy_shared_spill_profile();
+        *eos = local_state._partition_cursor == local_state._shared_state->spill_partition_count;
+        if (*eos) {
+            return Status::OK();
+        }
+        return local_state._recover_partition(state);
+    }
+
     _create_mutable_cols(local_state, block);
     {
         SCOPED_TIMER(local_state._get_data_timer);
@@ -95,6 +249,12 @@ Status SetSourceOperatorX<is_intersect>::get_block(RuntimeState* state, vectoriz
                 },
                 local_state._shared_state->hash_table_variants->method_variant));
     }
+    if (is_spilled && *eos) {
+        // Go on with the next partition.
+        local_state._partition_ready = false;
+        ++local_state._partition_cursor;
+        *eos = local_state._partition_cursor == local_state._shared_state->spill_partition_count;
+    }
     {
         SCOPED_TIMER(local_state._filter_timer);
         RETURN_IF_ERROR(vectorized::VExprContext::filter_block(local_state._conjuncts, block,
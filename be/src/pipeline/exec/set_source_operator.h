@@ -25,25 +25,40 @@
 namespace doris {
 class RuntimeState;
 
+namespace vectorized {
+template <class HashTableContext, bool is_intersected>
+struct HashTableProbe;
+} // namespace vectorized
+
 namespace pipeline {
 #include "common/compile_check_begin.h"
 template <bool is_intersect>
 class SetSourceOperatorX;
 
 template <bool is_intersect>
-class SetSourceLocalState final : public PipelineXLocalState<SetSharedState> {
+class SetSourceLocalState final : public PipelineXSpillLocalState<SetSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(SetSourceLocalState);
-    using Base = PipelineXLocalState<SetSharedState>;
+    using Base = PipelineXSpillLocalState<SetSharedState>;
     using Parent = SetSourceOperatorX<is_intersect>;
     SetSourceLocalState(RuntimeState* state, OperatorXBase* parent) : Base(state, parent) {};
     Status init(RuntimeState* state, LocalStateInfo& infos) override;
     Status open(RuntimeState* state) override;
+    Status close(RuntimeState* state) override;
+    int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
 
 private:
     void _add_result_columns();
+    // Build the hash table of the current spilled partition and probe it with the partitions
+    // of the other children.
+    Status _recover_partition(RuntimeState* state);
+    Status _read_spilled_partition(RuntimeState* state, size_t child_id,
+                                   std::unique_ptr<vectorized::MutableBlock>& block);
+
     friend class SetSourceOperatorX<is_intersect>;
     friend class OperatorX<SetSourceLocalState<is_intersect>>;
+    template <class HashTableContext, bool is_intersected>
+    friend struct vectorized::HashTableProbe;
     std::vector<vectorized::MutableColumnPtr> _mutable_cols;
     //record build column type
     vectorized::DataTypes _left_table_data_types;
@@ -51,6 +66,12 @@ private:
     RuntimeProfile::Counter* _get_data_timer = nullptr;
     RuntimeProfile::Counter* _filter_timer = nullptr;
     vectorized::IColumn::Selector _result_indexs;
+
+    // Only used if spilled.
+    size_t _partition_cursor = 0;
+    bool _partition_ready = false;
+    vectorized::ColumnRawPtrs _probe_columns;
+    vectorized::Arena _arena;
 };
 
 template <bool is_intersect>
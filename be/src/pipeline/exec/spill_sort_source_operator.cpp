@@ -209,8 +209,8 @@ Status SpillSortLocalState::_create_intermediate_merger(
         stream->set_read_counters(operator_profile());
         _current_merging_streams.emplace_back(stream);
         child_block_suppliers.emplace_back(
-                std::bind(std::mem_fn(&vectorized::SpillStream::read_next_block_sync), stream.get(),
-                          std::placeholders::_1, std::placeholders::_2));
+                std::bind(std::mem_fn(&vectorized::SpillStream::read_next_block_with_read_ahead),
+                          stream.get(), std::placeholders::_1, std::placeholders::_2));
 
         _shared_state->sorted_streams.pop_front();
     }
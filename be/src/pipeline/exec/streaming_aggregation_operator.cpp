@@ -19,6 +19,9 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <algorithm>
+#include <bitset>
+#include <cmath>
 #include <memory>
 #include <utility>
 
@@ -109,6 +112,8 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _hash_table_flush_counter = ADD_COUNTER(custom_profile(), "HashTableFlushCount", TUnit::UNIT);
+    _pre_agg_bypass_counter = ADD_COUNTER(custom_profile(), "PreAggBypassCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -330,6 +335,13 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
                                                      !_should_expand_preagg_hash_tables())) {
                             SCOPED_TIMER(_streaming_agg_timer);
                             ret_flag = true;
+                            // Output the pre-aggregated groups and aggregate the following input
+                            // into a new table which fits in the cache again, rather than passing
+                            // through all the remaining input.
+                            if (config::enable_streaming_agg_flush_hash_table &&
+                                hash_tbl.size() > 0) {
+                                _flushing_hash_table = true;
+                            }
                         }
                     }},
             _agg_data->method_variant);
@@ -337,6 +349,71 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+// Estimate the number of distinct keys of a block by linear counting on the hash values.
+static double estimate_distinct_keys(const DorisVector<size_t>& hash_values, uint32_t rows) {
+    static constexpr size_t NUM_BITS = 8192;
+    std::bitset<NUM_BITS> bits;
+    for (uint32_t i = 0; i < rows; ++i) {
+        bits.set(hash_values[i] & (NUM_BITS - 1));
+    }
+    const auto zeros = static_cast<double>(NUM_BITS - bits.count());
+    if (zeros == 0) {
+        return rows;
+    }
+    return std::min<double>(rows, -double(NUM_BITS) * std::log(zeros / double(NUM_BITS)));
+}
+
+bool StreamingAggLocalState::_should_bypass_pre_agg(const vectorized::ColumnRawPtrs& key_columns,
+                                                    uint32_t rows) {
+    if (!config::enable_streaming_agg_adaptive_bypass || !_pre_agg_bypassed) {
+        return false;
+    }
+    const auto probe_interval = std::max<int32_t>(config::streaming_agg_bypass_probe_interval, 1);
+    if (++_bypassed_blocks % probe_interval != 0) {
+        return true;
+    }
+
+    // The reduction within the block is a lower bound of the reduction against the hash table,
+    // so the pre-aggregation is only re-enabled when the key distribution really changed.
+    double reduction = 0;
+    std::visit(vectorized::Overload {
+                       [&](std::monostate& arg) -> void {
+                           throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                       },
+                       [&](auto& agg_method) -> void {
+                           agg_method.init_serialized_keys(key_columns, rows);
+                           reduction = double(rows) /
+                                       std::max(estimate_distinct_keys(agg_method.hash_values, rows),
+                                                1.0);
+                       }},
+               _agg_data->method_variant);
+    if (reduction < config::streaming_agg_bypass_min_reduction) {
+        return true;
+    }
+    _pre_agg_bypassed = false;
+    _live_reduction = 0;
+    _reduction_sampled_rows = 0;
+    return false;
+}
+
+void StreamingAggLocalState::_update_pre_agg_reduction(uint32_t rows, size_t new_groups) {
+    if (!config::enable_streaming_agg_adaptive_bypass || rows == 0) {
+        return;
+    }
+    static constexpr double DECAY = 0.75;
+    const double reduction = double(rows) / double(std::max<size_t>(new_groups, 1));
+    _live_reduction = _reduction_sampled_rows == 0
+                              ? reduction
+                              : _live_reduction * DECAY + reduction * (1 - DECAY);
+    _reduction_sampled_rows += rows;
+    if (_reduction_sampled_rows >= config::streaming_agg_bypass_min_sample_rows &&
+        _live_reduction < config::streaming_agg_bypass_min_reduction) {
+        _pre_agg_bypassed = true;
+        _bypassed_blocks = 0;
+        COUNTER_UPDATE(_pre_agg_bypass_counter, 1);
+    }
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -361,7 +438,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
     uint32_t rows = (uint32_t)in_block->rows();
     _places.resize(rows);
 
-    if (_should_not_do_pre_agg(rows)) {
+    if (_should_bypass_pre_agg(key_columns, rows) || _should_not_do_pre_agg(rows)) {
         bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
 
         std::vector<vectorized::DataTypePtr> data_types;
@@ -403,7 +480,9 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
             }
         }
     } else {
+        const auto groups_before = _get_hash_table_size();
         _emplace_into_hash_table(_places.data(), key_columns, rows);
+        _update_pre_agg_reduction(rows, _get_hash_table_size() - groups_before);
 
         for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
             RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
@@ -430,6 +509,38 @@ Status StreamingAggLocalState::_create_agg_status(vectorized::AggregateDataPtr d
     return Status::OK();
 }
 
+Status StreamingAggLocalState::_reset_hash_table() {
+    auto& p = _parent->cast<StreamingAggOperatorX>();
+    _close_with_serialized_key();
+    std::visit(vectorized::Overload {
+                       [&](std::monostate& arg) -> void {
+                           throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                       },
+                       [&](auto& agg_method) -> void {
+                           using HashTableType = std::decay_t<decltype(*agg_method.hash_table)>;
+                           using KeyType = typename std::decay_t<decltype(agg_method)>::Key;
+
+                           agg_method.arena.clear();
+                           agg_method.inited_iterator = false;
+                           agg_method.hash_table.reset(new HashTableType());
+                           _aggregate_data_container = std::make_unique<AggregateDataContainer>(
+                                   sizeof(KeyType), ((p._total_size_of_aggregate_states +
+                                                      p._align_aggregate_states - 1) /
+                                                     p._align_aggregate_states) *
+                                                            p._align_aggregate_states);
+                       }},
+               _agg_data->method_variant);
+    _agg_arena_pool.clear();
+
+    // The reduction of the new table is estimated from the input after the flush.
+    _should_expand_hash_table = true;
+    _input_num_rows = 0;
+    _cur_num_rows_returned = 0;
+    _flushing_hash_table = false;
+    COUNTER_UPDATE(_hash_table_flush_counter, 1);
+    return Status::OK();
+}
+
 Status StreamingAggLocalState::_get_results_with_serialized_key(RuntimeState* state,
                                                                 vectorized::Block* block,
                                                                 bool* eos) {
@@ -767,6 +878,13 @@ Status StreamingAggOperatorX::pull(RuntimeState* state, vectorized::Block* block
     SCOPED_PEAK_MEM(&local_state._estimate_memory_usage);
     if (!local_state._pre_aggregated_block->empty()) {
         local_state._pre_aggregated_block->swap(*block);
+    } else if (local_state._flushing_hash_table) {
+        bool flushed = false;
+        RETURN_IF_ERROR(local_state._get_results_with_serialized_key(state, block, &flushed));
+        local_state.make_nullable_output_key(block);
+        if (flushed) {
+            RETURN_IF_ERROR(local_state._reset_hash_table());
+        }
     } else {
         RETURN_IF_ERROR(local_state._get_results_with_serialized_key(state, block, eos));
         local_state.make_nullable_output_key(block);
@@ -794,7 +912,8 @@ Status StreamingAggOperatorX::push(RuntimeState* state, vectorized::Block* in_bl
 
 bool StreamingAggOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state = get_local_state(state);
-    return local_state._pre_aggregated_block->empty() && !local_state._child_eos;
+    return local_state._pre_aggregated_block->empty() && !local_state._flushing_hash_table &&
+           !local_state._child_eos;
 }
 
 #include "common/compile_check_end.h"
@@ -60,6 +60,10 @@ private:
     bool _should_expand_preagg_hash_tables();
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
+    // Whether to pass through the block because the pre-aggregation does not reduce the input,
+    // samples the reduction of the block once in a while to re-enable the pre-aggregation.
+    bool _should_bypass_pre_agg(const vectorized::ColumnRawPtrs& key_columns, uint32_t rows);
+    void _update_pre_agg_reduction(uint32_t rows, size_t new_groups);
 
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
@@ -70,6 +74,8 @@ private:
                                   vectorized::ColumnRawPtrs& key_columns, const uint32_t num_rows);
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     size_t _get_hash_table_size();
+    // Destroy the aggregate states and start over with an empty hash table after it is flushed.
+    Status _reset_hash_table();
 
     RuntimeProfile::Counter* _streaming_agg_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_compute_timer = nullptr;
@@ -86,8 +92,17 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _hash_table_flush_counter = nullptr;
+    RuntimeProfile::Counter* _pre_agg_bypass_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    // The hash table is full and being output by `pull`, the input is blocked until it is reset.
+    bool _flushing_hash_table = false;
+    // The live reduction (input rows / new groups) is below `streaming_agg_bypass_min_reduction`.
+    bool _pre_agg_bypassed = false;
+    double _live_reduction = 0;
+    size_t _reduction_sampled_rows = 0;
+    size_t _bypassed_blocks = 0;
     int64_t _cur_num_rows_returned = 0;
     vectorized::Arena _agg_arena_pool;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
@@ -138,12 +138,84 @@ void ShuffleExchanger::close(SourceInfo&& source_info) {
     bool eos;
     vectorized::Block block;
     _data_queue[source_info.channel_id].set_eos();
-    while (_dequeue_data(source_info.local_state, partitioned_block, &eos, &block,
-                         source_info.channel_id)) {
+    while (_dequeue_shuffled_data(source_info.local_state, partitioned_block, &eos, &block,
+                                  source_info.channel_id)) {
         // do nothing
     }
 }
 
+std::string ShuffleExchanger::data_queue_debug_string(int i) {
+    if (_rings.empty()) {
+        return Exchanger<PartitionedBlock>::data_queue_debug_string(i);
+    }
+    size_t ring_size = 0;
+    for (int sender_id = 0; sender_id < _num_senders; ++sender_id) {
+        ring_size += _ring(sender_id, i).size_approx();
+    }
+    return fmt::format("{}, [ring size approx = {}]",
+                       Exchanger<PartitionedBlock>::data_queue_debug_string(i), ring_size);
+}
+
+void ShuffleExchanger::_enqueue_shuffled_data(int sender_id, int source_id,
+                                              LocalExchangeSinkLocalState* local_state,
+                                              PartitionedBlock&& block) {
+    if (_rings.empty() || _ring(sender_id, source_id).full()) {
+        _enqueue_data_and_set_ready(source_id, local_state, std::move(block));
+        return;
+    }
+    if (_data_queue[source_id].eos) {
+        return;
+    }
+    block.first->record_channel_id(source_id);
+    _ring(sender_id, source_id).push(std::move(block));
+    // Pairs with the fence in `_dequeue_shuffled_data`, either the source sees the block after it
+    // blocks itself or we see the source blocked and wake it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    local_state->_shared_state->set_ready_to_read(source_id);
+}
+
+bool ShuffleExchanger::_try_dequeue_from_rings(LocalExchangeSourceLocalState* local_state,
+                                               PartitionedBlock& block, int channel_id) {
+    // Poll the rings round-robin so that no sender starves.
+    int& next = _next_ring[channel_id];
+    for (int i = 0; i < _num_senders; ++i) {
+        int sender_id = (next + i) % _num_senders;
+        if (_ring(sender_id, channel_id).try_pop(block)) {
+            next = (sender_id + 1) % _num_senders;
+            if (local_state != nullptr) {
+                local_state->_shared_state->sub_mem_usage(channel_id,
+                                                          block.first->_allocated_bytes);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ShuffleExchanger::_dequeue_shuffled_data(LocalExchangeSourceLocalState* local_state,
+                                              PartitionedBlock& block, bool* eos,
+                                              vectorized::Block* data_block, int channel_id) {
+    if (_rings.empty()) {
+        return _dequeue_data(local_state, block, eos, data_block, channel_id);
+    }
+    if (_try_dequeue_from_rings(local_state, block, channel_id) ||
+        _dequeue_data(local_state, block, eos, data_block, channel_id)) {
+        return true;
+    }
+    // `_dequeue_data` either found all the sinks finished or blocked the source. The blocks pushed
+    // to the rings before that are visible now, check the rings again.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_try_dequeue_from_rings(local_state, block, channel_id)) {
+        if (*eos) {
+            *eos = false;
+        } else if (local_state != nullptr) {
+            local_state->_dependency->set_ready();
+        }
+        return true;
+    }
+    return false;
+}
+
 Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block, bool* eos,
                                    Profile&& profile, SourceInfo&& source_info) {
     PartitionedBlock partitioned_block;
@@ -157,14 +229,26 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
             RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block, offset_start,
                                                    offset_start + partitioned_block.second.length));
         } while (mutable_block.rows() < state->batch_size() && !*eos &&
-                 _dequeue_data(source_info.local_state, partitioned_block, eos, block,
-                               source_info.channel_id));
+                 _dequeue_shuffled_data(source_info.local_state, partitioned_block, eos, block,
+                                        source_info.channel_id));
         return Status::OK();
     };
 
-    if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
-                      source_info.channel_id)) {
+    if (_dequeue_shuffled_data(source_info.local_state, partitioned_block, eos, block,
+                               source_info.channel_id)) {
         SCOPED_TIMER(profile.copy_data_timer);
+        if (_is_whole_block(partitioned_block) && block->rows() == 0) {
+            // All the rows of the block belong to this source and no other source references it,
+            // take the columns instead of copying the rows.
+            block->swap(partitioned_block.first->_data_block);
+            mutable_block = vectorized::MutableBlock::build_mutable_block(block);
+            if (mutable_block.rows() < state->batch_size() && !*eos &&
+                _dequeue_shuffled_data(source_info.local_state, partitioned_block, eos, block,
+                                       source_info.channel_id)) {
+                RETURN_IF_ERROR(get_data());
+            }
+            return Status::OK();
+        }
         mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                 block, partitioned_block.first->_data_block);
         RETURN_IF_ERROR(get_data());
@@ -172,6 +256,13 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
     return Status::OK();
 }
 
+bool ShuffleExchanger::_is_whole_block(const PartitionedBlock& partitioned_block) {
+    // The row indices of a partition are in ascending order, so a partition holding all the rows
+    // of the block is the identity selection.
+    return partitioned_block.first.use_count() == 1 &&
+           partitioned_block.second.length == partitioned_block.first->_data_block.rows();
+}
+
 Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                                      vectorized::Block* block, int channel_id,
                                      LocalExchangeSinkLocalState* local_state,
@@ -223,8 +314,8 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         uint32_t size = partition_rows_histogram[it.first + 1] - start;
         if (size > 0) {
             enqueue_rows += size;
-            _enqueue_data_and_set_ready(it.second, local_state,
-                                        {new_block_wrapper, {row_idx, start, size}});
+            _enqueue_shuffled_data(channel_id, it.second, local_state,
+                                   {new_block_wrapper, {row_idx, start, size}});
         }
     }
     if (enqueue_rows != rows) [[unlikely]] {
@@ -436,6 +527,14 @@ Status AdaptivePassthroughExchanger::_passthrough_sink(RuntimeState* state,
     }
     new_block.swap(*in_block);
     auto channel_id = ((*sink_info.channel_id)++) % _num_partitions;
+    if (config::local_exchange_skew_ratio > 0 && sink_info.local_state) {
+        // Choose the less loaded one of the two successive sources.
+        auto next_channel_id = (channel_id + 1) % _num_partitions;
+        if (_queued_bytes(sink_info.local_state, next_channel_id) <
+            _queued_bytes(sink_info.local_state, channel_id)) {
+            channel_id = next_channel_id;
+        }
+    }
     _enqueue_data_and_set_ready(
             channel_id, sink_info.local_state,
             BlockWrapper::create_shared(
@@ -517,6 +616,12 @@ Status AdaptivePassthroughExchanger::sink(RuntimeState* state, vectorized::Block
         return Status::OK();
     }
     if (_is_pass_through) {
+        if (_is_skewed(sink_info.local_state)) {
+            // Split the next blocks by rows into all the sources to drain the hot one.
+            _is_pass_through = false;
+            _total_block = 0;
+            return _shuffle_sink(state, in_block, std::move(sink_info));
+        }
         return _passthrough_sink(state, in_block, std::move(sink_info));
     } else {
         if (++_total_block >= _num_partitions) {
@@ -526,6 +631,34 @@ Status AdaptivePassthroughExchanger::sink(RuntimeState* state, vectorized::Block
     }
 }
 
+int64_t AdaptivePassthroughExchanger::_queued_bytes(LocalExchangeSinkLocalState* local_state,
+                                                    int channel_id) const {
+    auto* counter = local_state->_shared_state->mem_counters[channel_id];
+    // The counter is set when the source is opened.
+    return counter ? counter->value() : 0;
+}
+
+bool AdaptivePassthroughExchanger::_is_skewed(LocalExchangeSinkLocalState* local_state) const {
+    const double ratio = config::local_exchange_skew_ratio;
+    if (ratio <= 0 || local_state == nullptr) {
+        return false;
+    }
+    int64_t max_bytes = 0;
+    int64_t total_bytes = 0;
+    for (int i = 0; i < _num_partitions; i++) {
+        auto bytes = _queued_bytes(local_state, i);
+        max_bytes = std::max(max_bytes, bytes);
+        total_bytes += bytes;
+    }
+    // Small queues are drained soon, only a source holding more than half of its share of the
+    // buffer is considered.
+    if (double(max_bytes) * _num_partitions * 2 <
+        double(local_state->_shared_state->_buffer_mem_limit)) {
+        return false;
+    }
+    return double(max_bytes) > ratio * double(total_bytes) / _num_partitions;
+}
+
 Status AdaptivePassthroughExchanger::get_block(RuntimeState* state, vectorized::Block* block,
                                                bool* eos, Profile&& profile,
                                                SourceInfo&& source_info) {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 
@@ -228,6 +229,55 @@ struct BlockQueue {
 
 using BlockWrapperSPtr = std::shared_ptr<ExchangerBase::BlockWrapper>;
 
+/**
+ * A bounded ring with exactly one producer and one consumer. The producer and the consumer only
+ * write their own index, so the ring is lock-free and the indices do not share a cache line.
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity)
+            : _capacity(capacity), _slots(std::make_unique<T[]>(capacity)) {
+        DCHECK_GT(capacity, 0);
+    }
+
+    // Only called by the producer. A non-full ring stays non-full until the producer pushes.
+    bool full() const {
+        return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire) >=
+               _capacity;
+    }
+
+    void push(T&& item) {
+        DCHECK(!full());
+        auto tail = _tail.load(std::memory_order_relaxed);
+        _slots[tail % _capacity] = std::move(item);
+        _tail.store(tail + 1, std::memory_order_release);
+    }
+
+    // Only called by the consumer.
+    bool try_pop(T& item) {
+        auto head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(_slots[head % _capacity]);
+        // Release the reference held by the slot before the producer could reuse it.
+        _slots[head % _capacity] = T();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size_approx() const {
+        return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_relaxed);
+    }
+
+private:
+    const size_t _capacity;
+    std::unique_ptr<T[]> _slots;
+    alignas(64) std::atomic<size_t> _head = 0;
+    alignas(64) std::atomic<size_t> _tail = 0;
+};
+
 template <typename BlockType>
 class Exchanger : public ExchangerBase {
 public:
@@ -279,6 +329,14 @@ public:
         DCHECK_GT(num_partitions, 0);
         DCHECK_GT(num_sources, 0);
         _partition_rows_histogram.resize(running_sink_operators);
+        if (config::local_shuffle_spsc_ring_capacity > 0) {
+            _rings.resize(static_cast<size_t>(running_sink_operators) * num_sources);
+            for (auto& ring : _rings) {
+                ring = std::make_unique<SpscRing<PartitionedBlock>>(
+                        config::local_shuffle_spsc_ring_capacity);
+            }
+            _next_ring.resize(num_sources, 0);
+        }
     }
     ~ShuffleExchanger() override = default;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
@@ -288,8 +346,23 @@ public:
                      SourceInfo&& source_info) override;
     void close(SourceInfo&& source_info) override;
     ExchangeType get_type() const override { return ExchangeType::HASH_SHUFFLE; }
+    std::string data_queue_debug_string(int i) override;
 
 protected:
+    SpscRing<PartitionedBlock>& _ring(int sender_id, int source_id) {
+        return *_rings[sender_id * _num_sources + source_id];
+    }
+    // Push to the ring of (`sender_id`, `source_id`), or to the shared queue of `source_id` if the
+    // ring is full.
+    void _enqueue_shuffled_data(int sender_id, int source_id,
+                                LocalExchangeSinkLocalState* local_state, PartitionedBlock&& block);
+    bool _try_dequeue_from_rings(LocalExchangeSourceLocalState* local_state,
+                                 PartitionedBlock& block, int channel_id);
+    bool _dequeue_shuffled_data(LocalExchangeSourceLocalState* local_state, PartitionedBlock& block,
+                                bool* eos, vectorized::Block* data_block, int channel_id);
+    // Whether `partitioned_block` selects all the rows of a block that is only referenced here.
+    static bool _is_whole_block(const PartitionedBlock& partitioned_block);
+
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id,
                        LocalExchangeSinkLocalState* local_state,
@@ -297,6 +370,10 @@ protected:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id);
     std::vector<std::vector<uint32_t>> _partition_rows_histogram;
+    // `_num_senders` x `_num_sources` rings, empty if `local_shuffle_spsc_ring_capacity` is 0.
+    std::vector<std::unique_ptr<SpscRing<PartitionedBlock>>> _rings;
+    // The sender whose ring is polled first by each source, only touched by the source.
+    std::vector<int> _next_ring;
 };
 
 class BucketShuffleExchanger final : public ShuffleExchanger {
@@ -381,6 +458,10 @@ private:
     Status _shuffle_sink(RuntimeState* state, vectorized::Block* in_block, SinkInfo&& sink_info);
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, SinkInfo&& sink_info);
+    // Bytes queued for the source `channel_id` and not consumed yet.
+    int64_t _queued_bytes(LocalExchangeSinkLocalState* local_state, int channel_id) const;
+    // Whether the queued bytes of the sources are skewed, see `local_exchange_skew_ratio`.
+    bool _is_skewed(LocalExchangeSinkLocalState* local_state) const;
 
     std::atomic_bool _is_pass_through = false;
     std::atomic_int32_t _total_block = 0;
@@ -0,0 +1,351 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_cpu_profiler.h"
+
+#include <fmt/format.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <ctime>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+#include "common/logging.h"
+#include "common/stack_trace.h"
+#include "util/bit_util.h"
+#include "util/thread.h"
+#include "vec/common/demangle.h"
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+#include "common/symbol_index.h"
+#endif
+
+// Older glibc does not expose the thread id field of `sigevent`.
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+static size_t ring_capacity(size_t capacity) {
+    return BitUtil::RoundUpToPowerOfTwo(std::max<size_t>(capacity, 1));
+}
+
+CpuProfileRingBuffer::CpuProfileRingBuffer(size_t capacity)
+        : _samples(new CpuProfileSample[ring_capacity(capacity)]),
+          _mask(ring_capacity(capacity) - 1) {}
+
+void CpuProfileRingBuffer::drain(std::vector<CpuProfileSample>& samples) {
+    const uint64_t cap = capacity();
+    const uint64_t end = _write_pos.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(_read_pos, end > cap ? end - cap : 0);
+    const size_t old_size = samples.size();
+    for (uint64_t pos = begin; pos < end; ++pos) {
+        samples.push_back(_samples[pos & _mask]);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // The signal handler may have overwritten the oldest slots during the copy, the slot at
+    // `new_end - cap` may be in the middle of being written.
+    const uint64_t new_end = _write_pos.load(std::memory_order_relaxed);
+    const uint64_t valid_begin = new_end + 1 > cap ? new_end + 1 - cap : 0;
+    if (valid_begin > begin) {
+        const auto overwritten = static_cast<ptrdiff_t>(std::min(valid_begin, end) - begin);
+        samples.erase(samples.begin() + static_cast<ptrdiff_t>(old_size),
+                      samples.begin() + static_cast<ptrdiff_t>(old_size) + overwritten);
+    }
+    _read_pos = end;
+}
+
+void FragmentCpuProfile::add(const CpuProfileSample& sample) {
+    ++samples;
+    const auto leaf = sample.frames.begin();
+    Stack stack {sample.tag.scope, sample.tag.node_id,
+                 std::vector<void*>(std::make_reverse_iterator(leaf + sample.depth),
+                                    std::make_reverse_iterator(leaf))};
+    if (auto it = stacks.find(stack); it != stacks.end()) {
+        ++it->second;
+    } else if (stacks.size() < static_cast<size_t>(
+                                       std::max(config::pipeline_cpu_profile_max_stacks, 0))) {
+        stacks.emplace(std::move(stack), 1);
+    } else {
+        ++truncated_samples;
+    }
+}
+
+// Keep the qualified name of a function and drop its parameters, which are most of the length of
+// a demangled C++ symbol. ';' separates the frames in the collapsed format, so it is replaced.
+static std::string strip_parameters(std::string name) {
+    static constexpr std::string_view anonymous_namespace = "(anonymous namespace)";
+    static constexpr std::string_view call_operator = "operator()";
+    int depth = 0;
+    for (size_t i = 0; i < name.size(); ++i) {
+        switch (name[i]) {
+        case '<':
+        case '{':
+            ++depth;
+            break;
+        case '>':
+        case '}':
+            --depth;
+            break;
+        case ';':
+            name[i] = ':';
+            break;
+        case '(':
+            if (depth > 0) {
+                break;
+            }
+            if (std::string_view(name).substr(i).starts_with(anonymous_namespace)) {
+                i += anonymous_namespace.size() - 1;
+                break;
+            }
+            // The '(' of "operator()".
+            if (const size_t begin = i + 2; begin >= call_operator.size() &&
+                std::string_view(name).substr(begin - call_operator.size(), call_operator.size()) ==
+                        call_operator) {
+                ++i;
+                break;
+            }
+            name.resize(i);
+            return name;
+        default:
+            break;
+        }
+    }
+    return name;
+}
+
+std::string FragmentCpuProfile::to_folded(
+        const std::function<std::string(CpuProfileScope, int32_t)>& operator_name) const {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index_ptr = SymbolIndex::instance();
+    const SymbolIndex& symbol_index = *symbol_index_ptr;
+#endif
+    std::unordered_map<const void*, std::string> frame_names;
+    auto frame_name = [&](const void* address) -> const std::string& {
+        auto [it, inserted] = frame_names.try_emplace(address);
+        if (inserted) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+            // Except the leaf, the frames are return addresses, look up the call before them.
+            const auto* symbol = symbol_index.findSymbol(static_cast<const char*>(address) - 1);
+            it->second = symbol != nullptr ? strip_parameters(demangle(symbol->name))
+                                           : fmt::format("{}", address);
+#else
+            it->second = fmt::format("{}", address);
+#endif
+        }
+        return it->second;
+    };
+
+    std::map<std::pair<CpuProfileScope, int32_t>, std::string> operator_names;
+    fmt::memory_buffer out;
+    for (const auto& [stack, count] : stacks) {
+        auto op = operator_names.find({stack.scope, stack.node_id});
+        if (op == operator_names.end()) {
+            op = operator_names
+                         .emplace(std::make_pair(stack.scope, stack.node_id),
+                                  operator_name(stack.scope, stack.node_id))
+                         .first;
+        }
+        fmt::format_to(out, "{}", op->second);
+        for (const void* frame : stack.frames) {
+            fmt::format_to(out, ";{}", frame_name(frame));
+        }
+        fmt::format_to(out, " {}\n", count);
+    }
+    if (truncated_samples > 0) {
+        fmt::format_to(out, "[truncated] {}\n", truncated_samples);
+    }
+    return fmt::to_string(out);
+}
+
+void PipelineCpuProfiler::_signal_handler(int /*sig*/, siginfo_t* /*info*/, void* context) {
+    auto* buffer = _thread_buffer;
+    const CpuProfileTag tag = cpu_profile_tag;
+    if (buffer == nullptr || context == nullptr || tag.scope == CpuProfileScope::NONE) {
+        return;
+    }
+    const auto saved_errno = errno;
+    const StackTrace stack_trace(*reinterpret_cast<const ucontext_t*>(context));
+    const auto& frames = stack_trace.getFramePointers();
+    auto* sample = buffer->begin_append();
+    sample->tag = tag;
+    uint32_t depth = 0;
+    // Keep the frames closest to the leaf if the stack is too deep, the operator is in the tag.
+    for (size_t i = stack_trace.getOffset();
+         i < stack_trace.getSize() && depth < CpuProfileSample::MAX_DEPTH; ++i) {
+        sample->frames[depth++] = frames[i];
+    }
+    sample->depth = depth;
+    buffer->end_append();
+    errno = saved_errno;
+}
+
+static Status install_signal_handler(void (*handler)(int, siginfo_t*, void*)) {
+    struct sigaction sa {};
+    sa.sa_sigaction = handler;
+    // Restart the syscalls interrupted in the middle, e.g. a read of a scanner.
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+        return Status::InternalError("failed to install the SIGPROF handler, errno={}", errno);
+    }
+    return Status::OK();
+}
+
+Status PipelineCpuProfiler::start() {
+    if (!enabled() || _started) {
+        return Status::OK();
+    }
+    // Unwind once out of the signal handler, the unwinder may initialize itself lazily.
+    [[maybe_unused]] StackTrace warm_up;
+    RETURN_IF_ERROR(install_signal_handler(_signal_handler));
+    RETURN_IF_ERROR(Thread::create(
+            "PipelineCpuProfiler", "cpu_profile_drain", [this]() { _drain_loop(); },
+            &_drain_thread));
+    _started = true;
+    LOG(INFO) << "pipeline cpu profiler started, interval="
+              << config::pipeline_cpu_profile_interval_ms << "ms";
+    return Status::OK();
+}
+
+void PipelineCpuProfiler::stop() {
+    if (!_started.exchange(false)) {
+        return;
+    }
+    _stop_latch.count_down();
+    if (_drain_thread) {
+        _drain_thread->join();
+    }
+}
+
+void PipelineCpuProfiler::restore_signal_handler() {
+    if (!_started) {
+        return;
+    }
+    auto st = install_signal_handler(_signal_handler);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to restore the pipeline cpu profiler: " << st;
+    }
+}
+
+void PipelineCpuProfiler::_register_current_thread() {
+    if (!_started.load(std::memory_order_acquire)) {
+        return;
+    }
+    _thread_registered = true;
+
+    sigevent sev {};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGPROF;
+    sev.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+    timer_t timer_id;
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &timer_id) != 0) {
+        LOG(WARNING) << "failed to create the cpu profile timer of thread "
+                     << Thread::current_thread_id() << ", errno=" << errno;
+        return;
+    }
+    const int interval_ms = std::max(config::pipeline_cpu_profile_interval_ms, 1);
+    itimerspec spec {};
+    spec.it_interval.tv_sec = interval_ms / 1000;
+    spec.it_interval.tv_nsec = static_cast<long>(interval_ms % 1000) * 1000000L;
+    spec.it_value = spec.it_interval;
+
+    auto buffer = std::make_shared<CpuProfileRingBuffer>(
+            static_cast<size_t>(std::max(config::pipeline_cpu_profile_buffer_size, 1)));
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _buffers.push_back(buffer);
+    }
+    _thread_buffer = buffer.get();
+
+    // Delete the timer when the thread exits, the buffer is released by the draining thread
+    // after its last samples are drained.
+    struct ThreadTimer {
+        timer_t id;
+        std::shared_ptr<CpuProfileRingBuffer> buffer;
+
+        ~ThreadTimer() {
+            _thread_buffer = nullptr;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            timer_delete(id);
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    };
+    thread_local ThreadTimer thread_timer {timer_id, buffer};
+
+    if (timer_settime(timer_id, 0, &spec, nullptr) != 0) {
+        LOG(WARNING) << "failed to arm the cpu profile timer of thread "
+                     << Thread::current_thread_id() << ", errno=" << errno;
+    }
+}
+
+void PipelineCpuProfiler::begin_fragment(const TUniqueId& query_id, int32_t fragment_id) {
+    if (!_started) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_lock);
+    _fragments.try_emplace({query_id.hi, query_id.lo, fragment_id});
+}
+
+FragmentCpuProfile PipelineCpuProfiler::end_fragment(const TUniqueId& query_id,
+                                                     int32_t fragment_id) {
+    FragmentCpuProfile profile;
+    std::lock_guard<std::mutex> l(_lock);
+    auto it = _fragments.find({query_id.hi, query_id.lo, fragment_id});
+    if (it == _fragments.end()) {
+        return profile;
+    }
+    // Take the samples still in the rings.
+    _drain_locked();
+    profile = std::move(it->second);
+    _fragments.erase(it);
+    return profile;
+}
+
+void PipelineCpuProfiler::_drain_loop() {
+    while (!_stop_latch.wait_for(std::chrono::milliseconds(100))) {
+        std::lock_guard<std::mutex> l(_lock);
+        _drain_locked();
+    }
+}
+
+void PipelineCpuProfiler::_drain_locked() {
+    for (auto it = _buffers.begin(); it != _buffers.end();) {
+        // Read it before draining, so that the samples appended before retiring are drained.
+        const bool retired = (*it)->retired.load(std::memory_order_acquire);
+        _drained.clear();
+        (*it)->drain(_drained);
+        for (const auto& sample : _drained) {
+            auto fragment = _fragments.find(
+                    {sample.tag.query_id_hi, sample.tag.query_id_lo, sample.tag.fragment_id});
+            if (fragment != _fragments.end()) {
+                fragment->second.add(sample);
+            }
+        }
+        it = retired ? _buffers.erase(it) : it + 1;
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <array>
+#include <atomic>
+#include <compare>
+#include <csignal>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "util/countdown_latch.h"
+
+namespace doris {
+class Thread;
+} // namespace doris
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+enum class CpuProfileScope : uint8_t {
+    NONE,     // the thread is not working for a fragment, samples are dropped
+    TASK,     // a pipeline task, outside of any operator
+    OPERATOR, // `get_block` of an operator
+    SINK,     // `sink` of a sink operator
+    SCANNER,  // a scanner running for a scan operator
+};
+
+// What the current thread is working on. Read by the SIGPROF handler of the thread, so it only
+// has plain fields and is updated by the scoped guards below.
+struct CpuProfileTag {
+    int64_t query_id_hi = 0;
+    int64_t query_id_lo = 0;
+    int32_t fragment_id = 0;
+    int32_t node_id = -1;
+    CpuProfileScope scope = CpuProfileScope::NONE;
+};
+
+inline thread_local constinit CpuProfileTag cpu_profile_tag;
+
+// The tag is disabled while it is being changed, so that a signal in the middle of the change
+// drops the sample instead of attributing it to a mix of the old and new fragment.
+inline void set_cpu_profile_tag(const CpuProfileTag& tag) {
+    cpu_profile_tag.scope = CpuProfileScope::NONE;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    cpu_profile_tag.query_id_hi = tag.query_id_hi;
+    cpu_profile_tag.query_id_lo = tag.query_id_lo;
+    cpu_profile_tag.fragment_id = tag.fragment_id;
+    cpu_profile_tag.node_id = tag.node_id;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    cpu_profile_tag.scope = tag.scope;
+}
+
+// One stack sampled by the SIGPROF handler, the leaf frame first.
+struct CpuProfileSample {
+    static constexpr size_t MAX_DEPTH = 32;
+
+    CpuProfileTag tag;
+    uint32_t depth;
+    std::array<void*, MAX_DEPTH> frames;
+};
+
+// A bounded ring of samples written by the signal handler of a single thread. The newest samples
+// overwrite the oldest ones, which are lost if the ring is not drained in time.
+class CpuProfileRingBuffer {
+public:
+    explicit CpuProfileRingBuffer(size_t capacity);
+
+    // Only the owner thread calls it, from its signal handler.
+    CpuProfileSample* begin_append() {
+        return &_samples[_write_pos.load(std::memory_order_relaxed) & _mask];
+    }
+    void end_append() {
+        _write_pos.store(_write_pos.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_release);
+    }
+
+    // Move the samples appended since the last drain to `samples`. Not thread safe, there must be
+    // only one drainer.
+    void drain(std::vector<CpuProfileSample>& samples);
+
+    size_t capacity() const { return _mask + 1; }
+
+    // Set when the owner thread exits, the buffer is released after the next drain.
+    std::atomic<bool> retired = false;
+
+private:
+    std::unique_ptr<CpuProfileSample[]> _samples;
+    const size_t _mask;
+    std::atomic<uint64_t> _write_pos = 0;
+    uint64_t _read_pos = 0;
+};
+
+// The samples of one fragment, folded by operator and stack.
+struct FragmentCpuProfile {
+    struct Stack {
+        CpuProfileScope scope;
+        int32_t node_id;
+        // The root frame first.
+        std::vector<void*> frames;
+
+        auto operator<=>(const Stack&) const = default;
+    };
+
+    std::map<Stack, int64_t> stacks;
+    int64_t samples = 0;
+    // Samples not kept because the fragment already has `pipeline_cpu_profile_max_stacks` stacks.
+    int64_t truncated_samples = 0;
+
+    void add(const CpuProfileSample& sample);
+
+    // The collapsed stack format of flame graph tools, one "frame;frame;...;frame count" line per
+    // stack. The root frame of each stack is the operator, named by `operator_name`.
+    std::string to_folded(
+            const std::function<std::string(CpuProfileScope, int32_t)>& operator_name) const;
+};
+
+// Samples the CPU stacks of the threads running pipeline tasks and scanners, and folds them per
+// fragment and operator. Each thread arms a timer on its own CPU time clock, so idle threads cost
+// nothing and busy threads are sampled every `pipeline_cpu_profile_interval_ms` of CPU time. The
+// signal handler only copies the stack into a per-thread ring, a background thread drains the
+// rings into the fragments registered by `begin_fragment`.
+class PipelineCpuProfiler {
+public:
+    static PipelineCpuProfiler* instance() {
+        static PipelineCpuProfiler profiler;
+        return &profiler;
+    }
+
+    static bool enabled() { return config::enable_pipeline_cpu_profile; }
+
+    // Install the SIGPROF handler and start the draining thread.
+    Status start();
+    void stop();
+
+    // Install the SIGPROF handler again, after another profiler (e.g. gperftools started by the
+    // pprof action) replaced it.
+    void restore_signal_handler();
+
+    // Arm the CPU time timer of the current thread if it is not armed yet.
+    static void register_current_thread() {
+        if (enabled() && !_thread_registered) [[unlikely]] {
+            instance()->_register_current_thread();
+        }
+    }
+
+    void begin_fragment(const TUniqueId& query_id, int32_t fragment_id);
+    // Stop collecting samples of the fragment and return what has been collected.
+    FragmentCpuProfile end_fragment(const TUniqueId& query_id, int32_t fragment_id);
+
+private:
+    PipelineCpuProfiler() : _stop_latch(1) {}
+
+    using FragmentKey = std::tuple<int64_t, int64_t, int32_t>;
+
+    static void _signal_handler(int sig, siginfo_t* info, void* context);
+
+    void _register_current_thread();
+    void _drain_loop();
+    // Must hold `_lock`.
+    void _drain_locked();
+
+    static inline thread_local constinit bool _thread_registered = false;
+    static inline thread_local constinit CpuProfileRingBuffer* _thread_buffer = nullptr;
+
+    std::atomic<bool> _started = false;
+    CountDownLatch _stop_latch;
+    std::shared_ptr<Thread> _drain_thread;
+
+    std::mutex _lock;
+    std::vector<std::shared_ptr<CpuProfileRingBuffer>> _buffers;
+    std::map<FragmentKey, FragmentCpuProfile> _fragments;
+    std::vector<CpuProfileSample> _drained;
+};
+
+// Tag the samples of the current thread with a fragment, restored at the end of the scope.
+class ScopedCpuProfileFragment {
+public:
+    ScopedCpuProfileFragment(const TUniqueId& query_id, int32_t fragment_id,
+                             CpuProfileScope scope = CpuProfileScope::TASK, int32_t node_id = -1)
+            : _saved(cpu_profile_tag) {
+        PipelineCpuProfiler::register_current_thread();
+        set_cpu_profile_tag({query_id.hi, query_id.lo, fragment_id, node_id, scope});
+    }
+    ~ScopedCpuProfileFragment() { set_cpu_profile_tag(_saved); }
+
+private:
+    const CpuProfileTag _saved;
+};
+
+// Tag the samples of the current thread with an operator of the current fragment.
+class ScopedCpuProfileOperator {
+public:
+    ScopedCpuProfileOperator(int32_t node_id, CpuProfileScope scope)
+            : _saved_node_id(cpu_profile_tag.node_id), _saved_scope(cpu_profile_tag.scope) {
+        if (_saved_scope != CpuProfileScope::NONE) {
+            _set(node_id, scope);
+        }
+    }
+    ~ScopedCpuProfileOperator() {
+        if (_saved_scope != CpuProfileScope::NONE) {
+            _set(_saved_node_id, _saved_scope);
+        }
+    }
+
+private:
+    static void _set(int32_t node_id, CpuProfileScope scope) {
+        cpu_profile_tag.scope = CpuProfileScope::NONE;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        cpu_profile_tag.node_id = node_id;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        cpu_profile_tag.scope = scope;
+    }
+
+    const int32_t _saved_node_id;
+    const CpuProfileScope _saved_scope;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_event_trace.h"
+
+#include <fmt/format.h>
+#include <pthread.h>
+
+#include <algorithm>
+
+#include "util/bit_util.h"
+#include "util/thread.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+static size_t ring_capacity(size_t capacity) {
+    return BitUtil::RoundUpToPowerOfTwo(std::max<size_t>(capacity, 1));
+}
+
+PipelineTraceRingBuffer::PipelineTraceRingBuffer(size_t capacity, int64_t thread_id,
+                                                 std::string thread_name)
+        : _events(new PipelineTraceEvent[ring_capacity(capacity)]),
+          _mask(ring_capacity(capacity) - 1),
+          _thread_id(thread_id),
+          _thread_name(std::move(thread_name)) {}
+
+void PipelineTraceRingBuffer::snapshot(const TUniqueId* query_id,
+                                       std::vector<PipelineTraceEvent>& events) const {
+    const uint64_t cap = capacity();
+    const uint64_t end = _write_pos.load(std::memory_order_acquire);
+    const uint64_t begin =
+            std::max(_read_begin.load(std::memory_order_relaxed), end > cap ? end - cap : 0);
+    std::vector<PipelineTraceEvent> copied;
+    copied.reserve(end - begin);
+    for (uint64_t pos = begin; pos < end; ++pos) {
+        copied.push_back(_events[pos & _mask]);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // The writer may have overwritten the oldest slots during the copy, the slot at
+    // `new_end - cap` may be in the middle of being written.
+    const uint64_t new_end = _write_pos.load(std::memory_order_relaxed);
+    const uint64_t valid_begin = new_end + 1 > cap ? new_end + 1 - cap : 0;
+    for (uint64_t pos = std::max(begin, valid_begin); pos < end; ++pos) {
+        const auto& event = copied[pos - begin];
+        if (query_id == nullptr ||
+            (event.query_id_hi == query_id->hi && event.query_id_lo == query_id->lo)) {
+            events.push_back(event);
+        }
+    }
+}
+
+int64_t PipelineEventTracer::now() {
+    return MonotonicNanos();
+}
+
+PipelineTraceRingBuffer* PipelineEventTracer::_local_buffer() {
+    thread_local std::shared_ptr<PipelineTraceRingBuffer> buffer;
+    if (!buffer) [[unlikely]] {
+        char name[16] = {0};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        buffer = std::make_shared<PipelineTraceRingBuffer>(
+                config::pipeline_event_trace_buffer_size, Thread::current_thread_id(), name);
+        std::lock_guard<std::mutex> l(_buffers_lock);
+        _buffers.push_back(buffer);
+    }
+    return buffer.get();
+}
+
+void PipelineEventTracer::clear() {
+    std::lock_guard<std::mutex> l(_buffers_lock);
+    for (auto& buffer : _buffers) {
+        buffer->clear();
+    }
+}
+
+static const char* event_name(PipelineTraceEventType type) {
+    switch (type) {
+    case PipelineTraceEventType::EXECUTE:
+        return "Execute";
+    case PipelineTraceEventType::BLOCK:
+        return "Block";
+    case PipelineTraceEventType::DEPENDENCY_WAIT:
+        return "DependencyWait";
+    case PipelineTraceEventType::YIELD:
+        return "Yield";
+    case PipelineTraceEventType::STEAL:
+        return "Steal";
+    }
+    return "Unknown";
+}
+
+std::string PipelineEventTracer::to_chrome_trace_json(const TUniqueId* query_id) const {
+    std::vector<std::shared_ptr<PipelineTraceRingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> l(_buffers_lock);
+        buffers = _buffers;
+    }
+
+    fmt::memory_buffer out;
+    fmt::format_to(out, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    fmt::format_to(out,
+                   "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,"
+                   "\"args\":{{\"name\":\"doris_be\"}}}}");
+    std::vector<PipelineTraceEvent> events;
+    for (const auto& buffer : buffers) {
+        events.clear();
+        buffer->snapshot(query_id, events);
+        if (events.empty()) {
+            continue;
+        }
+        // Thread names are set by the thread pools and only contain printable characters.
+        fmt::format_to(out,
+                       ",{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},"
+                       "\"args\":{{\"name\":\"{}\"}}}}",
+                       buffer->thread_id(), buffer->thread_name());
+        for (const auto& event : events) {
+            TUniqueId id;
+            id.__set_hi(event.query_id_hi);
+            id.__set_lo(event.query_id_lo);
+            fmt::format_to(out, ",{{\"name\":\"{}\",\"cat\":\"pipeline\",\"pid\":0,\"tid\":{},",
+                           event_name(event.type), buffer->thread_id());
+            if (event.end_ns > event.begin_ns) {
+                fmt::format_to(out, "\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},",
+                               double(event.begin_ns) / 1000.0,
+                               double(event.end_ns - event.begin_ns) / 1000.0);
+            } else {
+                fmt::format_to(out, "\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},",
+                               double(event.begin_ns) / 1000.0);
+            }
+            fmt::format_to(out,
+                           "\"args\":{{\"query_id\":\"{}\",\"pipeline_id\":{},\"task_id\":{},"
+                           "\"core_id\":{}",
+                           print_id(id), event.pipeline_id, event.task_id, event.core_id);
+            switch (event.type) {
+            case PipelineTraceEventType::BLOCK:
+            case PipelineTraceEventType::DEPENDENCY_WAIT:
+                fmt::format_to(out, ",\"dependency_id\":{}", event.arg);
+                break;
+            case PipelineTraceEventType::STEAL:
+                fmt::format_to(out, ",\"to_core_id\":{}", event.arg);
+                break;
+            default:
+                break;
+            }
+            fmt::format_to(out, "}}}}");
+        }
+    }
+    fmt::format_to(out, "]}}");
+    return fmt::to_string(out);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+enum class PipelineTraceEventType : uint8_t {
+    EXECUTE,         // span, one time slice of a task on a worker
+    BLOCK,           // instant, the task is blocked by a dependency
+    DEPENDENCY_WAIT, // span, from the task being blocked to being woken up
+    YIELD,           // instant, the task used up its time slice
+    STEAL,           // instant, the task is stolen from the queue of another core
+};
+
+// One scheduling event of a pipeline task. Trivially copyable so that it can be copied out of the
+// ring buffer while the owner thread keeps writing.
+struct PipelineTraceEvent {
+    int64_t begin_ns;
+    int64_t end_ns;
+    int64_t query_id_hi;
+    int64_t query_id_lo;
+    uint32_t pipeline_id;
+    uint32_t task_id;
+    // The core the task runs on, or last ran on if it is not running.
+    int32_t core_id;
+    // The dependency id for `BLOCK` and `DEPENDENCY_WAIT`, the core stealing the task for `STEAL`.
+    int32_t arg;
+    PipelineTraceEventType type;
+};
+
+// A bounded ring of events written by a single thread. The newest events overwrite the oldest
+// ones. Readers snapshot the ring without blocking the writer and drop the slots that may have
+// been overwritten during the copy.
+class PipelineTraceRingBuffer {
+public:
+    PipelineTraceRingBuffer(size_t capacity, int64_t thread_id, std::string thread_name);
+
+    void append(const PipelineTraceEvent& event) {
+        auto pos = _write_pos.load(std::memory_order_relaxed);
+        _events[pos & _mask] = event;
+        _write_pos.store(pos + 1, std::memory_order_release);
+    }
+
+    // Append the events of `query_id` (all the events if it is nullptr) to `events`.
+    void snapshot(const TUniqueId* query_id, std::vector<PipelineTraceEvent>& events) const;
+
+    void clear() { _read_begin.store(_write_pos.load(std::memory_order_acquire)); }
+
+    size_t capacity() const { return _mask + 1; }
+    int64_t thread_id() const { return _thread_id; }
+    const std::string& thread_name() const { return _thread_name; }
+
+private:
+    std::unique_ptr<PipelineTraceEvent[]> _events;
+    const size_t _mask;
+    std::atomic<uint64_t> _write_pos = 0;
+    // Events before this position are cleared.
+    std::atomic<uint64_t> _read_begin = 0;
+    const int64_t _thread_id;
+    const std::string _thread_name;
+};
+
+// Records the scheduling events of pipeline tasks into per-thread ring buffers and exports them
+// as Chrome trace / Perfetto JSON. Recording is enabled by `enable_pipeline_event_trace`, the
+// disabled path is a single config check.
+class PipelineEventTracer {
+public:
+    static PipelineEventTracer* instance() {
+        static PipelineEventTracer tracer;
+        return &tracer;
+    }
+
+    static bool enabled() { return config::enable_pipeline_event_trace; }
+
+    static int64_t now();
+
+    void record(const PipelineTraceEvent& event) { _local_buffer()->append(event); }
+
+    // Chrome trace JSON of the events of `query_id`, or of all the queries if it is nullptr.
+    std::string to_chrome_trace_json(const TUniqueId* query_id) const;
+
+    // Drop the recorded events.
+    void clear();
+
+private:
+    PipelineEventTracer() = default;
+
+    PipelineTraceRingBuffer* _local_buffer();
+
+    mutable std::mutex _buffers_lock;
+    // Buffers are kept after their threads exit so that the events are still exportable, the
+    // executor threads are long lived so the number of buffers is bounded.
+    std::vector<std::shared_ptr<PipelineTraceRingBuffer>> _buffers;
+};
+
+inline void trace_pipeline_event(PipelineTraceEventType type, const TUniqueId& query_id,
+                                 uint32_t pipeline_id, uint32_t task_id, int core_id, int arg,
+                                 int64_t begin_ns, int64_t end_ns) {
+    PipelineEventTracer::instance()->record({begin_ns, end_ns, query_id.hi, query_id.lo,
+                                             pipeline_id, task_id, core_id, arg, type});
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
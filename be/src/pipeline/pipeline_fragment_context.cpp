@@ -100,6 +100,7 @@
 #include "pipeline/exec/union_source_operator.h"
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "pipeline/local_exchange/local_exchanger.h"
 #include "pipeline/task_scheduler.h"
 #include "pipeline_task.h"
@@ -109,10 +110,13 @@
 #include "runtime/stream_load/new_load_stream_mgr.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_context.h"
+#include "runtime/workload_management/resource_context.h"
 #include "runtime_filter/runtime_filter_mgr.h"
 #include "service/backend_options.h"
 #include "util/countdown_latch.h"
 #include "util/debug_util.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/common/sort/heap_sorter.h"
 #include "vec/common/sort/topn_sorter.h"
@@ -133,12 +137,15 @@ PipelineFragmentContext::PipelineFragmentContext(
           _is_report_on_cancel(true),
           _report_status_cb(report_status_cb) {
     _fragment_watcher.start();
+    PipelineCpuProfiler::instance()->begin_fragment(_query_id, _fragment_id);
 }
 
 PipelineFragmentContext::~PipelineFragmentContext() {
     LOG_INFO("PipelineFragmentContext::~PipelineFragmentContext")
             .tag("query_id", print_id(_query_id))
             .tag("fragment_id", _fragment_id);
+    // Drop the samples if the fragment is not closed normally.
+    static_cast<void>(PipelineCpuProfiler::instance()->end_fragment(_query_id, _fragment_id));
     // The memory released by the query end is recorded in the query mem tracker.
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_query_ctx->query_mem_tracker());
     auto st = _query_ctx->exec_status();
@@ -1196,6 +1203,7 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
         op.reset(new OlapScanOperatorX(
                 pool, tnode, next_operator_id(), descs, _num_instances,
                 enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {}));
+        op->cast<OlapScanOperatorX>().set_query_cache_allow_delta(_query_cache_allow_delta);
         RETURN_IF_ERROR(cur_pipe->add_operator(
                 op, request.__isset.parallel_instances ? request.parallel_instances : 0));
         fe_with_old_version = !tnode.__isset.is_serial_operator;
@@ -1259,6 +1267,9 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
         }
         bool need_create_cache_op =
                 enable_query_cache && tnode.node_id == request.fragment.query_cache_param.node_id;
+        if (need_create_cache_op) {
+            _query_cache_allow_delta = !tnode.agg_node.need_finalize && tnode.limit < 0;
+        }
         auto create_query_cache_operator = [&](PipelinePtr& new_pipe) {
             auto cache_node_id = request.local_params[0].per_node_scan_ranges.begin()->first;
             auto cache_source_id = next_operator_id();
@@ -1785,6 +1796,8 @@ void PipelineFragmentContext::_close_fragment_instance() {
     }
     Defer defer_op {[&]() { _is_fragment_instance_closed = true; }};
     _fragment_level_profile->total_time_counter()->update(_fragment_watcher.elapsed_time());
+    _attach_cpu_profile();
+    _attach_io_ledger();
     static_cast<void>(send_report(true));
     // Print profile content in info log is a tempoeray solution for stream load and external_connector.
     // Since stream load does not have someting like coordinator on FE, so
@@ -1822,6 +1835,47 @@ void PipelineFragmentContext::_close_fragment_instance() {
     _exec_env->fragment_mgr()->remove_pipeline_context({_query_id, _fragment_id});
 }
 
+void PipelineFragmentContext::_attach_cpu_profile() {
+    auto cpu_profile = PipelineCpuProfiler::instance()->end_fragment(_query_id, _fragment_id);
+    if (cpu_profile.samples == 0 || !_runtime_state->enable_profile() ||
+        static_cast<int64_t>(_fragment_watcher.elapsed_time()) <
+                config::pipeline_cpu_profile_min_fragment_time_s * NANOS_PER_SEC) {
+        return;
+    }
+    // The source and sink operators of a plan node share its id.
+    std::map<std::pair<CpuProfileScope, int32_t>, std::string> operator_names;
+    for (const auto& pipeline : _pipelines) {
+        for (const auto& op : pipeline->operators()) {
+            operator_names.try_emplace({CpuProfileScope::OPERATOR, op->node_id()}, op->get_name());
+        }
+        operator_names.try_emplace({CpuProfileScope::SINK, pipeline->sink()->node_id()},
+                                   pipeline->sink()->get_name());
+    }
+    auto operator_name = [&](CpuProfileScope scope, int32_t node_id) -> std::string {
+        if (scope == CpuProfileScope::TASK) {
+            return "PipelineTask";
+        }
+        const bool scanner = scope == CpuProfileScope::SCANNER;
+        auto it = operator_names.find({scanner ? CpuProfileScope::OPERATOR : scope, node_id});
+        return fmt::format("{}(id={}){}", it != operator_names.end() ? it->second : "UNKNOWN",
+                           node_id, scanner ? " Scanner" : "");
+    };
+    _fragment_level_profile->add_info_string("CpuFlameGraph",
+                                             cpu_profile.to_folded(operator_name));
+    COUNTER_SET(ADD_COUNTER(_fragment_level_profile, "CpuProfileSamples", TUnit::UNIT),
+                cpu_profile.samples);
+}
+
+void PipelineFragmentContext::_attach_io_ledger() {
+    if (!IOLedger::enabled() || !_runtime_state->enable_profile()) {
+        return;
+    }
+    auto snapshot = _query_ctx->resource_ctx()->io_context()->io_ledger()->snapshot(
+            static_cast<size_t>(std::max(config::query_io_ledger_top_files, 0)));
+    auto* profile = _fragment_level_profile->create_child("QueryIOLedger");
+    snapshot.to_profile(profile);
+}
+
 void PipelineFragmentContext::decrement_running_task(PipelineId pipeline_id) {
     // If all tasks of this pipeline has been closed, upstream tasks is never needed, and we just make those runnable here
     DCHECK(_pip_id_to_pipeline.contains(pipeline_id));
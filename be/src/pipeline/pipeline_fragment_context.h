@@ -173,6 +173,10 @@ private:
     Status _build_pipeline_tasks(const doris::TPipelineFragmentParams& request,
                                  ThreadPool* thread_pool);
     void _close_fragment_instance();
+    // Attach the CPU flame graph of the fragment to its profile if it ran long enough.
+    void _attach_cpu_profile();
+    // Attach the reads of the query on this backend so far, per storage tier.
+    void _attach_io_ledger();
     void _init_next_report_time();
 
     // Id of this query
@@ -323,6 +327,9 @@ private:
     // Total instance num running on all BEs
     int _total_instances = -1;
     bool _require_bucket_distribution = false;
+    // Whether the query cache node is a partial aggregation without limit, see
+    // OlapScanOperatorX::set_query_cache_allow_delta.
+    bool _query_cache_allow_delta = false;
 };
 } // namespace pipeline
 } // namespace doris
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include "pipeline/exec/operator.h"
 #include "pipeline/exec/scan_operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/task_queue.h"
 #include "pipeline/task_scheduler.h"
@@ -385,6 +386,7 @@ Status PipelineTask::execute(bool* done) {
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
     SCOPED_ATTACH_TASK(_state);
+    ScopedCpuProfileFragment cpu_profile_fragment(_query_id, fragment_context->get_fragment_id());
     Defer running_defer {[&]() {
         int64_t delta_cpu_time = cpu_time_stop_watch.elapsed_time();
         _task_cpu_timer->update(delta_cpu_time);
@@ -398,15 +400,16 @@ Status PipelineTask::execute(bool* done) {
             THROW_IF_ERROR(_sink->terminate(_state));
             _eos = true;
             *done = true;
-        } else if (_eos && !_spilling &&
+        } else if (_eos && !_spilling && !_sink_yielded &&
                    (fragment_context->is_canceled() || !_is_pending_finish())) {
             *done = true;
         }
+        _state->set_time_slice_deadline(0);
     }};
     const auto query_id = _state->query_id();
     // If this task is already EOS and block is empty (which means we already output all blocks),
     // just return here.
-    if (_eos && !_spilling) {
+    if (_eos && !_spilling && !_sink_yielded) {
         return Status::OK();
     }
     // If this task is blocked by a spilling request and waken up immediately, the spilling
@@ -414,7 +417,7 @@ Status PipelineTask::execute(bool* done) {
     if (!_block->empty()) {
         LOG(INFO) << "Query: " << print_id(query_id) << " has pending block, size: "
                   << PrettyPrinter::print_bytes(_block->allocated_bytes());
-        DCHECK(_spilling);
+        DCHECK(_spilling || _sink_yielded);
     }
 
     SCOPED_TIMER(_task_profile->total_time_counter());
@@ -451,11 +454,16 @@ Status PipelineTask::execute(bool* done) {
         RETURN_IF_ERROR(_open());
     }
 
+    if (config::enable_pipeline_task_cooperative_yield) {
+        _state->set_time_slice_deadline(MonotonicNanos() +
+                                         static_cast<int64_t>(_exec_time_slice) - time_spent);
+    }
     while (!fragment_context->is_canceled()) {
         SCOPED_RAW_TIMER(&time_spent);
         Defer defer {[&]() {
-            // If this run is pended by a spilling request, the block will be output in next run.
-            if (!_spilling) {
+            // If this run is pended by a spilling request or the sink yielded in the middle of
+            // the block, the block will be output in next run.
+            if (!_spilling && !_sink_yielded) {
                 _block->clear_column_data(_root->row_desc().num_materialized_slots());
             }
         }};
@@ -473,6 +481,10 @@ Status PipelineTask::execute(bool* done) {
 
         if (time_spent > _exec_time_slice) {
             COUNTER_UPDATE(_yield_counts, 1);
+            if (PipelineEventTracer::enabled()) {
+                auto now = PipelineEventTracer::now();
+                trace_event(PipelineTraceEventType::YIELD, 0, now, now);
+            }
             break;
         }
         auto* block = _block.get();
@@ -495,7 +507,7 @@ Status PipelineTask::execute(bool* done) {
         auto workload_group = _state->workload_group();
         // If last run is pended by a spilling request, `_block` is produced with some rows in last
         // run, so we will resume execution using the block.
-        if (!_eos && _block->empty()) {
+        if (!_eos && !_sink_yielded && _block->empty()) {
             SCOPED_TIMER(_get_block_timer);
             if (_state->low_memory_mode()) {
                 _sink->set_low_memory_mode(_state);
@@ -540,7 +552,8 @@ Status PipelineTask::execute(bool* done) {
                 }
             }
 
-            if (_eos) {
+            // The operators are already closed if the sink yielded at eos.
+            if (_eos && !_sink_yielded) {
                 RETURN_IF_ERROR(close(Status::OK(), false));
             }
 
@@ -580,7 +593,12 @@ Status PipelineTask::execute(bool* done) {
                 }
             });
             RETURN_IF_ERROR(block->check_type_and_column());
-            status = _sink->sink(_state, block, _eos);
+            {
+                ScopedCpuProfileOperator cpu_profile_operator(_sink->node_id(),
+                                                              CpuProfileScope::SINK);
+                status = _sink->sink(_state, block, _eos);
+            }
+            _sink_yielded = _state->get_and_reset_sink_yielded();
 
             if (status.is<ErrorCode::END_OF_FILE>()) {
                 set_wake_up_early();
@@ -589,6 +607,17 @@ Status PipelineTask::execute(bool* done) {
                 return status;
             }
 
+            if (_sink_yielded) {
+                // The time slice is used up in the middle of the block, keep the block and let
+                // other tasks run.
+                COUNTER_UPDATE(_yield_counts, 1);
+                if (PipelineEventTracer::enabled()) {
+                    auto now = PipelineEventTracer::now();
+                    trace_event(PipelineTraceEventType::YIELD, 0, now, now);
+                }
+                break;
+            }
+
             if (_eos) { // just return, the scheduler will do finish work
                 return Status::OK();
             }
@@ -607,6 +636,20 @@ bool PipelineTask::_try_to_reserve_memory(const size_t reserve_size, OperatorBas
         sink_revocable_mem_size >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) {
         st = Status(ErrorCode::QUERY_MEMORY_EXCEEDED, "Force Spill");
     }
+    if (st.ok() && _sink->is_spillable() &&
+        sink_revocable_mem_size >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM &&
+        config::spill_proactive_query_memory_ratio < 1) {
+        // Spill before the query reaches its limit, so that the spill io of the chosen operators
+        // overlaps with the rest of the query instead of failing a reservation later.
+        auto* memory_context = _state->get_query_ctx()->resource_ctx()->memory_context();
+        const auto mem_limit = memory_context->mem_limit();
+        if (mem_limit > 0 &&
+            static_cast<double>(memory_context->current_memory_bytes() +
+                                    static_cast<int64_t>(reserve_size)) >
+                    static_cast<double>(mem_limit) * config::spill_proactive_query_memory_ratio) {
+            st = Status(ErrorCode::QUERY_MEMORY_EXCEEDED, "Proactive Spill");
+        }
+    }
     if (!st.ok()) {
         COUNTER_UPDATE(_memory_reserve_failed_times, 1);
         auto debug_msg = fmt::format(
@@ -790,6 +833,14 @@ size_t PipelineTask::get_revocable_size() const {
     return _sink->revocable_mem_size(_state);
 }
 
+size_t PipelineTask::get_revocable_spill_io_size() const {
+    if (is_finalized() || _running || (_eos && !_spilling)) {
+        return 0;
+    }
+
+    return _sink->revocable_mem_spill_io_size(_state);
+}
+
 Status PipelineTask::revoke_memory(const std::shared_ptr<SpillContext>& spill_context) {
     if (is_finalized()) {
         if (spill_context) {
@@ -811,13 +862,36 @@ Status PipelineTask::revoke_memory(const std::shared_ptr<SpillContext>& spill_co
     return Status::OK();
 }
 
-Status PipelineTask::wake_up(Dependency* dep) {
+Status PipelineTask::wake_up(Dependency* dep, std::vector<PipelineTaskSPtr>& tasks) {
     // call by dependency
-    DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
-    _blocked_dep = nullptr;
-    auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
-    RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
-    RETURN_IF_ERROR(_state->get_query_ctx()->get_pipe_exec_scheduler()->submit(holder));
+    for (auto& task : tasks) {
+        DCHECK_EQ(task->_blocked_dep, dep)
+                << "dep : " << dep->debug_string(0) << "task: " << task->debug_string();
+        if (PipelineEventTracer::enabled() && task->_blocked_ns > 0) {
+            task->trace_event(PipelineTraceEventType::DEPENDENCY_WAIT, dep->id(),
+                               task->_blocked_ns, PipelineEventTracer::now());
+            task->_blocked_ns = 0;
+        }
+        task->_blocked_dep = nullptr;
+        RETURN_IF_ERROR(task->_state_transition(PipelineTask::State::RUNNABLE));
+    }
+    // The tasks blocked by one dependency almost always belong to the same query, submit the
+    // continuous tasks of the same scheduler together.
+    size_t begin = 0;
+    while (begin < tasks.size()) {
+        auto* scheduler = tasks[begin]->_state->get_query_ctx()->get_pipe_exec_scheduler();
+        size_t end = begin + 1;
+        while (end < tasks.size() &&
+               tasks[end]->_state->get_query_ctx()->get_pipe_exec_scheduler() == scheduler) {
+            ++end;
+        }
+        if (begin == 0 && end == tasks.size()) {
+            return scheduler->submit_batch(tasks);
+        }
+        std::vector<PipelineTaskSPtr> batch(tasks.begin() + begin, tasks.begin() + end);
+        RETURN_IF_ERROR(scheduler->submit_batch(batch));
+        begin = end;
+    }
     return Status::OK();
 }
 
@@ -26,6 +26,8 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_event_trace.h"
+#include "util/hot_path_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
@@ -117,11 +119,14 @@ public:
         return _op_shared_states[id].get();
     }
 
-    Status wake_up(Dependency* dep);
+    // Called by `dep` when it is ready: make `tasks`, which are blocked by `dep`, runnable and
+    // submit them in batch. Each task goes back to the core it ran on last time.
+    static Status wake_up(Dependency* dep, std::vector<std::shared_ptr<PipelineTask>>& tasks);
 
     DataSinkOperatorPtr sink() const { return _sink; }
 
     int task_id() const { return _index; };
+    int task_idx() const { return _task_idx; }
     bool is_finalized() const { return _exec_state == State::FINALIZED; }
 
     void set_wake_up_early() { _wake_up_early = true; }
@@ -144,7 +149,14 @@ public:
         _wait_worker_watcher.start();
     }
 
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue() {
+        if (hot_path_metrics::enabled()) {
+            hot_path_metrics::record_latency(
+                    HotPath::PIPELINE_TASK_QUEUE_WAIT,
+                    static_cast<int64_t>(_wait_worker_watcher.elapsed_time()));
+        }
+        _wait_worker_watcher.stop();
+    }
 
     bool is_running() { return _running.load(); }
     bool is_revoking() const;
@@ -162,14 +174,33 @@ public:
 
     PipelineId pipeline_id() const { return _pipeline->id(); }
     [[nodiscard]] size_t get_revocable_size() const;
+    [[nodiscard]] size_t get_revocable_spill_io_size() const;
     [[nodiscard]] Status revoke_memory(const std::shared_ptr<SpillContext>& spill_context);
 
     Status blocked(Dependency* dependency) {
         DCHECK_EQ(_blocked_dep, nullptr) << "task: " << debug_string();
         _blocked_dep = dependency;
+        if (PipelineEventTracer::enabled()) {
+            _blocked_ns = PipelineEventTracer::now();
+            trace_event(PipelineTraceEventType::BLOCK, dependency->id(), _blocked_ns,
+                         _blocked_ns);
+        }
         return _state_transition(PipelineTask::State::BLOCKED);
     }
 
+    // Undo `blocked` if `dependency` became ready before it could record this task.
+    Status unblocked(Dependency* dependency) {
+        DCHECK_EQ(_blocked_dep, dependency) << "task: " << debug_string();
+        _blocked_dep = nullptr;
+        _blocked_ns = 0;
+        return _state_transition(PipelineTask::State::RUNNABLE);
+    }
+
+    void trace_event(PipelineTraceEventType type, int arg, int64_t begin_ns, int64_t end_ns) {
+        trace_pipeline_event(type, _query_id, pipeline_id(), _index, _core_id, arg, begin_ns,
+                             end_ns);
+    }
+
 private:
     // Whether this task is blocked before execution (FE 2-phase commit trigger, runtime filters)
     bool _wait_to_start();
@@ -252,6 +283,8 @@ private:
     MOCK_REMOVE(const)
     unsigned long long _exec_time_slice = config::pipeline_task_exec_time_slice * NANOS_PER_MILLIS;
     Dependency* _blocked_dep = nullptr;
+    // When the task was blocked by `_blocked_dep`, only set if the event trace is enabled.
+    int64_t _blocked_ns = 0;
 
     Dependency* _memory_sufficient_dependency;
     std::mutex _dependency_lock;
@@ -302,6 +335,8 @@ private:
     std::atomic<State> _exec_state = State::INITED;
     MonotonicStopWatch _state_change_watcher;
     std::atomic<bool> _spilling = false;
+    // The sink yielded in the middle of `_block`, it will be sunk again in the next run.
+    bool _sink_yielded = false;
     const std::string _pipeline_name;
 };
 
@@ -66,4 +66,18 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+bool QueryCache::lookup_delta_base(const CacheKey& key, int64_t version,
+                                   doris::QueryCacheHandle* handle) {
+    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
+    auto* lru_handle = LRUCachePolicy::lookup(key);
+    if (lru_handle) {
+        QueryCacheHandle tmp_handle(this, lru_handle);
+        if (tmp_handle.get_cache_version() < version) {
+            *handle = std::move(tmp_handle);
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace doris
@@ -146,6 +146,10 @@ public:
 
     bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
 
+    // Find an entry built on an older version of the tablet, the rowsets appended after it
+    // can be scanned and merged with the cached partial result instead of a full recompute.
+    bool lookup_delta_base(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
+
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
 };
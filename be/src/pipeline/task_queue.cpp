@@ -19,12 +19,17 @@
 
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/time.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -113,30 +118,78 @@ PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
     }
 }
 
-Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
-    if (_closed) {
-        return Status::InternalError("WorkTaskQueue closed");
-    }
-    auto level = _compute_level(task->get_runtime_ns());
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
-
+void PriorityTaskQueue::_push_unprotected(PipelineTaskSPtr task, int level) {
     // update empty queue's  runtime, to avoid too high priority
     if (_sub_queues[level].empty() &&
         double(_queue_level_min_vruntime) > _sub_queues[level].get_vruntime()) {
         _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
     }
 
-    _sub_queues[level].push_back(task);
+    _sub_queues[level].push_back(std::move(task));
     _total_task_size++;
+}
+
+Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    auto level = _compute_level(task->get_runtime_ns());
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    _push_unprotected(std::move(task), level);
     DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
     _wait_task.notify_one();
     return Status::OK();
 }
 
+Status PriorityTaskQueue::push_batch(const PipelineTaskSPtr* tasks, size_t num_tasks) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    for (size_t i = 0; i < num_tasks; ++i) {
+        _push_unprotected(tasks[i], _compute_level(tasks[i]->get_runtime_ns()));
+    }
+    DorisMetrics::instance()->pipeline_task_queue_size->increment(num_tasks);
+    // Only the worker of this core waits on the queue.
+    _wait_task.notify_one();
+    return Status::OK();
+}
+
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {
+    _init_numa_topology(config::enable_pipeline_task_numa_aware);
+}
+
+void MultiCoreTaskQueue::_init_numa_topology(bool enable_numa) {
+    _core_to_node.assign(_core_size, 0);
+    _node_to_cores.clear();
+    if (enable_numa && CpuInfo::get_max_num_numa_nodes() > 1) {
+        // Core queue i is served by a worker bound to the NUMA node of cpu i. Nodes without
+        // any core queue are skipped, so the node index is dense.
+        std::vector<int> physical_to_dense(CpuInfo::get_max_num_numa_nodes(), -1);
+        int max_cores = CpuInfo::get_max_num_cores();
+        for (int i = 0; i < _core_size; ++i) {
+            int physical_node = CpuInfo::get_numa_node_of_core(i % max_cores);
+            if (physical_to_dense[physical_node] == -1) {
+                physical_to_dense[physical_node] = cast_set<int>(_node_to_cores.size());
+                _node_to_cores.emplace_back();
+            }
+            _core_to_node[i] = physical_to_dense[physical_node];
+            _node_to_cores[_core_to_node[i]].push_back(i);
+        }
+    } else {
+        _node_to_cores.emplace_back(_core_size);
+        std::iota(_node_to_cores[0].begin(), _node_to_cores[0].end(), 0);
+    }
+    _next_core_of_node = std::make_unique<std::atomic<uint32_t>[]>(_node_to_cores.size());
+    if (numa_aware()) {
+        LOG_INFO("MultiCoreTaskQueue is NUMA aware")
+                .tag("cores", _core_size)
+                .tag("numa_nodes", _node_to_cores.size());
+    }
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -162,7 +215,15 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
         if (task) {
             break;
         }
-        task = _prio_task_queues[core_id].take(WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
+        auto* lender = _lender.load();
+        if (lender) {
+            task = lender->steal_any();
+            if (task) {
+                break;
+            }
+        }
+        task = _prio_task_queues[core_id].take(
+                lender ? WAIT_LENDER_TASK_TIMEOUT_MS : WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
         if (task) {
             break;
         }
@@ -175,29 +236,111 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
 
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
-    int next_id = core_id;
-    for (int i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
+    int local_node = _core_to_node[core_id];
+    // Steal within the local node first to keep the hash tables and blocks owned by the task in
+    // the local memory and LLC.
+    if (auto task = _steal_take_from(core_id, _node_to_cores[local_node])) {
+        return task;
+    }
+    // Nothing is runnable in the whole local node, so the node is idle and stealing from a remote
+    // node is cheaper than leaving the cores unused.
+    int num_nodes = numa_nodes();
+    for (int i = 1; i < num_nodes; ++i) {
+        int node = (local_node + i) % num_nodes;
+        if (auto task = _steal_take_from(core_id, _node_to_cores[node])) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTaskSPtr MultiCoreTaskQueue::steal_any() {
+    if (_closed) {
+        return nullptr;
+    }
+    for (int i = 0; i < _core_size; ++i) {
+        auto task = _prio_task_queues[i].try_take(true);
+        if (task) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_take_from(int core_id,
+                                                      const std::vector<int>& candidates) {
+    auto size = candidates.size();
+    if (size == 0) {
+        return nullptr;
+    }
+    // `candidates` is sorted, begin with the first core after `core_id` to spread the stealing.
+    size_t start = std::upper_bound(candidates.begin(), candidates.end(), core_id) -
+                   candidates.begin();
+    for (size_t i = 0; i < size; ++i) {
+        int next_id = candidates[(start + i) % size];
+        if (next_id == core_id) {
+            continue;
         }
         DCHECK(next_id < _core_size);
         auto task = _prio_task_queues[next_id].try_take(true);
         if (task) {
+            if (PipelineEventTracer::enabled()) {
+                auto now = PipelineEventTracer::now();
+                task->trace_event(PipelineTraceEventType::STEAL, core_id, now, now);
+            }
             return task;
         }
     }
     return nullptr;
 }
 
-Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
+int MultiCoreTaskQueue::_select_core(const PipelineTaskSPtr& task) {
     int core_id = task->get_core_id();
-    if (core_id < 0) {
-        core_id = _next_core.fetch_add(1) % _core_size;
+    // The core id may belong to another queue if the task was lent to another scheduler pool.
+    if (core_id < 0 || core_id >= _core_size) {
+        if (numa_aware()) {
+            // The tasks of one fragment instance share the same task idx, place them on the same
+            // node so that the shared states built by one task are probed by the others locally.
+            auto node = task->task_idx() % _node_to_cores.size();
+            const auto& cores = _node_to_cores[node];
+            core_id = cores[_next_core_of_node[node].fetch_add(1) % cores.size()];
+        } else {
+            core_id = _next_core.fetch_add(1) % _core_size;
+        }
     }
+    return core_id;
+}
+
+Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
+    int core_id = _select_core(task);
     return push_back(task, core_id);
 }
 
+Status MultiCoreTaskQueue::push_back_batch(std::vector<PipelineTaskSPtr>& tasks) {
+    if (tasks.size() == 1) {
+        return push_back(tasks[0]);
+    }
+    std::vector<std::pair<int, PipelineTaskSPtr>> core_tasks;
+    core_tasks.reserve(tasks.size());
+    for (auto& task : tasks) {
+        task->put_in_runnable_queue();
+        core_tasks.emplace_back(_select_core(task), task);
+    }
+    std::stable_sort(core_tasks.begin(), core_tasks.end(),
+                     [](const auto& l, const auto& r) { return l.first < r.first; });
+    std::vector<PipelineTaskSPtr> batch;
+    size_t begin = 0;
+    while (begin < core_tasks.size()) {
+        int core_id = core_tasks[begin].first;
+        batch.clear();
+        for (; begin < core_tasks.size() && core_tasks[begin].first == core_id; ++begin) {
+            batch.push_back(std::move(core_tasks[begin].second));
+        }
+        RETURN_IF_ERROR(_prio_task_queues[core_id].push_batch(batch.data(), batch.size()));
+    }
+    return Status::OK();
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task, int core_id) {
     DCHECK(core_id < _core_size);
     task->put_in_runnable_queue();
@@ -213,4 +356,163 @@ void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spen
     }
 }
 
+////////////////////  GroupFairTaskQueue ////////////////////
+
+void GroupFairTaskQueue::close() {
+    std::unique_lock<std::mutex> lock(_lock);
+    _closed = true;
+    for (auto& [id, group] : _groups) {
+        group->tasks.close();
+    }
+    _wait_task.notify_all();
+}
+
+PipelineTaskSPtr GroupFairTaskQueue::take(uint32_t timeout_ms, uint64_t* group_id) {
+    std::unique_lock<std::mutex> lock(_lock);
+    auto* group = _pick_group_unprotected();
+    if (group == nullptr && !_closed) {
+        // Also wake up for the window roll, a capped group can be served again then.
+        _wait_task.wait_for(lock, std::chrono::milliseconds(timeout_ms));
+        group = _pick_group_unprotected();
+    }
+    if (group == nullptr) {
+        return nullptr;
+    }
+    auto task = group->tasks.try_take(false);
+    DCHECK(task);
+    if (task) {
+        group->running++;
+        *group_id = _order[_cursor];
+        task->pop_out_runnable_queue();
+    }
+    return task;
+}
+
+Status GroupFairTaskQueue::push(PipelineTaskSPtr task, const GroupSchedInfo& group) {
+    return push_batch(&task, 1, group);
+}
+
+Status GroupFairTaskQueue::push_batch(const PipelineTaskSPtr* tasks, size_t num_tasks,
+                                      const GroupSchedInfo& group) {
+    std::unique_lock<std::mutex> lock(_lock);
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    for (size_t i = 0; i < num_tasks; ++i) {
+        tasks[i]->put_in_runnable_queue();
+    }
+    RETURN_IF_ERROR(_get_group_unprotected(group)->tasks.push_batch(tasks, num_tasks));
+    if (num_tasks == 1) {
+        _wait_task.notify_one();
+    } else {
+        _wait_task.notify_all();
+    }
+    return Status::OK();
+}
+
+void GroupFairTaskQueue::finish(uint64_t group_id, PipelineTask* task, int64_t exec_ns,
+                                int64_t cpu_ns) {
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _groups.find(group_id);
+    if (it == _groups.end()) {
+        // The queue is closed.
+        return;
+    }
+    auto& group = *it->second;
+    if (exec_ns > 0) {
+        task->inc_runtime_ns(exec_ns);
+        group.tasks.inc_sub_queue_runtime(task->get_queue_level(), exec_ns);
+    }
+    group.deficit_ns -= cpu_ns;
+    group.window_cpu_ns += cpu_ns;
+    group.running--;
+}
+
+GroupFairTaskQueue::GroupQueue* GroupFairTaskQueue::_get_group_unprotected(
+        const GroupSchedInfo& group) {
+    auto& queue = _groups[group.id];
+    if (queue == nullptr) {
+        queue = std::make_unique<GroupQueue>();
+        _order.push_back(group.id);
+    }
+    // The share may be changed by the FE at any time.
+    queue->weight = std::max(group.weight, 1);
+    queue->max_cpu_percent = std::clamp(group.max_cpu_percent, 1, 100);
+    return queue.get();
+}
+
+bool GroupFairTaskQueue::_servable(const GroupQueue& group) const {
+    return !group.tasks.empty() &&
+           (group.max_cpu_percent >= 100 ||
+            group.window_cpu_ns * 100 < CPU_WINDOW_NS * _workers * group.max_cpu_percent);
+}
+
+int64_t GroupFairTaskQueue::_quantum_ns(const GroupQueue& group) const {
+    return std::max<int64_t>(config::workload_group_fair_scheduler_quantum_ms, 1) *
+           NANOS_PER_MILLIS * group.weight;
+}
+
+GroupFairTaskQueue::GroupQueue* GroupFairTaskQueue::_pick_group_unprotected() {
+    if (_closed) {
+        return nullptr;
+    }
+    _roll_window_unprotected(MonotonicNanos());
+    // The rounds needed until one of the servable groups has a positive deficit, the rounds are
+    // granted at once instead of visiting the groups round by round.
+    int64_t rounds = -1;
+    for (auto id : _order) {
+        const auto& group = *_groups[id];
+        if (!_servable(group)) {
+            continue;
+        }
+        int64_t group_rounds =
+                group.deficit_ns > 0 ? 0 : -group.deficit_ns / _quantum_ns(group) + 1;
+        rounds = rounds < 0 ? group_rounds : std::min(rounds, group_rounds);
+    }
+    if (rounds < 0) {
+        return nullptr;
+    }
+    if (rounds > 0) {
+        for (auto id : _order) {
+            auto& group = *_groups[id];
+            if (_servable(group)) {
+                group.deficit_ns += rounds * _quantum_ns(group);
+            }
+        }
+        // The group at the cursor used up its deficit, a new round begins after it.
+        _cursor = (_cursor + 1) % _order.size();
+    }
+    for (size_t i = 0; i < _order.size(); ++i) {
+        size_t index = (_cursor + i) % _order.size();
+        auto& group = *_groups[_order[index]];
+        if (_servable(group) && group.deficit_ns > 0) {
+            _cursor = index;
+            return &group;
+        }
+    }
+    DCHECK(false);
+    return nullptr;
+}
+
+void GroupFairTaskQueue::_roll_window_unprotected(int64_t now_ns) {
+    if (now_ns - _window_start_ns < CPU_WINDOW_NS) {
+        return;
+    }
+    _window_start_ns = now_ns;
+    // Drop the groups without any task, which also forgives their deficit.
+    std::erase_if(_order, [this](uint64_t id) {
+        auto it = _groups.find(id);
+        if (it->second->running == 0 && it->second->tasks.empty()) {
+            _groups.erase(it);
+            return true;
+        }
+        it->second->window_cpu_ns = 0;
+        return false;
+    });
+    if (_cursor >= _order.size()) {
+        _cursor = 0;
+    }
+}
+
+#include "common/compile_check_end.h"
 } // namespace doris::pipeline
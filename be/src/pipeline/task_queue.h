@@ -27,6 +27,8 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
@@ -78,12 +80,18 @@ public:
 
     Status push(PipelineTaskSPtr task);
 
+    // Push the tasks with one lock acquisition.
+    Status push_batch(const PipelineTaskSPtr* tasks, size_t num_tasks);
+
     void inc_sub_queue_runtime(int level, uint64_t runtime) {
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    bool empty() const { return _total_task_size == 0; }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
+    void _push_unprotected(PipelineTaskSPtr task, int level);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
@@ -102,7 +110,9 @@ private:
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// If `enable_pipeline_task_numa_aware` is set and the machine has more than one NUMA node, the
+// core queues are grouped by the NUMA node of their cores. Tasks are placed and stolen within
+// their node, and only cross the node boundary when the whole local node has nothing to run.
 class MultiCoreTaskQueue {
 public:
     explicit MultiCoreTaskQueue(int core_size);
@@ -122,19 +132,119 @@ public:
 
     Status push_back(PipelineTaskSPtr task, int core_id);
 
+    // Push the tasks to their core queues, the tasks of the same core are pushed together.
+    Status push_back_batch(std::vector<PipelineTaskSPtr>& tasks);
+
     void update_statistics(PipelineTask* task, int64_t time_spent);
 
+    // The idle workers of this queue take tasks from `lender` before waiting for new tasks,
+    // so that the capacity of one scheduler pool is not stranded while the other one is busy.
+    void set_lender(MultiCoreTaskQueue* lender) { _lender = lender; }
+
+    // Steal a task from any core queue of this queue.
+    PipelineTaskSPtr steal_any();
+
     int cores() const { return _core_size; }
 
+    bool numa_aware() const { return _node_to_cores.size() > 1; }
+
+    // The NUMA node (dense index in [0, numa_nodes())) which the core queue belongs to.
+    int numa_node_of_core(int core_id) const { return _core_to_node[core_id]; }
+
+    int numa_nodes() const { return cast_set<int>(_node_to_cores.size()); }
+
 private:
+    void _init_numa_topology(bool enable_numa);
+
+    int _select_core(const PipelineTaskSPtr& task);
+
     PipelineTaskSPtr _steal_take(int core_id);
 
+    // Try to steal a task from `candidates`, starting after `core_id` if it is one of them.
+    PipelineTaskSPtr _steal_take_from(int core_id, const std::vector<int>& candidates);
+
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
+    // core queue -> NUMA node, all 0 if not numa aware
+    std::vector<int> _core_to_node;
+    // NUMA node -> core queues in ascending order
+    std::vector<std::vector<int>> _node_to_cores;
+    // round robin cursor per NUMA node, used to place the tasks of one node
+    std::unique_ptr<std::atomic<uint32_t>[]> _next_core_of_node;
     std::atomic<bool> _closed;
 
     int _core_size;
+    std::atomic<MultiCoreTaskQueue*> _lender = nullptr;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
+    // wait shorter if there is a lender, to find the tasks of the lender earlier
+    static constexpr auto WAIT_LENDER_TASK_TIMEOUT_MS = 10;
+};
+
+// The workload group a task is scheduled for by `GroupFairTaskQueue`.
+struct GroupSchedInfo {
+    uint64_t id = 0;
+    // The share of the group relative to the other groups, at least 1.
+    int weight = 1;
+    // The cpu time of the pool the group may use, in percent.
+    int max_cpu_percent = 100;
 };
+
+// The tasks of all the workload groups sharing one worker pool, scheduled by weighted deficit
+// round robin. Every group has its own multilevel feedback queue. A group keeps being served while
+// its deficit is positive and every time slice charges its cpu time to the deficit of the group.
+// When none of the groups with runnable tasks has a positive deficit, each of them earns
+// `workload_group_fair_scheduler_quantum_ms * weight` per round. A group whose `max_cpu_percent`
+// is below 100 is not served for the rest of a window once it used that percent of the pool.
+class GroupFairTaskQueue {
+public:
+    explicit GroupFairTaskQueue(int workers) : _workers(workers) {}
+
+    void close();
+
+    // Take a task, `group_id` is set to the group to charge the time slice of the task to.
+    PipelineTaskSPtr take(uint32_t timeout_ms, uint64_t* group_id);
+
+    Status push(PipelineTaskSPtr task, const GroupSchedInfo& group);
+
+    // Push the tasks of one group with one lock acquisition.
+    Status push_batch(const PipelineTaskSPtr* tasks, size_t num_tasks,
+                      const GroupSchedInfo& group);
+
+    // Must be called once for every task taken, after its time slice. The wall time moves the task
+    // through the feedback queue of its group, the cpu time is charged to the group.
+    void finish(uint64_t group_id, PipelineTask* task, int64_t exec_ns, int64_t cpu_ns);
+
+private:
+    struct GroupQueue {
+        PriorityTaskQueue tasks;
+        int weight = 1;
+        int max_cpu_percent = 100;
+        int64_t deficit_ns = 0;
+        // The cpu time used in the current window.
+        int64_t window_cpu_ns = 0;
+        // The tasks taken and not finished yet, the group is dropped when it has no task.
+        int running = 0;
+    };
+
+    GroupQueue* _get_group_unprotected(const GroupSchedInfo& group);
+    bool _servable(const GroupQueue& group) const;
+    int64_t _quantum_ns(const GroupQueue& group) const;
+    // The group to serve next, nullptr if no group can be served now.
+    GroupQueue* _pick_group_unprotected();
+    void _roll_window_unprotected(int64_t now_ns);
+
+    static constexpr int64_t CPU_WINDOW_NS = 1'000'000'000;
+
+    const int _workers;
+    std::mutex _lock;
+    std::condition_variable _wait_task;
+    bool _closed = false;
+    std::unordered_map<uint64_t, std::unique_ptr<GroupQueue>> _groups;
+    // The round robin order of the groups.
+    std::vector<uint64_t> _order;
+    size_t _cursor = 0;
+    int64_t _window_start_ns = 0;
+};
+
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -42,6 +43,8 @@
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -74,6 +77,10 @@ Status TaskScheduler::submit(PipelineTaskSPtr task) {
     return _task_queue.push_back(task);
 }
 
+Status TaskScheduler::submit_batch(std::vector<PipelineTaskSPtr>& tasks) {
+    return _task_queue.push_back_batch(tasks);
+}
+
 // after close_task, task maybe destructed.
 void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext* ctx) {
     // Has to attach memory tracker here, because the close task will also release some memory.
@@ -95,7 +102,92 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
     }
 }
 
+// Bind the worker of core queue `index` to the cpus of its NUMA node, so that memory allocated by
+// the tasks is first touched on the local node.
+static void bind_worker_to_numa_node(int index) {
+    const auto& cpus = CpuInfo::get_cores_of_same_numa_node(index % CpuInfo::get_max_num_cores());
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "failed to bind pipeline worker " << index
+                     << " to its NUMA node, errno=" << ret;
+    }
+}
+
+// Run one time slice of `task` on worker `index`. `on_finish` is called with the time spent once
+// the slice is over, even if the task is not executed.
+template <typename OnFinish>
+static void execute_task(const PipelineTaskSPtr& task, int index, OnFinish&& on_finish) {
+    if (task->is_finalized()) {
+        on_finish(0);
+        return;
+    }
+    auto fragment_context = task->fragment_context().lock();
+    if (!fragment_context) {
+        // Fragment already finished
+        on_finish(0);
+        return;
+    }
+    task->set_running(true).set_core_id(index);
+    bool done = false;
+    auto status = Status::OK();
+    int64_t exec_ns = 0;
+    SCOPED_RAW_TIMER(&exec_ns);
+    Defer task_running_defer {[&]() {
+        // If fragment is finished, fragment context will be de-constructed with all tasks in it.
+        if (done || !status.ok()) {
+            auto id = task->pipeline_id();
+            close_task(task.get(), status, fragment_context.get());
+            task->set_running(false);
+            fragment_context->decrement_running_task(id);
+        } else {
+            task->set_running(false);
+        }
+        on_finish(exec_ns);
+    }};
+    bool canceled = fragment_context->is_canceled();
+
+    // Close task if canceled
+    if (canceled) {
+        status = fragment_context->get_query_ctx()->exec_status();
+        DCHECK(!status.ok());
+        return;
+    }
+
+    // Main logics of execution
+    ASSIGN_STATUS_IF_CATCH_EXCEPTION(
+            //TODO: use a better enclose to abstracting these
+            if (ExecEnv::GetInstance()->pipeline_tracer_context()->enabled()) {
+                TUniqueId query_id = fragment_context->get_query_id();
+                std::string task_name = task->task_name();
+
+                std::thread::id tid = std::this_thread::get_id();
+                uint64_t thread_id = *reinterpret_cast<uint64_t*>(&tid);
+                uint64_t start_time = MonotonicMicros();
+
+                status = task->execute(&done);
+
+                uint64_t end_time = MonotonicMicros();
+                ExecEnv::GetInstance()->pipeline_tracer_context()->record(
+                        {query_id, task_name, static_cast<uint32_t>(index), thread_id, start_time,
+                         end_time});
+            } else if (PipelineEventTracer::enabled()) {
+                auto start_ns = PipelineEventTracer::now();
+                status = task->execute(&done);
+                task->trace_event(PipelineTraceEventType::EXECUTE, 0, start_ns,
+                                  PipelineEventTracer::now());
+            } else { status = task->execute(&done); },
+            status);
+    fragment_context->trigger_report_if_necessary();
+}
+
 void TaskScheduler::_do_work(int index) {
+    if (_task_queue.numa_aware()) {
+        bind_worker_to_numa_node(index);
+    }
     while (!_need_to_stop) {
         auto task = _task_queue.take(index);
         if (!task) {
@@ -109,60 +201,9 @@ void TaskScheduler::_do_work(int index) {
             static_cast<void>(_task_queue.push_back(task, index));
             continue;
         }
-        if (task->is_finalized()) {
-            continue;
-        }
-        auto fragment_context = task->fragment_context().lock();
-        if (!fragment_context) {
-            // Fragment already finished
-            continue;
-        }
-        task->set_running(true).set_core_id(index);
-        bool done = false;
-        auto status = Status::OK();
-        int64_t exec_ns = 0;
-        SCOPED_RAW_TIMER(&exec_ns);
-        Defer task_running_defer {[&]() {
-            // If fragment is finished, fragment context will be de-constructed with all tasks in it.
-            if (done || !status.ok()) {
-                auto id = task->pipeline_id();
-                close_task(task.get(), status, fragment_context.get());
-                task->set_running(false);
-                fragment_context->decrement_running_task(id);
-            } else {
-                task->set_running(false);
-            }
+        execute_task(task, index, [&](int64_t exec_ns) {
             _task_queue.update_statistics(task.get(), exec_ns);
-        }};
-        bool canceled = fragment_context->is_canceled();
-
-        // Close task if canceled
-        if (canceled) {
-            status = fragment_context->get_query_ctx()->exec_status();
-            DCHECK(!status.ok());
-            continue;
-        }
-
-        // Main logics of execution
-        ASSIGN_STATUS_IF_CATCH_EXCEPTION(
-                //TODO: use a better enclose to abstracting these
-                if (ExecEnv::GetInstance()->pipeline_tracer_context()->enabled()) {
-                    TUniqueId query_id = fragment_context->get_query_id();
-                    std::string task_name = task->task_name();
-
-                    std::thread::id tid = std::this_thread::get_id();
-                    uint64_t thread_id = *reinterpret_cast<uint64_t*>(&tid);
-                    uint64_t start_time = MonotonicMicros();
-
-                    status = task->execute(&done);
-
-                    uint64_t end_time = MonotonicMicros();
-                    ExecEnv::GetInstance()->pipeline_tracer_context()->record(
-                            {query_id, task_name, static_cast<uint32_t>(index), thread_id,
-                             start_time, end_time});
-                } else { status = task->execute(&done); },
-                status);
-        fragment_context->trigger_report_if_necessary();
+        });
     }
 }
 
@@ -182,23 +223,190 @@ void TaskScheduler::stop() {
     }
 }
 
+HybridTaskScheduler::HybridTaskScheduler(int core_num, std::string name,
+                                         std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
+        : _blocking_scheduler(core_num * 2, name + "_blocking_scheduler", cgroup_cpu_ctl),
+          _simple_scheduler(core_num, name + "_simple_scheduler", cgroup_cpu_ctl) {
+    if (config::pipeline_latency_scheduler_thread_percent > 0) {
+        int latency_core_num = std::max(
+                1, core_num * std::min(config::pipeline_latency_scheduler_thread_percent, 100) /
+                           100);
+        _latency_scheduler.reset(new TaskScheduler(latency_core_num, name + "_latency_scheduler",
+                                                   cgroup_cpu_ctl));
+        _simple_scheduler._task_queue.set_lender(&_latency_scheduler->_task_queue);
+        _latency_scheduler->_task_queue.set_lender(&_simple_scheduler._task_queue);
+    }
+}
+
+bool HybridTaskScheduler::_is_latency_task(const PipelineTaskSPtr& task) {
+    auto* query_ctx = task->runtime_state()->get_query_ctx();
+    // Loads are throughput oriented even if they are small.
+    if (query_ctx != nullptr && query_ctx->is_pure_load_task()) {
+        return false;
+    }
+    // A task which already ran longer than the threshold belongs to a long running query, move
+    // it out of the latency pool.
+    return task->get_runtime_ns() <
+           static_cast<uint64_t>(config::pipeline_latency_task_runtime_threshold_ms) *
+                   NANOS_PER_MILLIS;
+}
+
 Status HybridTaskScheduler::submit(PipelineTaskSPtr task) {
     if (task->is_blockable()) {
         return _blocking_scheduler.submit(task);
+    } else if (_latency_scheduler && _is_latency_task(task)) {
+        return _latency_scheduler->submit(task);
     } else {
         return _simple_scheduler.submit(task);
     }
 }
 
+Status HybridTaskScheduler::submit_batch(std::vector<PipelineTaskSPtr>& tasks) {
+    std::vector<PipelineTaskSPtr> blocking_tasks;
+    std::vector<PipelineTaskSPtr> latency_tasks;
+    std::vector<PipelineTaskSPtr> simple_tasks;
+    for (auto& task : tasks) {
+        if (task->is_blockable()) {
+            blocking_tasks.push_back(task);
+        } else if (_latency_scheduler && _is_latency_task(task)) {
+            latency_tasks.push_back(task);
+        } else {
+            simple_tasks.push_back(task);
+        }
+    }
+    if (!blocking_tasks.empty()) {
+        RETURN_IF_ERROR(_blocking_scheduler.submit_batch(blocking_tasks));
+    }
+    if (!latency_tasks.empty()) {
+        RETURN_IF_ERROR(_latency_scheduler->submit_batch(latency_tasks));
+    }
+    if (!simple_tasks.empty()) {
+        RETURN_IF_ERROR(_simple_scheduler.submit_batch(simple_tasks));
+    }
+    return Status::OK();
+}
+
 Status HybridTaskScheduler::start() {
     RETURN_IF_ERROR(_blocking_scheduler.start());
     RETURN_IF_ERROR(_simple_scheduler.start());
+    if (_latency_scheduler) {
+        RETURN_IF_ERROR(_latency_scheduler->start());
+    }
     return Status::OK();
 }
 
 void HybridTaskScheduler::stop() {
     _blocking_scheduler.stop();
+    if (_latency_scheduler) {
+        // The two pools borrow tasks from each other, stop the lending before closing the queues.
+        _simple_scheduler._task_queue.set_lender(nullptr);
+        _latency_scheduler->_task_queue.set_lender(nullptr);
+        _latency_scheduler->stop();
+    }
     _simple_scheduler.stop();
 }
 
+WorkloadGroupFairTaskScheduler::WorkloadGroupFairTaskScheduler(int core_num, std::string name)
+        : TaskScheduler(0, name, nullptr),
+          _core_num(core_num),
+          _blocking_scheduler(core_num * 2, name + "_blocking_scheduler", nullptr),
+          _fair_queue(core_num) {}
+
+GroupSchedInfo WorkloadGroupFairTaskScheduler::_group_of(const PipelineTaskSPtr& task) {
+    auto* query_ctx = task->runtime_state()->get_query_ctx();
+    auto wg = query_ctx != nullptr ? query_ctx->workload_group() : nullptr;
+    if (wg == nullptr) {
+        return {};
+    }
+    // `min_cpu_percent` is the share guaranteed to the group, a group without it gets the
+    // smallest share.
+    return {wg->id(), std::max(wg->min_cpu_percent(), 1), wg->max_cpu_percent()};
+}
+
+Status WorkloadGroupFairTaskScheduler::submit(PipelineTaskSPtr task) {
+    if (task->is_blockable()) {
+        return _blocking_scheduler.submit(task);
+    }
+    auto group = _group_of(task);
+    return _fair_queue.push(std::move(task), group);
+}
+
+Status WorkloadGroupFairTaskScheduler::submit_batch(std::vector<PipelineTaskSPtr>& tasks) {
+    std::vector<PipelineTaskSPtr> blocking_tasks;
+    std::vector<PipelineTaskSPtr> group_tasks;
+    for (auto& task : tasks) {
+        if (task->is_blockable()) {
+            blocking_tasks.push_back(task);
+        } else {
+            group_tasks.push_back(task);
+        }
+    }
+    if (!blocking_tasks.empty()) {
+        RETURN_IF_ERROR(_blocking_scheduler.submit_batch(blocking_tasks));
+    }
+    // The tasks woken up together usually belong to one query, push the tasks of each group
+    // together.
+    size_t begin = 0;
+    while (begin < group_tasks.size()) {
+        auto group = _group_of(group_tasks[begin]);
+        size_t end = begin + 1;
+        while (end < group_tasks.size() && _group_of(group_tasks[end]).id == group.id) {
+            ++end;
+        }
+        RETURN_IF_ERROR(_fair_queue.push_batch(group_tasks.data() + begin, end - begin, group));
+        begin = end;
+    }
+    return Status::OK();
+}
+
+Status WorkloadGroupFairTaskScheduler::start() {
+    RETURN_IF_ERROR(_blocking_scheduler.start());
+    RETURN_IF_ERROR(ThreadPoolBuilder(_name)
+                            .set_min_threads(_core_num)
+                            .set_max_threads(_core_num)
+                            .set_max_queue_size(0)
+                            .build(&_fix_thread_pool));
+    LOG_INFO("WorkloadGroupFairTaskScheduler set cores").tag("size", _core_num);
+    for (int32_t i = 0; i < _core_num; ++i) {
+        RETURN_IF_ERROR(_fix_thread_pool->submit_func([this, i] { _do_fair_work(i); }));
+    }
+    return Status::OK();
+}
+
+void WorkloadGroupFairTaskScheduler::_do_fair_work(int index) {
+    while (!_need_to_stop) {
+        uint64_t group_id = 0;
+        auto task = _fair_queue.take(WAIT_TASK_TIMEOUT_MS, &group_id);
+        if (!task) {
+            continue;
+        }
+        if (task->is_running()) {
+            // Wait for the thread holding the task to release it, see `TaskScheduler::_do_work`.
+            static_cast<void>(_fair_queue.push(task, _group_of(task)));
+            _fair_queue.finish(group_id, task.get(), 0, 0);
+            continue;
+        }
+        MonotonicStopWatch exec_watch(true);
+        ThreadCpuStopWatch cpu_watch(true);
+        execute_task(task, index, [&](int64_t /*exec_ns*/) {
+            _fair_queue.finish(group_id, task.get(),
+                               static_cast<int64_t>(exec_watch.elapsed_time()),
+                               static_cast<int64_t>(cpu_watch.elapsed_time()));
+        });
+    }
+}
+
+void WorkloadGroupFairTaskScheduler::stop() {
+    _blocking_scheduler.stop();
+    if (!_shutdown) {
+        _fair_queue.close();
+        if (_fix_thread_pool) {
+            _need_to_stop = true;
+            _fix_thread_pool->shutdown();
+            _fix_thread_pool->wait();
+        }
+        _shutdown = true;
+    }
+}
+
 } // namespace doris::pipeline
@@ -43,12 +43,16 @@ class ThreadPool;
 namespace doris::pipeline {
 
 class HybridTaskScheduler;
+class WorkloadGroupFairTaskScheduler;
 class TaskScheduler {
 public:
     virtual ~TaskScheduler();
 
     virtual Status submit(PipelineTaskSPtr task);
 
+    // Submit the tasks woken up together by one dependency.
+    virtual Status submit_batch(std::vector<PipelineTaskSPtr>& tasks);
+
     virtual Status start();
 
     virtual void stop();
@@ -59,6 +63,7 @@ public:
 
 private:
     friend class HybridTaskScheduler;
+    friend class WorkloadGroupFairTaskScheduler;
 
     TaskScheduler(int core_num, std::string name, std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
             : _name(std::move(name)), _task_queue(core_num), _cgroup_cpu_ctl(cgroup_cpu_ctl) {}
@@ -74,26 +79,77 @@ private:
     void _do_work(int index);
 };
 
+// Blockable tasks run in `_blocking_scheduler`. If `pipeline_latency_scheduler_thread_percent` is
+// set, the non-blocking tasks are split into two pools: the tasks of short queries run in
+// `_latency_scheduler`, while the tasks of loads and the tasks which already ran long run in
+// `_simple_scheduler`. The two pools lend their idle workers to each other.
 class HybridTaskScheduler MOCK_REMOVE(final) : public TaskScheduler {
 public:
     HybridTaskScheduler(int core_num, std::string name,
-                        std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
-            : _blocking_scheduler(core_num * 2, name + "_blocking_scheduler", cgroup_cpu_ctl),
-              _simple_scheduler(core_num, name + "_simple_scheduler", cgroup_cpu_ctl) {}
+                        std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl);
+
+    // Stop all the pools before the members are destructed, the pools reference each other.
+    ~HybridTaskScheduler() override { HybridTaskScheduler::stop(); }
 
     Status submit(PipelineTaskSPtr task) override;
 
+    Status submit_batch(std::vector<PipelineTaskSPtr>& tasks) override;
+
     Status start() override;
 
     void stop() override;
 
     std::vector<std::pair<std::string, std::vector<int>>> thread_debug_info() override {
-        return {_blocking_scheduler.thread_debug_info()[0],
+        std::vector<std::pair<std::string, std::vector<int>>> infos {
+                _blocking_scheduler.thread_debug_info()[0],
                 _simple_scheduler.thread_debug_info()[0]};
+        if (_latency_scheduler) {
+            infos.push_back(_latency_scheduler->thread_debug_info()[0]);
+        }
+        return infos;
     }
 
 private:
+    static bool _is_latency_task(const PipelineTaskSPtr& task);
+
     TaskScheduler _blocking_scheduler;
     TaskScheduler _simple_scheduler;
+    std::unique_ptr<TaskScheduler> _latency_scheduler;
+};
+
+// The scheduler shared by all the workload groups if
+// `enable_workload_group_fair_pipeline_scheduler` is set. The non-blocking tasks run in one pool
+// and the groups share it by the cpu time of their tasks, see `GroupFairTaskQueue`. The blockable
+// tasks run in `_blocking_scheduler`. The pools are not bound to the cgroup of any group, so the
+// cpu of the groups is only isolated by the scheduler.
+class WorkloadGroupFairTaskScheduler MOCK_REMOVE(final) : public TaskScheduler {
+public:
+    WorkloadGroupFairTaskScheduler(int core_num, std::string name);
+
+    ~WorkloadGroupFairTaskScheduler() override { WorkloadGroupFairTaskScheduler::stop(); }
+
+    Status submit(PipelineTaskSPtr task) override;
+
+    Status submit_batch(std::vector<PipelineTaskSPtr>& tasks) override;
+
+    Status start() override;
+
+    void stop() override;
+
+    std::vector<std::pair<std::string, std::vector<int>>> thread_debug_info() override {
+        return {_blocking_scheduler.thread_debug_info()[0],
+                {_name, _fix_thread_pool->debug_info()}};
+    }
+
+private:
+    static GroupSchedInfo _group_of(const PipelineTaskSPtr& task);
+
+    void _do_fair_work(int index);
+
+    static constexpr auto WAIT_TASK_TIMEOUT_MS = 100;
+
+    const int _core_num;
+    TaskScheduler _blocking_scheduler;
+    GroupFairTaskQueue _fair_queue;
 };
 } // namespace doris::pipeline
\ No newline at end of file
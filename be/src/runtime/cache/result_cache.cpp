@@ -90,28 +90,31 @@ void ResultCache::update(const PUpdateCacheRequest* request, PCacheResponse* res
     UniqueId sql_key = request->sql_key();
     LOG(INFO) << "update cache, sql key:" << sql_key;
 
-    CacheWriteLock write_lock(_cache_mtx);
-    auto it = _node_map.find(sql_key);
-    if (it != _node_map.end()) {
-        node = it->second;
-        _cache_size -= node->get_data_size();
-        _partition_count -= node->get_partition_count();
-        status = node->update_partition(request, update_first);
-    } else {
-        node = _node_list.new_node(sql_key);
-        status = node->update_partition(request, update_first);
-        _node_list.push_back(node);
-        _node_map[sql_key] = node;
-        _node_count += 1;
-    }
-    if (update_first) {
-        _node_list.move_tail(node);
-    }
-    _cache_size += node->get_data_size();
-    _partition_count += node->get_partition_count();
-    response->set_status(status);
+    auto& shard = get_shard(sql_key);
+    {
+        CacheWriteLock write_lock(shard.cache_mtx);
+        auto it = shard.node_map.find(sql_key);
+        if (it != shard.node_map.end()) {
+            node = it->second;
+            shard.cache_size -= node->get_data_size();
+            shard.partition_count -= node->get_partition_count();
+            status = node->update_partition(request, update_first);
+        } else {
+            node = shard.node_list.new_node(sql_key);
+            status = node->update_partition(request, update_first);
+            shard.node_list.push_back(node);
+            shard.node_map[sql_key] = node;
+            shard.node_count += 1;
+        }
+        if (update_first) {
+            shard.node_list.move_tail(node);
+        }
+        shard.cache_size += node->get_data_size();
+        shard.partition_count += node->get_partition_count();
+        response->set_status(status);
 
-    prune();
+        prune(shard);
+    }
     update_monitor();
 }
 
@@ -123,10 +126,11 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
     ResultNodeMap::iterator node_it;
     const UniqueId sql_key = request->sql_key();
     LOG(INFO) << "fetch cache, sql key:" << sql_key;
+    auto& shard = get_shard(sql_key);
     {
-        CacheReadLock read_lock(_cache_mtx);
-        node_it = _node_map.find(sql_key);
-        if (node_it == _node_map.end()) {
+        CacheReadLock read_lock(shard.cache_mtx);
+        node_it = shard.node_map.find(sql_key);
+        if (node_it == shard.node_map.end()) {
             result->set_status(PCacheStatus::NO_SQL_KEY);
             LOG(INFO) << "no such sql key:" << sql_key;
             return;
@@ -155,14 +159,19 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
     }
 
     if (hit_first) {
-        CacheWriteLock write_lock(_cache_mtx);
-        _node_list.move_tail(node_it->second);
+        CacheWriteLock write_lock(shard.cache_mtx);
+        // the node may be pruned between the two locks
+        node_it = shard.node_map.find(sql_key);
+        if (node_it != shard.node_map.end()) {
+            shard.node_list.move_tail(node_it->second);
+        }
     }
 }
 
 bool ResultCache::contains(const UniqueId& sql_key) {
-    CacheReadLock read_lock(_cache_mtx);
-    return _node_map.find(sql_key) != _node_map.end();
+    auto& shard = get_shard(sql_key);
+    CacheReadLock read_lock(shard.cache_mtx);
+    return shard.node_map.find(sql_key) != shard.node_map.end();
 }
 
 /**
@@ -174,28 +183,33 @@ bool ResultCache::contains(const UniqueId& sql_key) {
  * };
  */
 void ResultCache::clear(const PClearCacheRequest* request, PCacheResponse* response) {
-    LOG(INFO) << "clear cache type" << request->clear_type()
-              << ", node size:" << _node_list.get_node_count() << ", map size:" << _node_map.size();
-    CacheWriteLock write_lock(_cache_mtx);
+    LOG(INFO) << "clear cache type" << request->clear_type();
     //0 clear, 1 prune, 2 before_time,3 sql_key
-    switch (request->clear_type()) {
-    case PClearType::CLEAR_ALL:
-        _node_list.clear();
-        _node_map.clear();
-        _cache_size = 0;
-        _node_count = 0;
-        _partition_count = 0;
-        break;
-    case PClearType::PRUNE_CACHE:
-        prune();
-        break;
-    default:
-        break;
+    for (auto& shard : _shards) {
+        CacheWriteLock write_lock(shard->cache_mtx);
+        switch (request->clear_type()) {
+        case PClearType::CLEAR_ALL:
+            clear_all(*shard);
+            break;
+        case PClearType::PRUNE_CACHE:
+            prune(*shard);
+            break;
+        default:
+            break;
+        }
     }
     update_monitor();
     response->set_status(PCacheStatus::CACHE_OK);
 }
 
+void ResultCache::clear_all(Shard& shard) {
+    shard.node_list.clear();
+    shard.node_map.clear();
+    shard.cache_size = 0;
+    shard.node_count = 0;
+    shard.partition_count = 0;
+}
+
 //private method
 ResultNode* find_min_time_node(ResultNode* result_node) {
     if (result_node->get_prev()) {
@@ -228,19 +242,19 @@ ResultNode* find_min_time_node(ResultNode* result_node) {
 *   4,3,6,8
 *   5,7,9,11,13 //_tail
 */
-void ResultCache::prune() {
-    if (_cache_size <= (_max_size + _elasticity_size)) {
+void ResultCache::prune(Shard& shard) {
+    if (shard.cache_size <= (_max_size + _elasticity_size)) {
         return;
     }
-    LOG(INFO) << "begin prune cache, cache_size : " << _cache_size << ", max_size : " << _max_size
-              << ", elasticity_size : " << _elasticity_size;
-    ResultNode* result_node = _node_list.get_head();
-    while (_cache_size > _max_size) {
+    LOG(INFO) << "begin prune cache, cache_size : " << shard.cache_size.load()
+              << ", max_size : " << _max_size << ", elasticity_size : " << _elasticity_size;
+    ResultNode* result_node = shard.node_list.get_head();
+    while (shard.cache_size > _max_size) {
         if (result_node == nullptr) {
             break;
         }
         result_node = find_min_time_node(result_node);
-        _cache_size -= result_node->prune_first();
+        shard.cache_size -= result_node->prune_first();
         if (result_node->get_data_size() == 0) {
             ResultNode* next_node;
             if (result_node->get_next()) {
@@ -248,35 +262,45 @@ void ResultCache::prune() {
             } else if (result_node->get_prev()) {
                 next_node = result_node->get_prev();
             } else {
-                next_node = _node_list.get_head();
+                next_node = shard.node_list.get_head();
             }
-            remove(result_node);
+            remove(shard, result_node);
             result_node = next_node;
         }
     }
-    LOG(INFO) << "finish prune, cache_size : " << _cache_size;
-    _node_count = _node_map.size();
-    _cache_size = 0;
-    _partition_count = 0;
-    for (auto node_it = _node_map.begin(); node_it != _node_map.end(); node_it++) {
-        _partition_count += node_it->second->get_partition_count();
-        _cache_size += node_it->second->get_data_size();
+    LOG(INFO) << "finish prune, cache_size : " << shard.cache_size.load();
+    shard.node_count = shard.node_map.size();
+    size_t cache_size = 0;
+    size_t partition_count = 0;
+    for (auto node_it = shard.node_map.begin(); node_it != shard.node_map.end(); node_it++) {
+        partition_count += node_it->second->get_partition_count();
+        cache_size += node_it->second->get_data_size();
     }
+    shard.cache_size = cache_size;
+    shard.partition_count = partition_count;
 }
 
-void ResultCache::remove(ResultNode* result_node) {
-    auto node_it = _node_map.find(result_node->get_sql_key());
-    if (node_it != _node_map.end()) {
-        _node_map.erase(node_it);
-        _node_list.remove(result_node);
-        _node_list.delete_node(&result_node);
+void ResultCache::remove(Shard& shard, ResultNode* result_node) {
+    auto node_it = shard.node_map.find(result_node->get_sql_key());
+    if (node_it != shard.node_map.end()) {
+        shard.node_map.erase(node_it);
+        shard.node_list.remove(result_node);
+        shard.node_list.delete_node(&result_node);
     }
 }
 
 void ResultCache::update_monitor() {
-    DorisMetrics::instance()->query_cache_memory_total_byte->set_value(_cache_size);
-    DorisMetrics::instance()->query_cache_sql_total_count->set_value(_node_count);
-    DorisMetrics::instance()->query_cache_partition_total_count->set_value(_partition_count);
+    size_t cache_size = 0;
+    size_t node_count = 0;
+    size_t partition_count = 0;
+    for (const auto& shard : _shards) {
+        cache_size += shard->cache_size;
+        node_count += shard->node_count;
+        partition_count += shard->partition_count;
+    }
+    DorisMetrics::instance()->query_cache_memory_total_byte->set_value(cache_size);
+    DorisMetrics::instance()->query_cache_sql_total_count->set_value(node_count);
+    DorisMetrics::instance()->query_cache_partition_total_count->set_value(partition_count);
 }
 
 } // namespace doris
@@ -17,9 +17,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "runtime/cache/result_node.h"
 #include "util/uid_util.h"
@@ -70,17 +74,21 @@ private:
  */
 class ResultCache {
 public:
-    ResultCache(int32_t max_size, int32_t elasticity_size) {
-        _max_size = static_cast<size_t>(max_size) * 1024 * 1024;
-        _elasticity_size = static_cast<size_t>(elasticity_size) * 1024 * 1024;
-        _cache_size = 0;
-        _node_count = 0;
-        _partition_count = 0;
+    ResultCache(int32_t max_size, int32_t elasticity_size, int32_t num_shards = 1) {
+        num_shards = std::max(num_shards, 1);
+        // every shard owns an equal part of the memory budget and is pruned on its own
+        _max_size = static_cast<size_t>(max_size) * 1024 * 1024 / num_shards;
+        _elasticity_size = static_cast<size_t>(elasticity_size) * 1024 * 1024 / num_shards;
+        for (int32_t i = 0; i < num_shards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>());
+        }
     }
 
     virtual ~ResultCache() {
-        _node_list.clear();
-        _node_map.clear();
+        for (auto& shard : _shards) {
+            shard->node_list.clear();
+            shard->node_map.clear();
+        }
     }
 
     void update(const PUpdateCacheRequest* request, PCacheResponse* response);
@@ -88,24 +96,41 @@ public:
     bool contains(const UniqueId& sql_key);
     void clear(const PClearCacheRequest* request, PCacheResponse* response);
 
-    size_t get_cache_size() { return _cache_size; }
+    size_t get_cache_size() {
+        size_t cache_size = 0;
+        for (const auto& shard : _shards) {
+            cache_size += shard->cache_size;
+        }
+        return cache_size;
+    }
 
 private:
-    void prune();
-    void remove(ResultNode* result_node);
+    // Sql keys are spread over shards, so that fetches and updates of different sqls don't
+    // contend on one lock.
+    struct Shard {
+        //At the same time, multithreaded reading
+        //Single thread updating and cleaning(only single be, Fe is not affected)
+        mutable std::shared_mutex cache_mtx;
+        ResultNodeMap node_map;
+        //List of result nodes corresponding to SqlKey,last recently used at the tail
+        ResultNodeList node_list;
+        // written under cache_mtx, read without it by the monitor
+        std::atomic<size_t> cache_size {0};
+        std::atomic<size_t> node_count {0};
+        std::atomic<size_t> partition_count {0};
+    };
+
+    Shard& get_shard(const UniqueId& sql_key) {
+        return *_shards[std::hash<UniqueId>()(sql_key) % _shards.size()];
+    }
+    void prune(Shard& shard);
+    void clear_all(Shard& shard);
+    void remove(Shard& shard, ResultNode* result_node);
     void update_monitor();
 
-    //At the same time, multithreaded reading
-    //Single thread updating and cleaning(only single be, Fe is not affected)
-    mutable std::shared_mutex _cache_mtx;
-    ResultNodeMap _node_map;
-    //List of result nodes corresponding to SqlKey,last recently used at the tail
-    ResultNodeList _node_list;
-    size_t _cache_size;
+    std::vector<std::unique_ptr<Shard>> _shards;
     size_t _max_size;
     double _elasticity_size;
-    size_t _node_count;
-    size_t _partition_count;
 
 private:
     ResultCache();
@@ -68,6 +68,7 @@ class HdfsMgr;
 namespace segment_v2 {
 class InvertedIndexSearcherCache;
 class InvertedIndexQueryCache;
+class SegmentFooterSnapshot;
 class TmpFileDirs;
 
 namespace inverted_index {
@@ -113,6 +114,7 @@ class ClientCache;
 class HeartbeatFlags;
 class FrontendServiceClient;
 class FileMetaCache;
+class ObjLRUCache;
 class GroupCommitMgr;
 class TabletSchemaCache;
 class TabletColumnObjectPool;
@@ -244,6 +246,8 @@ public:
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
     ThreadPool* non_block_close_thread_pool();
     ThreadPool* s3_file_system_thread_pool() { return _s3_file_system_thread_pool.get(); }
+    ThreadPool* s3_read_hedge_thread_pool() { return _s3_read_hedge_thread_pool.get(); }
+    ThreadPool* text_decompress_thread_pool() { return _text_decompress_thread_pool.get(); }
 
     void init_file_cache_factory(std::vector<doris::CachePath>& cache_paths);
     io::FileCacheFactory* file_cache_factory() { return _file_cache_factory; }
@@ -277,6 +281,7 @@ public:
     HeartbeatFlags* heartbeat_flags() { return _heartbeat_flags; }
     vectorized::ScannerScheduler* scanner_scheduler() { return _scanner_scheduler; }
     FileMetaCache* file_meta_cache() { return _file_meta_cache; }
+    ObjLRUCache* regexp_cache() { return _regexp_cache; }
     MemTableMemoryLimiter* memtable_memory_limiter() { return _memtable_memory_limiter.get(); }
     WalManager* wal_mgr() { return _wal_manager.get(); }
     DNSCache* dns_cache() { return _dns_cache; }
@@ -345,6 +350,9 @@ public:
     SchemaCache* schema_cache() { return _schema_cache; }
     StoragePageCache* get_storage_page_cache() { return _storage_page_cache; }
     SegmentLoader* segment_loader() { return _segment_loader; }
+    segment_v2::SegmentFooterSnapshot* segment_footer_snapshot() {
+        return _segment_footer_snapshot;
+    }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
     RowCache* get_row_cache() { return _row_cache; }
     CacheManager* get_cache_manager() { return _cache_manager; }
@@ -452,6 +460,10 @@ private:
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
     std::unique_ptr<ThreadPool> _non_block_close_thread_pool;
     std::unique_ptr<ThreadPool> _s3_file_system_thread_pool;
+    // Threadpool used to run the GETs of hedged s3 reads
+    std::unique_ptr<ThreadPool> _s3_read_hedge_thread_pool;
+    // Threadpool used to decompress text files ahead of the line parsing
+    std::unique_ptr<ThreadPool> _text_decompress_thread_pool;
 
     FragmentMgr* _fragment_mgr = nullptr;
     WorkloadGroupMgr* _workload_group_manager = nullptr;
@@ -477,6 +489,8 @@ private:
 
     // To save meta info of external file, such as parquet footer.
     FileMetaCache* _file_meta_cache = nullptr;
+    // To save regexps compiled for non constant patterns.
+    ObjLRUCache* _regexp_cache = nullptr;
     std::unique_ptr<MemTableMemoryLimiter> _memtable_memory_limiter;
     std::unique_ptr<LoadStreamMapPool> _load_stream_map_pool;
     std::unique_ptr<vectorized::DeltaWriterV2Pool> _delta_writer_v2_pool;
@@ -499,6 +513,8 @@ private:
     SchemaCache* _schema_cache = nullptr;
     StoragePageCache* _storage_page_cache = nullptr;
     SegmentLoader* _segment_loader = nullptr;
+    // nullptr if segment_footer_snapshot_path is empty
+    segment_v2::SegmentFooterSnapshot* _segment_footer_snapshot = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
     RowCache* _row_cache = nullptr;
     CacheManager* _cache_manager = nullptr;
@@ -54,6 +54,7 @@
 #include "olap/options.h"
 #include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/segment_footer_snapshot.h"
 #include "olap/schema_cache.h"
 #include "olap/segment_loader.h"
 #include "olap/storage_engine.h"
@@ -62,6 +63,7 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema_cache.h"
 #include "olap/wal/wal_manager.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "pipeline/pipeline_tracing.h"
 #include "pipeline/query_cache/query_cache.h"
 #include "pipeline/task_queue.h"
@@ -107,6 +109,7 @@
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
+#include "util/obj_lru_cache.h"
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
 #include "util/threadpool.h"
@@ -278,6 +281,14 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_min_threads(config::min_s3_file_system_thread_num)
                               .set_max_threads(config::max_s3_file_system_thread_num)
                               .build(&_s3_file_system_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("S3ReadHedgeThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(config::max_s3_read_hedge_thread_num)
+                              .build(&_s3_read_hedge_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("TextDecompressThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(config::max_text_decompress_thread_num)
+                              .build(&_text_decompress_thread_pool));
     RETURN_IF_ERROR(_init_mem_env());
 
     // NOTE: runtime query statistics mgr could be visited by query and daemon thread
@@ -291,6 +302,9 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
     doris::io::BeConfDataDirReader::init_be_conf_data_dir(store_paths, spill_store_paths,
                                                           cache_paths);
     _pipeline_tracer_ctx = std::make_unique<pipeline::PipelineTracerContext>(); // before query
+    if (auto st = pipeline::PipelineCpuProfiler::instance()->start(); !st.ok()) {
+        LOG(WARNING) << "Pipeline cpu profiler start failed. " << st;
+    }
     _init_runtime_filter_timer_queue();
 
     _workload_group_manager = new WorkloadGroupMgr();
@@ -298,7 +312,8 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
 
     _fragment_mgr = new FragmentMgr(this);
     _result_cache = new ResultCache(config::query_cache_max_size_mb,
-                                    config::query_cache_elasticity_size_mb);
+                                    config::query_cache_elasticity_size_mb,
+                                    config::query_cache_shard_num);
     _cluster_info = new ClusterInfo();
     _load_path_mgr = new LoadPathMgr(this);
     _bfd_parser = BfdParser::create();
@@ -513,7 +528,8 @@ Status ExecEnv::_init_mem_env() {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            config::compressed_page_cache_percentage);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
@@ -556,6 +572,18 @@ Status ExecEnv::_init_mem_env() {
               << " segment_cache_capacity: " << segment_cache_capacity
               << " min_segment_cache_mem_limit " << segment_cache_mem_limit;
 
+    if (!config::segment_footer_snapshot_path.empty()) {
+        _segment_footer_snapshot = new segment_v2::SegmentFooterSnapshot(
+                config::segment_footer_snapshot_path, config::segment_footer_snapshot_capacity);
+        Status st = _segment_footer_snapshot->load();
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to load segment footer snapshot "
+                         << config::segment_footer_snapshot_path << ": " << st;
+        }
+        RETURN_IF_ERROR(
+                _segment_footer_snapshot->start(config::segment_footer_snapshot_interval_sec));
+    }
+
     _schema_cache = new SchemaCache(config::schema_cache_capacity);
 
     size_t block_file_cache_fd_cache_size =
@@ -566,7 +594,10 @@ Status ExecEnv::_init_mem_env() {
               << config::file_cache_max_file_reader_cache_size;
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num,
+                                         config::max_external_file_page_index_cache_size);
+    _regexp_cache =
+            new ObjLRUCache(CachePolicy::CacheType::REGEXP_CACHE, config::regexp_cache_num);
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -748,6 +779,7 @@ void ExecEnv::destroy() {
     SAFE_STOP(_external_scan_context_mgr);
     SAFE_STOP(_fragment_mgr);
     SAFE_STOP(_runtime_filter_timer_queue);
+    pipeline::PipelineCpuProfiler::instance()->stop();
     // NewLoadStreamMgr should be destoried before storage_engine & after fragment_mgr stopped.
     _load_stream_mgr.reset();
     _new_load_stream_mgr.reset();
@@ -773,6 +805,8 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
+    SAFE_SHUTDOWN(_s3_read_hedge_thread_pool);
+    SAFE_SHUTDOWN(_text_decompress_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
@@ -782,6 +816,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_inverted_index_searcher_cache);
     SAFE_DELETE(_lookup_connection_cache);
     SAFE_DELETE(_schema_cache);
+    // save the footers of the segments opened before shutdown
+    SAFE_DELETE(_segment_footer_snapshot);
     SAFE_DELETE(_segment_loader);
     SAFE_DELETE(_row_cache);
     SAFE_DELETE(_query_cache);
@@ -802,6 +838,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_load_path_mgr);
     SAFE_DELETE(_result_mgr);
     SAFE_DELETE(_file_meta_cache);
+    SAFE_DELETE(_regexp_cache);
     SAFE_DELETE(_group_commit_mgr);
     SAFE_DELETE(_routine_load_task_executor);
     // _stream_load_executor
@@ -825,6 +862,8 @@ void ExecEnv::destroy() {
     _lazy_release_obj_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
+    _s3_read_hedge_thread_pool.reset(nullptr);
+    _text_decompress_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -388,7 +389,8 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
         {
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
+                    result.wait_internal_group_commit_finish,
+                    _group_commit_interval_ms(result.group_commit_interval_ms),
                     result.group_commit_data_bytes);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
@@ -427,6 +429,15 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
     return st;
 }
 
+int64_t GroupCommitTable::_group_commit_interval_ms(int64_t table_interval_ms) const {
+    int64_t min_interval_ms = config::group_commit_adaptive_min_interval_ms;
+    int64_t adaptive_interval_ms = _adaptive_interval_ms;
+    if (min_interval_ms <= 0 || min_interval_ms >= table_interval_ms || adaptive_interval_ms < 0) {
+        return table_interval_ms;
+    }
+    return std::clamp(adaptive_interval_ms, min_interval_ms, table_interval_ms);
+}
+
 Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_id,
                                                    const std::string& label, int64_t txn_id,
                                                    const TUniqueId& instance_id, Status& status,
@@ -517,6 +528,16 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             load_block_queue = it->second;
             if (!status.ok()) {
                 load_block_queue->cancel(status);
+            } else {
+                // a group with a single load only added latency, one which grouped several
+                // loads or filled up by size may batch more with a longer window.
+                auto interval_ms = load_block_queue->get_group_commit_interval_ms();
+                if (load_block_queue->group_commit_load_count > 1 ||
+                    load_block_queue->data_size_condition) {
+                    _adaptive_interval_ms = interval_ms * 2;
+                } else {
+                    _adaptive_interval_ms = interval_ms / 2;
+                }
             }
             //close wal
             RETURN_IF_ERROR(load_block_queue->close_wal());
@@ -178,6 +178,8 @@ private:
     Status _finish_group_commit_load(int64_t db_id, int64_t table_id, const std::string& label,
                                      int64_t txn_id, const TUniqueId& instance_id, Status& status,
                                      RuntimeState* state);
+    // the commit interval of the next load block queue, adapted from the table's interval
+    int64_t _group_commit_interval_ms(int64_t table_interval_ms) const;
 
     ExecEnv* _exec_env = nullptr;
     ThreadPool* _thread_pool = nullptr;
@@ -197,6 +199,8 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+    // interval suggested by the last finished group commit, -1 if there is none
+    std::atomic<int64_t> _adaptive_interval_ms = -1;
 };
 
 class GroupCommitMgr {
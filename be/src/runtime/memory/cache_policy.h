@@ -56,6 +56,9 @@ public:
         QUERY_CACHE = 20,
         TABLET_COLUMN_OBJECT_POOL = 21,
         SCHEMA_CLOUD_DICTIONARY_CACHE = 22,
+        COMPRESSED_DATA_PAGE_CACHE = 23,
+        FILE_PAGE_INDEX_CACHE = 24,
+        REGEXP_CACHE = 25,
     };
 
     static std::string type_string(CacheType type) {
@@ -102,6 +105,12 @@ public:
             return "QueryCache";
         case CacheType::TABLET_COLUMN_OBJECT_POOL:
             return "TabletColumnObjectPool";
+        case CacheType::COMPRESSED_DATA_PAGE_CACHE:
+            return "CompressedDataPageCache";
+        case CacheType::FILE_PAGE_INDEX_CACHE:
+            return "FilePageIndexCache";
+        case CacheType::REGEXP_CACHE:
+            return "RegexpCache";
         default:
             throw Exception(Status::FatalError("not match type of cache policy :{}",
                                                static_cast<int>(type)));
@@ -131,6 +140,9 @@ public:
             {"ForUTCacheNumber", CacheType::FOR_UT_CACHE_NUMBER},
             {"QueryCache", CacheType::QUERY_CACHE},
             {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL},
+            {"CompressedDataPageCache", CacheType::COMPRESSED_DATA_PAGE_CACHE},
+            {"FilePageIndexCache", CacheType::FILE_PAGE_INDEX_CACHE},
+            {"RegexpCache", CacheType::REGEXP_CACHE},
     };
 
     static CacheType string_to_type(std::string type) {
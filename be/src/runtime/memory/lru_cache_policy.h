@@ -37,13 +37,14 @@ public:
     LRUCachePolicy(CacheType type, size_t capacity, LRUCacheType lru_cache_type,
                    uint32_t stale_sweep_time_s, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS,
                    uint32_t element_count_capacity = DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY,
-                   bool enable_prune = true, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K)
+                   bool enable_prune = true,
+                   LRUCacheEvictionPolicy eviction_policy = DEFAULT_LRU_CACHE_EVICTION_POLICY)
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, eviction_policy));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -56,14 +57,14 @@ public:
                    uint32_t element_count_capacity,
                    CacheValueTimeExtractor cache_value_time_extractor,
                    bool cache_value_check_timestamp, bool enable_prune = true,
-                   bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K)
+                   LRUCacheEvictionPolicy eviction_policy = DEFAULT_LRU_CACHE_EVICTION_POLICY)
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         cache_value_time_extractor, cache_value_check_timestamp,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, eviction_policy));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
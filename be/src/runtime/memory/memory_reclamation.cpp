@@ -25,6 +25,7 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/runtime_query_statistics_mgr.h"
 #include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_group/workload_group_manager.h"
 #include "util/mem_info.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
@@ -32,6 +33,20 @@
 namespace doris {
 #include "common/compile_check_begin.h"
 
+bool MemoryReclamation::request_spill(ResourceContext* resource_ctx, const Status& reason) {
+    // the paused queries are handled per workload group
+    if (resource_ctx->workload_group() == nullptr) {
+        return false;
+    }
+    resource_ctx->task_controller()->set_revoke_requested_time();
+    // the paused query handler spills the revocable tasks once none of them is running,
+    // and resumes the query when the spill is done.
+    ExecEnv::GetInstance()->workload_group_mgr()->add_paused_query(
+            resource_ctx->shared_from_this(), 0,
+            Status::Error<ErrorCode::QUERY_MEMORY_EXCEEDED, false>(reason.msg()));
+    return true;
+}
+
 int64_t MemoryReclamation::revoke_tasks_memory(
         int64_t need_free_mem, const std::vector<std::shared_ptr<ResourceContext>>& resource_ctxs,
         const std::string& revoke_reason, RuntimeProfile* profile, PriorityCmpFunc priority_cmp,
@@ -124,7 +139,23 @@ int64_t MemoryReclamation::revoke_tasks_memory(
                 is_filtered = true;
             }
 
-            // TODO, if ActionFunc::SPILL, should skip spilling tasks.
+            // skip the tasks already asked to spill, like the cancelling ones, their revocable
+            // memory is counted in `freed_memory` until revoke_memory_max_tolerance_ms passed.
+            if (!is_filtered && action == ActionFunc::SPILL &&
+                !resource_ctx->task_controller()->paused_reason().ok()) {
+                if (MonotonicMillis() - resource_ctx->task_controller()->revoke_requested_time() >
+                    config::revoke_memory_max_tolerance_ms) {
+                    skip_cancelling_tasks.push_back(
+                            resource_ctx->task_controller()->debug_string());
+                } else {
+                    keep_wait_cancelling_tasks.push_back(
+                            resource_ctx->task_controller()->debug_string());
+                    COUNTER_UPDATE(freed_memory_counter,
+                                   static_cast<int64_t>(
+                                           resource_ctx->task_controller()->get_revocable_size()));
+                }
+                is_filtered = true;
+            }
 
             if (is_filtered) {
                 continue;
@@ -149,6 +180,12 @@ int64_t MemoryReclamation::revoke_tasks_memory(
         SCOPED_TIMER(revoke_cost_time);
         while (!revocable_resource_ctxs.empty()) {
             auto resource_ctx = revocable_resource_ctxs.top().second;
+            // spilling only frees the revocable memory, which is the weight of
+            // TOP_REVOCABLE_MEMORY, cancelling frees all memory of the task.
+            int64_t expected_freed_mem =
+                    action == ActionFunc::SPILL
+                            ? revocable_resource_ctxs.top().first
+                            : resource_ctx->memory_context()->current_memory_bytes();
             std::string task_revoke_reason = fmt::format(
                     "{} {} task: {}. because {}. in backend {}, {} execute again after enough "
                     "memory, details see be.INFO.",
@@ -158,8 +195,7 @@ int64_t MemoryReclamation::revoke_tasks_memory(
             if (ActionFuncImpl[action](resource_ctx.get(),
                                        Status::MemoryLimitExceeded(task_revoke_reason))) {
                 this_time_revoked_tasks.push_back(resource_ctx->task_controller()->debug_string());
-                COUNTER_UPDATE(freed_memory_counter,
-                               resource_ctx->memory_context()->current_memory_bytes());
+                COUNTER_UPDATE(freed_memory_counter, expected_freed_mem);
                 COUNTER_UPDATE(this_time_revoked_tasks_counter, 1);
                 if (freed_memory_counter->value() > need_free_mem) {
                     break;
@@ -171,6 +207,7 @@ int64_t MemoryReclamation::revoke_tasks_memory(
     return freed_memory_counter->value();
 }
 
+// step0: if enable_spill_in_memory_gc, spill the queries with the most revocable memory.
 // step1: free process top memory query
 // step2: free process top memory load, load retries are more expensive, so revoke at the end.
 bool MemoryReclamation::revoke_process_memory(const std::string& revoke_reason) {
@@ -195,6 +232,25 @@ bool MemoryReclamation::revoke_process_memory(const std::string& revoke_reason)
                 PrettyPrinter::print_bytes(freed_mem), watch.elapsed_time() / 1000, ss.str());
     }};
 
+    std::vector<std::shared_ptr<ResourceContext>> resource_ctxs;
+    ExecEnv::GetInstance()->runtime_query_statistics_mgr()->get_tasks_resource_context(
+            resource_ctxs);
+
+    // step0: ask the queries with the largest revocable memory to spill, cancelling them loses
+    // all the work done so far, so it is only done when spilling can not free enough memory.
+    if (config::enable_spill_in_memory_gc) {
+        RuntimeProfile* spill_top_revocable_query_profile =
+                profile->create_child("SpillTopRevocableMemoryQuery", true, true);
+        freed_mem += revoke_tasks_memory(MemInfo::process_full_gc_size() - freed_mem,
+                                         resource_ctxs, revoke_reason,
+                                         spill_top_revocable_query_profile,
+                                         PriorityCmpFunc::TOP_REVOCABLE_MEMORY,
+                                         {FilterFunc::IS_QUERY}, ActionFunc::SPILL);
+        if (freed_mem > MemInfo::process_full_gc_size()) {
+            return true;
+        }
+    }
+
     // step1: start canceling from the query with the largest memory usage until the memory of process_full_gc_size is freed.
     VLOG_DEBUG << fmt::format(
             "[MemoryGC] before free top memory query in revoke process memory, Type:{}, Memory "
@@ -204,9 +260,6 @@ bool MemoryReclamation::revoke_process_memory(const std::string& revoke_reason)
             MemTrackerLimiter::make_type_trackers_profile_str(MemTrackerLimiter::Type::QUERY));
     RuntimeProfile* free_top_query_profile =
             profile->create_child("FreeTopMemoryQuery", true, true);
-    std::vector<std::shared_ptr<ResourceContext>> resource_ctxs;
-    ExecEnv::GetInstance()->runtime_query_statistics_mgr()->get_tasks_resource_context(
-            resource_ctxs);
     freed_mem +=
             revoke_tasks_memory(MemInfo::process_full_gc_size() - freed_mem, resource_ctxs,
                                 revoke_reason, free_top_query_profile, PriorityCmpFunc::TOP_MEMORY,
@@ -30,7 +30,11 @@ constexpr size_t SMALL_MEMORY_TASK = 32 * 1024 * 1024; // 32M
 
 class MemoryReclamation {
 public:
-    enum class PriorityCmpFunc { TOP_MEMORY = 0, TOP_OVERCOMMITED_MEMORY = 1 };
+    enum class PriorityCmpFunc {
+        TOP_MEMORY = 0,
+        TOP_OVERCOMMITED_MEMORY = 1,
+        TOP_REVOCABLE_MEMORY = 2
+    };
     enum class FilterFunc {
         EXCLUDE_IS_SMALL = 0,
         EXCLUDE_IS_OVERCOMMITED = 1,
@@ -38,7 +42,7 @@ public:
         IS_LOAD = 3,
         IS_COMPACTION = 4
     };
-    enum class ActionFunc { CANCEL = 0 };
+    enum class ActionFunc { CANCEL = 0, SPILL = 1 };
 
     inline static std::unordered_map<PriorityCmpFunc,
                                      const std::function<int64_t(ResourceContext*)>>
@@ -58,6 +62,15 @@ public:
                                  (static_cast<double>(mem_size) / static_cast<double>(mem_limit)) *
                                  1000000); // mem_size will not be greater than 9000G, so not overflow int64_t.
                      }},
+                    {PriorityCmpFunc::TOP_REVOCABLE_MEMORY,
+                     [](ResourceContext* resource_ctx) {
+                         auto revocable_size = static_cast<int64_t>(
+                                 resource_ctx->task_controller()->get_revocable_size());
+                         if (revocable_size < static_cast<int64_t>(SMALL_MEMORY_TASK)) {
+                             return static_cast<int64_t>(-1); // too little to spill.
+                         }
+                         return revocable_size;
+                     }},
     };
 
     static std::string priority_cmp_func_string(PriorityCmpFunc func) {
@@ -66,6 +79,8 @@ public:
             return "Top Memory";
         case PriorityCmpFunc::TOP_OVERCOMMITED_MEMORY:
             return "Top Overcommited Memory";
+        case PriorityCmpFunc::TOP_REVOCABLE_MEMORY:
+            return "Top Revocable Memory";
         default:
             return "Error";
         }
@@ -120,6 +135,9 @@ public:
         return join(func_strs, ",");
     }
 
+    // Pause the query and let the paused query handler spill its revocable memory.
+    static bool request_spill(ResourceContext* resource_ctx, const Status& reason);
+
     inline static std::unordered_map<ActionFunc,
                                      const std::function<bool(ResourceContext*, const Status&)>>
             ActionFuncImpl = {
@@ -127,13 +145,15 @@ public:
                      [](ResourceContext* resource_ctx, const Status& reason) {
                          return resource_ctx->task_controller()->cancel(reason);
                      }},
-                    // TODO, FilterFunc::SPILL, etc.
+                    {ActionFunc::SPILL, request_spill},
     };
 
     static std::string action_func_string(ActionFunc func) {
         switch (func) {
         case ActionFunc::CANCEL:
             return "Cancel";
+        case ActionFunc::SPILL:
+            return "Spill";
         default:
             return "Error";
         }
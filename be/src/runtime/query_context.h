@@ -44,6 +44,8 @@
 
 namespace doris {
 
+class QueryCacheHandle;
+
 namespace pipeline {
 class PipelineFragmentContext;
 class PipelineTask;
@@ -149,6 +151,25 @@ public:
         }
     }
 
+    // The olap scan of an incremental query cache reads only the versions after the cached
+    // entry, it hands that entry over to the cache source of the same fragment instance.
+    void set_query_cache_delta_base(const std::string& key,
+                                    std::shared_ptr<QueryCacheHandle> handle) {
+        std::lock_guard<std::mutex> l(_query_cache_delta_base_lock);
+        _query_cache_delta_bases[key] = std::move(handle);
+    }
+
+    std::shared_ptr<QueryCacheHandle> take_query_cache_delta_base(const std::string& key) {
+        std::lock_guard<std::mutex> l(_query_cache_delta_base_lock);
+        auto iter = _query_cache_delta_bases.find(key);
+        if (iter == _query_cache_delta_bases.end()) {
+            return nullptr;
+        }
+        auto handle = std::move(iter->second);
+        _query_cache_delta_bases.erase(iter);
+        return handle;
+    }
+
     Status set_workload_group(WorkloadGroupPtr& wg);
 
     int execution_timeout() const {
@@ -306,6 +327,9 @@ private:
 
     std::unordered_map<int, vectorized::RuntimePredicate> _runtime_predicates;
 
+    std::mutex _query_cache_delta_base_lock;
+    std::unordered_map<std::string, std::shared_ptr<QueryCacheHandle>> _query_cache_delta_bases;
+
     std::unique_ptr<RuntimeFilterMgr> _runtime_filter_mgr;
     const TQueryOptions _query_options;
 
@@ -189,8 +189,80 @@ Status KafkaDataConsumer::assign_topic_partitions(
     return Status::OK();
 }
 
+void KafkaMessageBatch::add(const RdKafka::Message& msg, bool line_delimited) {
+    data.append(static_cast<const char*>(msg.payload()), msg.len());
+    if (line_delimited) {
+        data.push_back('\n');
+    }
+    ends.push_back(data.size());
+    bytes += static_cast<int64_t>(msg.len());
+    offsets[msg.partition()] = msg.offset();
+}
+
+void KafkaMessageBatch::add_partition_eof(const RdKafka::Message& msg) {
+    if (msg.offset() > 0) {
+        offsets[msg.partition()] = msg.offset() - 1;
+    }
+}
+
 Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                                         int64_t max_running_time_ms) {
+    return _group_consume(
+            max_running_time_ms,
+            [queue](std::unique_ptr<RdKafka::Message> msg) {
+                if (!queue->controlled_blocking_put(msg.get(),
+                                                    config::blocking_queue_cv_wait_timeout_ms)) {
+                    return false;
+                }
+                msg.release(); // release the ownership, msg will be deleted after being processed
+                return true;
+            },
+            [] { return true; });
+}
+
+Status KafkaDataConsumer::group_consume_batch(BlockingQueue<KafkaMessageBatch*>* queue,
+                                              int64_t max_running_time_ms, size_t batch_size,
+                                              bool line_delimited) {
+    // A batch is handed over once it is full or has waited this long, so that a slow topic does
+    // not delay its msgs until the end of the task.
+    static constexpr int64_t MAX_BATCH_WAIT_MS = 100;
+    auto batch = std::make_unique<KafkaMessageBatch>();
+    MonotonicStopWatch batch_watch;
+    auto flush = [&]() {
+        if (batch->rows() == 0 && batch->offsets.empty()) {
+            return true;
+        }
+        if (!queue->controlled_blocking_put(batch.get(),
+                                            config::blocking_queue_cv_wait_timeout_ms)) {
+            return false;
+        }
+        batch.release(); // the batch will be deleted after being processed
+        batch = std::make_unique<KafkaMessageBatch>();
+        return true;
+    };
+    return _group_consume(
+            max_running_time_ms,
+            [&](std::unique_ptr<RdKafka::Message> msg) {
+                if (batch->rows() == 0 && batch->offsets.empty()) {
+                    batch_watch.reset();
+                    batch_watch.start();
+                }
+                if (msg->err() == RdKafka::ERR_NO_ERROR) {
+                    batch->add(*msg, line_delimited);
+                } else {
+                    batch->add_partition_eof(*msg);
+                }
+                if (batch->rows() >= batch_size ||
+                    batch_watch.elapsed_time() / 1000 / 1000 >= MAX_BATCH_WAIT_MS) {
+                    return flush();
+                }
+                return true;
+            },
+            flush);
+}
+
+Status KafkaDataConsumer::_group_consume(int64_t max_running_time_ms, const MessageSink& put,
+                                         const std::function<bool()>& flush) {
     static constexpr int MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE = 3;
     int64_t left_time = max_running_time_ms;
     LOG(INFO) << "start kafka consumer: " << _id << ", grp: " << _grp_id
@@ -243,13 +315,11 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
                 break;
-            } else if (!queue->controlled_blocking_put(msg.get(),
-                                                       config::blocking_queue_cv_wait_timeout_ms)) {
+            } else if (!put(std::move(msg))) {
                 // queue is shutdown
                 done = true;
             } else {
                 ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
             }
             ++received_rows;
             DorisMetrics::instance()->routine_load_consume_rows->increment(1);
@@ -258,6 +328,9 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
             LOG(INFO) << "kafka consume timeout: " << _id;
+            if (!flush()) {
+                done = true;
+            }
             break;
         case RdKafka::ERR__TRANSPORT:
             LOG(INFO) << "kafka consume Disconnected: " << _id
@@ -271,15 +344,11 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             VLOG_NOTICE << "consumer meet partition eof: " << _id
                         << " partition offset: " << msg->offset();
             _consuming_partition_ids.erase(msg->partition());
-            if (!queue->controlled_blocking_put(msg.get(),
-                                                config::blocking_queue_cv_wait_timeout_ms)) {
+            if (!put(std::move(msg))) {
                 done = true;
             } else if (_consuming_partition_ids.size() <= 0) {
                 LOG(INFO) << "all partitions meet eof: " << _id;
-                msg.release();
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -304,6 +373,7 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             break;
         }
     }
+    static_cast<void>(flush());
 
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <ctime>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,6 +40,25 @@ namespace doris {
 template <typename T>
 class BlockingQueue;
 
+// The messages of a kafka consumer packed into one contiguous buffer, so that they are handed to
+// the stream load pipe in bulk. Only the messages of the partitions of one consumer, which are in
+// offset order.
+struct KafkaMessageBatch {
+    // The payloads, each followed by a line delimiter for the line delimited formats.
+    std::string data;
+    // The end of each message in `data`, including its delimiter.
+    std::vector<size_t> ends;
+    // The sum of the payload sizes.
+    int64_t bytes = 0;
+    // The offset to commit per partition once the batch is loaded.
+    std::map<int32_t, int64_t> offsets;
+
+    size_t rows() const { return ends.size(); }
+
+    void add(const RdKafka::Message& msg, bool line_delimited);
+    void add_partition_eof(const RdKafka::Message& msg);
+};
+
 class DataConsumer {
 public:
     DataConsumer()
@@ -146,6 +166,10 @@ public:
 
     // start the consumer and put msgs to queue
     Status group_consume(BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put msgs to queue in batches of up to `batch_size` msgs
+    Status group_consume_batch(BlockingQueue<KafkaMessageBatch*>* queue,
+                               int64_t max_running_time_ms, size_t batch_size,
+                               bool line_delimited);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids);
@@ -160,6 +184,14 @@ public:
                                            std::vector<PIntegerPair>* offsets, int timeout);
 
 private:
+    // Takes a data or partition eof msg, returns false if the queue is shutdown.
+    using MessageSink = std::function<bool(std::unique_ptr<RdKafka::Message>)>;
+
+    // `flush` is called when no msg is received in time and before returning, it returns false
+    // if the queue is shutdown.
+    Status _group_consume(int64_t max_running_time_ms, const MessageSink& put,
+                          const std::function<bool()>& flush);
+
     std::string _brokers;
     std::string _topic;
     std::unordered_map<std::string, std::string> _custom_properties;
@@ -19,11 +19,14 @@
 #include <gen_cpp/PlanNodes_types.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "librdkafka/rdkafkacpp.h"
 #include "runtime/routine_load/data_consumer.h"
@@ -59,7 +62,7 @@ Status KafkaDataConsumerGroup::assign_topic_partitions(std::shared_ptr<StreamLoa
 
 KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
-    _queue.shutdown();
+    _shutdown_queues();
     while (true) {
         RdKafka::Message* msg;
         if (_queue.blocking_get(&msg)) {
@@ -70,28 +73,44 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
         }
     }
     DCHECK(_queue.get_size() == 0);
+    KafkaMessageBatch* batch;
+    while (_batch_queue.blocking_get(&batch)) {
+        delete batch;
+    }
 }
 
 Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
                                          std::shared_ptr<io::KafkaConsumerPipe> kafka_pipe) {
     Status result_st = Status::OK();
+    const bool is_json = ctx->format == TFileFormatType::FORMAT_JSON;
+    const auto batch_size =
+            static_cast<size_t>(std::max(config::routine_load_consume_batch_size, 1));
+    ConsumeFinishCallback finish_cb = [this, &result_st](const Status& st) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _counter--;
+        VLOG_CRITICAL << "group counter is: " << _counter << ", grp: " << _grp_id;
+        if (_counter == 0) {
+            _shutdown_queues();
+            LOG(INFO) << "all consumers are finished. shutdown queue. group id: " << _grp_id;
+        }
+        if (result_st.ok() && !st.ok()) {
+            result_st = st;
+        }
+    };
     // start all consumers
     for (auto& consumer : _consumers) {
-        if (!_thread_pool.offer(std::bind<void>(
-                    &KafkaDataConsumerGroup::actual_consume, this, consumer, &_queue,
-                    ctx->max_interval_s * 1000, [this, &result_st](const Status& st) {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _counter--;
-                        VLOG_CRITICAL << "group counter is: " << _counter << ", grp: " << _grp_id;
-                        if (_counter == 0) {
-                            _queue.shutdown();
-                            LOG(INFO) << "all consumers are finished. shutdown queue. group id: "
-                                      << _grp_id;
-                        }
-                        if (result_st.ok() && !st.ok()) {
-                            result_st = st;
-                        }
-                    }))) {
+        // The consumers pack the msgs of their own partitions in parallel, so that this thread
+        // only hands them to the pipe.
+        PriorityThreadPool::WorkFunction consume_fn;
+        if (batch_size > 1) {
+            consume_fn = std::bind<void>(&KafkaDataConsumerGroup::actual_consume_batch, this,
+                                         consumer, ctx->max_interval_s * 1000, batch_size,
+                                         !is_json, finish_cb);
+        } else {
+            consume_fn = std::bind<void>(&KafkaDataConsumerGroup::actual_consume, this, consumer,
+                                         &_queue, ctx->max_interval_s * 1000, finish_cb);
+        }
+        if (!_thread_pool.offer(std::move(consume_fn))) {
             LOG(WARNING) << "failed to submit data consumer: " << consumer->id()
                          << ", group id: " << _grp_id;
             return Status::InternalError("failed to submit data consumer");
@@ -115,7 +134,7 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
 
     //improve performance
     Status (io::KafkaConsumerPipe::*append_data)(const char* data, size_t size);
-    if (ctx->format == TFileFormatType::FORMAT_JSON) {
+    if (is_json) {
         append_data = &io::KafkaConsumerPipe::append_json;
     } else {
         append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
@@ -132,12 +151,14 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
                       << ", received bytes=" << ctx->max_batch_size - left_bytes << ", eos: " << eos
                       << ", left_time: " << left_time << ", left_rows: " << left_rows
                       << ", left_bytes: " << left_bytes
-                      << ", blocking get time(us): " << _queue.total_get_wait_time() / 1000
-                      << ", blocking put time(us): " << _queue.total_put_wait_time() / 1000 << ", "
-                      << ctx->brief();
+                      << ", blocking get time(us): "
+                      << (_queue.total_get_wait_time() + _batch_queue.total_get_wait_time()) / 1000
+                      << ", blocking put time(us): "
+                      << (_queue.total_put_wait_time() + _batch_queue.total_put_wait_time()) / 1000
+                      << ", " << ctx->brief();
 
             // shutdown queue
-            _queue.shutdown();
+            _shutdown_queues();
             // cancel all consumers
             for (auto& consumer : _consumers) {
                 static_cast<void>(consumer->cancel(ctx));
@@ -156,6 +177,35 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
+        if (batch_size > 1) {
+            KafkaMessageBatch* batch;
+            if (_batch_queue.controlled_blocking_get(&batch,
+                                                     config::blocking_queue_cv_wait_timeout_ms)) {
+                std::unique_ptr<KafkaMessageBatch> batch_ptr(batch);
+                Status st = _append_batch(*batch, is_json, kafka_pipe.get());
+                if (st.ok()) {
+                    left_rows -= static_cast<int64_t>(batch->rows());
+                    left_bytes -= batch->bytes;
+                    for (const auto& [partition, offset] : batch->offsets) {
+                        cmt_offset[partition] = offset;
+                    }
+                } else {
+                    // failed to append this batch, we must stop
+                    LOG(WARNING) << "failed to append msgs to pipe. grp: " << _grp_id;
+                    eos = true;
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (result_st.ok()) {
+                        result_st = st;
+                    }
+                }
+            } else {
+                // queue is empty and shutdown
+                eos = true;
+            }
+            left_time = ctx->max_interval_s * 1000 - watch.elapsed_time() / 1000 / 1000;
+            continue;
+        }
+
         RdKafka::Message* msg;
         bool res = _queue.controlled_blocking_get(&msg, config::blocking_queue_cv_wait_timeout_ms);
         if (res) {
@@ -201,6 +251,31 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
     return Status::OK();
 }
 
+Status KafkaDataConsumerGroup::_append_batch(const KafkaMessageBatch& batch, bool json,
+                                             io::KafkaConsumerPipe* kafka_pipe) {
+    if (batch.rows() == 0) {
+        return Status::OK();
+    }
+    if (!json) {
+        return kafka_pipe->append(batch.data.data(), batch.data.size());
+    }
+    // The json reader parses one buffer of the pipe as one json document.
+    size_t begin = 0;
+    for (auto end : batch.ends) {
+        RETURN_IF_ERROR(kafka_pipe->append_json(batch.data.data() + begin, end - begin));
+        begin = end;
+    }
+    return Status::OK();
+}
+
+void KafkaDataConsumerGroup::actual_consume_batch(std::shared_ptr<DataConsumer> consumer,
+                                                  int64_t max_running_time_ms, size_t batch_size,
+                                                  bool line_delimited, ConsumeFinishCallback cb) {
+    Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume_batch(
+            &_batch_queue, max_running_time_ms, batch_size, line_delimited);
+    cb(st);
+}
+
 void KafkaDataConsumerGroup::actual_consume(std::shared_ptr<DataConsumer> consumer,
                                             BlockingQueue<RdKafka::Message*>* queue,
                                             int64_t max_running_time_ms, ConsumeFinishCallback cb) {
@@ -87,7 +87,8 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t consumer_num) : DataConsumerGroup(consumer_num), _queue(500) {}
+    KafkaDataConsumerGroup(size_t consumer_num)
+            : DataConsumerGroup(consumer_num), _queue(500), _batch_queue(16) {}
 
     virtual ~KafkaDataConsumerGroup();
 
@@ -101,10 +102,25 @@ private:
     void actual_consume(std::shared_ptr<DataConsumer> consumer,
                         BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
                         ConsumeFinishCallback cb);
+    // start a single consumer putting batches of msgs
+    void actual_consume_batch(std::shared_ptr<DataConsumer> consumer, int64_t max_running_time_ms,
+                              size_t batch_size, bool line_delimited, ConsumeFinishCallback cb);
+
+    // append the msgs of a batch to the pipe, one msg per buffer for json
+    static Status _append_batch(const KafkaMessageBatch& batch, bool json,
+                                io::KafkaConsumerPipe* kafka_pipe);
+
+    void _shutdown_queues() {
+        _queue.shutdown();
+        _batch_queue.shutdown();
+    }
 
 private:
     // blocking queue to receive msgs from all consumers
     BlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive batches of msgs from all consumers, if
+    // `routine_load_consume_batch_size` is larger than 1
+    BlockingQueue<KafkaMessageBatch*> _batch_queue;
 };
 #include "common/compile_check_end.h"
 
@@ -23,6 +23,7 @@
 #include <gen_cpp/Types_types.h>
 #include <thrift/TApplicationException.h>
 
+#include <algorithm>
 #include <condition_variable>
 #include <cstdint>
 #include <memory>
@@ -38,6 +39,7 @@
 #include "exec/schema_scanner/schema_scanner_helper.h"
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
+#include "runtime/workload_management/io_context.h"
 #include "util/debug_util.h"
 #include "util/threadpool.h"
 #include "util/thrift_client.h"
@@ -359,7 +361,7 @@ void RuntimeQueryStatisticsMgr::report_runtime_query_statistics() {
             // external query not need to report to FE, so we can remove it directly.
             if (resource_ctx->task_controller()->query_type() == TQueryType::EXTERNAL &&
                 is_query_finished) {
-                iter = _resource_contexts_map.erase(iter);
+                iter = _erase_resource_context(iter);
             } else {
                 if (resource_ctx->task_controller()->query_type() != TQueryType::EXTERNAL) {
                     if (fe_qs_map.find(resource_ctx->task_controller()->fe_addr()) ==
@@ -467,13 +469,40 @@ void RuntimeQueryStatisticsMgr::report_runtime_query_statistics() {
                 bool is_query_finished = qs_status_pair.first;
                 bool is_timeout_after_finish = qs_status_pair.second;
                 if ((is_rpc_success && is_query_finished) || is_timeout_after_finish) {
-                    _resource_contexts_map.erase(query_id);
+                    if (auto iter = _resource_contexts_map.find(query_id);
+                        iter != _resource_contexts_map.end()) {
+                        _erase_resource_context(iter);
+                    }
                 }
             }
         }
     }
 }
 
+RuntimeQueryStatisticsMgr::ResourceContextMap::iterator
+RuntimeQueryStatisticsMgr::_erase_resource_context(ResourceContextMap::iterator iter) {
+    if (IOLedger::enabled()) {
+        const auto top_files = static_cast<size_t>(std::max(config::query_io_ledger_top_files, 0));
+        const auto& resource_ctx = iter->second;
+        auto wg = resource_ctx->workload_group();
+        _finished_io_ledgers[wg ? static_cast<int64_t>(wg->id()) : -1].merge(
+                resource_ctx->io_context()->io_ledger()->snapshot(top_files), top_files);
+    }
+    return _resource_contexts_map.erase(iter);
+}
+
+void RuntimeQueryStatisticsMgr::get_workload_io_ledgers(
+        std::map<int64_t, IOLedger::Snapshot>* ledgers) {
+    const auto top_files = static_cast<size_t>(std::max(config::query_io_ledger_top_files, 0));
+    std::shared_lock<std::shared_mutex> read_lock(_resource_contexts_map_lock);
+    *ledgers = _finished_io_ledgers;
+    for (auto& [query_id, resource_ctx] : _resource_contexts_map) {
+        auto wg = resource_ctx->workload_group();
+        (*ledgers)[wg ? static_cast<int64_t>(wg->id()) : -1].merge(
+                resource_ctx->io_context()->io_ledger()->snapshot(top_files), top_files);
+    }
+}
+
 void RuntimeQueryStatisticsMgr::get_active_be_tasks_block(vectorized::Block* block) {
     std::shared_lock<std::shared_mutex> read_lock(_resource_contexts_map_lock);
     int64_t be_id = ExecEnv::GetInstance()->cluster_info()->backend_id;
@@ -22,12 +22,14 @@
 #include <gen_cpp/Types_types.h>
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
+#include "runtime/workload_management/io_ledger.h"
 #include "runtime/workload_management/resource_context.h"
 #include "util/threadpool.h"
 
@@ -60,6 +62,10 @@ public:
     // used for MemoryReclamation
     void get_tasks_resource_context(std::vector<std::shared_ptr<ResourceContext>>& resource_ctxs);
 
+    // The IO ledgers of the running and finished queries summed per workload group id, -1 for the
+    // queries without a workload group. See `enable_query_io_ledger`.
+    void get_workload_io_ledgers(std::map<int64_t, IOLedger::Snapshot>* ledgers);
+
     // Called by main threads when backend starts.
     Status start_report_thread();
     // Called by main threads when backend stops.
@@ -74,11 +80,19 @@ public:
     void trigger_profile_reporting();
 
 private:
+    using ResourceContextMap = std::map<std::string, std::shared_ptr<ResourceContext>>;
+
+    // Keep the IO ledger of the query before removing it. Must hold `_resource_contexts_map_lock`.
+    ResourceContextMap::iterator _erase_resource_context(ResourceContextMap::iterator iter);
+
     std::shared_mutex _resource_contexts_map_lock;
     // Must be shared_ptr of ResourceContext, because ResourceContext can only be removed from
     // _resource_contexts_map after QueryStatistics is reported to FE,
     // at which time the Query may have ended.
     std::map<std::string, std::shared_ptr<ResourceContext>> _resource_contexts_map;
+    // The IO ledgers of the queries removed from `_resource_contexts_map`, per workload group id.
+    // Protected by `_resource_contexts_map_lock`.
+    std::map<int64_t, IOLedger::Snapshot> _finished_io_ledgers;
 
     std::atomic_bool started = false;
     std::mutex _profile_map_lock;
@@ -49,6 +49,7 @@
 #include "runtime/workload_group/workload_group.h"
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "vec/runtime/vector_search_user_params.h"
 
 namespace doris {
@@ -482,6 +483,19 @@ public:
 
     [[nodiscard]] bool low_memory_mode() const;
 
+    // Cooperative yield of long running operators. The pipeline task sets the deadline of its
+    // time slice before running. Operators which may run for a long time inside one call check
+    // `should_yield()` in their loops: a source just returns what it has got, a sink calls
+    // `set_sink_yielded()` and returns, then the task keeps the block and sinks it again in the
+    // next time slice.
+    void set_time_slice_deadline(int64_t deadline_ns) { _time_slice_deadline_ns = deadline_ns; }
+    bool should_yield() const {
+        return _time_slice_deadline_ns > 0 && MonotonicNanos() > _time_slice_deadline_ns;
+    }
+    void set_sink_yielded() { _sink_yielded = true; }
+    // Return whether the sink yielded in the middle of the last block, and reset the flag.
+    bool get_and_reset_sink_yielded() { return std::exchange(_sink_yielded, false); }
+
     std::weak_ptr<QueryContext> get_query_ctx_weak();
     MOCK_FUNCTION WorkloadGroupPtr workload_group();
 
@@ -674,7 +688,9 @@ public:
     VectorSearchUserParams get_vector_search_params() const {
         return VectorSearchUserParams(_query_options.hnsw_ef_search,
                                       _query_options.hnsw_check_relative_distance,
-                                      _query_options.hnsw_bounded_queue);
+                                      _query_options.hnsw_bounded_queue,
+                                      config::ann_index_ivf_nprobe,
+                                      config::ann_index_ivf_refine_factor);
     }
 
 private:
@@ -774,6 +790,9 @@ private:
     int _max_operator_id = 0;
     pipeline::PipelineTask* _task = nullptr;
     int _task_id = -1;
+    // 0 means the operators should never yield
+    int64_t _time_slice_deadline_ns = 0;
+    bool _sink_yielded = false;
     int _task_num = 0;
 
     mutable std::mutex _hive_partition_updates_mutex;
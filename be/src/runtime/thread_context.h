@@ -191,6 +191,10 @@ public:
 
     bool is_attach_task() { return resource_ctx_ != nullptr; }
 
+    // The attached resource context without copying the shared_ptr, nullptr if no task is
+    // attached. For the hot paths which only update the statistics of the task.
+    ResourceContext* attached_resource_ctx() const { return resource_ctx_.get(); }
+
     std::shared_ptr<ResourceContext> resource_ctx() {
 #ifndef BE_TEST
         DCHECK(is_attach_task());
@@ -36,6 +36,7 @@
 #include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/memory_reclamation.h"
+#include "runtime/workload_group/workload_group_manager.h"
 #include "runtime/workload_group/workload_group_metrics.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/mem_info.h"
@@ -528,8 +529,8 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     int max_flush_thread_num = wg_info->max_flush_thread_num;
     int min_flush_thread_num = wg_info->min_flush_thread_num;
 
-    // 1 create thread pool
-    if (_task_sched == nullptr) {
+    // 1 create thread pool, the fair scheduler is shared by all the groups
+    if (_task_sched == nullptr && !config::enable_workload_group_fair_pipeline_scheduler) {
         std::unique_ptr<pipeline::TaskScheduler> pipeline_task_scheduler =
                 std::make_unique<pipeline::HybridTaskScheduler>(pipeline_exec_thread_num,
                                                                 "p_" + wg_name, cg_cpu_ctl_ptr);
@@ -642,7 +643,9 @@ void WorkloadGroup::get_query_scheduler(doris::pipeline::TaskScheduler** exec_sc
                                         vectorized::SimplifiedScanScheduler** scan_sched,
                                         vectorized::SimplifiedScanScheduler** remote_scan_sched) {
     std::shared_lock<std::shared_mutex> rlock(_task_sched_lock);
-    *exec_sched = _task_sched.get();
+    *exec_sched = _task_sched != nullptr
+                          ? _task_sched.get()
+                          : ExecEnv::GetInstance()->workload_group_mgr()->fair_task_scheduler();
     *scan_sched = _scan_task_sched.get();
     *remote_scan_sched = _remote_scan_task_sched.get();
 }
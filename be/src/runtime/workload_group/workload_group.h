@@ -70,6 +70,10 @@ public:
 
     std::string name() const { return _name; };
 
+    int min_cpu_percent() const { return _min_cpu_percent; }
+
+    int max_cpu_percent() const { return _max_cpu_percent; }
+
     int64_t memory_limit() const {
         std::shared_lock<std::shared_mutex> r_lock(_mutex);
         return _memory_limit;
@@ -934,6 +934,9 @@ void WorkloadGroupMgr::stop() {
     for (auto iter = _workload_groups.begin(); iter != _workload_groups.end(); iter++) {
         iter->second->try_stop_schedulers();
     }
+    if (_fair_task_sched) {
+        _fair_task_sched->stop();
+    }
 }
 
 Status WorkloadGroupMgr::create_internal_wg() {
@@ -947,6 +950,13 @@ Status WorkloadGroupMgr::create_internal_wg() {
     twg_info.__set_version(0);
 
     WorkloadGroupInfo wg_info = WorkloadGroupInfo::parse_topic_info(twg_info);
+    if (config::enable_workload_group_fair_pipeline_scheduler) {
+        // Created before any group, the groups do not create their own pipeline schedulers.
+        auto scheduler = std::make_unique<pipeline::WorkloadGroupFairTaskScheduler>(
+                wg_info.pipeline_exec_thread_num, "p_fair");
+        RETURN_IF_ERROR(scheduler->start());
+        _fair_task_sched = std::move(scheduler);
+    }
     auto normal_wg = std::make_shared<WorkloadGroup>(wg_info);
 
     RETURN_IF_ERROR(normal_wg->upsert_task_scheduler(&wg_info));
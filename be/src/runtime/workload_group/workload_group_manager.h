@@ -94,6 +94,10 @@ public:
 
     void handle_paused_queries();
 
+    // The scheduler shared by all the groups, nullptr if
+    // `enable_workload_group_fair_pipeline_scheduler` is not set.
+    pipeline::TaskScheduler* fair_task_scheduler() { return _fair_task_sched.get(); }
+
     friend class WorkloadGroupListener;
     friend class ExecEnv;
 
@@ -109,6 +113,7 @@ private:
 
     std::shared_mutex _group_mutex;
     std::unordered_map<uint64_t, WorkloadGroupPtr> _workload_groups;
+    std::unique_ptr<pipeline::TaskScheduler> _fair_task_sched;
 
     std::shared_mutex _clear_cgroup_lock;
 
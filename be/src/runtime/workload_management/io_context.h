@@ -18,6 +18,7 @@
 #pragma once
 
 #include "common/factory_creator.h"
+#include "runtime/workload_management/io_ledger.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/runtime_profile.h"
 
@@ -122,6 +123,9 @@ public:
         stats_.spill_read_bytes_from_local_storage_counter_->update(delta);
     }
 
+    // The reads of the task per storage tier, see `enable_query_io_ledger`.
+    IOLedger* io_ledger() { return &io_ledger_; }
+
     IOThrottle* io_throttle() {
         // TODO: get io throttle from workload group
         return nullptr;
@@ -133,6 +137,7 @@ protected:
     void set_resource_ctx(ResourceContext* resource_ctx) { resource_ctx_ = resource_ctx; }
 
     Stats stats_;
+    IOLedger io_ledger_;
     ResourceContext* resource_ctx_ {nullptr};
 };
 
@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_management/io_ledger.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "runtime/thread_context.h"
+#include "runtime/workload_management/io_context.h"
+#include "runtime/workload_management/resource_context.h"
+#include "util/pretty_printer.h"
+#include "util/runtime_profile.h"
+#include "util/time.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+const char* io_tier_name(IOTier tier) {
+    switch (tier) {
+    case IOTier::PAGE_CACHE:
+        return "PageCache";
+    case IOTier::FILE_CACHE:
+        return "FileCache";
+    case IOTier::LOCAL_DISK:
+        return "LocalDisk";
+    case IOTier::REMOTE:
+        return "Remote";
+    }
+    return "Unknown";
+}
+
+size_t IOLedger::latency_bucket(int64_t latency_ns) {
+    const auto latency_us = static_cast<uint64_t>(std::max<int64_t>(latency_ns, 0) / 1000);
+    return std::min(static_cast<size_t>(std::bit_width(latency_us)), LATENCY_BUCKETS - 1);
+}
+
+int64_t IOLedger::TierSnapshot::latency_percentile_ns(double percentile) const {
+    int64_t total = 0;
+    for (auto count : latency_histogram) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    const auto target = std::max<int64_t>(
+            static_cast<int64_t>(std::ceil(static_cast<double>(total) * percentile / 100.0)), 1);
+    int64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        seen += latency_histogram[i];
+        if (seen >= target) {
+            // The last bucket is unbounded, report its lower bound.
+            const size_t bound = i + 1 < LATENCY_BUCKETS ? i : i - 1;
+            return (int64_t(1) << bound) * 1000;
+        }
+    }
+    return (int64_t(1) << (LATENCY_BUCKETS - 2)) * 1000;
+}
+
+void IOLedger::record(IOTier tier, int64_t bytes, int64_t latency_ns) {
+    auto& t = _tiers[static_cast<size_t>(tier)];
+    t.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    t.requests.fetch_add(1, std::memory_order_relaxed);
+    t.latency_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    t.latency_histogram[latency_bucket(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void IOLedger::record(IOTier tier, int64_t bytes, int64_t latency_ns, std::string_view file) {
+    record(tier, bytes, latency_ns);
+    if (file.empty()) {
+        return;
+    }
+    const auto max_files = static_cast<size_t>(std::max(config::query_io_ledger_max_files, 0));
+    std::lock_guard<std::mutex> l(_files_lock);
+    if (auto it = _file_bytes.find(std::string(file)); it != _file_bytes.end()) {
+        it->second += bytes;
+    } else if (_file_bytes.size() < max_files) {
+        _file_bytes.emplace(file, bytes);
+    } else {
+        _file_bytes[""] += bytes;
+    }
+}
+
+static void sort_top_files(std::vector<std::pair<std::string, int64_t>>& files, size_t n) {
+    n = std::min(n, files.size());
+    std::partial_sort(files.begin(), files.begin() + static_cast<ptrdiff_t>(n), files.end(),
+                      [](const auto& a, const auto& b) { return a.second > b.second; });
+    files.resize(n);
+}
+
+IOLedger::Snapshot IOLedger::snapshot(size_t top_files) const {
+    Snapshot snapshot;
+    for (size_t i = 0; i < IO_TIER_NUM; ++i) {
+        const auto& from = _tiers[i];
+        auto& to = snapshot.tiers[i];
+        to.bytes = from.bytes.load(std::memory_order_relaxed);
+        to.requests = from.requests.load(std::memory_order_relaxed);
+        to.latency_ns = from.latency_ns.load(std::memory_order_relaxed);
+        for (size_t b = 0; b < LATENCY_BUCKETS; ++b) {
+            to.latency_histogram[b] = from.latency_histogram[b].load(std::memory_order_relaxed);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> l(_files_lock);
+        snapshot.top_files.assign(_file_bytes.begin(), _file_bytes.end());
+    }
+    sort_top_files(snapshot.top_files, top_files);
+    return snapshot;
+}
+
+void IOLedger::Snapshot::merge(const Snapshot& other, size_t max_files) {
+    for (size_t i = 0; i < IO_TIER_NUM; ++i) {
+        auto& to = tiers[i];
+        const auto& from = other.tiers[i];
+        to.bytes += from.bytes;
+        to.requests += from.requests;
+        to.latency_ns += from.latency_ns;
+        for (size_t b = 0; b < LATENCY_BUCKETS; ++b) {
+            to.latency_histogram[b] += from.latency_histogram[b];
+        }
+    }
+    std::unordered_map<std::string, int64_t> files(top_files.begin(), top_files.end());
+    for (const auto& [file, bytes] : other.top_files) {
+        files[file] += bytes;
+    }
+    top_files.assign(files.begin(), files.end());
+    sort_top_files(top_files, max_files);
+}
+
+void IOLedger::Snapshot::to_profile(RuntimeProfile* profile) const {
+    for (size_t i = 0; i < IO_TIER_NUM; ++i) {
+        const auto& t = tiers[i];
+        if (t.requests == 0) {
+            continue;
+        }
+        const std::string name = io_tier_name(static_cast<IOTier>(i));
+        COUNTER_SET(ADD_COUNTER(profile, name + "Bytes", TUnit::BYTES), t.bytes);
+        COUNTER_SET(ADD_COUNTER(profile, name + "Requests", TUnit::UNIT), t.requests);
+        COUNTER_SET(ADD_TIMER(profile, name + "Time"), t.latency_ns);
+        profile->add_info_string(
+                name + "Latency",
+                fmt::format("p50<={}, p90<={}, p99<={}",
+                            PrettyPrinter::print(t.latency_percentile_ns(50), TUnit::TIME_NS),
+                            PrettyPrinter::print(t.latency_percentile_ns(90), TUnit::TIME_NS),
+                            PrettyPrinter::print(t.latency_percentile_ns(99), TUnit::TIME_NS)));
+    }
+    if (!top_files.empty()) {
+        fmt::memory_buffer out;
+        for (const auto& [file, bytes] : top_files) {
+            fmt::format_to(out, "{}{}: {}", out.size() == 0 ? "" : ", ",
+                           file.empty() ? "(others)" : file,
+                           PrettyPrinter::print(bytes, TUnit::BYTES));
+        }
+        profile->add_info_string("TopFilesByBytes", fmt::to_string(out));
+    }
+}
+
+IOLedger* current_io_ledger() {
+    // Only pthreads, bthreads are not used to read the data of a query.
+    if (!IOLedger::enabled() || !pthread_context_ptr_init) {
+        return nullptr;
+    }
+    auto* resource_ctx = thread_context_ptr->attached_resource_ctx();
+    return resource_ctx != nullptr ? resource_ctx->io_context()->io_ledger() : nullptr;
+}
+
+ScopedIOLedgerRecord::ScopedIOLedgerRecord(IOLedger* ledger, IOTier tier, std::string_view file,
+                                           const size_t* bytes)
+        : _ledger(ledger), _tier(tier), _file(file), _bytes(bytes) {
+    if (_ledger != nullptr) {
+        _start_ns = MonotonicNanos();
+    }
+}
+
+ScopedIOLedgerRecord::~ScopedIOLedgerRecord() {
+    if (_ledger != nullptr && *_bytes > 0) {
+        _ledger->record(_tier, static_cast<int64_t>(*_bytes), MonotonicNanos() - _start_ns, _file);
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+class RuntimeProfile;
+
+// The storage tier serving a read. A read of a cloud segment which misses the file cache is
+// recorded as `REMOTE` by the remote reader, and the part served by the cache as `FILE_CACHE`.
+enum class IOTier : uint8_t {
+    PAGE_CACHE = 0,
+    FILE_CACHE,
+    LOCAL_DISK,
+    REMOTE,
+};
+
+inline constexpr size_t IO_TIER_NUM = 4;
+
+const char* io_tier_name(IOTier tier);
+
+// The reads of a query per storage tier: bytes, requests, latency histogram and the files read
+// the most bytes from. Thread safe, the tier counters are relaxed atomics updated on the read
+// paths, the files are counted under a lock and only for the tiers below the page cache.
+class IOLedger {
+public:
+    // Bucket i counts the latencies in [2^(i-1), 2^i) us, bucket 0 the ones below 1us and the
+    // last bucket is unbounded.
+    static constexpr size_t LATENCY_BUCKETS = 24;
+
+    struct TierSnapshot {
+        int64_t bytes = 0;
+        int64_t requests = 0;
+        int64_t latency_ns = 0;
+        std::array<int64_t, LATENCY_BUCKETS> latency_histogram {};
+
+        // The upper bound of the bucket holding the `percentile` (0-100) of the latencies.
+        int64_t latency_percentile_ns(double percentile) const;
+    };
+
+    struct Snapshot {
+        std::array<TierSnapshot, IO_TIER_NUM> tiers;
+        // Sorted by bytes in descending order.
+        std::vector<std::pair<std::string, int64_t>> top_files;
+
+        const TierSnapshot& tier(IOTier t) const { return tiers[static_cast<size_t>(t)]; }
+
+        // Add `other` to this snapshot, keeping the `max_files` files with the most bytes.
+        void merge(const Snapshot& other, size_t max_files);
+
+        // Counters and percentiles per tier, and the top files as an info string.
+        void to_profile(RuntimeProfile* profile) const;
+    };
+
+    static bool enabled() { return config::enable_query_io_ledger; }
+
+    static size_t latency_bucket(int64_t latency_ns);
+
+    void record(IOTier tier, int64_t bytes, int64_t latency_ns);
+    // Also count the bytes of `file`.
+    void record(IOTier tier, int64_t bytes, int64_t latency_ns, std::string_view file);
+
+    // The tiers and the `top_files` files with the most bytes.
+    Snapshot snapshot(size_t top_files) const;
+
+private:
+    struct Tier {
+        std::atomic<int64_t> bytes = 0;
+        std::atomic<int64_t> requests = 0;
+        std::atomic<int64_t> latency_ns = 0;
+        std::array<std::atomic<int64_t>, LATENCY_BUCKETS> latency_histogram {};
+    };
+
+    std::array<Tier, IO_TIER_NUM> _tiers;
+
+    mutable std::mutex _files_lock;
+    // Bounded by `query_io_ledger_max_files`, the bytes of the files over the limit are counted
+    // under an empty path.
+    std::unordered_map<std::string, int64_t> _file_bytes;
+};
+
+// The IO ledger of the query attached to the current thread, nullptr if the ledger is disabled or
+// no task is attached.
+IOLedger* current_io_ledger();
+
+// Time a read and record `*bytes` into `ledger` at the end of the scope, nothing if `ledger` is
+// nullptr. `file` must outlive the scope.
+class ScopedIOLedgerRecord {
+public:
+    ScopedIOLedgerRecord(IOLedger* ledger, IOTier tier, std::string_view file,
+                         const size_t* bytes);
+    ~ScopedIOLedgerRecord();
+
+private:
+    IOLedger* const _ledger;
+    const IOTier _tier;
+    const std::string_view _file;
+    const size_t* const _bytes;
+    int64_t _start_ns = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
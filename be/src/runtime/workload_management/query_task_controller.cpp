@@ -20,6 +20,7 @@
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/query_context.h"
 #include "runtime/workload_management/task_controller.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -125,7 +126,12 @@ Status QueryTaskController::revoke_memory() {
     if (query_ctx == nullptr) {
         return Status::OK();
     }
-    std::vector<std::pair<size_t, pipeline::PipelineTask*>> tasks;
+    struct RevocableTask {
+        size_t revocable_size;
+        size_t spill_io_size;
+        pipeline::PipelineTask* task;
+    };
+    std::vector<RevocableTask> tasks;
     std::vector<std::shared_ptr<pipeline::PipelineFragmentContext>> fragments;
     std::lock_guard<std::mutex> lock(query_ctx->_pipeline_map_write_lock);
     for (auto&& [fragment_id, fragment_wptr] : query_ctx->_fragment_id_to_pipeline_ctx) {
@@ -136,12 +142,22 @@ Status QueryTaskController::revoke_memory() {
 
         auto tasks_of_fragment = fragment_ctx->get_revocable_tasks();
         for (auto* task : tasks_of_fragment) {
-            tasks.emplace_back(task->get_revocable_size(), task);
+            tasks.push_back({task->get_revocable_size(), task->get_revocable_spill_io_size(), task});
         }
         fragments.emplace_back(std::move(fragment_ctx));
     }
 
-    std::sort(tasks.begin(), tasks.end(), [](auto&& l, auto&& r) { return l.first > r.first; });
+    // Spill the tasks freeing the most memory per byte of spill io first, then the larger ones.
+    std::sort(tasks.begin(), tasks.end(), [](const RevocableTask& l, const RevocableTask& r) {
+        const auto l_benefit = static_cast<double>(l.revocable_size) *
+                               static_cast<double>(std::max<size_t>(r.spill_io_size, 1));
+        const auto r_benefit = static_cast<double>(r.revocable_size) *
+                               static_cast<double>(std::max<size_t>(l.spill_io_size, 1));
+        if (l_benefit != r_benefit) {
+            return l_benefit > r_benefit;
+        }
+        return l.revocable_size > r.revocable_size;
+    });
 
     // Do not use memlimit, use current memory usage.
     // For example, if current limit is 1.6G, but current used is 1G, if reserve failed
@@ -152,16 +168,22 @@ Status QueryTaskController::revoke_memory() {
     size_t total_revokable_size = 0;
 
     std::vector<pipeline::PipelineTask*> chosen_tasks;
-    for (auto&& [revocable_size, task] : tasks) {
-        // Only revoke the largest task to ensure memory is used as much as possible
-        // break;
-        if (revoked_size < target_revoking_size) {
+    for (auto&& [revocable_size, spill_io_size, task] : tasks) {
+        // The tasks with too little data to spill free nothing, see `PipelineTask::revoke_memory`.
+        if (revoked_size < target_revoking_size &&
+            revocable_size >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) {
             chosen_tasks.emplace_back(task);
             revoked_size += revocable_size;
         }
         total_revokable_size += revocable_size;
     }
 
+    if (chosen_tasks.empty()) {
+        LOG(INFO) << debug_string() << ", no task has enough data to spill, resume it.";
+        query_ctx->set_memory_sufficient(true);
+        return Status::OK();
+    }
+
     std::weak_ptr<QueryContext> this_ctx = query_ctx;
     auto spill_context = std::make_shared<pipeline::SpillContext>(
             chosen_tasks.size(), query_ctx->query_id(),
@@ -111,6 +111,8 @@ public:
     void increase_revoking_tasks_count() { revoking_tasks_count_.fetch_add(1); }
     void decrease_revoking_tasks_count() { revoking_tasks_count_.fetch_sub(1); }
     int get_revoking_tasks_count() const { return revoking_tasks_count_.load(); }
+    void set_revoke_requested_time() { revoke_requested_time_ = MonotonicMillis(); }
+    int64_t revoke_requested_time() const { return revoke_requested_time_; }
 
 protected:
     friend class ResourceContext;
@@ -147,6 +149,8 @@ protected:
     /* memory revoke property
     */
     std::atomic<int> revoking_tasks_count_ = 0;
+    // when the memory gc last asked this task to spill its revocable memory
+    std::atomic<int64_t> revoke_requested_time_ = 0;
 };
 
 #include "common/compile_check_end.h"
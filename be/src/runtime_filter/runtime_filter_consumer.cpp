@@ -66,6 +66,16 @@ void RuntimeFilterConsumer::signal(RuntimeFilter* other) {
     }
 }
 
+void RuntimeFilterConsumer::extend_wait_time(int32_t extension_ms) {
+    std::unique_lock<std::recursive_mutex> l(_rmtx);
+    if (_rf_state != State::NOT_READY) {
+        return;
+    }
+    for (auto& timer : _filter_timer) {
+        timer->extend_wait_time(extension_ms);
+    }
+}
+
 std::shared_ptr<pipeline::RuntimeFilterTimer> RuntimeFilterConsumer::create_filter_timer(
         std::shared_ptr<pipeline::Dependency> dependencies) {
     std::unique_lock<std::recursive_mutex> l(_rmtx);
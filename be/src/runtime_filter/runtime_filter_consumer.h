@@ -55,6 +55,10 @@ public:
     std::shared_ptr<pipeline::RuntimeFilterTimer> create_filter_timer(
             std::shared_ptr<pipeline::Dependency> dependencies);
 
+    // Called by a producer on the same backend once its part of the filter is published and only
+    // the global merge is pending, so the filter is worth waiting for a bit longer.
+    void extend_wait_time(int32_t extension_ms);
+
     // Called after `State` is ready (e.g. signaled)
     Status acquire_expr(std::vector<vectorized::VRuntimeFilterPtr>& push_exprs);
 
@@ -93,6 +93,10 @@ public:
 
     bool ready() const { return _rf_state == State::READY; }
 
+    bool disabled() const {
+        return _wrapper->get_state() == RuntimeFilterWrapper::State::DISABLED;
+    }
+
 private:
     RuntimeFilterMerger(const QueryContext* query_ctx, const TRuntimeFilterDesc* desc)
             : RuntimeFilter(desc), _rf_state(State::WAITING_FOR_PRODUCT) {}
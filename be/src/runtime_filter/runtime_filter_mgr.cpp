@@ -303,18 +303,33 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
     }
     auto& cnt_val = iter->second;
     bool is_ready = false;
+    bool need_assign = true;
     {
         std::lock_guard<std::mutex> l(iter->second.mtx);
         // Skip the other broadcast join runtime filter
         if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
             return Status::OK();
         }
-        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
-        RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
-                                                      &tmp_filter));
+        // A disabled merger (e.g. an IN filter that reached max in num) ignores its inputs,
+        // so there is no need to deserialize them.
+        need_assign = !cnt_val.merger->disabled();
+    }
 
+    // Deserializing a partial filter does not touch the merger, so do it outside the lock to
+    // let the partial filters of different backends be decoded concurrently, only the merge
+    // itself is serialized.
+    std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+    RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
+                                                  &tmp_filter));
+    if (need_assign) {
         RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+    }
 
+    {
+        std::lock_guard<std::mutex> l(iter->second.mtx);
+        if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
+            return Status::OK();
+        }
         RETURN_IF_ERROR(cnt_val.merger->merge_from(tmp_filter.get()));
 
         cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
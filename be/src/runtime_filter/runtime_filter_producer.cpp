@@ -19,6 +19,7 @@
 
 #include <glog/logging.h>
 
+#include "common/config.h"
 #include "runtime_filter/runtime_filter_consumer.h"
 #include "runtime_filter/runtime_filter_merger.h"
 #include "runtime_filter/runtime_filter_wrapper.h"
@@ -34,6 +35,19 @@ Status RuntimeFilterProducer::_send_to_remote_targets(RuntimeState* state,
     return merger_filter->_push_to_remote(state, &addr);
 };
 
+// The build side of this backend is done and the filter only waits for the global merge, which
+// usually arrives shortly after. Consumers on this backend that are still waiting keep waiting a
+// little longer instead of timing out just before the filter arrives.
+void RuntimeFilterProducer::_extend_local_consumers_wait(RuntimeState* state) {
+    if (config::runtime_filter_merge_wait_extension_ms <= 0) {
+        return;
+    }
+    for (const auto& consumer :
+         state->global_runtime_filter_mgr()->get_consume_filters(_wrapper->filter_id())) {
+        consumer->extend_wait_time(config::runtime_filter_merge_wait_extension_ms);
+    }
+}
+
 Status RuntimeFilterProducer::_send_to_local_targets(RuntimeState* state, RuntimeFilter* source,
                                                      bool global) {
     std::vector<std::shared_ptr<RuntimeFilterConsumer>> filters =
@@ -67,6 +81,7 @@ Status RuntimeFilterProducer::publish(RuntimeState* state, bool build_hash_table
         if (context->merger->ready()) {
             if (_has_remote_target) {
                 RETURN_IF_ERROR(_send_to_remote_targets(state, context->merger.get()));
+                _extend_local_consumers_wait(state);
             } else {
                 RETURN_IF_ERROR(_send_to_local_targets(state, context->merger.get(), true));
             }
@@ -82,6 +97,7 @@ Status RuntimeFilterProducer::publish(RuntimeState* state, bool build_hash_table
     } else if (build_hash_table) {
         if (_is_broadcast_join) {
             RETURN_IF_ERROR(_send_to_remote_targets(state, this));
+            _extend_local_consumers_wait(state);
         } else {
             RETURN_IF_ERROR(do_merge());
         }
@@ -137,6 +137,7 @@ private:
 
     Status _send_to_remote_targets(RuntimeState* state, RuntimeFilter* merger_filter);
     Status _send_to_local_targets(RuntimeState* state, RuntimeFilter* merger_filter, bool global);
+    void _extend_local_consumers_wait(RuntimeState* state);
 
     void _check_state(std::vector<State> assumed_states) {
         if (!check_state_impl<RuntimeFilterProducer>(_rf_state, assumed_states)) {
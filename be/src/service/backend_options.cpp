@@ -72,6 +72,14 @@ std::string BackendOptions::get_be_endpoint() {
     return _s_localhost + ":" + std::to_string(config::heartbeat_service_port);
 }
 
+std::string BackendOptions::get_brpc_unix_socket_path(const std::string& host, int port) {
+    if (config::brpc_unix_socket_dir.empty()) {
+        return "";
+    }
+    return config::brpc_unix_socket_dir + "/doris_be_brpc_" + host + "_" + std::to_string(port) +
+           ".sock";
+}
+
 TBackend BackendOptions::get_local_backend() {
     TBackend backend;
     backend.__set_host(_s_localhost);
@@ -35,6 +35,9 @@ public:
     static bool init();
     static const std::string& get_localhost();
     static std::string get_be_endpoint();
+    // The unix domain socket of the brpc server of the BE at `host:port`, empty if
+    // `brpc_unix_socket_dir` is not set.
+    static std::string get_brpc_unix_socket_path(const std::string& host, int port);
     static TBackend get_local_backend();
     static void set_backend_id(int64_t backend_id);
     static int64_t get_backend_id() { return _s_backend_id; }
@@ -24,6 +24,7 @@
 #include <errno.h> // IWYU pragma: keep
 #include <gflags/gflags_declare.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <ostream>
 
@@ -65,15 +66,13 @@ BRpcService::~BRpcService() {
 
 Status BRpcService::start(int port, int num_threads) {
     // Add service
+    google::protobuf::Service* service = nullptr;
     if (config::is_cloud_mode()) {
-        _server->AddService(
-                new CloudInternalServiceImpl(_exec_env->storage_engine().to_cloud(), _exec_env),
-                brpc::SERVER_OWNS_SERVICE);
+        service = new CloudInternalServiceImpl(_exec_env->storage_engine().to_cloud(), _exec_env);
     } else {
-        _server->AddService(
-                new PInternalServiceImpl(_exec_env->storage_engine().to_local(), _exec_env),
-                brpc::SERVER_OWNS_SERVICE);
+        service = new PInternalServiceImpl(_exec_env->storage_engine().to_local(), _exec_env);
     }
+    _server->AddService(service, brpc::SERVER_OWNS_SERVICE);
     // start service
     brpc::ServerOptions options;
     if (num_threads != -1) {
@@ -101,10 +100,49 @@ Status BRpcService::start(int port, int num_threads) {
                      << ", errmsg=" << strerror_r(errno, buf, 64) << ", port=" << port;
         return Status::InternalError("start brpc service failed");
     }
+    _start_unix_socket_server(service, port, options.idle_timeout_sec);
     return Status::OK();
 }
 
+void BRpcService::_start_unix_socket_server(google::protobuf::Service* service, int port,
+                                            int idle_timeout_sec) {
+    auto path = BackendOptions::get_brpc_unix_socket_path(BackendOptions::get_localhost(), port);
+    if (path.empty()) {
+        return;
+    }
+    // The socket of the previous process is left if it is not stopped gracefully.
+    unlink(path.c_str());
+    butil::EndPoint point;
+    if (butil::str2endpoint(("unix:" + path).c_str(), &point) < 0) {
+        LOG(WARNING) << "invalid brpc unix socket path: " << path;
+        return;
+    }
+    // The service is owned by the TCP server, which is stopped after this one.
+    auto server = std::make_unique<brpc::Server>();
+    server->AddService(service, brpc::SERVER_DOESNT_OWN_SERVICE);
+    brpc::ServerOptions options;
+    options.idle_timeout_sec = idle_timeout_sec;
+    options.has_builtin_services = false;
+    if (server->Start(point, &options) != 0) {
+        char buf[64];
+        LOG(WARNING) << "start brpc on unix socket failed, errno=" << errno
+                     << ", errmsg=" << strerror_r(errno, buf, 64) << ", path=" << path;
+        return;
+    }
+    LOG(INFO) << "BRPC server bind to unix socket: " << path;
+    _unix_socket_path = std::move(path);
+    _unix_socket_server = std::move(server);
+}
+
 void BRpcService::join() {
+    if (_unix_socket_server) {
+        if (_unix_socket_server->Stop(1000) == 0) {
+            _unix_socket_server->Join();
+        }
+        _unix_socket_server->ClearServices();
+        _unix_socket_server.reset();
+        unlink(_unix_socket_path.c_str());
+    }
     int stop_succeed = _server->Stop(1000);
 
     if (stop_succeed == 0) {
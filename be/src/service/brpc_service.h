@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "common/status.h"
 
@@ -25,6 +26,10 @@ namespace brpc {
 class Server;
 }
 
+namespace google::protobuf {
+class Service;
+} // namespace google::protobuf
+
 namespace doris {
 
 class ExecEnv;
@@ -39,8 +44,15 @@ public:
     void join();
 
 private:
+    // Serve `service` on the unix domain socket if `brpc_unix_socket_dir` is set. TCP is still
+    // used if the socket fails to start.
+    void _start_unix_socket_server(google::protobuf::Service* service, int port,
+                                   int idle_timeout_sec);
+
     ExecEnv* _exec_env;
     std::unique_ptr<brpc::Server> _server;
+    std::unique_ptr<brpc::Server> _unix_socket_server;
+    std::string _unix_socket_path;
 };
 
 } // namespace doris
@@ -72,6 +72,7 @@
 #include "http/action/tablets_distribution_action.h"
 #include "http/action/tablets_info_action.h"
 #include "http/action/version_action.h"
+#include "http/action/workload_io_ledger_action.h"
 #include "http/default_path_handlers.h"
 #include "http/ev_http_server.h"
 #include "http/http_method.h"
@@ -190,6 +191,18 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/api/query_pipeline_tasks/{query_id}",
                                       query_pipeline_task_action);
 
+    // Dump the pipeline task scheduling events as Chrome trace JSON
+    PipelineEventTraceAction* pipeline_event_trace_action =
+            _pool.add(new PipelineEventTraceAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/pipeline_event_trace",
+                                      pipeline_event_trace_action);
+
+    // Dump the reads of the queries per workload group and storage tier
+    WorkloadIOLedgerAction* workload_io_ledger_action =
+            _pool.add(new WorkloadIOLedgerAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/workload_io_ledger",
+                                      workload_io_ledger_action);
+
     // Dump all be process thread num
     BeProcThreadAction* be_proc_thread_action = _pool.add(new BeProcThreadAction(_env));
     _ev_http_server->register_handler(HttpMethod::GET, "/api/be_process_thread_num",
@@ -26,8 +26,12 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -54,6 +58,7 @@
 #include "util/runtime_profile.h"
 #include "util/simd/bits.h"
 #include "util/thrift_util.h"
+#include "vec/columns/column_string.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -218,7 +223,8 @@ LookupConnectionCache* LookupConnectionCache::create_global_instance(size_t capa
 RowCache::RowCache(int64_t capacity, int num_shards)
         : LRUCachePolicy(CachePolicy::CacheType::POINT_QUERY_ROW_CACHE, capacity,
                          LRUCacheType::SIZE, config::point_query_row_cache_stale_sweep_time_sec,
-                         num_shards) {}
+                         num_shards),
+          _admission_counters(new std::atomic<uint8_t>[kAdmissionCounterNum]()) {}
 
 // Create global instance of this class
 RowCache* RowCache::create_global_cache(int64_t capacity, uint32_t num_shards) {
@@ -242,12 +248,38 @@ bool RowCache::lookup(const RowCacheKey& key, CacheHandle* handle) {
     return true;
 }
 
+bool RowCache::_admit(const std::string& encoded_key) {
+    int32_t min_misses = config::point_query_row_cache_admission_min_misses;
+    if (min_misses <= 1) {
+        return true;
+    }
+    auto& counter = _admission_counters[std::hash<std::string> {}(encoded_key) %
+                                        kAdmissionCounterNum];
+    // Racing updates may lose a count, which only delays the admission of that key.
+    uint8_t misses = counter.load(std::memory_order_relaxed);
+    if (misses < std::numeric_limits<uint8_t>::max()) {
+        counter.store(++misses, std::memory_order_relaxed);
+    }
+    if (_admission_misses.fetch_add(1, std::memory_order_relaxed) + 1 == kAdmissionCounterNum) {
+        _admission_misses.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < kAdmissionCounterNum; ++i) {
+            auto& aged = _admission_counters[i];
+            aged.store(static_cast<uint8_t>(aged.load(std::memory_order_relaxed) >> 1),
+                       std::memory_order_relaxed);
+        }
+    }
+    return misses >= min_misses;
+}
+
 void RowCache::insert(const RowCacheKey& key, const Slice& value) {
+    const std::string& encoded_key = key.encode();
+    if (!_admit(encoded_key)) {
+        return;
+    }
     char* cache_value = static_cast<char*>(malloc(value.size));
     memcpy(cache_value, value.data, value.size);
     auto* row_cache_value = new RowCacheValue;
     row_cache_value->cache_value = cache_value;
-    const std::string& encoded_key = key.encode();
     auto* handle = LRUCachePolicy::insert(encoded_key, row_cache_value, value.size, value.size,
                                           CachePriority::NORMAL);
     // handle will released
@@ -421,7 +453,14 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Walk the primary key indexes in key order, so that keys of a multi-key lookup landing
+    // in the same index pages are resolved back to back.
+    std::vector<size_t> key_orders(_row_read_ctxs.size());
+    std::iota(key_orders.begin(), key_orders.end(), 0);
+    std::sort(key_orders.begin(), key_orders.end(), [&](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    for (size_t i : key_orders) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -454,9 +493,58 @@ Status PointQueryExecutor::_lookup_row_key() {
     return Status::OK();
 }
 
+// Rows of a multi-key lookup are grouped by segment, each segment is opened once and its
+// row store pages are read in rowid order no matter how many keys land in it.
+Status PointQueryExecutor::_read_row_store_values(std::vector<std::string>* values) {
+    values->resize(_row_read_ctxs.size());
+    std::map<std::pair<RowsetId, uint32_t>, std::vector<size_t>> segment_rows;
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        if (_row_read_ctxs[i]._cached_row_data.valid() ||
+            !_row_read_ctxs[i]._row_location.has_value()) {
+            continue;
+        }
+        const auto& location = _row_read_ctxs[i]._row_location.value();
+        segment_rows[{location.rowset_id, location.segment_id}].push_back(i);
+    }
+    bool use_row_cache = !config::disable_storage_row_cache;
+    for (const auto& [segment, rows] : segment_rows) {
+        std::vector<uint32_t> rowids;
+        rowids.reserve(rows.size());
+        for (size_t i : rows) {
+            rowids.push_back(_row_read_ctxs[i]._row_location->row_id);
+        }
+        std::sort(rowids.begin(), rowids.end());
+        rowids.erase(std::unique(rowids.begin(), rowids.end()), rowids.end());
+
+        RowsetSharedPtr rowset = *(_row_read_ctxs[rows.front()]._rowset_ptr);
+        const auto& row_store_column =
+                *DORIS_TRY(rowset->tablet_schema()->column(BeConsts::ROW_STORE_COL));
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        RETURN_IF_ERROR(BaseTablet::fetch_value_by_rowids(rowset, segment.second, rowids,
+                                                          row_store_column, column));
+        const auto& string_column = assert_cast<const vectorized::ColumnString&>(*column);
+        for (size_t i : rows) {
+            auto pos = std::lower_bound(rowids.begin(), rowids.end(),
+                                        _row_read_ctxs[i]._row_location->row_id) -
+                       rowids.begin();
+            StringRef value = string_column.get_data_at(pos);
+            (*values)[i] = value.to_string();
+            if (use_row_cache) {
+                RowCache::instance()->insert({_tablet->tablet_id(), _row_read_ctxs[i]._primary_key},
+                                             Slice {value.data, value.size});
+            }
+        }
+    }
+    return Status::OK();
+}
+
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    std::vector<std::string> row_store_values;
+    if (_reusable->rs_column_uid() != -1) {
+        RETURN_IF_ERROR(_read_row_store_values(&row_store_values));
+    }
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -470,14 +558,9 @@ Status PointQueryExecutor::_lookup_row_data() {
         if (!_row_read_ctxs[i]._row_location.has_value()) {
             continue;
         }
-        std::string value;
         // fill block by row store
         if (_reusable->rs_column_uid() != -1) {
-            bool use_row_cache = !config::disable_storage_row_cache;
-            RETURN_IF_ERROR(_tablet->lookup_row_data(
-                    _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                    *(_row_read_ctxs[i]._rowset_ptr), _profile_metrics.read_stats, value,
-                    use_row_cache));
+            const auto& value = row_store_values[i];
             // serilize value to block, currently only jsonb row formt
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
                     _reusable->get_data_type_serdes(), value.data(), value.size(),
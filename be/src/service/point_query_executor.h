@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -215,7 +216,17 @@ public:
 
 private:
     static constexpr uint32_t kDefaultNumShards = 128;
+    static constexpr size_t kAdmissionCounterNum = 1 << 16;
     RowCache(int64_t capacity, int num_shards = kDefaultNumShards);
+
+    // Whether a row that missed the cache is hot enough to be inserted, see
+    // point_query_row_cache_admission_min_misses.
+    bool _admit(const std::string& encoded_key);
+
+    // Saturating miss counters indexed by the hash of the key, halved every
+    // kAdmissionCounterNum misses so that keys hot long ago age out.
+    std::unique_ptr<std::atomic<uint8_t>[]> _admission_counters;
+    std::atomic<size_t> _admission_misses {0};
 };
 
 // A cache used for prepare stmt.
@@ -312,6 +323,8 @@ private:
 
     Status _lookup_row_data();
 
+    Status _read_row_store_values(std::vector<std::string>* values);
+
     Status _output_data();
 
     static void release_rowset(RowsetSharedPtr* r) {
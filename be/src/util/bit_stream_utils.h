@@ -101,6 +101,12 @@ public:
     template <typename T>
     bool GetValue(int num_bits, T* v);
 
+    // Unpacks up to 'num_values' values of 'num_bits' each into 'v' with the batched unpacking
+    // of BitPacking. The stream must be at a byte boundary. T must be an unsigned integer.
+    // Returns the number of values read.
+    template <typename T>
+    int UnpackBatch(int num_bits, int num_values, T* v);
+
     // Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T needs to be a
     // little-endian native type and big enough to store 'num_bytes'. The value is assumed
     // to be byte-aligned so the stream will be advanced to the start of the next byte
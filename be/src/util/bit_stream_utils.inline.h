@@ -138,6 +138,16 @@ bool BitReader::GetValue(int num_bits, T* v) {
     return true;
 }
 
+template <typename T>
+int BitReader::UnpackBatch(int num_bits, int num_values, T* v) {
+    DCHECK_EQ(bit_offset_ % 8, 0);
+    const int byte_pos = byte_offset_ + bit_offset_ / 8;
+    auto [_, num_read] = BitPacking::UnpackValues(num_bits, buffer_ + byte_pos,
+                                                  max_bytes_ - byte_pos, num_values, v);
+    Advance(num_read * num_bits);
+    return static_cast<int>(num_read);
+}
+
 inline void BitReader::Rewind(int num_bits) {
     bit_offset_ -= num_bits;
     if (bit_offset_ >= 0) {
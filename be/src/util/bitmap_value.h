@@ -1329,9 +1329,10 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
-                }
+                // union the existing bitmap together with the inputs in one pass,
+                // so containers of the same key are merged lazily only once
+                bitmaps.push_back(_bitmap.get());
+                *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
                 break;
             case SET: {
                 *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
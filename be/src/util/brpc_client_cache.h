@@ -194,6 +194,26 @@ public:
         return stub;
     }
 
+    // The client of a brpc server listening on the unix domain socket `path`.
+    std::shared_ptr<T> get_unix_socket_client(const std::string& path) {
+        std::string endpoint = "unix:" + path;
+        std::shared_ptr<T> stub_ptr;
+        auto get_value = [&stub_ptr](const auto& v) { stub_ptr = v.second; };
+        if (LIKELY(_stub_map.if_contains(endpoint, get_value))) {
+            if (static_cast<FailureDetectChannel*>(stub_ptr->channel())->channel_status()->ok()) {
+                return stub_ptr;
+            } else {
+                _stub_map.erase(endpoint);
+            }
+        }
+        auto stub = get_new_client_no_cache(endpoint);
+        if (stub != nullptr) {
+            _stub_map.try_emplace_l(
+                    endpoint, [&stub](const auto& v) { stub = v.second; }, stub);
+        }
+        return stub;
+    }
+
     std::shared_ptr<T> get_client(const std::string& host_port) {
         const auto pos = host_port.rfind(':');
         std::string host = host_port.substr(0, pos);
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "common/logging.h"
 #include "common/status.h"
@@ -39,7 +40,16 @@ struct ByteBuffer : private Allocator<false> {
         return Status::OK();
     }
 
+    // Wrap `size` bytes at `data` kept alive by `owner`, which is released with the buffer. The
+    // buffer is ready to be read.
+    static ByteBufferPtr wrap(char* data, size_t size, std::shared_ptr<void> owner) {
+        return ByteBufferPtr(new ByteBuffer(data, size, std::move(owner)));
+    }
+
     ~ByteBuffer() {
+        if (owner_ != nullptr) {
+            return;
+        }
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker_);
         Allocator<false>::free(ptr, capacity);
     }
@@ -78,7 +88,11 @@ private:
         ptr = reinterpret_cast<char*>(Allocator<false>::alloc(capacity_));
     }
 
+    ByteBuffer(char* data, size_t size, std::shared_ptr<void> owner)
+            : ptr(data), pos(0), limit(size), capacity(size), owner_(std::move(owner)) {}
+
     std::shared_ptr<MemTrackerLimiter> mem_tracker_;
+    std::shared_ptr<void> owner_;
 };
 
 } // namespace doris
@@ -180,6 +180,21 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(compaction_waitting_permits, MetricUnit::NOUN
 
 DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(tablet_version_num_distribution, MetricUnit::NOUNIT);
 
+#define DEFINE_HOT_PATH_LATENCY_METRIC(name, path)                                \
+    DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(name, MetricUnit::NANOSECONDS, "",     \
+                                           hot_path_latency_ns, Labels({{"path", path}}))
+DEFINE_HOT_PATH_LATENCY_METRIC(page_cache_lookup_latency_ns, "page_cache_lookup");
+DEFINE_HOT_PATH_LATENCY_METRIC(pipeline_task_queue_wait_ns, "pipeline_task_queue_wait");
+DEFINE_HOT_PATH_LATENCY_METRIC(scan_task_queue_wait_ns, "scan_task_queue_wait");
+DEFINE_HOT_PATH_LATENCY_METRIC(exchange_rpc_latency_ns, "exchange_rpc");
+
+#define DEFINE_LOCK_WAIT_METRIC(name, lock)                                                 \
+    DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(name, MetricUnit::NANOSECONDS, "", lock_wait_ns, \
+                                           Labels({{"lock", lock}}))
+DEFINE_LOCK_WAIT_METRIC(file_cache_lock_wait_ns, "file_cache");
+DEFINE_LOCK_WAIT_METRIC(lru_cache_shard_lock_wait_ns, "lru_cache_shard");
+DEFINE_LOCK_WAIT_METRIC(dependency_lock_wait_ns, "dependency");
+
 DEFINE_GAUGE_CORE_METRIC_PROTOTYPE_2ARG(query_scan_bytes_per_second, MetricUnit::BYTES);
 
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(readable_blocks_total, MetricUnit::BLOCKS);
@@ -351,6 +366,14 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
 
     HISTOGRAM_METRIC_REGISTER(_server_metric_entity, tablet_version_num_distribution);
 
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, page_cache_lookup_latency_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, pipeline_task_queue_wait_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, scan_task_queue_wait_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, exchange_rpc_latency_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, file_cache_lock_wait_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, lru_cache_shard_lock_wait_ns);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, dependency_lock_wait_ns);
+
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, query_scan_bytes_per_second);
 
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_rows);
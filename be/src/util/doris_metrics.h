@@ -161,6 +161,15 @@ public:
 
     HistogramMetric* tablet_version_num_distribution = nullptr;
 
+    // See `enable_hot_path_metrics`.
+    HistogramMetric* page_cache_lookup_latency_ns = nullptr;
+    HistogramMetric* pipeline_task_queue_wait_ns = nullptr;
+    HistogramMetric* scan_task_queue_wait_ns = nullptr;
+    HistogramMetric* exchange_rpc_latency_ns = nullptr;
+    HistogramMetric* file_cache_lock_wait_ns = nullptr;
+    HistogramMetric* lru_cache_shard_lock_wait_ns = nullptr;
+    HistogramMetric* dependency_lock_wait_ns = nullptr;
+
     // The following metrics will be calculated
     // by metric calculator
     IntGauge* query_scan_bytes_per_second = nullptr;
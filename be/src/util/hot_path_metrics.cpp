@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/hot_path_metrics.h"
+
+#include <algorithm>
+
+#include "util/doris_metrics.h"
+#include "util/metrics.h"
+
+namespace doris::hot_path_metrics {
+#include "common/compile_check_begin.h"
+
+static HistogramMetric* latency_histogram(HotPath path) {
+    auto* metrics = DorisMetrics::instance();
+    switch (path) {
+    case HotPath::PAGE_CACHE_LOOKUP:
+        return metrics->page_cache_lookup_latency_ns;
+    case HotPath::PIPELINE_TASK_QUEUE_WAIT:
+        return metrics->pipeline_task_queue_wait_ns;
+    case HotPath::SCAN_TASK_QUEUE_WAIT:
+        return metrics->scan_task_queue_wait_ns;
+    case HotPath::EXCHANGE_RPC:
+        return metrics->exchange_rpc_latency_ns;
+    }
+    return nullptr;
+}
+
+static HistogramMetric* lock_wait_histogram(HotLock lock) {
+    auto* metrics = DorisMetrics::instance();
+    switch (lock) {
+    case HotLock::FILE_CACHE:
+        return metrics->file_cache_lock_wait_ns;
+    case HotLock::LRU_CACHE_SHARD:
+        return metrics->lru_cache_shard_lock_wait_ns;
+    case HotLock::DEPENDENCY:
+        return metrics->dependency_lock_wait_ns;
+    }
+    return nullptr;
+}
+
+void record_latency(HotPath path, int64_t latency_ns) {
+    if (auto* histogram = latency_histogram(path); histogram != nullptr) {
+        histogram->add(static_cast<uint64_t>(std::max<int64_t>(latency_ns, 0)));
+    }
+}
+
+void record_lock_wait(HotLock lock, int64_t wait_ns) {
+    if (auto* histogram = lock_wait_histogram(lock); histogram != nullptr) {
+        histogram->add(static_cast<uint64_t>(std::max<int64_t>(wait_ns, 0)));
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::hot_path_metrics
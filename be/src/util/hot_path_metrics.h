@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// The hot paths whose latency is recorded, each into a histogram of `hot_path_latency_ns`.
+enum class HotPath : uint8_t {
+    PAGE_CACHE_LOOKUP,
+    PIPELINE_TASK_QUEUE_WAIT,
+    SCAN_TASK_QUEUE_WAIT,
+    EXCHANGE_RPC,
+};
+
+// The hot locks whose contended acquisitions are recorded, each into a histogram of
+// `lock_wait_ns`. An acquisition which does not wait is not recorded, so the count of a
+// histogram is the number of contended acquisitions.
+enum class HotLock : uint8_t {
+    FILE_CACHE,
+    LRU_CACHE_SHARD,
+    DEPENDENCY,
+};
+
+namespace hot_path_metrics {
+
+inline bool enabled() {
+    return config::enable_hot_path_metrics;
+}
+
+void record_latency(HotPath path, int64_t latency_ns);
+void record_lock_wait(HotLock lock, int64_t wait_ns);
+
+// Lock `mutex`, and record the time waited for it if it is held by another thread. It costs a
+// failed `try_lock` more than `lock` on contention only.
+template <typename Mutex>
+void lock(Mutex& mutex, HotLock hot_lock) {
+    if (!enabled()) {
+        mutex.lock();
+        return;
+    }
+    if (mutex.try_lock()) {
+        return;
+    }
+    const int64_t start = MonotonicNanos();
+    mutex.lock();
+    record_lock_wait(hot_lock, MonotonicNanos() - start);
+}
+
+template <typename SharedMutex>
+void lock_shared(SharedMutex& mutex, HotLock hot_lock) {
+    if (!enabled()) {
+        mutex.lock_shared();
+        return;
+    }
+    if (mutex.try_lock_shared()) {
+        return;
+    }
+    const int64_t start = MonotonicNanos();
+    mutex.lock_shared();
+    record_lock_wait(hot_lock, MonotonicNanos() - start);
+}
+
+} // namespace hot_path_metrics
+
+// Record the latency of the scope.
+class ScopedHotPathLatency {
+public:
+    explicit ScopedHotPathLatency(HotPath path)
+            : _path(path), _start(hot_path_metrics::enabled() ? MonotonicNanos() : 0) {}
+    ~ScopedHotPathLatency() {
+        if (_start != 0) {
+            hot_path_metrics::record_latency(_path, MonotonicNanos() - _start);
+        }
+    }
+
+private:
+    const HotPath _path;
+    const int64_t _start;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
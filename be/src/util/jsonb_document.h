@@ -1037,7 +1037,7 @@ private:
 
         while (pch < fence) {
             auto* pkey = (JsonbKeyValue*)(pch);
-            if (klen == pkey->klen() && strncmp(key, pkey->getKeyStr(), klen) == 0) {
+            if (klen == pkey->klen() && memcmp(key, pkey->getKeyStr(), klen) == 0) {
                 return iterator(pkey);
             }
             pch += pkey->numPackedBytes();
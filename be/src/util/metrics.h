@@ -205,6 +205,9 @@ public:
 #define DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(name, unit) \
     DEFINE_METRIC_PROTOTYPE(name, MetricType::HISTOGRAM, unit, "", "", Labels(), false)
 
+#define DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(name, unit, desc, group, labels) \
+    DEFINE_METRIC_PROTOTYPE(name, MetricType::HISTOGRAM, unit, desc, #group, labels, false)
+
 #define INT_COUNTER_METRIC_REGISTER(entity, metric) \
     metric = (IntCounter*)(entity->register_metric<IntCounter>(&METRIC_##metric))
 
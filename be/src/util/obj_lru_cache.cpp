@@ -25,6 +25,11 @@ ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards)
                          num_shards),
           _enabled(capacity > 0) {}
 
+ObjLRUCache::ObjLRUCache(CachePolicy::CacheType type, int64_t capacity, uint32_t num_shards)
+        : LRUCachePolicy(type, capacity, LRUCacheType::SIZE,
+                         config::common_obj_lru_cache_stale_sweep_time_sec, num_shards),
+          _enabled(capacity > 0) {}
+
 bool ObjLRUCache::lookup(const ObjKey& key, CacheHandle* handle) {
     if (!_enabled) {
         return false;
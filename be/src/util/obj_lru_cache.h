@@ -88,14 +88,19 @@ public:
 
     ObjLRUCache(int64_t capacity, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS);
 
+    // A cache whose capacity is in bytes, each object is charged by the 'charge' of insert().
+    ObjLRUCache(CachePolicy::CacheType type, int64_t capacity,
+                uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS);
+
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
     template <typename T>
-    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle) {
+    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle, size_t charge = 1) {
         if (_enabled) {
             const std::string& encoded_key = key.key;
             auto* obj_value = new ObjValue<T>(value);
-            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, sizeof(T),
+            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, charge,
+                                                  std::max(charge, sizeof(T)),
                                                   CachePriority::NORMAL);
             *cache_handle = CacheHandle {this, handle};
         } else {
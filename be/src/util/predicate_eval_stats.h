@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "common/logging.h"
+
+namespace doris {
+
+// The cost and the selectivity of one predicate of a conjunction, measured on the rows
+// it evaluates.
+struct PredicateEvalStats {
+    int64_t input_rows = 0;
+    int64_t output_rows = 0;
+    int64_t cost_ns = 0;
+
+    void update(int64_t input, int64_t output, int64_t ns) {
+        input_rows += input;
+        output_rows += output;
+        cost_ns += ns;
+    }
+
+    // The cost to filter out one row: the cost per input row divided by the fraction of
+    // the rows filtered out. Evaluating the predicates of a conjunction in the ascending
+    // order of rank minimizes the total cost when they are independent. A predicate not
+    // measured yet ranks first, so it is measured in the next round.
+    double rank() const {
+        if (input_rows == 0) {
+            return 0;
+        }
+        const double cost_per_row = static_cast<double>(cost_ns) / static_cast<double>(input_rows);
+        const double filtered_ratio =
+                static_cast<double>(input_rows - output_rows) / static_cast<double>(input_rows);
+        return cost_per_row / std::max(filtered_ratio, 1e-6);
+    }
+
+    // Halve the history, so that the order follows a change of the data.
+    void decay() {
+        input_rows /= 2;
+        output_rows /= 2;
+        cost_ns /= 2;
+    }
+};
+
+// Sort `items` and their `stats` in the ascending order of rank, the items with the same
+// rank keep their order. Return true if the order changes.
+template <typename T>
+bool reorder_by_rank(std::vector<T>* items, std::vector<PredicateEvalStats>* stats) {
+    DCHECK_EQ(items->size(), stats->size());
+    std::vector<size_t> order(items->size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+        return (*stats)[l].rank() < (*stats)[r].rank();
+    });
+    bool changed = false;
+    std::vector<T> sorted_items;
+    std::vector<PredicateEvalStats> sorted_stats;
+    sorted_items.reserve(order.size());
+    sorted_stats.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        changed |= order[i] != i;
+        sorted_items.push_back(std::move((*items)[order[i]]));
+        sorted_stats.push_back((*stats)[order[i]]);
+        sorted_stats.back().decay();
+    }
+    *items = std::move(sorted_items);
+    *stats = std::move(sorted_stats);
+    return changed;
+}
+
+} // namespace doris
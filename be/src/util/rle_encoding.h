@@ -19,6 +19,7 @@
 #include <glog/logging.h>
 
 #include <limits> // IWYU pragma: keep
+#include <type_traits>
 
 #include "common/cast_set.h"
 #include "util/bit_stream_utils.inline.h"
@@ -361,7 +362,18 @@ size_t RleDecoder<T>::get_values(T* values, size_t num_values) {
             read_num += read_this_time;
         } else if (literal_count_ > 0) {
             read_this_time = std::min((size_t)literal_count_, read_this_time);
-            for (int i = 0; i < read_this_time; ++i) {
+            size_t unpacked = 0;
+            if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+                // A literal run starts at a byte boundary and holds groups of 8 values, which
+                // end at byte boundaries too, so whole groups can be unpacked in batches.
+                if (literal_count_ % 8 == 0 && read_this_time >= 32) {
+                    unpacked = bit_reader_.UnpackBatch(
+                            bit_width_, cast_set<int>(read_this_time / 8 * 8),
+                            reinterpret_cast<std::make_unsigned_t<T>*>(values));
+                    values += unpacked;
+                }
+            }
+            for (size_t i = unpacked; i < read_this_time; ++i) {
                 bool result = bit_reader_.GetValue(bit_width_, values);
                 DCHECK(result);
                 values++;
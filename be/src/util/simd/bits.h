@@ -197,6 +197,52 @@ inline T count_zero_num(const int8_t* __restrict data, const uint8_t* __restrict
 }
 
 // TODO: compare with different SIMD implements
+// Returns a 64-bit mask whose i-th bit is set when data[i] equals `byte` or `other_byte`,
+// `data` must have at least 64 readable bytes.
+inline uint64_t bytes64_match_mask(const uint8_t* data, uint8_t byte, uint8_t other_byte) {
+#ifdef __SSE2__
+    const __m128i v_byte = _mm_set1_epi8(static_cast<char>(byte));
+    const __m128i v_other = _mm_set1_epi8(static_cast<char>(other_byte));
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+        const __m128i matched =
+                _mm_or_si128(_mm_cmpeq_epi8(values, v_byte), _mm_cmpeq_epi8(values, v_other));
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matched)))
+                << (i * 16);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; ++i) {
+        mask |= static_cast<uint64_t>(data[i] == byte || data[i] == other_byte) << i;
+    }
+    return mask;
+#endif
+}
+
+inline uint64_t bytes64_match_mask(const uint8_t* data, uint8_t byte) {
+    return bytes64_match_mask(data, byte, byte);
+}
+
+// Returns the position of the first byte in [start, end) which equals `byte` or `other_byte`,
+// returns `end` if not found.
+inline size_t find_first_of(const uint8_t* data, size_t start, size_t end, uint8_t byte,
+                            uint8_t other_byte) {
+    for (; start + 64 <= end; start += 64) {
+        const uint64_t mask = bytes64_match_mask(data + start, byte, other_byte);
+        if (mask != 0) {
+            return start + static_cast<size_t>(__builtin_ctzll(mask));
+        }
+    }
+    for (; start < end; ++start) {
+        if (data[start] == byte || data[start] == other_byte) {
+            return start;
+        }
+    }
+    return end;
+}
+
 template <class T>
 static size_t find_byte(const std::vector<T>& vec, size_t start, T byte) {
     if (start >= vec.size()) {
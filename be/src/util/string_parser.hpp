@@ -30,6 +30,7 @@
 // IWYU pragma: no_include <bits/std_abs.h>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <map>
 #include <string>
@@ -447,6 +448,27 @@ public:
         }
         return true;
     }
+
+    // Parses the 8 chars at s as one decimal number in a few 64-bit operations (SWAR).
+    // Returns false without touching *val if any of them is not a digit.
+    static inline bool parse_eight_digits(const char* __restrict s, uint32_t* val) {
+        uint64_t chunk;
+        memcpy(&chunk, s, sizeof(chunk));
+        // every byte is 0x30..0x39 iff its high nibble is 3 and adding 6 does not carry into it
+        if (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+            0x3333333333333333ULL) {
+            return false;
+        }
+        chunk -= 0x3030303030303030ULL;
+        // combine adjacent digits into 2-digit, then 4-digit, then the 8-digit value
+        chunk = (chunk * 10) + (chunk >> 8);
+        chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                 (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+                32;
+        *val = static_cast<uint32_t>(chunk);
+        return true;
+    }
 }; // end of class StringParser
 
 template <typename T, bool enable_strict_mode>
@@ -641,7 +663,16 @@ T StringParser::string_to_int_no_overflow(const char* __restrict s, int len, Par
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        // the caller guarantees no overflow, so whole 8-digit chunks can be folded in directly
+        uint32_t eight_digits = 0;
+        while (i + 8 <= len && parse_eight_digits(s + i, &eight_digits)) {
+            val = val * 100000000 + eight_digits;
+            i += 8;
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_approx_top.h"
@@ -59,6 +60,18 @@ class AggregateFunctionApproxTopK final
 private:
     using State = AggregateFunctionTopKGenericData;
 
+    static StringRef all_serialize_value_into_arena(size_t i, size_t keys_size,
+                                                    const IColumn** columns, Arena& arena) {
+        const char* begin = nullptr;
+
+        size_t sum_size = 0;
+        for (size_t j = 0; j < keys_size; ++j) {
+            sum_size += columns[j]->serialize_value_into_arena(i, arena, begin).size;
+        }
+
+        return {begin, sum_size};
+    }
+
 public:
     AggregateFunctionApproxTopK(const std::vector<std::string>& column_names,
                                 const DataTypes& argument_types_)
@@ -147,24 +160,37 @@ public:
             set.resize(_reserved);
         }
 
-        auto all_serialize_value_into_arena =
-                [](size_t i, size_t keys_size, const IColumn** columns, Arena& arena) -> StringRef {
-            const char* begin = nullptr;
-
-            size_t sum_size = 0;
-            for (size_t j = 0; j < keys_size; ++j) {
-                sum_size += columns[j]->serialize_value_into_arena(i, arena, begin).size;
-            }
-
-            return {begin, sum_size};
-        };
-
         StringRef str_serialized =
                 all_serialize_value_into_arena(row_num, _column_names.size(), columns, arena);
         set.insert(str_serialized);
         arena.rollback(str_serialized.size);
     }
 
+    // Serializes the whole batch first so that SpaceSaving can count duplicated keys
+    // before maintaining its counter list.
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        if (batch_size == 0) {
+            return;
+        }
+        if (!_init_flag) {
+            lazy_init(columns, 0, this->get_argument_types());
+        }
+
+        auto& set = this->data(place).value;
+        if (set.capacity() != _reserved) {
+            set.resize(_reserved);
+        }
+
+        // the serialized keys are only needed until they are inserted into the set
+        Arena keys_arena;
+        std::vector<StringRef> keys(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            keys[i] = all_serialize_value_into_arena(i, _column_names.size(), columns, keys_arena);
+        }
+        set.insert_batch(keys.data(), batch_size);
+    }
+
     void add_many(AggregateDataPtr __restrict place, const IColumn** columns,
                   std::vector<int>& rows, Arena& arena) const override {
         for (auto row : rows) {
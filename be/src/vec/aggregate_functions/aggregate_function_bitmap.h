@@ -125,6 +125,8 @@ struct AggregateFunctionGroupBitmapXorOp {
 
 template <typename Op>
 struct AggregateFunctionBitmapData {
+    static constexpr size_t MERGE_BATCH_MIN_ROWS = 8;
+
     BitmapValue value;
     bool is_first = true;
 
@@ -137,6 +139,25 @@ struct AggregateFunctionBitmapData {
 
     void merge(const BitmapValue& data) { Op::merge(value, data, is_first); }
 
+    // merge many states at once, union op could use fastunion instead of pairwise merge
+    void merge_batch(const BitmapValue* data, size_t num_rows) {
+        if constexpr (requires(std::vector<const BitmapValue*>& values) {
+                          Op::add_batch(value, values, is_first);
+                      }) {
+            if (num_rows >= MERGE_BATCH_MIN_ROWS) {
+                std::vector<const BitmapValue*> values(num_rows);
+                for (size_t i = 0; i != num_rows; ++i) {
+                    values[i] = data + i;
+                }
+                Op::add_batch(value, values, is_first);
+                return;
+            }
+        }
+        for (size_t i = 0; i != num_rows; ++i) {
+            merge(data[i]);
+        }
+    }
+
     void write(BufferWritable& buf) const { DataTypeBitMap::serialize_as_stream(value, buf); }
 
     void read(BufferReadable& buf) { DataTypeBitMap::deserialize_as_stream(value, buf); }
@@ -190,10 +211,7 @@ public:
         const auto& col = assert_cast<const ColumnBitmap&>(column);
         const size_t num_rows = column.size();
         const auto* data = col.get_data().data();
-
-        for (size_t i = 0; i != num_rows; ++i) {
-            this->data(place).merge(data[i]);
-        }
+        this->data(place).merge_batch(data, num_rows);
     }
 
     void deserialize_and_merge_from_column_range(AggregateDataPtr __restrict place,
@@ -203,9 +221,7 @@ public:
                 << ", begin:" << begin << ", end:" << end << ", column.size():" << column.size();
         const auto& col = assert_cast<const ColumnBitmap&>(column);
         const auto* data = col.get_data().data();
-        for (size_t i = begin; i <= end; ++i) {
-            this->data(place).merge(data[i]);
-        }
+        this->data(place).merge_batch(data + begin, end - begin + 1);
     }
 
     void deserialize_and_merge_vec(const AggregateDataPtr* places, size_t offset,
@@ -65,6 +65,20 @@ public:
         ++data(place).count;
     }
 
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn**, Arena&, bool) const override {
+        // Count the runs of the same group at once.
+        for (size_t i = 0; i < batch_size;) {
+            auto* place = places[i];
+            size_t end = i + 1;
+            while (end < batch_size && places[end] == place) {
+                ++end;
+            }
+            data(place + place_offset).count += end - i;
+            i = end;
+        }
+    }
+
     void reset(AggregateDataPtr place) const override {
         AggregateFunctionCount::data(place).count = 0;
     }
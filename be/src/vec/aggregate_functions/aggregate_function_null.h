@@ -491,7 +491,7 @@ public:
     void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
              Arena& arena) const override {
         /// This container stores the columns we really pass to the nested function.
-        std::vector<const IColumn*> nested_columns(number_of_arguments);
+        std::array<const IColumn*, MAX_ARGS> nested_columns;
 
         for (size_t i = 0; i < number_of_arguments; ++i) {
             if (is_nullable[i]) {
@@ -514,7 +514,63 @@ public:
                                    arena);
     }
 
+    void add_batch(size_t batch_size, AggregateDataPtr* __restrict places, size_t place_offset,
+                   const IColumn** columns, Arena& arena, bool agg_many) const override {
+        std::array<const IColumn*, MAX_ARGS> nested_columns;
+        if (!get_nested_columns_without_null(batch_size, columns, nested_columns.data())) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(places[i] + place_offset, columns, i, arena);
+            }
+            return;
+        }
+        if constexpr (result_is_nullable) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                AggregateDataPtr __restrict place = places[i] + place_offset;
+                place[0] |= 1;
+                this->nested_function->add(this->nested_place(place), nested_columns.data(), i,
+                                           arena);
+            }
+        } else {
+            this->nested_function->add_batch(batch_size, places, place_offset,
+                                             nested_columns.data(), arena, agg_many);
+        }
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        std::array<const IColumn*, MAX_ARGS> nested_columns;
+        if (!get_nested_columns_without_null(batch_size, columns, nested_columns.data())) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+            return;
+        }
+        this->set_flag(place);
+        this->nested_function->add_batch_single_place(batch_size, this->nested_place(place),
+                                                      nested_columns.data(), arena);
+    }
+
 private:
+    // Fills nested_columns and returns true if no argument has a null in the first batch_size
+    // rows, in which case the whole batch can go to the nested function at once.
+    bool get_nested_columns_without_null(size_t batch_size, const IColumn** columns,
+                                         const IColumn** nested_columns) const {
+        for (size_t i = 0; i < number_of_arguments; ++i) {
+            if (is_nullable[i]) {
+                const auto& nullable_col =
+                        assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(
+                                *columns[i]);
+                if (nullable_col.has_null(0, batch_size)) {
+                    return false;
+                }
+                nested_columns[i] = &nullable_col.get_nested_column();
+            } else {
+                nested_columns[i] = columns[i];
+            }
+        }
+        return true;
+    }
+
     // The array length is fixed in the implementation of some aggregate functions.
     // Therefore we choose 256 as the appropriate maximum length limit.
     static const size_t MAX_ARGS = 256;
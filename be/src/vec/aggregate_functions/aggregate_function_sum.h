@@ -100,6 +100,29 @@ public:
                 typename PrimitiveTypeTraits<TResult>::ColumnItemType(column.get_data()[row_num]));
     }
 
+    // Adjacent rows of the same group (low cardinality or clustered keys) are summed up in a
+    // local state first, so that the loop is vectorized and the state is stored once per run.
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena&, bool) const override {
+        const auto* __restrict src =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_data()
+                        .data();
+        for (size_t i = 0; i < batch_size;) {
+            auto* place = places[i];
+            size_t end = i + 1;
+            while (end < batch_size && places[end] == place) {
+                ++end;
+            }
+            Data run;
+            for (size_t j = i; j < end; ++j) {
+                run.add(typename PrimitiveTypeTraits<TResult>::ColumnItemType(src[j]));
+            }
+            this->data(place + place_offset).merge(run);
+            i = end;
+        }
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).sum = {}; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
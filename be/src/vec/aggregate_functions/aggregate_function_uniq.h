@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 
+#include <array>
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <type_traits>
@@ -54,6 +55,138 @@ template <PrimitiveType T>
 class ColumnDecimal;
 /// uniqExact
 
+/// Hash set of an exact distinct count state. It starts as one flat set and is split into
+/// NUM_PARTITIONS sets by hash once it holds more than TWO_LEVEL_THRESHOLD keys: growing then
+/// rehashes one small partition at a time instead of the whole set, and two large states are
+/// merged partition by partition so that each pair of partitions stays cache resident.
+template <typename Key, typename Hash>
+class UniqExactSet {
+public:
+    using SingleLevelSet = flat_hash_set<Key, Hash>;
+
+    static constexpr size_t NUM_PARTITIONS_BITS = 8;
+    static constexpr size_t NUM_PARTITIONS = 1ULL << NUM_PARTITIONS_BITS;
+    static constexpr size_t TWO_LEVEL_THRESHOLD = 1ULL << 16;
+
+    bool is_two_level() const { return _partitions != nullptr; }
+
+    void ALWAYS_INLINE insert(const Key& key) {
+        if (is_two_level()) {
+            size_t hash_value = _set.hash(key);
+            _partition(hash_value).lazy_emplace_with_hash(
+                    key, hash_value, [&](const auto& ctor) { ctor(key); });
+            return;
+        }
+        _set.insert(key);
+        if (UNLIKELY(_set.size() > TWO_LEVEL_THRESHOLD)) {
+            convert_to_two_level();
+        }
+    }
+
+    void ALWAYS_INLINE prefetch(const Key& key) {
+        size_t hash_value = _set.hash(key);
+        if (is_two_level()) {
+            _partition(hash_value).prefetch_hash(hash_value);
+        } else {
+            _set.prefetch_hash(hash_value);
+        }
+    }
+
+    size_t size() const {
+        if (!is_two_level()) {
+            return _set.size();
+        }
+        size_t res = 0;
+        for (const auto& partition : *_partitions) {
+            res += partition.size();
+        }
+        return res;
+    }
+
+    /// reserve space for num_elements keys in total
+    void reserve(size_t num_elements) {
+        if (!is_two_level() && num_elements > TWO_LEVEL_THRESHOLD) {
+            convert_to_two_level();
+        }
+        if (is_two_level()) {
+            for (auto& partition : *_partitions) {
+                partition.reserve(num_elements / NUM_PARTITIONS);
+            }
+        } else {
+            _set.reserve(num_elements);
+        }
+    }
+
+    void merge(const UniqExactSet& rhs) {
+        if (rhs.is_two_level()) {
+            if (!is_two_level()) {
+                convert_to_two_level();
+            }
+            // both sides partition with the same hash, so partition i only meets partition i
+            for (size_t i = 0; i != NUM_PARTITIONS; ++i) {
+                const auto& src = (*rhs._partitions)[i];
+                if (src.empty()) {
+                    continue;
+                }
+                auto& dst = (*_partitions)[i];
+                dst.reserve(dst.size() + src.size());
+                dst.insert(src.begin(), src.end());
+            }
+            return;
+        }
+        reserve(size() + rhs._set.size());
+        for (const auto& key : rhs._set) {
+            insert(key);
+        }
+    }
+
+    template <typename Func>
+    void for_each(Func&& func) const {
+        if (is_two_level()) {
+            for (const auto& partition : *_partitions) {
+                for (const auto& key : partition) {
+                    func(key);
+                }
+            }
+        } else {
+            for (const auto& key : _set) {
+                func(key);
+            }
+        }
+    }
+
+    void clear() {
+        _set.clear();
+        _partitions.reset();
+    }
+
+    void convert_to_two_level() {
+        DCHECK(!is_two_level());
+        _partitions = std::make_unique<std::array<SingleLevelSet, NUM_PARTITIONS>>();
+        for (auto& partition : *_partitions) {
+            partition.reserve(_set.size() / NUM_PARTITIONS);
+        }
+        for (const auto& key : _set) {
+            size_t hash_value = _set.hash(key);
+            _partition(hash_value).lazy_emplace_with_hash(
+                    key, hash_value, [&](const auto& ctor) { ctor(key); });
+        }
+        SingleLevelSet().swap(_set);
+    }
+
+private:
+    SingleLevelSet& _partition(size_t hash_value) {
+        // the flat sets probe with the low bits of the hash, so pick the partition from the
+        // high bits of a remixed hash to keep keys of one partition spread over its slots
+        size_t mixed = phmap::phmap_mix<sizeof(size_t)>()(hash_value);
+        return (*_partitions)[mixed >> (sizeof(size_t) * 8 - NUM_PARTITIONS_BITS)];
+    }
+
+    /// the single level set, empty once converted to two level (kept for its hasher)
+    SingleLevelSet _set;
+    std::unique_ptr<std::array<SingleLevelSet, NUM_PARTITIONS>> _partitions;
+};
+
 template <PrimitiveType T>
 struct AggregateFunctionUniqExactData {
     static constexpr bool is_string_key = is_string_type(T);
@@ -64,7 +197,7 @@ struct AggregateFunctionUniqExactData {
                                                   typename PrimitiveTypeTraits<T>::CppNativeType>>>;
     using Hash = HashCRC32<Key>;
 
-    using Set = flat_hash_set<Key, Hash>;
+    using Set = UniqExactSet<Key, Hash>;
 
     static UInt128 ALWAYS_INLINE get_key(const StringRef& value) {
         auto hash_value = XXH_INLINE_XXH128(value.data, value.size, 0);
@@ -184,12 +317,7 @@ public:
         auto& rhs_set = this->data(rhs).set;
         if (rhs_set.size() == 0) return;
 
-        auto& set = this->data(place).set;
-        set.rehash(set.size() + rhs_set.size());
-
-        for (auto elem : rhs_set) {
-            set.insert(elem);
-        }
+        this->data(place).set.merge(rhs_set);
     }
 
     void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
@@ -209,9 +337,7 @@ public:
     void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
         auto& set = this->data(place).set;
         buf.write_var_uint(set.size());
-        for (const auto& elem : set) {
-            buf.write_binary(elem);
-        }
+        set.for_each([&](const auto& elem) { buf.write_binary(elem); });
     }
 
     void deserialize_and_merge(AggregateDataPtr __restrict place, AggregateDataPtr __restrict rhs,
@@ -220,7 +346,7 @@ public:
         UInt64 size;
         buf.read_var_uint(size);
 
-        set.rehash(size + set.size());
+        set.reserve(size + set.size());
 
         for (size_t i = 0; i < size; ++i) {
             KeyType ref;
@@ -235,7 +361,7 @@ public:
         UInt64 size;
         buf.read_var_uint(size);
 
-        set.rehash(size + set.size());
+        set.reserve(size + set.size());
 
         for (size_t i = 0; i < size; ++i) {
             KeyType ref;
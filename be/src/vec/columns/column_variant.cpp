@@ -2522,29 +2522,38 @@ void ColumnVariant::fill_path_column_from_sparse_data(Subcolumn& subcolumn, Null
 
     const auto& sparse_data_paths = assert_cast<const ColumnString&>(sparse_data_map.get_keys());
     const auto& sparse_data_values = assert_cast<const ColumnString&>(sparse_data_map.get_values());
+    // A rare path is missing from most rows, so the missing rows are added as one run of
+    // defaults when the next row that has the path, or the end, is reached.
+    size_t num_missing = 0;
+    auto flush_missing = [&]() {
+        if (num_missing == 0) {
+            return;
+        }
+        subcolumn.insert_many_defaults(num_missing);
+        if (null_map) {
+            null_map->resize_fill(null_map->size() + num_missing, 1);
+        }
+        num_missing = 0;
+    };
     for (size_t i = start; i != end; ++i) {
         size_t paths_start = sparse_data_offsets[static_cast<ssize_t>(i) - 1];
         size_t paths_end = sparse_data_offsets[static_cast<ssize_t>(i)];
         auto lower_bound_path_index = ColumnVariant::find_path_lower_bound_in_sparse_data(
                 path, sparse_data_paths, paths_start, paths_end);
-        bool is_null = false;
         if (lower_bound_path_index != paths_end &&
             sparse_data_paths.get_data_at(lower_bound_path_index) == path) {
-            // auto value_data = sparse_data_values.get_data_at(lower_bound_path_index);
-            // ReadBufferFromMemory buf(value_data.data, value_data.size);
-            // dynamic_serialization->deserializeBinary(path_column, buf, getFormatSettings());
+            flush_missing();
             const auto& data = ColumnVariant::deserialize_from_sparse_column(
                     &sparse_data_values, lower_bound_path_index);
             subcolumn.insert(data.first, data.second);
-            is_null = false;
+            if (null_map) {
+                null_map->push_back(0);
+            }
         } else {
-            subcolumn.insert_default();
-            is_null = true;
-        }
-        if (null_map) {
-            null_map->push_back(is_null);
+            ++num_missing;
         }
     }
+    flush_missing();
 }
 
 MutableColumnPtr ColumnVariant::clone() const {
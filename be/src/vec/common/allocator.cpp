@@ -45,6 +45,33 @@ namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+namespace {
+// Maps an anonymous region for the mmap path of Allocator. With
+// enable_mmap_transparent_huge_pages the region is advised MADV_HUGEPAGE before any page is
+// touched, so the kernel can back it with 2MB pages instead of 4KB ones.
+void* mmap_anonymous(size_t size, int flags) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    if (doris::config::enable_mmap_transparent_huge_pages) {
+        // MAP_POPULATE would fault the region in as small pages before the advice applies,
+        // so pre-fault it after madvise instead.
+        const bool populate = (flags & MAP_POPULATE) != 0;
+        void* buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags & ~MAP_POPULATE, -1, 0);
+        if (MAP_FAILED != buf) {
+            // failures only mean the region stays on small pages
+            madvise(buf, size, MADV_HUGEPAGE);
+#ifdef MADV_POPULATE_WRITE
+            if (populate) {
+                madvise(buf, size, MADV_POPULATE_WRITE);
+            }
+#endif
+        }
+        return buf;
+    }
+#endif
+    return mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+}
+} // namespace
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
           bool check_and_tracking_memory>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
@@ -243,11 +270,34 @@ void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
                check_and_tracking_memory>::memory_check(size_t size) const {
     if (check_and_tracking_memory) {
         alloc_fault_probability();
+        if (can_skip_memory_check(size)) {
+            return;
+        }
         sys_memory_check(size);
         memory_tracker_check(size);
     }
 }
 
+template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
+          bool check_and_tracking_memory>
+bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
+               check_and_tracking_memory>::can_skip_memory_check(size_t size) const {
+    if (!doris::config::enable_amortized_allocator_memory_check) {
+        return false;
+    }
+#ifdef BE_TEST
+    if (!doris::pthread_context_ptr_init) {
+        return false;
+    }
+#endif
+    // Until the untracked memory reaches mem_tracker_consume_min_size_bytes the allocation is
+    // not consumed into the limiter tracker either, so checking once per flush keeps the
+    // limit as precise as the tracker. The allocation that makes the thread flush is checked.
+    return doris::thread_context()->thread_mem_tracker_mgr->untracked_mem() +
+                   static_cast<int64_t>(size) <
+           doris::config::mem_tracker_consume_min_size_bytes;
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
           bool check_and_tracking_memory>
 void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
@@ -319,7 +369,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
                     size);
         }
 
-        buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+        buf = mmap_anonymous(size, mmap_flags);
         if (MAP_FAILED == buf) {
             release_memory(size);
             throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
@@ -253,6 +253,8 @@ private:
     // If sys memory or tracker exceeds the limit, but there is no external catch bad_alloc,
     // alloc will continue to execute, so the consume memtracker is forced.
     void memory_check(size_t size) const;
+    // Whether the limit checks of memory_check can be skipped for a small allocation.
+    bool can_skip_memory_check(size_t size) const;
     void alloc_fault_probability() const;
 
     // Increases consumption of this tracker by 'bytes'.
@@ -69,6 +69,16 @@ struct MethodBaseInner {
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
         bucket_nums.resize(num_rows);
 
+        if constexpr (requires { hash_table->direct_bucket_num(keys[0]); }) {
+            if (hash_table->use_direct_mapping()) {
+                for (uint32_t k = 0; k < num_rows; ++k) {
+                    bucket_nums[k] = null_map && null_map[k]
+                                             ? bucket_size
+                                             : hash_table->direct_bucket_num(keys[k]);
+                }
+                return;
+            }
+        }
         if (null_map == nullptr) {
             init_join_bucket_num(num_rows, bucket_size);
             return;
@@ -19,10 +19,16 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <type_traits>
 
+#include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/exception.h"
 #include "common/status.h"
+#include "olap/rowset/segment_v2/block_split_bloom_filter.h"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/common/custom_allocator.h"
 #include "vec/common/hash_table/hash.h"
@@ -45,7 +51,9 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(_row_of) + cal_vector_mem(_partitioned_keys) +
+               (_bloom_filter ? _bloom_filter->size() : 0);
     }
 
     template <int JoinOpType>
@@ -69,6 +77,69 @@ public:
 
     uint32_t get_bucket_size() const { return bucket_size; }
 
+    // Map dense integral build keys directly to buckets if the range of the keys is not larger
+    // than the hash buckets: the bucket of `key` is `key - min + 1`, bucket 0 is left empty for
+    // the probe keys out of the range. Must be called after `prepare_build`, the bucket numbers
+    // must be computed again if it returns true.
+    bool try_direct_mapping(const Key* __restrict keys, const uint8_t* null_map,
+                            uint32_t num_elem)
+        requires std::is_integral_v<Key>
+    {
+        bool found = false;
+        Key min_key = std::numeric_limits<Key>::max();
+        Key max_key = std::numeric_limits<Key>::lowest();
+        // the first row in build side is not really from build side table
+        for (uint32_t i = 1; i < num_elem; i++) {
+            if (null_map && null_map[i]) {
+                continue;
+            }
+            found = true;
+            min_key = std::min(min_key, keys[i]);
+            max_key = std::max(max_key, keys[i]);
+        }
+        if (!found || static_cast<uint64_t>(max_key - min_key) + 2 > bucket_size) {
+            return false;
+        }
+        _use_direct_mapping = true;
+        _direct_min_key = min_key;
+        _direct_max_key = max_key;
+        bucket_size = static_cast<uint32_t>(max_key - min_key) + 2;
+        first.assign(bucket_size + 1, 0);
+        return true;
+    }
+
+    bool use_direct_mapping() const { return _use_direct_mapping; }
+
+    // Build a blocked bloom filter of the build keys, `pre_build_idxs` tests the probe keys
+    // against it before loading the chain heads, so that the probe rows without a match do not
+    // touch the much larger `first` array. Not useful when the keys are mapped directly.
+    Status build_bloom_filter(const Key* __restrict keys, uint32_t num_elem, double fpp) {
+        _bloom_filter.reset();
+        if (_use_direct_mapping || num_elem <= 1) {
+            return Status::OK();
+        }
+        std::unique_ptr<segment_v2::BloomFilter> bloom_filter;
+        RETURN_IF_ERROR(
+                segment_v2::BloomFilter::create(segment_v2::BLOCK_BLOOM_FILTER, &bloom_filter));
+        RETURN_IF_ERROR(bloom_filter->init(num_elem - 1, fpp, segment_v2::HASH_MURMUR3_X64_64));
+        // the first row in build side is not really from build side table
+        for (uint32_t i = 1; i < num_elem; i++) {
+            bloom_filter->add_hash(_bloom_hash(keys[i]));
+        }
+        _bloom_filter = std::move(bloom_filter);
+        return Status::OK();
+    }
+
+    bool has_bloom_filter() const { return _bloom_filter != nullptr; }
+
+    uint32_t direct_bucket_num(const Key& key) const
+        requires std::is_integral_v<Key>
+    {
+        return key >= _direct_min_key && key <= _direct_max_key
+                       ? static_cast<uint32_t>(key - _direct_min_key) + 1
+                       : 0;
+    }
+
     size_t size() const { return next.size(); }
 
     DorisVector<uint8_t>& get_visited() { return visited; }
@@ -77,12 +148,77 @@ public:
 
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
                uint32_t num_elem, bool keep_null_key) {
+        build_range(keys, bucket_nums, 1, num_elem);
+        finish_build(keep_null_key);
+    }
+
+    // Insert the rows in [begin, end) into the hash table, so that a big build can be split
+    // into several ranges in ascending order. `finish_build` must be called after the last range.
+    void build_range(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
+                     uint32_t begin, uint32_t end) {
         build_keys = keys;
-        for (uint32_t i = 1; i < num_elem; i++) {
+        for (uint32_t i = begin; i < end; i++) {
             uint32_t bucket_num = bucket_nums[i];
             next[i] = first[bucket_num];
             first[bucket_num] = i;
         }
+    }
+
+    // Same as `build_range`, but disjoint ranges may be built by several threads at the same time,
+    // a row is pushed to its chain by atomically exchanging the chain head. The keys must be set
+    // by `set_build_keys` before.
+    void build_range_concurrent(const uint32_t* __restrict bucket_nums, uint32_t begin,
+                                uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            next[i] = std::atomic_ref<uint32_t>(first[bucket_nums[i]])
+                              .exchange(i, std::memory_order_relaxed);
+        }
+    }
+
+    void set_build_keys(const Key* keys) { build_keys = keys; }
+
+    // Build the table with the rows grouped by bucket instead of chaining the rows in place. The
+    // rows are radix sorted by bucket number, so a bucket is a contiguous range of positions and
+    // walking it reads `build_keys` and `next` sequentially instead of one random miss per row.
+    // Chains link positions, `_row_of` maps a position back to its build row. `finish_build`
+    // must be called after it.
+    void build_partitioned(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
+                           uint32_t num_elem) {
+        // `first[b]` counts the rows of bucket `b`, then becomes the end of its range.
+        for (uint32_t i = 1; i < num_elem; i++) {
+            first[bucket_nums[i]]++;
+        }
+        uint32_t end = 1;
+        for (uint32_t b = 0; b <= bucket_size; b++) {
+            end += first[b];
+            first[b] = end;
+        }
+        _row_of.resize(num_elem);
+        _partitioned_keys.resize(num_elem);
+        _row_of[0] = 0;
+        // Fill backwards so that `first[b]` ends at the beginning of its range.
+        for (uint32_t i = num_elem; i-- > 1;) {
+            uint32_t pos = --first[bucket_nums[i]];
+            _row_of[pos] = i;
+            _partitioned_keys[pos] = keys[i];
+        }
+        next[0] = 0;
+        for (uint32_t b = 0; b <= bucket_size; b++) {
+            uint32_t begin = first[b];
+            uint32_t range_end = b < bucket_size ? first[b + 1] : num_elem;
+            if (begin == range_end) {
+                first[b] = 0;
+                continue;
+            }
+            for (uint32_t pos = begin; pos + 1 < range_end; pos++) {
+                next[pos] = pos + 1;
+            }
+            next[range_end - 1] = 0;
+        }
+        build_keys = _partitioned_keys.data();
+    }
+
+    void finish_build(bool keep_null_key) {
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
         }
@@ -211,12 +347,52 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
-        for (unsigned int& bucket : buckets) {
-            bucket = first[bucket];
+        const size_t num_buckets = buckets.size();
+        for (size_t i = 0; i < num_buckets; i++) {
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num_buckets)) {
+                __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]], 0, 1);
+            }
+            buckets[i] = first[buckets[i]];
+        }
+    }
+
+    // Same as above, but the probe rows whose keys are not in the bloom filter get the empty
+    // chain without reading `first`. The null bucket is always resolved.
+    void pre_build_idxs(DorisVector<uint32_t>& buckets, const Key* __restrict keys) const {
+        if (!_bloom_filter) {
+            pre_build_idxs(buckets);
+            return;
+        }
+        const size_t num_buckets = buckets.size();
+        for (size_t i = 0; i < num_buckets; i++) {
+            if (buckets[i] != bucket_size && !_bloom_filter->test_hash(_bloom_hash(keys[i]))) {
+                buckets[i] = 0;
+                continue;
+            }
+            buckets[i] = first[buckets[i]];
         }
     }
 
 private:
+    // The block of the filter is chosen by the high 32 bits, but only the low 32 bits of the
+    // crc32 hash are meaningful, spread them over the whole word.
+    uint64_t _bloom_hash(const Key& key) const {
+        return static_cast<uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    static constexpr int PROBE_PREFETCH_DIST = static_cast<int>(HASH_MAP_PREFETCH_DIST);
+
+    // The chain heads are resolved by `pre_build_idxs`, load the head of the probe row
+    // `PROBE_PREFETCH_DIST` rows ahead while the current row walks its chain.
+    ALWAYS_INLINE void _prefetch_chain_head(const uint32_t* __restrict build_idx_map,
+                                            int probe_idx, int probe_rows) const {
+        if (LIKELY(probe_idx + PROBE_PREFETCH_DIST < probe_rows)) {
+            const auto head = build_idx_map[probe_idx + PROBE_PREFETCH_DIST];
+            __builtin_prefetch(&build_keys[head], 0, 1);
+            __builtin_prefetch(&next[head], 0, 1);
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -243,11 +419,13 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
-                if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
-                    visited[build_idx] = 1;
+                const auto row = _to_row(build_idx);
+                if (!visited[row] && keys[probe_idx] == build_keys[build_idx]) {
+                    visited[row] = 1;
                 }
                 build_idx = next[build_idx];
             }
@@ -272,6 +450,7 @@ private:
                 }
             }
 
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -294,7 +473,7 @@ private:
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
                 if (keys[probe_idx] == build_keys[build_idx]) {
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = _to_row(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
                     matched_cnt++;
 
@@ -328,6 +507,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -348,13 +528,14 @@ private:
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
                 if (keys[probe_idx] == build_keys[build_idx]) {
+                    const auto row = _to_row(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = row;
                     matched_cnt++;
                     if constexpr (JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
                                   JoinOpType == TJoinOp::FULL_OUTER_JOIN) {
-                        if (!visited[build_idx]) {
-                            visited[build_idx] = 1;
+                        if (!visited[row]) {
+                            visited[row] = 1;
                         }
                     }
                 }
@@ -382,6 +563,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -409,7 +591,7 @@ private:
 
             while (build_idx && matched_cnt < batch_size) {
                 if (picking_null_keys || keys[probe_idx] == build_keys[build_idx]) {
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = _to_row(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
                     null_flags[matched_cnt] = picking_null_keys;
                     matched_cnt++;
@@ -441,6 +623,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
 
             /// If the probe key is null
@@ -460,6 +643,11 @@ private:
         return std::tuple {probe_idx, build_idx, matched_cnt, picking_null_keys};
     }
 
+    // The build row of a position in the chains, identity if the table is not partitioned.
+    uint32_t _to_row(uint32_t build_idx) const {
+        return _row_of.empty() ? build_idx : _row_of[build_idx];
+    }
+
     const Key* __restrict build_keys;
     DorisVector<uint8_t> visited;
 
@@ -469,6 +657,17 @@ private:
     DorisVector<uint32_t> first = {0};
     DorisVector<uint32_t> next = {0};
 
+    bool _use_direct_mapping = false;
+    Key _direct_min_key {};
+    Key _direct_max_key {};
+
+    // Only set by `build_bloom_filter`.
+    std::unique_ptr<segment_v2::BloomFilter> _bloom_filter;
+
+    // Only set by `build_partitioned`.
+    DorisVector<uint32_t> _row_of;
+    DorisVector<Key> _partitioned_keys;
+
     // use in iter hash map
     mutable uint32_t iter_idx = 1;
     bool _has_null_key = false;
@@ -58,6 +58,26 @@ struct StringHashMapCell<StringKey16, TMapped>
     static const StringKey16& get_key(const value_type& value_) { return value_.first; }
 };
 
+template <typename TMapped>
+struct StringHashMapCell<StringKey24, TMapped>
+        : public HashMapCell<StringKey24, TMapped, StringHashTableHash, HashTableNoState> {
+    using Base = HashMapCell<StringKey24, TMapped, StringHashTableHash, HashTableNoState>;
+    using value_type = typename Base::value_type;
+    using Base::Base;
+    static constexpr bool need_zero_value_storage = false;
+    bool is_zero(const HashTableNoState& state) const { return is_zero(this->value.first, state); }
+
+    // Zero means unoccupied cells in hash table. Use key with last word = 0 as
+    // zero keys, because such keys are unrepresentable (no way to encode length).
+    static bool is_zero(const StringKey24& key, const HashTableNoState&) { return key.c == 0; }
+    void set_zero() { this->value.first.c = 0; }
+
+    // external
+    const doris::StringRef get_key() const { return to_string_ref(this->value.first); } /// NOLINT
+    // internal
+    static const StringKey24& get_key(const value_type& value_) { return value_.first; }
+};
+
 template <typename TMapped>
 struct StringHashMapCell<doris::StringRef, TMapped>
         : public HashMapCellWithSavedHash<doris::StringRef, TMapped, StringHashTableHash,
@@ -103,6 +123,9 @@ struct StringHashMapSubMaps {
     using T4 = HashMapTable<StringHashMapSubKeys::T4,
                             StringHashMapCell<StringHashMapSubKeys::T4, TMapped>,
                             StringHashTableHash, StringHashTableGrower<>, Allocator>;
+    using T5 = HashMapTable<StringHashMapSubKeys::T5,
+                            StringHashMapCell<StringHashMapSubKeys::T5, TMapped>,
+                            StringHashTableHash, StringHashTableGrower<>, Allocator>;
     using Ts = HashMapTable<doris::StringRef, StringHashMapCell<doris::StringRef, TMapped>,
                             StringHashTableHash, StringHashTableGrower<>, Allocator>;
 };
@@ -146,6 +169,9 @@ public:
         for (auto& v : this->m4) {
             func(v.get_second());
         }
+        for (auto& v : this->m5) {
+            func(v.get_second());
+        }
         for (auto& v : this->ms) {
             func(v.get_second());
         }
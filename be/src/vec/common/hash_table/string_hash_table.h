@@ -31,19 +31,32 @@ using StringKey2 = doris::vectorized::UInt16;
 using StringKey4 = doris::vectorized::UInt32;
 using StringKey8 = doris::vectorized::UInt64;
 using StringKey16 = doris::vectorized::UInt128;
+struct StringKey24 {
+    doris::vectorized::UInt64 a;
+    doris::vectorized::UInt64 b;
+    doris::vectorized::UInt64 c;
+
+    bool operator==(const StringKey24 rhs) const { return a == rhs.a && b == rhs.b && c == rhs.c; }
+};
 
 struct StringHashMapSubKeys {
     using T1 = StringKey2;
     using T2 = StringKey4;
     using T3 = StringKey8;
     using T4 = StringKey16;
+    using T5 = StringKey24;
 };
 
 template <typename StringKey>
 StringKey to_string_key(const doris::StringRef& key) {
     DCHECK_LE(key.size, sizeof(StringKey));
     StringKey string_key {};
-    memcpy_small<sizeof(StringKey)>((char*)&string_key, key.data, key.size);
+    if constexpr (sizeof(StringKey) > 16) {
+        memcpy_fixed<StringKey16>((char*)&string_key, key.data);
+        memcpy_small<8>((char*)&string_key + 16, key.data + 16, key.size - 16);
+    } else {
+        memcpy_small<sizeof(StringKey)>((char*)&string_key, key.data, key.size);
+    }
     return string_key;
 }
 
@@ -56,6 +69,10 @@ inline doris::StringRef ALWAYS_INLINE to_string_ref(const StringKey16& n) {
     assert(n.items[1] != 0);
     return {reinterpret_cast<const char*>(&n), 16UL - (__builtin_clzll(n.items[1]) >> 3)};
 }
+inline doris::StringRef ALWAYS_INLINE to_string_ref(const StringKey24& n) {
+    assert(n.c != 0);
+    return {reinterpret_cast<const char*>(&n), 24UL - (__builtin_clzll(n.c) >> 3)};
+}
 
 struct StringHashTableHash {
 #if defined(__SSE4_2__) || defined(__aarch64__)
@@ -71,6 +88,13 @@ struct StringHashTableHash {
         res = _mm_crc32_u64(res, key.high());
         return res;
     }
+    size_t ALWAYS_INLINE operator()(StringKey24 key) const {
+        size_t res = -1ULL;
+        res = _mm_crc32_u64(res, key.a);
+        res = _mm_crc32_u64(res, key.b);
+        res = _mm_crc32_u64(res, key.c);
+        return res;
+    }
 #else
     template <typename T>
     size_t ALWAYS_INLINE operator()(T key) const {
@@ -88,6 +112,8 @@ struct StringHashTableHash {
             return StringHashTableHash()(to_string_key<StringHashMapSubKeys::T3>(key));
         } else if (key.size <= sizeof(StringHashMapSubKeys::T4)) {
             return StringHashTableHash()(to_string_key<StringHashMapSubKeys::T4>(key));
+        } else if (key.size <= sizeof(StringHashMapSubKeys::T5)) {
+            return StringHashTableHash()(to_string_key<StringHashMapSubKeys::T5>(key));
         }
         return doris::StringRefHash()(key);
     }
@@ -227,6 +253,7 @@ protected:
     using T2 = typename SubMaps::T2;
     using T3 = typename SubMaps::T3;
     using T4 = typename SubMaps::T4;
+    using T5 = typename SubMaps::T5;
 
     // Long strings are stored as doris::StringRef along with saved hash
     using Ts = typename SubMaps::Ts;
@@ -237,6 +264,7 @@ protected:
     T2 m2;
     T3 m3;
     T4 m4;
+    T5 m5;
     Ts ms;
 
     using Cell = typename Ts::cell_type;
@@ -251,7 +279,8 @@ protected:
         typename T2::iterator iterator2;
         typename T3::iterator iterator3;
         typename T4::iterator iterator4;
-        typename Ts::iterator iterator5;
+        typename T5::iterator iterator5;
+        typename Ts::iterator iterator6;
 
         typename Ts::cell_type cell;
 
@@ -261,8 +290,8 @@ protected:
         iterator_base() = default;
         iterator_base(Container* container_, bool end = false) : container(container_) {
             if (end) {
-                sub_table_index = 5;
-                iterator5 = container->ms.end();
+                sub_table_index = 6;
+                iterator6 = container->ms.end();
             } else {
                 sub_table_index = 0;
                 if (container->m0.size() == 0) {
@@ -299,7 +328,14 @@ protected:
                     return;
                 }
 
-                iterator5 = container->ms.begin();
+                iterator5 = container->m5.begin();
+                if (iterator5 == container->m5.end()) {
+                    sub_table_index++;
+                } else {
+                    return;
+                }
+
+                iterator6 = container->ms.begin();
             }
         }
 
@@ -326,6 +362,9 @@ protected:
             case 5: {
                 return iterator5 == rhs.iterator5;
             }
+            case 6: {
+                return iterator6 == rhs.iterator6;
+            }
             }
             throw doris::Exception(doris::Status::FatalError("__builtin_unreachable"));
         }
@@ -369,6 +408,13 @@ protected:
             }
             case 5: {
                 ++iterator5;
+                if (iterator5 == container->m5.end()) {
+                    need_switch_to_next = true;
+                }
+                break;
+            }
+            case 6: {
+                ++iterator6;
                 break;
             }
             }
@@ -406,7 +452,14 @@ protected:
                     break;
                 }
                 case 5: {
-                    iterator5 = container->ms.begin();
+                    iterator5 = container->m5.begin();
+                    if (iterator5 == container->m5.end()) {
+                        need_switch_to_next = true;
+                    }
+                    break;
+                }
+                case 6: {
+                    iterator6 = container->ms.begin();
                     break;
                 }
                 }
@@ -441,6 +494,10 @@ protected:
                 const_cast<iterator_base*>(this)->cell = *iterator5;
                 break;
             }
+            case 6: {
+                const_cast<iterator_base*>(this)->cell = *iterator6;
+                break;
+            }
             }
             return cell;
         }
@@ -466,7 +523,10 @@ protected:
                 return iterator4->get_hash(container->m4);
             }
             case 5: {
-                return iterator5->get_hash(container->ms);
+                return iterator5->get_hash(container->m5);
+            }
+            case 6: {
+                return iterator6->get_hash(container->ms);
             }
             }
         }
@@ -502,11 +562,12 @@ public:
     StringHashTable() = default;
 
     explicit StringHashTable(size_t reserve_for_num_elements)
-            : m1 {reserve_for_num_elements / 5},
-              m2 {reserve_for_num_elements / 5},
-              m3 {reserve_for_num_elements / 5},
-              m4 {reserve_for_num_elements / 5},
-              ms {reserve_for_num_elements / 5} {}
+            : m1 {reserve_for_num_elements / 6},
+              m2 {reserve_for_num_elements / 6},
+              m3 {reserve_for_num_elements / 6},
+              m4 {reserve_for_num_elements / 6},
+              m5 {reserve_for_num_elements / 6},
+              ms {reserve_for_num_elements / 6} {}
 
     ~StringHashTable() = default;
 
@@ -548,6 +609,9 @@ public:
         if (sz <= sizeof(StringHashMapSubKeys::T4)) {
             return func(self.m4, to_string_key<StringHashMapSubKeys::T4>(key), key, hash_value);
         }
+        if (sz <= sizeof(StringHashMapSubKeys::T5)) {
+            return func(self.m5, to_string_key<StringHashMapSubKeys::T5>(key), key, hash_value);
+        }
 
         return func(self.ms, std::forward<KeyHolder>(key), key, hash_value);
     }
@@ -610,6 +674,8 @@ public:
             m3.template prefetch<read>(hash_value);
         } else if (key.size <= sizeof(StringHashMapSubKeys::T4)) {
             m4.template prefetch<read>(hash_value);
+        } else if (key.size <= sizeof(StringHashMapSubKeys::T5)) {
+            m5.template prefetch<read>(hash_value);
         } else {
             ms.template prefetch<read>(hash_value);
         }
@@ -640,17 +706,19 @@ public:
     }
 
     size_t size() const {
-        return m0.size() + m1.size() + m2.size() + m3.size() + m4.size() + ms.size();
+        return m0.size() + m1.size() + m2.size() + m3.size() + m4.size() + m5.size() + ms.size();
     }
 
     bool empty() const {
-        return m0.empty() && m1.empty() && m2.empty() && m3.empty() && m4.empty() && ms.empty();
+        return m0.empty() && m1.empty() && m2.empty() && m3.empty() && m4.empty() && m5.empty() &&
+               ms.empty();
     }
 
     size_t get_buffer_size_in_bytes() const {
         return m0.get_buffer_size_in_bytes() + m1.get_buffer_size_in_bytes() +
                m2.get_buffer_size_in_bytes() + m3.get_buffer_size_in_bytes() +
-               m4.get_buffer_size_in_bytes() + ms.get_buffer_size_in_bytes();
+               m4.get_buffer_size_in_bytes() + m5.get_buffer_size_in_bytes() +
+               ms.get_buffer_size_in_bytes();
     }
 
     class iterator : public iterator_base<iterator, false> {
@@ -676,7 +744,7 @@ public:
     bool add_elem_size_overflow(size_t add_size) const {
         return m1.add_elem_size_overflow(add_size) || m2.add_elem_size_overflow(add_size) ||
                m3.add_elem_size_overflow(add_size) || m4.add_elem_size_overflow(add_size) ||
-               ms.add_elem_size_overflow(add_size);
+               m5.add_elem_size_overflow(add_size) || ms.add_elem_size_overflow(add_size);
     }
 
     size_t estimate_memory(size_t num_elem) const {
@@ -698,6 +766,10 @@ public:
             estimate_size = std::max(estimate_size, m4.estimate_memory(num_elem));
         }
 
+        if (m5.add_elem_size_overflow(num_elem)) {
+            estimate_size = std::max(estimate_size, m5.estimate_memory(num_elem));
+        }
+
         if (ms.add_elem_size_overflow(num_elem)) {
             estimate_size = std::max(estimate_size, ms.estimate_memory(num_elem));
         }
@@ -38,6 +38,7 @@
 #include <memory>
 #include <ostream>
 #include <set>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -51,6 +52,7 @@
 #include "olap/rowset/rowset_fwd.h"
 #include "olap/rowset/segment_v2/variant/variant_column_reader.h"
 #include "olap/rowset/segment_v2/variant/variant_column_writer_impl.h"
+#include "olap/rowset/segment_v2/variant/variant_path_access_tracker.h"
 #include "olap/segment_loader.h"
 #include "olap/tablet.h"
 #include "olap/tablet_fwd.h"
@@ -748,18 +750,19 @@ Status VariantCompactionUtil::aggregate_variant_extended_info(
 // get the subpaths and sparse paths for the variant column
 void VariantCompactionUtil::get_subpaths(int32_t max_subcolumns_count,
                                          const PathToNoneNullValues& stats,
-                                         TabletSchema::PathsSetInfo& paths_set_info) {
+                                         TabletSchema::PathsSetInfo& paths_set_info,
+                                         const std::unordered_set<std::string>& hot_paths) {
     // max_subcolumns_count is 0 means no limit
     if (max_subcolumns_count > 0 && stats.size() > max_subcolumns_count) {
-        std::vector<std::pair<size_t, std::string_view>> paths_with_sizes;
+        std::vector<std::tuple<bool, size_t, std::string_view>> paths_with_sizes;
         paths_with_sizes.reserve(stats.size());
         for (const auto& [path, size] : stats) {
-            paths_with_sizes.emplace_back(size, path);
+            paths_with_sizes.emplace_back(hot_paths.contains(path), size, path);
         }
         std::sort(paths_with_sizes.begin(), paths_with_sizes.end(), std::greater());
 
         // Select top N paths as subcolumns, remaining paths as sparse columns
-        for (const auto& [size, path] : paths_with_sizes) {
+        for (const auto& [_, size, path] : paths_with_sizes) {
             if (paths_set_info.sub_path_set.size() < max_subcolumns_count) {
                 paths_set_info.sub_path_set.emplace(path);
             } else {
@@ -1053,10 +1056,15 @@ Status VariantCompactionUtil::get_extended_compaction_schema(
                 uid_to_variant_extended_info[column->unique_id()].path_to_data_types, column,
                 output_schema, uid_to_paths_set_info[column->unique_id()]));
 
-        // 3. get the subpaths
+        // 3. get the subpaths, the paths queries keep reading from the sparse column first
+        std::unordered_set<std::string> hot_paths;
+        if (config::variant_hot_path_min_access_count > 0 && !rowsets.empty()) {
+            hot_paths = segment_v2::VariantPathAccessTracker::instance()->take_hot_paths(
+                    rowsets.front()->rowset_meta()->tablet_id(), column->unique_id());
+        }
         get_subpaths(column->variant_max_subcolumns_count(),
                      uid_to_variant_extended_info[column->unique_id()].path_to_none_null_values,
-                     uid_to_paths_set_info[column->unique_id()]);
+                     uid_to_paths_set_info[column->unique_id()], hot_paths);
 
         // 4. append subcolumns
         if (column->variant_max_subcolumns_count() > 0 || !column->get_sub_columns().empty()) {
@@ -25,6 +25,7 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 
 #include "common/status.h"
 #include "olap/tablet_fwd.h"
@@ -161,8 +162,10 @@ bool generate_sub_column_info(const TabletSchema& schema, int32_t col_unique_id,
 class VariantCompactionUtil {
 public:
     // get the subpaths and sparse paths for the variant column
+    // the hot paths are picked as subcolumns before the others if they have values
     static void get_subpaths(int32_t max_subcolumns_count, const PathToNoneNullValues& path_stats,
-                             TabletSchema::PathsSetInfo& paths_set_info);
+                             TabletSchema::PathsSetInfo& paths_set_info,
+                             const std::unordered_set<std::string>& hot_paths = {});
 
     // collect extended info from the variant column
     static Status aggregate_variant_extended_info(
@@ -88,15 +88,15 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
 }
 
 Status MergeSorterState::merge_sort_read(doris::vectorized::Block* block, int batch_size,
-                                         bool* eos) {
+                                         bool* eos, const RuntimeState* state) {
     DCHECK(_sorted_blocks.empty());
     DCHECK(unsorted_block()->empty());
-    _merge_sort_read_impl(batch_size, block, eos);
+    _merge_sort_read_impl(batch_size, block, eos, state);
     return Status::OK();
 }
 
 void MergeSorterState::_merge_sort_read_impl(int batch_size, doris::vectorized::Block* block,
-                                             bool* eos) {
+                                             bool* eos, const RuntimeState* state) {
     size_t num_columns = unsorted_block()->columns();
 
     MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(block, *unsorted_block());
@@ -106,6 +106,10 @@ void MergeSorterState::_merge_sort_read_impl(int batch_size, doris::vectorized::
     size_t merged_rows = 0;
     // process single element queue on merge_sort_read()
     while (_queue.is_valid() && merged_rows < batch_size) {
+        if (_offset > 0 && state && state->should_yield()) {
+            // Nothing is output yet since the offset is not skipped, yield with an empty block.
+            break;
+        }
         auto [current, current_rows] = _queue.current();
         current_rows = std::min(current_rows, batch_size - merged_rows);
 
@@ -129,7 +133,7 @@ void MergeSorterState::_merge_sort_read_impl(int batch_size, doris::vectorized::
     }
 
     block->set_columns(std::move(merged_columns));
-    *eos = merged_rows == 0;
+    *eos = merged_rows == 0 && !_queue.is_valid();
 }
 
 Status Sorter::merge_sort_read_for_spill(RuntimeState* state, doris::vectorized::Block* block,
@@ -275,7 +279,7 @@ Status FullSorter::prepare_for_read(bool is_spill) {
 }
 
 Status FullSorter::get_next(RuntimeState* state, Block* block, bool* eos) {
-    return _state->merge_sort_read(block, state->batch_size(), eos);
+    return _state->merge_sort_read(block, state->batch_size(), eos, state);
 }
 
 Status FullSorter::merge_sort_read_for_spill(RuntimeState* state, doris::vectorized::Block* block,
@@ -66,7 +66,10 @@ public:
 
     Status build_merge_tree(const SortDescription& sort_description);
 
-    Status merge_sort_read(doris::vectorized::Block* block, int batch_size, bool* eos);
+    // If `state` is not null, skipping a large offset yields with an empty block and `eos` false
+    // once the time slice of the task is used up.
+    Status merge_sort_read(doris::vectorized::Block* block, int batch_size, bool* eos,
+                           const RuntimeState* state = nullptr);
 
     size_t data_size() const {
         size_t size = _unsorted_block->bytes();
@@ -86,7 +89,8 @@ public:
     void ignore_offset() { _offset = 0; }
 
 private:
-    void _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos);
+    void _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos,
+                               const RuntimeState* state);
 
     std::unique_ptr<Block> _unsorted_block;
     MergeSorterQueue _queue;
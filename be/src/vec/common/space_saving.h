@@ -165,6 +165,19 @@ public:
         push(std::make_unique<Counter>(arena.emplace(key), alpha + increment, alpha + error, hash));
     }
 
+    // Inserts a batch of keys. Duplicated keys of the batch are counted first, so that each
+    // distinct key is looked up and percolated once with its total count instead of per row.
+    void insert_batch(const TKey* keys, size_t num_keys) {
+        flat_hash_map<TKey, uint64_t, Hash> batch_counts;
+        batch_counts.reserve(num_keys);
+        for (size_t i = 0; i < num_keys; ++i) {
+            ++batch_counts[keys[i]];
+        }
+        for (const auto& [key, count] : batch_counts) {
+            insert(key, count);
+        }
+    }
+
     // Merges another `SpaceSaving` object into the current one. Updates counts and errors of elements.
     // If the other object is full, it adds its elements to the current list and maintains sorting.
     void merge(const Self& rhs) {
@@ -20,10 +20,156 @@
 
 #include "vec/core/sort_block.h"
 
+#include <cstring>
+
+#include "common/config.h"
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+
+namespace {
+
+// The sort keys of a row encoded into `Width` memcomparable bytes, like `KeyCoder` does for the
+// short keys: a null byte for the nullable keys, then big endian values with the sign bit
+// flipped, all the bits inverted for the descending keys.
+template <size_t Width>
+struct NormalizedKey {
+    uint8_t key[Width];
+    uint32_t row;
+
+    bool operator<(const NormalizedKey& rhs) const { return memcmp(key, rhs.key, Width) < 0; }
+};
+
+static constexpr size_t MAX_NORMALIZED_KEY_WIDTH = 32;
+
+template <typename T>
+void encode_normalized_key(const T* data, const NullMap* null_map, bool null_last, bool desc,
+                           size_t rows, size_t offset, uint8_t* keys, size_t entry_size) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    for (size_t i = 0; i != rows; ++i) {
+        auto* key = keys + i * entry_size + offset;
+        if (null_map) {
+            if ((*null_map)[i]) {
+                // All the null keys are equal, the value bytes are left zero.
+                *key = null_last ? 1 : 0;
+                continue;
+            }
+            *key++ = null_last ? 0 : 1;
+        }
+        auto value = static_cast<UnsignedT>(data[i]);
+        if constexpr (std::is_signed_v<T>) {
+            value ^= UnsignedT(1) << (sizeof(T) * 8 - 1);
+        }
+        if (desc) {
+            value = ~value;
+        }
+        for (size_t j = 0; j != sizeof(T); ++j) {
+            key[j] = static_cast<uint8_t>(value >> ((sizeof(T) - 1 - j) * 8));
+        }
+    }
+}
+
+// Encode one key column into the normalized keys, returns the number of bytes used, or 0 if the
+// column can not be normalized.
+size_t encode_normalized_key_column(const ColumnWithSortDescription& column, size_t rows,
+                                    size_t offset, uint8_t* keys, size_t entry_size, bool encode) {
+    const IColumn* data_column = column.first;
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(data_column)) {
+        data_column = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    const bool desc = column.second.direction < 0;
+    // The effective order of a null compared to a non-null value, see `ColumnNullable::compare_at`.
+    const bool null_last = column.second.direction * column.second.nulls_direction > 0;
+    size_t width = 0;
+    auto try_encode = [&]<typename ColumnType>(const ColumnType* typed_column, auto get_data) {
+        if (!typed_column) {
+            return false;
+        }
+        const auto* data = get_data(typed_column);
+        width = sizeof(*data) + (null_map != nullptr);
+        if (encode) {
+            encode_normalized_key(data, null_map, null_last, desc, rows, offset, keys, entry_size);
+        }
+        return true;
+    };
+    auto vector_data = [](const auto* col) { return col->get_data().data(); };
+    auto decimal_data = [](const auto* col) { return &col->get_data().data()->value; };
+    // Only the types compared by their integer values, e.g. not floats because of NaN.
+    (void)(try_encode(check_and_get_column<ColumnInt8>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnInt16>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnInt32>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnInt64>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnInt128>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnUInt8>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnDateV2>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnDateTimeV2>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnIPv4>(data_column), vector_data) ||
+           try_encode(check_and_get_column<ColumnDecimal32>(data_column), decimal_data) ||
+           try_encode(check_and_get_column<ColumnDecimal64>(data_column), decimal_data) ||
+           try_encode(check_and_get_column<ColumnDecimal128V3>(data_column), decimal_data));
+    return width;
+}
+
+template <size_t Width>
+void sort_normalized_keys(const ColumnsWithSortDescriptions& columns, size_t rows, UInt64 limit,
+                          IColumn::Permutation& perm) {
+    std::vector<NormalizedKey<Width>> keys(rows);
+    memset(keys.data(), 0, rows * sizeof(NormalizedKey<Width>));
+    auto* bytes = reinterpret_cast<uint8_t*>(keys.data());
+    size_t offset = 0;
+    for (const auto& column : columns) {
+        offset += encode_normalized_key_column(column, rows, offset, bytes,
+                                               sizeof(NormalizedKey<Width>), true);
+    }
+    for (size_t i = 0; i != rows; ++i) {
+        keys[i].row = static_cast<uint32_t>(i);
+    }
+
+    if (limit) {
+        std::partial_sort(keys.begin(), keys.begin() + limit, keys.end());
+    } else {
+        pdqsort(keys.begin(), keys.end());
+    }
+    for (size_t i = 0; i != rows; ++i) {
+        perm[i] = keys[i].row;
+    }
+}
+
+// Sort by one memcomparable key per row if all the sort keys are fixed width integers, so that
+// the rows are compared by a fixed size memcmp instead of a virtual compare per key column.
+bool sort_by_normalized_key(const ColumnsWithSortDescriptions& columns, size_t rows, UInt64 limit,
+                            IColumn::Permutation& perm) {
+    if (!config::enable_sort_normalized_key) {
+        return false;
+    }
+    size_t width = 0;
+    for (const auto& column : columns) {
+        auto column_width = encode_normalized_key_column(column, rows, 0, nullptr, 0, false);
+        if (column_width == 0) {
+            return false;
+        }
+        width += column_width;
+    }
+    if (width <= 8) {
+        sort_normalized_keys<8>(columns, rows, limit, perm);
+    } else if (width <= 16) {
+        sort_normalized_keys<16>(columns, rows, limit, perm);
+    } else if (width <= 24) {
+        sort_normalized_keys<24>(columns, rows, limit, perm);
+    } else if (width <= MAX_NORMALIZED_KEY_WIDTH) {
+        sort_normalized_keys<MAX_NORMALIZED_KEY_WIDTH>(columns, rows, limit, perm);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -78,7 +224,7 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
 
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
-        {
+        if (!sort_by_normalized_key(columns_with_sort_desc, size, limit, perm)) {
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
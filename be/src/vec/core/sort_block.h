@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -142,6 +143,17 @@ struct PermutationWithInlineValue {
     uint32_t row_id;
 };
 
+// Strings also keep their first 8 bytes as a big endian integer, zero padded, so that most
+// comparisons are decided on the prefix without loading the string data.
+template <PrimitiveType T>
+    requires(is_string_type(T))
+struct PermutationWithInlineValue<T> {
+    using ValueType = StringRef;
+    ValueType inline_value;
+    uint64_t prefix;
+    uint32_t row_id;
+};
+
 template <PrimitiveType T>
 using PermutationForColumn = std::vector<PermutationWithInlineValue<T>>;
 
@@ -351,6 +363,14 @@ private:
     template <typename ColumnType>
     static constexpr bool always_false_v = false;
 
+    // the first 8 bytes of str, zero padded, as a big endian integer: two strings with
+    // different prefixes compare the same way as their prefixes
+    static uint64_t _string_prefix(const StringRef& str) {
+        uint64_t prefix = 0;
+        memcpy(&prefix, str.data, std::min(str.size, sizeof(prefix)));
+        return __builtin_bswap64(prefix);
+    }
+
     template <typename ColumnType, PrimitiveType T>
     void _create_permutation(const ColumnType& column,
                              PermutationWithInlineValue<T>* __restrict permutation_for_column,
@@ -363,6 +383,8 @@ private:
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
                 permutation_for_column[i].inline_value = column.get_data_at(row_id);
+                permutation_for_column[i].prefix =
+                        _string_prefix(permutation_for_column[i].inline_value);
             } else {
                 static_assert(always_false_v<ColumnType>);
             }
@@ -447,6 +469,9 @@ private:
             if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
                 return Compare::compare(a.inline_value, b.inline_value);
             } else {
+                if (a.prefix != b.prefix) {
+                    return a.prefix < b.prefix ? -1 : 1;
+                }
                 return memcmp_small_allow_overflow15(
                         reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
                         reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
@@ -440,30 +440,42 @@ private:
         batch_size = 1;
         size_t child_idx = next_child_index();
         auto& next_child_cursor = *(_queue.begin() + child_idx);
+        size_t remaining_rows = min_cursor_size - min_cursor_pos;
 
-        auto add_if_better = [&](size_t step) {
-            if (min_cursor_pos + batch_size + step > min_cursor_size) {
-                return false;
-            }
-            if (next_child_cursor.greater_or_equals_with_offset(begin_cursor, 0,
-                                                                batch_size + step - 1)) {
-                batch_size += step;
-                return true;
-            }
-            return false;
+        /// The first `num_rows` rows of the top cursor can be taken before the head of the
+        /// next child, which is monotonic in `num_rows` because the cursor is sorted.
+        auto fits = [&](size_t num_rows) {
+            return next_child_cursor.greater_or_equals_with_offset(begin_cursor, 0, num_rows - 1);
         };
 
-        if (!add_if_better(1)) {
+        if (remaining_rows <= 1 || !fits(2)) {
             return;
         }
-
-        size_t big_step = min_cursor_size - min_cursor_pos - batch_size;
-        if (add_if_better(big_step)) {
+        if (fits(remaining_rows)) {
+            batch_size = remaining_rows;
             return;
         }
 
-        while (add_if_better(1)) {
+        /// Gallop to bound the run, then binary search inside the last step:
+        /// `lo` rows always fit and `hi` rows never do.
+        size_t lo = 2;
+        size_t hi = remaining_rows;
+        for (size_t step = 2; lo + step < hi; step *= 2) {
+            if (!fits(lo + step)) {
+                hi = lo + step;
+                break;
+            }
+            lo += step;
+        }
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (fits(mid)) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
         }
+        batch_size = lo;
     }
 };
 template <typename Cursor>
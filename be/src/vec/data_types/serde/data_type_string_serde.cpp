@@ -223,17 +223,25 @@ Status DataTypeStringSerDeBase<ColumnType>::write_column_to_arrow_impl(const ICo
                                                                        BuilderType& builder,
                                                                        int64_t start,
                                                                        int64_t end) const {
+    if (start >= end) {
+        return Status::OK();
+    }
     const auto& string_column = assert_cast<const ColumnType&>(column);
+    const auto& offsets = string_column.get_offsets();
+    // Reserve the offsets and the chars of all the rows up front, so that the rows are appended
+    // without a capacity check and a possible reallocation per row.
+    RETURN_IF_ERROR(checkArrowStatus(builder.Reserve(end - start), column.get_name(),
+                                     builder.type()->name()));
+    RETURN_IF_ERROR(checkArrowStatus(
+            builder.ReserveData(static_cast<int64_t>(offsets[end - 1] - offsets[start - 1])),
+            column.get_name(), builder.type()->name()));
     for (size_t string_i = start; string_i < end; ++string_i) {
         if (null_map && (*null_map)[string_i]) {
-            RETURN_IF_ERROR(checkArrowStatus(builder.AppendNull(), column.get_name(),
-                                             builder.type()->name()));
+            builder.UnsafeAppendNull();
             continue;
         }
         auto string_ref = string_column.get_data_at(string_i);
-        RETURN_IF_ERROR(checkArrowStatus(
-                builder.Append(string_ref.data, cast_set<int, size_t, false>(string_ref.size)),
-                column.get_name(), builder.type()->name()));
+        builder.UnsafeAppend(string_ref.data, cast_set<int, size_t, false>(string_ref.size));
     }
     return Status::OK();
 }
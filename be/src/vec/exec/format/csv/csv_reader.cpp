@@ -42,6 +42,7 @@
 #include "io/fs/tracing_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/core/block.h"
@@ -85,8 +86,21 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
                                                          std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const auto sep = static_cast<uint8_t>(_value_sep[0]);
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
+    size_t i = 0;
+    // match the separator 64 bytes at a time, then walk the set bits of the mask
+    for (; i + 64 <= size; i += 64) {
+        uint64_t mask = simd::bytes64_match_mask(reinterpret_cast<const uint8_t*>(data + i), sep);
+        while (mask != 0) {
+            const size_t pos = i + static_cast<size_t>(__builtin_ctzll(mask));
+            process_value_func(data, value_start, pos - value_start, _trimming_char,
+                               splitted_values);
+            value_start = pos + _value_sep_len;
+            mask &= mask - 1;
+        }
+    }
+    for (; i < size; ++i) {
         if (data[i] == _value_sep[0]) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
             value_start = i + _value_sep_len;
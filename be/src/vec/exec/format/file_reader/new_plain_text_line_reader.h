@@ -36,6 +36,7 @@ struct IOContext;
 
 class Decompressor;
 class Status;
+class TextDecompressPipeline;
 
 class TextLineReaderContextIf {
 public:
@@ -255,6 +256,8 @@ private:
 
     void extend_input_buf();
     Status extend_output_buf();
+    // start decompressing on the text decompress thread pool if it is enabled
+    void start_decompress_pipeline();
 
     RuntimeProfile* _profile = nullptr;
     io::FileReaderSPtr _file_reader;
@@ -286,6 +289,10 @@ private:
 
     size_t _current_offset;
 
+    // reads and decompresses the file ahead of the line parsing, nullptr if not enabled
+    std::unique_ptr<TextDecompressPipeline> _decompress_pipeline;
+    bool _decompress_pipeline_checked = false;
+
     // Profile counters
     RuntimeProfile::Counter* _bytes_decompress_counter = nullptr;
     RuntimeProfile::Counter* _decompress_timer = nullptr;
@@ -32,6 +32,7 @@
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string_view>
@@ -57,6 +58,7 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_struct.h"
+#include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type_array.h"
@@ -176,6 +178,20 @@ Status NewJsonReader::init_reader(
     //use serde insert data to column.
     for (auto* slot_desc : _file_slot_descs) {
         _serdes.emplace_back(slot_desc->get_data_type_ptr()->get_serde());
+        PrimitiveType type = remove_nullable(slot_desc->get_data_type_ptr())->get_primitive_type();
+        switch (type) {
+        case TYPE_TINYINT:
+        case TYPE_SMALLINT:
+        case TYPE_INT:
+        case TYPE_BIGINT:
+        case TYPE_DOUBLE:
+        case TYPE_VARCHAR:
+        case TYPE_STRING:
+            break;
+        default:
+            type = INVALID_TYPE;
+        }
+        _direct_write_types.push_back(type);
     }
 
     // create decompressor.
@@ -925,11 +941,15 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         }
         simdjson::ondemand::value val = field.value();
         auto* column_ptr = block.get_by_position(column_index).column->assume_mutable().get();
-        RETURN_IF_ERROR(_simdjson_write_data_to_column(
-                val, slot_descs[column_index]->type(), column_ptr,
-                slot_descs[column_index]->col_name(), _serdes[column_index], valid));
-        if (!(*valid)) {
-            return Status::OK();
+        bool written = false;
+        RETURN_IF_ERROR(_simdjson_write_direct(val, column_index, column_ptr, &written));
+        if (!written) {
+            RETURN_IF_ERROR(_simdjson_write_data_to_column(
+                    val, slot_descs[column_index]->type(), column_ptr,
+                    slot_descs[column_index]->col_name(), _serdes[column_index], valid));
+            if (!(*valid)) {
+                return Status::OK();
+            }
         }
         _seen_columns[column_index] = true;
         has_valid_value = true;
@@ -1016,6 +1036,82 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
     return Status::OK();
 }
 
+template <typename ColumnType>
+static Status insert_json_integer(simdjson::ondemand::value& value, IColumn* column) {
+    using T = typename ColumnType::value_type;
+    int64_t int_value = value.get_int64();
+    if constexpr (!std::is_same_v<T, int64_t>) {
+        if (int_value < std::numeric_limits<T>::min() ||
+            int_value > std::numeric_limits<T>::max()) {
+            return Status::InvalidArgument("parse number fail, string: '{}'", int_value);
+        }
+    }
+    assert_cast<ColumnType*>(column)->insert_value(static_cast<T>(int_value));
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_write_direct(simdjson::ondemand::value& value,
+                                             size_t column_index, vectorized::IColumn* column_ptr,
+                                             bool* written) {
+    *written = false;
+    const PrimitiveType type = _direct_write_types[column_index];
+    if (type == INVALID_TYPE) {
+        return Status::OK();
+    }
+    const auto json_type = value.type();
+    if (json_type == simdjson::ondemand::json_type::string) {
+        if (type != TYPE_VARCHAR && type != TYPE_STRING) {
+            return Status::OK();
+        }
+    } else if (json_type == simdjson::ondemand::json_type::number) {
+        // only the number types that are read without loss, the others still go through the serde
+        const auto number_type = value.get_number_type();
+        if (type == TYPE_DOUBLE) {
+            if (number_type != simdjson::ondemand::number_type::floating_point_number &&
+                number_type != simdjson::ondemand::number_type::signed_integer) {
+                return Status::OK();
+            }
+        } else if (type == TYPE_VARCHAR || type == TYPE_STRING ||
+                   number_type != simdjson::ondemand::number_type::signed_integer) {
+            return Status::OK();
+        }
+    } else {
+        return Status::OK();
+    }
+
+    IColumn* data_column_ptr = column_ptr;
+    if (column_ptr->is_nullable()) {
+        data_column_ptr = &assert_cast<ColumnNullable*>(column_ptr)->get_nested_column();
+    }
+    switch (type) {
+    case TYPE_TINYINT:
+        RETURN_IF_ERROR(insert_json_integer<ColumnInt8>(value, data_column_ptr));
+        break;
+    case TYPE_SMALLINT:
+        RETURN_IF_ERROR(insert_json_integer<ColumnInt16>(value, data_column_ptr));
+        break;
+    case TYPE_INT:
+        RETURN_IF_ERROR(insert_json_integer<ColumnInt32>(value, data_column_ptr));
+        break;
+    case TYPE_BIGINT:
+        RETURN_IF_ERROR(insert_json_integer<ColumnInt64>(value, data_column_ptr));
+        break;
+    case TYPE_DOUBLE:
+        assert_cast<ColumnFloat64*>(data_column_ptr)->insert_value(double(value.get_double()));
+        break;
+    default: {
+        std::string_view value_string = value.get_string();
+        assert_cast<ColumnString*>(data_column_ptr)
+                ->insert_data(value_string.data(), value_string.size());
+    }
+    }
+    if (column_ptr->is_nullable()) {
+        assert_cast<ColumnNullable*>(column_ptr)->get_null_map_data().push_back(0);
+    }
+    *written = true;
+    return Status::OK();
+}
+
 Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value& value,
                                                      const DataTypePtr& type_desc,
                                                      vectorized::IColumn* column_ptr,
@@ -1427,11 +1523,15 @@ Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
                 return Status::OK();
             }
         } else {
-            RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_desc->type(),
-                                                           column_ptr, slot_desc->col_name(),
-                                                           _serdes[i], valid));
-            if (!(*valid)) {
-                return Status::OK();
+            bool written = false;
+            RETURN_IF_ERROR(_simdjson_write_direct(json_value, i, column_ptr, &written));
+            if (!written) {
+                RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_desc->type(),
+                                                               column_ptr, slot_desc->col_name(),
+                                                               _serdes[i], valid));
+                if (!(*valid)) {
+                    return Status::OK();
+                }
             }
             has_valid_value = true;
         }
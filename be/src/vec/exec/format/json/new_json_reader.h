@@ -148,6 +148,12 @@ private:
                                           const std::string& column_name, DataTypeSerDeSPtr serde,
                                           bool* valid);
 
+    // Appends a top-level string or number straight into the column of `column_index`,
+    // instead of formatting it and parsing it again through the serde.
+    // `written` is false if the value is left to _simdjson_write_data_to_column.
+    Status _simdjson_write_direct(simdjson::ondemand::value& value, size_t column_index,
+                                  vectorized::IColumn* column_ptr, bool* written);
+
     Status _simdjson_write_columns_by_jsonpath(simdjson::ondemand::object* value,
                                                const std::vector<SlotDescriptor*>& slot_descs,
                                                Block& block, bool* valid);
@@ -278,6 +284,9 @@ private:
 
     DataTypeSerDeSPtrs _serdes;
     vectorized::DataTypeSerDe::FormatOptions _serde_options;
+    // the type of each file slot which _simdjson_write_direct can append to,
+    // INVALID_TYPE for the others.
+    std::vector<PrimitiveType> _direct_write_types;
 };
 
 } // namespace vectorized
@@ -20,6 +20,7 @@
 #include "util/bit_util.h"
 #include "vec/columns/column_dictionary.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/common/unaligned.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/exec/format/parquet/decoder.h"
 
@@ -79,11 +80,24 @@ protected:
         while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
             switch (read_type) {
             case ColumnSelectVector::CONTENT: {
-                for (size_t i = 0; i < run_length; ++i) {
-                    memcpy(raw_data + data_index, _dict_items[_indexes[dict_index++]],
-                           _type_length);
-                    data_index += _type_length;
+                switch (_type_length) {
+                case 4:
+                    _gather_dict_values<uint32_t>(raw_data + data_index, dict_index, run_length);
+                    break;
+                case 8:
+                    _gather_dict_values<uint64_t>(raw_data + data_index, dict_index, run_length);
+                    break;
+                case 16:
+                    _gather_dict_values<__int128>(raw_data + data_index, dict_index, run_length);
+                    break;
+                default:
+                    for (size_t i = 0; i < run_length; ++i) {
+                        memcpy(raw_data + data_index + i * _type_length,
+                               _dict_items[_indexes[dict_index + i]], _type_length);
+                    }
                 }
+                dict_index += run_length;
+                data_index += run_length * _type_length;
                 break;
             }
             case ColumnSelectVector::NULL_DATA: {
@@ -103,6 +117,17 @@ protected:
         return Status::OK();
     }
 
+    // Gathers dictionary values of a common width with typed loads instead of a memcpy of
+    // '_type_length' bytes per value, so the loop can be compiled into vector gathers.
+    template <typename T>
+    void _gather_dict_values(char* dst, size_t dict_index, size_t run_length) {
+        const auto* dict = reinterpret_cast<const T*>(_dict.get());
+        const auto* indexes = _indexes.data() + dict_index;
+        for (size_t i = 0; i < run_length; ++i) {
+            unaligned_store<T>(dst + i * sizeof(T), dict[indexes[i]]);
+        }
+    }
+
     Status set_dict(std::unique_ptr<uint8_t[]>& dict, int32_t length, size_t num_values) override {
         if (num_values * _type_length != length) {
             return Status::Corruption("Wrong dictionary data for fixed length type");
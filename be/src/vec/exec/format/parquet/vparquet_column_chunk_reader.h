@@ -140,6 +140,8 @@ public:
         }
         return load_page_data();
     }
+    // Whether the data of current page has been decompressed and loaded.
+    bool page_data_loaded() const { return _state == DATA_LOADED; }
     // The remaining number of values in current page(including null values). Decreased when reading or skipping.
     uint32_t remaining_num_values() const { return _remaining_num_values; }
     // null values are generated from definition levels
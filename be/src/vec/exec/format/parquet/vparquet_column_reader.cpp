@@ -195,6 +195,11 @@ Status ScalarColumnReader::init(io::FileReaderSPtr file, FieldSchema* field, siz
     return Status::OK();
 }
 
+Status ScalarColumnReader::_skip_page() {
+    _deferred_skip_values = 0;
+    return _chunk_reader->skip_page();
+}
+
 Status ScalarColumnReader::_skip_values(size_t num_values) {
     if (num_values == 0) {
         return Status::OK();
@@ -615,13 +620,12 @@ Status ScalarColumnReader::read_column_data(
 
         // generate the row ranges that should be read
         std::list<RowRange> read_ranges;
-        _generate_read_ranges(_current_row_index,
-                              _current_row_index + _chunk_reader->remaining_num_values(),
+        _generate_read_ranges(_current_row_index, _current_row_index + _remaining_num_values(),
                               read_ranges);
         if (read_ranges.size() == 0) {
             // skip the whole page
-            _current_row_index += _chunk_reader->remaining_num_values();
-            RETURN_IF_ERROR(_chunk_reader->skip_page());
+            _current_row_index += _remaining_num_values();
+            RETURN_IF_ERROR(_skip_page());
             *read_rows = 0;
         } else {
             bool skip_whole_batch = false;
@@ -637,8 +641,8 @@ Status ScalarColumnReader::read_column_data(
                     filter_map.can_filter_all(remaining_num_values, _filter_map_index)) {
                     // We can skip the whole page if the remaining values is filtered by predicate columns
                     _filter_map_index += remaining_num_values;
-                    _current_row_index += _chunk_reader->remaining_num_values();
-                    RETURN_IF_ERROR(_chunk_reader->skip_page());
+                    _current_row_index += _remaining_num_values();
+                    RETURN_IF_ERROR(_skip_page());
                     *read_rows = remaining_num_values;
                     if (!_chunk_reader->has_next_page()) {
                         *eof = true;
@@ -651,8 +655,37 @@ Status ScalarColumnReader::read_column_data(
                     _filter_map_index += batch_size;
                 }
             }
+            if (skip_whole_batch && !_chunk_reader->page_data_loaded()) {
+                // Defer the skipping, so that the page is not decompressed if all the values of
+                // it are filtered by the following batches too.
+                size_t has_read = 0;
+                for (auto& range : read_ranges) {
+                    size_t skip_values = range.first_row - _current_row_index;
+                    size_t read_values = std::min((size_t)(range.last_row - range.first_row),
+                                                  batch_size - has_read);
+                    _deferred_skip_values += skip_values + read_values;
+                    _current_row_index += skip_values + read_values;
+                    has_read += read_values;
+                    if (has_read == batch_size) {
+                        break;
+                    }
+                }
+                *read_rows = has_read;
+                if (_remaining_num_values() == 0) {
+                    RETURN_IF_ERROR(_skip_page());
+                    if (!_chunk_reader->has_next_page()) {
+                        *eof = true;
+                    }
+                }
+                break;
+            }
             // load page data to decode or skip values
             RETURN_IF_ERROR(_chunk_reader->load_page_data_idempotent());
+            if (_deferred_skip_values > 0) {
+                size_t deferred_skip_values = _deferred_skip_values;
+                _deferred_skip_values = 0;
+                RETURN_IF_ERROR(_skip_values(deferred_skip_values));
+            }
             size_t has_read = 0;
             for (auto& range : read_ranges) {
                 // generate the skipped values
@@ -205,7 +205,15 @@ private:
     std::unique_ptr<parquet::PhysicalToLogicalConverter> _converter = nullptr;
     std::unique_ptr<std::vector<uint8_t>> _nested_filter_map_data = nullptr;
     size_t _orig_filter_map_index = 0;
+    // Values at the head of current page which are filtered by predicate columns, but not
+    // skipped yet because the page data is not loaded. If the whole page is filtered, the page is
+    // skipped without being decompressed.
+    size_t _deferred_skip_values = 0;
 
+    size_t _remaining_num_values() const {
+        return _chunk_reader->remaining_num_values() - _deferred_skip_values;
+    }
+    Status _skip_page();
     Status _skip_values(size_t num_values);
     Status _read_values(size_t num_values, ColumnPtr& doris_column, DataTypePtr& type,
                         FilterMap& filter_map, bool is_dict_filter);
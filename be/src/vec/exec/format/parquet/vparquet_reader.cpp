@@ -42,6 +42,7 @@
 #include "util/string_util.h"
 #include "util/timezone_utils.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_string.h"
 #include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -82,6 +83,9 @@ class Block;
 namespace doris::vectorized {
 
 #include "common/compile_check_begin.h"
+// The dictionary is checked value by value, so large dictionaries are not used to filter groups.
+static constexpr size_t MAX_DICT_SIZE_TO_FILTER_ROW_GROUP = 1024;
+
 ParquetReader::ParquetReader(RuntimeProfile* profile, const TFileScanRangeParams& params,
                              const TFileRangeDesc& range, size_t batch_size, cctz::time_zone* ctz,
                              io::IOContext* io_ctx, RuntimeState* state, FileMetaCache* meta_cache,
@@ -139,6 +143,8 @@ void ParquetReader::_init_profile() {
 
         _parquet_profile.filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.dict_filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByDict", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.to_read_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "ReadGroups", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_group_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -171,6 +177,8 @@ void ParquetReader::_init_profile() {
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PageIndexReadTime", parquet_profile, 1);
         _parquet_profile.parse_page_index_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PageIndexParseTime", parquet_profile, 1);
+        _parquet_profile.page_index_hit_cache =
+                ADD_COUNTER_WITH_LEVEL(_profile, "PageIndexHitCache", TUnit::UNIT, 1);
         _parquet_profile.row_group_filter_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "RowGroupFilterTime", parquet_profile, 1);
         _parquet_profile.file_footer_read_calls =
@@ -209,6 +217,7 @@ Status ParquetReader::close() {
 
 void ParquetReader::_close_internal() {
     if (!_closed) {
+        _next_group_prefetch_reader.reset();
         _closed = true;
     }
 }
@@ -857,6 +866,10 @@ Status ParquetReader::_next_row_group_reader() {
     if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
         // InMemoryFileReader has the ability to merge small IO
         group_file_reader = _file_reader;
+    } else if (_next_group_prefetch_reader != nullptr &&
+               _next_group_prefetch_id == row_group_index.row_group_id) {
+        // The column chunks were merged and prefetched while the last row group was read.
+        group_file_reader = std::move(_next_group_prefetch_reader);
     } else {
         size_t avg_io_size = 0;
         const std::vector<io::PrefetchRange> io_ranges =
@@ -868,6 +881,8 @@ Status ParquetReader::_next_row_group_reader() {
                                               _profile, _file_reader, io_ranges)
                                     : _file_reader;
     }
+    _next_group_prefetch_reader.reset();
+    _prefetch_next_row_group();
     _current_group_reader.reset(
             new RowGroupReader(_io_ctx ? std::make_shared<io::TracingFileReader>(
                                                  group_file_reader, _io_ctx->file_reader_stats)
@@ -886,6 +901,28 @@ Status ParquetReader::_next_row_group_reader() {
                                        _slot_id_to_filter_conjuncts);
 }
 
+void ParquetReader::_prefetch_next_row_group() {
+    if (config::parquet_row_group_prefetch_max_bytes <= 0 || _read_row_groups.empty() ||
+        _read_line_mode_mode || !io::DelegateReader::is_thread_safe(_file_reader.get())) {
+        return;
+    }
+    const RowGroupReader::RowGroupIndex& next_group = _read_row_groups.front();
+    size_t avg_io_size = 0;
+    const std::vector<io::PrefetchRange> io_ranges =
+            _generate_random_access_ranges(next_group, &avg_io_size);
+    auto prefetch_reader = std::make_shared<io::RangesPrefetchReader>(
+            _profile, _file_reader, io_ranges, config::merged_oss_min_io_size,
+            config::parquet_row_group_prefetch_max_bytes);
+    Status st = prefetch_reader->prefetch(_io_ctx);
+    if (!st.ok()) {
+        VLOG_DEBUG << "failed to prefetch row group " << next_group.row_group_id << " of "
+                   << _scan_range.path << ": " << st;
+        return;
+    }
+    _next_group_prefetch_reader = std::move(prefetch_reader);
+    _next_group_prefetch_id = next_group.row_group_id;
+}
+
 Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
     SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
     if (is_filter_groups && (_total_groups == 0 || _t_metadata->num_rows == 0 || _range_size < 0)) {
@@ -1003,6 +1040,25 @@ bool ParquetReader::_is_misaligned_range_group(const tparquet::RowGroup& row_gro
     return false;
 }
 
+Status ParquetReader::_read_page_index(const PageIndex& page_index,
+                                       ParquetPageIndexBuffer* buffer) {
+    SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
+    size_t bytes_read = 0;
+    buffer->column_index.resize(page_index._column_index_size);
+    Slice col_index_slice(buffer->column_index.data(), page_index._column_index_size);
+    RETURN_IF_ERROR(_tracing_file_reader->read_at(page_index._column_index_start, col_index_slice,
+                                                  &bytes_read, _io_ctx));
+    _column_statistics.read_bytes += bytes_read;
+    buffer->offset_index.resize(page_index._offset_index_size);
+    Slice off_index_slice(buffer->offset_index.data(), page_index._offset_index_size);
+    RETURN_IF_ERROR(_tracing_file_reader->read_at(page_index._offset_index_start, off_index_slice,
+                                                  &bytes_read, _io_ctx));
+    _column_statistics.read_bytes += bytes_read;
+    // read twice: parse column index & parse offset index
+    _column_statistics.page_index_read_calls += 2;
+    return Status::OK();
+}
+
 bool ParquetReader::_has_page_index(const std::vector<tparquet::ColumnChunk>& columns,
                                     PageIndex& page_index) {
     return page_index.check_and_get_page_index_ranges(columns);
@@ -1040,26 +1096,33 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         read_whole_row_group();
         return Status::OK();
     }
-    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
-    size_t bytes_read = 0;
-    Slice result(col_index_buff.data(), page_index._column_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_tracing_file_reader->read_at(page_index._column_index_start, result,
-                                                      &bytes_read, _io_ctx));
+    ObjLRUCache::CacheHandle page_index_handle;
+    std::unique_ptr<ParquetPageIndexBuffer> page_index_buff_ptr;
+    const ParquetPageIndexBuffer* page_index_buff = nullptr;
+    std::string page_index_key;
+    if (_meta_cache != nullptr && _meta_cache->page_index_enabled()) {
+        page_index_key = FileMetaCache::get_page_index_key(
+                FileMetaCache::get_key(_tracing_file_reader, _file_description),
+                row_group_index.row_group_id);
+        if (_meta_cache->lookup_page_index(page_index_key, &page_index_handle)) {
+            page_index_buff = page_index_handle.data<ParquetPageIndexBuffer>();
+            _statistics.page_index_hit_cache++;
+        }
     }
-    _column_statistics.read_bytes += bytes_read;
-    std::vector<RowRange> skipped_row_ranges;
-    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
-    Slice res(off_index_buff.data(), page_index._offset_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_tracing_file_reader->read_at(page_index._offset_index_start, res,
-                                                      &bytes_read, _io_ctx));
+    if (page_index_buff == nullptr) {
+        page_index_buff_ptr = std::make_unique<ParquetPageIndexBuffer>();
+        RETURN_IF_ERROR(_read_page_index(page_index, page_index_buff_ptr.get()));
+        if (!page_index_key.empty()) {
+            _meta_cache->insert_page_index(page_index_key, page_index_buff_ptr.release(),
+                                           &page_index_handle);
+            page_index_buff = page_index_handle.data<ParquetPageIndexBuffer>();
+        } else {
+            page_index_buff = page_index_buff_ptr.get();
+        }
     }
-    _column_statistics.read_bytes += bytes_read;
-    // read twice: parse column index & parse offset index
-    _column_statistics.page_index_read_calls += 2;
+    const uint8_t* col_index_buff = page_index_buff->column_index.data();
+    const uint8_t* off_index_buff = page_index_buff->offset_index.data();
+    std::vector<RowRange> skipped_row_ranges;
     SCOPED_RAW_TIMER(&_statistics.parse_page_index_time);
 
     for (size_t idx = 0; idx < _read_table_columns.size(); idx++) {
@@ -1084,7 +1147,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff.data(), &column_index));
+        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff, &column_index));
         const int64_t num_of_pages = column_index.null_pages.size();
         if (num_of_pages <= 0) {
             continue;
@@ -1120,7 +1183,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::OffsetIndex offset_index;
-        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff.data(), &offset_index));
+        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff, &offset_index));
         for (int page_id : skipped_page_range) {
             RowRange skipped_row_range;
             RETURN_IF_ERROR(page_index.create_skipped_row_range(offset_index, row_group.num_rows,
@@ -1191,7 +1254,7 @@ Status ParquetReader::_process_row_group_filter(
     } else {
         RETURN_IF_ERROR(_process_column_stat_filter(row_group, filter_group));
         _init_chunk_dicts();
-        RETURN_IF_ERROR(_process_dict_filter(filter_group));
+        RETURN_IF_ERROR(_process_dict_filter(row_group, filter_group));
         _init_bloom_filter();
         RETURN_IF_ERROR(_process_bloom_filter(filter_group));
     }
@@ -1226,7 +1289,89 @@ Status ParquetReader::_process_column_stat_filter(const tparquet::RowGroup& row_
 
 void ParquetReader::_init_chunk_dicts() {}
 
-Status ParquetReader::_process_dict_filter(bool* filter_group) {
+Status ParquetReader::_process_dict_filter(const tparquet::RowGroup& row_group,
+                                           bool* filter_group) {
+    if (!config::enable_parquet_dict_row_group_filter || !_enable_filter_by_min_max ||
+        *filter_group) {
+        return Status::OK();
+    }
+    // parquet column id -> dictionary values, read once for all the predicates of the column
+    std::unordered_map<int, MutableColumnPtr> column_dict_values;
+    for (const auto& expr : _push_down_exprs) {
+        bool is_eq = expr->node_type() == TExprNodeType::BINARY_PRED &&
+                     expr->op() == TExprOpcode::EQ;
+        bool is_in = expr->node_type() == TExprNodeType::IN_PRED &&
+                     expr->op() == TExprOpcode::FILTER_IN;
+        if ((!is_eq && !is_in) || !expr->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        const auto* slot_ref = static_cast<const VSlotRef*>(expr->children()[0].get());
+        auto* slot = _tuple_descriptor->slots()[slot_ref->column_id()];
+        if (!_table_info_node_ptr->children_column_exists(slot->col_name())) {
+            continue;
+        }
+        const FieldSchema* col_schema = _file_metadata->schema().get_column(
+                _table_info_node_ptr->children_file_column_name(slot->col_name()));
+        int parquet_col_id = col_schema->physical_column_index;
+        if (parquet_col_id < 0) {
+            continue;
+        }
+        const auto& chunk_meta = row_group.columns[parquet_col_id].meta_data;
+        // all the data pages should be dictionary encoded, so the dictionary holds all the values
+        if (!has_dict_page(chunk_meta) || !RowGroupReader::is_dictionary_encoded(chunk_meta)) {
+            continue;
+        }
+        auto dict_iter = column_dict_values.find(parquet_col_id);
+        if (dict_iter == column_dict_values.end()) {
+            MutableColumnPtr dict_values = ColumnString::create();
+            RETURN_IF_ERROR(_read_dict_values(row_group, col_schema, dict_values));
+            dict_iter = column_dict_values.emplace(parquet_col_id, std::move(dict_values)).first;
+        }
+        const auto& dict_values = assert_cast<const ColumnString&>(*dict_iter->second);
+        if (dict_values.empty() || dict_values.size() > MAX_DICT_SIZE_TO_FILTER_ROW_GROUP) {
+            continue;
+        }
+        // The plain encoded dictionary values are in the same format as the encoded statistics,
+        // so each value is checked as a column whose min and max are the value.
+        ParquetPredicate::ColumnStat value_stat {.has_null = false, .is_all_null = false};
+        std::function<bool(const FieldSchema*, ParquetPredicate::ColumnStat*)> get_stat_func =
+                [&](const FieldSchema*, ParquetPredicate::ColumnStat* stat) {
+                    *stat = value_stat;
+                    return true;
+                };
+        bool all_filtered = true;
+        for (size_t i = 0; i < dict_values.size() && all_filtered; ++i) {
+            StringRef value = dict_values.get_data_at(i);
+            value_stat.encoded_min_value.assign(value.data, value.size);
+            value_stat.encoded_max_value = value_stat.encoded_min_value;
+            all_filtered = _expr_push_down(expr, get_stat_func);
+        }
+        if (all_filtered) {
+            *filter_group = true;
+            _statistics.dict_filtered_row_groups++;
+            return Status::OK();
+        }
+    }
+    return Status::OK();
+}
+
+Status ParquetReader::_read_dict_values(const tparquet::RowGroup& row_group,
+                                        const FieldSchema* col_schema,
+                                        MutableColumnPtr& dict_values) {
+    const auto& chunk_meta = row_group.columns[col_schema->physical_column_index].meta_data;
+    // only the dictionary page is read
+    size_t max_buf_size = chunk_meta.data_page_offset > chunk_meta.dictionary_page_offset
+                                  ? chunk_meta.data_page_offset - chunk_meta.dictionary_page_offset
+                                  : 0;
+    std::unique_ptr<ParquetColumnReader> reader;
+    RETURN_IF_ERROR(ParquetColumnReader::create(_tracing_file_reader,
+                                                const_cast<FieldSchema*>(col_schema), row_group,
+                                                {}, _ctz, _io_ctx, reader, max_buf_size));
+    bool has_dict = false;
+    RETURN_IF_ERROR(reader->read_dict_values_to_column(dict_values, &has_dict));
+    if (!has_dict) {
+        dict_values->clear();
+    }
     return Status::OK();
 }
 
@@ -1249,6 +1394,8 @@ void ParquetReader::_collect_profile() {
         _current_group_reader->collect_profile_before_close();
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.dict_filtered_row_groups,
+                   _statistics.dict_filtered_row_groups);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
@@ -1264,6 +1411,7 @@ void ParquetReader::_collect_profile() {
     COUNTER_UPDATE(_parquet_profile.page_index_filter_time, _statistics.page_index_filter_time);
     COUNTER_UPDATE(_parquet_profile.read_page_index_time, _statistics.read_page_index_time);
     COUNTER_UPDATE(_parquet_profile.parse_page_index_time, _statistics.parse_page_index_time);
+    COUNTER_UPDATE(_parquet_profile.page_index_hit_cache, _statistics.page_index_hit_cache);
     COUNTER_UPDATE(_parquet_profile.row_group_filter_time, _statistics.row_group_filter_time);
     COUNTER_UPDATE(_parquet_profile.file_footer_read_calls, _statistics.file_footer_read_calls);
     COUNTER_UPDATE(_parquet_profile.file_footer_hit_cache, _statistics.file_footer_hit_cache);
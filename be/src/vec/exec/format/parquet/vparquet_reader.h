@@ -76,6 +76,7 @@ class ParquetReader : public GenericReader {
 public:
     struct Statistics {
         int32_t filtered_row_groups = 0;
+        int32_t dict_filtered_row_groups = 0;
         int32_t read_row_groups = 0;
         int64_t filtered_group_rows = 0;
         int64_t filtered_page_rows = 0;
@@ -94,6 +95,7 @@ public:
         int64_t page_index_filter_time = 0;
         int64_t read_page_index_time = 0;
         int64_t parse_page_index_time = 0;
+        int64_t page_index_hit_cache = 0;
         int64_t predicate_filter_time = 0;
         int64_t dict_filter_rewrite_time = 0;
     };
@@ -166,6 +168,7 @@ protected:
 private:
     struct ParquetProfile {
         RuntimeProfile::Counter* filtered_row_groups = nullptr;
+        RuntimeProfile::Counter* dict_filtered_row_groups = nullptr;
         RuntimeProfile::Counter* to_read_row_groups = nullptr;
         RuntimeProfile::Counter* filtered_group_rows = nullptr;
         RuntimeProfile::Counter* filtered_page_rows = nullptr;
@@ -183,6 +186,7 @@ private:
         RuntimeProfile::Counter* page_index_filter_time = nullptr;
         RuntimeProfile::Counter* read_page_index_time = nullptr;
         RuntimeProfile::Counter* parse_page_index_time = nullptr;
+        RuntimeProfile::Counter* page_index_hit_cache = nullptr;
         RuntimeProfile::Counter* file_footer_read_calls = nullptr;
         RuntimeProfile::Counter* file_footer_hit_cache = nullptr;
         RuntimeProfile::Counter* decompress_time = nullptr;
@@ -210,6 +214,8 @@ private:
     void _init_file_description();
     // Page Index Filter
     bool _has_page_index(const std::vector<tparquet::ColumnChunk>& columns, PageIndex& page_index);
+    Status _read_page_index(const PageIndex& page_index, ParquetPageIndexBuffer* buffer);
+    void _prefetch_next_row_group();
     Status _process_page_index(const tparquet::RowGroup& row_group,
                                const RowGroupReader::RowGroupIndex& row_group_index,
                                std::vector<RowRange>& candidate_row_ranges);
@@ -220,7 +226,9 @@ private:
     Status _process_row_group_filter(const RowGroupReader::RowGroupIndex& row_group_index,
                                      const tparquet::RowGroup& row_group, bool* filter_group);
     void _init_chunk_dicts();
-    Status _process_dict_filter(bool* filter_group);
+    Status _process_dict_filter(const tparquet::RowGroup& row_group, bool* filter_group);
+    Status _read_dict_values(const tparquet::RowGroup& row_group, const FieldSchema* col_schema,
+                             MutableColumnPtr& dict_values);
     void _init_bloom_filter();
     Status _process_bloom_filter(bool* filter_group);
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
@@ -290,6 +298,9 @@ private:
     RowGroupReader::LazyReadContext _lazy_read_ctx;
 
     std::list<RowGroupReader::RowGroupIndex> _read_row_groups;
+    // The column chunks of the next row group prefetched while the current one is read.
+    std::shared_ptr<io::RangesPrefetchReader> _next_group_prefetch_reader;
+    int32_t _next_group_prefetch_id = -1;
     // parquet file reader object
     size_t _batch_size;
     int64_t _range_start_offset;
@@ -29,6 +29,8 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ * The hash set is not changed after init(), so that the scanners sharing the same
+ * delete files can call filter_data_block() concurrently.
  */
 class EqualityDeleteBase {
 protected:
@@ -66,7 +68,6 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
@@ -83,19 +84,16 @@ class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
     // hash column for delete block
     std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
     // hash code => row index
     // if hash values are equal, then compare the real values
     // the row index records the row number of the delete row in delete block
     std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    // data_column_index: the delete column indexes in data block
+    bool _equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index);
 
 public:
     MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
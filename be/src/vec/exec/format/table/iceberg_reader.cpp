@@ -142,8 +142,66 @@ Status IcebergTableReader::init_row_filters() {
     return Status::OK();
 }
 
+std::string IcebergTableReader::_equality_delete_cache_key(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::vector<std::string> paths;
+    paths.reserve(delete_files.size());
+    for (const auto& delete_file : delete_files) {
+        paths.emplace_back(delete_file.path);
+    }
+    // the delete files of iceberg are immutable, so the paths identify the deleted rows
+    std::sort(paths.begin(), paths.end());
+    std::string key = "equality_delete";
+    for (const auto& path : paths) {
+        key.append("_").append(path);
+    }
+    return key;
+}
+
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    Status create_status = Status::OK();
+    auto* equality_delete = _kv_cache->get<EqualityDelete>(
+            _equality_delete_cache_key(delete_files), [&]() -> EqualityDelete* {
+                auto delete_data = std::make_unique<EqualityDelete>();
+                create_status =
+                        _read_equality_delete_files(delete_files, &delete_data->delete_block);
+                if (!create_status) {
+                    return nullptr;
+                }
+                delete_data->delete_impl =
+                        EqualityDeleteBase::get_delete_impl(&delete_data->delete_block);
+                create_status = delete_data->delete_impl->init(_profile);
+                if (!create_status) {
+                    return nullptr;
+                }
+                return delete_data.release();
+            });
+    RETURN_IF_ERROR(create_status);
+    if (equality_delete == nullptr) {
+        return Status::InternalError("Failed to build the equality delete");
+    }
+
+    const Block& delete_block = equality_delete->delete_block;
+    for (size_t i = 0; i < delete_block.columns(); ++i) {
+        const auto& delete_col = delete_block.get_by_position(i);
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(),
+                      delete_col.name) == _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col.name);
+            DataTypePtr data_type = make_nullable(delete_col.type);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col.name);
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    _equality_delete_impl = equality_delete->delete_impl.get();
+    return Status::OK();
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, Block* delete_block) {
     bool init_schema = false;
     std::vector<std::string> equality_delete_col_names;
     std::vector<DataTypePtr> equality_delete_col_types;
@@ -164,7 +222,7 @@ Status IcebergTableReader::_equality_delete_base(
             RETURN_IF_ERROR(delete_reader->init_schema_reader());
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
+            _generate_equality_delete_block(delete_block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
         }
@@ -189,26 +247,12 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    return Status::OK();
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -111,10 +111,21 @@ protected:
     PositionDeleteRange _get_range(const ColumnString& file_path_column);
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
+    static std::string _equality_delete_cache_key(
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
+
+    // The equality deletes built from a set of delete files, which is cached in the kv cache,
+    // so that the data files sharing the same delete files only read and build them once.
+    struct EqualityDelete {
+        Block delete_block;
+        std::unique_ptr<EqualityDeleteBase> delete_impl;
+    };
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       Block* delete_block);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -149,9 +160,8 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // equality delete, owned by the kv cache
+    EqualityDeleteBase* _equality_delete_impl = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
@@ -50,15 +50,19 @@
 #include "pipeline/exec/olap_scan_operator.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
+#include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/scan_node.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/json/path_in_data.h"
 #include "vec/olap/block_reader.h"
 
@@ -235,9 +239,17 @@ Status OlapScanner::prepare() {
         }
 
         // Initialize tablet_reader_params
-        RETURN_IF_ERROR(_init_tablet_reader_params(_key_ranges, local_state->_olap_filters,
-                                                   local_state->_filter_predicates,
-                                                   local_state->_push_down_functions));
+        if (config::enable_late_arrival_runtime_filter_pushdown) {
+            pipeline::FilterPredicates filter_predicates = local_state->_filter_predicates;
+            RETURN_IF_ERROR(_append_late_arrival_filter_predicates(&filter_predicates));
+            RETURN_IF_ERROR(_init_tablet_reader_params(_key_ranges, local_state->_olap_filters,
+                                                       filter_predicates,
+                                                       local_state->_push_down_functions));
+        } else {
+            RETURN_IF_ERROR(_init_tablet_reader_params(_key_ranges, local_state->_olap_filters,
+                                                       local_state->_filter_predicates,
+                                                       local_state->_push_down_functions));
+        }
     }
 
     // add read columns in profile
@@ -283,6 +295,51 @@ Status OlapScanner::open(RuntimeState* state) {
 }
 
 // it will be called under tablet read lock because capture rs readers need
+// Runtime filters that arrive after the scan node processed its conjuncts are only evaluated
+// as conjuncts. A scanner that has not built its reader yet can still hand the bloom and IN
+// filters to the storage layer, so they prune segments and pages by zone map, bloom filter
+// index and inverted index like the filters that arrived in time. The conjuncts are kept, so
+// a filter that can't be pushed down is still applied.
+Status OlapScanner::_append_late_arrival_filter_predicates(
+        pipeline::FilterPredicates* filter_predicates) {
+    auto* local_state = static_cast<pipeline::OlapScanLocalState*>(_local_state);
+    RETURN_IF_ERROR(try_append_late_arrival_runtime_filter());
+    for (size_t i = local_state->_normalized_conjunct_num; i < _conjuncts.size(); ++i) {
+        const auto& root = _conjuncts[i]->root();
+        if (!root->is_rf_wrapper()) {
+            continue;
+        }
+        auto* rf_expr = assert_cast<VRuntimeFilterWrapper*>(root.get());
+        auto impl = rf_expr->get_impl();
+        if (impl->get_num_children() != 1 || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        auto* slot_ref = assert_cast<VSlotRef*>(impl->children()[0].get());
+        auto entry = local_state->_slot_id_to_value_range.find(slot_ref->slot_id());
+        if (entry == local_state->_slot_id_to_value_range.end()) {
+            continue;
+        }
+        SlotDescriptor* slot = entry->second.first;
+        if (slot->get_virtual_column_expr() != nullptr ||
+            is_complex_type(slot->type()->get_primitive_type()) ||
+            slot_ref->data_type()->get_primitive_type() != slot->type()->get_primitive_type()) {
+            continue;
+        }
+        if (impl->node_type() == TExprNodeType::BLOOM_PRED) {
+            filter_predicates->bloom_filters.emplace_back(
+                    slot->col_name(), impl->get_bloom_filter_func(), rf_expr->filter_id(),
+                    rf_expr->predicate_filtered_rows_counter(),
+                    rf_expr->predicate_input_rows_counter());
+        } else if (impl->node_type() == TExprNodeType::IN_PRED && impl->get_set_func()) {
+            filter_predicates->in_filters.emplace_back(
+                    slot->col_name(), impl->get_set_func(), rf_expr->filter_id(),
+                    rf_expr->predicate_filtered_rows_counter(),
+                    rf_expr->predicate_input_rows_counter());
+        }
+    }
+    return Status::OK();
+}
+
 Status OlapScanner::_init_tablet_reader_params(
         const std::vector<OlapScanRange*>& key_ranges,
         const std::vector<FilterOlapParam<TCondition>>& filters,
@@ -678,6 +735,8 @@ void OlapScanner::_collect_profile_before_close() {
                    stats.generate_row_ranges_by_zonemap_ns);
     COUNTER_UPDATE(local_state->_segment_generate_row_range_by_dict_timer,
                    stats.generate_row_ranges_by_dict_ns);
+    COUNTER_UPDATE(local_state->_segment_generate_row_range_by_encoded_pages_timer,
+                   stats.generate_row_ranges_by_encoded_pages_ns);
     COUNTER_UPDATE(local_state->_predicate_column_read_timer, stats.predicate_column_read_ns);
     COUNTER_UPDATE(local_state->_non_predicate_column_read_timer, stats.non_predicate_read_ns);
     COUNTER_UPDATE(local_state->_predicate_column_read_seek_timer,
@@ -696,9 +755,11 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_rows_short_circuit_cond_input_counter,
                    stats.short_circuit_cond_input_rows);
     COUNTER_UPDATE(local_state->_rows_expr_cond_input_counter, stats.expr_cond_input_rows);
+    COUNTER_UPDATE(local_state->_predicate_reorder_counter, stats.predicate_reorder_num);
     COUNTER_UPDATE(local_state->_stats_filtered_counter, stats.rows_stats_filtered);
     COUNTER_UPDATE(local_state->_stats_rp_filtered_counter, stats.rows_stats_rp_filtered);
     COUNTER_UPDATE(local_state->_dict_filtered_counter, stats.segment_dict_filtered);
+    COUNTER_UPDATE(local_state->_encoded_page_filtered_counter, stats.rows_encoded_page_filtered);
     COUNTER_UPDATE(local_state->_bf_filtered_counter, stats.rows_bf_filtered);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_del_filtered);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_del_by_bitmap);
@@ -707,6 +768,8 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_key_range_filtered_counter, stats.rows_key_range_filtered);
     COUNTER_UPDATE(local_state->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(local_state->_cached_pages_num_counter, stats.cached_pages_num);
+    COUNTER_UPDATE(local_state->_cached_compressed_pages_num_counter,
+                   stats.cached_compressed_pages_num);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_counter, stats.rows_bitmap_index_filtered);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_timer, stats.bitmap_index_filter_timer);
     COUNTER_UPDATE(local_state->_inverted_index_filter_counter, stats.rows_inverted_index_filtered);
@@ -93,6 +93,8 @@ private:
                                       const pipeline::FilterPredicates& filter_predicates,
                                       const std::vector<FunctionFilter>& function_filters);
 
+    Status _append_late_arrival_filter_predicates(pipeline::FilterPredicates* filter_predicates);
+
     [[nodiscard]] Status _init_return_columns();
     [[nodiscard]] Status _init_variant_columns();
 
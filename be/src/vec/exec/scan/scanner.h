@@ -26,6 +26,7 @@
 #include "olap/tablet.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/hot_path_metrics.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
 
@@ -132,7 +133,13 @@ public:
         _cpu_watch.start();
     }
 
-    void update_wait_worker_timer() { _scanner_wait_worker_timer += _watch.elapsed_time(); }
+    void update_wait_worker_timer() {
+        const auto wait_ns = static_cast<int64_t>(_watch.elapsed_time());
+        _scanner_wait_worker_timer += wait_ns;
+        if (hot_path_metrics::enabled()) {
+            hot_path_metrics::record_latency(HotPath::SCAN_TASK_QUEUE_WAIT, wait_ns);
+        }
+    }
 
     int64_t get_scanner_wait_worker_timer() const { return _scanner_wait_worker_timer; }
 
@@ -201,6 +201,10 @@ Status ScannerContext::init() {
     // Avoid corner case.
     _min_scan_concurrency = std::min(_min_scan_concurrency, _max_scan_concurrency);
 
+    _target_scan_concurrency = config::enable_adaptive_scan_concurrency
+                                       ? std::max(_min_scan_concurrency, _max_scan_concurrency / 2)
+                                       : _max_scan_concurrency;
+
     COUNTER_SET(_local_state->_max_scan_concurrency, (int64_t)_max_scan_concurrency);
     COUNTER_SET(_local_state->_min_scan_concurrency, (int64_t)_min_scan_concurrency);
 
@@ -292,6 +296,11 @@ void ScannerContext::push_back_scan_task(std::shared_ptr<ScanTask> scan_task) {
     }
     _tasks_queue.push_back(scan_task);
     _num_scheduled_scanners--;
+    if (config::enable_adaptive_scan_concurrency &&
+        (cast_set<int32_t>(_tasks_queue.size()) >= _target_scan_concurrency ||
+         _block_memory_usage >= _max_bytes_in_queue)) {
+        _adjust_target_scan_concurrency(false);
+    }
 
     _dependency->set_ready();
 }
@@ -369,6 +378,9 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
     *eos = done();
 
     if (_tasks_queue.empty()) {
+        if (config::enable_adaptive_scan_concurrency && !*eos) {
+            _adjust_target_scan_concurrency(true);
+        }
         _dependency->block();
     }
 
@@ -631,6 +643,15 @@ std::shared_ptr<ScanTask> ScannerContext::_pull_next_scan_task(
         return nullptr;
     }
 
+    if (config::enable_adaptive_scan_concurrency &&
+        current_concurrency >= _target_scan_concurrency) {
+        VLOG_DEBUG << fmt::format(
+                "ScannerContext {} current concurrency {} >= _target_scan_concurrency {}, skip "
+                "pull",
+                ctx_id, current_concurrency, _target_scan_concurrency);
+        return nullptr;
+    }
+
     if (current_scan_task != nullptr) {
         if (!current_scan_task->cached_blocks.empty() || current_scan_task->is_eos()) {
             // This should not happen.
@@ -649,6 +670,15 @@ std::shared_ptr<ScanTask> ScannerContext::_pull_next_scan_task(
     }
 }
 
+void ScannerContext::_adjust_target_scan_concurrency(bool starving) {
+    if (starving) {
+        _target_scan_concurrency = std::min(_max_scan_concurrency,
+                                            std::max(1, _target_scan_concurrency * 2));
+    } else {
+        _target_scan_concurrency = std::max(_min_scan_concurrency, _target_scan_concurrency - 1);
+    }
+}
+
 bool ScannerContext::low_memory_mode() const {
     return _local_state->low_memory_mode();
 }
@@ -257,6 +257,11 @@ protected:
     int32_t _min_scan_concurrency_of_scan_scheduler = 0;
     int32_t _min_scan_concurrency = 1;
     int32_t _max_scan_concurrency = 0;
+    // Number of in-flight scan tasks this context aims for, equals _max_scan_concurrency unless
+    // enable_adaptive_scan_concurrency is set. Then it doubles whenever the operator drains the
+    // queue (the scan is the bottleneck) and shrinks by one whenever finished tasks pile up or
+    // the queued blocks reach _max_bytes_in_queue (the downstream is the bottleneck).
+    int32_t _target_scan_concurrency = 0;
 
     std::shared_ptr<ScanTask> _pull_next_scan_task(std::shared_ptr<ScanTask> current_scan_task,
                                                    int32_t current_concurrency);
@@ -264,6 +269,9 @@ protected:
     int32_t _get_margin(std::unique_lock<std::mutex>& transfer_lock,
                         std::unique_lock<std::shared_mutex>& scheduler_lock);
 
+    // Must be called with _transfer_lock held.
+    void _adjust_target_scan_concurrency(bool starving);
+
     // TODO: Add implementation of runtime_info_feed_back
     // adaptive scan concurrency related end
 };
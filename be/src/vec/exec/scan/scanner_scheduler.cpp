@@ -33,6 +33,7 @@
 #include "common/status.h"
 #include "file_scanner.h"
 #include "olap/tablet.h"
+#include "pipeline/pipeline_cpu_profiler.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
@@ -151,6 +152,9 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
         return;
     }
     SCOPED_ATTACH_TASK(ctx->state());
+    pipeline::ScopedCpuProfileFragment cpu_profile_fragment(
+            ctx->state()->query_id(), ctx->state()->fragment_id(),
+            pipeline::CpuProfileScope::SCANNER, ctx->local_state()->parent()->node_id());
 
     ctx->update_peak_running_scanner(1);
     Defer defer([&] { ctx->update_peak_running_scanner(-1); });
@@ -22,6 +22,7 @@
 
 #include <ostream>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/runtime_state.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -95,10 +96,17 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     }
     DCHECK(_open_finished || _getting_const_col);
     ColumnNumbers arguments(_children.size());
-    for (int i = 0; i < _children.size(); i++) {
-        int column_id = -1;
-        RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
-        arguments[i] = column_id;
+    // inverted index results are computed for the rows of the whole block, and constant
+    // expressions must keep constant arguments
+    if (config::enable_conditional_branch_on_selected_rows && !_has_case_expr &&
+        !is_constant() && context->get_inverted_index_context() == nullptr) {
+        RETURN_IF_ERROR(_execute_children_on_selected_rows(context, block, arguments));
+    } else {
+        for (int i = 0; i < _children.size(); i++) {
+            int column_id = -1;
+            RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
+            arguments[i] = column_id;
+        }
     }
     RETURN_IF_ERROR(check_constant(*block, arguments));
 
@@ -112,6 +120,47 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     return Status::OK();
 }
 
+Status VCaseExpr::_execute_children_on_selected_rows(VExprContext* context, Block* block,
+                                                     ColumnNumbers& arguments) {
+    const size_t num_whens = (_children.size() - _has_else_expr) / 2;
+    // a row takes the first WHEN that is true, so each WHEN and THEN only has to be evaluated
+    // on the rows no earlier WHEN took. The other rows get defaults, which the case function
+    // never reads for them.
+    IColumn::Filter remaining(block->rows(), 1);
+    IColumn::Filter true_rows;
+    IColumn::Filter taken;
+    bool selectable = true;
+    auto execute_child = [&](size_t child_index, const IColumn::Filter& selected) {
+        int column_id = -1;
+        const auto& child = _children[child_index];
+        if (selectable && !child->is_slot_ref() && !child->is_literal() &&
+            can_execute_on_selected_rows(*child)) {
+            RETURN_IF_ERROR(execute_on_selected_rows(context, block, child, selected, &column_id));
+        } else {
+            RETURN_IF_ERROR(child->execute(context, block, &column_id));
+        }
+        arguments[child_index] = column_id;
+        return Status::OK();
+    };
+    for (size_t i = 0; i < num_whens; ++i) {
+        RETURN_IF_ERROR(execute_child(2 * i, remaining));
+        selectable = selectable &&
+                     get_true_rows(block->get_by_position(arguments[2 * i]).column, true_rows);
+        if (selectable) {
+            taken.resize(remaining.size());
+            for (size_t row = 0; row < remaining.size(); ++row) {
+                taken[row] = remaining[row] && true_rows[row];
+                remaining[row] = remaining[row] && !true_rows[row];
+            }
+        }
+        RETURN_IF_ERROR(execute_child(2 * i + 1, taken));
+    }
+    if (_has_else_expr) {
+        RETURN_IF_ERROR(execute_child(_children.size() - 1, remaining));
+    }
+    return Status::OK();
+}
+
 const std::string& VCaseExpr::expr_name() const {
     return EXPR_NAME;
 }
@@ -52,6 +52,9 @@ public:
     std::string debug_string() const override;
 
 private:
+    Status _execute_children_on_selected_rows(VExprContext* context, Block* block,
+                                              ColumnNumbers& arguments);
+
     std::string get_function_name() const {
         std::string res = FUNCTION_NAME;
         if (_has_case_expr) {
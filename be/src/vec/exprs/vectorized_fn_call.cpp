@@ -213,10 +213,18 @@ Status VectorizedFnCall::_do_execute(doris::vectorized::VExprContext* context,
     DCHECK(_open_finished || _getting_const_col) << debug_string();
     // TODO: not execute const expr again, but use the const column in function context
     args.resize(_children.size());
-    for (int i = 0; i < _children.size(); ++i) {
-        int column_id = -1;
-        RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
-        args[i] = column_id;
+    // inverted index results are computed for the rows of the whole block, and constant
+    // expressions must keep constant arguments
+    if (config::enable_conditional_branch_on_selected_rows && _function_name == "if" &&
+        _children.size() == 3 && !is_constant() &&
+        context->get_inverted_index_context() == nullptr) {
+        RETURN_IF_ERROR(_execute_if_children_on_selected_rows(context, block, args));
+    } else {
+        for (int i = 0; i < _children.size(); ++i) {
+            int column_id = -1;
+            RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
+            args[i] = column_id;
+        }
     }
 
     RETURN_IF_ERROR(check_constant(*block, args));
@@ -241,6 +249,32 @@ Status VectorizedFnCall::_do_execute(doris::vectorized::VExprContext* context,
     return Status::OK();
 }
 
+Status VectorizedFnCall::_execute_if_children_on_selected_rows(VExprContext* context, Block* block,
+                                                               ColumnNumbers& args) {
+    int column_id = -1;
+    RETURN_IF_ERROR(_children[0]->execute(context, block, &column_id));
+    args[0] = column_id;
+    // the then branch is only read where the condition is true, the else branch elsewhere
+    IColumn::Filter then_rows;
+    bool selectable = get_true_rows(block->get_by_position(column_id).column, then_rows);
+    IColumn::Filter else_rows(then_rows.size());
+    for (size_t row = 0; row < then_rows.size(); ++row) {
+        else_rows[row] = !then_rows[row];
+    }
+    for (size_t i = 1; i < 3; ++i) {
+        const auto& child = _children[i];
+        if (selectable && !child->is_slot_ref() && !child->is_literal() &&
+            can_execute_on_selected_rows(*child)) {
+            RETURN_IF_ERROR(execute_on_selected_rows(context, block, child,
+                                                     i == 1 ? then_rows : else_rows, &column_id));
+        } else {
+            RETURN_IF_ERROR(child->execute(context, block, &column_id));
+        }
+        args[i] = column_id;
+    }
+    return Status::OK();
+}
+
 size_t VectorizedFnCall::estimate_memory(const size_t rows) {
     if (is_const_and_have_executed()) { // const have execute in open function
         return 0;
@@ -268,7 +302,21 @@ Status VectorizedFnCall::execute_runtime_filter(doris::vectorized::VExprContext*
 Status VectorizedFnCall::execute(VExprContext* context, vectorized::Block* block,
                                  int* result_column_id) {
     ColumnNumbers arguments;
-    return _do_execute(context, block, result_column_id, arguments);
+    auto num_columns_before = block->columns();
+    RETURN_IF_ERROR(_do_execute(context, block, result_column_id, arguments));
+    if (config::enable_expr_release_intermediate_columns) {
+        // the columns children inserted are only read by this call, swap them for a const
+        // placeholder now instead of keeping one full column per node alive until the whole
+        // tree is evaluated
+        for (auto column_id : arguments) {
+            if (column_id >= num_columns_before &&
+                static_cast<int>(column_id) != *result_column_id) {
+                auto& arg = block->get_by_position(column_id);
+                arg.column = arg.type->create_column_const_with_default_value(arg.column->size());
+            }
+        }
+    }
+    return Status::OK();
 }
 
 const std::string& VectorizedFnCall::expr_name() const {
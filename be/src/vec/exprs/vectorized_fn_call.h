@@ -96,6 +96,8 @@ protected:
     std::string _function_name;
 
 private:
+    Status _execute_if_children_on_selected_rows(VExprContext* context, Block* block,
+                                                 ColumnNumbers& args);
     Status _do_execute(doris::vectorized::VExprContext* context, doris::vectorized::Block* block,
                        int* result_column_id, ColumnNumbers& args);
 };
@@ -27,9 +27,11 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <stack>
 #include <utility>
 
+#include "common/cast_set.h"
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
@@ -37,6 +39,8 @@
 #include "olap/rowset/segment_v2/ann_index/ann_topn_runtime.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/define_primitive_type.h"
+#include "util/simd/bits.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/core/field.h"
 #include "vec/data_types/data_type_array.h"
@@ -786,6 +790,96 @@ void VExpr::close_function_context(VExprContext* context, FunctionContext::Funct
     }
 }
 
+bool VExpr::can_execute_on_selected_rows(const VExpr& expr) {
+    if (expr.is_slot_ref() || expr.is_literal()) {
+        return true;
+    }
+    switch (expr.node_type()) {
+    case TExprNodeType::FUNCTION_CALL:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::CASE_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::IN_PRED:
+        break;
+    default:
+        return false;
+    }
+    return std::all_of(expr.children().begin(), expr.children().end(),
+                       [](const VExprSPtr& child) { return can_execute_on_selected_rows(*child); });
+}
+
+Status VExpr::execute_on_selected_rows(VExprContext* context, Block* block, const VExprSPtr& expr,
+                                       const IColumn::Filter& selected, int* result_column_id) {
+    const size_t rows = block->rows();
+    const size_t count = rows - simd::count_zero_num((const int8_t*)selected.data(), rows);
+    std::set<int> column_ids;
+    expr->collect_slot_column_ids(column_ids);
+    // a block without slot columns has no rows, evaluate on the whole block instead
+    if (count == rows || (count > 0 && column_ids.empty())) {
+        return expr->execute(context, block, result_column_id);
+    }
+
+    ColumnPtr selected_result;
+    if (count == 0) {
+        selected_result = expr->data_type()->create_column();
+    } else {
+        // only the slots expr reads are filtered, the other positions are kept empty
+        Block selected_block;
+        for (size_t i = 0; i < block->columns(); ++i) {
+            const auto& column = block->get_by_position(i);
+            selected_block.insert({column_ids.contains(static_cast<int>(i)) && column.column
+                                           ? column.column->filter(selected, count)
+                                           : nullptr,
+                                   column.type, column.name});
+        }
+        int column_id = -1;
+        RETURN_IF_ERROR(expr->execute(context, &selected_block, &column_id));
+        selected_result =
+                selected_block.get_by_position(column_id).column->convert_to_full_column_if_const();
+    }
+
+    auto result = selected_result->clone_empty();
+    result->reserve(rows);
+    size_t selected_pos = 0;
+    for (size_t begin = 0; begin < rows;) {
+        size_t end = begin + 1;
+        while (end < rows && selected[end] == selected[begin]) {
+            ++end;
+        }
+        if (selected[begin]) {
+            result->insert_range_from(*selected_result, selected_pos, end - begin);
+            selected_pos += end - begin;
+        } else {
+            result->insert_many_defaults(end - begin);
+        }
+        begin = end;
+    }
+    *result_column_id = cast_set<int>(block->columns());
+    block->insert({std::move(result), expr->data_type(), expr->expr_name()});
+    return Status::OK();
+}
+
+bool VExpr::get_true_rows(const ColumnPtr& condition, IColumn::Filter& true_rows) {
+    auto column = condition->convert_to_full_column_if_const();
+    const NullMap* null_map = nullptr;
+    const IColumn* nested = column.get();
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(*column)) {
+        null_map = &nullable->get_null_map_data();
+        nested = nullable->get_nested_column_ptr().get();
+    }
+    const auto* bools = check_and_get_column<ColumnUInt8>(*nested);
+    if (bools == nullptr) {
+        return false;
+    }
+    const auto& data = bools->get_data();
+    true_rows.resize(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        true_rows[i] = data[i] != 0 && (null_map == nullptr || !(*null_map)[i]);
+    }
+    return true;
+}
+
 Status VExpr::check_constant(const Block& block, ColumnNumbers arguments) const {
     if (is_constant() && !VectorizedUtils::all_arguments_are_constant(block, arguments)) {
         return Status::InternalError("const check failed, expr={}", debug_string());
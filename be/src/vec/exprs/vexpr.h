@@ -325,6 +325,21 @@ protected:
 
     Status check_constant(const Block& block, ColumnNumbers arguments) const;
 
+    /// Whether expr only reads its slots and can be evaluated on a block holding part of the
+    /// rows, used to evaluate conditional branches only on the rows that take them.
+    static bool can_execute_on_selected_rows(const VExpr& expr);
+
+    /// Evaluate expr on the rows set in selected and scatter the result into a full size
+    /// column of block, the other rows hold default values.
+    static Status execute_on_selected_rows(VExprContext* context, Block* block,
+                                           const VExprSPtr& expr,
+                                           const IColumn::Filter& selected,
+                                           int* result_column_id);
+
+    /// Set true_rows to the rows where condition is true, null counts as false. Returns false
+    /// if condition is not a boolean column.
+    static bool get_true_rows(const ColumnPtr& condition, IColumn::Filter& true_rows);
+
     /// Helper function that calls ctx->register(), sets fn_context_index_, and returns the
     /// registered FunctionContext
     void register_function_context(RuntimeState* state, VExprContext* context);
@@ -28,7 +28,9 @@
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "udf/udf.h"
+#include "util/predicate_eval_stats.h"
 #include "util/simd/bits.h"
+#include "util/time.h"
 #include "vec/columns/column_const.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -185,12 +187,31 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                                        const std::vector<IColumn::Filter*>* filters,
                                        bool accept_null, Block* block,
-                                       IColumn::Filter* result_filter, bool* can_filter_all) {
+                                       IColumn::Filter* result_filter, bool* can_filter_all,
+                                       std::vector<PredicateEvalStats>* eval_stats) {
     size_t rows = block->rows();
     DCHECK_EQ(result_filter->size(), rows);
+    DCHECK(eval_stats == nullptr || eval_stats->size() == ctxs.size());
     *can_filter_all = false;
     auto* __restrict result_filter_data = result_filter->data();
-    for (const auto& ctx : ctxs) {
+    // the rows kept by the ctxs executed so far, only counted when the stats are required
+    int64_t remaining_rows =
+            eval_stats == nullptr
+                    ? 0
+                    : static_cast<int64_t>(
+                              rows - simd::count_zero_num((int8_t*)result_filter_data, rows));
+    for (size_t ctx_idx = 0; ctx_idx < ctxs.size(); ++ctx_idx) {
+        const auto& ctx = ctxs[ctx_idx];
+        const int64_t start_ns = eval_stats == nullptr ? 0 : MonotonicNanos();
+        auto update_eval_stats = [&]() {
+            if (eval_stats != nullptr) {
+                const auto output_rows = static_cast<int64_t>(
+                        rows - simd::count_zero_num((int8_t*)result_filter_data, rows));
+                (*eval_stats)[ctx_idx].update(remaining_rows, output_rows,
+                                              MonotonicNanos() - start_ns);
+                remaining_rows = output_rows;
+            }
+        };
         // Statistics are only required when an rf wrapper exists in the expr.
         bool is_rf_wrapper = ctx->root()->is_rf_wrapper();
         int result_column_id = -1;
@@ -227,6 +248,7 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                         rows - (is_rf_wrapper
                                         ? simd::count_zero_num((int8_t*)result_filter_data, rows)
                                         : 0);
+                update_eval_stats();
 
                 if (is_rf_wrapper) {
                     ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
@@ -243,8 +265,10 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
             if (!const_column->get_bool(0)) {
                 *can_filter_all = true;
                 memset(result_filter_data, 0, result_filter->size());
+                update_eval_stats();
                 return Status::OK();
             }
+            update_eval_stats();
         } else {
             const IColumn::Filter& filter =
                     assert_cast<const ColumnUInt8&>(*filter_column).get_data();
@@ -261,6 +285,7 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
             size_t output_rows =
                     rows -
                     (is_rf_wrapper ? simd::count_zero_num((int8_t*)result_filter_data, rows) : 0);
+            update_eval_stats();
 
             if (is_rf_wrapper) {
                 ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
@@ -377,14 +402,15 @@ Status VExprContext::execute_conjuncts_and_filter_block(const VExprContextSPtrs&
     return Status::OK();
 }
 
-Status VExprContext::execute_conjuncts_and_filter_block(const VExprContextSPtrs& ctxs, Block* block,
-                                                        std::vector<uint32_t>& columns_to_filter,
-                                                        int column_to_keep,
-                                                        IColumn::Filter& filter) {
+Status VExprContext::execute_conjuncts_and_filter_block(
+        const VExprContextSPtrs& ctxs, Block* block, std::vector<uint32_t>& columns_to_filter,
+        int column_to_keep, IColumn::Filter& filter,
+        std::vector<PredicateEvalStats>* eval_stats) {
     _reset_memory_usage(ctxs);
     filter.resize_fill(block->rows(), 1);
     bool can_filter_all;
-    RETURN_IF_ERROR(execute_conjuncts(ctxs, nullptr, false, block, &filter, &can_filter_all));
+    RETURN_IF_ERROR(execute_conjuncts(ctxs, nullptr, false, block, &filter, &can_filter_all,
+                                      eval_stats));
 
     // Accumulate the usage of `result_filter` into the first context.
     if (!ctxs.empty()) {
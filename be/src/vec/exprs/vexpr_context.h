@@ -38,6 +38,7 @@
 #include "vec/exprs/vexpr_fwd.h"
 
 namespace doris {
+struct PredicateEvalStats;
 class RowDescriptor;
 class RuntimeState;
 } // namespace doris
@@ -215,11 +216,12 @@ public:
     [[nodiscard]] static Status filter_block(const VExprContextSPtrs& expr_contexts, Block* block,
                                              size_t column_to_keep);
 
-    [[nodiscard]] static Status execute_conjuncts(const VExprContextSPtrs& ctxs,
-                                                  const std::vector<IColumn::Filter*>* filters,
-                                                  bool accept_null, Block* block,
-                                                  IColumn::Filter* result_filter,
-                                                  bool* can_filter_all);
+    // If `eval_stats` is not null, it has one entry per ctx and accumulates the rows passed
+    // to and kept by every ctx, and the time to execute it.
+    [[nodiscard]] static Status execute_conjuncts(
+            const VExprContextSPtrs& ctxs, const std::vector<IColumn::Filter*>* filters,
+            bool accept_null, Block* block, IColumn::Filter* result_filter, bool* can_filter_all,
+            std::vector<PredicateEvalStats>* eval_stats = nullptr);
 
     [[nodiscard]] static Status execute_conjuncts(const VExprContextSPtrs& conjuncts, Block* block,
                                                   ColumnUInt8& null_map,
@@ -233,9 +235,10 @@ public:
             const VExprContextSPtrs& ctxs, Block* block, std::vector<uint32_t>& columns_to_filter,
             int column_to_keep);
 
-    static Status execute_conjuncts_and_filter_block(const VExprContextSPtrs& ctxs, Block* block,
-                                                     std::vector<uint32_t>& columns_to_filter,
-                                                     int column_to_keep, IColumn::Filter& filter);
+    static Status execute_conjuncts_and_filter_block(
+            const VExprContextSPtrs& ctxs, Block* block, std::vector<uint32_t>& columns_to_filter,
+            int column_to_keep, IColumn::Filter& filter,
+            std::vector<PredicateEvalStats>* eval_stats = nullptr);
 
     [[nodiscard]] static Status get_output_block_after_execute_exprs(const VExprContextSPtrs&,
                                                                      const Block&, Block*,
@@ -17,6 +17,7 @@
 
 #include "vec/functions/complex_hash_map_dictionary.h" // for ComplexHashMapDictionary
 
+#include <algorithm>
 #include <type_traits>
 #include <vector>
 
@@ -32,6 +33,7 @@ ComplexHashMapDictionary::~ComplexHashMapDictionary() {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_mem_tracker);
         _hash_map_method.method_variant.emplace<std::monostate>();
         ColumnPtrs {}.swap(_key_columns);
+        PaddedPODArray<UInt32> {}.swap(_flat_index);
     }
 }
 
@@ -46,6 +48,7 @@ size_t ComplexHashMapDictionary::allocated_bytes() const {
     for (const auto& column : _key_columns) {
         bytes += column->allocated_bytes();
     }
+    bytes += _flat_index.allocated_bytes();
     return bytes + IDictionary::allocated_bytes();
 }
 void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const DataTypes& key_types,
@@ -93,10 +96,70 @@ void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const Da
                        }},
                _hash_map_method.method_variant);
 
+    try_build_flat_index(key_types);
+
     // load value column
     load_values(values_column);
 }
 
+void ComplexHashMapDictionary::try_build_flat_index(const DataTypes& key_types) {
+    if (_key_columns.size() != 1 || _key_columns[0]->empty()) {
+        return;
+    }
+    cast_type_to_either<DataTypeInt8, DataTypeInt16, DataTypeInt32, DataTypeInt64>(
+            key_types[0].get(), [&](const auto& type) {
+                using ColumnType = typename std::decay_t<decltype(type)>::ColumnType;
+                const auto* key_column = check_and_get_column<ColumnType>(_key_columns[0].get());
+                if (!key_column) {
+                    return false;
+                }
+                const auto& keys = key_column->get_data();
+                const auto [min_it, max_it] = std::minmax_element(keys.begin(), keys.end());
+                // Int128 avoids overflow when the keys span the whole Int64 range
+                const Int128 range = static_cast<Int128>(*max_it) - *min_it + 1;
+                if (range > static_cast<Int128>(keys.size() * FLAT_INDEX_MAX_EXPANSION)) {
+                    return false;
+                }
+                _flat_key_min = *min_it;
+                _flat_index.resize_fill(static_cast<size_t>(range), FLAT_INDEX_NOT_FOUND);
+                for (size_t i = 0; i < keys.size(); ++i) {
+                    _flat_index[static_cast<size_t>(keys[i] - _flat_key_min)] =
+                            static_cast<UInt32>(i);
+                }
+                _flat_key_type = key_types[0];
+                return true;
+            });
+}
+
+void ComplexHashMapDictionary::find_by_flat_index(const IColumn& key_column,
+                                                  IColumn::Selector& value_index,
+                                                  NullMap& key_not_found) const {
+    const IColumn* key_data_column = &key_column;
+    const NullMap* key_null_map = nullptr;
+    if (const auto* nullable_column = check_and_get_column<ColumnNullable>(&key_column)) {
+        key_data_column = &nullable_column->get_nested_column();
+        key_null_map = &nullable_column->get_null_map_data();
+    }
+    cast_type_to_either<DataTypeInt8, DataTypeInt16, DataTypeInt32, DataTypeInt64>(
+            _flat_key_type.get(), [&](const auto& type) {
+                using ColumnType = typename std::decay_t<decltype(type)>::ColumnType;
+                const auto& keys = assert_cast<const ColumnType&>(*key_data_column).get_data();
+                const size_t index_size = _flat_index.size();
+                for (size_t i = 0; i < keys.size(); ++i) {
+                    // keys below the minimum wrap around to a large offset and fall out of range
+                    const auto offset = static_cast<UInt64>(static_cast<Int64>(keys[i])) -
+                                        static_cast<UInt64>(_flat_key_min);
+                    if ((key_null_map && (*key_null_map)[i]) || offset >= index_size ||
+                        _flat_index[offset] == FLAT_INDEX_NOT_FOUND) {
+                        key_not_found[i] = true;
+                    } else {
+                        value_index[i] = _flat_index[offset];
+                    }
+                }
+                return true;
+            });
+}
+
 void ComplexHashMapDictionary::init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                                                   const DataTypes& key_types) const {
     THROW_IF_ERROR(
@@ -136,6 +199,25 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
     // if key is not found, or key is null , wiil set true
     NullMap key_not_found = NullMap(rows, false);
 
+    if (can_use_flat_index(key_types)) {
+        find_by_flat_index(*key_columns[0], value_index, key_not_found);
+    } else {
+        find_by_hash_map(key_columns, key_types, value_index, key_not_found);
+    }
+
+    ColumnPtrs columns;
+    for (size_t i = 0; i < attribute_names.size(); ++i) {
+        columns.push_back(get_single_value_column(value_index, key_not_found, attribute_names[i],
+                                                  attribute_types[i]));
+    }
+    return columns;
+}
+
+void ComplexHashMapDictionary::find_by_hash_map(const ColumnPtrs& key_columns,
+                                                const DataTypes& key_types,
+                                                IColumn::Selector& value_index,
+                                                NullMap& key_not_found) const {
+    auto rows = uint32_t(key_columns[0]->size());
     DictionaryHashMapMethod find_hash_map;
     // In init_find_hash_map, hashtable will be shared, similar to shared_hashtable in join
     init_find_hash_map(find_hash_map, key_types);
@@ -189,13 +271,6 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
                            }
                        }},
                find_hash_map.method_variant, make_bool_variant(key_hash_nullable));
-
-    ColumnPtrs columns;
-    for (size_t i = 0; i < attribute_names.size(); ++i) {
-        columns.push_back(get_single_value_column(value_index, key_not_found, attribute_names[i],
-                                                  attribute_types[i]));
-    }
-    return columns;
 }
 
 ColumnPtr ComplexHashMapDictionary::get_single_value_column(
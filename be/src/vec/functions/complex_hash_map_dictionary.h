@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -78,10 +79,34 @@ private:
     void init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                             const DataTypes& key_types) const;
 
+    void find_by_hash_map(const ColumnPtrs& key_columns, const DataTypes& key_types,
+                          IColumn::Selector& value_index, NullMap& key_not_found) const;
+
+    // A single integer key whose values are dense is also indexed by a flat array,
+    // so lookups are an offset computation instead of a hash table probe.
+    void try_build_flat_index(const DataTypes& key_types);
+
+    bool can_use_flat_index(const DataTypes& key_types) const {
+        return !_flat_index.empty() && key_types.size() == 1 &&
+               key_types[0]->equals(*_flat_key_type);
+    }
+
+    void find_by_flat_index(const IColumn& key_column, IColumn::Selector& value_index,
+                            NullMap& key_not_found) const;
+
+    // the flat index is built only if its size is at most this multiple of the key count
+    static constexpr size_t FLAT_INDEX_MAX_EXPANSION = 4;
+    static constexpr UInt32 FLAT_INDEX_NOT_FOUND = std::numeric_limits<UInt32>::max();
+
     DictionaryHashMapMethod _hash_map_method;
 
     // Used to save key columns, because some types of hashmaps do not hold key columns, such as MethodStringNoCache
     ColumnPtrs _key_columns;
+
+    // _flat_index[key - _flat_key_min] is the value row of key, or FLAT_INDEX_NOT_FOUND
+    PaddedPODArray<UInt32> _flat_index;
+    Int64 _flat_key_min = 0;
+    DataTypePtr _flat_key_type;
 };
 
 inline DictionaryPtr create_complex_hash_map_dict_from_column(
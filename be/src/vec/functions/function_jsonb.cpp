@@ -19,6 +19,7 @@
 
 #include <cstdlib>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -922,6 +923,9 @@ public:
         // reuseable json path list, espacially for const path
         std::vector<JsonbPath> json_path_list;
         json_path_list.resize(rdata_columns.size());
+        // raw text of the path currently held in json_path_list, a non const path column
+        // usually repeats the same few paths, so only re-parse when the text changes
+        std::vector<std::optional<std::string_view>> parsed_path_list(rdata_columns.size());
 
         // lambda function to parse json path for row i and path pi
         auto parse_json_path = [&](size_t i, size_t pi) -> Status {
@@ -934,6 +938,11 @@ public:
             size_t r_size = roffsets[index] - r_off;
             const char* r_raw = reinterpret_cast<const char*>(&rdata[r_off]);
 
+            std::string_view raw_path(r_raw, r_size);
+            if (parsed_path_list[pi].has_value() && *parsed_path_list[pi] == raw_path) {
+                return Status::OK();
+            }
+
             JsonbPath path;
             if (!path.seek(r_raw, r_size)) {
                 return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
@@ -941,6 +950,7 @@ public:
             }
 
             json_path_list[pi] = std::move(path);
+            parsed_path_list[pi] = raw_path;
 
             return Status::OK();
         };
@@ -1046,6 +1056,10 @@ public:
 
         std::unique_ptr<JsonbToJson> formater;
 
+        // the path column usually repeats a few paths, keep the last parsed one
+        JsonbPath path;
+        std::optional<std::string_view> parsed_path;
+
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (l_null_map && (*l_null_map)[i]) {
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
@@ -1063,11 +1077,15 @@ public:
             int r_size = roffsets[i] - roffsets[i - 1];
             const char* r_raw = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
 
-            JsonbPath path;
-            if (!path.seek(r_raw, r_size)) {
-                return Status::InvalidArgument(
-                        "Json path error: Invalid Json Path for value: {} at row: {}",
-                        std::string_view(r_raw, r_size), i);
+            std::string_view raw_path(r_raw, r_size);
+            if (!parsed_path.has_value() || *parsed_path != raw_path) {
+                path = JsonbPath();
+                if (!path.seek(r_raw, r_size)) {
+                    return Status::InvalidArgument(
+                            "Json path error: Invalid Json Path for value: {} at row: {}",
+                            raw_path, i);
+                }
+                parsed_path = raw_path;
             }
 
             inner_loop_impl(i, res_data, res_offsets, null_map, formater, l_raw, l_size, path);
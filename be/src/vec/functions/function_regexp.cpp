@@ -62,21 +62,21 @@ struct RegexpCountImpl {
     }
     static int _execute_inner_loop(FunctionContext* context, const ColumnString* str_col,
                                    const ColumnString* pattern_col, const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        const re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
         std::unique_ptr<re2::RE2> scoped_re;
+        ObjLRUCache::CacheHandle cache_handle;
         if (re == nullptr) {
             std::string error_str;
             DCHECK(pattern_col);
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, false));
-            bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(), StringRef(),
-                                                     scoped_re);
-            if (!st) {
+            re = StringFunctions::compile_regex_cached(pattern, &error_str, StringRef(),
+                                                       &cache_handle, scoped_re);
+            if (re == nullptr) {
                 context->add_warning(error_str.c_str());
                 throw Exception(Status::InvalidArgument(error_str));
                 return 0;
             }
-            re = scoped_re.get();
         }
 
         const auto& str = str_col->get_data_at(index_now);
@@ -316,20 +316,20 @@ struct RegexpReplaceImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        const re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
         std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
+        ObjLRUCache::CacheHandle cache_handle;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
-            bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(),
-                                                     options_value, scoped_re);
-            if (!st) {
+            re = StringFunctions::compile_regex_cached(pattern, &error_str, options_value,
+                                                       &cache_handle, scoped_re);
+            if (re == nullptr) {
                 context->add_warning(error_str.c_str());
                 StringOP::push_null_string(index_now, result_data, result_offset, null_map);
                 return;
             }
-            re = scoped_re.get();
         }
 
         re2::StringPiece replace_str = re2::StringPiece(
@@ -386,20 +386,20 @@ struct RegexpReplaceOneImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        const re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
         std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
+        ObjLRUCache::CacheHandle cache_handle;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
-            bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(),
-                                                     options_value, scoped_re);
-            if (!st) {
+            re = StringFunctions::compile_regex_cached(pattern, &error_str, options_value,
+                                                       &cache_handle, scoped_re);
+            if (re == nullptr) {
                 context->add_warning(error_str.c_str());
                 StringOP::push_null_string(index_now, result_data, result_offset, null_map);
                 return;
             }
-            re = scoped_re.get();
         }
 
         re2::StringPiece replace_str = re2::StringPiece(
@@ -469,20 +469,20 @@ struct RegexpExtractImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        const re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
         std::unique_ptr<re2::RE2> scoped_re;
+        ObjLRUCache::CacheHandle cache_handle;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
-            bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(), StringRef(),
-                                                     scoped_re);
-            if (!st) {
+            re = StringFunctions::compile_regex_cached(pattern, &error_str, StringRef(),
+                                                       &cache_handle, scoped_re);
+            if (re == nullptr) {
                 context->add_warning(error_str.c_str());
                 StringOP::push_null_string(index_now, result_data, result_offset, null_map);
                 return;
             }
-            re = scoped_re.get();
         }
         const auto& str = str_col->get_data_at(index_now);
         re2::StringPiece str_sp = re2::StringPiece(str.data, str.size);
@@ -548,20 +548,20 @@ struct RegexpExtractAllImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        const re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
         std::unique_ptr<re2::RE2> scoped_re;
+        ObjLRUCache::CacheHandle cache_handle;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
-            bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(), StringRef(),
-                                                     scoped_re);
-            if (!st) {
+            re = StringFunctions::compile_regex_cached(pattern, &error_str, StringRef(),
+                                                       &cache_handle, scoped_re);
+            if (re == nullptr) {
                 context->add_warning(error_str.c_str());
                 StringOP::push_null_string(index_now, result_data, result_offset, null_map);
                 return;
             }
-            re = scoped_re.get();
         }
         if (re->NumberOfCapturingGroups() == 0) {
             StringOP::push_empty_string(index_now, result_data, result_offset);
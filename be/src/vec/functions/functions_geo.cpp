@@ -610,7 +610,25 @@ struct StRelationFunction {
     static const size_t NUM_ARGS = 2;
     using Type = DataTypeUInt8;
 
-    static Status execute(Block& block, const ColumnNumbers& arguments, size_t result) {
+    static Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
+        if (scope != FunctionContext::THREAD_LOCAL) {
+            return Status::OK();
+        }
+        // Decode the constant shape once instead of once per row. The S2 index of a polygon is
+        // built by its first relation check and reused by all the following rows.
+        auto state = std::make_shared<StContainsState>();
+        for (int i = 0; i < 2; ++i) {
+            if (context->is_col_constant(i)) {
+                auto value = context->get_constant_col(i)->column_ptr->get_data_at(0);
+                state->shapes[i] = GeoShape::from_encoded(value.data, value.size);
+            }
+        }
+        context->set_function_state(scope, state);
+        return Status::OK();
+    }
+
+    static Status execute(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
+                          size_t result) {
         DCHECK_EQ(arguments.size(), 2);
         auto return_type = block.get_data_type(result);
         const auto& [left_column, left_const] =
@@ -624,10 +642,15 @@ struct StRelationFunction {
         auto null_map = ColumnUInt8::create(size, 0);
         auto& null_map_data = null_map->get_data();
 
+        const auto* state = reinterpret_cast<StContainsState*>(
+                context->get_function_state(FunctionContext::THREAD_LOCAL));
+        std::unique_ptr<GeoShape> const_holder;
         if (left_const) {
-            const_vector(left_column, right_column, res, null_map_data, size);
+            const auto* lhs = const_shape(state, 0, left_column, const_holder);
+            vector_loop<true>(lhs, right_column, res, null_map_data, size);
         } else if (right_const) {
-            vector_const(left_column, right_column, res, null_map_data, size);
+            const auto* rhs = const_shape(state, 1, right_column, const_holder);
+            vector_loop<false>(rhs, left_column, res, null_map_data, size);
         } else {
             vector_vector(left_column, right_column, res, null_map_data, size);
         }
@@ -636,73 +659,95 @@ struct StRelationFunction {
         return Status::OK();
     }
 
-    static void loop_do(StringRef& lhs_value, StringRef& rhs_value,
-                        std::vector<std::unique_ptr<GeoShape>>& shapes,
-                        ColumnUInt8::MutablePtr& res, NullMap& null_map, int row) {
-        StringRef* strs[2] = {&lhs_value, &rhs_value};
-        for (int i = 0; i < 2; ++i) {
-            std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(strs[i]->data, strs[i]->size));
-            shapes[i] = std::move(shape);
-            if (!shapes[i]) {
-                null_map[row] = 1;
-                break;
-            }
-        }
-        if (shapes[0] && shapes[1]) {
-            auto relation_value = Func::evaluate(shapes[0].get(), shapes[1].get());
-            res->get_data()[row] = relation_value;
+    // The constant shape of argument `index`, the one decoded by `open` if there is, otherwise
+    // decoded into `holder` once for the block. nullptr if the shape is invalid.
+    static const GeoShape* const_shape(const StContainsState* state, int index,
+                                       const ColumnPtr& column,
+                                       std::unique_ptr<GeoShape>& holder) {
+        if (state != nullptr && state->shapes[index] != nullptr) {
+            return state->shapes[index].get();
         }
+        auto value = column->get_data_at(0);
+        holder = GeoShape::from_encoded(value.data, value.size);
+        return holder.get();
     }
 
-    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+    // Decode the shape of a row into `shape`, in place if it has the same type as the shape of the
+    // previous row, which saves the allocation per row when the column is all points.
+    static bool decode_row(const StringRef& value, std::unique_ptr<GeoShape>& shape) {
+        if (shape != nullptr && shape->decode_from(value.data, value.size)) {
+            return true;
         }
+        shape = GeoShape::from_encoded(value.data, value.size);
+        return shape != nullptr;
     }
 
-    static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
+    // Evaluate the relation between the constant shape and the shape of every row of `column`,
+    // `const_is_left` tells the side of the constant shape.
+    template <bool const_is_left>
+    static void vector_loop(const GeoShape* const_shape, const ColumnPtr& column,
+                            ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
+        if (const_shape == nullptr) {
+            std::fill(null_map.begin(), null_map.begin() + size, 1);
+            return;
+        }
+        auto& res_data = res->get_data();
+        std::unique_ptr<GeoShape> row_shape;
         for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+            if (!decode_row(column->get_data_at(row), row_shape)) {
+                null_map[row] = 1;
+                continue;
+            }
+            if constexpr (const_is_left) {
+                res_data[row] = Func::evaluate(const_shape, row_shape.get());
+            } else {
+                res_data[row] = Func::evaluate(row_shape.get(), const_shape);
+            }
         }
     }
 
     static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                               ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
+        auto& res_data = res->get_data();
+        std::unique_ptr<GeoShape> lhs;
+        std::unique_ptr<GeoShape> rhs;
         for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+            if (!decode_row(left_column->get_data_at(row), lhs) ||
+                !decode_row(right_column->get_data_at(row), rhs)) {
+                null_map[row] = 1;
+                continue;
+            }
+            res_data[row] = Func::evaluate(lhs.get(), rhs.get());
         }
     }
 };
 
 struct StContainsFunc {
     static constexpr auto NAME = "st_contains";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->contains(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->contains(shape2);
+    }
 };
 
 struct StIntersectsFunc {
     static constexpr auto NAME = "st_intersects";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->intersects(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->intersects(shape2);
+    }
 };
 
 struct StDisjointFunc {
     static constexpr auto NAME = "st_disjoint";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->disjoint(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->disjoint(shape2);
+    }
 };
 
 struct StTouchesFunc {
     static constexpr auto NAME = "st_touches";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->touches(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->touches(shape2);
+    }
 };
 
 struct StGeometryFromText {
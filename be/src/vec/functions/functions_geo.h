@@ -48,6 +48,7 @@ struct StConstructState {
     std::string encoded_buf;
 };
 
+// The constant shapes of a relation function, decoded once by `open`.
 struct StContainsState {
     StContainsState() : is_null(false), shapes {nullptr, nullptr} {}
     ~StContainsState() {}
@@ -69,9 +70,21 @@ public:
         return make_nullable(std::make_shared<ReturnType>());
     }
 
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override {
+        if constexpr (requires { Impl::open(context, scope); }) {
+            return Impl::open(context, scope);
+        } else {
+            return Status::OK();
+        }
+    }
+
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         uint32_t result, size_t input_rows_count) const override {
-        return Impl::execute(block, arguments, result);
+        if constexpr (requires { Impl::execute(context, block, arguments, result); }) {
+            return Impl::execute(context, block, arguments, result);
+        } else {
+            return Impl::execute(block, arguments, result);
+        }
     }
 };
 
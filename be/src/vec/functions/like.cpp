@@ -415,9 +415,24 @@ Status FunctionLikeBase::constant_regex_fn(LikeSearchState* state, const ColumnS
                                            const StringRef& pattern,
                                            ColumnUInt8::Container& result) {
     auto sz = val.size();
+    // rows without the required literal can not match, find the ones with it by searching
+    // the whole chars buffer once and only run the regex on them. Low cardinality columns
+    // repeat values in runs, so a row equal to the previous one reuses its result.
+    ColumnUInt8::Container candidates;
+    if (state->search_string_sv.size > 0) {
+        candidates.resize_fill(sz, 0);
+        RETURN_IF_ERROR(execute_substring(val.get_chars(), val.get_offsets(), candidates, state));
+    }
     if (state->hs_database) { // use hyperscan
         for (size_t i = 0; i < sz; i++) {
+            if (!candidates.empty() && !candidates[i]) {
+                continue;
+            }
             const auto& str_ref = val.get_data_at(i);
+            if (i > 0 && str_ref == val.get_data_at(i - 1)) {
+                result[i] = result[i - 1];
+                continue;
+            }
             auto ret = hs_scan(state->hs_database.get(), str_ref.data, (int)str_ref.size, 0,
                                state->hs_scratch.get(),
                                doris::vectorized::LikeSearchState::hs_match_handler,
@@ -428,7 +443,14 @@ Status FunctionLikeBase::constant_regex_fn(LikeSearchState* state, const ColumnS
         }
     } else { // fallback to re2
         for (size_t i = 0; i < sz; i++) {
+            if (!candidates.empty() && !candidates[i]) {
+                continue;
+            }
             const auto& str_ref = val.get_data_at(i);
+            if (i > 0 && str_ref == val.get_data_at(i - 1)) {
+                result[i] = result[i - 1];
+                continue;
+            }
             *(result.data() + i) =
                     RE2::PartialMatch(re2::StringPiece(str_ref.data, str_ref.size), *state->regex);
         }
@@ -548,7 +570,7 @@ Status FunctionLikeBase::execute_impl(FunctionContext* context, Block& block,
 Status FunctionLikeBase::execute_substring(const ColumnString::Chars& values,
                                            const ColumnString::Offsets& value_offsets,
                                            ColumnUInt8::Container& result,
-                                           LikeSearchState* search_state) const {
+                                           LikeSearchState* search_state) {
     // treat continuous multi string data as a long string data
     const UInt8* begin = values.data();
     const UInt8* end = begin + values.size();
@@ -787,6 +809,27 @@ void FunctionLike::remove_escape_character(std::string* search_string) {
     }
 }
 
+std::string FunctionLike::extract_required_literal(const std::string& pattern) {
+    std::string longest;
+    std::string current;
+    auto size = pattern.size();
+    for (size_t i = 0; i < size; i++) {
+        char c = pattern[i];
+        if (c == '\\' && i + 1 < size &&
+            (pattern[i + 1] == '%' || pattern[i + 1] == '_' || pattern[i + 1] == '\\')) {
+            current.append(1, pattern[++i]);
+        } else if (c == '%' || c == '_') {
+            if (current.size() > longest.size()) {
+                longest.swap(current);
+            }
+            current.clear();
+        } else {
+            current.append(1, c);
+        }
+    }
+    return current.size() > longest.size() ? current : longest;
+}
+
 bool re2_full_match(const std::string& str, const RE2& re, std::vector<std::string>& results) {
     if (!re.ok()) {
         return false;
@@ -896,6 +939,8 @@ Status FunctionLike::construct_like_const_state(FunctionContext* context, const
                        << ", size: " << re_pattern.size();
         }
 
+        state->search_state.set_search_string(extract_required_literal(pattern_str));
+
         hs_database_t* database = nullptr;
         hs_scratch_t* scratch = nullptr;
         if (try_hyperscan && hs_prepare(context, re_pattern.c_str(), &database, &scratch).ok()) {
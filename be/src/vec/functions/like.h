@@ -90,6 +90,8 @@ struct LikeSearchState {
     /// constant string or has a constant string at the beginning or end of the pattern.
     /// This will be set in order to check for that pattern in the corresponding part of
     /// the string.
+    /// For a LIKE pattern evaluated by regex, this is the longest literal every match must
+    /// contain, used to select the candidate rows before running the regex.
     StringRef search_string_sv;
 
     /// Used for LIKE predicates if the pattern is a constant argument and has a constant
@@ -201,9 +203,12 @@ protected:
                             ColumnUInt8::Container& result, LikeState* state,
                             size_t input_rows_count) const;
 
-    Status execute_substring(const ColumnString::Chars& values,
-                             const ColumnString::Offsets& value_offsets,
-                             ColumnUInt8::Container& result, LikeSearchState* search_state) const;
+    // search the substring pattern of search_state over all strings at once and set
+    // result to 1 for the rows containing it
+    static Status execute_substring(const ColumnString::Chars& values,
+                                    const ColumnString::Offsets& value_offsets,
+                                    ColumnUInt8::Container& result,
+                                    LikeSearchState* search_state);
 
     template <bool LIKE_PATTERN>
     static VPatternSearchStateSPtr pattern_type_recognition(const ColumnString& patterns);
@@ -303,6 +308,9 @@ private:
                                      std::string* re_pattern);
 
     static void remove_escape_character(std::string* search_string);
+
+    // longest run of literal characters of a LIKE pattern, every matched string contains it
+    static std::string extract_required_literal(const std::string& pattern);
 };
 
 class FunctionRegexpLike : public FunctionLikeBase {
@@ -165,20 +165,22 @@ void parse_json_to_variant(IColumn& column, const char* src, size_t length,
         check_paths.insert(check_paths.end(), paths.begin(), paths.end());
         THROW_IF_ERROR(vectorized::schema_util::check_variant_has_no_ambiguous_paths(check_paths));
     }
+    size_t num_inserted = 0;
     for (size_t i = 0; i < paths.size(); ++i) {
         FieldInfo field_info;
         schema_util::get_field_info(values[i], &field_info);
         if (field_info.scalar_type_id == PrimitiveType::INVALID_TYPE) {
             continue;
         }
-        if (column_variant.get_subcolumn(paths[i], i) == nullptr) {
+        auto* subcolumn = column_variant.get_subcolumn(paths[i], i);
+        if (subcolumn == nullptr) {
             if (paths[i].has_nested_part()) {
                 column_variant.add_nested_subcolumn(paths[i], field_info, old_num_rows);
             } else {
                 column_variant.add_sub_column(paths[i], old_num_rows);
             }
+            subcolumn = column_variant.get_subcolumn(paths[i], i);
         }
-        auto* subcolumn = column_variant.get_subcolumn(paths[i], i);
         if (!subcolumn) {
             throw doris::Exception(ErrorCode::INVALID_ARGUMENT, "Failed to find sub column {}",
                                    paths[i].get_path());
@@ -193,21 +195,32 @@ void parse_json_to_variant(IColumn& column, const char* src, size_t length,
                                    paths[i].get_path());
         }
         subcolumn->insert(std::move(values[i]), std::move(field_info));
+        ++num_inserted;
     }
     // /// Insert default values to missed subcolumns.
-    const auto& subcolumns = column_variant.get_subcolumns();
-    for (const auto& entry : subcolumns) {
-        if (entry->data.size() == old_num_rows) {
-            // Handle nested paths differently from simple paths
-            if (entry->path.has_nested_part()) {
-                // Try to insert default from nested, if failed, insert regular default
-                bool success = UNLIKELY(column_variant.try_insert_default_from_nested(entry));
-                if (!success) {
-                    entry->data.insert_default();
+    // Each insert above went to a distinct subcolumn, so a document with the same layout as the
+    // column has filled all of them but the root, and the scan over the subcolumns is skipped.
+    auto& subcolumns = column_variant.get_subcolumns();
+    auto* root = subcolumns.get_mutable_root();
+    bool root_missing = root != nullptr && root->is_scalar() && root->data.size() == old_num_rows;
+    if (num_inserted + root_missing == subcolumns.size()) {
+        if (root_missing) {
+            root->data.increment_default_counter();
+        }
+    } else {
+        for (const auto& entry : subcolumns) {
+            if (entry->data.size() == old_num_rows) {
+                // Handle nested paths differently from simple paths
+                if (entry->path.has_nested_part()) {
+                    // Try to insert default from nested, if failed, insert regular default
+                    bool success = UNLIKELY(column_variant.try_insert_default_from_nested(entry));
+                    if (!success) {
+                        entry->data.insert_default();
+                    }
+                } else {
+                    // For non-nested paths, increment default counter
+                    entry->data.increment_default_counter();
                 }
-            } else {
-                // For non-nested paths, increment default counter
-                entry->data.increment_default_counter();
             }
         }
     }
@@ -440,13 +440,12 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
         _block_row_locations.resize(_block_row_max);
     }
     while (_get_size(block) < _block_row_max) {
-        if (_merge_heap.empty()) {
-            VLOG_NOTICE << "_merge_heap empty";
+        auto* ctx = _winner();
+        if (ctx == nullptr) {
+            VLOG_NOTICE << "_loser_tree empty";
             break;
         }
-
-        auto ctx = _merge_heap.top();
-        _merge_heap.pop();
+        const size_t leaf = _loser_tree[0];
         if (ctx->is_same()) {
             tmp_row_sources.emplace_back(ctx->order(), true);
         } else {
@@ -482,10 +481,9 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
         }
 
         RETURN_IF_ERROR(ctx->advance());
-        if (ctx->valid()) {
-            _merge_heap.push(ctx);
-        } else {
-            // push next iterator in same rowset into heap
+        if (!ctx->valid()) {
+            // the next iterator in same rowset takes over the leaf
+            _leaves[leaf] = nullptr;
             size_t cur_order = ctx->order();
             for (size_t next_order = cur_order + 1;
                  next_order < _iterator_init_flags.size() && !_iterator_init_flags[next_order];
@@ -494,7 +492,7 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
                 DCHECK(next_ctx);
                 RETURN_IF_ERROR(next_ctx->init(_opts));
                 if (next_ctx->valid()) {
-                    _merge_heap.push(next_ctx.get());
+                    _leaves[leaf] = next_ctx.get();
                     break;
                 }
                 // next_ctx is empty segment, move to next
@@ -503,9 +501,10 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
             // Release ctx earlier to reduce resource consumed
             _ori_iter_ctx[cur_order].reset();
         }
+        _replay_loser_tree(leaf);
     }
     RETURN_IF_ERROR(_row_sources_buf->append(tmp_row_sources));
-    if (!_merge_heap.empty()) {
+    if (_winner() != nullptr) {
         return Status::OK();
     }
     if (UNLIKELY(_record_rowids)) {
@@ -548,16 +547,50 @@ Status VerticalHeapMergeIterator::init(const StorageReadOptions& opts,
                 pre_iter_invalid = true;
                 continue;
             }
-            _merge_heap.push(ctx.get());
+            _leaves.push_back(ctx.get());
             pre_iter_invalid = false;
         }
     }
+    _build_loser_tree();
 
     _opts = opts;
     _block_row_max = opts.block_row_max;
     return Status::OK();
 }
 
+void VerticalHeapMergeIterator::_build_loser_tree() {
+    // leaf i sits at node i + n, the parent of node j is j / 2, node 0 keeps the final winner.
+    const size_t n = _leaves.size();
+    if (n == 0) {
+        return;
+    }
+    _loser_tree.assign(n, 0);
+    std::vector<size_t> winners(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+        winners[i + n] = i;
+    }
+    for (size_t node = n - 1; node >= 1; --node) {
+        size_t lhs = winners[2 * node];
+        size_t rhs = winners[2 * node + 1];
+        if (_leaf_wins(rhs, lhs)) {
+            std::swap(lhs, rhs);
+        }
+        winners[node] = lhs;
+        _loser_tree[node] = rhs;
+    }
+    _loser_tree[0] = n == 1 ? 0 : winners[1];
+}
+
+void VerticalHeapMergeIterator::_replay_loser_tree(size_t leaf) {
+    size_t winner = leaf;
+    for (size_t node = (leaf + _leaves.size()) / 2; node >= 1; node /= 2) {
+        if (_leaf_wins(_loser_tree[node], winner)) {
+            std::swap(_loser_tree[node], winner);
+        }
+    }
+    _loser_tree[0] = winner;
+}
+
 //  ----------------  VerticalFifoMergeIterator  -------------  //
 Status VerticalFifoMergeIterator::next_batch(Block* block) {
     size_t row_idx = 0;
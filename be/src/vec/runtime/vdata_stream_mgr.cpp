@@ -120,6 +120,17 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
     static_cast<void>(find_recvr(t_finst_id, request->node_id(), &recvr));
+
+    // The other instances must be served before the blocks are moved into the receiver of
+    // `finst_id`. The stream is alive as long as any of the instances is alive.
+    bool fanned_out = false;
+    if (!request->broadcast_finst_ids().empty()) {
+        RETURN_IF_ERROR(_fan_out_broadcast(request, wait_for_worker,
+                                           cpu_time_stop_watch.elapsed_time(), &fanned_out));
+    }
+    if (recvr == nullptr && fanned_out) {
+        return Status::OK();
+    }
     if (recvr == nullptr) {
         // The receiver may remove itself from the receiver map via deregister_recvr()
         // at any time without considering the remaining number of senders.
@@ -139,6 +150,9 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
     // deconstructed
     auto ctx_lock = recvr->task_exec_ctx();
     if (ctx_lock == nullptr) {
+        if (fanned_out) {
+            return Status::OK();
+        }
         // Do not return internal error, because when query finished, the downstream node
         // may finish before upstream node. And the object maybe deconstructed. If return error
         // then the upstream node may report error status to FE, the query is failed.
@@ -189,6 +203,47 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
     return Status::OK();
 }
 
+Status VDataStreamMgr::_fan_out_broadcast(const PTransmitDataParams* request,
+                                          const int64_t wait_for_worker,
+                                          const uint64_t time_to_find_recvr, bool* accepted) {
+    for (const auto& finst_id : request->broadcast_finst_ids()) {
+        TUniqueId t_finst_id;
+        t_finst_id.hi = finst_id.hi();
+        t_finst_id.lo = finst_id.lo();
+        std::shared_ptr<VDataStreamRecvr> recvr = nullptr;
+        static_cast<void>(find_recvr(t_finst_id, request->node_id(), &recvr));
+        if (recvr == nullptr) {
+            continue;
+        }
+        auto ctx_lock = recvr->task_exec_ctx();
+        if (ctx_lock == nullptr) {
+            continue;
+        }
+        *accepted = true;
+        // The copies do not hold the rpc closure, the back pressure is applied by the receiver
+        // of the instance the request is sent to.
+        for (int i = 0; i < request->blocks_size(); i++) {
+            RETURN_IF_ERROR(recvr->add_block(
+                    std::make_unique<PBlock>(request->blocks(i)), request->sender_id(),
+                    request->be_number(), request->packet_seq() - request->blocks_size() + i,
+                    nullptr, wait_for_worker, time_to_find_recvr));
+        }
+        if (request->has_block()) {
+            RETURN_IF_ERROR(recvr->add_block(std::make_unique<PBlock>(request->block()),
+                                             request->sender_id(), request->be_number(),
+                                             request->packet_seq(), nullptr, wait_for_worker,
+                                             time_to_find_recvr));
+        }
+        if (request->eos()) {
+            Status exec_status = request->has_exec_status()
+                                         ? Status::create(request->exec_status())
+                                         : Status::OK();
+            recvr->remove_sender(request->sender_id(), request->be_number(), exec_status);
+        }
+    }
+    return Status::OK();
+}
+
 Status VDataStreamMgr::deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id) {
     std::shared_ptr<VDataStreamRecvr> targert_recvr;
     VLOG_QUERY << "deregister_recvr(): fragment_instance_id=" << print_id(fragment_instance_id)
@@ -95,6 +95,11 @@ private:
     FragmentStreamSet _fragment_stream_set;
 
     uint32_t get_hash_value(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
+
+    // Add a copy of the blocks of a per-BE broadcast request to the receivers of the other
+    // instances listed in `broadcast_finst_ids`. `accepted` is set if any of them is alive.
+    Status _fan_out_broadcast(const PTransmitDataParams* request, const int64_t wait_for_worker,
+                              const uint64_t time_to_find_recvr, bool* accepted);
 };
 } // namespace vectorized
 } // namespace doris
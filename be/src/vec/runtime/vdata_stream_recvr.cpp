@@ -33,6 +33,7 @@
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/core/materialize_block.h"
@@ -58,16 +59,74 @@ VDataStreamRecvr::SenderQueue::~SenderQueue() {
     // Check pending closures, if it is not empty, should clear it here. but it should not happen.
     // closure will delete itself during run method. If it is not called, brpc will memory leak.
     DCHECK(_pending_closures.empty());
-    for (auto closure_pair : _pending_closures) {
-        closure_pair.first->Run();
-        int64_t elapse_time = closure_pair.second.elapsed_time();
-        if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
-            _recvr->_max_wait_to_process_time->set(elapse_time);
-        }
+    for (auto& pending : _pending_closures) {
+        _run_pending_closure(pending);
     }
     _pending_closures.clear();
 }
 
+void VDataStreamRecvr::SenderQueue::_run_pending_closure(PendingClosure& pending) {
+    pending.closure->Run();
+    int64_t elapse_time = pending.watch.elapsed_time();
+    if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
+        _recvr->_max_wait_to_process_time->set(elapse_time);
+    }
+}
+
+// A remote sender has at most one RPC in flight to a receiver, the response of its RPC is the
+// credit for the next one. It is delayed while the blocks of the sender queued here exceed the
+// credit of the sender, so a receiver can not have more than a credit plus an RPC per sender
+// queued. The credit is the share of the sender of the budget of the queue, and lower if the
+// queue is consumed slower than that share per `exchange_credit_window_ms`.
+int64_t VDataStreamRecvr::SenderQueue::_sender_credit() const {
+    const int64_t senders = std::max(_num_remaining_senders, 1);
+    const int64_t share = _recvr->sender_queue_credit_budget() / senders;
+    if (_consume_bytes_per_sec <= 0) {
+        return share;
+    }
+    const auto consumed = static_cast<int64_t>(_consume_bytes_per_sec *
+                                               config::exchange_credit_window_ms / 1000.0) /
+                          senders;
+    return std::clamp(consumed, std::min(MIN_SENDER_CREDIT_BYTES, share), share);
+}
+
+// Only the time when the consumer did not wait for blocks counts, so that a starved consumer does
+// not lower the credits and starve itself more.
+void VDataStreamRecvr::SenderQueue::_update_consume_rate(size_t block_byte_size,
+                                                         bool backlogged) {
+    const int64_t now = MonotonicNanos();
+    if (_backlogged && _last_consume_ns > 0) {
+        _consume_window_bytes += static_cast<int64_t>(block_byte_size);
+        _consume_window_ns += now - _last_consume_ns;
+        if (_consume_window_ns >= config::exchange_credit_window_ms * NANOS_PER_MILLIS) {
+            const double rate = static_cast<double>(_consume_window_bytes) *
+                                static_cast<double>(NANOS_PER_SEC) /
+                                static_cast<double>(_consume_window_ns);
+            _consume_bytes_per_sec =
+                    _consume_bytes_per_sec <= 0 ? rate : (_consume_bytes_per_sec + rate) / 2;
+            _consume_window_bytes = 0;
+            _consume_window_ns = 0;
+        }
+    }
+    _last_consume_ns = now;
+    _backlogged = backlogged;
+}
+
+void VDataStreamRecvr::SenderQueue::_release_credited_closures() {
+    const int64_t credit = _sender_credit();
+    for (auto it = _pending_closures.begin(); it != _pending_closures.end();) {
+        auto queued = _sender_queued_bytes.find(it->be_number);
+        if (queued != _sender_queued_bytes.end() && queued->second > credit) {
+            ++it;
+            continue;
+        }
+        _run_pending_closure(*it);
+        it->watch.stop();
+        _recvr->_buffer_full_total_timer->update(it->watch.elapsed_time());
+        it = _pending_closures.erase(it);
+    }
+}
+
 Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
 #ifndef NDEBUG
     if (!_is_cancelled && _block_queue.empty() && _num_remaining_senders > 0) {
@@ -106,6 +165,16 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
     _recvr->_memory_used_counter->update(-(int64_t)block_byte_size);
     INJECT_MOCK_SLEEP(std::lock_guard<std::mutex> l(_lock));
     sub_blocks_memory_usage(block_byte_size);
+    if (block_item.be_number() >= 0) {
+        auto queued = _sender_queued_bytes.find(block_item.be_number());
+        if (queued != _sender_queued_bytes.end()) {
+            queued->second -= static_cast<int64_t>(block_byte_size);
+            if (queued->second <= 0) {
+                _sender_queued_bytes.erase(queued);
+            }
+        }
+    }
+    _update_consume_rate(block_byte_size, !_block_queue.empty());
     _record_debug_info();
     if (_block_queue.empty() && _source_dependency) {
         if (!_is_cancelled && _num_remaining_senders > 0) {
@@ -113,17 +182,15 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
         }
     }
 
-    if (!_pending_closures.empty()) {
-        auto closure_pair = _pending_closures.front();
-        closure_pair.first->Run();
-        int64_t elapse_time = closure_pair.second.elapsed_time();
-        if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
-            _recvr->_max_wait_to_process_time->set(elapse_time);
-        }
+    if (config::enable_exchange_credit_flow_control) {
+        _release_credited_closures();
+    } else if (!_pending_closures.empty()) {
+        auto pending = _pending_closures.front();
+        _run_pending_closure(pending);
         _pending_closures.pop_front();
 
-        closure_pair.second.stop();
-        _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
+        pending.watch.stop();
+        _recvr->_buffer_full_total_timer->update(pending.watch.elapsed_time());
     }
     DCHECK(block->empty());
     block->swap(*next_block);
@@ -188,17 +255,22 @@ Status VDataStreamRecvr::SenderQueue::add_block(std::unique_ptr<PBlock> pblock,
         _recvr->_max_find_recvr_time->set((int64_t)time_to_find_recvr);
     }
 
-    _block_queue.emplace_back(std::move(pblock), block_byte_size);
+    _block_queue.emplace_back(std::move(pblock), block_byte_size, be_number);
+    auto& sender_queued_bytes = _sender_queued_bytes[be_number];
+    sender_queued_bytes += static_cast<int64_t>(block_byte_size);
     COUNTER_UPDATE(_recvr->_remote_bytes_received_counter, block_byte_size);
     _record_debug_info();
     set_source_ready(l);
 
+    const bool delay_response = config::enable_exchange_credit_flow_control
+                                        ? sender_queued_bytes > _sender_credit()
+                                        : _recvr->exceeds_limit(block_byte_size);
     // if done is nullptr, this function can't delay this response
-    if (done != nullptr && _recvr->exceeds_limit(block_byte_size)) {
+    if (done != nullptr && delay_response) {
         MonotonicStopWatch monotonicStopWatch;
         monotonicStopWatch.start();
         DCHECK(*done != nullptr);
-        _pending_closures.emplace_back(*done, monotonicStopWatch);
+        _pending_closures.push_back({*done, monotonicStopWatch, be_number});
         *done = nullptr;
     }
     _recvr->_memory_used_counter->update(block_byte_size);
@@ -264,6 +336,10 @@ void VDataStreamRecvr::SenderQueue::decrement_senders(int be_number) {
     if (_num_remaining_senders == 0) {
         set_source_ready(l);
     }
+    // The remaining senders have larger credits.
+    if (config::enable_exchange_credit_flow_control) {
+        _release_credited_closures();
+    }
 }
 
 void VDataStreamRecvr::SenderQueue::cancel(Status cancel_status) {
@@ -281,12 +357,8 @@ void VDataStreamRecvr::SenderQueue::cancel(Status cancel_status) {
     }
     {
         INJECT_MOCK_SLEEP(std::lock_guard<std::mutex> l(_lock));
-        for (auto closure_pair : _pending_closures) {
-            closure_pair.first->Run();
-            int64_t elapse_time = closure_pair.second.elapsed_time();
-            if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
-                _recvr->_max_wait_to_process_time->set(elapse_time);
-            }
+        for (auto& pending : _pending_closures) {
+            _run_pending_closure(pending);
         }
         _pending_closures.clear();
     }
@@ -300,16 +372,13 @@ void VDataStreamRecvr::SenderQueue::close() {
     _is_cancelled = true;
     set_source_ready(l);
 
-    for (auto closure_pair : _pending_closures) {
-        closure_pair.first->Run();
-        int64_t elapse_time = closure_pair.second.elapsed_time();
-        if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
-            _recvr->_max_wait_to_process_time->set(elapse_time);
-        }
+    for (auto& pending : _pending_closures) {
+        _run_pending_closure(pending);
     }
     _pending_closures.clear();
     // Delete any batches queued in _block_queue
     _block_queue.clear();
+    _sender_queued_bytes.clear();
 }
 
 VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr,
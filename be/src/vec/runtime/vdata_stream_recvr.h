@@ -22,6 +22,7 @@
 #include <glog/logging.h>
 #include <google/protobuf/stubs/callback.h>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -113,6 +114,11 @@ public:
     // in this function is not safe.
     MOCK_FUNCTION bool exceeds_limit(size_t block_byte_size);
     bool queue_exceeds_limit(size_t byte_size) const;
+    // The bytes the remote senders of one sender queue may have queued in it together.
+    int64_t sender_queue_credit_budget() const {
+        return config::exchg_node_buffer_size_bytes /
+               std::max(static_cast<int64_t>(_sender_queues.size()), int64_t(1));
+    }
     bool is_closed() const { return _is_closed; }
 
     std::shared_ptr<pipeline::Dependency> get_local_channel_dependency(int sender_id);
@@ -205,6 +211,22 @@ protected:
     bool exceeds_limit();
     friend class pipeline::ExchangeLocalState;
 
+    // A sender has at least this much credit, unless its share of the budget is smaller.
+    static constexpr int64_t MIN_SENDER_CREDIT_BYTES = 256 * 1024;
+
+    struct PendingClosure {
+        google::protobuf::Closure* closure;
+        MonotonicStopWatch watch;
+        // The sender whose response is delayed.
+        int be_number;
+    };
+    void _run_pending_closure(PendingClosure& pending);
+
+    // See `enable_exchange_credit_flow_control`.
+    int64_t _sender_credit() const;
+    void _update_consume_rate(size_t block_byte_size, bool backlogged);
+    void _release_credited_closures();
+
     void set_source_ready(std::lock_guard<std::mutex>&);
 
     // To record information about several variables in the event of a DCHECK failure.
@@ -282,13 +304,20 @@ protected:
         BlockItem(BlockUPtr&& block, size_t block_byte_size)
                 : _block(std::move(block)), _block_byte_size(block_byte_size) {}
 
-        BlockItem(std::unique_ptr<PBlock>&& pblock, size_t block_byte_size)
-                : _block(nullptr), _pblock(std::move(pblock)), _block_byte_size(block_byte_size) {}
+        BlockItem(std::unique_ptr<PBlock>&& pblock, size_t block_byte_size, int be_number)
+                : _block(nullptr),
+                  _pblock(std::move(pblock)),
+                  _block_byte_size(block_byte_size),
+                  _be_number(be_number) {}
+
+        // The remote sender of the block, -1 for a block of a local sender.
+        int be_number() const { return _be_number; }
 
     private:
         BlockUPtr _block;
         std::unique_ptr<PBlock> _pblock;
         size_t _block_byte_size = 0;
+        int _be_number = -1;
         int64_t _deserialize_time = 0;
     };
 
@@ -298,7 +327,15 @@ protected:
     std::unordered_set<int> _sender_eos_set;
     // be_number => packet_seq
     std::unordered_map<int, int64_t> _packet_seq_map;
-    std::deque<std::pair<google::protobuf::Closure*, MonotonicStopWatch>> _pending_closures;
+    std::deque<PendingClosure> _pending_closures;
+    // be_number => bytes of the blocks of the remote sender in `_block_queue`
+    std::unordered_map<int, int64_t> _sender_queued_bytes;
+    // The bytes consumed per second while blocks were queued, 0 until it is measured.
+    double _consume_bytes_per_sec = 0;
+    int64_t _consume_window_bytes = 0;
+    int64_t _consume_window_ns = 0;
+    int64_t _last_consume_ns = 0;
+    bool _backlogged = false;
 
     std::shared_ptr<pipeline::Dependency> _source_dependency;
     std::shared_ptr<pipeline::Dependency> _local_channel_dependency;
@@ -24,13 +24,15 @@ namespace doris {
 bool VectorSearchUserParams::operator==(const VectorSearchUserParams& other) const {
     return hnsw_ef_search == other.hnsw_ef_search &&
            hnsw_check_relative_distance == other.hnsw_check_relative_distance &&
-           hnsw_bounded_queue == other.hnsw_bounded_queue;
+           hnsw_bounded_queue == other.hnsw_bounded_queue && ivf_nprobe == other.ivf_nprobe &&
+           ivf_refine_factor == other.ivf_refine_factor;
 }
 
 std::string VectorSearchUserParams::to_string() const {
     return fmt::format(
             "hnsw_ef_search: {}, hnsw_check_relative_distance: {}, "
-            "hnsw_bounded_queue: {}",
-            hnsw_ef_search, hnsw_check_relative_distance, hnsw_bounded_queue);
+            "hnsw_bounded_queue: {}, ivf_nprobe: {}, ivf_refine_factor: {}",
+            hnsw_ef_search, hnsw_check_relative_distance, hnsw_bounded_queue, ivf_nprobe,
+            ivf_refine_factor);
 }
 } // namespace doris
\ No newline at end of file
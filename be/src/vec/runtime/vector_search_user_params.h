@@ -26,6 +26,8 @@ struct VectorSearchUserParams {
     int hnsw_ef_search = 32;
     bool hnsw_check_relative_distance = true;
     bool hnsw_bounded_queue = true;
+    int ivf_nprobe = 16;
+    int ivf_refine_factor = 4;
 
     bool operator==(const VectorSearchUserParams& other) const;
 
@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vsorted_run_merger.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -111,11 +112,11 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         }
     });
 
-    if (_priority_queue.empty()) {
+    if (!_priority_queue.is_valid()) {
         *eos = true;
         return Status::OK();
     } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+        auto current = *_priority_queue.current().first;
         DCHECK(!current->eof());
         DCHECK(current->block_ptr() != nullptr);
         while (_offset != 0) {
@@ -123,7 +124,7 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             current->next(process_rows);
             _offset -= process_rows;
             if (current->is_last(0)) {
-                _priority_queue.pop();
+                _priority_queue.remove_top();
                 if (current->eof()) {
                     *eos = true;
                 } else {
@@ -147,12 +148,12 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         } else {
             _pending_cursor = current.impl;
         }
-        _priority_queue.pop();
+        _priority_queue.remove_top();
         return Status::OK();
     } else {
-        size_t num_columns = _priority_queue.top().impl->block->columns();
+        size_t num_columns = _priority_queue.current().first->impl->block->columns();
         MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(
-                output_block, *_priority_queue.top().impl->block);
+                output_block, *_priority_queue.current().first->impl->block);
         MutableColumns& merged_columns = m_block.mutable_columns();
 
         if (num_columns != merged_columns.size()) {
@@ -178,22 +179,36 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             _column_addrs.clear();
         };
 
-        /// Take rows from queue in right order and push to 'merged'.
+        /// Take rows from queue in right order and push to 'merged'. The queue reports how many
+        /// rows of the top cursor precede every other cursor, a run of them is copied as a range.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
-
-            if (_offset > 0) {
-                _offset--;
-            } else {
-                _indexs.emplace_back(current->pos);
+        while (merged_rows != _batch_size && _priority_queue.is_valid()) {
+            auto [current_ptr, run_rows] = _priority_queue.current();
+            auto current = *current_ptr;
+
+            size_t skip_rows = std::min(run_rows, _offset);
+            _offset -= skip_rows;
+            size_t take_rows = std::min(run_rows - skip_rows, _batch_size - merged_rows);
+            size_t start = current->pos + skip_rows;
+            if (take_rows == 1) {
+                _indexs.emplace_back(start);
                 _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
+            } else if (take_rows > 1) {
+                do_insert();
+                for (size_t i = 0; i < num_columns; ++i) {
+                    merged_columns[i]->insert_range_from(
+                            *current->block_ptr()->get_by_position(i).column, start, take_rows);
+                }
             }
-
-            current->next();
-            if (_need_more_data(current)) {
+            merged_rows += take_rows;
+
+            /// If current stream is exhausted and not eof, we should break this loop and read
+            /// more blocks.
+            size_t consumed_rows = skip_rows + take_rows;
+            bool exhausted = current->is_last(consumed_rows);
+            _priority_queue.next(consumed_rows);
+            if (exhausted && !current->eof()) {
+                _pending_cursor = current.impl;
                 do_insert();
                 return Status::OK();
             }
@@ -210,16 +225,4 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     return Status::OK();
 }
 
-bool VSortedRunMerger::_need_more_data(MergeSortCursor& current) {
-    if (!current->is_last(0)) {
-        _priority_queue.push(current);
-        return false;
-    } else if (current->eof()) {
-        return false;
-    } else {
-        _pending_cursor = current.impl;
-        return true;
-    }
-}
-
 } // namespace doris::vectorized
\ No newline at end of file
@@ -20,7 +20,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
 #include <vector>
 
 #include "common/status.h"
@@ -36,7 +35,8 @@ namespace doris::vectorized {
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
 // Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// rows in sorted order at the top of the heap. Rows of the top run that sort before the
+// head of every other run are found by galloping and copied as one range.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -74,7 +74,7 @@ protected:
     size_t _offset = 0;
 
     std::vector<std::shared_ptr<BlockSupplierSortCursorImpl>> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    SortingQueueBatch<MergeSortCursor> _priority_queue;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
     /// we make it as a pending cursor until the supplier is readable.
@@ -92,8 +92,6 @@ protected:
 
 private:
     void init_timers(RuntimeProfile* profile);
-    // If current stream is exhausted and not eof, we should break this loop and read more blocks.
-    bool _need_more_data(MergeSortCursor& current);
 };
 
 } // namespace doris::vectorized
@@ -170,13 +170,33 @@ Status VArrowFlightResultWriter::write(RuntimeState* state, Block& input_block)
     RETURN_IF_ERROR(VExprContext::get_output_block_after_execute_exprs(_output_vexpr_ctxs,
                                                                        input_block, &block));
 
+    // The caller clears and reuses the input block, leave it empty columns so that the output
+    // columns it shared are referenced by `block` only.
+    for (auto& elem : input_block) {
+        if (elem.column) {
+            elem.column = elem.column->clone_empty();
+        }
+    }
+
     {
+        auto* query_mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_sinker->mem_tracker());
-        std::unique_ptr<vectorized::MutableBlock> mutable_block =
-                vectorized::MutableBlock::create_unique(block.clone_empty());
-        RETURN_IF_ERROR(mutable_block->merge_ignore_overflow(std::move(block)));
+        // Move the columns into the result queue, a column is only copied when it is const or
+        // still referenced outside of this writer, the moved memory is charged to the buffer.
         std::shared_ptr<vectorized::Block> output_block = vectorized::Block::create_shared();
-        output_block->swap(mutable_block->to_block());
+        int64_t moved_bytes = 0;
+        for (auto& elem : block) {
+            bool is_const = is_column_const(*elem.column);
+            ColumnPtr column = std::move(elem.column);
+            column = column->convert_to_full_column_if_const();
+            const auto* origin_column = column.get();
+            auto mutable_column = (*std::move(column)).mutate();
+            if (!is_const && mutable_column.get() == origin_column) {
+                moved_bytes += mutable_column->allocated_bytes();
+            }
+            output_block->insert({std::move(mutable_column), elem.type, elem.name});
+        }
+        query_mem_tracker->transfer_to(moved_bytes, _sinker->mem_tracker().get());
 
         auto num_rows = output_block->rows();
         // arrow::RecordBatch without `nbytes()` in C++
@@ -26,6 +26,7 @@
 #include <gen_cpp/internal_service.pb.h>
 #include <glog/logging.h>
 #include <stddef.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <cstdint>
@@ -76,7 +77,13 @@ Status Channel::_init_brpc_stub(RuntimeState* state) {
     }
 
     auto network_address = _brpc_dest_addr;
-    if (_brpc_dest_addr.hostname == BackendOptions::get_localhost()) {
+    // A BE sharing the unix socket directory is on the same host, skip the TCP stack.
+    auto unix_socket_path = BackendOptions::get_brpc_unix_socket_path(_brpc_dest_addr.hostname,
+                                                                      _brpc_dest_addr.port);
+    if (!unix_socket_path.empty() && access(unix_socket_path.c_str(), F_OK) == 0) {
+        _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_unix_socket_client(
+                unix_socket_path);
+    } else if (_brpc_dest_addr.hostname == BackendOptions::get_localhost()) {
         _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_client(
                 "127.0.0.1", _brpc_dest_addr.port);
         network_address.hostname = "127.0.0.1";
@@ -334,9 +341,16 @@ Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t n
     SCOPED_TIMER(_parent->_serialize_batch_timer);
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    auto compression_type = _codec ? _codec->choose(_parent->compression_type())
+                                   : _parent->compression_type();
+    const int64_t compress_time_before = src->get_compress_time();
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, compression_type,
                                    _parent->transfer_large_data_by_brpc()));
+    if (_codec) {
+        _codec->update_compression(compression_type, uncompressed_bytes, compressed_bytes,
+                                   src->get_compress_time() - compress_time_before);
+    }
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -95,6 +95,9 @@ public:
 
     void set_low_memory_mode(RuntimeState* state) { _buffer_mem_limit = 4 * 1024 * 1024; }
 
+    // If set, the codec chooser of the destination overrides the compression type of the query.
+    void set_adaptive_codec(pipeline::AdaptiveTransmitCodec* codec) { _codec = codec; }
+
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
 
@@ -104,6 +107,7 @@ private:
     bool _is_local;
     const int _batch_size;
     std::atomic<size_t> _buffer_mem_limit = UINT64_MAX;
+    pipeline::AdaptiveTransmitCodec* _codec = nullptr;
 };
 
 class Channel {
@@ -146,6 +150,8 @@ public:
 
     bool is_receiver_eof() const { return _receiver_status.is<ErrorCode::END_OF_FILE>(); }
 
+    bool is_local_receiver_closed() const { return _local_recvr && _local_recvr->is_closed(); }
+
     void set_receiver_eof(Status st) { _receiver_status = st; }
 
     int64_t mem_usage() const;
@@ -161,7 +167,10 @@ public:
     Status add_rows(Block* block, const uint32_t* data, const uint32_t offset, const uint32_t size,
                     bool eos);
 
-    void set_exchange_buffer(pipeline::ExchangeSinkBuffer* buffer) { _buffer = buffer; }
+    void set_exchange_buffer(pipeline::ExchangeSinkBuffer* buffer) {
+        _buffer = buffer;
+        _serializer.set_adaptive_codec(buffer->adaptive_codec(dest_ins_id()));
+    }
 
     InstanceLoId dest_ins_id() const { return _fragment_instance_id.lo; }
 
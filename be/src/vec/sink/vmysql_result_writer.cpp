@@ -184,10 +184,6 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
     uint64_t bytes_sent = 0;
     {
         SCOPED_TIMER(_convert_tuple_timer);
-        MysqlRowBuffer<is_binary_format> row_buffer;
-        if constexpr (is_binary_format) {
-            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
-        }
 
         struct Arguments {
             const IColumn* column;
@@ -233,19 +229,54 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+        if constexpr (is_binary_format) {
+            MysqlRowBuffer<is_binary_format> row_buffer;
+            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                }
+
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                bytes_sent += row_buffer.length();
+                row_buffer.reset();
+                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            }
+        } else {
+            // Fields of a text protocol row are independent length encoded strings, so encode
+            // one column at a time into its own buffer, then assemble every row with a single
+            // allocation from the recorded field boundaries.
+            std::vector<MysqlRowBuffer<is_binary_format>> col_buffers(num_cols);
+            std::vector<std::vector<int64_t>> field_ends(num_cols);
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
+                auto& col_buffer = col_buffers[col_idx];
+                field_ends[col_idx].resize(num_rows);
+                for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), col_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                    field_ends[col_idx][row_idx] = col_buffer.length();
+                }
             }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
-                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                int64_t row_length = 0;
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    int64_t field_begin = row_idx == 0 ? 0 : field_ends[col_idx][row_idx - 1];
+                    row_length += field_ends[col_idx][row_idx] - field_begin;
+                }
+                // copy the fields of the row to Thrift
+                auto& row = result->result_batch.rows[row_idx];
+                row.reserve(row_length);
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    int64_t field_begin = row_idx == 0 ? 0 : field_ends[col_idx][row_idx - 1];
+                    row.append(col_buffers[col_idx].buf() + field_begin,
+                               field_ends[col_idx][row_idx] - field_begin);
+                }
+                bytes_sent += row_length;
             }
         }
     }
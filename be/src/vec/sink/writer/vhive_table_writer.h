@@ -64,7 +64,7 @@ private:
 
     std::string _compute_file_name();
 
-    Status _filter_block(doris::vectorized::Block& block, const vectorized::IColumn::Filter* filter,
+    Status _filter_block(doris::vectorized::Block& block, const std::vector<uint32_t>& rows,
                          doris::vectorized::Block* output_block);
 
     // Currently it is a copy, maybe it is better to use move semantics to eliminate it.
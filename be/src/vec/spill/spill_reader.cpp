@@ -28,6 +28,7 @@
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/slice.h"
+#include "vec/common/unaligned.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream_manager.h"
 namespace doris {
@@ -46,7 +47,7 @@ Status SpillReader::open() {
 
     COUNTER_UPDATE(_read_file_count, 1);
 
-    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(file_path_, &file_reader_));
+    RETURN_IF_ERROR(fs_->open_file(file_path_, &file_reader_));
 
     size_t file_size = file_reader_->size();
     DCHECK(file_size >= 16); // max_sub_block_size, block count
@@ -104,6 +105,47 @@ void SpillReader::seek(size_t block_index) {
     read_block_index_ = block_index;
 }
 
+Status SpillReader::_read_at(size_t offset, Slice result) {
+    size_t bytes_read = 0;
+    {
+        SCOPED_TIMER(_read_file_timer);
+        RETURN_IF_ERROR(file_reader_->read_at(offset, result, &bytes_read));
+    }
+    DCHECK(bytes_read == result.size);
+    COUNTER_UPDATE(_read_file_size, bytes_read);
+    ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
+    if (_resource_ctx) {
+        _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
+    }
+    return Status::OK();
+}
+
+Status SpillReader::_read_batch_at(const std::vector<io::FileReadRange>& ranges) {
+    size_t bytes_read = 0;
+    {
+        SCOPED_TIMER(_read_file_timer);
+        RETURN_IF_ERROR(file_reader_->read_at_batch(ranges, &bytes_read));
+    }
+    COUNTER_UPDATE(_read_file_size, bytes_read);
+    ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
+    if (_resource_ctx) {
+        _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
+    }
+    return Status::OK();
+}
+
+Status SpillReader::_deserialize_column(const char* data, size_t size, Block* block) {
+    SCOPED_TIMER(_deserialize_timer);
+    if (!pb_block_.ParseFromArray(data, cast_set<int>(size))) {
+        return Status::InternalError("Failed to read spilled block");
+    }
+    Block column_block;
+    RETURN_IF_ERROR(column_block.deserialize(pb_block_));
+    DCHECK_EQ(column_block.columns(), 1);
+    block->insert(std::move(column_block.get_by_position(0)));
+    return Status::OK();
+}
+
 Status SpillReader::read(Block* block, bool* eos) {
     DCHECK(file_reader_);
     block->clear_column_data();
@@ -113,42 +155,56 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    size_t bytes_to_read =
-            block_start_offsets_[read_block_index_ + 1] - block_start_offsets_[read_block_index_];
+    const size_t block_start = block_start_offsets_[read_block_index_];
+    const size_t bytes_to_read = block_start_offsets_[read_block_index_ + 1] - block_start;
 
     if (bytes_to_read == 0) {
         ++read_block_index_;
         return Status::OK();
     }
 
-    Slice result(read_buff_.data(), bytes_to_read);
-    size_t bytes_read = 0;
-    {
-        SCOPED_TIMER(_read_file_timer);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
-    }
-    DCHECK(bytes_read == bytes_to_read);
-
-    if (bytes_read > 0) {
-        COUNTER_UPDATE(_read_file_size, bytes_read);
-        ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
-        if (_resource_ctx) {
-            _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
+    // block format: column1, ..., columnn, column1 end offset, ..., columnn end offset, n
+    Block result;
+    if (read_column_ids_.empty()) {
+        char* data = read_buff_.data();
+        RETURN_IF_ERROR(_read_at(block_start, Slice(data, bytes_to_read)));
+        auto num_columns = unaligned_load<size_t>(data + bytes_to_read - sizeof(size_t));
+        const char* column_ends = data + bytes_to_read - (num_columns + 1) * sizeof(size_t);
+        size_t column_start = 0;
+        for (size_t i = 0; i < num_columns; ++i) {
+            auto column_end = unaligned_load<size_t>(column_ends + i * sizeof(size_t));
+            RETURN_IF_ERROR(
+                    _deserialize_column(data + column_start, column_end - column_start, &result));
+            column_start = column_end;
         }
-        COUNTER_UPDATE(_read_block_count, 1);
-        {
-            SCOPED_TIMER(_deserialize_timer);
-            if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
-                return Status::InternalError("Failed to read spilled block");
-            }
-            RETURN_IF_ERROR(block->deserialize(pb_block_));
-        }
-        COUNTER_UPDATE(_read_block_data_size, block->bytes());
-        COUNTER_UPDATE(_read_rows_count, block->rows());
     } else {
-        block->clear_column_data();
+        size_t num_columns = 0;
+        RETURN_IF_ERROR(_read_at(block_start + bytes_to_read - sizeof(size_t),
+                                 Slice((char*)&num_columns, sizeof(size_t))));
+        std::vector<size_t> column_ends(num_columns);
+        RETURN_IF_ERROR(_read_at(block_start + bytes_to_read - (num_columns + 1) * sizeof(size_t),
+                                 Slice((char*)column_ends.data(), num_columns * sizeof(size_t))));
+        // The selected columns are read in one batch, each into its own part of the buffer.
+        std::vector<io::FileReadRange> ranges;
+        ranges.reserve(read_column_ids_.size());
+        char* data = read_buff_.data();
+        for (auto column_id : read_column_ids_) {
+            DCHECK_LT(column_id, num_columns);
+            size_t column_start = column_id == 0 ? 0 : column_ends[column_id - 1];
+            size_t column_size = column_ends[column_id] - column_start;
+            ranges.push_back({block_start + column_start, Slice(data, column_size)});
+            data += column_size;
+        }
+        RETURN_IF_ERROR(_read_batch_at(ranges));
+        for (const auto& range : ranges) {
+            RETURN_IF_ERROR(_deserialize_column(range.result.data, range.result.size, &result));
+        }
     }
+    block->swap(result);
+
+    COUNTER_UPDATE(_read_block_count, 1);
+    COUNTER_UPDATE(_read_block_data_size, block->bytes());
+    COUNTER_UPDATE(_read_rows_count, block->rows());
 
     ++read_block_index_;
 
@@ -24,9 +24,12 @@
 #include <vector>
 
 #include "common/status.h"
+#include "io/fs/file_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/fs/file_system.h"
 #include "runtime/workload_management/resource_context.h"
 #include "util/runtime_profile.h"
+#include "util/slice.h"
 #include "vec/common/pod_array.h"
 #include "vec/common/pod_array_fwd.h"
 
@@ -36,9 +39,10 @@ class Block;
 class SpillReader {
 public:
     SpillReader(std::shared_ptr<ResourceContext> resource_context, int64_t stream_id,
-                std::string file_path)
+                std::string file_path, io::FileSystemSPtr fs)
             : stream_id_(stream_id),
               file_path_(std::move(file_path)),
+              fs_(std::move(fs)),
               _resource_ctx(std::move(resource_context)) {}
 
     ~SpillReader() { (void)close(); }
@@ -57,6 +61,11 @@ public:
 
     size_t block_count() const { return block_count_; }
 
+    // Only read the columns with these positions, in this order. Empty means all the columns.
+    void set_read_columns(std::vector<size_t> column_ids) {
+        read_column_ids_ = std::move(column_ids);
+    }
+
     void set_counters(RuntimeProfile* operator_profile) {
         RuntimeProfile* custom_profile = operator_profile->get_child("CustomCounters");
         DCHECK(custom_profile != nullptr);
@@ -70,8 +79,14 @@ public:
     }
 
 private:
+    Status _read_at(size_t offset, Slice result);
+    Status _read_batch_at(const std::vector<io::FileReadRange>& ranges);
+
+    Status _deserialize_column(const char* data, size_t size, Block* block);
+
     int64_t stream_id_;
     std::string file_path_;
+    io::FileSystemSPtr fs_;
     io::FileReaderSPtr file_reader_;
 
     size_t block_count_ = 0;
@@ -79,6 +94,7 @@ private:
     size_t max_sub_block_size_ = 0;
     PaddedPODArray<char> read_buff_;
     std::vector<size_t> block_start_offsets_;
+    std::vector<size_t> read_column_ids_;
 
     PBlock pb_block_;
 
@@ -23,6 +23,7 @@
 #include <mutex>
 #include <utility>
 
+#include "common/exception.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
@@ -39,10 +40,11 @@ namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 SpillStream::SpillStream(RuntimeState* state, int64_t stream_id, SpillDataDir* data_dir,
                          std::string spill_dir, size_t batch_rows, size_t batch_bytes,
-                         RuntimeProfile* operator_profile)
+                         RuntimeProfile* operator_profile, io::FileSystemSPtr fs)
         : state_(state),
           stream_id_(stream_id),
           data_dir_(data_dir),
+          fs_(fs ? std::move(fs) : io::FileSystemSPtr(io::global_local_filesystem())),
           spill_dir_(std::move(spill_dir)),
           batch_rows_(batch_rows),
           batch_bytes_(batch_bytes),
@@ -65,9 +67,35 @@ SpillStream::~SpillStream() {
 }
 
 void SpillStream::gc() {
+    _wait_read_ahead();
     if (_current_file_size) {
         COUNTER_UPDATE(_current_file_size, -total_written_bytes_);
     }
+    if (is_remote()) {
+        total_written_bytes_ = 0;
+        if (std::exchange(_remote_gc_submitted, true)) {
+            return;
+        }
+        if (_current_file_count) {
+            COUNTER_UPDATE(_current_file_count, -1);
+        }
+        // deleting the objects is slow, do not block the query
+        auto* thread_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+        auto status = thread_pool->submit_func([fs = fs_, spill_dir = spill_dir_]() {
+            auto st = fs->delete_directory(spill_dir);
+            if (!st.ok()) {
+                LOG_EVERY_T(WARNING, 1) << fmt::format(
+                        "failed to gc remote spill data, dir {}, error: {}", spill_dir,
+                        st.to_string());
+            }
+        });
+        if (!status.ok()) {
+            LOG_EVERY_T(WARNING, 1) << fmt::format(
+                    "failed to gc remote spill data, dir {}, error: {}", spill_dir_,
+                    status.to_string());
+        }
+        return;
+    }
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -100,11 +128,11 @@ void SpillStream::gc() {
 
 Status SpillStream::prepare() {
     writer_ = std::make_unique<SpillWriter>(state_->get_query_ctx()->resource_ctx(), profile_,
-                                            stream_id_, batch_rows_, data_dir_, spill_dir_);
+                                            stream_id_, batch_rows_, data_dir_, spill_dir_, fs_);
     _set_write_counters(profile_);
 
     reader_ = std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                            writer_->get_file_path());
+                                            writer_->get_file_path(), fs_);
 
     DBUG_EXECUTE_IF("fault_inject::spill_stream::prepare_spill", {
         return Status::Error<INTERNAL_ERROR>("fault_inject spill_stream prepare_spill failed");
@@ -118,7 +146,7 @@ Status SpillStream::prepare() {
 
 SpillReaderUPtr SpillStream::create_separate_reader() const {
     return std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                         writer_->get_file_path());
+                                         writer_->get_file_path(), fs_);
 }
 
 const TUniqueId& SpillStream::query_id() const {
@@ -170,4 +198,51 @@ Status SpillStream::read_next_block_sync(Block* block, bool* eos) {
     return reader_->read(block, eos);
 }
 
+Status SpillStream::read_next_block_with_read_ahead(Block* block, bool* eos) {
+    if (_read_ahead_future.valid()) {
+        RETURN_IF_ERROR(_read_ahead_future.get());
+        block->swap(*_read_ahead_block);
+        *eos = _read_ahead_eos;
+    } else {
+        // the first block, or the read ahead of this block could not be submitted
+        RETURN_IF_ERROR(read_next_block_sync(block, eos));
+    }
+    if (!*eos) {
+        _submit_read_ahead();
+    }
+    return Status::OK();
+}
+
+void SpillStream::_submit_read_ahead() {
+    auto* thread_pool =
+            ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_read_ahead_thread_pool();
+    if (thread_pool == nullptr) {
+        return;
+    }
+    if (!_read_ahead_block) {
+        _read_ahead_block = Block::create_unique();
+    }
+    auto promise = std::make_shared<std::promise<Status>>();
+    auto future = promise->get_future();
+    auto resource_ctx = state_->get_query_ctx()->resource_ctx();
+    auto st = thread_pool->submit_func([this, promise, resource_ctx]() {
+        SCOPED_ATTACH_TASK(resource_ctx);
+        auto status = [&]() {
+            RETURN_IF_CATCH_EXCEPTION(
+                    { return read_next_block_sync(_read_ahead_block.get(), &_read_ahead_eos); });
+        }();
+        promise->set_value(std::move(status));
+    });
+    // the next block is read synchronously if the pool is full
+    if (st.ok()) {
+        _read_ahead_future = std::move(future);
+    }
+}
+
+void SpillStream::_wait_read_ahead() {
+    if (_read_ahead_future.valid()) {
+        static_cast<void>(_read_ahead_future.get());
+    }
+}
+
 } // namespace doris::vectorized
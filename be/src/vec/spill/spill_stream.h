@@ -38,9 +38,10 @@ public:
     // to avoid too many small file writes
     static constexpr size_t MIN_SPILL_WRITE_BATCH_MEM = 32 * 1024;
     static constexpr size_t MAX_SPILL_WRITE_BATCH_MEM = 32 * 1024 * 1024;
+    // `data_dir` is nullptr if the stream is spilled to the remote storage `fs`.
     SpillStream(RuntimeState* state, int64_t stream_id, SpillDataDir* data_dir,
                 std::string spill_dir, size_t batch_rows, size_t batch_bytes,
-                RuntimeProfile* profile);
+                RuntimeProfile* profile, io::FileSystemSPtr fs = nullptr);
 
     SpillStream() = delete;
 
@@ -51,6 +52,8 @@ public:
     int64_t id() const { return stream_id_; }
 
     SpillDataDir* get_data_dir() const { return data_dir_; }
+
+    bool is_remote() const { return data_dir_ == nullptr; }
     const std::string& get_spill_root_dir() const;
 
     const std::string& get_spill_dir() const { return spill_dir_; }
@@ -63,6 +66,15 @@ public:
 
     Status read_next_block_sync(Block* block, bool* eos);
 
+    // Same as `read_next_block_sync`, and starts reading the block after it in the background, so
+    // that a merge of many streams does not wait on the disk for each stream in turn.
+    Status read_next_block_with_read_ahead(Block* block, bool* eos);
+
+    // Only read the columns with these positions from the spilled blocks.
+    void set_read_columns(std::vector<size_t> column_ids) {
+        reader_->set_read_columns(std::move(column_ids));
+    }
+
     void set_read_counters(RuntimeProfile* operator_profile) {
         reader_->set_counters(operator_profile);
     }
@@ -82,9 +94,14 @@ private:
 
     void _set_write_counters(RuntimeProfile* profile) { writer_->set_counters(profile); }
 
+    void _submit_read_ahead();
+
+    void _wait_read_ahead();
+
     RuntimeState* state_ = nullptr;
     int64_t stream_id_;
     SpillDataDir* data_dir_ = nullptr;
+    io::FileSystemSPtr fs_;
     // Directory path format specified in SpillStreamManager::register_spill_stream:
     // storage_root/spill/query_id/partitioned_hash_join-node_id-task_id-stream_id
     std::string spill_dir_;
@@ -94,10 +111,16 @@ private:
 
     std::atomic_bool _ready_for_reading = false;
     std::atomic_bool _is_reading = false;
+    bool _remote_gc_submitted = false;
 
     SpillWriterUPtr writer_;
     SpillReaderUPtr reader_;
 
+    // The block read in the background, the result is ready when `_read_ahead_future` is.
+    std::unique_ptr<Block> _read_ahead_block;
+    bool _read_ahead_eos = false;
+    std::future<Status> _read_ahead_future;
+
     TUniqueId query_id_;
 
     RuntimeProfile* profile_ = nullptr;
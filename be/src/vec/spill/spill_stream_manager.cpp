@@ -27,10 +27,13 @@
 #include <random>
 #include <string>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/doris_metrics.h"
 #include "util/parse_util.h"
@@ -83,6 +86,13 @@ Status SpillStreamManager::init() {
                               .set_max_threads(config::spill_io_thread_pool_thread_num)
                               .set_max_queue_size(config::spill_io_thread_pool_queue_size)
                               .build(&_spill_io_thread_pool));
+    if (config::spill_read_ahead_thread_pool_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("SpillReadAheadThreadPool")
+                                  .set_min_threads(1)
+                                  .set_max_threads(config::spill_read_ahead_thread_pool_thread_num)
+                                  .set_max_queue_size(config::spill_io_thread_pool_queue_size)
+                                  .build(&_spill_read_ahead_thread_pool));
+    }
 
     RETURN_IF_ERROR(Thread::create(
             "Spill", "spill_gc_thread", [this]() { this->_spill_gc_thread_callback(); },
@@ -150,6 +160,13 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
     return stores;
 }
 
+io::FileSystemSPtr SpillStreamManager::_get_remote_fs_for_spill() const {
+    if (!config::enable_spill_to_remote_storage || !config::is_cloud_mode()) {
+        return nullptr;
+    }
+    return ExecEnv::GetInstance()->storage_engine().to_cloud().latest_fs();
+}
+
 Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStreamSPtr& spill_stream,
                                                  const std::string& query_id,
                                                  const std::string& operator_name, int32_t node_id,
@@ -159,12 +176,23 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     if (data_dirs.empty()) {
         data_dirs = _get_stores_for_spill(TStorageMedium::type::HDD);
     }
+    uint64_t id = id_++;
     if (data_dirs.empty()) {
-        return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
-                "no available disk can be used for spill.");
+        auto remote_fs = _get_remote_fs_for_spill();
+        if (remote_fs == nullptr) {
+            return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
+                    "no available disk can be used for spill.");
+        }
+        // spill/query_id/instance_id/partitioned_hash_join-node_id-task_id-stream_id
+        auto spill_dir = fmt::format("spill/{}/{}/{}-{}-{}-{}", query_id,
+                                     print_id(state->fragment_instance_id()), operator_name,
+                                     node_id, state->task_id(), id);
+        spill_stream = std::make_shared<SpillStream>(state, id, nullptr, spill_dir, batch_rows,
+                                                     batch_bytes, operator_profile, remote_fs);
+        RETURN_IF_ERROR(spill_stream->prepare());
+        return Status::OK();
     }
 
-    uint64_t id = id_++;
     std::string spill_dir;
     SpillDataDir* data_dir = nullptr;
     for (auto& dir : data_dirs) {
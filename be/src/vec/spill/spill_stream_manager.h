@@ -126,6 +126,9 @@ public:
             _spill_gc_thread->join();
         }
         _spill_io_thread_pool->shutdown();
+        if (_spill_read_ahead_thread_pool) {
+            _spill_read_ahead_thread_pool->shutdown();
+        }
     }
 
     // 创建SpillStream并登记
@@ -143,6 +146,11 @@ public:
 
     ThreadPool* get_spill_io_thread_pool() const { return _spill_io_thread_pool.get(); }
 
+    // Reads the next blocks of the spill streams being merged, nullptr if read ahead is disabled.
+    ThreadPool* get_spill_read_ahead_thread_pool() const {
+        return _spill_read_ahead_thread_pool.get();
+    }
+
     void update_spill_write_bytes(int64_t bytes) { _spill_write_bytes_counter->increment(bytes); }
 
     void update_spill_read_bytes(int64_t bytes) { _spill_read_bytes_counter->increment(bytes); }
@@ -152,11 +160,14 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    // The remote storage the streams are spilled to when all the local spill dirs are full.
+    io::FileSystemSPtr _get_remote_fs_for_spill() const;
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
 
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
+    std::unique_ptr<ThreadPool> _spill_read_ahead_thread_pool;
     std::shared_ptr<Thread> _spill_gc_thread;
 
     std::atomic_uint64_t id_ = 0;
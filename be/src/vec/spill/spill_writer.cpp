@@ -24,6 +24,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
@@ -32,7 +33,7 @@ Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    return fs_->create_file(file_path_, &file_writer_);
 }
 
 Status SpillWriter::close() {
@@ -58,7 +59,9 @@ Status SpillWriter::close() {
     if (_write_file_current_size) {
         COUNTER_UPDATE(_write_file_current_size, meta_.size());
     }
-    data_dir_->update_spill_data_usage(meta_.size());
+    if (data_dir_) {
+        data_dir_->update_spill_data_usage(meta_.size());
+    }
     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(meta_.size());
 
     RETURN_IF_ERROR(file_writer_->close());
@@ -104,6 +107,18 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
     }
 }
 
+// Fixed length columns are compressed by LZ4 to keep reloading cheap, the variable length ones by
+// ZSTD for better compression ratio.
+static segment_v2::CompressionTypePB column_compression_type(const IDataType& type) {
+    auto primitive_type = type.get_primitive_type();
+    if (is_string_type(primitive_type) || is_complex_type(primitive_type) ||
+        is_var_len_object(primitive_type) || primitive_type == TYPE_VARIANT ||
+        primitive_type == TYPE_JSONB) {
+        return segment_v2::CompressionTypePB::ZSTD;
+    }
+    return segment_v2::CompressionTypePB::LZ4;
+}
+
 Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
 
@@ -113,25 +128,38 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
 
     if (block.rows() > 0) {
         {
-            PBlock pblock;
+            // block format: column1, column2, ..., columnn, column1 end offset, column2 end
+            // offset, ..., columnn end offset, n. Each column is a PBlock of one column, so that
+            // the columns are compressed separately and could be read separately.
             SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
-            RETURN_IF_ERROR(status);
-            int64_t pblock_mem = pblock.ByteSizeLong();
-            COUNTER_UPDATE(_memory_used_counter, pblock_mem);
-            Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
-            if (!pblock.SerializeToString(&buff)) {
-                return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
-                        "serialize spill data error. [path={}]", file_path_);
+            std::string column_ends;
+            for (size_t i = 0; i < block.columns(); ++i) {
+                const auto& column = block.get_by_position(i);
+                Block column_block {column};
+                PBlock pblock;
+                size_t column_uncompressed_bytes = 0, column_compressed_bytes = 0;
+                status = column_block.serialize(
+                        BeExecVersionManager::get_newest_version(), &pblock,
+                        &column_uncompressed_bytes, &column_compressed_bytes,
+                        column_compression_type(*remove_nullable(column.type)));
+                RETURN_IF_ERROR(status);
+                uncompressed_bytes += column_uncompressed_bytes;
+                compressed_bytes += column_compressed_bytes;
+                if (!pblock.AppendToString(&buff)) {
+                    return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
+                            "serialize spill data error. [path={}]", file_path_);
+                }
+                size_t column_end = buff.size();
+                column_ends.append((const char*)&column_end, sizeof(column_end));
             }
+            size_t num_columns = block.columns();
+            buff.append(column_ends);
+            buff.append((const char*)&num_columns, sizeof(num_columns));
             buff_size = buff.size();
             COUNTER_UPDATE(_memory_used_counter, buff_size);
             Defer defer2 {[&]() { COUNTER_UPDATE(_memory_used_counter, -buff_size); }};
         }
-        if (data_dir_->reach_capacity_limit(buff_size)) {
+        if (data_dir_ && data_dir_->reach_capacity_limit(buff_size)) {
             return Status::Error<ErrorCode::DISK_REACH_CAPACITY_LIMIT>(
                     "spill data total size exceed limit, path: {}, size limit: {}, spill data "
                     "size: {}",
@@ -143,7 +171,9 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
         {
             Defer defer {[&]() {
                 if (status.ok()) {
-                    data_dir_->update_spill_data_usage(buff_size);
+                    if (data_dir_) {
+                        data_dir_->update_spill_data_usage(buff_size);
+                    }
                     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(buff_size);
 
                     written_bytes += buff_size;
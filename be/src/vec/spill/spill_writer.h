@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 
+#include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
 #include "runtime/workload_management/resource_context.h"
 #include "util/runtime_profile.h"
@@ -34,8 +35,10 @@ class SpillDataDir;
 class SpillWriter {
 public:
     SpillWriter(std::shared_ptr<ResourceContext> resource_context, RuntimeProfile* profile,
-                int64_t id, size_t batch_size, SpillDataDir* data_dir, const std::string& dir)
+                int64_t id, size_t batch_size, SpillDataDir* data_dir, const std::string& dir,
+                io::FileSystemSPtr fs)
             : data_dir_(data_dir),
+              fs_(std::move(fs)),
               stream_id_(id),
               batch_size_(batch_size),
               _resource_ctx(std::move(resource_context)) {
@@ -75,7 +78,9 @@ private:
 
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
+    // nullptr if the file is on the remote storage.
     SpillDataDir* data_dir_ = nullptr;
+    io::FileSystemSPtr fs_;
     std::atomic_bool closed_ = false;
     int64_t stream_id_;
     size_t batch_size_;
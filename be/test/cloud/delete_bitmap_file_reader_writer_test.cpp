@@ -68,4 +68,32 @@ TEST_F(DeleteBitmapFileReaderWriterTest, TestWriteAndRead) {
         EXPECT_EQ(delete_bitmap_pb.segment_delete_bitmaps(i), dbm.segment_delete_bitmaps(i));
     }
 }
+
+TEST_F(DeleteBitmapFileReaderWriterTest, TestReadTruncatedFile) {
+    int64_t tablet_id = 43232;
+    std::string rowset_id = "432w1abc3";
+    std::optional<StorageResource> storage_resource_op;
+    DeleteBitmapPB delete_bitmap_pb;
+    delete_bitmap_pb.add_rowset_ids("rowset_id_0");
+    delete_bitmap_pb.add_segment_ids(0);
+    delete_bitmap_pb.add_versions(0);
+    delete_bitmap_pb.add_segment_delete_bitmaps("bitmap.val_0");
+
+    DeleteBitmapFileWriter writer(tablet_id, rowset_id, storage_resource_op);
+    EXPECT_TRUE(writer.init().ok());
+    EXPECT_TRUE(writer.write(delete_bitmap_pb).ok());
+    EXPECT_TRUE(writer.close().ok());
+
+    std::string path = "./log/" + rowset_id + "_delete_bitmap.dat";
+    auto file_size = std::filesystem::file_size(path);
+    // Truncated in the delete bitmap, in the checksum and in the header
+    for (auto truncated_size : {file_size - 6, file_size - 1, uint64_t {8}}) {
+        std::filesystem::resize_file(path, truncated_size);
+        DeleteBitmapFileReader reader(tablet_id, rowset_id, storage_resource_op);
+        EXPECT_TRUE(reader.init().ok());
+        DeleteBitmapPB dbm;
+        EXPECT_FALSE(reader.read(dbm).ok()) << truncated_size;
+        EXPECT_TRUE(reader.close().ok());
+    }
+}
 } // namespace doris
\ No newline at end of file
@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -297,4 +298,28 @@ TEST_F(SpaceSavingTest, test_space_saving_string_keys) {
     }
 }
 
+TEST_F(SpaceSavingTest, test_space_saving_insert_batch) {
+    SpaceSaving<int32_t> space_saving(256);
+    std::unordered_map<int32_t, int32_t> count_map;
+
+    std::vector<int32_t> datas;
+    for (int32_t i = 0; i < 10000; ++i) {
+        datas.emplace_back(i % 100);
+        count_map[i % 100]++;
+    }
+
+    // insert in several batches, keys repeat both within and across batches
+    for (size_t begin = 0; begin < datas.size(); begin += 4096) {
+        size_t batch_size = std::min<size_t>(4096, datas.size() - begin);
+        space_saving.insert_batch(datas.data() + begin, batch_size);
+    }
+
+    auto counts = space_saving.top_k(256);
+    EXPECT_EQ(counts.size(), 100U);
+    for (auto& iter : counts) {
+        EXPECT_EQ(iter.count, count_map[iter.key]);
+        EXPECT_EQ(iter.error, 0);
+    }
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "testutil/column_helper.h"
 #include "vec/common/columns_hashing.h"
 #include "vec/common/hash_table/hash.h"
@@ -127,4 +130,36 @@ TEST(HashTableMethodTest, testMethodStringNoCache) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodStringNoCacheKeySizes) {
+    MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>> method;
+
+    // Keys of every sub table: empty, up to 2, 4, 8, 16 and 24 bytes inline, and longer ones.
+    std::vector<std::string> keys = {"",
+                                     "a",
+                                     "abc",
+                                     "abcdefg",
+                                     "abcdefghijklmno",
+                                     "abcdefghijklmnopq",
+                                     "abcdefghijklmnopqrstuvwx",
+                                     "abcdefghijklmnopqrstuvwxy",
+                                     std::string("abcdefghijklmnopqrst\0", 21)};
+    test_insert(method, {ColumnHelper::create_column<DataTypeString>(keys)});
+    EXPECT_EQ(method.hash_table->size(), keys.size());
+
+    std::vector<int64_t> expected;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        expected.push_back(i);
+    }
+    test_find(method, {ColumnHelper::create_column<DataTypeString>(keys)}, expected);
+
+    test_find(method,
+              {ColumnHelper::create_column<DataTypeString>(
+                      {"abcdefghijklmnopqrstuvwX", "abcdefghijklmnopqrstuvw", "abcdefghijklmnopq"})},
+              {-1, -1, 5});
+
+    size_t num_mapped = 0;
+    method.hash_table->for_each_mapped([&](auto& mapped) { ++num_mapped; });
+    EXPECT_EQ(num_mapped, keys.size());
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -20,11 +20,14 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exprs/block_bloom_filter.hpp"
 #include "exprs/create_predicate_function.h"
 #include "gtest/gtest.h"
 #include "runtime/define_primitive_type.h"
@@ -608,4 +611,28 @@ TEST_F(BloomFilterFuncTest, FindFixedLenOlapEngine) {
     ASSERT_EQ(offsets2[1], 3);
 }
 
+TEST_F(BloomFilterFuncTest, FindBatch) {
+    BlockBloomFilter bloom_filter;
+    ASSERT_TRUE(bloom_filter.init(12, 0));
+    std::vector<uint32_t> hashes(3000);
+    std::vector<uint8_t> results(hashes.size());
+    // an empty filter finds nothing
+    bloom_filter.find_batch(hashes.data(), hashes.size(), results.data());
+    ASSERT_EQ(std::count(results.begin(), results.end(), 1), 0);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        bloom_filter.insert(i * 3);
+    }
+    for (uint32_t i = 0; i < hashes.size(); ++i) {
+        hashes[i] = i;
+    }
+    bloom_filter.find_batch(hashes.data(), hashes.size(), results.data());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        ASSERT_EQ(results[i] != 0, bloom_filter.find(hashes[i])) << i;
+        if (i % 3 == 0) {
+            ASSERT_TRUE(results[i]) << i;
+        }
+    }
+}
+
 } // namespace doris
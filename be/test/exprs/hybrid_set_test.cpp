@@ -19,8 +19,10 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "exprs/create_predicate_function.h"
@@ -283,6 +285,38 @@ TEST_F(HybridSetTest, int) {
     a = 5;
     EXPECT_FALSE(set->find(&a));
 }
+TEST_F(HybridSetTest, dense_int) {
+    std::unique_ptr<HybridSetBase> set(create_set(PrimitiveType::TYPE_INT, false));
+    // dense values around zero are looked up through the bitmap
+    for (int32_t a = -50; a <= 50; a += 2) {
+        set->insert(&a);
+    }
+    for (int32_t a = -60; a <= 60; ++a) {
+        EXPECT_EQ(set->find(&a), a >= -50 && a <= 50 && a % 2 == 0) << a;
+    }
+    auto* hybrid_set = static_cast<HybridSet<PrimitiveType::TYPE_INT>*>(set.get());
+    EXPECT_NE(hybrid_set->_dense_bitmap, nullptr);
+
+    auto column = vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(
+            {-52, -50, -1, 0, 50, 51, std::numeric_limits<int32_t>::min()});
+    auto result_column = vectorized::ColumnUInt8::create(column->size(), 0);
+    set->find_batch(*column, column->size(), result_column->get_data());
+    std::vector<uint8_t> expected {0, 1, 0, 1, 1, 0, 0};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(result_column->get_data()[i], expected[i]) << i;
+    }
+
+    // a sparse value makes the set fall back to hashing
+    int32_t sparse = std::numeric_limits<int32_t>::max();
+    set->insert(&sparse);
+    EXPECT_TRUE(set->find(&sparse));
+    EXPECT_EQ(hybrid_set->_dense_bitmap, nullptr);
+    int32_t a = 10;
+    EXPECT_TRUE(set->find(&a));
+    a = 11;
+    EXPECT_FALSE(set->find(&a));
+}
+
 TEST_F(HybridSetTest, bigint) {
     std::unique_ptr<HybridSetBase> set(create_set(PrimitiveType::TYPE_BIGINT, false));
     int64_t a = 0;
@@ -22,6 +22,9 @@
 
 #include <memory>
 
+#include "runtime/exec_env.h"
+#include "util/obj_lru_cache.h"
+
 namespace doris {
 
 class StringFunctionsTest : public ::testing::Test {
@@ -121,4 +124,58 @@ TEST_F(StringFunctionsTest, TestCompileRegex) {
     EXPECT_TRUE(re->options().dot_nl());
 }
 
+TEST_F(StringFunctionsTest, TestCompileRegexCached) {
+    std::string error_str;
+    auto* exec_env = ExecEnv::GetInstance();
+    auto* old_cache = exec_env->_regexp_cache;
+
+    // without the cache the caller owns the compiled regex
+    exec_env->_regexp_cache = nullptr;
+    {
+        ObjLRUCache::CacheHandle handle;
+        std::unique_ptr<re2::RE2> scoped_re;
+        const auto* re = StringFunctions::compile_regex_cached(create_string_ref("a+b"),
+                                                               &error_str, StringRef(), &handle,
+                                                               scoped_re);
+        ASSERT_NE(re, nullptr);
+        EXPECT_EQ(re, scoped_re.get());
+        EXPECT_FALSE(handle.valid());
+    }
+
+    ObjLRUCache cache(CachePolicy::CacheType::REGEXP_CACHE, 10);
+    exec_env->_regexp_cache = &cache;
+    const re2::RE2* first = nullptr;
+    {
+        ObjLRUCache::CacheHandle handle;
+        std::unique_ptr<re2::RE2> scoped_re;
+        first = StringFunctions::compile_regex_cached(create_string_ref("a+b"), &error_str,
+                                                      StringRef(), &handle, scoped_re);
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(scoped_re, nullptr);
+        EXPECT_TRUE(handle.valid());
+    }
+    {
+        // the same pattern is served from the cache, options are part of the key
+        ObjLRUCache::CacheHandle handle;
+        std::unique_ptr<re2::RE2> scoped_re;
+        EXPECT_EQ(StringFunctions::compile_regex_cached(create_string_ref("a+b"), &error_str,
+                                                        StringRef(), &handle, scoped_re),
+                  first);
+        ObjLRUCache::CacheHandle other_handle;
+        EXPECT_NE(StringFunctions::compile_regex_cached(
+                          create_string_ref("a+b"), &error_str,
+                          create_string_ref("ignore_invalid_escape"), &other_handle, scoped_re),
+                  first);
+    }
+    {
+        ObjLRUCache::CacheHandle handle;
+        std::unique_ptr<re2::RE2> scoped_re;
+        EXPECT_EQ(StringFunctions::compile_regex_cached(create_string_ref("(a"), &error_str,
+                                                        StringRef(), &handle, scoped_re),
+                  nullptr);
+        EXPECT_FALSE(handle.valid());
+    }
+    exec_env->_regexp_cache = old_cache;
+}
+
 } // namespace doris
\ No newline at end of file
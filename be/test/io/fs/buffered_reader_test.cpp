@@ -341,6 +341,32 @@ TEST_F(BufferedReaderTest, test_read_amplify) {
     EXPECT_EQ(merge_reader.statistics().merged_bytes, 1024 * kb + 12 * kb);
 }
 
+TEST_F(BufferedReaderTest, test_ranges_prefetch_reader_merge) {
+    size_t kb = 1024;
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(2048 * kb); // 2MB
+    std::vector<io::PrefetchRange> ranges;
+    ranges.emplace_back(0, 1 * kb);
+    ranges.emplace_back(2 * kb, 4 * kb);     // merged with the former, gap is 1KB
+    ranges.emplace_back(10 * kb, 20 * kb);   // not merged, gap is 6KB
+    ranges.emplace_back(20 * kb, 30 * kb);   // merged with the former
+    ranges.emplace_back(100 * kb, 200 * kb); // exceed the max bytes
+
+    io::RangesPrefetchReader prefetch_reader(nullptr, offset_reader, ranges, 1 * kb, 64 * kb);
+    const auto& merged = prefetch_reader.prefetch_ranges();
+    ASSERT_EQ(merged.size(), 2);
+    EXPECT_EQ(merged[0], io::PrefetchRange(0, 4 * kb));
+    EXPECT_EQ(merged[1], io::PrefetchRange(10 * kb, 30 * kb));
+
+    // not prefetched, read from the underlying reader
+    std::vector<char> data(1 * kb);
+    size_t bytes_read = 0;
+    ASSERT_TRUE(prefetch_reader.read_at(150 * kb, Slice(data.data(), 1 * kb), &bytes_read, nullptr)
+                        .ok());
+    EXPECT_EQ(bytes_read, 1 * kb);
+    EXPECT_EQ(data[0], (char)((150 * kb) % UCHAR_MAX));
+    EXPECT_TRUE(prefetch_reader.close().ok());
+}
+
 TEST_F(BufferedReaderTest, test_merged_io) {
     io::FileReaderSPtr offset_reader =
             std::make_shared<MockOffsetFileReader>(128 * 1024 * 1024); // 128MB
@@ -29,6 +29,7 @@
 #include <filesystem>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
@@ -385,6 +386,47 @@ TEST_F(LocalFileSystemTest, AbnormalWriteRead) {
     EXPECT_EQ(std::string_view(buf, 26), "abcdefghijklmnopqrstuvwxyz");
 }
 
+TEST_F(LocalFileSystemTest, ReadAtBatch) {
+    auto fname = fmt::format("{}/batch", test_dir);
+    std::string content;
+    for (int i = 0; i < 10000; ++i) {
+        content.push_back(static_cast<char>(i % 127));
+    }
+    ASSERT_TRUE(save_string_file(fname, content).ok());
+
+    io::FileReaderSPtr file_reader;
+    auto st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+
+    auto origin = config::enable_local_io_uring;
+    // With io_uring if the kernel supports it, and with pread.
+    for (bool enable_io_uring : {true, false}) {
+        config::enable_local_io_uring = enable_io_uring;
+        std::vector<char> buf(content.size());
+        std::vector<io::FileReadRange> ranges;
+        size_t buf_offset = 0;
+        // More ranges than the queue depth, so that they are submitted in several batches.
+        for (size_t offset = 7; offset + 50 <= content.size(); offset += 97) {
+            ranges.push_back({offset, Slice(buf.data() + buf_offset, 50)});
+            buf_offset += 50;
+        }
+        size_t bytes_read = 0;
+        st = file_reader->read_at_batch(ranges, &bytes_read);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(bytes_read, buf_offset);
+        for (const auto& range : ranges) {
+            EXPECT_EQ(range.result.to_string(), content.substr(range.offset, 50));
+        }
+
+        std::vector<io::FileReadRange> out_of_file {{content.size() - 10, Slice(buf.data(), 20)},
+                                                    {0, Slice(buf.data() + 20, 20)}};
+        st = file_reader->read_at_batch(out_of_file, &bytes_read);
+        EXPECT_FALSE(st.ok());
+    }
+    config::enable_local_io_uring = origin;
+    ASSERT_TRUE(file_reader->close().ok());
+}
+
 TEST_F(LocalFileSystemTest, TestGlob) {
     std::string path = "./be/ut_build_ASAN/test/file_path/";
     EXPECT_TRUE(io::global_local_filesystem()->delete_directory(path).ok());
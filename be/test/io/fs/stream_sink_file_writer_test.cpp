@@ -20,6 +20,11 @@
 #include <brpc/channel.h>
 #include <brpc/server.h>
 
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
 #include "util/debug/leakcheck_disabler.h"
@@ -46,7 +51,14 @@ constexpr int32_t SEGMENT_ID = 4567;
 const std::string DATA0 = "segment data";
 const std::string DATA1 = "hello world";
 
-static std::atomic<int64_t> g_num_request;
+struct AppendDataRequest {
+    uint64_t offset;
+    std::string data;
+    bool segment_eos;
+};
+
+static std::mutex g_requests_lock;
+static std::vector<AppendDataRequest> g_requests;
 
 class StreamSinkFileWriterTest : public testing::Test {
     class MockStreamStub : public LoadStreamStub {
@@ -66,16 +78,12 @@ class StreamSinkFileWriterTest : public testing::Test {
             EXPECT_EQ(INDEX_ID, index_id);
             EXPECT_EQ(TABLET_ID, tablet_id);
             EXPECT_EQ(SEGMENT_ID, segment_id);
-            if (segment_eos) {
-                EXPECT_EQ(0, data.size());
-                EXPECT_EQ(DATA0.length() + DATA1.length(), offset);
-            } else {
-                EXPECT_EQ(2, data.size());
-                EXPECT_EQ(DATA0, data[0].to_string());
-                EXPECT_EQ(DATA1, data[1].to_string());
-                EXPECT_EQ(0, offset);
+            std::string buf;
+            for (const auto& slice : data) {
+                buf.append(slice.get_data(), slice.get_size());
             }
-            g_num_request++;
+            std::lock_guard lock(g_requests_lock);
+            g_requests.push_back({offset, std::move(buf), segment_eos});
             return Status::OK();
         }
     };
@@ -100,15 +108,54 @@ protected:
 };
 
 TEST_F(StreamSinkFileWriterTest, Test) {
-    g_num_request = 0;
+    config::stream_sink_file_writer_buffer_bytes = 0;
+    g_requests.clear();
+    io::StreamSinkFileWriter writer(_streams);
+    writer.init(_load_id, PARTITION_ID, INDEX_ID, TABLET_ID, SEGMENT_ID);
+    std::vector<Slice> slices {DATA0, DATA1};
+
+    CHECK_STATUS_OK(writer.appendv(&(*slices.begin()), slices.size()));
+    EXPECT_EQ(NUM_STREAM, g_requests.size());
+    CHECK_STATUS_OK(writer.close());
+    EXPECT_EQ(NUM_STREAM * 2, g_requests.size());
+    for (int i = 0; i < NUM_STREAM; i++) {
+        EXPECT_EQ(0, g_requests[i].offset);
+        EXPECT_EQ(DATA0 + DATA1, g_requests[i].data);
+        EXPECT_FALSE(g_requests[i].segment_eos);
+        EXPECT_EQ(DATA0.length() + DATA1.length(), g_requests[NUM_STREAM + i].offset);
+        EXPECT_TRUE(g_requests[NUM_STREAM + i].data.empty());
+        EXPECT_TRUE(g_requests[NUM_STREAM + i].segment_eos);
+    }
+    config::stream_sink_file_writer_buffer_bytes = 65536;
+}
+
+TEST_F(StreamSinkFileWriterTest, BufferSmallAppends) {
+    config::stream_sink_file_writer_buffer_bytes = (DATA0.length() + DATA1.length()) * 2;
+    g_requests.clear();
     io::StreamSinkFileWriter writer(_streams);
     writer.init(_load_id, PARTITION_ID, INDEX_ID, TABLET_ID, SEGMENT_ID);
     std::vector<Slice> slices {DATA0, DATA1};
 
+    // buffered until the buffer is full
+    CHECK_STATUS_OK(writer.appendv(&(*slices.begin()), slices.size()));
+    EXPECT_EQ(0, g_requests.size());
+    EXPECT_EQ(DATA0.length() + DATA1.length(), writer.bytes_appended());
     CHECK_STATUS_OK(writer.appendv(&(*slices.begin()), slices.size()));
-    EXPECT_EQ(NUM_STREAM, g_num_request);
+    EXPECT_EQ(NUM_STREAM, g_requests.size());
+    // the rest is sent with the segment eos
+    CHECK_STATUS_OK(writer.appendv(&(*slices.begin()), 1));
+    EXPECT_EQ(NUM_STREAM, g_requests.size());
     CHECK_STATUS_OK(writer.close());
-    EXPECT_EQ(NUM_STREAM * 2, g_num_request);
+    EXPECT_EQ(NUM_STREAM * 2, g_requests.size());
+    for (int i = 0; i < NUM_STREAM; i++) {
+        EXPECT_EQ(0, g_requests[i].offset);
+        EXPECT_EQ(DATA0 + DATA1 + DATA0 + DATA1, g_requests[i].data);
+        EXPECT_FALSE(g_requests[i].segment_eos);
+        EXPECT_EQ((DATA0.length() + DATA1.length()) * 2, g_requests[NUM_STREAM + i].offset);
+        EXPECT_EQ(DATA0, g_requests[NUM_STREAM + i].data);
+        EXPECT_TRUE(g_requests[NUM_STREAM + i].segment_eos);
+    }
+    config::stream_sink_file_writer_buffer_bytes = 65536;
 }
 
 } // namespace doris
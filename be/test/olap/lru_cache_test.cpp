@@ -22,14 +22,17 @@
 #include <gtest/gtest-test-part.h>
 
 #include <iosfwd>
+#include <thread>
 #include <vector>
 
+#include "common/config.h"
 #include "gtest/gtest.h"
 #include "gtest/gtest_pred_impl.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "testutil/test_util.h"
+#include "util/defer_op.h"
 
 using namespace doris;
 using namespace std;
@@ -339,7 +342,7 @@ TEST_F(CacheTest, Usage) {
 }
 
 TEST_F(CacheTest, UsageLRUK) {
-    LRUCache cache(LRUCacheType::SIZE, true);
+    LRUCache cache(LRUCacheType::SIZE, LRUCacheEvictionPolicy::LRU_K);
     cache.set_capacity(1050);
 
     // The lru usage is handle_size + charge.
@@ -562,6 +565,188 @@ TEST_F(CacheTest, Number) {
     EXPECT_EQ(0, cache.get_usage());
 }
 
+TEST_F(CacheTest, FrequencySketch) {
+    FrequencySketch sketch;
+    EXPECT_EQ(0, sketch.frequency(1));
+    sketch.increment(1); // not sized yet, ignored
+    EXPECT_EQ(0, sketch.frequency(1));
+
+    sketch.ensure_capacity(64);
+    ASSERT_EQ(64, sketch._table.size());
+    for (int i = 0; i < 3; ++i) {
+        sketch.increment(1);
+    }
+    EXPECT_GE(sketch.frequency(1), 3);
+    // the counters saturate at 15
+    for (int i = 0; i < 20; ++i) {
+        sketch.increment(2);
+    }
+    EXPECT_EQ(15, sketch.frequency(2));
+    EXPECT_LT(sketch.frequency(1), sketch.frequency(2));
+
+    // the aging halves all the counters
+    sketch._reset();
+    EXPECT_EQ(7, sketch.frequency(2));
+    EXPECT_GE(sketch.frequency(1), 1);
+    EXPECT_LE(sketch.frequency(1), 7);
+
+    // a smaller capacity keeps the table
+    sketch.ensure_capacity(16);
+    EXPECT_EQ(64, sketch._table.size());
+    EXPECT_EQ(7, sketch.frequency(2));
+}
+
+TEST_F(CacheTest, TinyLFU) {
+    LRUCache cache(LRUCacheType::NUMBER, LRUCacheEvictionPolicy::TINY_LFU);
+    cache.set_capacity(10);
+
+    auto lookup = [&](const CacheKey& key) {
+        auto* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        if (handle != nullptr) {
+            cache.release(handle);
+        }
+        return handle != nullptr;
+    };
+    auto get_or_insert = [&](const CacheKey& key) {
+        if (!lookup(key)) {
+            insert_number_LRUCache(cache, key, 0, 1, CachePriority::NORMAL);
+        }
+    };
+
+    // the hot keys are hit after their insertion, so they leave the probation list
+    std::vector<std::string> hot_keys;
+    for (int i = 0; i < 5; ++i) {
+        hot_keys.push_back("hot_" + std::to_string(i));
+        get_or_insert(CacheKey(hot_keys.back()));
+        EXPECT_TRUE(lookup(CacheKey(hot_keys.back())));
+        EXPECT_TRUE(lookup(CacheKey(hot_keys.back())));
+    }
+    EXPECT_EQ(5, cache.get_usage());
+
+    // a scan of keys accessed once only replaces the entries in probation
+    for (int i = 0; i < 100; ++i) {
+        get_or_insert(CacheKey("scan_" + std::to_string(i)));
+    }
+    EXPECT_EQ(10, cache.get_usage());
+    for (const auto& key : hot_keys) {
+        EXPECT_TRUE(lookup(CacheKey(key)));
+    }
+    EXPECT_EQ(0, cache.get_rejected_count());
+
+    // drop the probation list, the cache is full of hot entries
+    cache.set_capacity(5);
+    EXPECT_EQ(5, cache.get_usage());
+    for (int i = 0; i < 3; ++i) {
+        for (const auto& key : hot_keys) {
+            EXPECT_TRUE(lookup(CacheKey(key)));
+        }
+    }
+
+    // a new key is not admitted until it is as frequent as the hot entries
+    CacheKey new_key("new");
+    get_or_insert(new_key);
+    EXPECT_EQ(1, cache.get_rejected_count());
+    EXPECT_EQ(5, cache.get_usage());
+    EXPECT_FALSE(lookup(new_key));
+
+    int attempts = 0;
+    while (!lookup(new_key) && attempts < 20) {
+        insert_number_LRUCache(cache, new_key, 0, 1, CachePriority::NORMAL);
+        ++attempts;
+    }
+    EXPECT_LT(attempts, 20);
+    EXPECT_GT(cache.get_rejected_count(), 1);
+    EXPECT_EQ(5, cache.get_usage());
+}
+
+TEST_F(CacheTest, LazyRecency) {
+    bool lazy_recency = config::enable_lru_cache_lazy_recency;
+    config::enable_lru_cache_lazy_recency = true;
+    Defer defer {[&]() { config::enable_lru_cache_lazy_recency = lazy_recency; }};
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(3);
+
+    auto lookup = [&](const CacheKey& key) {
+        return cache.lookup(key, key.hash(key.data(), key.size(), 0));
+    };
+    CacheKey key1("1");
+    CacheKey key2("2");
+    CacheKey key3("3");
+    CacheKey key4("4");
+    CacheKey key5("5");
+    insert_number_LRUCache(cache, key1, 1, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key2, 2, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key3, 3, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+
+    // key1 is visited, it gets a second chance and key2 is evicted
+    cache.release(lookup(key1));
+    insert_number_LRUCache(cache, key4, 4, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_EQ(nullptr, lookup(key2));
+
+    // key3 is referenced, it is skipped and key1 is evicted
+    auto* handle3 = lookup(key3);
+    ASSERT_NE(nullptr, handle3);
+    insert_number_LRUCache(cache, key5, 5, 1, CachePriority::NORMAL);
+    cache.release(handle3);
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_EQ(3, cache.get_element_count());
+    EXPECT_EQ(nullptr, lookup(key1));
+
+    // an entry erased while referenced is freed by its last release
+    auto* handle5 = lookup(key5);
+    ASSERT_NE(nullptr, handle5);
+    cache.erase(key5, key5.hash(key5.data(), key5.size(), 0));
+    EXPECT_EQ(2, cache.get_usage());
+    EXPECT_EQ(nullptr, lookup(key5));
+    cache.release(handle5);
+
+    // prune keeps the referenced entries
+    auto* handle4 = lookup(key4);
+    ASSERT_NE(nullptr, handle4);
+    EXPECT_EQ(1, cache.prune().pruned_count);
+    EXPECT_EQ(1, cache.get_usage());
+    cache.release(handle4);
+    EXPECT_EQ(1, cache.prune().pruned_count);
+    EXPECT_EQ(0, cache.get_usage());
+
+    EXPECT_EQ(cache.get_lookup_count(), cache.get_hit_count() + cache.get_miss_count());
+}
+
+TEST_F(CacheTest, LazyRecencyConcurrent) {
+    bool lazy_recency = config::enable_lru_cache_lazy_recency;
+    config::enable_lru_cache_lazy_recency = true;
+    Defer defer {[&]() { config::enable_lru_cache_lazy_recency = lazy_recency; }};
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(32);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t]() {
+            for (int i = 0; i < 10000; ++i) {
+                CacheKey key(std::to_string((i * 7 + t) % 64));
+                uint32_t hash = key.hash(key.data(), key.size(), 0);
+                auto* handle = cache.lookup(key, hash);
+                if (handle == nullptr) {
+                    auto* value = new CacheTest::CacheValue(EncodeValue(i));
+                    handle = cache.insert(key, hash, value, 1, CachePriority::NORMAL);
+                }
+                cache.release(handle);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(cache.get_usage(), 32);
+    EXPECT_EQ(cache.get_usage(), cache.get_element_count());
+    EXPECT_EQ(40000, cache.get_lookup_count());
+    EXPECT_EQ(cache.get_lookup_count(), cache.get_hit_count() + cache.get_miss_count());
+    cache.prune();
+    EXPECT_EQ(0, cache.get_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     init_size_cache();
     // Add a bunch of light and heavy entries and then count the combined
@@ -20,6 +20,10 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "gtest/gtest_pred_impl.h"
 
 namespace doris {
@@ -286,4 +290,66 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+// Half of the data page cache is allocated to the compressed tier
+TEST_F(StoragePageCacheTest, compressed_data_page) {
+    StoragePageCache cache(kNumShards * 8192, 0, 0, kNumShards, 50);
+    EXPECT_TRUE(cache.has_compressed_tier(segment_v2::DATA_PAGE));
+    EXPECT_FALSE(cache.has_compressed_tier(segment_v2::INDEX_PAGE));
+
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+    {
+        PageCacheHandle handle;
+        EXPECT_FALSE(cache.lookup_compressed(key, &handle, page_type));
+        EXPECT_FALSE(cache.lookup_compressed(key, &handle, segment_v2::INDEX_PAGE));
+    }
+
+    auto* data = new DataPage(1024, true, page_type);
+    data->reset_size(1000);
+    cache.insert_compressed(key, data, page_type);
+    {
+        PageCacheHandle handle;
+        EXPECT_TRUE(cache.lookup_compressed(key, &handle, page_type));
+        EXPECT_EQ(data->data(), handle.data().data);
+        EXPECT_EQ(1000, handle.data().size);
+        // the tiers are separated
+        EXPECT_FALSE(cache.lookup(key, &handle, page_type));
+    }
+
+    // the compressed tier is disabled by default
+    StoragePageCache no_compressed_cache(kNumShards * 2048, 0, 0, kNumShards);
+    EXPECT_FALSE(no_compressed_cache.has_compressed_tier(page_type));
+}
+
+TEST_F(StoragePageCacheTest, single_flight_load) {
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+
+    EXPECT_TRUE(cache.begin_load(key));
+    // other pages are not blocked by the page being loaded
+    EXPECT_TRUE(cache.begin_load(StoragePageCache::CacheKey("abc", 0, 1)));
+    cache.finish_load(StoragePageCache::CacheKey("abc", 0, 1));
+
+    std::atomic<bool> waiter_done = false;
+    bool waiter_loads = true;
+    std::thread waiter([&]() {
+        waiter_loads = cache.begin_load(key);
+        waiter_done = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(waiter_done);
+
+    auto* data = new DataPage(1024, true, page_type);
+    PageCacheHandle handle;
+    cache.insert(key, data, &handle, page_type);
+    cache.finish_load(key);
+    waiter.join();
+    EXPECT_FALSE(waiter_loads);
+
+    // the page is not being loaded anymore
+    EXPECT_TRUE(cache.begin_load(key));
+    cache.finish_load(key);
+}
+
 } // namespace doris
@@ -17,6 +17,7 @@
 
 #include "olap/primary_key_index.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
@@ -253,6 +254,58 @@ TEST_F(PrimaryKeyIndexTest, multiple_pages) {
     }
 }
 
+TEST_F(PrimaryKeyIndexTest, reuse_iterator_across_pages) {
+    std::string filename = kTestDir + "/reuse_iterator_across_pages";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+
+    config::primary_key_data_page_size = 5 * 5;
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 0, 0);
+    static_cast<void>(builder.init());
+    std::vector<std::string> keys;
+    for (int i = 0; i < 40; i += 2) {
+        keys.push_back(fmt::format("{:05d}", i));
+        static_cast<void>(builder.add_item(keys.back()));
+    }
+    EXPECT_GT(builder.data_page_num(), 2);
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+
+    PrimaryKeyIndexReader index_reader;
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta, nullptr).ok());
+
+    // one iterator serves every lookup, in ascending order first and then in reverse
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+    auto check = [&](int i) {
+        std::string key = fmt::format("{:05d}", i);
+        Slice slice(key);
+        bool exact_match = false;
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_TRUE(status.ok()) << key;
+        EXPECT_EQ(i % 2 == 0, exact_match) << key;
+        EXPECT_EQ((i + 1) / 2, index_iterator->get_current_ordinal()) << key;
+    };
+    for (int i = 0; i < 39; i++) {
+        check(i);
+    }
+    for (int i = 38; i >= 0; i--) {
+        check(i);
+    }
+    {
+        std::string key("00039");
+        Slice slice(key);
+        bool exact_match = false;
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+    }
+    check(0);
+}
+
 TEST_F(PrimaryKeyIndexTest, single_page) {
     std::string filename = kTestDir + "/single_page";
     io::FileWriterPtr file_writer;
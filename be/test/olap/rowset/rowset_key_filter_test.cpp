@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/rowset_key_filter.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(RowsetKeyFilterTest, LookupSegments) {
+    const int num_keys = 100000;
+    const uint32_t num_segments = 500;
+    RowsetKeyFilter filter(num_keys);
+    for (int i = 0; i < num_keys; ++i) {
+        std::string key = "key_" + std::to_string(i);
+        ASSERT_TRUE(filter.insert(key, i % num_segments)) << key;
+    }
+    EXPECT_GE(filter.size_bytes(), num_keys * sizeof(uint32_t));
+
+    // no false negatives
+    size_t num_candidates = 0;
+    for (int i = 0; i < num_keys; ++i) {
+        std::string key = "key_" + std::to_string(i);
+        std::vector<uint32_t> segment_ids;
+        filter.lookup(key, &segment_ids);
+        EXPECT_NE(std::find(segment_ids.begin(), segment_ids.end(), i % num_segments),
+                  segment_ids.end())
+                << key;
+        num_candidates += segment_ids.size();
+    }
+    EXPECT_LT(num_candidates, num_keys * 1.01);
+
+    // the keys not inserted rarely hit a segment
+    size_t num_false_positives = 0;
+    for (int i = num_keys; i < num_keys * 2; ++i) {
+        std::vector<uint32_t> segment_ids;
+        filter.lookup("key_" + std::to_string(i), &segment_ids);
+        num_false_positives += segment_ids.size();
+    }
+    EXPECT_LT(num_false_positives, num_keys / 100);
+}
+
+TEST(RowsetKeyFilterTest, DuplicateKeys) {
+    RowsetKeyFilter filter(16);
+    // the same key in several segments, e.g. overlapping segments of one load
+    for (uint32_t segment_id = 0; segment_id < 4; ++segment_id) {
+        ASSERT_TRUE(filter.insert("key", segment_id));
+    }
+    std::vector<uint32_t> segment_ids;
+    filter.lookup("key", &segment_ids);
+    std::sort(segment_ids.begin(), segment_ids.end());
+    EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 3}), segment_ids);
+}
+
+} // namespace doris
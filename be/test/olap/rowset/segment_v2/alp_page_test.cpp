@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        using ColumnType = std::conditional_t<std::is_same_v<CppType, float>,
+                                              vectorized::ColumnFloat32, vectorized::ColumnFloat64>;
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        ASSERT_TRUE(AlpPageBuilder<Type>::create(&builder_ptr, options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = src.size();
+        ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+        ASSERT_EQ(src.size(), size);
+        OwnedSlice page;
+        ASSERT_TRUE(builder->finish(&page).ok());
+        LOG(INFO) << "ALP encoded size for " << size << " values: " << page.slice().size
+                  << ", original size: " << size * sizeof(CppType);
+
+        AlpPageDecoder<Type> decoder(page.slice(), PageDecoderOptions());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(size, decoder.count());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t to_read = size;
+        ASSERT_TRUE(decoder.next_batch(&to_read, column).ok());
+        ASSERT_EQ(size, to_read);
+        const auto& values = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < size; ++i) {
+            // Compare the bits, for NaN and -0.0.
+            ASSERT_EQ(0, memcmp(&src[i], &values[i], sizeof(CppType))) << i << " " << src[i];
+        }
+
+        // Seek within the page by ordinal.
+        std::mt19937 rng(42);
+        for (int i = 0; i < 100; ++i) {
+            size_t pos = rng() % size;
+            ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+            vectorized::MutableColumnPtr one = ColumnType::create();
+            size_t n = 1;
+            ASSERT_TRUE(decoder.next_batch(&n, one).ok());
+            ASSERT_EQ(1, n);
+            ASSERT_EQ(0, memcmp(&src[pos], &assert_cast<const ColumnType&>(*one).get_data()[0],
+                                sizeof(CppType)));
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 3; i < size; i += 7) {
+            rowids.push_back(i + 100);
+        }
+        vectorized::MutableColumnPtr selected = ColumnType::create();
+        size_t n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 100, &n, selected).ok());
+        ASSERT_EQ(rowids.size(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(0, memcmp(&src[rowids[i] - 100],
+                                &assert_cast<const ColumnType&>(*selected).get_data()[i],
+                                sizeof(CppType)));
+        }
+    }
+};
+
+TEST_F(AlpPageTest, TestDecimalDoubles) {
+    std::vector<double> src;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(static_cast<double>(rng() % 1000000) / 100);
+    }
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(src);
+}
+
+TEST_F(AlpPageTest, TestExceptions) {
+    std::vector<double> src;
+    for (int i = 0; i < 1000; ++i) {
+        src.push_back(i * 0.5);
+    }
+    src[3] = std::numeric_limits<double>::quiet_NaN();
+    src[31] = -0.0;
+    src[32] = std::numeric_limits<double>::infinity();
+    src[500] = M_PI;
+    src[999] = std::numeric_limits<double>::max();
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(src);
+}
+
+TEST_F(AlpPageTest, TestFloats) {
+    std::vector<float> src;
+    std::mt19937 rng(2);
+    for (int i = 0; i < 5000; ++i) {
+        src.push_back(static_cast<float>(rng() % 100000) / 10);
+    }
+    src[7] = std::numeric_limits<float>::quiet_NaN();
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_FLOAT>(src);
+}
+
+TEST_F(AlpPageTest, TestSameValue) {
+    std::vector<double> src(3000, 12.25);
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(src);
+}
+
+TEST_F(AlpPageTest, TestEmptyPage) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE>::create(&builder_ptr, options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+    double value;
+    EXPECT_FALSE(builder->get_first_value(&value).ok());
+
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    EXPECT_EQ(0, decoder.count());
+    ASSERT_TRUE(decoder.seek_to_position_in_page(0).ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common/config.h"
+#include "olap/rowset/segment_v2/bitshuffle_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class BitShufflePageFusedDecodeTest : public testing::Test {
+public:
+    void SetUp() override {
+        _fused_decode = config::enable_bitshuffle_fused_page_decode;
+        config::enable_bitshuffle_fused_page_decode = true;
+    }
+    void TearDown() override { config::enable_bitshuffle_fused_page_decode = _fused_decode; }
+
+    template <FieldType Type>
+    OwnedSlice build_page(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        PageBuilderOptions options;
+        options.data_page_size = 1024 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(BitshufflePageBuilder<Type>::create(&builder_ptr, options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = src.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+        EXPECT_EQ(src.size(), size);
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+        return page;
+    }
+
+    template <FieldType Type, typename ColumnType>
+    void test_fused_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        OwnedSlice page = build_page<Type>(src);
+
+        // The page is kept encoded by the pre decoder.
+        std::unique_ptr<DataPage> data_page;
+        Slice page_slice = page.slice();
+        BitShufflePagePreDecoder<false> pre_decoder;
+        ASSERT_TRUE(pre_decoder.decode(&data_page, &page_slice, 0, false, DATA_PAGE).ok());
+        EXPECT_EQ(nullptr, data_page.get());
+        EXPECT_EQ(page.slice().data, page_slice.data);
+
+        BitShufflePageDecoder<Type> decoder(page_slice, PageDecoderOptions());
+        ASSERT_TRUE(decoder.init().ok());
+        EXPECT_TRUE(decoder._encoded);
+        EXPECT_GT(decoder._block_offsets.size(), 1U);
+        EXPECT_EQ(src.size(), decoder.count());
+
+        // Batches crossing the block boundaries.
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t remaining = src.size();
+        while (remaining > 0) {
+            size_t n = 1000;
+            ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+            ASSERT_GT(n, 0U);
+            remaining -= n;
+        }
+        const auto& values = assert_cast<const ColumnType&>(*column).get_data();
+        ASSERT_EQ(src.size(), values.size());
+        for (size_t i = 0; i < src.size(); ++i) {
+            ASSERT_EQ(src[i], values[i]) << i;
+        }
+
+        std::mt19937 rng(42);
+        for (int i = 0; i < 100; ++i) {
+            size_t pos = rng() % src.size();
+            ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+            vectorized::MutableColumnPtr one = ColumnType::create();
+            size_t n = 1;
+            ASSERT_TRUE(decoder.peek_next_batch(&n, one).ok());
+            EXPECT_EQ(pos, decoder.current_index());
+            EXPECT_EQ(src[pos], assert_cast<const ColumnType&>(*one).get_data()[0]);
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 3; i < src.size(); i += 7) {
+            rowids.push_back(i + 100);
+        }
+        vectorized::MutableColumnPtr selected = ColumnType::create();
+        size_t n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 100, &n, selected).ok());
+        ASSERT_EQ(rowids.size(), n);
+        const auto& selected_values = assert_cast<const ColumnType&>(*selected).get_data();
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(src[rowids[i] - 100], selected_values[i]);
+        }
+    }
+
+private:
+    bool _fused_decode = false;
+};
+
+TEST_F(BitShufflePageFusedDecodeTest, TestInt32) {
+    std::vector<int32_t> src;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 10001; ++i) {
+        src.push_back(static_cast<int32_t>(rng() % 100000));
+    }
+    test_fused_decode<FieldType::OLAP_FIELD_TYPE_INT, vectorized::ColumnInt32>(src);
+}
+
+TEST_F(BitShufflePageFusedDecodeTest, TestInt64) {
+    std::vector<int64_t> src;
+    for (int64_t i = 0; i < 5000; ++i) {
+        src.push_back(i * i);
+    }
+    test_fused_decode<FieldType::OLAP_FIELD_TYPE_BIGINT, vectorized::ColumnInt64>(src);
+}
+
+TEST_F(BitShufflePageFusedDecodeTest, TestSeekAtOrAfterValue) {
+    std::vector<int32_t> src;
+    for (int32_t i = 0; i < 10000; ++i) {
+        src.push_back(i * 2);
+    }
+    OwnedSlice page = build_page<FieldType::OLAP_FIELD_TYPE_INT>(src);
+    BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_INT> decoder(page.slice(),
+                                                                   PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+
+    bool exact_match = false;
+    int32_t value = 2 * 5001 + 1;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_FALSE(exact_match);
+    EXPECT_EQ(5002U, decoder.current_index());
+
+    value = 2 * 9999;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(9999U, decoder.current_index());
+
+    value = 2 * 9999 + 1;
+    EXPECT_FALSE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+}
+
+TEST_F(BitShufflePageFusedDecodeTest, TestDisabled) {
+    std::vector<int32_t> src(3000, 7);
+    OwnedSlice page = build_page<FieldType::OLAP_FIELD_TYPE_INT>(src);
+
+    config::enable_bitshuffle_fused_page_decode = false;
+    BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_INT> encoded(page.slice(),
+                                                                   PageDecoderOptions());
+    EXPECT_FALSE(encoded.init().ok());
+
+    // The page decoded by the pre decoder is read as before.
+    std::unique_ptr<DataPage> data_page;
+    Slice page_slice = page.slice();
+    BitShufflePagePreDecoder<false> pre_decoder;
+    ASSERT_TRUE(pre_decoder.decode(&data_page, &page_slice, 0, false, DATA_PAGE).ok());
+    ASSERT_NE(nullptr, data_page.get());
+    BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_INT> decoder(page_slice,
+                                                                   PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    EXPECT_FALSE(decoder._encoded);
+    vectorized::MutableColumnPtr column = vectorized::ColumnInt32::create();
+    size_t n = src.size();
+    ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+    EXPECT_EQ(src.size(), n);
+    EXPECT_EQ(7, assert_cast<const vectorized::ColumnInt32&>(*column).get_data()[2999]);
+}
+
+TEST_F(BitShufflePageFusedDecodeTest, TestCorruptedBlocks) {
+    std::vector<int32_t> src(3000, 7);
+    OwnedSlice page = build_page<FieldType::OLAP_FIELD_TYPE_INT>(src);
+    // Truncate the last block.
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    encode_fixed32_le(reinterpret_cast<uint8_t*>(truncated.data) + 4,
+                      static_cast<uint32_t>(truncated.size));
+    BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_INT> decoder(truncated,
+                                                                   PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -659,6 +659,33 @@ TEST_F(ColumnReaderWriterTest, test_nullable) {
     delete[] double_vals;
 }
 
+TEST_F(ColumnReaderWriterTest, test_adaptive_compression) {
+    const bool enabled = config::enable_adaptive_column_compression;
+    const int32_t sample_pages = config::adaptive_column_compression_sample_pages;
+    config::enable_adaptive_column_compression = true;
+    size_t num_rows = LOOP_LESS_OR_MORE(1024, 1024 * 1024);
+    uint8_t* is_null = new uint8_t[num_rows];
+    int64_t* vals = new int64_t[num_rows];
+    for (int i = 0; i < num_rows; ++i) {
+        vals[i] = i;
+        BitmapChange(is_null, i, (i % 4) == 0);
+    }
+    // The codec is chosen after the first page, and when the column is written for a column with
+    // fewer pages than sampled.
+    for (int32_t pages : {1, 1000}) {
+        config::adaptive_column_compression_sample_pages = pages;
+        test_nullable_data<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>(
+                (uint8_t*)vals, is_null, num_rows, "adaptive_bigint_" + std::to_string(pages));
+        test_nullable_data<FieldType::OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>(
+                (uint8_t*)vals, is_null, num_rows,
+                "adaptive_bigint_plain_" + std::to_string(pages));
+    }
+    config::enable_adaptive_column_compression = enabled;
+    config::adaptive_column_compression_sample_pages = sample_pages;
+    delete[] vals;
+    delete[] is_null;
+}
+
 TEST_F(ColumnReaderWriterTest, test_types) {
     size_t num_uint8_rows = LOOP_LESS_OR_MORE(1024, 1024 * 1024);
     uint8_t* is_null = new uint8_t[num_uint8_rows];
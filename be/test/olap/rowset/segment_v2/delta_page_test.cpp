@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class DeltaPageTest : public testing::Test {
+public:
+    template <FieldType Type, typename ColumnType>
+    size_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(DeltaPageBuilder<Type>::create(&builder_ptr, options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = src.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+        EXPECT_EQ(src.size(), size);
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+        CppType first_value;
+        EXPECT_TRUE(builder->get_first_value(&first_value).ok());
+        EXPECT_EQ(src.front(), first_value);
+        CppType last_value;
+        EXPECT_TRUE(builder->get_last_value(&last_value).ok());
+        EXPECT_EQ(src.back(), last_value);
+
+        DeltaPageDecoder<Type> decoder(page.slice(), PageDecoderOptions());
+        EXPECT_TRUE(decoder.init().ok());
+        EXPECT_EQ(size, decoder.count());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t to_read = size;
+        EXPECT_TRUE(decoder.next_batch(&to_read, column).ok());
+        EXPECT_EQ(size, to_read);
+        const auto& values = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(0, memcmp(&src[i], &values[i], sizeof(CppType))) << i;
+        }
+
+        std::mt19937 rng(42);
+        for (int i = 0; i < 100; ++i) {
+            size_t pos = rng() % size;
+            EXPECT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+            vectorized::MutableColumnPtr one = ColumnType::create();
+            size_t n = 1;
+            EXPECT_TRUE(decoder.next_batch(&n, one).ok());
+            EXPECT_EQ(0, memcmp(&src[pos], &assert_cast<const ColumnType&>(*one).get_data()[0],
+                                sizeof(CppType)));
+        }
+        return page.slice().size;
+    }
+};
+
+TEST_F(DeltaPageTest, TestRegularTimestamps) {
+    std::vector<uint64_t> src;
+    uint64_t ts = 1700000000000ULL;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(ts);
+        ts += 1000;
+    }
+    auto size = test_encode_decode<FieldType::OLAP_FIELD_TYPE_DATETIMEV2,
+                                   vectorized::ColumnDateTimeV2>(src);
+    // Only the header, all the delta of deltas are 0.
+    EXPECT_EQ(DELTA_PAGE_HEADER_SIZE, size);
+}
+
+TEST_F(DeltaPageTest, TestJitteredTimestamps) {
+    std::vector<int64_t> src;
+    std::mt19937 rng(1);
+    int64_t ts = 1000000;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(ts);
+        ts += 1000 + static_cast<int64_t>(rng() % 16) - 8;
+    }
+    auto size = test_encode_decode<FieldType::OLAP_FIELD_TYPE_BIGINT, vectorized::ColumnInt64>(
+            src);
+    EXPECT_LT(size, src.size() * sizeof(int64_t) / 10);
+}
+
+TEST_F(DeltaPageTest, TestOverflow) {
+    std::vector<int32_t> src = {std::numeric_limits<int32_t>::max(),
+                                std::numeric_limits<int32_t>::min(), 0, -1, 1,
+                                std::numeric_limits<int32_t>::max()};
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_INT, vectorized::ColumnInt32>(src);
+    std::vector<int8_t> tiny = {127, -128, 5};
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_TINYINT, vectorized::ColumnInt8>(tiny);
+}
+
+TEST_F(DeltaPageTest, TestSeekAtOrAfterValue) {
+    std::vector<int32_t> src;
+    for (int i = 0; i < 1000; ++i) {
+        src.push_back(i * 10);
+    }
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(DeltaPageBuilder<FieldType::OLAP_FIELD_TYPE_INT>::create(&builder_ptr, options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t size = src.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+
+    DeltaPageDecoder<FieldType::OLAP_FIELD_TYPE_INT> decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    bool exact_match = false;
+    int32_t value = 55;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_FALSE(exact_match);
+    EXPECT_EQ(6, decoder.current_index());
+    value = 500;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(50, decoder.current_index());
+    value = 100000;
+    EXPECT_FALSE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
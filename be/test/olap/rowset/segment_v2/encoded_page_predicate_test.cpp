@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/plain_page.h"
+#include "olap/rowset/segment_v2/rle_page.h"
+#include "vec/columns/predicate_column.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class EncodedPagePredicateTest : public testing::Test {
+public:
+    static OwnedSlice build_rle_page(const std::vector<uint8_t>& src) {
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(RlePageBuilder<FieldType::OLAP_FIELD_TYPE_BOOL>::create(&builder_ptr, options)
+                            .ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = src.size();
+        EXPECT_TRUE(builder->add(src.data(), &size).ok());
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+        return page;
+    }
+};
+
+TEST_F(EncodedPagePredicateTest, TestRleRuns) {
+    std::vector<uint8_t> src;
+    for (int run = 0; run < 20; ++run) {
+        src.insert(src.end(), 10 + run, run % 2);
+    }
+    OwnedSlice page = build_rle_page(src);
+    RlePageDecoder<FieldType::OLAP_FIELD_TYPE_BOOL> decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+
+    std::vector<uint32_t> refs(src.size());
+    size_t n = refs.size();
+    // The runs must be read first.
+    EXPECT_FALSE(decoder.next_encoded_refs(&n, refs.data()).ok());
+
+    vectorized::MutableColumnPtr values = vectorized::PredicateColumnType<TYPE_BOOLEAN>::create();
+    ASSERT_TRUE(decoder.read_encoded_values(values).ok());
+    ASSERT_EQ(20, values->size());
+
+    // Start in the middle of the second run.
+    ASSERT_TRUE(decoder.seek_to_position_in_page(15).ok());
+    n = refs.size();
+    ASSERT_TRUE(decoder.next_encoded_refs(&n, refs.data()).ok());
+    ASSERT_EQ(src.size() - 15, n);
+    const auto& data =
+            assert_cast<vectorized::PredicateColumnType<TYPE_BOOLEAN>&>(*values).get_data();
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(src[15 + i], data[refs[i]]) << i;
+    }
+    EXPECT_EQ(1, refs[0]);
+    EXPECT_EQ(19, refs[n - 1]);
+    EXPECT_EQ(src.size(), decoder.current_index());
+}
+
+TEST_F(EncodedPagePredicateTest, TestNotSupported) {
+    std::vector<int32_t> src = {1, 2, 3};
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(
+            PlainPageBuilder<FieldType::OLAP_FIELD_TYPE_INT>::create(&builder_ptr, options).ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t size = src.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+
+    PlainPageDecoder<FieldType::OLAP_FIELD_TYPE_INT> decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    std::vector<uint32_t> refs(size);
+    EXPECT_TRUE(decoder.next_encoded_refs(&size, refs.data())
+                        .is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class FsstPageTest : public testing::Test {
+public:
+    void test_encode_decode(const std::vector<std::string>& src) {
+        std::vector<Slice> slices(src.begin(), src.end());
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        ASSERT_TRUE(
+                FsstPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>::create(&builder_ptr, options)
+                        .ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = slices.size();
+        ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(slices.data()), &size).ok());
+        ASSERT_EQ(slices.size(), size);
+        OwnedSlice page;
+        ASSERT_TRUE(builder->finish(&page).ok());
+
+        Slice first_value;
+        ASSERT_TRUE(builder->get_first_value(&first_value).ok());
+        EXPECT_EQ(src.front(), first_value.to_string());
+        Slice last_value;
+        ASSERT_TRUE(builder->get_last_value(&last_value).ok());
+        EXPECT_EQ(src.back(), last_value.to_string());
+
+        FsstPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> decoder(page.slice(),
+                                                                    PageDecoderOptions());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(size, decoder.count());
+
+        // Read in several batches.
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        size_t read = 0;
+        while (read < size) {
+            size_t n = 100;
+            ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+            read += n;
+        }
+        ASSERT_EQ(size, column->size());
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(src[i], column->get_data_at(i).to_string()) << i;
+        }
+
+        std::mt19937 rng(42);
+        for (int i = 0; i < 100; ++i) {
+            size_t pos = rng() % size;
+            ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+            vectorized::MutableColumnPtr one = vectorized::ColumnString::create();
+            size_t n = 1;
+            ASSERT_TRUE(decoder.next_batch(&n, one).ok());
+            ASSERT_EQ(1, n);
+            ASSERT_EQ(src[pos], one->get_data_at(0).to_string());
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 1; i < size; i += 5) {
+            rowids.push_back(i + 10);
+        }
+        vectorized::MutableColumnPtr selected = vectorized::ColumnString::create();
+        size_t n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 10, &n, selected).ok());
+        ASSERT_EQ(rowids.size(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(src[rowids[i] - 10], selected->get_data_at(i).to_string());
+        }
+    }
+};
+
+TEST_F(FsstPageTest, TestLogLines) {
+    std::vector<std::string> src;
+    std::mt19937 rng(1);
+    const std::vector<std::string> words = {"GET /api/v1/", "user=", "ERROR ", "INFO ",
+                                            "https://www.example.com/", "timeout"};
+    for (int i = 0; i < 3000; ++i) {
+        std::string line;
+        for (int j = 0; j < 4; ++j) {
+            line += words[rng() % words.size()] + std::to_string(rng() % 1000);
+        }
+        src.push_back(line);
+    }
+    test_encode_decode(src);
+}
+
+TEST_F(FsstPageTest, TestEmptyAndBinaryStrings) {
+    std::vector<std::string> src;
+    std::mt19937 rng(2);
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 7 == 0) {
+            src.emplace_back();
+            continue;
+        }
+        std::string s(rng() % 20, '\0');
+        for (auto& c : s) {
+            c = static_cast<char>(rng() % 256);
+        }
+        src.push_back(s);
+    }
+    test_encode_decode(src);
+}
+
+TEST_F(FsstPageTest, TestCorruptedPage) {
+    std::string data(3, '\0');
+    FsstPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> decoder(Slice(data),
+                                                                PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
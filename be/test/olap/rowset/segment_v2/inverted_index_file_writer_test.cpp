@@ -1334,6 +1334,7 @@ public:
     RowsetId rowset_id() override { return _context.rowset_id; }
     RowsetTypePB type() const override { return BETA_ROWSET; }
     int32_t allocate_segment_id() override { return 0; }
+    int32_t allocate_segment_ids(int32_t num) override { return 0; }
     std::shared_ptr<PartialUpdateInfo> get_partial_update_info() override { return nullptr; }
     bool is_partial_update() override { return false; }
 
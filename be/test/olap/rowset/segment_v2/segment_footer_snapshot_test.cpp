@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_snapshot.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class SegmentFooterSnapshotTest : public testing::Test {
+public:
+    const std::string kTestDir = "./ut_dir/segment_footer_snapshot_test";
+    const std::string kSnapshotPath = kTestDir + "/segment_footer.snapshot";
+
+    void SetUp() override {
+        auto st = io::global_local_filesystem()->delete_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+    void TearDown() override {
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(kTestDir).ok());
+    }
+};
+
+TEST_F(SegmentFooterSnapshotTest, LookupAndEvict) {
+    SegmentFooterSnapshot snapshot(kSnapshotPath, 20);
+    std::string footer;
+    EXPECT_FALSE(snapshot.lookup("k1", &footer));
+
+    snapshot.insert("k1", "footer1");
+    snapshot.insert("k2", "footer2");
+    EXPECT_EQ(2, snapshot.size());
+    EXPECT_EQ(18, snapshot.bytes());
+    EXPECT_TRUE(snapshot.lookup("k1", &footer));
+    EXPECT_EQ("footer1", footer);
+
+    // k2 is the least recently used one
+    snapshot.insert("k3", "footer3");
+    EXPECT_EQ(2, snapshot.size());
+    EXPECT_FALSE(snapshot.lookup("k2", &footer));
+    EXPECT_TRUE(snapshot.lookup("k1", &footer));
+    EXPECT_TRUE(snapshot.lookup("k3", &footer));
+
+    // too large to be kept
+    snapshot.insert("k4", std::string(100, 'x'));
+    EXPECT_FALSE(snapshot.lookup("k4", &footer));
+    EXPECT_EQ(2, snapshot.size());
+
+    snapshot.erase("k1");
+    EXPECT_FALSE(snapshot.lookup("k1", &footer));
+    EXPECT_EQ(9, snapshot.bytes());
+}
+
+TEST_F(SegmentFooterSnapshotTest, SaveAndLoad) {
+    {
+        SegmentFooterSnapshot snapshot(kSnapshotPath, 1024);
+        // nothing to load
+        ASSERT_TRUE(snapshot.load().ok());
+        EXPECT_EQ(0, snapshot.size());
+        snapshot.insert("k1", "footer1");
+        snapshot.insert("k2", "footer2");
+        snapshot.insert("k3", std::string(200, '\0'));
+        ASSERT_TRUE(snapshot.save().ok());
+    }
+
+    // the most recently used entries are kept if the capacity is smaller
+    SegmentFooterSnapshot snapshot(kSnapshotPath, 215);
+    ASSERT_TRUE(snapshot.load().ok());
+    EXPECT_EQ(2, snapshot.size());
+    std::string footer;
+    EXPECT_TRUE(snapshot.lookup("k3", &footer));
+    EXPECT_EQ(std::string(200, '\0'), footer);
+    EXPECT_TRUE(snapshot.lookup("k2", &footer));
+    EXPECT_EQ("footer2", footer);
+    EXPECT_FALSE(snapshot.lookup("k1", &footer));
+}
+
+TEST_F(SegmentFooterSnapshotTest, InvalidFile) {
+    {
+        io::FileWriterPtr writer;
+        ASSERT_TRUE(io::global_local_filesystem()->create_file(kSnapshotPath, &writer).ok());
+        ASSERT_TRUE(writer->append("not a snapshot").ok());
+        ASSERT_TRUE(writer->close().ok());
+    }
+    SegmentFooterSnapshot snapshot(kSnapshotPath, 1024);
+    EXPECT_FALSE(snapshot.load().ok());
+    EXPECT_EQ(0, snapshot.size());
+
+    // a truncated snapshot keeps the entries before the truncation
+    snapshot.insert("k1", "footer1");
+    snapshot.insert("k2", "footer2");
+    ASSERT_TRUE(snapshot.save().ok());
+    int64_t file_size = 0;
+    ASSERT_TRUE(io::global_local_filesystem()->file_size(kSnapshotPath, &file_size).ok());
+    std::string buf(file_size, '\0');
+    {
+        io::FileReaderSPtr reader;
+        ASSERT_TRUE(io::global_local_filesystem()->open_file(kSnapshotPath, &reader).ok());
+        size_t bytes_read = 0;
+        ASSERT_TRUE(reader->read_at(0, Slice(buf), &bytes_read).ok());
+    }
+    {
+        io::FileWriterPtr writer;
+        ASSERT_TRUE(io::global_local_filesystem()->create_file(kSnapshotPath, &writer).ok());
+        ASSERT_TRUE(writer->append(Slice(buf.data(), buf.size() - 1)).ok());
+        ASSERT_TRUE(writer->close().ok());
+    }
+    SegmentFooterSnapshot truncated(kSnapshotPath, 1024);
+    ASSERT_TRUE(truncated.load().ok());
+    EXPECT_EQ(1, truncated.size());
+    std::string footer;
+    EXPECT_TRUE(truncated.lookup("k2", &footer));
+}
+
+} // namespace segment_v2
+} // namespace doris
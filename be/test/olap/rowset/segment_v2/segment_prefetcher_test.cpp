@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/file_reader.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class RecordingFileReader final : public io::FileReader {
+public:
+    Status close() override { return Status::OK(); }
+    const io::Path& path() const override { return _path; }
+    size_t size() const override { return 1L << 40; }
+    bool closed() const override { return false; }
+
+    std::vector<std::pair<size_t, size_t>> reads;
+    bool all_dryrun = true;
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const io::IOContext* io_ctx) override {
+        reads.emplace_back(offset, result.size);
+        all_dryrun &= io_ctx != nullptr && io_ctx->is_dryrun;
+        *bytes_read = result.size;
+        return Status::OK();
+    }
+
+private:
+    io::Path _path = "recording_file";
+};
+
+class SegmentPrefetcherTest : public testing::Test {
+public:
+    void SetUp() override {
+        _block_size = config::file_cache_each_block_size;
+        config::file_cache_each_block_size = 1024 * 1024;
+    }
+    void TearDown() override { config::file_cache_each_block_size = _block_size; }
+
+private:
+    int64_t _block_size = 0;
+};
+
+TEST_F(SegmentPrefetcherTest, TestCoalesce) {
+    auto reader = std::make_shared<RecordingFileReader>();
+    auto prefetcher =
+            std::make_shared<SegmentPrefetcher>(reader, io::IOContext(), 16 * 1024 * 1024, nullptr);
+    // Column 1, three adjacent pages and one far away.
+    prefetcher->add_column_pages({{0, 100}, {100, 100}, {300, 100}, {10 * 1024 * 1024, 100}},
+                                 {0, 10, 20, 30}, {9, 19, 29, 39});
+    // Column 2 is after column 1 in the file.
+    prefetcher->add_column_pages({{20 * 1024 * 1024, 200}, {20 * 1024 * 1024 + 200, 200}}, {0, 20},
+                                 {19, 39});
+    ASSERT_EQ(3, prefetcher->num_reads());
+    prefetcher->finish();
+    prefetcher->advance(0);
+
+    // Issued in the order of rows.
+    std::vector<std::pair<size_t, size_t>> expected = {
+            {0, 400}, {20 * 1024 * 1024, 400}, {10 * 1024 * 1024, 100}};
+    EXPECT_EQ(expected, reader->reads);
+    EXPECT_TRUE(reader->all_dryrun);
+}
+
+TEST_F(SegmentPrefetcherTest, TestWindow) {
+    auto reader = std::make_shared<RecordingFileReader>();
+    auto prefetcher =
+            std::make_shared<SegmentPrefetcher>(reader, io::IOContext(), 250 * 1024, nullptr);
+    std::vector<PagePointer> pages;
+    std::vector<ordinal_t> first_ordinals;
+    std::vector<ordinal_t> last_ordinals;
+    for (uint64_t i = 0; i < 10; ++i) {
+        pages.emplace_back(i * 2 * 1024 * 1024, 100 * 1024);
+        first_ordinals.push_back(i * 10);
+        last_ordinals.push_back(i * 10 + 9);
+    }
+    prefetcher->add_column_pages(pages, first_ordinals, last_ordinals);
+    ASSERT_EQ(10, prefetcher->num_reads());
+    prefetcher->finish();
+
+    prefetcher->advance(0);
+    EXPECT_EQ(2, reader->reads.size());
+    EXPECT_EQ(200 * 1024, prefetcher->bytes_ahead());
+
+    // The first page is consumed, one more read fits in the window.
+    prefetcher->advance(10);
+    EXPECT_EQ(3, reader->reads.size());
+    EXPECT_EQ(2 * 1024 * 1024 * 2, reader->reads.back().first);
+
+    // The reads the iterator has passed are never issued.
+    prefetcher->advance(75);
+    EXPECT_EQ(5, reader->reads.size());
+    EXPECT_EQ(7 * 2 * 1024 * 1024, reader->reads[3].first);
+    EXPECT_EQ(8 * 2 * 1024 * 1024, reader->reads[4].first);
+
+    prefetcher->stop();
+    prefetcher->advance(90);
+    EXPECT_EQ(5, reader->reads.size());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -25,6 +25,7 @@
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
@@ -233,5 +234,62 @@ TEST_F(ColumnZoneMapTest, ZoneMapCut) {
     delete field;
 }
 
+// Test for the distinct values of the zones
+TEST_F(ColumnZoneMapTest, DistinctValues) {
+    auto max_distinct_values = config::zone_map_max_distinct_values;
+    config::zone_map_max_distinct_values = 4;
+    auto fs = io::global_local_filesystem();
+    TabletColumnPtr int_column = create_int_key(0);
+    std::unique_ptr<Field> field(FieldFactory::create(*int_column));
+
+    auto write_pages = [&](const std::string& filename,
+                           const std::vector<std::vector<int>>& pages,
+                           ColumnIndexMetaPB* index_meta) -> std::vector<ZoneMapPB> {
+        std::unique_ptr<ZoneMapIndexWriter> builder(nullptr);
+        EXPECT_TRUE(ZoneMapIndexWriter::create(field.get(), builder).ok());
+        for (const auto& page : pages) {
+            builder->add_values((const uint8_t*)page.data(), page.size());
+            builder->add_nulls(1);
+            EXPECT_TRUE(builder->flush().ok());
+        }
+        io::FileWriterPtr file_writer;
+        EXPECT_TRUE(fs->create_file(kTestDir + "/" + filename, &file_writer).ok());
+        EXPECT_TRUE(builder->finish(file_writer.get(), index_meta).ok());
+        EXPECT_TRUE(file_writer->close().ok());
+
+        io::FileReaderSPtr file_reader;
+        EXPECT_TRUE(fs->open_file(kTestDir + "/" + filename, &file_reader).ok());
+        ZoneMapIndexReader reader(file_reader, index_meta->zone_map_index().page_zone_maps());
+        EXPECT_TRUE(reader.load(true, false).ok());
+        return reader.page_zone_maps();
+    };
+    auto sorted_values = [](const ZoneMapPB& zone_map) {
+        std::vector<std::string> values(zone_map.distinct_values().begin(),
+                                        zone_map.distinct_values().end());
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+
+    ColumnIndexMetaPB index_meta;
+    auto zone_maps = write_pages("DistinctValues1", {{1, 2, 2, 3}, {5, 5}}, &index_meta);
+    ASSERT_EQ(2, zone_maps.size());
+    EXPECT_EQ(std::vector<std::string>({"1", "2", "3"}), sorted_values(zone_maps[0]));
+    EXPECT_EQ(std::vector<std::string>({"5"}), sorted_values(zone_maps[1]));
+    EXPECT_EQ(std::vector<std::string>({"1", "2", "3", "5"}),
+              sorted_values(index_meta.zone_map_index().segment_zone_map()));
+
+    // More values than the limit in one page, or in the segment.
+    index_meta.Clear();
+    zone_maps = write_pages("DistinctValues2", {{1, 2, 3, 4, 5}, {6, 7}, {8, 9, 10}}, &index_meta);
+    ASSERT_EQ(3, zone_maps.size());
+    EXPECT_EQ(0, zone_maps[0].distinct_values_size());
+    EXPECT_EQ("1", zone_maps[0].min());
+    EXPECT_EQ(2, zone_maps[1].distinct_values_size());
+    EXPECT_EQ(3, zone_maps[2].distinct_values_size());
+    EXPECT_EQ(0, index_meta.zone_map_index().segment_zone_map().distinct_values_size());
+
+    config::zone_map_max_distinct_values = max_distinct_values;
+}
+
 } // namespace segment_v2
 } // namespace doris
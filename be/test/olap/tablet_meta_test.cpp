@@ -403,4 +403,22 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     EXPECT_EQ(d.cardinality(), 500);
 }
 
+TEST(TabletMetaTest, TestDeleteBitmapRunOptimize) {
+    DeleteBitmap dbm(10086);
+    RowsetId rowset_id {2, 0, 1, 1};
+    for (uint32_t k = 0; k < 10000; ++k) {
+        dbm.add({rowset_id, 0, 1}, k);
+    }
+    dbm.add({rowset_id, 1, 1}, 7);
+    uint64_t size_before = dbm.get_size();
+    EXPECT_GT(dbm.run_optimize(), 0U);
+    EXPECT_LT(dbm.get_size(), size_before);
+    EXPECT_EQ(dbm.cardinality(), 10001U);
+    EXPECT_TRUE(dbm.contains({rowset_id, 0, 1}, 9999));
+    EXPECT_FALSE(dbm.contains({rowset_id, 0, 1}, 10000));
+    EXPECT_TRUE(dbm.contains({rowset_id, 1, 1}, 7));
+    // Already optimized, nothing more to save
+    EXPECT_EQ(dbm.run_optimize(), 0U);
+}
+
 } // namespace doris
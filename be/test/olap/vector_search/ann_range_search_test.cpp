@@ -600,7 +600,7 @@ TEST_F(VectorSearchTest, TestAnnIndexReaderRangeSearchEdgeCases) {
     {
         // Create reader with unsupported index type
         std::map<std::string, std::string> unsupported_properties;
-        unsupported_properties["index_type"] = "ivf"; // Unsupported type
+        unsupported_properties["index_type"] = "diskann"; // Unsupported type
         unsupported_properties["metric_type"] = "l2_distance";
 
         // Since we can't easily create an AnnIndexReader with invalid type,
@@ -184,4 +184,30 @@ TEST_F(VectorSearchTest, AnnTopNRuntimeEvaluateTopN) {
     ASSERT_EQ(row_ids->size(), 10);
 }
 
+TEST_F(VectorSearchTest, AnnTopNRuntimeGlobalPruning) {
+    auto runtime = segment_v2::AnnTopNRuntime::create_shared(true, 4, nullptr);
+
+    // The first segment fills the shared top-4: {0, 1, 2, 3}.
+    std::vector<float> distances1 = {0, 1, 2, 3, 4};
+    std::vector<uint64_t> row_ids1 = {10, 11, 12, 13, 14};
+    roaring::Roaring bitmap1;
+    bitmap1.addRange(10, 15);
+    runtime->_prune_by_global_topn(distances1, row_ids1, bitmap1);
+    EXPECT_EQ(distances1.size(), 5);
+    EXPECT_EQ(bitmap1.cardinality(), 5);
+
+    // Rows of the second segment behind the 4th best distance are dropped, ties are kept.
+    std::vector<float> distances2 = {0.5, 3, 3.5, 7};
+    std::vector<uint64_t> row_ids2 = {1, 2, 3, 4};
+    roaring::Roaring bitmap2;
+    bitmap2.addRange(1, 5);
+    runtime->_prune_by_global_topn(distances2, row_ids2, bitmap2);
+    EXPECT_EQ(distances2, (std::vector<float> {0.5, 3}));
+    EXPECT_EQ(row_ids2, (std::vector<uint64_t> {1, 2}));
+    EXPECT_EQ(bitmap2.cardinality(), 2);
+    EXPECT_TRUE(bitmap2.contains(1));
+    EXPECT_TRUE(bitmap2.contains(2));
+    EXPECT_FLOAT_EQ(runtime->_global_topn_scores.top(), 2);
+}
+
 } // namespace doris::vectorized
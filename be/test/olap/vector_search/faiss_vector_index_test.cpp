@@ -1024,4 +1024,101 @@ TEST_F(VectorSearchTest, InnerProductRangeSearchZeroAndNegativeRadius) {
     ASSERT_GE(res_gen.roaring->cardinality(), static_cast<size_t>(n * 0.9));
 }
 
+TEST_F(VectorSearchTest, IvfFlatProbeAllListsMatchesFlat) {
+    const int dimension = 32;
+    const int num_vectors = 500;
+    auto doris_index = std::make_unique<FaissVectorIndex>();
+    FaissBuildParameter params;
+    params.dim = dimension;
+    params.index_type = FaissBuildParameter::IndexType::IVF;
+    params.nlist = 16;
+    doris_index->build(params);
+    auto native_index = doris::vector_search_utils::create_native_index(
+            doris::vector_search_utils::IndexType::FLAT_L2, dimension, 0);
+
+    auto vectors =
+            doris::vector_search_utils::generate_test_vectors_flatten(num_vectors, dimension);
+    ASSERT_TRUE(doris_index->add(num_vectors, vectors.data()).ok());
+    native_index->add(num_vectors, vectors.data());
+    // Fewer rows than the training threshold, training happens when the segment is saved.
+    ASSERT_TRUE(doris_index->_need_train);
+    ASSERT_TRUE(doris_index->save(_ram_dir.get()).ok());
+    ASSERT_FALSE(doris_index->_need_train);
+    ASSERT_EQ(doris_index->_index->ntotal, num_vectors);
+
+    IVFSearchParameters search_params;
+    auto roaring = std::make_unique<roaring::Roaring>();
+    roaring->addRange(0, num_vectors);
+    search_params.roaring = roaring.get();
+    search_params.rows_of_segment = num_vectors;
+    search_params.nprobe = params.nlist;
+
+    const int top_k = 10;
+    const float* query_vec = vectors.data() + static_cast<size_t>(num_vectors / 2) * dimension;
+    IndexSearchResult doris_results;
+    ASSERT_TRUE(doris_index->ann_topn_search(query_vec, top_k, search_params, doris_results).ok());
+
+    std::vector<float> native_distances(top_k);
+    std::vector<faiss::idx_t> native_indices(top_k);
+    native_index->search(1, query_vec, top_k, native_distances.data(), native_indices.data());
+    for (auto& distance : native_distances) {
+        distance = std::sqrt(distance);
+    }
+    vector_search_utils::compare_search_results(doris_results, native_distances, native_indices);
+}
+
+TEST_F(VectorSearchTest, IvfPqRefineSaveAndLoad) {
+    const int dimension = 16;
+    const int num_vectors = 1000;
+    auto index1 = std::make_unique<FaissVectorIndex>();
+    FaissBuildParameter params;
+    params.dim = dimension;
+    params.index_type = FaissBuildParameter::IndexType::IVF_PQ;
+    params.nlist = 4;
+    params.pq_m = 4;
+    params.pq_nbits = 4;
+    params.refine = true;
+    index1->build(params);
+    // 16 centroids for 4-bit codes at 39 points each, the second batch triggers training.
+    ASSERT_EQ(index1->_train_rows, 16 * 39);
+
+    auto vectors =
+            doris::vector_search_utils::generate_test_vectors_flatten(num_vectors, dimension);
+    ASSERT_TRUE(index1->add(num_vectors / 2, vectors.data()).ok());
+    ASSERT_TRUE(index1->_need_train);
+    ASSERT_TRUE(index1->add(num_vectors / 2,
+                            vectors.data() + static_cast<size_t>(num_vectors / 2) * dimension)
+                        .ok());
+    ASSERT_FALSE(index1->_need_train);
+    ASSERT_EQ(index1->_index->ntotal, num_vectors);
+    ASSERT_TRUE(index1->save(_ram_dir.get()).ok());
+
+    auto index2 = std::make_unique<FaissVectorIndex>();
+    ASSERT_TRUE(index2->load(_ram_dir.get()).ok());
+
+    IVFSearchParameters search_params;
+    auto roaring = std::make_unique<roaring::Roaring>();
+    roaring->addRange(0, num_vectors);
+    search_params.roaring = roaring.get();
+    search_params.rows_of_segment = num_vectors;
+    search_params.nprobe = params.nlist;
+    search_params.refine_factor = 20;
+
+    // Re-ranked by exact distance, the query vector itself is the nearest one.
+    const int query_idx = 123;
+    const float* query_vec = vectors.data() + static_cast<size_t>(query_idx) * dimension;
+    IndexSearchResult result1;
+    IndexSearchResult result2;
+    ASSERT_TRUE(index1->ann_topn_search(query_vec, 5, search_params, result1).ok());
+    ASSERT_TRUE(index2->ann_topn_search(query_vec, 5, search_params, result2).ok());
+    ASSERT_EQ(result1.roaring->cardinality(), 5);
+    ASSERT_EQ(*result1.roaring, *result2.roaring);
+    EXPECT_EQ((*result1.row_ids)[0], query_idx);
+    EXPECT_FLOAT_EQ(result1.distances[0], 0.0F);
+
+    IndexSearchResult range_result;
+    ASSERT_TRUE(index2->range_search(query_vec, 1e6F, search_params, range_result).ok());
+    EXPECT_EQ(range_result.roaring->cardinality(), num_vectors);
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -21,9 +21,15 @@
 
 #include <cstdint>
 
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/columns/column_vector.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
+namespace doris::vectorized {
+void register_aggregate_function_sum(AggregateFunctionSimpleFactory& factory);
+} // namespace doris::vectorized
+
 namespace doris::pipeline {
 
 class AggregatedDataVariantsTest : public testing::Test {
@@ -331,4 +337,43 @@ TEST_F(AggregatedDataVariantsTest, TestInvalidKeyType) {
     std::vector<vectorized::DataTypePtr> types {std::make_shared<vectorized::DataTypeInt32>()};
     ASSERT_THROW(_variants->init(types, static_cast<HashKeyType>(-1)), Exception);
 }
+
+TEST(ColumnarAggregateStatesTest, AddAndInsertResults) {
+    vectorized::AggregateFunctionSimpleFactory factory;
+    vectorized::register_aggregate_function_sum(factory);
+    vectorized::DataTypes data_types {std::make_shared<vectorized::DataTypeInt32>()};
+    auto sum = factory.get("sum", data_types, false, -1);
+    ColumnarAggregateStates states({sum.get(), sum.get()});
+
+    // More groups than one chunk.
+    constexpr uint32_t num_groups = 10000;
+    for (uint32_t i = 0; i < num_groups; ++i) {
+        EXPECT_EQ(states.append_group(), i);
+    }
+    EXPECT_EQ(states.total_count(), num_groups);
+    EXPECT_GT(states.memory_usage(), 0);
+
+    auto column = vectorized::ColumnInt32::create();
+    std::vector<uint32_t> group_ids;
+    for (uint32_t i = 0; i < num_groups * 2; ++i) {
+        column->insert_value(static_cast<int32_t>(i));
+        group_ids.push_back(i % num_groups);
+    }
+    const vectorized::IColumn* columns[1] = {column.get()};
+    vectorized::Arena arena;
+    states.add_batch(0, group_ids.data(), group_ids.size(), columns, arena);
+
+    auto result = vectorized::ColumnInt64::create();
+    states.insert_results_into(0, *result);
+    ASSERT_EQ(result->size(), num_groups);
+    for (uint32_t i = 0; i < num_groups; ++i) {
+        EXPECT_EQ(result->get_element(i), int64_t(i) * 2 + num_groups);
+    }
+
+    // The states of the other function are not touched.
+    auto other_result = vectorized::ColumnInt64::create();
+    states.insert_results_into(1, *other_result);
+    ASSERT_EQ(other_result->size(), num_groups);
+    EXPECT_EQ(other_result->get_element(num_groups - 1), 0);
+}
 } // namespace doris::pipeline
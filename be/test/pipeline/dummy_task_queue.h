@@ -55,6 +55,10 @@ public:
 
     Status submit(PipelineTaskSPtr task) override { return _task_queue->push_back(task); }
 
+    Status submit_batch(std::vector<PipelineTaskSPtr>& tasks) override {
+        return _task_queue->push_back_batch(tasks);
+    }
+
     Status start() override { return Status::OK(); }
 
     void stop() override {}
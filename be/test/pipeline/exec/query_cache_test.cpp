@@ -120,6 +120,28 @@ TEST_F(QueryCacheTest, insert_and_lookup) {
     }
 }
 
+TEST_F(QueryCacheTest, lookup_delta_base) {
+    std::unique_ptr<QueryCache> query_cache {QueryCache::create_global_cache(1024 * 1024 * 1024)};
+    std::string cache_key = "be ut";
+    {
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3});
+        query_cache->insert(cache_key, 42, result, {1, 2, 3}, 1);
+    }
+
+    QueryCacheHandle handle;
+    EXPECT_FALSE(query_cache->lookup_delta_base(cache_key, 42, &handle));
+    EXPECT_FALSE(query_cache->lookup_delta_base(cache_key, 41, &handle));
+    EXPECT_FALSE(query_cache->lookup_delta_base("other key", 43, &handle));
+    EXPECT_FALSE(query_cache->lookup(cache_key, 43, &handle));
+
+    EXPECT_TRUE(query_cache->lookup_delta_base(cache_key, 43, &handle));
+    EXPECT_EQ(handle.get_cache_version(), 42);
+    EXPECT_TRUE(ColumnHelper::block_equal(*handle.get_cache_result()->back(),
+                                          ColumnHelper::create_block<DataTypeInt32>({1, 2, 3})));
+}
+
 // ./run-be-ut.sh --run --filter=DataQueueTest.*
 
 } // namespace doris::pipeline
@@ -400,6 +400,68 @@ TEST_F(DataStreamRecvrTest, TestRemoteMemLimitSender) {
     sender->close();
 }
 
+TEST_F(DataStreamRecvrTest, TestRemoteCreditSender) {
+    create_recvr(2, false);
+    auto* sender = recvr->sender_queues().back();
+    auto source_dep = std::make_shared<Dependency>(0, 0, "test", false);
+    sender->set_dependency(source_dep);
+
+    config::enable_exchange_credit_flow_control = true;
+    // The credit of each sender is smaller than a block.
+    config::exchg_node_buffer_size_bytes = 2;
+    Defer set_([&]() {
+        config::enable_exchange_credit_flow_control = false;
+        config::exchg_node_buffer_size_bytes = 20485760;
+    });
+    EXPECT_EQ(sender->_sender_credit(), 1);
+
+    std::vector<bool> responded {false, false, false};
+    std::vector<std::shared_ptr<MockClosure>> closures {3};
+    auto send = [&](int be_number, int64_t packet_seq) {
+        closures[be_number] = std::make_shared<MockClosure>();
+        closures[be_number]->_cb = [&responded, be_number]() { responded[be_number] = true; };
+        auto block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
+        auto pblock = std::make_unique<PBlock>();
+        to_pblock(block, pblock.get());
+        google::protobuf::Closure* done = closures[be_number].get();
+        EXPECT_TRUE(sender->add_block(std::move(pblock), be_number, packet_seq, &done, 0, 0));
+        if (done != nullptr) {
+            done->Run();
+        }
+    };
+    send(1, 1);
+    send(2, 1);
+    EXPECT_FALSE(responded[1]);
+    EXPECT_FALSE(responded[2]);
+    EXPECT_EQ(sender->_pending_closures.size(), 2);
+
+    // Only the response of the sender whose block is consumed is sent.
+    Block block;
+    bool eos = false;
+    EXPECT_TRUE(sender->get_batch(&block, &eos));
+    EXPECT_TRUE(responded[1]);
+    EXPECT_FALSE(responded[2]);
+    EXPECT_EQ(sender->_sender_queued_bytes.count(1), 0);
+
+    // A sender within its credit is not delayed.
+    config::exchg_node_buffer_size_bytes = 20485760;
+    responded[1] = false;
+    send(1, 2);
+    EXPECT_TRUE(responded[1]);
+    EXPECT_FALSE(responded[2]);
+
+    // The credit of the remaining sender grows when a sender ends.
+    config::exchg_node_buffer_size_bytes = 2;
+    sender->decrement_senders(1);
+    EXPECT_EQ(sender->_sender_credit(), 2);
+    EXPECT_FALSE(responded[2]);
+    block.clear();
+    EXPECT_TRUE(sender->get_batch(&block, &eos));
+    EXPECT_TRUE(responded[2]);
+    EXPECT_TRUE(sender->_pending_closures.empty());
+    sender->close();
+}
+
 TEST_F(DataStreamRecvrTest, TestRemoteMultiSender) {
     create_recvr(3, false);
     EXPECT_EQ(recvr->sender_queues().size(), 1);
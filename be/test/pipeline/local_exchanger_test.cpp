@@ -25,6 +25,7 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "thrift_builder.h"
+#include "util/defer_op.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
 #include "vec/data_types/data_type.h"
@@ -1263,4 +1264,203 @@ TEST_F(LocalExchangerTest, TestShuffleExchangerWrongMap) {
                         .is<ErrorCode::INTERNAL_ERROR>());
     }
 }
+
+TEST_F(LocalExchangerTest, SpscRing) {
+    SpscRing<int> ring(2);
+    int item = 0;
+    EXPECT_FALSE(ring.try_pop(item));
+    ring.push(1);
+    ring.push(2);
+    EXPECT_TRUE(ring.full());
+    EXPECT_EQ(ring.size_approx(), 2);
+    EXPECT_TRUE(ring.try_pop(item));
+    EXPECT_EQ(item, 1);
+    EXPECT_FALSE(ring.full());
+    ring.push(3);
+    EXPECT_TRUE(ring.try_pop(item));
+    EXPECT_EQ(item, 2);
+    EXPECT_TRUE(ring.try_pop(item));
+    EXPECT_EQ(item, 3);
+    EXPECT_FALSE(ring.try_pop(item));
+    EXPECT_EQ(ring.size_approx(), 0);
+}
+
+TEST_F(LocalExchangerTest, ShuffleExchangerWithSpscRing) {
+    int num_sink = 2;
+    int num_sources = 2;
+    int num_partitions = 2;
+    int free_block_limit = 0;
+    std::map<int, int> shuffle_idx_to_instance_idx;
+    for (int i = 0; i < num_partitions; i++) {
+        shuffle_idx_to_instance_idx[i] = i;
+    }
+    config::local_exchange_buffer_mem_limit = 1024 * 1024;
+    // The second block of each sink overflows to the shared queue.
+    auto origin_ring_capacity = config::local_shuffle_spsc_ring_capacity;
+    config::local_shuffle_spsc_ring_capacity = 1;
+    Defer defer {[&]() { config::local_shuffle_spsc_ring_capacity = origin_ring_capacity; }};
+
+    std::vector<std::unique_ptr<LocalExchangeSinkLocalState>> _sink_local_states;
+    std::vector<std::unique_ptr<LocalExchangeSourceLocalState>> _local_states;
+    _sink_local_states.resize(num_sink);
+    _local_states.resize(num_sources);
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_partitions);
+    shared_state->exchanger = ShuffleExchanger::create_unique(num_sink, num_sources, num_partitions,
+                                                              free_block_limit);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+
+    auto* exchanger = (ShuffleExchanger*)shared_state->exchanger.get();
+    EXPECT_EQ(exchanger->_rings.size(), static_cast<size_t>(num_sink * num_sources));
+    for (size_t i = 0; i < num_sink; i++) {
+        _sink_local_states[i].reset(new LocalExchangeSinkLocalState(nullptr, nullptr));
+        _sink_local_states[i]->_exchanger = shared_state->exchanger.get();
+        _sink_local_states[i]->_compute_hash_value_timer =
+                ADD_TIMER(profile, "ComputeHashValueTime" + std::to_string(i));
+        _sink_local_states[i]->_distribute_timer =
+                ADD_TIMER(profile, "distribute_timer" + std::to_string(i));
+        _sink_local_states[i]->_partitioner.reset(
+                new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(
+                        num_partitions));
+        auto texpr =
+                TExprNodeBuilder(TExprNodeType::SLOT_REF,
+                                 TTypeDescBuilder()
+                                         .set_types(TTypeNodeBuilder()
+                                                            .set_type(TTypeNodeType::SCALAR)
+                                                            .set_scalar_type(TPrimitiveType::INT)
+                                                            .build())
+                                         .build(),
+                                 0)
+                        .set_slot_ref(TSlotRefBuilder(0, 0).build())
+                        .build();
+        auto slot = doris::vectorized::VSlotRef::create_shared(texpr);
+        slot->_column_id = 0;
+        ((vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>*)_sink_local_states[i]
+                 ->_partitioner.get())
+                ->_partition_expr_ctxs.push_back(
+                        std::make_shared<doris::vectorized::VExprContext>(slot));
+        _sink_local_states[i]->_channel_id = i;
+        _sink_local_states[i]->_shared_state = shared_state.get();
+        _sink_local_states[i]->_dependency = sink_dep.get();
+        _sink_local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "SinkMemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+    }
+    for (size_t i = 0; i < num_sources; i++) {
+        _local_states[i].reset(new LocalExchangeSourceLocalState(nullptr, nullptr));
+        _local_states[i]->_exchanger = shared_state->exchanger.get();
+        _local_states[i]->_get_block_failed_counter =
+                ADD_TIMER(profile, "_get_block_failed_counter" + std::to_string(i));
+        _local_states[i]->_copy_data_timer =
+                ADD_TIMER(profile, "_copy_data_timer" + std::to_string(i));
+        _local_states[i]->_channel_id = i;
+        _local_states[i]->_shared_state = shared_state.get();
+        _local_states[i]->_dependency = shared_state->get_dep_by_channel_id(i).front().get();
+        _local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+        shared_state->mem_counters[i] = _local_states[i]->_memory_used_counter;
+    }
+
+    // All the rows have the same value, so they are shuffled to the same source.
+    std::vector<uint32_t> hash_vals(10, 0);
+    int value = 1;
+    for (size_t i = 0; i < num_sink; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            vectorized::Block in_block;
+            vectorized::DataTypePtr int_type = std::make_shared<vectorized::DataTypeInt32>();
+            auto int_col0 = vectorized::ColumnInt32::create();
+            int_col0->insert_many_vals(value, 10);
+            in_block.insert({std::move(int_col0), int_type, "test_int_col0"});
+            EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                      {_sink_local_states[i]->_compute_hash_value_timer,
+                                       _sink_local_states[i]->_distribute_timer, nullptr},
+                                      {&_sink_local_states[i]->_channel_id,
+                                       _sink_local_states[i]->_partitioner.get(),
+                                       _sink_local_states[i].get(), &shuffle_idx_to_instance_idx}),
+                      Status::OK());
+        }
+    }
+    auto int_col = vectorized::ColumnInt32::create();
+    int_col->insert_many_vals(value, 10);
+    int_col->update_crcs_with_value(hash_vals.data(), PrimitiveType::TYPE_INT,
+                                    cast_set<uint32_t>(int_col->size()), 0, nullptr);
+    int channel_id = hash_vals.back() % num_partitions;
+    int other_channel_id = 1 - channel_id;
+    for (size_t i = 0; i < num_sink; i++) {
+        EXPECT_EQ(exchanger->_ring(cast_set<int>(i), channel_id).size_approx(), 1);
+        EXPECT_EQ(exchanger->_ring(cast_set<int>(i), other_channel_id).size_approx(), 0);
+    }
+    EXPECT_EQ(exchanger->_data_queue[channel_id].data_queue.size_approx(),
+              static_cast<size_t>(num_sink));
+    EXPECT_EQ(_local_states[channel_id]->_dependency->ready(), true);
+    EXPECT_EQ(_local_states[other_channel_id]->_dependency->ready(), false);
+
+    {
+        // The blocks in the rings and the shared queue are merged into one batch.
+        bool eos = false;
+        vectorized::Block block;
+        EXPECT_EQ(exchanger->get_block(
+                          _runtime_state.get(), &block, &eos,
+                          {nullptr, nullptr, _local_states[channel_id]->_copy_data_timer},
+                          {channel_id, _local_states[channel_id].get()}),
+                  Status::OK());
+        EXPECT_EQ(block.rows(), 40);
+        EXPECT_EQ(eos, false);
+        EXPECT_EQ(_local_states[channel_id]->_dependency->ready(), false);
+        EXPECT_EQ(shared_state->mem_usage, 0);
+    }
+    for (size_t i = 0; i < num_sink; i++) {
+        shared_state->sub_running_sink_operators();
+    }
+    for (int i = 0; i < num_sources; i++) {
+        bool eos = false;
+        vectorized::Block block;
+        EXPECT_EQ(exchanger->get_block(_runtime_state.get(), &block, &eos,
+                                       {nullptr, nullptr, _local_states[i]->_copy_data_timer},
+                                       {i, _local_states[i].get()}),
+                  Status::OK());
+        EXPECT_EQ(block.rows(), 0);
+        EXPECT_EQ(eos, true);
+    }
+}
+
+TEST_F(LocalExchangerTest, AdaptivePassthroughExchangerSkew) {
+    int num_sink = 2;
+    int num_sources = 4;
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_sources);
+    shared_state->exchanger = AdaptivePassthroughExchanger::create_unique(num_sink, num_sources, 0);
+    shared_state->_buffer_mem_limit = 1024;
+    for (int i = 0; i < num_sources; i++) {
+        shared_state->mem_counters[i] = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+    }
+    LocalExchangeSinkLocalState sink_local_state(nullptr, nullptr);
+    sink_local_state._shared_state = shared_state.get();
+    auto* exchanger = (AdaptivePassthroughExchanger*)shared_state->exchanger.get();
+
+    auto origin_skew_ratio = config::local_exchange_skew_ratio;
+    Defer defer {[&]() { config::local_exchange_skew_ratio = origin_skew_ratio; }};
+    shared_state->mem_counters[0]->update(1000);
+    config::local_exchange_skew_ratio = 0;
+    EXPECT_FALSE(exchanger->_is_skewed(&sink_local_state));
+
+    config::local_exchange_skew_ratio = 2;
+    EXPECT_TRUE(exchanger->_is_skewed(&sink_local_state));
+    EXPECT_EQ(exchanger->_queued_bytes(&sink_local_state, 0), 1000);
+
+    // Balanced queues are not skewed.
+    for (int i = 1; i < num_sources; i++) {
+        shared_state->mem_counters[i]->update(1000);
+    }
+    EXPECT_FALSE(exchanger->_is_skewed(&sink_local_state));
+
+    // Small queues are ignored.
+    for (int i = 0; i < num_sources; i++) {
+        shared_state->mem_counters[i]->update(i == 0 ? -900 : -1000);
+    }
+    EXPECT_FALSE(exchanger->_is_skewed(&sink_local_state));
+}
 } // namespace doris::pipeline
@@ -254,6 +254,7 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction2) {
     create_window_type(false, true, temp_window);
     create_local_state();
     // test with row_number agg function and has window: _get_next_for_unbounded_rows
+    EXPECT_TRUE(sink_local_state->_use_running_frame_batch);
 
     auto sink_data = [&](int row_count, bool eos) {
         std::vector<int64_t> data_vals;
@@ -323,6 +324,7 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction3) {
     create_window_type(false, true, temp_window);
     create_local_state();
     // test with row_number agg function and has window: _get_next_for_unbounded_rows
+    EXPECT_TRUE(sink_local_state->_use_running_frame_batch);
 
     auto sink_data = [&](int row_count, bool eos) {
         std::vector<int64_t> data_vals;
@@ -458,6 +460,58 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction4) {
     std::cout << "######### AggFunction with row_number test end #########" << std::endl;
 }
 
+TEST_F(AnalyticSinkOperatorTest, SlidingMaxFunction) {
+    int batch_size = 2;
+    Initialize(batch_size);
+    create_operator(true, 1, "max", {std::make_shared<DataTypeInt64>()});
+    sink->_agg_expr_ctxs.resize(1);
+    sink->_agg_expr_ctxs[0] =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    TAnalyticWindow temp_window;
+    temp_window.type = TAnalyticWindowType::ROWS;
+    TAnalyticWindowBoundary window_start;
+    window_start.type = TAnalyticWindowBoundaryType::PRECEDING;
+    window_start.__set_rows_offset_value(2);
+    temp_window.__set_window_start(window_start);
+    TAnalyticWindowBoundary window_end;
+    window_end.type = TAnalyticWindowBoundaryType::CURRENT_ROW;
+    temp_window.__set_window_end(window_end);
+    create_window_type(true, true, temp_window);
+    create_local_state();
+    // test with max agg function over rows between 2 preceding and current row
+    EXPECT_TRUE(sink_local_state->_use_sliding_extremum[0]);
+
+    std::vector<int64_t> data_vals {5, 3, 4, 1, 2, 0, 9, 7, 8, 6};
+    std::vector<int64_t> expect_vals {5, 5, 5, 4, 4, 2, 9, 9, 9, 8}; //max
+    for (int i = 0; i < 5; i++) {
+        std::vector<int64_t> block_vals(data_vals.begin() + i * batch_size,
+                                        data_vals.begin() + (i + 1) * batch_size);
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>(block_vals);
+        auto st = sink->sink(state.get(), &block, i == 4);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    for (int i = 0; i < 5; i++) {
+        std::vector<int64_t> data_vals_tmp(data_vals.begin() + i * batch_size,
+                                           data_vals.begin() + (i + 1) * batch_size);
+        std::vector<int64_t> expect_vals_tmp(expect_vals.begin() + i * batch_size,
+                                             expect_vals.begin() + (i + 1) * batch_size);
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        std::cout << "source get from block is: \n" << block.dump_data() << std::endl;
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>(data_vals_tmp, expect_vals_tmp)));
+    }
+    vectorized::Block block2 = ColumnHelper::create_block<DataTypeInt64>({});
+    bool eos2 = false;
+    auto st2 = source->get_block(state.get(), &block2, &eos2);
+    EXPECT_TRUE(st2.ok()) << st2.msg();
+    EXPECT_EQ(block2.rows(), 0);
+    EXPECT_TRUE(eos2);
+}
+
 TEST_F(AnalyticSinkOperatorTest, AggFunction5) {
     int batch_size = 2;
     Initialize(batch_size);
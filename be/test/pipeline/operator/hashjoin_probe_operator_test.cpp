@@ -116,6 +116,8 @@ public:
         bool is_broadcast_join {false};
         bool null_safe_equal {false};
         bool has_other_join_conjuncts {false};
+        // Use the other join conjuncts as the conjuncts of the join node.
+        bool other_join_conjuncts_as_conjuncts {false};
     };
 
     // NOLINTNEXTLINE(readability-function-*)
@@ -127,6 +129,11 @@ public:
                 join_params.join_op_type, key_types, left_keys_nullable, right_keys_nullable,
                 join_params.is_mark_join, join_params.mark_join_conjuncts_size,
                 join_params.null_safe_equal, join_params.has_other_join_conjuncts);
+        if (join_params.other_join_conjuncts_as_conjuncts) {
+            tnode.__set_conjuncts(tnode.hash_join_node.other_join_conjuncts);
+            tnode.hash_join_node.other_join_conjuncts.clear();
+            tnode.hash_join_node.__isset.other_join_conjuncts = false;
+        }
 
         bool should_build_hash_table = true;
         if (join_params.is_broadcast_join) {
@@ -347,6 +354,43 @@ TEST_F(HashJoinProbeOperatorTest, InnerJoin) {
                          vectorized::Field::create_field<TYPE_STRING>("d")});
 }
 
+TEST_F(HashJoinProbeOperatorTest, InnerJoinAllProbeRowsMatched) {
+    auto sink_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
+    sink_block.insert(ColumnHelper::create_column_with_name<DataTypeString>(
+            {"a", "b", "c", "d", "e"}));
+
+    auto probe_block = ColumnHelper::create_block<DataTypeInt32>({4, 2, 5, 1});
+    probe_block.insert(ColumnHelper::create_column_with_name<DataTypeString>({"d", "b", "e", "a"}));
+
+    // Every probe row matches one build row, the probe columns are moved to the output.
+    Block output_block;
+    std::vector<Block> build_blocks = {sink_block};
+    std::vector<Block> probe_blocks;
+    probe_blocks.emplace_back(std::move(probe_block));
+    run_test({TJoinOp::INNER_JOIN}, {TPrimitiveType::INT, TPrimitiveType::STRING}, {false, false},
+             {false, false}, build_blocks, probe_blocks, output_block);
+
+    ASSERT_EQ(output_block.rows(), 4);
+
+    auto sorted_block = sort_block_by_columns(output_block);
+    std::cout << "Output block: " << sorted_block.dump_data() << std::endl;
+
+    for (size_t i : {0, 2}) {
+        check_column_values(*sorted_block.get_by_position(i).column,
+                            {vectorized::Field::create_field<TYPE_INT>(1),
+                             vectorized::Field::create_field<TYPE_INT>(2),
+                             vectorized::Field::create_field<TYPE_INT>(4),
+                             vectorized::Field::create_field<TYPE_INT>(5)});
+    }
+    for (size_t i : {1, 3}) {
+        check_column_values(*sorted_block.get_by_position(i).column,
+                            {vectorized::Field::create_field<TYPE_STRING>("a"),
+                             vectorized::Field::create_field<TYPE_STRING>("b"),
+                             vectorized::Field::create_field<TYPE_STRING>("d"),
+                             vectorized::Field::create_field<TYPE_STRING>("e")});
+    }
+}
+
 TEST_F(HashJoinProbeOperatorTest, InnerJoinEmptyBuildSide) {
     auto sink_block = ColumnHelper::create_block<DataTypeInt32>({});
     sink_block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeString>({}, {}));
@@ -427,6 +471,55 @@ TEST_F(HashJoinProbeOperatorTest, InnerJoinOtherConjuncts) {
                          vectorized::Field::create_field<TYPE_INT>(59)});
 }
 
+TEST_F(HashJoinProbeOperatorTest, InnerJoinLateMaterialization) {
+    auto sink_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
+    sink_block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeString>(
+            {"a", "b", "c", "d", "e"}, {0, 0, 0, 0, 1}));
+    sink_block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(
+            {51, 52, 59, 52, 200}, {0, 0, 0, 0, 1}));
+
+    auto probe_block =
+            ColumnHelper::create_nullable_block<DataTypeInt32>({1, 2, 3, 4, 5}, {0, 0, 0, 0, 1});
+    probe_block.insert(
+            ColumnHelper::create_column_with_name<DataTypeString>({"a", "b", "c", "d", "e"}));
+    probe_block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(
+            {101, 100, 102, 99, 200}, {0, 0, 0, 0, 1}));
+
+    // The columns not used by the conjuncts are gathered after the filter.
+    Block output_block;
+    std::vector<Block> build_blocks = {sink_block};
+    std::vector<Block> probe_blocks = {probe_block};
+    run_test({.join_op_type = TJoinOp::INNER_JOIN,
+              .has_other_join_conjuncts = true,
+              .other_join_conjuncts_as_conjuncts = true},
+             {TPrimitiveType::INT, TPrimitiveType::STRING}, {true, false}, {false, true},
+             build_blocks, probe_blocks, output_block);
+
+    ASSERT_EQ(output_block.rows(), 2);
+
+    auto sorted_block = sort_block_by_columns(output_block);
+    std::cout << "Output block: " << sorted_block.dump_data() << std::endl;
+
+    check_column_values(*sorted_block.get_by_position(0).column,
+                        {vectorized::Field::create_field<TYPE_INT>(1),
+                         vectorized::Field::create_field<TYPE_INT>(3)});
+    check_column_values(*sorted_block.get_by_position(1).column,
+                        {vectorized::Field::create_field<TYPE_STRING>("a"),
+                         vectorized::Field::create_field<TYPE_STRING>("c")});
+    check_column_values(*sorted_block.get_by_position(2).column,
+                        {vectorized::Field::create_field<TYPE_INT>(101),
+                         vectorized::Field::create_field<TYPE_INT>(102)});
+    check_column_values(*sorted_block.get_by_position(3).column,
+                        {vectorized::Field::create_field<TYPE_INT>(1),
+                         vectorized::Field::create_field<TYPE_INT>(3)});
+    check_column_values(*sorted_block.get_by_position(4).column,
+                        {vectorized::Field::create_field<TYPE_STRING>("a"),
+                         vectorized::Field::create_field<TYPE_STRING>("c")});
+    check_column_values(*sorted_block.get_by_position(5).column,
+                        {vectorized::Field::create_field<TYPE_INT>(51),
+                         vectorized::Field::create_field<TYPE_INT>(59)});
+}
+
 TEST_F(HashJoinProbeOperatorTest, InnerJoinNullSafeEqual) {
     auto sink_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
     sink_block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeString>(
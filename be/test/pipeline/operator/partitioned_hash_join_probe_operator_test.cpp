@@ -208,7 +208,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, spill_probe_blocks) {
     ASSERT_TRUE(st.ok()) << "spill probe blocks failed: " << st.to_string();
 
     std::cout << "wait for spill dependency ready" << std::endl;
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
     std::cout << "spill dependency ready" << std::endl;
@@ -267,7 +267,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverProbeBlocksFromDisk) {
     ASSERT_TRUE(has_data);
 
     // Wait for async recovery to complete
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -335,7 +335,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverProbeBlocksFromDiskLargeData
                             .ok());
 
         // Wait for async recovery to complete
-        while (local_state->_spill_dependency->_ready.load() == false) {
+        while (local_state->_spill_dependency->ready() == false) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
     }
@@ -387,7 +387,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverProbeBlocksFromDiskEmpty) {
                                                          test_partition, has_data)
                         .ok());
     ASSERT_TRUE(has_data);
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -432,7 +432,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverProbeBlocksFromDiskError) {
                                                          test_partition, has_data)
                         .ok());
     ASSERT_TRUE(has_data);
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -483,7 +483,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDisk) {
     ASSERT_TRUE(has_data);
 
     // Wait for async recovery
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -541,7 +541,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDiskCanceled)
     ASSERT_TRUE(has_data);
 
     // Wait for async recovery
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         _helper.runtime_state->_query_ctx->_exec_status.update(Status::Cancelled("test canceled"));
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
@@ -681,7 +681,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDiskEmpty) {
                         .ok());
     ASSERT_TRUE(has_data);
 
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -733,7 +733,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDiskLargeData
                                                              test_partition, has_data)
                             .ok());
 
-        while (local_state->_spill_dependency->_ready.load() == false) {
+        while (local_state->_spill_dependency->ready() == false) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
 
@@ -787,7 +787,7 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDiskError) {
                                                               test_partition, has_data);
 
     ASSERT_TRUE(status.ok()) << "recover build blocks failed: " << status.to_string();
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
@@ -1093,12 +1093,12 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, PullWithDiskRecovery) {
 
     st = probe_operator->pull(_helper.runtime_state.get(), &output_block, &eos);
     ASSERT_TRUE(st.ok()) << "Pull failed: " << st.to_string();
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
     st = probe_operator->pull(_helper.runtime_state.get(), &output_block, &eos);
-    while (local_state->_spill_dependency->_ready.load() == false) {
+    while (local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
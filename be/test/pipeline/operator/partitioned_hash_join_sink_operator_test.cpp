@@ -25,7 +25,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "common/config.h"
@@ -41,6 +43,7 @@
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_operators.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type_number.h"
@@ -210,11 +213,11 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, Sink) {
     vectorized::Block block;
     bool eos = true;
 
-    ASSERT_EQ(read_dependency->_ready.load(), false);
+    ASSERT_EQ(read_dependency->ready(), false);
     auto st = sink_operator->sink(_helper.runtime_state.get(), &block, eos);
     ASSERT_TRUE(st.ok()) << "Sink failed: " << st.to_string();
 
-    ASSERT_EQ(read_dependency->_ready.load(), true);
+    ASSERT_EQ(read_dependency->ready(), true);
 }
 
 TEST_F(PartitionedHashJoinSinkOperatorTest, SinkEosAndSpill) {
@@ -256,7 +259,7 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, SinkEosAndSpill) {
 
     // sink empty block
     sink_local_state->_shared_state->need_to_spill = false;
-    ASSERT_EQ(read_dependency->_ready.load(), false);
+    ASSERT_EQ(read_dependency->ready(), false);
     st = sink_operator->sink(_helper.runtime_state.get(), &block, false);
     ASSERT_TRUE(st.ok()) << "Sink failed: " << st.to_string();
 
@@ -267,23 +270,23 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, SinkEosAndSpill) {
     ASSERT_TRUE(st.ok()) << "Sink failed: " << st.to_string();
 
     sink_local_state->_shared_state->need_to_spill = true;
-    ASSERT_EQ(read_dependency->_ready.load(), false);
+    ASSERT_EQ(read_dependency->ready(), false);
     st = sink_operator->sink(_helper.runtime_state.get(), &block, false);
     ASSERT_TRUE(st.ok()) << "Sink failed: " << st.to_string();
 
-    while (sink_local_state->_spill_dependency->_ready.load() == false) {
+    while (sink_local_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
-    ASSERT_EQ(read_dependency->_ready.load(), false);
+    ASSERT_EQ(read_dependency->ready(), false);
     st = sink_operator->sink(_helper.runtime_state.get(), &block, true);
     ASSERT_TRUE(st.ok()) << "Sink failed: " << st.to_string();
 
-    while (read_dependency->_ready.load() == false) {
+    while (read_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
-    ASSERT_TRUE(sink_local_state->_dependency->_ready.load());
+    ASSERT_TRUE(sink_local_state->_dependency->ready());
 }
 
 TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemoryEmpty) {
@@ -300,6 +303,9 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemoryEmpty) {
 }
 
 TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemory) {
+    auto origin_ratio = config::hash_join_spill_partition_ratio;
+    config::hash_join_spill_partition_ratio = 1;
+    Defer defer {[&]() { config::hash_join_spill_partition_ratio = origin_ratio; }};
     auto [_, sink_operator] = _helper.create_operators();
 
     std::shared_ptr<MockPartitionedHashJoinSharedState> shared_state;
@@ -361,7 +367,7 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemory) {
     ASSERT_TRUE(sink_state->_shared_state->need_to_spill);
 
     std::cout << "wait for spill dependency ready" << std::endl;
-    while (sink_state->_spill_dependency->_ready.load() == false) {
+    while (sink_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
     std::cout << "spill dependency ready" << std::endl;
@@ -382,7 +388,7 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemory) {
     status = sink_state->revoke_memory(_helper.runtime_state.get(), nullptr);
     ASSERT_TRUE(status.ok()) << "Revoke memory failed: " << status.to_string();
     std::cout << "wait for spill dependency ready" << std::endl;
-    while (sink_state->_spill_dependency->_ready.load() == false) {
+    while (sink_state->_spill_dependency->ready() == false) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
     std::cout << "spill dependency ready" << std::endl;
@@ -390,4 +396,90 @@ TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemory) {
     ASSERT_EQ(written_rows + 3 * 1024 * 1024, written_rows_counter->value());
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(PartitionedHashJoinSinkOperatorTest, RevokeMemoryPartially) {
+    auto origin_ratio = config::hash_join_spill_partition_ratio;
+    config::hash_join_spill_partition_ratio = 0.5;
+    Defer defer {[&]() { config::hash_join_spill_partition_ratio = origin_ratio; }};
+    auto [_, sink_operator] = _helper.create_operators();
+
+    std::shared_ptr<MockPartitionedHashJoinSharedState> shared_state;
+    auto sink_state = _helper.create_sink_local_state(_helper.runtime_state.get(),
+                                                      sink_operator.get(), shared_state);
+
+    auto child = std::dynamic_pointer_cast<MockChildOperator>(sink_operator->child());
+    RowDescriptor row_desc(_helper.runtime_state->desc_tbl(), {1}, {false});
+    child->_row_descriptor = row_desc;
+
+    const auto& tnode = sink_operator->_tnode;
+    auto partitioner = std::make_unique<SpillPartitionerType>(sink_operator->_partition_count);
+    auto status = partitioner->init({tnode.hash_join_node.eq_join_conjuncts[0].right});
+    ASSERT_TRUE(status.ok()) << "Init partitioner failed: " << status.to_string();
+    status = partitioner->prepare(_helper.runtime_state.get(), sink_operator->_child->row_desc());
+    ASSERT_TRUE(status.ok()) << "Prepare partitioner failed: " << status.to_string();
+    sink_state->_partitioner = std::move(partitioner);
+    sink_state->_shared_state->need_to_spill = false;
+
+    for (uint32_t i = 0; i != sink_operator->_partition_count; ++i) {
+        auto& spilling_stream = sink_state->_shared_state->spilled_streams[i];
+        auto st = (ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                _helper.runtime_state.get(), spilling_stream,
+                print_id(_helper.runtime_state->query_id()), fmt::format("hash_build_sink_{}", i),
+                sink_operator->node_id(), std::numeric_limits<int32_t>::max(),
+                std::numeric_limits<size_t>::max(), sink_state->operator_profile()));
+        ASSERT_TRUE(st.ok()) << "Register spill stream failed: " << st.to_string();
+    }
+
+    auto& inner_sink = sink_operator->_inner_sink_operator;
+    auto inner_sink_local_state = std::make_unique<MockHashJoinBuildSinkLocalState>(
+            inner_sink.get(), sink_state->_shared_state->inner_runtime_state.get());
+    inner_sink_local_state->_hash_table_memory_usage =
+            sink_state->custom_profile()->add_counter("HashTableMemoryUsage", TUnit::BYTES);
+    inner_sink_local_state->_build_arena_memory_usage =
+            sink_state->operator_profile()->add_counter("BuildArenaMemoryUsage", TUnit::BYTES);
+
+    std::vector<int32_t> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+    inner_sink_local_state->_build_side_mutable_block =
+            vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data);
+    sink_state->_shared_state->inner_runtime_state->emplace_sink_local_state(
+            0, std::move(inner_sink_local_state));
+    sink_state->_finish_dependency =
+            Dependency::create_shared(sink_operator->operator_id(), sink_operator->node_id(),
+                                      "HashJoinBuildFinishDependency", true);
+
+    status = sink_state->revoke_memory(_helper.runtime_state.get(), nullptr);
+    ASSERT_TRUE(status.ok()) << "Revoke memory failed: " << status.to_string();
+    while (sink_state->_spill_dependency->ready() == false) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Half of the partitions are spilled, the rows of the others stay in memory.
+    const auto& spilled_partitions = sink_state->_shared_state->spilled_partitions;
+    const auto& partitioned_blocks = sink_state->_shared_state->partitioned_build_blocks;
+    size_t num_spilled = 0;
+    size_t in_memory_rows = 0;
+    for (uint32_t i = 0; i != sink_operator->_partition_count; ++i) {
+        const auto rows = partitioned_blocks[i] ? partitioned_blocks[i]->rows() : 0;
+        if (spilled_partitions[i]) {
+            ++num_spilled;
+            EXPECT_EQ(rows, 0) << i;
+        } else {
+            in_memory_rows += rows;
+        }
+    }
+    EXPECT_EQ(num_spilled, (sink_operator->_partition_count + 1) / 2);
+    auto* written_rows_counter = sink_state->custom_profile()->get_counter("SpillWriteRows");
+    EXPECT_GT(written_rows_counter->value(), 0);
+    EXPECT_GT(in_memory_rows, 0);
+    EXPECT_EQ(written_rows_counter->value() + in_memory_rows, data.size() - 1);
+
+    // Without memory pressure the in-memory partitions are not spilled.
+    status = sink_state->revoke_memory(_helper.runtime_state.get(), nullptr, false);
+    ASSERT_TRUE(status.ok()) << "Revoke memory failed: " << status.to_string();
+    while (sink_state->_spill_dependency->ready() == false) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(std::count(spilled_partitions.begin(), spilled_partitions.end(), true), num_spilled);
+}
+
+} // namespace doris::pipeline
@@ -188,6 +188,7 @@ PartitionedHashJoinProbeLocalState* PartitionedHashJoinTestHelper::create_probe_
             Dependency::create_shared(0, 0, "PartitionedHashJoinProbeOperatorTestSpillDep", true);
     shared_state->spilled_streams.resize(probe_operator->_partition_count);
     shared_state->partitioned_build_blocks.resize(probe_operator->_partition_count);
+    shared_state->spilled_partitions.assign(probe_operator->_partition_count, false);
 
     shared_state->inner_runtime_state = std::make_unique<MockRuntimeState>();
     shared_state->inner_shared_state = std::make_shared<MockHashJoinSharedState>();
@@ -220,6 +221,7 @@ PartitionedHashJoinSinkLocalState* PartitionedHashJoinTestHelper::create_sink_lo
 
     shared_state->spilled_streams.resize(sink_operator->_partition_count);
     shared_state->partitioned_build_blocks.resize(sink_operator->_partition_count);
+    shared_state->spilled_partitions.assign(sink_operator->_partition_count, false);
 
     shared_state->inner_runtime_state = std::make_unique<MockRuntimeState>();
     shared_state->inner_shared_state = std::make_shared<MockHashJoinSharedState>();
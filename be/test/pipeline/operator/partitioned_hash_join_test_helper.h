@@ -53,6 +53,7 @@ public:
     void init(size_t partition_count) {
         spilled_streams.resize(partition_count);
         partitioned_build_blocks.resize(partition_count);
+        spilled_partitions.assign(partition_count, false);
     }
 };
 
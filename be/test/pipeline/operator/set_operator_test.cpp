@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -554,4 +555,44 @@ TEST_F(ExceptOperatorTest, test_refresh_hash_table) {
         EXPECT_TRUE(block.empty());
     }
 }
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(ExceptOperatorTest, test_partition_spill_block) {
+    init_op(2, {std::make_shared<DataTypeInt64>()});
+    sink_op->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    probe_sink_ops[0]->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+
+    init_local_state();
+    shared_state->init_spill_params(4);
+    EXPECT_EQ(shared_state->spilled_streams.size(), 2);
+    EXPECT_EQ(shared_state->spilled_streams[1].size(), 4);
+
+    // The rows with the same keys of different children must be in the same partition.
+    auto partition_of_keys = [&](const std::vector<int64_t>& keys) {
+        Block block = ColumnHelper::create_block<DataTypeInt64>(keys);
+        std::vector<std::unique_ptr<MutableBlock>> partitioned_blocks;
+        EXPECT_TRUE(shared_state->partition_spill_block(block, partitioned_blocks));
+        EXPECT_EQ(partitioned_blocks.size(), 4);
+        std::map<int64_t, size_t> partitions;
+        size_t rows = 0;
+        for (size_t i = 0; i != partitioned_blocks.size(); ++i) {
+            if (!partitioned_blocks[i]) {
+                continue;
+            }
+            auto partitioned_block = partitioned_blocks[i]->to_block();
+            const auto& column =
+                    assert_cast<const ColumnInt64&>(*partitioned_block.get_by_position(0).column);
+            for (size_t row = 0; row != column.size(); ++row) {
+                partitions[column.get_element(row)] = i;
+            }
+            rows += partitioned_block.rows();
+        }
+        EXPECT_EQ(rows, keys.size());
+        return partitions;
+    };
+
+    auto build_partitions = partition_of_keys({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    auto probe_partitions = partition_of_keys({10, 8, 6, 4, 2, 1, 3, 5, 7, 9});
+    EXPECT_EQ(build_partitions, probe_partitions);
+}
+} // namespace doris::pipeline
@@ -31,6 +31,7 @@
 #include "testutil/mock/mock_runtime_state.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
 
 namespace doris::pipeline {
 class SpillSortSourceOperatorTest : public testing::Test {
@@ -250,7 +251,7 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpill) {
         st = source_operator->get_block(_helper.runtime_state.get(), &block, &eos);
         ASSERT_TRUE(st.ok()) << "get_block failed: " << st.to_string();
 
-        while (local_state->_spill_dependency->_ready.load() == false) {
+        while (local_state->_spill_dependency->ready() == false) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
         if (block.empty()) {
@@ -402,7 +403,7 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpill2) {
         st = source_operator->get_block(_helper.runtime_state.get(), &block, &eos);
         ASSERT_TRUE(st.ok()) << "get_block failed: " << st.to_string();
 
-        while (local_state->_spill_dependency->_ready.load() == false) {
+        while (local_state->_spill_dependency->ready() == false) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
         if (block.empty()) {
@@ -552,7 +553,7 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpillError) {
             break;
         }
 
-        while (local_state->_spill_dependency->_ready.load() == false) {
+        while (local_state->_spill_dependency->ready() == false) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
         if (block.empty()) {
@@ -576,4 +577,56 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpillError) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
+TEST_F(SpillSortSourceOperatorTest, ReadSpilledColumns) {
+    vectorized::SpillStreamSPtr spill_stream;
+    auto st = ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            _helper.runtime_state.get(), spill_stream, print_id(_helper.runtime_state->query_id()),
+            "sort", 0, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max(),
+            _helper.operator_profile.get());
+    ASSERT_TRUE(st.ok()) << "register_spill_stream failed: " << st.to_string();
+
+    std::vector<int32_t> data;
+    std::vector<std::string> data2;
+    std::vector<int64_t> data3;
+    for (size_t i = 0; i != 10; ++i) {
+        data.emplace_back(i);
+        data2.emplace_back(std::to_string(i % 3));
+        data3.emplace_back(i * 10);
+    }
+    auto input_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data);
+    input_block.insert(
+            vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeString>(data2));
+    input_block.insert(
+            vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeInt64>(data3));
+    st = spill_stream->spill_block(_helper.runtime_state.get(), input_block, true);
+    ASSERT_TRUE(st.ok()) << "spill_block failed: " << st.to_string();
+
+    spill_stream->set_read_counters(_helper.operator_profile.get());
+    vectorized::Block block;
+    bool eos = false;
+    st = spill_stream->read_next_block_sync(&block, &eos);
+    ASSERT_TRUE(st.ok()) << "read_next_block_sync failed: " << st.to_string();
+    ASSERT_FALSE(eos);
+    EXPECT_TRUE(vectorized::ColumnHelper::block_equal(block, input_block));
+
+    auto reader = spill_stream->create_separate_reader();
+    reader->set_counters(_helper.operator_profile.get());
+    reader->set_read_columns({2, 0});
+    st = reader->open();
+    ASSERT_TRUE(st.ok()) << "open failed: " << st.to_string();
+    st = reader->read(&block, &eos);
+    ASSERT_TRUE(st.ok()) << "read failed: " << st.to_string();
+    ASSERT_FALSE(eos);
+    auto expected_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt64>(data3);
+    expected_block.insert(
+            vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeInt32>(data));
+    EXPECT_TRUE(vectorized::ColumnHelper::block_equal(block, expected_block));
+
+    st = reader->read(&block, &eos);
+    ASSERT_TRUE(st.ok()) << "read failed: " << st.to_string();
+    EXPECT_TRUE(eos);
+    (void)reader->close();
+    ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
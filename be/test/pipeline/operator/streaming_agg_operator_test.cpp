@@ -237,6 +237,188 @@ TEST_F(StreamingAggOperatorTest, test2) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, test_flush_hash_table) {
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    {
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 2, 2, 2, 3}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+    }
+
+    {
+        // The table is full, the block is passed through and the table is flushed.
+        local_state->should_not_do_pre_agg = true;
+        local_state->_flushing_hash_table = true;
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({2, 2, 2, 2, 4, 4}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 6);
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 3);
+        EXPECT_FALSE(local_state->_flushing_hash_table);
+        EXPECT_EQ(local_state->_get_hash_table_size(), 0);
+        EXPECT_TRUE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        local_state->should_not_do_pre_agg = false;
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 5, 5}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 2);
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_EQ(block.rows(), 2);
+    }
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+}
+
+TEST_F(StreamingAggOperatorTest, test_adaptive_bypass) {
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    const bool origin_enable = config::enable_streaming_agg_adaptive_bypass;
+    const int64_t origin_min_sample_rows = config::streaming_agg_bypass_min_sample_rows;
+    const int32_t origin_probe_interval = config::streaming_agg_bypass_probe_interval;
+    config::enable_streaming_agg_adaptive_bypass = true;
+    config::streaming_agg_bypass_min_sample_rows = 1;
+    config::streaming_agg_bypass_probe_interval = 1;
+
+    {
+        // All the keys are distinct, there is no reduction.
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3, 4, 5, 6}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 6);
+        EXPECT_TRUE(local_state->_pre_agg_bypassed);
+    }
+
+    {
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({7, 8, 9, 10, 11, 12}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 6);
+        EXPECT_TRUE(local_state->_pre_agg_bypassed);
+
+        bool eos = false;
+        vectorized::Block output;
+        st = op->pull(state.get(), &output, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(output.rows(), 6);
+    }
+
+    {
+        // The key distribution changes, the pre-aggregation is re-enabled.
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({13, 13, 13, 13, 13, 13}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(local_state->_pre_agg_bypassed);
+        EXPECT_EQ(local_state->_get_hash_table_size(), 7);
+    }
+
+    config::enable_streaming_agg_adaptive_bypass = origin_enable;
+    config::streaming_agg_bypass_min_sample_rows = origin_min_sample_rows;
+    config::streaming_agg_bypass_probe_interval = origin_probe_interval;
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+}
+
 TEST_F(StreamingAggOperatorTest, test3) {
     op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
             pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_cpu_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "util/time.h"
+
+namespace doris::pipeline {
+
+void cpu_profile_test_function() {}
+
+static CpuProfileSample make_sample(int32_t fragment_id, int32_t node_id,
+                                    std::vector<void*> frames) {
+    CpuProfileSample sample;
+    sample.tag = {1, 2, fragment_id, node_id, CpuProfileScope::OPERATOR};
+    sample.depth = static_cast<uint32_t>(frames.size());
+    std::copy(frames.begin(), frames.end(), sample.frames.begin());
+    return sample;
+}
+
+TEST(PipelineCpuProfilerTest, test_ring_buffer_drain) {
+    CpuProfileRingBuffer buffer(3);
+    EXPECT_EQ(buffer.capacity(), 4);
+    for (int i = 0; i < 10; ++i) {
+        auto* sample = buffer.begin_append();
+        *sample = make_sample(i, 0, {});
+        buffer.end_append();
+    }
+    std::vector<CpuProfileSample> samples;
+    buffer.drain(samples);
+    // The oldest slot may be overwritten by the signal handler, only capacity - 1 are kept.
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_EQ(samples[0].tag.fragment_id, 7);
+    EXPECT_EQ(samples[2].tag.fragment_id, 9);
+
+    // Drained samples are not returned again.
+    samples.clear();
+    buffer.drain(samples);
+    EXPECT_TRUE(samples.empty());
+
+    auto* sample = buffer.begin_append();
+    *sample = make_sample(10, 0, {});
+    buffer.end_append();
+    buffer.drain(samples);
+    ASSERT_EQ(samples.size(), 1);
+    EXPECT_EQ(samples[0].tag.fragment_id, 10);
+}
+
+TEST(PipelineCpuProfilerTest, test_fold_stacks) {
+    auto* leaf = reinterpret_cast<char*>(&cpu_profile_test_function) + 1;
+    auto* root = reinterpret_cast<void*>(0x10);
+    FragmentCpuProfile profile;
+    profile.add(make_sample(0, 3, {leaf, root}));
+    profile.add(make_sample(0, 3, {leaf, root}));
+    profile.add(make_sample(0, 5, {leaf, root}));
+    EXPECT_EQ(profile.samples, 3);
+    ASSERT_EQ(profile.stacks.size(), 2);
+    // The root frame is the first.
+    EXPECT_EQ(profile.stacks.begin()->first.frames.front(), root);
+    EXPECT_EQ(profile.stacks.begin()->second, 2);
+
+    auto folded = profile.to_folded([](CpuProfileScope scope, int32_t node_id) {
+        return "OP" + std::to_string(node_id);
+    });
+    EXPECT_EQ(folded.find("OP3;"), 0);
+    EXPECT_NE(folded.find("cpu_profile_test_function 2\n"), std::string::npos);
+    EXPECT_NE(folded.find("cpu_profile_test_function 1\n"), std::string::npos);
+
+    const int32_t max_stacks = config::pipeline_cpu_profile_max_stacks;
+    config::pipeline_cpu_profile_max_stacks = 2;
+    profile.add(make_sample(0, 6, {root}));
+    profile.add(make_sample(0, 3, {leaf, root}));
+    config::pipeline_cpu_profile_max_stacks = max_stacks;
+    EXPECT_EQ(profile.samples, 5);
+    EXPECT_EQ(profile.truncated_samples, 1);
+    EXPECT_EQ(profile.stacks.size(), 2);
+}
+
+TEST(PipelineCpuProfilerTest, test_scoped_tag) {
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    {
+        // Not in a fragment, the operator is not tagged.
+        ScopedCpuProfileOperator op(3, CpuProfileScope::OPERATOR);
+        EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::NONE);
+    }
+    {
+        ScopedCpuProfileFragment fragment(query_id, 4);
+        EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::TASK);
+        EXPECT_EQ(cpu_profile_tag.fragment_id, 4);
+        {
+            ScopedCpuProfileOperator op(3, CpuProfileScope::OPERATOR);
+            {
+                ScopedCpuProfileOperator sink(5, CpuProfileScope::SINK);
+                EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::SINK);
+                EXPECT_EQ(cpu_profile_tag.node_id, 5);
+            }
+            EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::OPERATOR);
+            EXPECT_EQ(cpu_profile_tag.node_id, 3);
+        }
+        EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::TASK);
+    }
+    EXPECT_EQ(cpu_profile_tag.scope, CpuProfileScope::NONE);
+}
+
+TEST(PipelineCpuProfilerTest, test_sample_fragment) {
+    const bool enabled = config::enable_pipeline_cpu_profile;
+    config::enable_pipeline_cpu_profile = true;
+    auto* profiler = PipelineCpuProfiler::instance();
+    ASSERT_TRUE(profiler->start().ok());
+
+    TUniqueId query_id;
+    query_id.__set_hi(3);
+    query_id.__set_lo(4);
+    profiler->begin_fragment(query_id, 0);
+    {
+        ScopedCpuProfileFragment fragment(query_id, 0);
+        ScopedCpuProfileOperator op(1, CpuProfileScope::OPERATOR);
+        // Burn enough CPU time for a few samples.
+        volatile uint64_t sum = 0;
+        const int64_t begin = MonotonicMillis();
+        while (MonotonicMillis() - begin < 500) {
+            for (int i = 0; i < 10000; ++i) {
+                sum = sum + i;
+            }
+        }
+    }
+    auto profile = profiler->end_fragment(query_id, 0);
+    EXPECT_GT(profile.samples, 0);
+    for (const auto& [stack, count] : profile.stacks) {
+        EXPECT_EQ(stack.scope, CpuProfileScope::OPERATOR);
+        EXPECT_EQ(stack.node_id, 1);
+    }
+    // Ended fragments do not collect samples.
+    EXPECT_EQ(profiler->end_fragment(query_id, 0).samples, 0);
+
+    profiler->stop();
+    config::enable_pipeline_cpu_profile = enabled;
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_event_trace.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include <vector>
+
+namespace doris::pipeline {
+
+static PipelineTraceEvent make_event(int64_t ts, int64_t query_id_lo,
+                                     PipelineTraceEventType type) {
+    return {ts, ts, 1, query_id_lo, 0, 0, 0, 0, type};
+}
+
+TEST(PipelineEventTraceTest, test_ring_buffer_overwrite) {
+    PipelineTraceRingBuffer buffer(3, 0, "test");
+    EXPECT_EQ(buffer.capacity(), 4);
+    for (int i = 0; i < 10; ++i) {
+        buffer.append(make_event(i, 0, PipelineTraceEventType::YIELD));
+    }
+    std::vector<PipelineTraceEvent> events;
+    buffer.snapshot(nullptr, events);
+    // The oldest slot may be overwritten by a concurrent writer, only capacity - 1 are kept.
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0].begin_ns, 7);
+    EXPECT_EQ(events[2].begin_ns, 9);
+
+    buffer.clear();
+    events.clear();
+    buffer.snapshot(nullptr, events);
+    EXPECT_TRUE(events.empty());
+
+    buffer.append(make_event(10, 0, PipelineTraceEventType::YIELD));
+    buffer.snapshot(nullptr, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].begin_ns, 10);
+}
+
+TEST(PipelineEventTraceTest, test_ring_buffer_filter_query) {
+    PipelineTraceRingBuffer buffer(16, 0, "test");
+    for (int i = 0; i < 6; ++i) {
+        buffer.append(make_event(i, i % 2, PipelineTraceEventType::BLOCK));
+    }
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(1);
+    std::vector<PipelineTraceEvent> events;
+    buffer.snapshot(&query_id, events);
+    ASSERT_EQ(events.size(), 3);
+    for (const auto& event : events) {
+        EXPECT_EQ(event.query_id_lo, 1);
+    }
+}
+
+TEST(PipelineEventTraceTest, test_chrome_trace_json) {
+    auto* tracer = PipelineEventTracer::instance();
+    tracer->clear();
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    trace_pipeline_event(PipelineTraceEventType::EXECUTE, query_id, 3, 4, 5, 0, 1000, 3000);
+    trace_pipeline_event(PipelineTraceEventType::BLOCK, query_id, 3, 4, 5, 6, 3000, 3000);
+
+    auto json = tracer->to_chrome_trace_json(&query_id);
+    rapidjson::Document doc;
+    doc.Parse(json.data(), json.size());
+    ASSERT_FALSE(doc.HasParseError()) << json;
+    const auto& events = doc["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    int num_spans = 0;
+    int num_instants = 0;
+    for (const auto& event : events.GetArray()) {
+        std::string ph = event["ph"].GetString();
+        if (ph == "X") {
+            ++num_spans;
+            EXPECT_STREQ(event["name"].GetString(), "Execute");
+            EXPECT_DOUBLE_EQ(event["ts"].GetDouble(), 1.0);
+            EXPECT_DOUBLE_EQ(event["dur"].GetDouble(), 2.0);
+            EXPECT_EQ(event["args"]["pipeline_id"].GetInt(), 3);
+            EXPECT_EQ(event["args"]["core_id"].GetInt(), 5);
+        } else if (ph == "i") {
+            ++num_instants;
+            EXPECT_STREQ(event["name"].GetString(), "Block");
+            EXPECT_EQ(event["args"]["dependency_id"].GetInt(), 6);
+        }
+    }
+    EXPECT_EQ(num_spans, 1);
+    EXPECT_EQ(num_instants, 1);
+
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(2);
+    other_query_id.__set_lo(2);
+    json = tracer->to_chrome_trace_json(&other_query_id);
+    EXPECT_EQ(json.find("Execute"), std::string::npos);
+    tracer->clear();
+}
+
+} // namespace doris::pipeline
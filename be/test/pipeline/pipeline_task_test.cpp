@@ -334,7 +334,7 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_FALSE(task->_opened);
         EXPECT_FALSE(_query_ctx->get_execution_dependency()->ready());
-        EXPECT_FALSE(_query_ctx->get_execution_dependency()->_blocked_task.empty());
+        EXPECT_FALSE(_query_ctx->get_execution_dependency()->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::BLOCKED);
     }
     {
@@ -349,7 +349,7 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_FALSE(task->_opened);
         EXPECT_FALSE(task->_execution_dependencies.back()->ready());
-        EXPECT_FALSE(task->_execution_dependencies.back()->_blocked_task.empty());
+        EXPECT_FALSE(task->_execution_dependencies.back()->_num_blocked_tasks.load() == 0);
         EXPECT_TRUE(task->_read_dependencies.empty());
         EXPECT_TRUE(task->_write_dependencies.empty());
         EXPECT_TRUE(task->_finish_dependencies.empty());
@@ -373,7 +373,7 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
         EXPECT_TRUE(task->_opened);
         EXPECT_FALSE(read_dep->ready());
         EXPECT_TRUE(write_dep->ready());
-        EXPECT_FALSE(read_dep->_blocked_task.empty());
+        EXPECT_FALSE(read_dep->_num_blocked_tasks.load() == 0);
         source_finish_dep =
                 _runtime_state->get_local_state_result(task->_operators.front()->operator_id())
                         .value()
@@ -392,7 +392,7 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
         EXPECT_FALSE(done);
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_FALSE(source_finish_dep->ready());
-        EXPECT_FALSE(source_finish_dep->_blocked_task.empty());
+        EXPECT_FALSE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::BLOCKED);
     }
     {
@@ -738,7 +738,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY) {
         EXPECT_TRUE(task->_opened);
         EXPECT_FALSE(read_dep->ready());
         EXPECT_TRUE(write_dep->ready());
-        EXPECT_FALSE(read_dep->_blocked_task.empty());
+        EXPECT_FALSE(read_dep->_num_blocked_tasks.load() == 0);
         source_finish_dep =
                 _runtime_state->get_local_state_result(task->_operators.front()->operator_id())
                         .value()
@@ -761,7 +761,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY) {
         EXPECT_FALSE(done);
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_TRUE(source_finish_dep->ready());
-        EXPECT_TRUE(source_finish_dep->_blocked_task.empty());
+        EXPECT_TRUE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::RUNNABLE);
     }
     {
@@ -779,7 +779,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY) {
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_FALSE(task->_spilling);
         EXPECT_TRUE(source_finish_dep->ready());
-        EXPECT_TRUE(source_finish_dep->_blocked_task.empty());
+        EXPECT_TRUE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::RUNNABLE);
     }
 }
@@ -874,7 +874,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         EXPECT_TRUE(task->_opened);
         EXPECT_FALSE(read_dep->ready());
         EXPECT_TRUE(write_dep->ready());
-        EXPECT_FALSE(read_dep->_blocked_task.empty());
+        EXPECT_FALSE(read_dep->_num_blocked_tasks.load() == 0);
         source_finish_dep =
                 _runtime_state->get_local_state_result(task->_operators.front()->operator_id())
                         .value()
@@ -905,7 +905,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         EXPECT_FALSE(done);
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_TRUE(source_finish_dep->ready());
-        EXPECT_TRUE(source_finish_dep->_blocked_task.empty());
+        EXPECT_TRUE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_TRUE(
                 ((MockWorkloadGroupMgr*)ExecEnv::GetInstance()->_workload_group_manager)->_paused);
     }
@@ -926,7 +926,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         EXPECT_FALSE(done);
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_TRUE(source_finish_dep->ready());
-        EXPECT_TRUE(source_finish_dep->_blocked_task.empty());
+        EXPECT_TRUE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::RUNNABLE);
         EXPECT_TRUE(
                 ((MockWorkloadGroupMgr*)ExecEnv::GetInstance()->_workload_group_manager)->_paused);
@@ -946,7 +946,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         EXPECT_TRUE(done);
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_TRUE(source_finish_dep->ready());
-        EXPECT_TRUE(source_finish_dep->_blocked_task.empty());
+        EXPECT_TRUE(source_finish_dep->_num_blocked_tasks.load() == 0);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::RUNNABLE);
         EXPECT_FALSE(
                 ((MockWorkloadGroupMgr*)ExecEnv::GetInstance()->_workload_group_manager)->_paused);
@@ -956,7 +956,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         task->_spill_dependencies.front()->block();
         EXPECT_TRUE(task->is_revoking());
         EXPECT_FALSE(task->_spill_dependencies.front()->ready());
-        EXPECT_TRUE(task->_spill_dependencies.front()->_blocked_task.empty());
+        EXPECT_TRUE(task->_spill_dependencies.front()->_num_blocked_tasks.load() == 0);
         task->_spill_dependencies.front()->set_ready();
     }
     {
@@ -964,7 +964,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         task->_spill_dependencies.front()->block();
         EXPECT_TRUE(task->_is_blocked());
         EXPECT_FALSE(task->_spill_dependencies.front()->ready());
-        EXPECT_FALSE(task->_spill_dependencies.front()->_blocked_task.empty());
+        EXPECT_FALSE(task->_spill_dependencies.front()->_num_blocked_tasks.load() == 0);
         task->_spill_dependencies.front()->set_ready();
     }
     {
@@ -972,7 +972,7 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
         task->_spill_dependencies.front()->block();
         EXPECT_TRUE(task->_is_pending_finish());
         EXPECT_FALSE(task->_spill_dependencies.front()->ready());
-        EXPECT_FALSE(task->_spill_dependencies.front()->_blocked_task.empty());
+        EXPECT_FALSE(task->_spill_dependencies.front()->_num_blocked_tasks.load() == 0);
         task->_spill_dependencies.front()->set_ready();
     }
     delete ExecEnv::GetInstance()->_workload_group_manager;
@@ -1029,4 +1029,92 @@ TEST_F(PipelineTaskTest, TEST_INJECT_SHARED_STATE) {
     }
 }
 
+TEST_F(PipelineTaskTest, TEST_GROUP_FAIR_TASK_QUEUE) {
+    auto num_instances = 1;
+    auto pip_id = 0;
+    auto task_id = 0;
+    auto pip = std::make_shared<Pipeline>(pip_id, num_instances, num_instances);
+    {
+        OperatorPtr source_op;
+        source_op.reset(new DummyOperator());
+        EXPECT_TRUE(pip->add_operator(source_op, num_instances).ok());
+
+        int op_id = 1;
+        int node_id = 2;
+        int dest_id = 3;
+        DataSinkOperatorPtr sink_op;
+        sink_op.reset(new DummySinkOperatorX(op_id, node_id, dest_id));
+        EXPECT_TRUE(pip->set_sink(sink_op).ok());
+    }
+    auto profile = std::make_shared<RuntimeProfile>("Pipeline : " + std::to_string(pip_id));
+    std::map<int,
+             std::pair<std::shared_ptr<BasicSharedState>, std::vector<std::shared_ptr<Dependency>>>>
+            shared_state_map;
+    auto task = std::make_shared<PipelineTask>(pip, task_id, _runtime_state.get(), _context,
+                                               profile.get(), shared_state_map, task_id);
+    const int32_t quantum_ms = config::workload_group_fair_scheduler_quantum_ms;
+    config::workload_group_fair_scheduler_quantum_ms = 10;
+    constexpr int64_t ONE_MS = 1'000'000;
+    {
+        GroupFairTaskQueue queue(1);
+        const GroupSchedInfo group_a {1, 1, 100};
+        const GroupSchedInfo group_b {2, 3, 100};
+        for (int i = 0; i < 40; ++i) {
+            EXPECT_TRUE(queue.push(task, group_a).ok());
+            EXPECT_TRUE(queue.push(task, group_b).ok());
+        }
+        // Every time slice costs 1ms of cpu, group b is served 3 times as many slices as group a.
+        std::map<uint64_t, int> slices;
+        for (int i = 0; i < 40; ++i) {
+            uint64_t group_id = 0;
+            auto taken = queue.take(1, &group_id);
+            ASSERT_NE(taken, nullptr);
+            slices[group_id]++;
+            queue.finish(group_id, taken.get(), ONE_MS, ONE_MS);
+        }
+        EXPECT_EQ(slices[1], 10);
+        EXPECT_EQ(slices[2], 30);
+        queue.close();
+        uint64_t group_id = 0;
+        EXPECT_EQ(queue.take(1, &group_id), nullptr);
+        EXPECT_FALSE(queue.push(task, group_a).ok());
+    }
+    {
+        GroupFairTaskQueue queue(1);
+        // Group c may use half of the pool.
+        const GroupSchedInfo group_c {3, 100, 50};
+        const GroupSchedInfo group_d {4, 1, 100};
+        EXPECT_TRUE(queue.push(task, group_c).ok());
+        EXPECT_TRUE(queue.push(task, group_c).ok());
+        uint64_t group_id = 0;
+        auto taken = queue.take(1, &group_id);
+        ASSERT_NE(taken, nullptr);
+        EXPECT_EQ(group_id, 3U);
+        queue.finish(group_id, taken.get(), 600 * ONE_MS, 600 * ONE_MS);
+        // The group used more than its half of the window.
+        EXPECT_EQ(queue.take(1, &group_id), nullptr);
+
+        EXPECT_TRUE(queue.push(task, group_d).ok());
+        auto taken_d = queue.take(1, &group_id);
+        ASSERT_NE(taken_d, nullptr);
+        EXPECT_EQ(group_id, 4U);
+
+        // Group c is served again in the next window.
+        queue._roll_window_unprotected(queue._window_start_ns + GroupFairTaskQueue::CPU_WINDOW_NS);
+        taken = queue.take(1, &group_id);
+        ASSERT_NE(taken, nullptr);
+        EXPECT_EQ(group_id, 3U);
+        queue.finish(3, taken.get(), ONE_MS, ONE_MS);
+        queue.finish(4, taken_d.get(), ONE_MS, ONE_MS);
+
+        // The groups without any task are dropped at the end of the window.
+        EXPECT_EQ(queue._groups.size(), 2U);
+        queue._roll_window_unprotected(queue._window_start_ns + GroupFairTaskQueue::CPU_WINDOW_NS);
+        EXPECT_TRUE(queue._groups.empty());
+        EXPECT_TRUE(queue._order.empty());
+        queue.close();
+    }
+    config::workload_group_fair_scheduler_quantum_ms = quantum_ms;
+}
+
 } // namespace doris::pipeline
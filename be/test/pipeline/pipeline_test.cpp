@@ -992,7 +992,7 @@ TEST_F(PipelineTest, PLAN_HASH_JOIN) {
                 EXPECT_EQ(_pipeline_tasks[_pipelines[i]->id()][j]->_wait_to_start(), true);
             }
         }
-        EXPECT_EQ(_query_ctx->get_execution_dependency()->_blocked_task.size(),
+        EXPECT_EQ((size_t)_query_ctx->get_execution_dependency()->_num_blocked_tasks.load(),
                   _pipelines.size() * parallelism);
         _query_ctx->get_execution_dependency()->set_ready();
         for (size_t i = 0; i < _pipelines.size(); i++) {
@@ -1052,7 +1052,7 @@ TEST_F(PipelineTest, PLAN_HASH_JOIN) {
                 EXPECT_EQ(local_state.stream_recvr->_sender_queues[0]->_source_dependency->ready(),
                           false);
                 EXPECT_EQ(local_state.stream_recvr->_sender_queues[0]
-                                  ->_source_dependency->_blocked_task.size(),
+                                  ->_source_dependency->_num_blocked_tasks.load(),
                           i == 1 ? 1 : 0);
                 local_state.stream_recvr->_sender_queues[0]->add_block(&block, true);
             }
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/task_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "util/cpu_info.h"
+
+namespace doris::pipeline {
+
+class TaskQueueTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_numa_nodes = CpuInfo::max_num_numa_nodes_;
+        _origin_core_to_numa_node.assign(CpuInfo::core_to_numa_node_.get(),
+                                         CpuInfo::core_to_numa_node_.get() +
+                                                 CpuInfo::get_max_num_cores());
+    }
+
+    void TearDown() override {
+        CpuInfo::_init_fake_numa_for_test(_origin_numa_nodes, _origin_core_to_numa_node);
+    }
+
+    // Simulate 2 NUMA nodes, the cpus are interleaved between the nodes.
+    static void fake_two_numa_nodes() {
+        std::vector<int> core_to_numa_node(CpuInfo::get_max_num_cores());
+        for (int i = 0; i < core_to_numa_node.size(); ++i) {
+            core_to_numa_node[i] = i % 2;
+        }
+        CpuInfo::_init_fake_numa_for_test(2, core_to_numa_node);
+    }
+
+private:
+    int _origin_numa_nodes;
+    std::vector<int> _origin_core_to_numa_node;
+};
+
+TEST_F(TaskQueueTest, test_numa_topology_disabled) {
+    fake_two_numa_nodes();
+    MultiCoreTaskQueue queue(8);
+    queue._init_numa_topology(false);
+    EXPECT_FALSE(queue.numa_aware());
+    EXPECT_EQ(queue.numa_nodes(), 1);
+    EXPECT_EQ(queue._node_to_cores[0], std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(queue.numa_node_of_core(i), 0);
+    }
+}
+
+TEST_F(TaskQueueTest, test_numa_topology_enabled) {
+    if (CpuInfo::get_max_num_cores() < 2) {
+        GTEST_SKIP() << "need at least 2 cpus";
+    }
+    fake_two_numa_nodes();
+    MultiCoreTaskQueue queue(8);
+    queue._init_numa_topology(true);
+    EXPECT_TRUE(queue.numa_aware());
+    EXPECT_EQ(queue.numa_nodes(), 2);
+    for (int i = 0; i < 8; ++i) {
+        int node = queue.numa_node_of_core(i);
+        EXPECT_EQ(node, CpuInfo::get_numa_node_of_core(i % CpuInfo::get_max_num_cores()));
+        const auto& cores = queue._node_to_cores[node];
+        EXPECT_TRUE(std::find(cores.begin(), cores.end(), i) != cores.end());
+    }
+    EXPECT_EQ(queue._node_to_cores[0].size() + queue._node_to_cores[1].size(), 8);
+}
+
+TEST_F(TaskQueueTest, test_numa_topology_single_core_queue) {
+    fake_two_numa_nodes();
+    // Only one node has a core queue, the topology degenerates to a single node.
+    MultiCoreTaskQueue queue(1);
+    queue._init_numa_topology(true);
+    EXPECT_FALSE(queue.numa_aware());
+    EXPECT_EQ(queue.numa_nodes(), 1);
+    EXPECT_EQ(queue.numa_node_of_core(0), 0);
+    EXPECT_EQ(queue._steal_take(0), nullptr);
+}
+
+} // namespace doris::pipeline
@@ -288,6 +288,16 @@ TEST_F(PartitionCacheTest, prune_data) {
     clear();
 }
 
+TEST_F(PartitionCacheTest, prune_data_sharded) {
+    init(1, 1);
+    SAFE_DELETE(_cache);
+    _cache = new ResultCache(1, 1, 4);
+    init_batch_data(LOOP_LESS_OR_MORE(10, 129), 1, 1024, CacheType::PARTITION_CACHE);
+    EXPECT_LE(_cache->get_cache_size(), 1 * 1024 * 1024); //cache_size <= 1M
+    EXPECT_GT(_cache->get_cache_size(), 0);
+    clear();
+}
+
 TEST_F(PartitionCacheTest, fetch_not_continue_partition) {
     init_default();
     init_batch_data(1, 1, 1, CacheType::PARTITION_CACHE);
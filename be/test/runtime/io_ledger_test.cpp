@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "runtime/workload_management/io_ledger.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace doris {
+
+TEST(IOLedgerTest, test_latency_bucket) {
+    EXPECT_EQ(IOLedger::latency_bucket(-1), 0U);
+    EXPECT_EQ(IOLedger::latency_bucket(999), 0U);
+    EXPECT_EQ(IOLedger::latency_bucket(1000), 1U);
+    EXPECT_EQ(IOLedger::latency_bucket(1999), 1U);
+    EXPECT_EQ(IOLedger::latency_bucket(2000), 2U);
+    EXPECT_EQ(IOLedger::latency_bucket(int64_t(1) << 62), IOLedger::LATENCY_BUCKETS - 1);
+}
+
+TEST(IOLedgerTest, test_record) {
+    IOLedger ledger;
+    for (int i = 0; i < 98; ++i) {
+        ledger.record(IOTier::PAGE_CACHE, 10, 500);
+    }
+    ledger.record(IOTier::PAGE_CACHE, 10, 3000);
+    ledger.record(IOTier::PAGE_CACHE, 10, 100000);
+    ledger.record(IOTier::REMOTE, 100, 5000000, "a");
+
+    auto snapshot = ledger.snapshot(10);
+    const auto& page_cache = snapshot.tier(IOTier::PAGE_CACHE);
+    EXPECT_EQ(page_cache.bytes, 1000);
+    EXPECT_EQ(page_cache.requests, 100);
+    EXPECT_EQ(page_cache.latency_percentile_ns(50), 1000);
+    EXPECT_EQ(page_cache.latency_percentile_ns(99), 4000);
+    EXPECT_EQ(page_cache.latency_percentile_ns(100), 128000);
+    EXPECT_EQ(snapshot.tier(IOTier::FILE_CACHE).latency_percentile_ns(50), 0);
+    EXPECT_EQ(snapshot.tier(IOTier::REMOTE).bytes, 100);
+    // The page cache reads are not counted per file.
+    ASSERT_EQ(snapshot.top_files.size(), 1U);
+    EXPECT_EQ(snapshot.top_files[0].first, "a");
+}
+
+TEST(IOLedgerTest, test_top_files) {
+    const int32_t max_files = config::query_io_ledger_max_files;
+    config::query_io_ledger_max_files = 2;
+    IOLedger ledger;
+    ledger.record(IOTier::REMOTE, 10, 0, "a");
+    ledger.record(IOTier::REMOTE, 30, 0, "b");
+    ledger.record(IOTier::LOCAL_DISK, 5, 0, "c");
+    ledger.record(IOTier::LOCAL_DISK, 50, 0, "d");
+    ledger.record(IOTier::FILE_CACHE, 5, 0, "a");
+    config::query_io_ledger_max_files = max_files;
+
+    auto snapshot = ledger.snapshot(2);
+    ASSERT_EQ(snapshot.top_files.size(), 2U);
+    // The files over the limit are counted together.
+    EXPECT_EQ(snapshot.top_files[0], std::make_pair(std::string(), int64_t(55)));
+    EXPECT_EQ(snapshot.top_files[1], std::make_pair(std::string("b"), int64_t(30)));
+    EXPECT_EQ(ledger.snapshot(10).top_files.size(), 3U);
+}
+
+TEST(IOLedgerTest, test_merge) {
+    IOLedger a;
+    a.record(IOTier::REMOTE, 10, 1000, "x");
+    a.record(IOTier::REMOTE, 10, 1000, "y");
+    IOLedger b;
+    b.record(IOTier::REMOTE, 20, 3000, "y");
+    b.record(IOTier::LOCAL_DISK, 5, 100, "z");
+
+    auto snapshot = a.snapshot(10);
+    snapshot.merge(b.snapshot(10), 2);
+    EXPECT_EQ(snapshot.tier(IOTier::REMOTE).bytes, 40);
+    EXPECT_EQ(snapshot.tier(IOTier::REMOTE).requests, 3);
+    EXPECT_EQ(snapshot.tier(IOTier::REMOTE).latency_ns, 5000);
+    EXPECT_EQ(snapshot.tier(IOTier::REMOTE).latency_histogram[1], 2);
+    EXPECT_EQ(snapshot.tier(IOTier::LOCAL_DISK).requests, 1);
+    ASSERT_EQ(snapshot.top_files.size(), 2U);
+    EXPECT_EQ(snapshot.top_files[0], std::make_pair(std::string("y"), int64_t(30)));
+    EXPECT_EQ(snapshot.top_files[1], std::make_pair(std::string("x"), int64_t(10)));
+}
+
+TEST(IOLedgerTest, test_scoped_record) {
+    IOLedger ledger;
+    size_t bytes_read = 0;
+    {
+        ScopedIOLedgerRecord record(&ledger, IOTier::LOCAL_DISK, "f", &bytes_read);
+    }
+    // Nothing read, nothing recorded.
+    EXPECT_EQ(ledger.snapshot(10).tier(IOTier::LOCAL_DISK).requests, 0);
+    {
+        ScopedIOLedgerRecord record(&ledger, IOTier::LOCAL_DISK, "f", &bytes_read);
+        bytes_read = 64;
+    }
+    {
+        ScopedIOLedgerRecord record(nullptr, IOTier::LOCAL_DISK, "f", &bytes_read);
+    }
+    auto snapshot = ledger.snapshot(10);
+    EXPECT_EQ(snapshot.tier(IOTier::LOCAL_DISK).requests, 1);
+    EXPECT_EQ(snapshot.tier(IOTier::LOCAL_DISK).bytes, 64);
+    ASSERT_EQ(snapshot.top_files.size(), 1U);
+    EXPECT_EQ(snapshot.top_files[0].second, 64);
+}
+
+} // namespace doris
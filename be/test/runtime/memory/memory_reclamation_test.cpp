@@ -369,4 +369,52 @@ TEST_F(MemoryReclamationTest, TestRevokeTasksMemoryMixTaskNoFilter) {
     EXPECT_TRUE(resource_ctxs[4]->task_controller()->is_cancelled());
 }
 
+TEST_F(MemoryReclamationTest, TestRevokeTasksMemorySpill) {
+    std::unique_ptr<RuntimeProfile> profile;
+    std::vector<std::shared_ptr<ResourceContext>> resource_ctxs;
+    auto ctxs = _create_query_ctxs(2, TQueryType::type::SELECT, resource_ctxs);
+    auto* small_controller =
+            static_cast<MockQueryTaskController*>(resource_ctxs[0]->task_controller());
+    auto* large_controller =
+            static_cast<MockQueryTaskController*>(resource_ctxs[1]->task_controller());
+    small_controller->revocable_size = 1024;
+    large_controller->revocable_size = 64 * 1024 * 1024;
+
+    // the query without workload group can not be paused, so nothing is asked to spill
+    profile = std::make_unique<RuntimeProfile>("MemoryReclamationTest");
+    EXPECT_EQ(MemoryReclamation::revoke_tasks_memory(
+                      1024, resource_ctxs, "MemoryReclamationTest", profile.get(),
+                      MemoryReclamation::PriorityCmpFunc::TOP_REVOCABLE_MEMORY,
+                      {MemoryReclamation::FilterFunc::IS_QUERY},
+                      MemoryReclamation::ActionFunc::SPILL),
+              0);
+    EXPECT_FALSE(resource_ctxs[0]->task_controller()->is_cancelled());
+    EXPECT_FALSE(resource_ctxs[1]->task_controller()->is_cancelled());
+
+    // the query already asked to spill counts its revocable memory as being freed
+    large_controller->update_paused_reason(
+            Status::Error<ErrorCode::QUERY_MEMORY_EXCEEDED, false>("MemoryReclamationTest"));
+    large_controller->set_revoke_requested_time(MonotonicMillis());
+    profile = std::make_unique<RuntimeProfile>("MemoryReclamationTest");
+    EXPECT_EQ(MemoryReclamation::revoke_tasks_memory(
+                      1024, resource_ctxs, "MemoryReclamationTest", profile.get(),
+                      MemoryReclamation::PriorityCmpFunc::TOP_REVOCABLE_MEMORY,
+                      {MemoryReclamation::FilterFunc::IS_QUERY},
+                      MemoryReclamation::ActionFunc::SPILL),
+              64 * 1024 * 1024);
+
+    // until the spill takes longer than revoke_memory_max_tolerance_ms
+    large_controller->set_revoke_requested_time(MonotonicMillis() -
+                                                config::revoke_memory_max_tolerance_ms - 1000);
+    profile = std::make_unique<RuntimeProfile>("MemoryReclamationTest");
+    EXPECT_EQ(MemoryReclamation::revoke_tasks_memory(
+                      1024, resource_ctxs, "MemoryReclamationTest", profile.get(),
+                      MemoryReclamation::PriorityCmpFunc::TOP_REVOCABLE_MEMORY,
+                      {MemoryReclamation::FilterFunc::IS_QUERY},
+                      MemoryReclamation::ActionFunc::SPILL),
+              0);
+    EXPECT_FALSE(resource_ctxs[0]->task_controller()->is_cancelled());
+    EXPECT_FALSE(resource_ctxs[1]->task_controller()->is_cancelled());
+}
+
 } // end namespace doris
@@ -28,6 +28,7 @@
 #include <mutex>
 #include <tuple>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "mock_scanner_scheduler.h"
 #include "mock_simplified_scan_scheduler.h"
@@ -504,6 +505,60 @@ TEST_F(ScannerContextTest, pull_next_scan_task) {
     EXPECT_NE(pull_scan_task, nullptr);
 }
 
+TEST_F(ScannerContextTest, adaptive_scan_concurrency) {
+    const int parallel_tasks = 4;
+    auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+
+    auto olap_scan_local_state =
+            pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
+
+    const int64_t limit = 100;
+
+    OlapScanner::Params scanner_params;
+    scanner_params.state = state.get();
+    scanner_params.profile = profile.get();
+    scanner_params.limit = limit;
+    scanner_params.key_ranges = std::vector<OlapScanRange*>(); // empty
+
+    std::shared_ptr<Scanner> scanner =
+            OlapScanner::create_shared(olap_scan_local_state.get(), std::move(scanner_params));
+
+    std::list<std::shared_ptr<ScannerDelegate>> scanners;
+    for (int i = 0; i < 11; ++i) {
+        scanners.push_back(std::make_shared<ScannerDelegate>(scanner));
+    }
+
+    std::shared_ptr<ScannerContext> scanner_context = ScannerContext::create_shared(
+            state.get(), olap_scan_local_state.get(), output_tuple_desc, output_row_descriptor,
+            scanners, limit, scan_dependency, parallel_tasks);
+
+    scanner_context->_min_scan_concurrency = 1;
+    scanner_context->_max_scan_concurrency = 8;
+    scanner_context->_target_scan_concurrency = 2;
+
+    // The operator drained the queue, scale up quickly but not beyond the max.
+    scanner_context->_adjust_target_scan_concurrency(true);
+    EXPECT_EQ(scanner_context->_target_scan_concurrency, 4);
+    scanner_context->_adjust_target_scan_concurrency(true);
+    scanner_context->_adjust_target_scan_concurrency(true);
+    EXPECT_EQ(scanner_context->_target_scan_concurrency, 8);
+
+    // Finished tasks pile up, scale down one by one but not below the min.
+    scanner_context->_adjust_target_scan_concurrency(false);
+    EXPECT_EQ(scanner_context->_target_scan_concurrency, 7);
+    scanner_context->_target_scan_concurrency = 1;
+    scanner_context->_adjust_target_scan_concurrency(false);
+    EXPECT_EQ(scanner_context->_target_scan_concurrency, 1);
+
+    // The target only limits pulling when adaptive scan concurrency is on.
+    scanner_context->_target_scan_concurrency = 2;
+    config::enable_adaptive_scan_concurrency = true;
+    EXPECT_EQ(scanner_context->_pull_next_scan_task(nullptr, 2), nullptr);
+    config::enable_adaptive_scan_concurrency = false;
+    EXPECT_NE(scanner_context->_pull_next_scan_task(nullptr, 2), nullptr);
+}
+
 TEST_F(ScannerContextTest, schedule_scan_task) {
     const int parallel_tasks = 4;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
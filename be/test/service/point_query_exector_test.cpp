@@ -296,6 +296,28 @@ TEST_F(RowCacheTest, PQTestLRUEviction) {
     ASSERT_TRUE(!found);
 }
 
+// Test RowCache only admits rows missed often enough
+TEST_F(RowCacheTest, PQTestAdmissionByMisses) {
+    auto origin_min_misses = config::point_query_row_cache_admission_min_misses;
+    config::point_query_row_cache_admission_min_misses = 2;
+    const int64_t tablet_id = 12345;
+    const std::string key_data = "admission_key";
+    const std::string value_data = "admission_value";
+    RowCache::RowCacheKey cache_key(tablet_id, Slice(key_data.c_str(), key_data.size()));
+    Slice value_slice(value_data.c_str(), value_data.size());
+
+    // The first miss is not cached
+    _row_cache->insert(cache_key, value_slice);
+    RowCache::CacheHandle handle;
+    ASSERT_FALSE(_row_cache->lookup(cache_key, &handle));
+
+    // The second miss is cached
+    _row_cache->insert(cache_key, value_slice);
+    ASSERT_TRUE(_row_cache->lookup(cache_key, &handle));
+    ASSERT_EQ(handle.data().size, value_slice.size);
+    config::point_query_row_cache_admission_min_misses = origin_min_misses;
+}
+
 // LookupConnectionCache test class
 class LookupConnectionCacheTest : public testing::Test {
 protected:
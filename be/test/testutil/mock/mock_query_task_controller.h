@@ -35,6 +35,11 @@ struct MockQueryTaskController : public QueryTaskController {
     }
 
     void set_cancelled_time(int64_t ctime) { cancelled_time_ = ctime; }
+    void set_revoke_requested_time(int64_t rtime) { revoke_requested_time_ = rtime; }
+
+    size_t get_revocable_size() override { return revocable_size; }
+
+    size_t revocable_size = 0;
 };
 
 } // namespace doris
@@ -19,6 +19,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <memory>
+#include <string>
 
 #include "gtest/gtest_pred_impl.h"
 #include "util/byte_buffer.h"
@@ -53,4 +54,24 @@ TEST_F(ByteBufferTest, normal) {
     EXPECT_EQ(3, buf->remaining());
 }
 
+TEST_F(ByteBufferTest, wrap) {
+    auto owner = std::make_shared<std::string>("abcdef");
+    std::weak_ptr<std::string> weak_owner = owner;
+    auto buf = ByteBuffer::wrap(owner->data() + 1, 4, owner);
+    owner.reset();
+    EXPECT_FALSE(weak_owner.expired());
+    EXPECT_EQ(0, buf->pos);
+    EXPECT_EQ(4, buf->limit);
+    EXPECT_EQ(4, buf->remaining());
+
+    char out[4];
+    buf->get_bytes(out, 4);
+    EXPECT_EQ(std::string(out, 4), "bcde");
+    EXPECT_FALSE(buf->has_remaining());
+
+    // The owner is released with the buffer.
+    buf.reset();
+    EXPECT_TRUE(weak_owner.expired());
+}
+
 } // namespace doris
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/hot_path_metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "util/doris_metrics.h"
+
+namespace doris {
+
+class HotPathMetricsTest : public testing::Test {
+public:
+    void SetUp() override {
+        _enabled = config::enable_hot_path_metrics;
+        config::enable_hot_path_metrics = true;
+    }
+    void TearDown() override { config::enable_hot_path_metrics = _enabled; }
+
+private:
+    bool _enabled = false;
+};
+
+TEST_F(HotPathMetricsTest, TestLatency) {
+    auto* histogram = DorisMetrics::instance()->page_cache_lookup_latency_ns;
+    const uint64_t num = histogram->num();
+    {
+        ScopedHotPathLatency latency(HotPath::PAGE_CACHE_LOOKUP);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(num + 1, histogram->num());
+    EXPECT_GE(histogram->max(), 1000000U);
+
+    config::enable_hot_path_metrics = false;
+    { ScopedHotPathLatency latency(HotPath::PAGE_CACHE_LOOKUP); }
+    EXPECT_EQ(num + 1, histogram->num());
+
+    auto metric = DorisMetrics::instance()->server_entity()->get_metric(
+            "page_cache_lookup_latency_ns", "hot_path_latency_ns");
+    EXPECT_EQ(histogram, metric);
+}
+
+TEST_F(HotPathMetricsTest, TestLockWait) {
+    auto* histogram = DorisMetrics::instance()->dependency_lock_wait_ns;
+    const uint64_t num = histogram->num();
+    std::mutex mutex;
+    // Not contended, not recorded.
+    hot_path_metrics::lock(mutex, HotLock::DEPENDENCY);
+    EXPECT_EQ(num, histogram->num());
+
+    std::thread waiter([&] {
+        hot_path_metrics::lock(mutex, HotLock::DEPENDENCY);
+        mutex.unlock();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    mutex.unlock();
+    waiter.join();
+    EXPECT_EQ(num + 1, histogram->num());
+
+    auto* shard_histogram = DorisMetrics::instance()->lru_cache_shard_lock_wait_ns;
+    const uint64_t shard_num = shard_histogram->num();
+    std::shared_mutex shared_mutex;
+    hot_path_metrics::lock_shared(shared_mutex, HotLock::LRU_CACHE_SHARD);
+    // Readers do not exclude each other.
+    hot_path_metrics::lock_shared(shared_mutex, HotLock::LRU_CACHE_SHARD);
+    shared_mutex.unlock_shared();
+    shared_mutex.unlock_shared();
+    EXPECT_EQ(shard_num, shard_histogram->num());
+}
+
+} // namespace doris
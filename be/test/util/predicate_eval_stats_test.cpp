@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/predicate_eval_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris {
+
+TEST(PredicateEvalStatsTest, Rank) {
+    PredicateEvalStats unknown;
+    EXPECT_EQ(0, unknown.rank());
+
+    PredicateEvalStats cheap_selective;
+    cheap_selective.update(1000, 100, 1000);
+    PredicateEvalStats cheap_unselective;
+    cheap_unselective.update(1000, 990, 1000);
+    PredicateEvalStats costly_selective;
+    costly_selective.update(1000, 100, 100000);
+    EXPECT_LT(cheap_selective.rank(), cheap_unselective.rank());
+    EXPECT_LT(cheap_selective.rank(), costly_selective.rank());
+
+    // keeping every row is never worth evaluating first
+    PredicateEvalStats keep_all;
+    keep_all.update(1000, 1000, 10);
+    EXPECT_GT(keep_all.rank(), costly_selective.rank());
+
+    cheap_selective.decay();
+    EXPECT_EQ(500, cheap_selective.input_rows);
+    EXPECT_EQ(50, cheap_selective.output_rows);
+    EXPECT_EQ(500, cheap_selective.cost_ns);
+}
+
+TEST(PredicateEvalStatsTest, ReorderByRank) {
+    std::vector<std::string> items = {"a", "b", "c", "d"};
+    std::vector<PredicateEvalStats> stats(4);
+    stats[0].update(1000, 900, 1000);
+    stats[1].update(1000, 100, 1000);
+    stats[2].update(1000, 900, 1000);
+    // stats[3] has not been measured
+
+    EXPECT_TRUE(reorder_by_rank(&items, &stats));
+    std::vector<std::string> expected = {"d", "b", "a", "c"};
+    EXPECT_EQ(expected, items);
+    ASSERT_EQ(4, stats.size());
+    EXPECT_EQ(0, stats[0].input_rows);
+    EXPECT_EQ(50, stats[1].output_rows);
+    EXPECT_EQ(450, stats[2].output_rows);
+
+    // the order is stable once it is sorted
+    EXPECT_FALSE(reorder_by_rank(&items, &stats));
+    EXPECT_EQ(expected, items);
+}
+
+} // namespace doris
@@ -226,6 +226,22 @@ TEST(StringToInt, Limit) {
                             StringParser::PARSE_SUCCESS);
 }
 
+TEST(StringToInt, EightDigitChunks) {
+    // lengths around the 8-digit chunk boundary, with digits and non-digits inside a chunk
+    test_int_value<int64_t>("12345678", 12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-1234567890123456", -1234567890123456, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("100000000000000007", 100000000000000007,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("000000001", 1, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789.000", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234:6789", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678/123", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int32_t>("987654321", 987654321, StringParser::PARSE_SUCCESS);
+    test_unsigned_int_value<uint64_t>("1234567812345678", 1234567812345678,
+                                      StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToUnsignedInt, Basic) {
     test_unsigned_int_value<uint8_t>("123", 123, StringParser::PARSE_SUCCESS);
     test_unsigned_int_value<uint16_t>("123", 123, StringParser::PARSE_SUCCESS);
@@ -300,4 +300,42 @@ TEST(AggBitmapTest, bitmap_union_int_test) {
     validate_bitmap_union_int_test<TYPE_BIGINT>();
 }
 
+TEST(AggBitmapTest, bitmap_union_merge_from_column_test) {
+    Arena arena;
+    auto data_type = std::make_shared<DataTypeBitMap>();
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_bitmap(factory);
+    DataTypes data_types = {data_type};
+    auto agg_function = factory.get("bitmap_union", data_types, false, -1);
+    agg_function->set_version(3);
+
+    // partial states with overlapping values, enough rows to take the batched union path
+    auto column_bitmap = agg_function->create_serialize_column();
+    for (int i = 0; i < agg_test_batch_size * 4; i++) {
+        BitmapValue bitmap_value;
+        for (int j = 0; j < 40; j++) {
+            bitmap_value.add(i * 10 + j);
+        }
+        assert_cast<ColumnBitmap&>(*column_bitmap).insert_value(bitmap_value);
+    }
+
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+    AggregateDataPtr place = memory.get();
+    agg_function->create(place);
+    agg_function->deserialize_and_merge_from_column(place, *column_bitmap, arena);
+    ColumnBitmap ans;
+    agg_function->insert_result_into(place, ans);
+    EXPECT_EQ(ans.get_element(0).cardinality(), (agg_test_batch_size * 4 - 1) * 10 + 40);
+    agg_function->destroy(place);
+
+    agg_function->create(place);
+    agg_function->deserialize_and_merge_from_column_range(place, *column_bitmap, 2, 11, arena);
+    ColumnBitmap range_ans;
+    agg_function->insert_result_into(place, range_ans);
+    EXPECT_EQ(range_ans.get_element(0).cardinality(), 9 * 10 + 40);
+    EXPECT_TRUE(range_ans.get_element(0).contains(20));
+    EXPECT_FALSE(range_ans.get_element(0).contains(19));
+    agg_function->destroy(place);
+}
+
 } // namespace doris::vectorized
@@ -143,4 +143,24 @@ TEST_F(AggregateFunctionCorrTest, test_corr_welford) {
             ColumnHelper::create_column_with_name<DataTypeFloat64>({1}));
 }
 
+TEST_F(AggregateFunctionCorrTest, test_corr_nullable) {
+    create_agg("corr", true,
+               {make_nullable(std::make_shared<DataTypeFloat64>()),
+                make_nullable(std::make_shared<DataTypeFloat64>())});
+
+    // no null in the batch, the nested function gets the whole batch
+    execute(Block({ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>(
+                           {1, 2, 3, 4, 5}, {0, 0, 0, 0, 0}),
+                   ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>(
+                           {1, 2, 3, 4, 5}, {0, 0, 0, 0, 0})}),
+            ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>({1}, {0}));
+
+    // rows with a null in any argument are skipped
+    execute(Block({ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>(
+                           {1, 2, 100, 4, 5}, {0, 0, 1, 0, 0}),
+                   ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>(
+                           {1, 2, 200, 4, 5}, {0, 0, 0, 0, 0})}),
+            ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>({1}, {0}));
+}
+
 } // namespace doris::vectorized
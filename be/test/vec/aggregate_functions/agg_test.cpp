@@ -23,6 +23,7 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -71,6 +72,39 @@ TEST(AggTest, basic_test) {
     agg_function->destroy(place);
 }
 
+TEST(AggTest, sum_add_batch_test) {
+    Arena arena;
+    auto column_vector_int32 = ColumnInt32::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        column_vector_int32->insert(Field::create_field<TYPE_INT>(cast_to_nearest_field_type(i)));
+    }
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto agg_function = factory.get("sum", data_types, false, -1);
+    const size_t size_of_data = agg_function->size_of_data();
+    constexpr int num_groups = 3;
+    std::unique_ptr<char[]> memory(new char[size_of_data * num_groups]);
+    for (int i = 0; i < num_groups; i++) {
+        agg_function->create(memory.get() + size_of_data * i);
+    }
+
+    // Runs of the same group of different lengths, and groups appearing in several runs.
+    std::vector<AggregateDataPtr> places(agg_test_batch_size);
+    int64_t expected[num_groups] = {0, 0, 0};
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        int group = (i / (i % 7 + 1)) % num_groups;
+        places[i] = memory.get() + size_of_data * group;
+        expected[group] += i;
+    }
+    const IColumn* column[1] = {column_vector_int32.get()};
+    agg_function->add_batch(agg_test_batch_size, places.data(), 0, column, arena, true);
+    for (int i = 0; i < num_groups; i++) {
+        EXPECT_EQ(expected[i], *reinterpret_cast<int64_t*>(memory.get() + size_of_data * i));
+        agg_function->destroy(memory.get() + size_of_data * i);
+    }
+}
+
 TEST(AggTest, topn_test) {
     Arena arena;
     MutableColumns datas(2);
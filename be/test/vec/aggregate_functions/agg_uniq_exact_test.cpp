@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "vec/aggregate_functions/aggregate_function_uniq.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/core/types.h"
+
+namespace doris::vectorized {
+
+using TestSet = UniqExactSet<Int64, HashCRC32<Int64>>;
+
+TEST(AggUniqExactTest, convert_to_two_level) {
+    TestSet set;
+    const auto num_keys = static_cast<Int64>(TestSet::TWO_LEVEL_THRESHOLD * 2);
+    for (Int64 i = 0; i < num_keys; ++i) {
+        set.prefetch(i);
+        set.insert(i);
+        set.insert(i);
+    }
+    EXPECT_TRUE(set.is_two_level());
+    EXPECT_EQ(set.size(), static_cast<size_t>(num_keys));
+
+    Int64 sum = 0;
+    set.for_each([&](Int64 key) { sum += key; });
+    EXPECT_EQ(sum, num_keys * (num_keys - 1) / 2);
+
+    set.clear();
+    EXPECT_FALSE(set.is_two_level());
+    EXPECT_EQ(set.size(), 0);
+}
+
+TEST(AggUniqExactTest, merge) {
+    const auto num_keys = static_cast<Int64>(TestSet::TWO_LEVEL_THRESHOLD * 2);
+    TestSet two_level;
+    for (Int64 i = 0; i < num_keys; ++i) {
+        two_level.insert(i);
+    }
+    TestSet other_two_level;
+    for (Int64 i = num_keys / 2; i < num_keys * 3 / 2; ++i) {
+        other_two_level.insert(i);
+    }
+    TestSet single_level;
+    for (Int64 i = -100; i < 100; ++i) {
+        single_level.insert(i);
+    }
+    EXPECT_FALSE(single_level.is_two_level());
+
+    // single level into two level
+    two_level.merge(single_level);
+    EXPECT_EQ(two_level.size(), static_cast<size_t>(num_keys + 100));
+
+    // two level into two level, partition by partition
+    two_level.merge(other_two_level);
+    EXPECT_EQ(two_level.size(), static_cast<size_t>(num_keys * 3 / 2 + 100));
+
+    // two level into single level converts the destination
+    single_level.merge(other_two_level);
+    EXPECT_TRUE(single_level.is_two_level());
+    EXPECT_EQ(single_level.size(), static_cast<size_t>(num_keys + 200));
+
+    TestSet reserved;
+    reserved.reserve(TestSet::TWO_LEVEL_THRESHOLD + 1);
+    EXPECT_TRUE(reserved.is_two_level());
+    reserved.merge(single_level);
+    EXPECT_EQ(reserved.size(), single_level.size());
+}
+
+} // namespace doris::vectorized
@@ -554,6 +554,30 @@ TEST_F(ColumnVariantTest, advanced_finalize) {
     }
 }
 
+TEST_F(ColumnVariantTest, fill_path_column_from_sparse_data_with_missing_rows) {
+    auto variant = VariantUtil::construct_advanced_varint_column();
+    variant->finalize(ColumnVariant::FinalizeMode::WRITE_MODE);
+    EXPECT_TRUE(variant->pick_subcolumns_to_sparse_column({}, false).ok());
+
+    const auto& [paths, _] = variant->get_sparse_data_paths_and_values();
+    const auto& offsets = variant->serialized_sparse_column_offsets();
+    for (const auto* path : {"v.b.d", "not.exist"}) {
+        ColumnVariant::Subcolumn subcolumn(0, true, false);
+        NullMap null_map;
+        ColumnVariant::fill_path_column_from_sparse_data(subcolumn, &null_map, StringRef {path},
+                                                         variant->get_sparse_column(), 0, 15);
+        EXPECT_EQ(subcolumn.size(), 15);
+        ASSERT_EQ(null_map.size(), 15);
+        for (ssize_t row = 0; row < 15; ++row) {
+            bool has_path = false;
+            for (size_t i = offsets[row - 1]; i < offsets[row]; ++i) {
+                has_path |= paths->get_data_at(i) == StringRef {path};
+            }
+            EXPECT_EQ(null_map[row], !has_path) << path << " row " << row;
+        }
+    }
+}
+
 TEST_F(ColumnVariantTest, advanced_deserialize) {
     auto variant = VariantUtil::construct_advanced_varint_column();
 
@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace doris {
+
+using TestJoinHashTable = JoinHashTable<uint64_t>;
+
+static constexpr uint32_t BUILD_ROWS = 1000;
+static constexpr uint32_t PROBE_ROWS = 150;
+static constexpr int BATCH_SIZE = 64;
+
+// Row 0 of the build side is mocked, the key of row i is i % 100.
+template <int JoinOpType>
+static void build_table(TestJoinHashTable& table, std::vector<uint64_t>& keys, bool partitioned) {
+    table.prepare_build<JoinOpType>(BUILD_ROWS, BATCH_SIZE, false);
+    keys.resize(BUILD_ROWS);
+    std::vector<uint32_t> bucket_nums(BUILD_ROWS);
+    for (uint32_t i = 0; i < BUILD_ROWS; ++i) {
+        keys[i] = i % 100;
+        bucket_nums[i] = static_cast<uint32_t>(keys[i] & (table.get_bucket_size() - 1));
+    }
+    if (partitioned) {
+        table.build_partitioned(keys.data(), bucket_nums.data(), BUILD_ROWS);
+        table.finish_build(false);
+    } else {
+        table.build(keys.data(), bucket_nums.data(), BUILD_ROWS, false);
+    }
+}
+
+template <int JoinOpType>
+static std::vector<std::pair<uint32_t, uint32_t>> probe_table(TestJoinHashTable& table) {
+    std::vector<uint64_t> probe_keys(PROBE_ROWS);
+    DorisVector<uint32_t> build_idx_map(PROBE_ROWS);
+    for (uint32_t i = 0; i < PROBE_ROWS; ++i) {
+        probe_keys[i] = i;
+        build_idx_map[i] = static_cast<uint32_t>(i & (table.get_bucket_size() - 1));
+    }
+    table.pre_build_idxs(build_idx_map);
+
+    std::vector<std::pair<uint32_t, uint32_t>> matches;
+    std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+    int probe_idx = 0;
+    uint32_t build_idx = 0;
+    bool probe_visited = false;
+    while (probe_idx < static_cast<int>(PROBE_ROWS)) {
+        auto [new_probe_idx, new_build_idx, matched_cnt] = table.find_batch<JoinOpType>(
+                probe_keys.data(), build_idx_map.data(), probe_idx, build_idx, PROBE_ROWS,
+                probe_idxs.data(), probe_visited, build_idxs.data(), nullptr, false, false, false);
+        for (uint32_t i = 0; i < matched_cnt; ++i) {
+            matches.emplace_back(probe_idxs[i], build_idxs[i]);
+        }
+        probe_idx = new_probe_idx;
+        build_idx = new_build_idx;
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+TEST(JoinHashTableTest, test_partitioned_build_inner_join) {
+    TestJoinHashTable chained;
+    TestJoinHashTable partitioned;
+    std::vector<uint64_t> chained_keys;
+    std::vector<uint64_t> partitioned_keys;
+    build_table<TJoinOp::INNER_JOIN>(chained, chained_keys, false);
+    build_table<TJoinOp::INNER_JOIN>(partitioned, partitioned_keys, true);
+
+    auto expected = probe_table<TJoinOp::INNER_JOIN>(chained);
+    auto matches = probe_table<TJoinOp::INNER_JOIN>(partitioned);
+    EXPECT_EQ(expected.size(), BUILD_ROWS - 1);
+    EXPECT_EQ(matches, expected);
+    for (const auto& [probe_idx, build_idx] : matches) {
+        EXPECT_EQ(probe_idx, build_idx % 100);
+    }
+}
+
+TEST(JoinHashTableTest, test_partitioned_build_right_semi_join) {
+    TestJoinHashTable table;
+    std::vector<uint64_t> keys;
+    build_table<TJoinOp::RIGHT_SEMI_JOIN>(table, keys, true);
+    probe_table<TJoinOp::RIGHT_SEMI_JOIN>(table);
+
+    // The visited flags are indexed by build row, not by position in the table.
+    auto& visited = table.get_visited();
+    for (uint32_t i = 1; i < BUILD_ROWS; ++i) {
+        EXPECT_EQ(visited[i], 1) << i;
+    }
+}
+
+TEST(JoinHashTableTest, test_concurrent_build) {
+    TestJoinHashTable chained;
+    std::vector<uint64_t> chained_keys;
+    build_table<TJoinOp::INNER_JOIN>(chained, chained_keys, false);
+
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(BUILD_ROWS, BATCH_SIZE, false);
+    std::vector<uint64_t> keys(BUILD_ROWS);
+    std::vector<uint32_t> bucket_nums(BUILD_ROWS);
+    for (uint32_t i = 0; i < BUILD_ROWS; ++i) {
+        keys[i] = i % 100;
+        bucket_nums[i] = static_cast<uint32_t>(keys[i] & (table.get_bucket_size() - 1));
+    }
+    table.set_build_keys(keys.data());
+    std::vector<std::thread> threads;
+    constexpr uint32_t NUM_THREADS = 4;
+    for (uint32_t t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            uint32_t begin = std::max(1U, t * BUILD_ROWS / NUM_THREADS);
+            table.build_range_concurrent(bucket_nums.data(), begin,
+                                         (t + 1) * BUILD_ROWS / NUM_THREADS);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    table.finish_build(false);
+
+    EXPECT_EQ(probe_table<TJoinOp::INNER_JOIN>(table), probe_table<TJoinOp::INNER_JOIN>(chained));
+}
+
+TEST(JoinHashTableTest, test_direct_mapping) {
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(BUILD_ROWS, BATCH_SIZE, false);
+    std::vector<uint64_t> keys(BUILD_ROWS);
+    for (uint32_t i = 0; i < BUILD_ROWS; ++i) {
+        keys[i] = i % 100 + 1000;
+    }
+    // The mocked row 0 is not taken into account.
+    keys[0] = 0;
+    ASSERT_TRUE(table.try_direct_mapping(keys.data(), nullptr, BUILD_ROWS));
+    EXPECT_TRUE(table.use_direct_mapping());
+    EXPECT_EQ(table.get_bucket_size(), 101);
+    EXPECT_EQ(table.direct_bucket_num(999), 0);
+    EXPECT_EQ(table.direct_bucket_num(1000), 1);
+    EXPECT_EQ(table.direct_bucket_num(1099), 100);
+    EXPECT_EQ(table.direct_bucket_num(1100), 0);
+
+    std::vector<uint32_t> bucket_nums(BUILD_ROWS);
+    for (uint32_t i = 0; i < BUILD_ROWS; ++i) {
+        bucket_nums[i] = table.direct_bucket_num(keys[i]);
+    }
+    table.build(keys.data(), bucket_nums.data(), BUILD_ROWS, false);
+
+    std::vector<uint64_t> probe_keys {1000, 1050, 999, 1100};
+    DorisVector<uint32_t> build_idx_map(probe_keys.size());
+    for (size_t i = 0; i < probe_keys.size(); ++i) {
+        build_idx_map[i] = table.direct_bucket_num(probe_keys[i]);
+    }
+    table.pre_build_idxs(build_idx_map);
+    std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+    bool probe_visited = false;
+    auto [probe_idx, build_idx, matched_cnt] = table.find_batch<TJoinOp::INNER_JOIN>(
+            probe_keys.data(), build_idx_map.data(), 0, 0,
+            static_cast<uint32_t>(probe_keys.size()), probe_idxs.data(), probe_visited,
+            build_idxs.data(), nullptr, false, false, false);
+    EXPECT_EQ(probe_idx, probe_keys.size());
+    EXPECT_EQ(matched_cnt, 19);
+    for (uint32_t i = 0; i < matched_cnt; ++i) {
+        EXPECT_EQ(keys[build_idxs[i]], probe_keys[probe_idxs[i]]);
+    }
+}
+
+TEST(JoinHashTableTest, test_direct_mapping_sparse_keys) {
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(BUILD_ROWS, BATCH_SIZE, false);
+    std::vector<uint64_t> keys(BUILD_ROWS);
+    for (uint32_t i = 0; i < BUILD_ROWS; ++i) {
+        keys[i] = uint64_t(i) * 1000;
+    }
+    auto bucket_size = table.get_bucket_size();
+    EXPECT_FALSE(table.try_direct_mapping(keys.data(), nullptr, BUILD_ROWS));
+    EXPECT_FALSE(table.use_direct_mapping());
+    EXPECT_EQ(table.get_bucket_size(), bucket_size);
+}
+
+TEST(JoinHashTableTest, test_probe_bloom_filter) {
+    TestJoinHashTable table;
+    std::vector<uint64_t> keys;
+    build_table<TJoinOp::INNER_JOIN>(table, keys, false);
+    auto expected = probe_table<TJoinOp::INNER_JOIN>(table);
+
+    ASSERT_TRUE(table.build_bloom_filter(keys.data(), BUILD_ROWS, 0.01).ok());
+    EXPECT_TRUE(table.has_bloom_filter());
+    std::vector<uint64_t> probe_keys(PROBE_ROWS);
+    DorisVector<uint32_t> buckets(PROBE_ROWS);
+    DorisVector<uint32_t> filtered_buckets(PROBE_ROWS);
+    for (uint32_t i = 0; i < PROBE_ROWS; ++i) {
+        probe_keys[i] = i;
+        buckets[i] = static_cast<uint32_t>(i & (table.get_bucket_size() - 1));
+    }
+    filtered_buckets = buckets;
+    table.pre_build_idxs(buckets);
+    table.pre_build_idxs(filtered_buckets, probe_keys.data());
+    // A bloom filter has no false negative, the keys in the build side keep their chains.
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(filtered_buckets[i], buckets[i]) << i;
+    }
+    for (uint32_t i = 100; i < PROBE_ROWS; ++i) {
+        EXPECT_TRUE(filtered_buckets[i] == 0 || filtered_buckets[i] == buckets[i]) << i;
+    }
+
+    EXPECT_EQ(probe_table<TJoinOp::INNER_JOIN>(table), expected);
+}
+
+} // namespace doris
@@ -359,6 +359,24 @@ TEST_F(SchemaUtilTest, get_subpaths) {
                 uid_to_paths_set_info[1].sparse_path_set.end());
 }
 
+TEST_F(SchemaUtilTest, get_subpaths_prefer_hot_paths) {
+    schema_util::PathToNoneNullValues path_stats = {
+            {"path1", 1000}, {"path2", 800}, {"path3", 500}, {"path4", 300}, {"path5", 200}};
+
+    // path5 is rarely present but queried often, it takes the slot of the least frequent path
+    TabletSchema::PathsSetInfo paths_set_info;
+    schema_util::VariantCompactionUtil::get_subpaths(3, path_stats, paths_set_info,
+                                                     {"path5", "missing"});
+
+    EXPECT_EQ(paths_set_info.sub_path_set.size(), 3);
+    EXPECT_TRUE(paths_set_info.sub_path_set.contains("path5"));
+    EXPECT_TRUE(paths_set_info.sub_path_set.contains("path1"));
+    EXPECT_TRUE(paths_set_info.sub_path_set.contains("path2"));
+    EXPECT_EQ(paths_set_info.sparse_path_set.size(), 2);
+    EXPECT_TRUE(paths_set_info.sparse_path_set.contains("path3"));
+    EXPECT_TRUE(paths_set_info.sparse_path_set.contains("path4"));
+}
+
 TEST_F(SchemaUtilTest, get_subpaths_equal_to_max) {
     TabletSchema schema;
     TabletColumn variant;
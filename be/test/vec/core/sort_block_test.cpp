@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+static Block create_random_block(size_t rows) {
+    std::mt19937 rng(42);
+    std::vector<int32_t> keys1(rows);
+    std::vector<NullMap::value_type> nulls(rows);
+    std::vector<int64_t> keys2(rows);
+    std::vector<std::string> payload(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        keys1[i] = static_cast<int32_t>(rng() % 20) - 10;
+        nulls[i] = rng() % 5 == 0;
+        keys2[i] = static_cast<int64_t>(rng() % 1000) - 500;
+        payload[i] = std::to_string(i);
+    }
+    Block block;
+    block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(keys1, nulls));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt64>(keys2));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeString>(payload));
+    return block;
+}
+
+static void check_same_keys(const Block& expected, const Block& actual, size_t rows) {
+    ASSERT_EQ(expected.rows(), rows);
+    ASSERT_EQ(actual.rows(), rows);
+    // Rows with equal keys may be in any order, only the keys are compared.
+    for (size_t col = 0; col < 2; ++col) {
+        const auto& expected_column = *expected.get_by_position(col).column;
+        const auto& actual_column = *actual.get_by_position(col).column;
+        for (size_t i = 0; i < rows; ++i) {
+            EXPECT_EQ(expected_column.compare_at(i, i, actual_column, 1), 0) << col << " " << i;
+        }
+    }
+}
+
+static void sort_with_and_without_normalized_key(const SortDescription& description,
+                                                 UInt64 limit) {
+    const size_t rows = 4096;
+    auto origin = config::enable_sort_normalized_key;
+
+    config::enable_sort_normalized_key = false;
+    auto src_block = create_random_block(rows);
+    auto expected = src_block.clone_empty();
+    sort_block(src_block, expected, description, limit);
+
+    config::enable_sort_normalized_key = true;
+    src_block = create_random_block(rows);
+    auto actual = src_block.clone_empty();
+    sort_block(src_block, actual, description, limit);
+    config::enable_sort_normalized_key = origin;
+
+    check_same_keys(expected, actual, limit ? limit : rows);
+}
+
+TEST(SortBlockTest, test_normalized_key_asc) {
+    sort_with_and_without_normalized_key({{0, 1, 1}, {1, 1, 1}}, 0);
+    sort_with_and_without_normalized_key({{0, 1, -1}, {1, 1, -1}}, 0);
+}
+
+TEST(SortBlockTest, test_normalized_key_desc) {
+    sort_with_and_without_normalized_key({{0, -1, 1}, {1, 1, -1}}, 0);
+    sort_with_and_without_normalized_key({{1, -1, -1}, {0, -1, -1}}, 0);
+}
+
+TEST(SortBlockTest, test_normalized_key_limit) {
+    sort_with_and_without_normalized_key({{0, -1, -1}, {1, 1, 1}}, 100);
+}
+
+TEST(SortBlockTest, test_string_prefix) {
+    // strings that tie on the 8 byte prefix, are shorter than it or contain zero bytes
+    std::vector<std::string> keys {"abcdefgh2", "abcdefgh10", "abc", "ab", "", "abcdefgh",
+                                   "b", "abd", "abcdefgh2", "\xff"};
+    keys.emplace_back("abc\0", 4);
+    keys.emplace_back(1, '\0');
+    std::vector<int32_t> values(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        values[i] = static_cast<int32_t>(keys.size() - i);
+    }
+    for (int direction : {1, -1}) {
+        Block block;
+        block.insert(ColumnHelper::create_column_with_name<DataTypeString>(keys));
+        block.insert(ColumnHelper::create_column_with_name<DataTypeInt32>(values));
+        auto sorted = block.clone_empty();
+        sort_block(block, sorted, {{0, direction, 1}, {1, 1, 1}}, 0);
+
+        const auto& key_column = *sorted.get_by_position(0).column;
+        const auto& value_column = *sorted.get_by_position(1).column;
+        for (size_t i = 1; i < keys.size(); ++i) {
+            int res = key_column.compare_at(i - 1, i, key_column, 1) * direction;
+            EXPECT_LE(res, 0) << i;
+            if (res == 0) {
+                EXPECT_LE(value_column.compare_at(i - 1, i, value_column, 1), 0) << i;
+            }
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -235,4 +235,65 @@ TEST_F(ExchangeSInkTest, test_queue_size) {
     }
 }
 
+TEST_F(ExchangeSInkTest, test_broadcast_fanout_end) {
+    {
+        auto state = create_runtime_state();
+        auto buffer = create_buffer(state);
+        buffer->set_broadcast_fanout(
+                {dest_fragment_ins_id_1, dest_fragment_ins_id_2, dest_fragment_ins_id_3});
+        EXPECT_EQ(buffer->_rpc_instances[dest_ins_id_1]->request->broadcast_finst_ids_size(), 2);
+
+        auto sink1 = create_sink(state, buffer);
+        auto sink2 = create_sink(state, buffer);
+        auto sink3 = create_sink(state, buffer);
+        for (auto* sink : {&sink1, &sink2, &sink3}) {
+            EXPECT_EQ(sink->add_block(dest_ins_id_1, true), Status::OK());
+            EXPECT_EQ(sink->add_block(dest_ins_id_2, true), Status::OK());
+            EXPECT_EQ(sink->add_block(dest_ins_id_3, true), Status::OK());
+        }
+        // Only the leader sends rpc, the followers are ended with it.
+        EXPECT_TRUE(done_map[dest_ins_id_2].empty());
+        EXPECT_TRUE(done_map[dest_ins_id_3].empty());
+
+        pop_block(dest_ins_id_1, PopState::accept);
+        pop_block(dest_ins_id_1, PopState::accept);
+        for (const auto& [id, instance] : buffer->_rpc_instances) {
+            EXPECT_EQ(instance->running_sink_count, 1) << "id : " << id;
+            EXPECT_EQ(instance->rpc_channel_is_turn_off, false) << "id : " << id;
+        }
+
+        pop_block(dest_ins_id_1, PopState::eof);
+        for (const auto& [id, instance] : buffer->_rpc_instances) {
+            EXPECT_EQ(instance->rpc_channel_is_turn_off, true) << "id : " << id;
+        }
+        EXPECT_TRUE(sink1.add_block(dest_ins_id_2, true).is<ErrorCode::END_OF_FILE>());
+        clear_all_done();
+    }
+}
+
+TEST(AdaptiveTransmitCodecTest, test_choose) {
+    using segment_v2::CompressionTypePB;
+    AdaptiveTransmitCodec codec;
+    // Probe each codec once before choosing.
+    EXPECT_EQ(codec.choose(CompressionTypePB::LZ4), CompressionTypePB::LZ4);
+    codec.update_compression(CompressionTypePB::LZ4, 1000, 500, 1000);
+    EXPECT_EQ(codec.choose(CompressionTypePB::LZ4), CompressionTypePB::ZSTD);
+    codec.update_compression(CompressionTypePB::ZSTD, 1000, 250, 10000);
+    // No rpc is finished yet, the compression type of the query is used.
+    EXPECT_EQ(codec.choose(CompressionTypePB::LZ4), CompressionTypePB::LZ4);
+
+    // Slow link, 100ns per byte: ZSTD costs 10 + 25, LZ4 costs 1 + 50.
+    codec.update_rpc(1000, 100000);
+    EXPECT_EQ(codec.choose(CompressionTypePB::LZ4), CompressionTypePB::ZSTD);
+
+    // Fast link: sending uncompressed bytes is cheaper than compressing them.
+    AdaptiveTransmitCodec fast_codec;
+    fast_codec.choose(CompressionTypePB::LZ4);
+    fast_codec.update_compression(CompressionTypePB::LZ4, 1000, 900, 1000);
+    fast_codec.choose(CompressionTypePB::LZ4);
+    fast_codec.update_compression(CompressionTypePB::ZSTD, 1000, 800, 10000);
+    fast_codec.update_rpc(1000, 100);
+    EXPECT_EQ(fast_codec.choose(CompressionTypePB::LZ4), CompressionTypePB::NO_COMPRESSION);
+}
+
 } // namespace doris::vectorized
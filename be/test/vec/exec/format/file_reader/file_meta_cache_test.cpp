@@ -151,4 +151,29 @@ TEST(FileMetaCacheTest, InsertAndLookupWithIntValue) {
     EXPECT_EQ(*cached_val2, 12345);
 }
 
+TEST(FileMetaCacheTest, PageIndexCacheChargedBySize) {
+    FileMetaCache cache(1024, 4096);
+    ASSERT_TRUE(cache.page_index_enabled());
+    std::string file_key = FileMetaCache::get_key("/path/to/file.parquet", 1000, 0);
+    std::string key0 = FileMetaCache::get_page_index_key(file_key, 0);
+    std::string key1 = FileMetaCache::get_page_index_key(file_key, 1);
+    EXPECT_NE(key0, key1);
+
+    auto* value = new ParquetPageIndexBuffer();
+    value->column_index.assign(100, 1);
+    value->offset_index.assign(200, 2);
+    {
+        ObjLRUCache::CacheHandle handle;
+        cache.insert_page_index(key0, value, &handle);
+        EXPECT_EQ(handle.data<ParquetPageIndexBuffer>()->offset_index.size(), 200);
+    }
+    ObjLRUCache::CacheHandle handle;
+    ASSERT_TRUE(cache.lookup_page_index(key0, &handle));
+    EXPECT_EQ(handle.data<ParquetPageIndexBuffer>()->column_index[0], 1);
+    EXPECT_FALSE(cache.lookup_page_index(key1, &handle));
+
+    FileMetaCache disabled_cache(1024);
+    EXPECT_FALSE(disabled_cache.page_index_enabled());
+}
+
 } // namespace doris
\ No newline at end of file
@@ -165,4 +165,14 @@ TEST_F(EncloseCsvLineReaderTest, MultiCharDelimiters) {
                      {"\"a|||b\"|||c", "\"d|||e\"|||f"}, {{7}, {7}});
 }
 
+TEST_F(EncloseCsvLineReaderTest, LongFields) {
+    // fields longer than 64 bytes are scanned by the 64-byte match masks
+    const std::string long_value(100, 'x');
+    const std::string quoted = "\"" + std::string(70, 'y') + "\"\"" + std::string(70, 'z') +
+                               "\\\"" + std::string(10, 'w') + ",\"";
+    const std::string line = long_value + "," + quoted + "," + long_value;
+    verify_csv_split(line + "\n" + line, "\n", ",", '"', '\\', false, {line, line},
+                     {{100, 100 + 1 + quoted.size()}, {100, 100 + 1 + quoted.size()}});
+}
+
 } // namespace doris::vectorized
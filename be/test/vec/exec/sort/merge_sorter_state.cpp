@@ -101,4 +101,43 @@ TEST_F(MergeSorterStateTest, test1) {
                                               ColumnHelper::create_block<DataTypeInt64>({5, 6})));
     }
 }
-} // namespace doris::vectorized
\ No newline at end of file
+
+TEST_F(MergeSorterStateTest, test_yield_when_skip_offset) {
+    state.reset(new MergeSorterState(*row_desc, 4));
+    state->add_sorted_block(create_block({1, 2, 3}));
+    state->add_sorted_block(create_block({4, 5, 6}));
+
+    SortDescription desc {SortColumnDescription {0, 1, -1}};
+    EXPECT_TRUE(state->build_merge_tree(desc));
+
+    {
+        // The time slice is already used up, nothing is skipped and it is not eos.
+        _state.set_time_slice_deadline(1);
+        Block block;
+        bool eos = true;
+        Status status = state->merge_sort_read(&block, 2, &eos, &_state);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(block.rows(), 0);
+        EXPECT_FALSE(eos);
+    }
+
+    _state.set_time_slice_deadline(0);
+    {
+        Block block;
+        bool eos = false;
+        Status status = state->merge_sort_read(&block, 2, &eos, &_state);
+        EXPECT_TRUE(status.ok());
+        EXPECT_TRUE(ColumnHelper::block_equal(block,
+                                              ColumnHelper::create_block<DataTypeInt64>({5, 6})));
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        Status status = state->merge_sort_read(&block, 2, &eos, &_state);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(block.rows(), 0);
+        EXPECT_TRUE(eos);
+    }
+}
+} // namespace doris::vectorized
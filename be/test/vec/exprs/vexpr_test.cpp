@@ -41,11 +41,15 @@
 #include "runtime/jsonb_value.h"
 #include "runtime/large_int_value.h"
 #include "runtime/runtime_state.h"
+#include "testutil/column_helper.h"
 #include "testutil/desc_tbl_builder.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_factory.hpp"
+#include "vec/data_types/data_type_number.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vliteral.h"
 #include "vec/runtime/time_value.h"
@@ -741,3 +745,75 @@ TEST(TEST_VEXPR, LITERALTEST) {
         }
     }
 }
+
+namespace doris::vectorized {
+
+// doubles its child and records how many rows it was evaluated on
+class DoubleInt32Expr final : public VExpr {
+public:
+    DoubleInt32Expr() {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+        _data_type = std::make_shared<DataTypeInt32>();
+    }
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        int child_id = -1;
+        RETURN_IF_ERROR(_children[0]->execute(context, block, &child_id));
+        const auto& input =
+                assert_cast<const ColumnInt32&>(*block->get_by_position(child_id).column)
+                        .get_data();
+        auto result = ColumnInt32::create();
+        for (auto value : input) {
+            result->insert_value(value * 2);
+        }
+        evaluated_rows = input.size();
+        *result_column_id = static_cast<int>(block->columns());
+        block->insert({std::move(result), _data_type, _name});
+        return Status::OK();
+    }
+
+    const std::string& expr_name() const override { return _name; }
+
+    size_t evaluated_rows = 0;
+
+private:
+    std::string _name = "double";
+};
+
+TEST(TEST_VEXPR, EXECUTE_ON_SELECTED_ROWS) {
+    auto type = std::make_shared<DataTypeInt32>();
+    auto expr = std::make_shared<DoubleInt32Expr>();
+    expr->add_child(std::make_shared<MockSlotRef>(0, type));
+    EXPECT_TRUE(VExpr::can_execute_on_selected_rows(*expr));
+
+    Block block;
+    block.insert({ColumnHelper::create_column<DataTypeInt32>({1, 2, 3, 4, 5}), type, "a"});
+    IColumn::Filter selected {0, 1, 1, 0, 1};
+    int column_id = -1;
+    ASSERT_TRUE(VExpr::execute_on_selected_rows(nullptr, &block, expr, selected, &column_id).ok());
+    EXPECT_EQ(expr->evaluated_rows, 3);
+    EXPECT_TRUE(ColumnHelper::column_equal(block.get_by_position(column_id).column,
+                                           ColumnHelper::create_column<DataTypeInt32>(
+                                                   {0, 4, 6, 0, 10})));
+
+    // no selected row, the expr is not evaluated at all
+    expr->evaluated_rows = 0;
+    IColumn::Filter none(5, 0);
+    ASSERT_TRUE(VExpr::execute_on_selected_rows(nullptr, &block, expr, none, &column_id).ok());
+    EXPECT_EQ(expr->evaluated_rows, 0);
+    EXPECT_EQ(block.get_by_position(column_id).column->size(), 5);
+}
+
+TEST(TEST_VEXPR, GET_TRUE_ROWS) {
+    IColumn::Filter true_rows;
+    auto condition = ColumnHelper::create_nullable_column<DataTypeUInt8>({1, 0, 1}, {0, 0, 1});
+    ASSERT_TRUE(VExpr::get_true_rows(condition, true_rows));
+    EXPECT_EQ(true_rows.size(), 3);
+    EXPECT_EQ(true_rows[0], 1);
+    EXPECT_EQ(true_rows[1], 0);
+    EXPECT_EQ(true_rows[2], 0);
+
+    EXPECT_FALSE(VExpr::get_true_rows(ColumnHelper::create_column<DataTypeInt32>({1}), true_rows));
+}
+
+} // namespace doris::vectorized
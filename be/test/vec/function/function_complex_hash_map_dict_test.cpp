@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -132,4 +133,44 @@ TEST(ComplexHashMapDictTest, Test1) {
             "dict1");
 }
 
+TEST(ComplexHashMapDictTest, FlatIndex) {
+    auto dense_dict = create_complex_hash_map_dict_from_column(
+            "dict1",
+            ColumnsWithTypeAndName {
+                    create_column_with_data_and_name<DataTypeInt32>({5, 7, 6, 9}, "key")},
+            ColumnsWithTypeAndName {create_column_with_data_and_name<DataTypeString>(
+                    {"e", "g", "f", "i"}, "value")});
+    auto sparse_dict = create_complex_hash_map_dict_from_column(
+            "dict2",
+            ColumnsWithTypeAndName {create_column_with_data_and_name<DataTypeInt32>(
+                    {5, 7, 6, 1000000}, "key")},
+            ColumnsWithTypeAndName {create_column_with_data_and_name<DataTypeString>(
+                    {"e", "g", "f", "i"}, "value")});
+    EXPECT_FALSE(static_cast<ComplexHashMapDictionary*>(dense_dict.get())->_flat_index.empty());
+    EXPECT_TRUE(static_cast<ComplexHashMapDictionary*>(sparse_dict.get())->_flat_index.empty());
+
+    auto key_column = ColumnNullable::create(
+            create_column_with_data<DataTypeInt32>(
+                    {9, 5, 8, 4, std::numeric_limits<Int32>::min(), 7, 6}),
+            ColumnUInt8::create());
+    for (UInt8 is_null : {0, 0, 0, 0, 0, 1, 0}) {
+        key_column->get_null_map_data().push_back(is_null);
+    }
+    ColumnPtrs key_columns {std::move(key_column)};
+    DataTypes key_types {std::make_shared<DataTypeInt32>()};
+    DataTypes attribute_types {std::make_shared<DataTypeString>()};
+
+    auto result = dense_dict->get_tuple_columns({"value"}, attribute_types, key_columns,
+                                                key_types)[0];
+    const auto& nullable_result = assert_cast<const ColumnNullable&>(*result);
+    std::vector<std::string> expected {"i", "e", "", "", "", "", "f"};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(nullable_result.is_null_at(i), expected[i].empty()) << i;
+        if (!expected[i].empty()) {
+            EXPECT_EQ(nullable_result.get_nested_column().get_data_at(i).to_string(),
+                      expected[i]);
+        }
+    }
+}
+
 } // namespace doris::vectorized
@@ -286,8 +286,13 @@ TEST(VGeoFunctionsTest, function_geo_st_contains) {
     EXPECT_TRUE(status == GEO_PARSE_OK);
     point2.encode_to(&buf3);
 
+    // The shapes of the rows change between points and polygons, which are decoded in place only
+    // when the type does not change.
     DataSet data_set = {{{buf1, buf2}, (uint8_t)1},
+                        {{buf1, buf1}, (uint8_t)1},
                         {{buf1, buf3}, (uint8_t)0},
+                        {{buf1, "invalid"}, Null()},
+                        {{buf1, buf2}, (uint8_t)1},
                         {{buf1, Null()}, Null()},
                         {{Null(), buf3}, Null()}};
     {
@@ -825,4 +825,33 @@ TEST(FunctionLikeTest, comprehensive_null_handling) {
             check_function_all_arg_comb<DataTypeUInt8, true>(func_name, input_types, data_set));
 }
 
+TEST(FunctionLikeTest, extract_required_literal) {
+    EXPECT_EQ(FunctionLike::extract_required_literal("%ab%cde_f%"), "cde");
+    EXPECT_EQ(FunctionLike::extract_required_literal("a_c%"), "a");
+    EXPECT_EQ(FunctionLike::extract_required_literal("%x\\%yz%"), "x%yz");
+    EXPECT_EQ(FunctionLike::extract_required_literal("\\\\b_"), "\\b");
+    EXPECT_EQ(FunctionLike::extract_required_literal("%_%"), "");
+}
+
+TEST(FunctionLikeTest, regex_with_required_literal) {
+    std::string func_name = "like";
+
+    // the rows are checked against the required literal "bcd" before the regex runs
+    DataSet data_set = {{{std::string("abcdxe"), std::string("%bcd_e%")}, uint8_t(1)},
+                        {{std::string("abcde"), std::string("%bcd_e%")}, uint8_t(0)},
+                        {{std::string("bc"), std::string("%bcd_e%")}, uint8_t(0)},
+                        {{std::string("dxe"), std::string("%bcd_e%")}, uint8_t(0)},
+                        {{std::string("xbcdbcdye"), std::string("%bcd_e%")}, uint8_t(1)},
+                        {{std::string(""), std::string("%bcd_e%")}, uint8_t(0)},
+                        // repeated values reuse the result of the previous row
+                        {{std::string("zbcdye"), std::string("%bcd_e%")}, uint8_t(1)},
+                        {{std::string("zbcdye"), std::string("%bcd_e%")}, uint8_t(1)},
+                        {{std::string("zbcdy"), std::string("%bcd_e%")}, uint8_t(0)},
+                        {{std::string("zbcdy"), std::string("%bcd_e%")}, uint8_t(0)}};
+
+    InputTypeSet input_types = {PrimitiveType::TYPE_VARCHAR, PrimitiveType::TYPE_VARCHAR};
+    static_cast<void>(
+            check_function_all_arg_comb<DataTypeUInt8, true>(func_name, input_types, data_set));
+}
+
 } // namespace doris::vectorized
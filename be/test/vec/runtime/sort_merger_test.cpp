@@ -471,9 +471,10 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
         }
         EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
         EXPECT_EQ(merger->_priority_queue.size(), 1);
-        EXPECT_EQ(merger->_priority_queue.top()->pos, 0);
-        EXPECT_EQ(merger->_priority_queue.top()->rows, 1);
-        EXPECT_EQ(merger->_priority_queue.top()->block_ptr()->rows(), 1);
+        auto& top = *merger->_priority_queue.current().first;
+        EXPECT_EQ(top->pos, 0);
+        EXPECT_EQ(top->rows, 1);
+        EXPECT_EQ(top->block_ptr()->rows(), 1);
     }
     {
         vectorized::Block block;
@@ -485,4 +486,61 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+TEST(SortMergerTest, TEST_BATCH_RUNS) {
+    /**
+     * in: [([0, 1, 2, 10, 11], eos = true)]
+     *     [([3, 4, 5, 6, 12], eos = true)]
+     *     offset = 0, limit = -1, ASC
+     * out: [0, 1, 2, 3, 4, 5, 6, 10], [11, 12]
+     */
+    const int batch_size = 8;
+    std::vector<std::vector<int64_t>> inputs = {{0, 1, 2, 10, 11}, {3, 4, 5, 6, 12}};
+
+    std::unique_ptr<VSortedRunMerger> merger;
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    {
+        std::vector<bool> is_asc_order = {true};
+        std::vector<bool> nulls_first = {false};
+        merger.reset(new VSortedRunMerger(ordering_expr, is_asc_order, nulls_first, batch_size, -1,
+                                          0, profile.get()));
+    }
+    {
+        std::vector<vectorized::BlockSupplier> child_block_suppliers;
+        for (const auto& input : inputs) {
+            child_block_suppliers.emplace_back([input](vectorized::Block* block, bool* eos) {
+                *block = ColumnHelper::create_block<DataTypeInt64>(input);
+                *eos = true;
+                return Status::OK();
+            });
+        }
+        EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
+    }
+    {
+        vectorized::Block block;
+        bool eos = false;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        EXPECT_TRUE(ColumnHelper::column_equal(
+                block.get_by_position(0).column,
+                ColumnHelper::create_column<DataTypeInt64>({0, 1, 2, 3, 4, 5, 6, 10})));
+        EXPECT_FALSE(eos);
+    }
+    {
+        vectorized::Block block;
+        bool eos = false;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        EXPECT_TRUE(ColumnHelper::column_equal(
+                block.get_by_position(0).column,
+                ColumnHelper::create_column<DataTypeInt64>({11, 12})));
+        EXPECT_FALSE(eos);
+    }
+    {
+        vectorized::Block block;
+        bool eos = false;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        EXPECT_EQ(block.rows(), 0);
+        EXPECT_TRUE(eos);
+    }
+}
+
+} // namespace doris::vectorized
@@ -95,6 +95,10 @@ CONF_Bool(enable_checker, "false");
 // The parallelism for parallel recycle operation
 // s3_producer_pool recycle_tablet_pool, delete single object in this pool
 CONF_Int32(recycle_pool_parallelism, "40");
+// Max number of files deleted by one task when recycling rowset data, the files of a storage
+// vault are split into tasks of this size and deleted concurrently in s3_producer_pool.
+// 0 means deleting all files of a storage vault in a single task.
+CONF_mInt32(recycle_delete_files_batch_size, "0");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
 // Currently only used for recycler test
@@ -176,6 +180,9 @@ CONF_mBool(snapshot_get_tablet_stats, "true");
 
 // Value codec version
 CONF_mInt16(meta_schema_value_version, "1");
+// Max number of tablet schemas cached in process for get_tablet/get_rowset, 0 to disable.
+// Schema kvs are never rewritten once saved, so the cached entries need no invalidation.
+CONF_mInt64(tablet_schema_cache_capacity, "0");
 
 // Limit kv size of Schema SchemaDictKeyList, default 5MB
 CONF_mInt32(schema_dict_kv_size_limit, "5242880");
@@ -282,6 +289,10 @@ CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_mInt64(txn_lazy_max_rowsets_per_batch, "1000");
+// Whether to queue the commit_txn of the same partitions within a meta service process. The
+// concurrent commits of a partition always conflict on its version key and are retried with
+// backoff, queueing turns the conflicts into short waits.
+CONF_mBool(enable_commit_txn_partition_lock, "false");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
 CONF_Int32(max_restore_job_rowsets_per_batch, "1000");
@@ -981,6 +981,9 @@ void internal_get_tablet(MetaServiceCode& code, std::string& msg, const std::str
         }
         auto key = meta_schema_key(
                 {instance_id, tablet_meta->index_id(), tablet_meta->schema_version()});
+        if (TabletSchemaCache::instance().get(key, tablet_meta->mutable_schema())) {
+            return;
+        }
         ValueBuf val_buf;
         err = cloud::blob_get(txn, key, &val_buf);
         if (err != TxnErrorCode::TXN_OK) {
@@ -995,6 +998,7 @@ void internal_get_tablet(MetaServiceCode& code, std::string& msg, const std::str
             msg = fmt::format("malformed schema value, key={}", key);
             return;
         }
+        TabletSchemaCache::instance().put(key, tablet_meta->schema());
     }
 }
 
@@ -1002,8 +1006,12 @@ static bool try_fetch_and_parse_schema(Transaction* txn, TabletSchemaCloudPB* sc
                                        const std::string& instance_id, int64_t index_id,
                                        int64_t schema_version, MetaServiceCode& code,
                                        std::string& msg, bool is_versioned_read) {
+    // The versioned and unversioned schema kvs hold the same schema, share the cache entry
+    std::string key = meta_schema_key({instance_id, index_id, schema_version});
+    if (TabletSchemaCache::instance().get(key, schema)) {
+        return true;
+    }
     if (!is_versioned_read) {
-        std::string key = meta_schema_key({instance_id, index_id, schema_version});
         ValueBuf val_buf;
         TxnErrorCode err = cloud::blob_get(txn, key, &val_buf);
         if (err != TxnErrorCode::TXN_OK) {
@@ -1025,6 +1033,7 @@ static bool try_fetch_and_parse_schema(Transaction* txn, TabletSchemaCloudPB* sc
             return false;
         }
     }
+    TabletSchemaCache::instance().put(key, *schema);
     return true;
 }
 
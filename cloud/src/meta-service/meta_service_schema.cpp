@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "common/bvars.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/util.h"
@@ -42,6 +43,72 @@
 namespace doris::cloud {
 namespace config {
 extern int16_t meta_schema_value_version;
+extern int64_t tablet_schema_cache_capacity;
+}
+
+TabletSchemaCache& TabletSchemaCache::instance() {
+    static TabletSchemaCache cache;
+    return cache;
+}
+
+bool TabletSchemaCache::get(std::string_view key, doris::TabletSchemaCloudPB* schema) {
+    if (config::tablet_schema_cache_capacity <= 0) {
+        return false;
+    }
+    std::shared_ptr<const doris::TabletSchemaCloudPB> cached;
+    {
+        auto& s = shard(key);
+        std::lock_guard lock(s.mutex);
+        auto it = s.map.find(key);
+        if (it == s.map.end()) {
+            g_bvar_tablet_schema_cache_miss_counter << 1;
+            return false;
+        }
+        s.lru.splice(s.lru.begin(), s.lru, it->second);
+        cached = it->second->second;
+    }
+    g_bvar_tablet_schema_cache_hit_counter << 1;
+    // Copy outside the lock, a schema may have thousands of columns
+    schema->CopyFrom(*cached);
+    return true;
+}
+
+void TabletSchemaCache::put(std::string_view key, const doris::TabletSchemaCloudPB& schema) {
+    int64_t capacity = config::tablet_schema_cache_capacity;
+    if (capacity <= 0) {
+        return;
+    }
+    size_t shard_capacity = std::max<size_t>(1, static_cast<size_t>(capacity) / NUM_SHARDS);
+    auto value = std::make_shared<const doris::TabletSchemaCloudPB>(schema);
+    auto& s = shard(key);
+    std::lock_guard lock(s.mutex);
+    if (auto it = s.map.find(key); it != s.map.end()) {
+        s.lru.splice(s.lru.begin(), s.lru, it->second);
+        return;
+    }
+    s.lru.emplace_front(std::string(key), std::move(value));
+    s.map.emplace(s.lru.front().first, s.lru.begin());
+    while (s.lru.size() > shard_capacity) {
+        s.map.erase(s.lru.back().first);
+        s.lru.pop_back();
+    }
+}
+
+void TabletSchemaCache::clear() {
+    for (auto& s : shards_) {
+        std::lock_guard lock(s.mutex);
+        s.map.clear();
+        s.lru.clear();
+    }
+}
+
+size_t TabletSchemaCache::size() {
+    size_t n = 0;
+    for (auto& s : shards_) {
+        std::lock_guard lock(s.mutex);
+        n += s.lru.size();
+    }
+    return n;
 }
 
 constexpr static const char* VARIANT_TYPE_NAME = "VARIANT";
@@ -20,10 +20,55 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 namespace doris::cloud {
 class Transaction;
 struct ValueBuf;
 
+// A bounded in-process LRU cache of tablet schemas, keyed by the encoded meta schema key.
+//
+// A schema kv is identified by (instance_id, index_id, schema_version) and is never rewritten
+// once saved (see `put_schema_kv`), so a cached entry is always consistent with the meta-store
+// and needs no invalidation. The capacity is `config::tablet_schema_cache_capacity`, 0 disables
+// the cache.
+class TabletSchemaCache {
+public:
+    static TabletSchemaCache& instance();
+
+    // Return true and fill `schema` if the schema of `key` is cached.
+    bool get(std::string_view key, doris::TabletSchemaCloudPB* schema);
+
+    void put(std::string_view key, const doris::TabletSchemaCloudPB& schema);
+
+    void clear();
+
+    size_t size();
+
+private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Shard {
+        using Entry = std::pair<std::string, std::shared_ptr<const doris::TabletSchemaCloudPB>>;
+
+        std::mutex mutex;
+        std::list<Entry> lru; // The most recently used entry is at the front
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> map;
+    };
+
+    Shard& shard(std::string_view key) {
+        return shards_[std::hash<std::string_view> {}(key) % NUM_SHARDS];
+    }
+
+    std::array<Shard, NUM_SHARDS> shards_;
+};
+
 void put_schema_kv(MetaServiceCode& code, std::string& msg, Transaction* txn,
                    std::string_view schema_key, const doris::TabletSchemaCloudPB& schema);
 
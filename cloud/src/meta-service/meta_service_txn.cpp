@@ -15,9 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bthread/mutex.h>
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <limits>
@@ -1137,6 +1140,47 @@ std::pair<MetaServiceCode, std::string> get_partition_versions(
  * Note: getting version and all changes maded are in a single TxnKv transaction:
  *       step 5, 6, 7, 8
  */
+// Striped locks that queue the commits of the same partitions within this process.
+//
+// Commits of disjoint partitions take disjoint stripes (modulo hash collisions) and run
+// concurrently, the stripes are always locked in ascending order to avoid deadlocks.
+class PartitionCommitLockGuard {
+public:
+    PartitionCommitLockGuard(
+            const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowsets_meta) {
+        if (!config::enable_commit_txn_partition_lock) {
+            return;
+        }
+        for (auto& [_, rowset_meta] : tmp_rowsets_meta) {
+            stripes_.push_back(static_cast<size_t>(rowset_meta.partition_id()) % NUM_STRIPES);
+        }
+        std::sort(stripes_.begin(), stripes_.end());
+        stripes_.erase(std::unique(stripes_.begin(), stripes_.end()), stripes_.end());
+        for (size_t stripe : stripes_) {
+            locks()[stripe].lock();
+        }
+    }
+
+    ~PartitionCommitLockGuard() {
+        for (auto it = stripes_.rbegin(); it != stripes_.rend(); ++it) {
+            locks()[*it].unlock();
+        }
+    }
+
+    PartitionCommitLockGuard(const PartitionCommitLockGuard&) = delete;
+    PartitionCommitLockGuard& operator=(const PartitionCommitLockGuard&) = delete;
+
+private:
+    static constexpr size_t NUM_STRIPES = 1024;
+
+    static std::array<bthread::Mutex, NUM_STRIPES>& locks() {
+        static std::array<bthread::Mutex, NUM_STRIPES> locks;
+        return locks;
+    }
+
+    std::vector<size_t> stripes_;
+};
+
 void MetaServiceImpl::commit_txn_immediately(
         const CommitTxnRequest* request, CommitTxnResponse* response, MetaServiceCode& code,
         std::string& msg, const std::string& instance_id, int64_t db_id,
@@ -1145,6 +1189,9 @@ void MetaServiceImpl::commit_txn_immediately(
     std::stringstream ss;
     int64_t txn_id = request->txn_id();
 
+    // Queue behind the in-flight commits of the same partitions instead of conflicting with them
+    PartitionCommitLockGuard partition_lock_guard(tmp_rowsets_meta);
+
     bool is_versioned_write = is_version_write_enabled(instance_id);
     bool is_versioned_read = is_version_read_enabled(instance_id);
     do {
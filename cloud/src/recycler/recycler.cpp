@@ -33,6 +33,7 @@
 #include <cstdlib>
 #include <deque>
 #include <initializer_list>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <string_view>
@@ -1859,8 +1860,11 @@ int InstanceRecycler::delete_rowset_data(
         const std::map<std::string, doris::RowsetMetaCloudPB>& rowsets, RowsetRecyclingState type,
         RecyclerMetricsContext& metrics_context) {
     int ret = 0;
-    // resource_id -> file_paths
-    std::map<std::string, std::vector<std::string>> resource_file_paths;
+    // resource_id -> batches of file_paths, the files of a rowset are always in the same batch
+    std::map<std::string, std::vector<std::vector<std::string>>> resource_file_paths;
+    size_t batch_size = config::recycle_delete_files_batch_size > 0
+                                ? static_cast<size_t>(config::recycle_delete_files_batch_size)
+                                : std::numeric_limits<size_t>::max();
     // (resource_id, tablet_id, rowset_id)
     std::vector<std::tuple<std::string, int64_t, std::string>> rowsets_delete_by_prefix;
     bool is_formal_rowset = (type == RowsetRecyclingState::FORMAL_ROWSET);
@@ -1885,7 +1889,11 @@ int InstanceRecycler::delete_rowset_data(
             continue;
         }
 
-        auto& file_paths = resource_file_paths[rs.resource_id()];
+        auto& batches = resource_file_paths[rs.resource_id()];
+        if (batches.empty() || batches.back().size() >= batch_size) {
+            batches.emplace_back();
+        }
+        auto& file_paths = batches.back();
         const auto& rowset_id = rs.rowset_id_v2();
         int64_t tablet_id = rs.tablet_id();
         int64_t num_segments = rs.num_segments();
@@ -1986,16 +1994,25 @@ int InstanceRecycler::delete_rowset_data(
     SyncExecutor<int> concurrent_delete_executor(_thread_pool_group.s3_producer_pool,
                                                  "delete_rowset_data",
                                                  [](const int& ret) { return ret != 0; });
-    for (auto& [resource_id, file_paths] : resource_file_paths) {
-        concurrent_delete_executor.add([&, rid = &resource_id, paths = &file_paths]() -> int {
+    // (resource_id, file_paths) of each delete task
+    std::vector<std::pair<const std::string*, const std::vector<std::string>*>> delete_tasks;
+    for (auto& [resource_id, batches] : resource_file_paths) {
+        for (auto& file_paths : batches) {
+            if (!file_paths.empty()) {
+                delete_tasks.emplace_back(&resource_id, &file_paths);
+            }
+        }
+    }
+    for (auto [rid, paths] : delete_tasks) {
+        concurrent_delete_executor.add([&, rid, paths]() -> int {
             DCHECK(accessor_map_.count(*rid))
                     << "uninitilized accessor, instance_id=" << instance_id_
-                    << " resource_id=" << resource_id << " path[0]=" << (*paths)[0];
+                    << " resource_id=" << *rid << " path[0]=" << (*paths)[0];
             TEST_SYNC_POINT_CALLBACK("InstanceRecycler::delete_rowset_data.no_resource_id",
                                      &accessor_map_);
             if (!accessor_map_.contains(*rid)) {
                 LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
-                        .tag("resource_id", resource_id)
+                        .tag("resource_id", *rid)
                         .tag("instance_id", instance_id_);
                 return -1;
             }
@@ -25,6 +25,7 @@
 #include <google/protobuf/repeated_field.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -1871,6 +1872,56 @@ TEST(MetaServiceTest, CommitTxnTest) {
     }
 }
 
+TEST(MetaServiceTest, CommitTxnPartitionLockTest) {
+    auto meta_service = get_meta_service();
+    config::enable_commit_txn_partition_lock = true;
+    DORIS_CLOUD_DEFER {
+        config::enable_commit_txn_partition_lock = false;
+    };
+    int64_t db_id = 1;
+    int64_t table_id = 12340;
+    int64_t index_id = 12341;
+    int64_t partition_id = 12342;
+    int64_t tablet_id = 12343;
+    ASSERT_NO_FATAL_FAILURE(
+            create_tablet(meta_service.get(), table_id, index_id, partition_id, tablet_id));
+
+    constexpr int num_txns = 8;
+    std::vector<int64_t> txn_ids(num_txns);
+    for (int i = 0; i < num_txns; ++i) {
+        std::string label = "commit_txn_partition_lock_" + std::to_string(i);
+        ASSERT_NO_FATAL_FAILURE(begin_txn(meta_service.get(), db_id, label, table_id, txn_ids[i]));
+        auto tmp_rowset = create_rowset(txn_ids[i], tablet_id, partition_id);
+        CreateRowsetResponse res;
+        commit_rowset(meta_service.get(), tmp_rowset, res);
+        ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    }
+
+    // The concurrent commits of the same partition are queued, each gets its own version
+    std::vector<int64_t> versions(num_txns, -1);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_txns; ++i) {
+        threads.emplace_back([&, i]() {
+            brpc::Controller cntl;
+            CommitTxnRequest req;
+            CommitTxnResponse res;
+            req.set_db_id(db_id);
+            req.set_txn_id(txn_ids[i]);
+            meta_service->commit_txn(&cntl, &req, &res, nullptr);
+            if (res.status().code() == MetaServiceCode::OK && res.versions_size() == 1) {
+                versions[i] = res.versions(0);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    std::sort(versions.begin(), versions.end());
+    for (int i = 0; i < num_txns; ++i) {
+        ASSERT_EQ(versions[i], i + 2);
+    }
+}
+
 TEST(MetaServiceTest, CommitTxnExpiredTest) {
     auto meta_service = get_meta_service();
 
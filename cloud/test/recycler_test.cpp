@@ -4997,6 +4997,56 @@ TEST(RecyclerTest, delete_rowset_data) {
     }
 }
 
+TEST(RecyclerTest, delete_rowset_data_in_batches) {
+    auto txn_kv = std::make_shared<MemTxnKv>();
+    ASSERT_EQ(txn_kv->init(), 0);
+
+    std::string resource_id = "delete_rowset_data_in_batches";
+    InstanceInfoPB instance;
+    instance.set_instance_id(instance_id);
+    auto obj_info = instance.add_obj_info();
+    obj_info->set_id(resource_id);
+    obj_info->set_ak(config::test_s3_ak);
+    obj_info->set_sk(config::test_s3_sk);
+    obj_info->set_endpoint(config::test_s3_endpoint);
+    obj_info->set_region(config::test_s3_region);
+    obj_info->set_bucket(config::test_s3_bucket);
+    obj_info->set_prefix(resource_id);
+
+    doris::TabletSchemaCloudPB schema;
+    schema.set_schema_version(1);
+    schema.set_inverted_index_storage_format(InvertedIndexStorageFormatPB::V1);
+    auto index = schema.add_index();
+    index->set_index_id(1);
+    index->set_index_type(IndexType::INVERTED);
+
+    // Each rowset has 11 files, every batch holds the files of a single rowset
+    config::recycle_delete_files_batch_size = 3;
+    DORIS_CLOUD_DEFER {
+        config::recycle_delete_files_batch_size = 0;
+    };
+
+    InstanceRecycler recycler(txn_kv, instance, thread_group,
+                              std::make_shared<TxnLazyCommitter>(txn_kv));
+    ASSERT_EQ(recycler.init(), 0);
+    auto accessor = recycler.accessor_map_.begin()->second;
+    constexpr int index_id = 30001, tablet_id = 30002;
+    std::map<std::string, doris::RowsetMetaCloudPB> rowset_pbs;
+    for (int i = 0; i < 50; ++i) {
+        auto rowset = create_rowset(resource_id, tablet_id, index_id, 5, schema);
+        create_recycle_rowset(txn_kv.get(), accessor.get(), rowset, RecycleRowsetPB::COMPACT,
+                              true, false);
+        rowset_pbs.emplace(rowset.rowset_id_v2(), std::move(rowset));
+    }
+    RecyclerMetricsContext metrics_context(instance_id, "delete_rowset_data_in_batches");
+    ASSERT_EQ(0, recycler.delete_rowset_data(rowset_pbs, RowsetRecyclingState::FORMAL_ROWSET,
+                                             metrics_context));
+    ASSERT_EQ(metrics_context.total_recycled_num.load(), 50U);
+    std::unique_ptr<ListIterator> list_iter;
+    ASSERT_EQ(0, accessor->list_all(&list_iter));
+    ASSERT_FALSE(list_iter->has_next());
+}
+
 TEST(RecyclerTest, delete_rowset_data_without_inverted_index_storage_format) {
     auto txn_kv = std::make_shared<MemTxnKv>();
     ASSERT_EQ(txn_kv->init(), 0);
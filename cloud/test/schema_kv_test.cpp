@@ -876,4 +876,40 @@ TEST(AlterSchemaKVTest, AlterDisableAutoCompactionTest) {
     }
 }
 
+TEST(TabletSchemaCacheTest, PutGetEvictTest) {
+    auto& cache = TabletSchemaCache::instance();
+    cache.clear();
+    auto defer = std::make_unique<std::function<void()>>([&]() {
+        config::tablet_schema_cache_capacity = 0;
+        cache.clear();
+    });
+
+    std::string key = meta_schema_key({instance_id, 30001, 1});
+    doris::TabletSchemaCloudPB schema;
+    fill_schema(&schema, 1);
+    doris::TabletSchemaCloudPB cached;
+
+    // Disabled by default
+    config::tablet_schema_cache_capacity = 0;
+    cache.put(key, schema);
+    ASSERT_FALSE(cache.get(key, &cached));
+    ASSERT_EQ(cache.size(), 0U);
+
+    config::tablet_schema_cache_capacity = 16;
+    ASSERT_FALSE(cache.get(key, &cached));
+    cache.put(key, schema);
+    ASSERT_TRUE(cache.get(key, &cached));
+    ASSERT_EQ(cached.SerializeAsString(), schema.SerializeAsString());
+
+    // Each shard keeps at most capacity / 16 = 1 entry, the total never exceeds the capacity
+    for (int64_t i = 0; i < 100; ++i) {
+        cache.put(meta_schema_key({instance_id, 30002, i}), schema);
+    }
+    ASSERT_LE(cache.size(), 16U);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0U);
+    ASSERT_FALSE(cache.get(key, &cached));
+}
+
 } // namespace doris::cloud